@@ -0,0 +1,88 @@
+// ACPI system description tables.
+// Only used to find tables the firmware describes devices with, the
+// machine is still set up from the MP tables (mp.c).
+
+#include "types.h"
+#include "defs.h"
+#include "memlayout.h"
+#include "acpi.h"
+
+static uchar
+sum(uchar *addr, int len)
+{
+  int i, sum;
+
+  sum = 0;
+  for(i=0; i<len; i++)
+    sum += addr[i];
+  return sum;
+}
+
+// Look for the RSDP in the len bytes at physical address a.
+static struct acpi_rsdp*
+rsdpsearch1(uint a, int len)
+{
+  uchar *e, *p, *addr;
+
+  addr = P2V(a);
+  e = addr+len;
+  for(p = addr; p < e; p += 16)
+    if(memcmp(p, "RSD PTR ", 8) == 0 && sum(p, 20) == 0)
+      return (struct acpi_rsdp*)p;
+  return 0;
+}
+
+// The RSDP is on a 16 byte boundary in the first KB of the EBDA or
+// in the BIOS ROM between 0xE0000 and 0xFFFFF.
+static struct acpi_rsdp*
+rsdpsearch(void)
+{
+  uchar *bda;
+  uint p;
+  struct acpi_rsdp *rsdp;
+
+  bda = (uchar *) P2V(0x400);
+  if((p = ((bda[0x0F]<<8)| bda[0x0E]) << 4))
+    if((rsdp = rsdpsearch1(p, 1024)))
+      return rsdp;
+  return rsdpsearch1(0xE0000, 0x20000);
+}
+
+// Map the table at physical address pa. The tables are usually at the
+// top of memory, above what the kernel maps.
+static struct acpi_header*
+maptable(uint pa)
+{
+  struct acpi_header *h;
+
+  if((h = ioremap(pa, sizeof(*h), IOREMAP_WB)) == 0)
+    return 0;
+  if((h = ioremap(pa, h->length, IOREMAP_WB)) == 0 || sum((uchar*)h, h->length) != 0)
+    return 0;
+  return h;
+}
+
+// Return the table with signature sig, or 0 if the firmware doesn't
+// have one. Only for use while booting, see ioremap.
+void*
+acpitable(char *sig)
+{
+  struct acpi_rsdp *rsdp;
+  struct acpi_rsdt *rsdt;
+  struct acpi_header *h;
+  int i, n;
+
+  if((rsdp = rsdpsearch()) == 0)
+    return 0;
+  if((rsdt = (struct acpi_rsdt*)maptable(rsdp->rsdt)) == 0 ||
+     memcmp(rsdt->h.signature, "RSDT", 4) != 0)
+    return 0;
+
+  n = (rsdt->h.length - sizeof(rsdt->h)) / sizeof(rsdt->entry[0]);
+  for(i = 0; i < n; i++){
+    h = ioremap(rsdt->entry[i], sizeof(*h), IOREMAP_WB);
+    if(h && memcmp(h->signature, sig, 4) == 0)
+      return maptable(rsdt->entry[i]);
+  }
+  return 0;
+}
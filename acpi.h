@@ -0,0 +1,52 @@
+// ACPI system description tables, see the ACPI specification 5.2.
+
+// Root System Description Pointer, found by scanning low memory.
+struct acpi_rsdp {
+  uchar signature[8];         // "RSD PTR "
+  uchar checksum;             // of the first 20 bytes
+  uchar oemid[6];
+  uchar revision;
+  uint rsdt;                  // physical address of the RSDT
+  uint length;                // revision 2 and up from here on
+  uint xsdt_lo;
+  uint xsdt_hi;
+  uchar xchecksum;
+  uchar reserved[3];
+} __attribute__((packed));
+
+// Header of every other table.
+struct acpi_header {
+  uchar signature[4];
+  uint length;                // of the whole table, header included
+  uchar revision;
+  uchar checksum;             // of the whole table
+  uchar oemid[6];
+  uchar oemtableid[8];
+  uint oemrevision;
+  uint creatorid;
+  uint creatorrevision;
+} __attribute__((packed));
+
+// The RSDT is a header followed by the physical addresses of the
+// other tables.
+struct acpi_rsdt {
+  struct acpi_header h;
+  uint entry[];
+} __attribute__((packed));
+
+// MCFG, where the PCI express memory mapped configuration space
+// (ECAM) of each PCI segment is.
+struct acpi_mcfg_entry {
+  uint base_lo;               // of bus 0, even if start_bus isn't
+  uint base_hi;
+  ushort segment;
+  uchar start_bus;
+  uchar end_bus;
+  uint reserved;
+} __attribute__((packed));
+
+struct acpi_mcfg {
+  struct acpi_header h;
+  uchar reserved[8];
+  struct acpi_mcfg_entry entry[];
+} __attribute__((packed));
@@ -6,6 +6,7 @@
 
 #include "types.h"
 #include "defs.h"
+#include "spinlock.h"
 #include "arp_frame.h"
 #include "nic.h"
 
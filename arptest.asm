@@ -0,0 +1,1392 @@
+
+_arptest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "types.h"
+#include "user.h"
+
+int main(void) {
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 14             	sub    $0x14,%esp
+  int MAC_SIZE = 18;
+  11:	c7 45 f4 12 00 00 00 	movl   $0x12,-0xc(%ebp)
+  char* ip = "192.168.2.1";
+  18:	c7 45 f0 aa 0a 00 00 	movl   $0xaaa,-0x10(%ebp)
+  char* mac = malloc(MAC_SIZE);
+  1f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  22:	83 ec 0c             	sub    $0xc,%esp
+  25:	50                   	push   %eax
+  26:	e8 9c 09 00 00       	call   9c7 <malloc>
+  2b:	83 c4 10             	add    $0x10,%esp
+  2e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(arp("mynet0", ip, mac, MAC_SIZE) < 0) {
+  31:	ff 75 f4             	push   -0xc(%ebp)
+  34:	ff 75 ec             	push   -0x14(%ebp)
+  37:	ff 75 f0             	push   -0x10(%ebp)
+  3a:	68 b6 0a 00 00       	push   $0xab6
+  3f:	e8 6f 05 00 00       	call   5b3 <arp>
+  44:	83 c4 10             	add    $0x10,%esp
+  47:	85 c0                	test   %eax,%eax
+  49:	79 15                	jns    60 <main+0x60>
+    printf(1, "ARP for IP:%s Failed.\n", ip);
+  4b:	83 ec 04             	sub    $0x4,%esp
+  4e:	ff 75 f0             	push   -0x10(%ebp)
+  51:	68 bd 0a 00 00       	push   $0xabd
+  56:	6a 01                	push   $0x1
+  58:	e8 72 06 00 00       	call   6cf <printf>
+  5d:	83 c4 10             	add    $0x10,%esp
+  }
+  exit();
+  60:	e8 ae 04 00 00       	call   513 <exit>
+
+00000065 <stosb>:
+}
+
+int
+stat(char *n, struct stat *st)
+{
+  int fd;
+  65:	55                   	push   %ebp
+  66:	89 e5                	mov    %esp,%ebp
+  68:	57                   	push   %edi
+  69:	53                   	push   %ebx
+  int r;
+  6a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  6d:	8b 55 10             	mov    0x10(%ebp),%edx
+  70:	8b 45 0c             	mov    0xc(%ebp),%eax
+  73:	89 cb                	mov    %ecx,%ebx
+  75:	89 df                	mov    %ebx,%edi
+  77:	89 d1                	mov    %edx,%ecx
+  79:	fc                   	cld
+  7a:	f3 aa                	rep stos %al,%es:(%edi)
+  7c:	89 ca                	mov    %ecx,%edx
+  7e:	89 fb                	mov    %edi,%ebx
+  80:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  83:	89 55 10             	mov    %edx,0x10(%ebp)
+
+  fd = open(n, O_RDONLY);
+  if(fd < 0)
+    return -1;
+  86:	90                   	nop
+  87:	5b                   	pop    %ebx
+  88:	5f                   	pop    %edi
+  89:	5d                   	pop    %ebp
+  8a:	c3                   	ret
+
+0000008b <strcpy>:
+{
+  8b:	55                   	push   %ebp
+  8c:	89 e5                	mov    %esp,%ebp
+  8e:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+  91:	8b 45 08             	mov    0x8(%ebp),%eax
+  94:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  97:	90                   	nop
+  98:	8b 55 0c             	mov    0xc(%ebp),%edx
+  9b:	8d 42 01             	lea    0x1(%edx),%eax
+  9e:	89 45 0c             	mov    %eax,0xc(%ebp)
+  a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  a4:	8d 48 01             	lea    0x1(%eax),%ecx
+  a7:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  aa:	0f b6 12             	movzbl (%edx),%edx
+  ad:	88 10                	mov    %dl,(%eax)
+  af:	0f b6 00             	movzbl (%eax),%eax
+  b2:	84 c0                	test   %al,%al
+  b4:	75 e2                	jne    98 <strcpy+0xd>
+  return os;
+  b6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  b9:	c9                   	leave
+  ba:	c3                   	ret
+
+000000bb <strlen>:
+{
+  bb:	55                   	push   %ebp
+  bc:	89 e5                	mov    %esp,%ebp
+  be:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+  c1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  c8:	eb 04                	jmp    ce <strlen+0x13>
+  ca:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  ce:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  d4:	01 d0                	add    %edx,%eax
+  d6:	0f b6 00             	movzbl (%eax),%eax
+  d9:	84 c0                	test   %al,%al
+  db:	75 ed                	jne    ca <strlen+0xf>
+  return n;
+  dd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  e0:	c9                   	leave
+  e1:	c3                   	ret
+
+000000e2 <memset>:
+{
+  e2:	55                   	push   %ebp
+  e3:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+  e5:	8b 45 10             	mov    0x10(%ebp),%eax
+  e8:	50                   	push   %eax
+  e9:	ff 75 0c             	push   0xc(%ebp)
+  ec:	ff 75 08             	push   0x8(%ebp)
+  ef:	e8 71 ff ff ff       	call   65 <stosb>
+  f4:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+  f7:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+  fa:	c9                   	leave
+  fb:	c3                   	ret
+
+000000fc <strchr>:
+{
+  fc:	55                   	push   %ebp
+  fd:	89 e5                	mov    %esp,%ebp
+  ff:	83 ec 04             	sub    $0x4,%esp
+ 102:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 105:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 108:	eb 14                	jmp    11e <strchr+0x22>
+    if(*s == c)
+ 10a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 10d:	0f b6 00             	movzbl (%eax),%eax
+ 110:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 113:	75 05                	jne    11a <strchr+0x1e>
+      return (char*)s;
+ 115:	8b 45 08             	mov    0x8(%ebp),%eax
+ 118:	eb 13                	jmp    12d <strchr+0x31>
+  for(; *s; s++)
+ 11a:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 11e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 121:	0f b6 00             	movzbl (%eax),%eax
+ 124:	84 c0                	test   %al,%al
+ 126:	75 e2                	jne    10a <strchr+0xe>
+  return 0;
+ 128:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 12d:	c9                   	leave
+ 12e:	c3                   	ret
+
+0000012f <gets>:
+{
+ 12f:	55                   	push   %ebp
+ 130:	89 e5                	mov    %esp,%ebp
+ 132:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 135:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 13c:	eb 42                	jmp    180 <gets+0x51>
+    cc = read(0, &c, 1);
+ 13e:	83 ec 04             	sub    $0x4,%esp
+ 141:	6a 01                	push   $0x1
+ 143:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 146:	50                   	push   %eax
+ 147:	6a 00                	push   $0x0
+ 149:	e8 dd 03 00 00       	call   52b <read>
+ 14e:	83 c4 10             	add    $0x10,%esp
+ 151:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 154:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 158:	7e 33                	jle    18d <gets+0x5e>
+    buf[i++] = c;
+ 15a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 15d:	8d 50 01             	lea    0x1(%eax),%edx
+ 160:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 163:	89 c2                	mov    %eax,%edx
+ 165:	8b 45 08             	mov    0x8(%ebp),%eax
+ 168:	01 c2                	add    %eax,%edx
+ 16a:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 16e:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 170:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 174:	3c 0a                	cmp    $0xa,%al
+ 176:	74 16                	je     18e <gets+0x5f>
+ 178:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 17c:	3c 0d                	cmp    $0xd,%al
+ 17e:	74 0e                	je     18e <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 180:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 183:	83 c0 01             	add    $0x1,%eax
+ 186:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 189:	7f b3                	jg     13e <gets+0xf>
+ 18b:	eb 01                	jmp    18e <gets+0x5f>
+      break;
+ 18d:	90                   	nop
+  buf[i] = '\0';
+ 18e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 191:	8b 45 08             	mov    0x8(%ebp),%eax
+ 194:	01 d0                	add    %edx,%eax
+ 196:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 199:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 19c:	c9                   	leave
+ 19d:	c3                   	ret
+
+0000019e <stat>:
+{
+ 19e:	55                   	push   %ebp
+ 19f:	89 e5                	mov    %esp,%ebp
+ 1a1:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+ 1a4:	83 ec 08             	sub    $0x8,%esp
+ 1a7:	6a 00                	push   $0x0
+ 1a9:	ff 75 08             	push   0x8(%ebp)
+ 1ac:	e8 a2 03 00 00       	call   553 <open>
+ 1b1:	83 c4 10             	add    $0x10,%esp
+ 1b4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 1b7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 1bb:	79 07                	jns    1c4 <stat+0x26>
+    return -1;
+ 1bd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 1c2:	eb 25                	jmp    1e9 <stat+0x4b>
+  r = fstat(fd, st);
+ 1c4:	83 ec 08             	sub    $0x8,%esp
+ 1c7:	ff 75 0c             	push   0xc(%ebp)
+ 1ca:	ff 75 f4             	push   -0xc(%ebp)
+ 1cd:	e8 99 03 00 00       	call   56b <fstat>
+ 1d2:	83 c4 10             	add    $0x10,%esp
+ 1d5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 1d8:	83 ec 0c             	sub    $0xc,%esp
+ 1db:	ff 75 f4             	push   -0xc(%ebp)
+ 1de:	e8 58 03 00 00       	call   53b <close>
+ 1e3:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 1e6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 1e9:	c9                   	leave
+ 1ea:	c3                   	ret
+
+000001eb <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 1eb:	55                   	push   %ebp
+ 1ec:	89 e5                	mov    %esp,%ebp
+ 1ee:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+
+  dst = vdst;
+ 1f1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f4:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 1f7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1fa:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 1fd:	eb 17                	jmp    216 <memmove+0x2b>
+    *dst++ = *src++;
+ 1ff:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 202:	8d 42 01             	lea    0x1(%edx),%eax
+ 205:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 208:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 20b:	8d 48 01             	lea    0x1(%eax),%ecx
+ 20e:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 211:	0f b6 12             	movzbl (%edx),%edx
+ 214:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 216:	8b 45 10             	mov    0x10(%ebp),%eax
+ 219:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 21c:	89 55 10             	mov    %edx,0x10(%ebp)
+ 21f:	85 c0                	test   %eax,%eax
+ 221:	7f dc                	jg     1ff <memmove+0x14>
+  return vdst;
+ 223:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 226:	c9                   	leave
+ 227:	c3                   	ret
+
+00000228 <cpuinfo>:
+ 228:	55                   	push   %ebp
+ 229:	89 e5                	mov    %esp,%ebp
+ 22b:	56                   	push   %esi
+ 22c:	53                   	push   %ebx
+ 22d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 230:	ba 00 00 00 00       	mov    $0x0,%edx
+ 235:	89 d1                	mov    %edx,%ecx
+ 237:	0f a2                	cpuid
+ 239:	89 c6                	mov    %eax,%esi
+ 23b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 23e:	89 30                	mov    %esi,(%eax)
+ 240:	8b 45 10             	mov    0x10(%ebp),%eax
+ 243:	89 18                	mov    %ebx,(%eax)
+ 245:	8b 45 14             	mov    0x14(%ebp),%eax
+ 248:	89 08                	mov    %ecx,(%eax)
+ 24a:	8b 45 18             	mov    0x18(%ebp),%eax
+ 24d:	89 10                	mov    %edx,(%eax)
+ 24f:	90                   	nop
+ 250:	5b                   	pop    %ebx
+ 251:	5e                   	pop    %esi
+ 252:	5d                   	pop    %ebp
+ 253:	c3                   	ret
+
+00000254 <atoi>:
+{
+ 254:	55                   	push   %ebp
+ 255:	89 e5                	mov    %esp,%ebp
+ 257:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+ 25a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 261:	eb 25                	jmp    288 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 263:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 266:	89 d0                	mov    %edx,%eax
+ 268:	c1 e0 02             	shl    $0x2,%eax
+ 26b:	01 d0                	add    %edx,%eax
+ 26d:	01 c0                	add    %eax,%eax
+ 26f:	89 c1                	mov    %eax,%ecx
+ 271:	8b 45 08             	mov    0x8(%ebp),%eax
+ 274:	8d 50 01             	lea    0x1(%eax),%edx
+ 277:	89 55 08             	mov    %edx,0x8(%ebp)
+ 27a:	0f b6 00             	movzbl (%eax),%eax
+ 27d:	0f be c0             	movsbl %al,%eax
+ 280:	01 c8                	add    %ecx,%eax
+ 282:	83 e8 30             	sub    $0x30,%eax
+ 285:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 288:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28b:	0f b6 00             	movzbl (%eax),%eax
+ 28e:	3c 2f                	cmp    $0x2f,%al
+ 290:	7e 0a                	jle    29c <atoi+0x48>
+ 292:	8b 45 08             	mov    0x8(%ebp),%eax
+ 295:	0f b6 00             	movzbl (%eax),%eax
+ 298:	3c 39                	cmp    $0x39,%al
+ 29a:	7e c7                	jle    263 <atoi+0xf>
+  return n;
+ 29c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 29f:	c9                   	leave
+ 2a0:	c3                   	ret
+
+000002a1 <strcmp>:
+{
+ 2a1:	55                   	push   %ebp
+ 2a2:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 2a4:	eb 08                	jmp    2ae <strcmp+0xd>
+    p++, q++;
+ 2a6:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 2aa:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 2ae:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b1:	0f b6 00             	movzbl (%eax),%eax
+ 2b4:	84 c0                	test   %al,%al
+ 2b6:	74 10                	je     2c8 <strcmp+0x27>
+ 2b8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2bb:	0f b6 10             	movzbl (%eax),%edx
+ 2be:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2c1:	0f b6 00             	movzbl (%eax),%eax
+ 2c4:	38 c2                	cmp    %al,%dl
+ 2c6:	74 de                	je     2a6 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 2c8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2cb:	0f b6 00             	movzbl (%eax),%eax
+ 2ce:	0f b6 d0             	movzbl %al,%edx
+ 2d1:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2d4:	0f b6 00             	movzbl (%eax),%eax
+ 2d7:	0f b6 c0             	movzbl %al,%eax
+ 2da:	29 c2                	sub    %eax,%edx
+ 2dc:	89 d0                	mov    %edx,%eax
+}
+ 2de:	5d                   	pop    %ebp
+ 2df:	c3                   	ret
+
+000002e0 <udiv64>:
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	57                   	push   %edi
+ 2e4:	56                   	push   %esi
+ 2e5:	83 ec 38             	sub    $0x38,%esp
+ 2e8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2eb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 2ee:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2f1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 2f4:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2f7:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 2fa:	8b 45 14             	mov    0x14(%ebp),%eax
+ 2fd:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  q = r = 0;
+ 300:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 307:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 30e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 311:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 314:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 317:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 31a:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 321:	e9 85 00 00 00       	jmp    3ab <udiv64+0xcb>
+    r = (r << 1) | ((n >> i) & 1);
+ 326:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 329:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 32c:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 330:	01 c0                	add    %eax,%eax
+ 332:	89 c6                	mov    %eax,%esi
+ 334:	89 d7                	mov    %edx,%edi
+ 336:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 339:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 33c:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 33f:	0f ad d0             	shrd   %cl,%edx,%eax
+ 342:	d3 ea                	shr    %cl,%edx
+ 344:	f6 c1 20             	test   $0x20,%cl
+ 347:	74 04                	je     34d <udiv64+0x6d>
+ 349:	89 d0                	mov    %edx,%eax
+ 34b:	31 d2                	xor    %edx,%edx
+ 34d:	83 e0 01             	and    $0x1,%eax
+ 350:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 353:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+ 35a:	89 f0                	mov    %esi,%eax
+ 35c:	89 fa                	mov    %edi,%edx
+ 35e:	0b 45 c0             	or     -0x40(%ebp),%eax
+ 361:	0b 55 c4             	or     -0x3c(%ebp),%edx
+ 364:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 367:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 36a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 36d:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 370:	3b 45 c8             	cmp    -0x38(%ebp),%eax
+ 373:	89 d0                	mov    %edx,%eax
+ 375:	1b 45 cc             	sbb    -0x34(%ebp),%eax
+ 378:	72 2d                	jb     3a7 <udiv64+0xc7>
+      r -= d;
+ 37a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+ 37d:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 380:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 383:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64_t)1 << i;
+ 386:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 389:	b8 01 00 00 00       	mov    $0x1,%eax
+ 38e:	ba 00 00 00 00       	mov    $0x0,%edx
+ 393:	0f a5 c2             	shld   %cl,%eax,%edx
+ 396:	d3 e0                	shl    %cl,%eax
+ 398:	f6 c1 20             	test   $0x20,%cl
+ 39b:	74 04                	je     3a1 <udiv64+0xc1>
+ 39d:	89 c2                	mov    %eax,%edx
+ 39f:	31 c0                	xor    %eax,%eax
+ 3a1:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 3a4:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 3a7:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 3ab:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 3af:	0f 89 71 ff ff ff    	jns    326 <udiv64+0x46>
+  if(rem)
+ 3b5:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+ 3b9:	74 0e                	je     3c9 <udiv64+0xe9>
+    *rem = r;
+ 3bb:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 3be:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 3c1:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 3c4:	89 01                	mov    %eax,(%ecx)
+ 3c6:	89 51 04             	mov    %edx,0x4(%ecx)
+  return q;
+ 3c9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 3cc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 3cf:	83 c4 38             	add    $0x38,%esp
+ 3d2:	5e                   	pop    %esi
+ 3d3:	5f                   	pop    %edi
+ 3d4:	5d                   	pop    %ebp
+ 3d5:	c3                   	ret
+
+000003d6 <crc32cinit>:
+{
+ 3d6:	55                   	push   %ebp
+ 3d7:	89 e5                	mov    %esp,%ebp
+ 3d9:	83 ec 20             	sub    $0x20,%esp
+  for(i = 0; i < 256; i++){
+ 3dc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 3e3:	eb 4c                	jmp    431 <crc32cinit+0x5b>
+    r = i;
+ 3e5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 3e8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+ 3eb:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+ 3f2:	eb 26                	jmp    41a <crc32cinit+0x44>
+      r = (r >> 1) ^ ((r & 1) ? CRC32C_POLY : 0);
+ 3f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3f7:	d1 e8                	shr    %eax
+ 3f9:	89 c2                	mov    %eax,%edx
+ 3fb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3fe:	83 e0 01             	and    $0x1,%eax
+ 401:	85 c0                	test   %eax,%eax
+ 403:	74 07                	je     40c <crc32cinit+0x36>
+ 405:	b8 78 3b f6 82       	mov    $0x82f63b78,%eax
+ 40a:	eb 05                	jmp    411 <crc32cinit+0x3b>
+ 40c:	b8 00 00 00 00       	mov    $0x0,%eax
+ 411:	31 d0                	xor    %edx,%eax
+ 413:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+ 416:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+ 41a:	83 7d f8 07          	cmpl   $0x7,-0x8(%ebp)
+ 41e:	76 d4                	jbe    3f4 <crc32cinit+0x1e>
+    crc32ctab[i] = r;
+ 420:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 423:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 426:	89 14 85 e0 0d 00 00 	mov    %edx,0xde0(,%eax,4)
+  for(i = 0; i < 256; i++){
+ 42d:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 431:	81 7d fc ff 00 00 00 	cmpl   $0xff,-0x4(%ebp)
+ 438:	76 ab                	jbe    3e5 <crc32cinit+0xf>
+  cpuinfo(1, &a, &b, &c, &d);
+ 43a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 43d:	50                   	push   %eax
+ 43e:	8d 45 e8             	lea    -0x18(%ebp),%eax
+ 441:	50                   	push   %eax
+ 442:	8d 45 ec             	lea    -0x14(%ebp),%eax
+ 445:	50                   	push   %eax
+ 446:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 449:	50                   	push   %eax
+ 44a:	6a 01                	push   $0x1
+ 44c:	e8 d7 fd ff ff       	call   228 <cpuinfo>
+ 451:	83 c4 14             	add    $0x14,%esp
+  crc32chw = (c & CPUID_SSE42) != 0;
+ 454:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 457:	25 00 00 10 00       	and    $0x100000,%eax
+ 45c:	85 c0                	test   %eax,%eax
+ 45e:	0f 95 c0             	setne  %al
+ 461:	0f b6 c0             	movzbl %al,%eax
+ 464:	a3 b0 0d 00 00       	mov    %eax,0xdb0
+}
+ 469:	90                   	nop
+ 46a:	c9                   	leave
+ 46b:	c3                   	ret
+
+0000046c <crc32c>:
+{
+ 46c:	55                   	push   %ebp
+ 46d:	89 e5                	mov    %esp,%ebp
+ 46f:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s = p;
+ 472:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 475:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(crc32chw < 0)
+ 478:	a1 b0 0d 00 00       	mov    0xdb0,%eax
+ 47d:	85 c0                	test   %eax,%eax
+ 47f:	79 05                	jns    486 <crc32c+0x1a>
+    crc32cinit();
+ 481:	e8 50 ff ff ff       	call   3d6 <crc32cinit>
+  crc = ~crc;
+ 486:	f7 55 08             	notl   0x8(%ebp)
+  if(crc32chw){
+ 489:	a1 b0 0d 00 00       	mov    0xdb0,%eax
+ 48e:	85 c0                	test   %eax,%eax
+ 490:	74 6c                	je     4fe <crc32c+0x92>
+    for(; n >= 4; n -= 4, s += 4)
+ 492:	eb 18                	jmp    4ac <crc32c+0x40>
+      asm("crc32l %1, %0" : "+r" (crc) : "rm" (*(const uint*)s));
+ 494:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 497:	8b 10                	mov    (%eax),%edx
+ 499:	8b 45 08             	mov    0x8(%ebp),%eax
+ 49c:	f2 0f 38 f1 c2       	crc32  %edx,%eax
+ 4a1:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n >= 4; n -= 4, s += 4)
+ 4a4:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+ 4a8:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+ 4ac:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+ 4b0:	77 e2                	ja     494 <crc32c+0x28>
+    for(; n > 0; n--, s++)
+ 4b2:	eb 19                	jmp    4cd <crc32c+0x61>
+      asm("crc32b %1, %0" : "+r" (crc) : "qm" (*s));
+ 4b4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 4b7:	0f b6 10             	movzbl (%eax),%edx
+ 4ba:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4bd:	f2 0f 38 f0 c2       	crc32  %dl,%eax
+ 4c2:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+ 4c5:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+ 4c9:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 4cd:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 4d1:	75 e1                	jne    4b4 <crc32c+0x48>
+ 4d3:	eb 2f                	jmp    504 <crc32c+0x98>
+      crc = crc32ctab[(crc ^ *s) & 0xff] ^ (crc >> 8);
+ 4d5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 4d8:	0f b6 00             	movzbl (%eax),%eax
+ 4db:	0f b6 c0             	movzbl %al,%eax
+ 4de:	33 45 08             	xor    0x8(%ebp),%eax
+ 4e1:	0f b6 c0             	movzbl %al,%eax
+ 4e4:	8b 04 85 e0 0d 00 00 	mov    0xde0(,%eax,4),%eax
+ 4eb:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4ee:	c1 ea 08             	shr    $0x8,%edx
+ 4f1:	31 d0                	xor    %edx,%eax
+ 4f3:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+ 4f6:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+ 4fa:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 4fe:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 502:	75 d1                	jne    4d5 <crc32c+0x69>
+  return ~crc;
+ 504:	8b 45 08             	mov    0x8(%ebp),%eax
+ 507:	f7 d0                	not    %eax
+}
+ 509:	c9                   	leave
+ 50a:	c3                   	ret
+
+0000050b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 50b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <exit>:
+SYSCALL(exit)
+ 513:	b8 02 00 00 00       	mov    $0x2,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <wait>:
+SYSCALL(wait)
+ 51b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <pipe>:
+SYSCALL(pipe)
+ 523:	b8 04 00 00 00       	mov    $0x4,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <read>:
+SYSCALL(read)
+ 52b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <write>:
+SYSCALL(write)
+ 533:	b8 10 00 00 00       	mov    $0x10,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <close>:
+SYSCALL(close)
+ 53b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <kill>:
+SYSCALL(kill)
+ 543:	b8 06 00 00 00       	mov    $0x6,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <exec>:
+SYSCALL(exec)
+ 54b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <open>:
+SYSCALL(open)
+ 553:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <mknod>:
+SYSCALL(mknod)
+ 55b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <unlink>:
+SYSCALL(unlink)
+ 563:	b8 12 00 00 00       	mov    $0x12,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <fstat>:
+SYSCALL(fstat)
+ 56b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <link>:
+SYSCALL(link)
+ 573:	b8 13 00 00 00       	mov    $0x13,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <mkdir>:
+SYSCALL(mkdir)
+ 57b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <chdir>:
+SYSCALL(chdir)
+ 583:	b8 09 00 00 00       	mov    $0x9,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <dup>:
+SYSCALL(dup)
+ 58b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <getpid>:
+SYSCALL(getpid)
+ 593:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <sbrk>:
+SYSCALL(sbrk)
+ 59b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <sleep>:
+SYSCALL(sleep)
+ 5a3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <uptime>:
+SYSCALL(uptime)
+ 5ab:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <arp>:
+SYSCALL(arp)
+ 5b3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <ifstat>:
+SYSCALL(ifstat)
+ 5bb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <pcapctl>:
+SYSCALL(pcapctl)
+ 5c3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <pcapread>:
+SYSCALL(pcapread)
+ 5cb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <bpfattach>:
+SYSCALL(bpfattach)
+ 5d3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <pktgen>:
+SYSCALL(pktgen)
+ 5db:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <reflect>:
+SYSCALL(reflect)
+ 5e3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <brctl>:
+SYSCALL(brctl)
+ 5eb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <hostopen>:
+SYSCALL(hostopen)
+ 5f3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 5fb:	55                   	push   %ebp
+ 5fc:	89 e5                	mov    %esp,%ebp
+ 5fe:	83 ec 18             	sub    $0x18,%esp
+ 601:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 604:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 607:	83 ec 04             	sub    $0x4,%esp
+ 60a:	6a 01                	push   $0x1
+ 60c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 60f:	50                   	push   %eax
+ 610:	ff 75 08             	push   0x8(%ebp)
+ 613:	e8 1b ff ff ff       	call   533 <write>
+ 618:	83 c4 10             	add    $0x10,%esp
+}
+ 61b:	90                   	nop
+ 61c:	c9                   	leave
+ 61d:	c3                   	ret
+
+0000061e <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 61e:	55                   	push   %ebp
+ 61f:	89 e5                	mov    %esp,%ebp
+ 621:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 624:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 62b:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 62f:	74 17                	je     648 <printint+0x2a>
+ 631:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 635:	79 11                	jns    648 <printint+0x2a>
+    neg = 1;
+ 637:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 63e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 641:	f7 d8                	neg    %eax
+ 643:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 646:	eb 06                	jmp    64e <printint+0x30>
+  } else {
+    x = xx;
+ 648:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 64b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 64e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 655:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 658:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 65b:	ba 00 00 00 00       	mov    $0x0,%edx
+ 660:	f7 f1                	div    %ecx
+ 662:	89 d1                	mov    %edx,%ecx
+ 664:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 667:	8d 50 01             	lea    0x1(%eax),%edx
+ 66a:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 66d:	0f b6 91 b4 0d 00 00 	movzbl 0xdb4(%ecx),%edx
+ 674:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 678:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 67b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 67e:	ba 00 00 00 00       	mov    $0x0,%edx
+ 683:	f7 f1                	div    %ecx
+ 685:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 688:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 68c:	75 c7                	jne    655 <printint+0x37>
+  if(neg)
+ 68e:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 692:	74 2d                	je     6c1 <printint+0xa3>
+    buf[i++] = '-';
+ 694:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 697:	8d 50 01             	lea    0x1(%eax),%edx
+ 69a:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 69d:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 6a2:	eb 1d                	jmp    6c1 <printint+0xa3>
+    putc(fd, buf[i]);
+ 6a4:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 6a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6aa:	01 d0                	add    %edx,%eax
+ 6ac:	0f b6 00             	movzbl (%eax),%eax
+ 6af:	0f be c0             	movsbl %al,%eax
+ 6b2:	83 ec 08             	sub    $0x8,%esp
+ 6b5:	50                   	push   %eax
+ 6b6:	ff 75 08             	push   0x8(%ebp)
+ 6b9:	e8 3d ff ff ff       	call   5fb <putc>
+ 6be:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 6c1:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 6c5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 6c9:	79 d9                	jns    6a4 <printint+0x86>
+}
+ 6cb:	90                   	nop
+ 6cc:	90                   	nop
+ 6cd:	c9                   	leave
+ 6ce:	c3                   	ret
+
+000006cf <printf>:
+
+// Print to the given fd. Only understands %d, %u, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 6cf:	55                   	push   %ebp
+ 6d0:	89 e5                	mov    %esp,%ebp
+ 6d2:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 6d5:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 6dc:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 6df:	83 c0 04             	add    $0x4,%eax
+ 6e2:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 6e5:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 6ec:	e9 7d 01 00 00       	jmp    86e <printf+0x19f>
+    c = fmt[i] & 0xff;
+ 6f1:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 6f4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 6f7:	01 d0                	add    %edx,%eax
+ 6f9:	0f b6 00             	movzbl (%eax),%eax
+ 6fc:	0f be c0             	movsbl %al,%eax
+ 6ff:	25 ff 00 00 00       	and    $0xff,%eax
+ 704:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 707:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 70b:	75 2c                	jne    739 <printf+0x6a>
+      if(c == '%'){
+ 70d:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 711:	75 0c                	jne    71f <printf+0x50>
+        state = '%';
+ 713:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 71a:	e9 4b 01 00 00       	jmp    86a <printf+0x19b>
+      } else {
+        putc(fd, c);
+ 71f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 722:	0f be c0             	movsbl %al,%eax
+ 725:	83 ec 08             	sub    $0x8,%esp
+ 728:	50                   	push   %eax
+ 729:	ff 75 08             	push   0x8(%ebp)
+ 72c:	e8 ca fe ff ff       	call   5fb <putc>
+ 731:	83 c4 10             	add    $0x10,%esp
+ 734:	e9 31 01 00 00       	jmp    86a <printf+0x19b>
+      }
+    } else if(state == '%'){
+ 739:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 73d:	0f 85 27 01 00 00    	jne    86a <printf+0x19b>
+      if(c == 'd'){
+ 743:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 747:	75 1e                	jne    767 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 749:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 74c:	8b 00                	mov    (%eax),%eax
+ 74e:	6a 01                	push   $0x1
+ 750:	6a 0a                	push   $0xa
+ 752:	50                   	push   %eax
+ 753:	ff 75 08             	push   0x8(%ebp)
+ 756:	e8 c3 fe ff ff       	call   61e <printint>
+ 75b:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 75e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 762:	e9 fc 00 00 00       	jmp    863 <printf+0x194>
+      } else if(c == 'u'){
+ 767:	83 7d e4 75          	cmpl   $0x75,-0x1c(%ebp)
+ 76b:	75 1e                	jne    78b <printf+0xbc>
+        printint(fd, *ap, 10, 0);
+ 76d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 770:	8b 00                	mov    (%eax),%eax
+ 772:	6a 00                	push   $0x0
+ 774:	6a 0a                	push   $0xa
+ 776:	50                   	push   %eax
+ 777:	ff 75 08             	push   0x8(%ebp)
+ 77a:	e8 9f fe ff ff       	call   61e <printint>
+ 77f:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 782:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 786:	e9 d8 00 00 00       	jmp    863 <printf+0x194>
+      } else if(c == 'x' || c == 'p'){
+ 78b:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 78f:	74 06                	je     797 <printf+0xc8>
+ 791:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 795:	75 1e                	jne    7b5 <printf+0xe6>
+        printint(fd, *ap, 16, 0);
+ 797:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 79a:	8b 00                	mov    (%eax),%eax
+ 79c:	6a 00                	push   $0x0
+ 79e:	6a 10                	push   $0x10
+ 7a0:	50                   	push   %eax
+ 7a1:	ff 75 08             	push   0x8(%ebp)
+ 7a4:	e8 75 fe ff ff       	call   61e <printint>
+ 7a9:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 7ac:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7b0:	e9 ae 00 00 00       	jmp    863 <printf+0x194>
+      } else if(c == 's'){
+ 7b5:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 7b9:	75 43                	jne    7fe <printf+0x12f>
+        s = (char*)*ap;
+ 7bb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7be:	8b 00                	mov    (%eax),%eax
+ 7c0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 7c3:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 7c7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 7cb:	75 25                	jne    7f2 <printf+0x123>
+          s = "(null)";
+ 7cd:	c7 45 f4 d4 0a 00 00 	movl   $0xad4,-0xc(%ebp)
+        while(*s != 0){
+ 7d4:	eb 1c                	jmp    7f2 <printf+0x123>
+          putc(fd, *s);
+ 7d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7d9:	0f b6 00             	movzbl (%eax),%eax
+ 7dc:	0f be c0             	movsbl %al,%eax
+ 7df:	83 ec 08             	sub    $0x8,%esp
+ 7e2:	50                   	push   %eax
+ 7e3:	ff 75 08             	push   0x8(%ebp)
+ 7e6:	e8 10 fe ff ff       	call   5fb <putc>
+ 7eb:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 7ee:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 7f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7f5:	0f b6 00             	movzbl (%eax),%eax
+ 7f8:	84 c0                	test   %al,%al
+ 7fa:	75 da                	jne    7d6 <printf+0x107>
+ 7fc:	eb 65                	jmp    863 <printf+0x194>
+        }
+      } else if(c == 'c'){
+ 7fe:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 802:	75 1d                	jne    821 <printf+0x152>
+        putc(fd, *ap);
+ 804:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 807:	8b 00                	mov    (%eax),%eax
+ 809:	0f be c0             	movsbl %al,%eax
+ 80c:	83 ec 08             	sub    $0x8,%esp
+ 80f:	50                   	push   %eax
+ 810:	ff 75 08             	push   0x8(%ebp)
+ 813:	e8 e3 fd ff ff       	call   5fb <putc>
+ 818:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 81b:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 81f:	eb 42                	jmp    863 <printf+0x194>
+      } else if(c == '%'){
+ 821:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 825:	75 17                	jne    83e <printf+0x16f>
+        putc(fd, c);
+ 827:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 82a:	0f be c0             	movsbl %al,%eax
+ 82d:	83 ec 08             	sub    $0x8,%esp
+ 830:	50                   	push   %eax
+ 831:	ff 75 08             	push   0x8(%ebp)
+ 834:	e8 c2 fd ff ff       	call   5fb <putc>
+ 839:	83 c4 10             	add    $0x10,%esp
+ 83c:	eb 25                	jmp    863 <printf+0x194>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 83e:	83 ec 08             	sub    $0x8,%esp
+ 841:	6a 25                	push   $0x25
+ 843:	ff 75 08             	push   0x8(%ebp)
+ 846:	e8 b0 fd ff ff       	call   5fb <putc>
+ 84b:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 84e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 851:	0f be c0             	movsbl %al,%eax
+ 854:	83 ec 08             	sub    $0x8,%esp
+ 857:	50                   	push   %eax
+ 858:	ff 75 08             	push   0x8(%ebp)
+ 85b:	e8 9b fd ff ff       	call   5fb <putc>
+ 860:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 863:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 86a:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 86e:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 871:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 874:	01 d0                	add    %edx,%eax
+ 876:	0f b6 00             	movzbl (%eax),%eax
+ 879:	84 c0                	test   %al,%al
+ 87b:	0f 85 70 fe ff ff    	jne    6f1 <printf+0x22>
+    }
+  }
+}
+ 881:	90                   	nop
+ 882:	90                   	nop
+ 883:	c9                   	leave
+ 884:	c3                   	ret
+
+00000885 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 885:	55                   	push   %ebp
+ 886:	89 e5                	mov    %esp,%ebp
+ 888:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 88b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 88e:	83 e8 08             	sub    $0x8,%eax
+ 891:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 894:	a1 e8 11 00 00       	mov    0x11e8,%eax
+ 899:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 89c:	eb 24                	jmp    8c2 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 89e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8a1:	8b 00                	mov    (%eax),%eax
+ 8a3:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 8a6:	72 12                	jb     8ba <free+0x35>
+ 8a8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8ab:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 8ae:	72 24                	jb     8d4 <free+0x4f>
+ 8b0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8b3:	8b 00                	mov    (%eax),%eax
+ 8b5:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 8b8:	72 1a                	jb     8d4 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8ba:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8bd:	8b 00                	mov    (%eax),%eax
+ 8bf:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 8c2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8c5:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 8c8:	73 d4                	jae    89e <free+0x19>
+ 8ca:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8cd:	8b 00                	mov    (%eax),%eax
+ 8cf:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 8d2:	73 ca                	jae    89e <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 8d4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8d7:	8b 40 04             	mov    0x4(%eax),%eax
+ 8da:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 8e1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8e4:	01 c2                	add    %eax,%edx
+ 8e6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8e9:	8b 00                	mov    (%eax),%eax
+ 8eb:	39 c2                	cmp    %eax,%edx
+ 8ed:	75 24                	jne    913 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 8ef:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8f2:	8b 50 04             	mov    0x4(%eax),%edx
+ 8f5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8f8:	8b 00                	mov    (%eax),%eax
+ 8fa:	8b 40 04             	mov    0x4(%eax),%eax
+ 8fd:	01 c2                	add    %eax,%edx
+ 8ff:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 902:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 905:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 908:	8b 00                	mov    (%eax),%eax
+ 90a:	8b 10                	mov    (%eax),%edx
+ 90c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 90f:	89 10                	mov    %edx,(%eax)
+ 911:	eb 0a                	jmp    91d <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 913:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 916:	8b 10                	mov    (%eax),%edx
+ 918:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 91b:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 91d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 920:	8b 40 04             	mov    0x4(%eax),%eax
+ 923:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 92a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 92d:	01 d0                	add    %edx,%eax
+ 92f:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 932:	75 20                	jne    954 <free+0xcf>
+    p->s.size += bp->s.size;
+ 934:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 937:	8b 50 04             	mov    0x4(%eax),%edx
+ 93a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 93d:	8b 40 04             	mov    0x4(%eax),%eax
+ 940:	01 c2                	add    %eax,%edx
+ 942:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 945:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 948:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 94b:	8b 10                	mov    (%eax),%edx
+ 94d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 950:	89 10                	mov    %edx,(%eax)
+ 952:	eb 08                	jmp    95c <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 954:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 957:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 95a:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 95c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 95f:	a3 e8 11 00 00       	mov    %eax,0x11e8
+}
+ 964:	90                   	nop
+ 965:	c9                   	leave
+ 966:	c3                   	ret
+
+00000967 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 967:	55                   	push   %ebp
+ 968:	89 e5                	mov    %esp,%ebp
+ 96a:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 96d:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 974:	77 07                	ja     97d <morecore+0x16>
+    nu = 4096;
+ 976:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 97d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 980:	c1 e0 03             	shl    $0x3,%eax
+ 983:	83 ec 0c             	sub    $0xc,%esp
+ 986:	50                   	push   %eax
+ 987:	e8 0f fc ff ff       	call   59b <sbrk>
+ 98c:	83 c4 10             	add    $0x10,%esp
+ 98f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 992:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 996:	75 07                	jne    99f <morecore+0x38>
+    return 0;
+ 998:	b8 00 00 00 00       	mov    $0x0,%eax
+ 99d:	eb 26                	jmp    9c5 <morecore+0x5e>
+  hp = (Header*)p;
+ 99f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9a2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 9a5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 9ab:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 9ae:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9b1:	83 c0 08             	add    $0x8,%eax
+ 9b4:	83 ec 0c             	sub    $0xc,%esp
+ 9b7:	50                   	push   %eax
+ 9b8:	e8 c8 fe ff ff       	call   885 <free>
+ 9bd:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 9c0:	a1 e8 11 00 00       	mov    0x11e8,%eax
+}
+ 9c5:	c9                   	leave
+ 9c6:	c3                   	ret
+
+000009c7 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 9c7:	55                   	push   %ebp
+ 9c8:	89 e5                	mov    %esp,%ebp
+ 9ca:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9cd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9d0:	83 c0 07             	add    $0x7,%eax
+ 9d3:	c1 e8 03             	shr    $0x3,%eax
+ 9d6:	83 c0 01             	add    $0x1,%eax
+ 9d9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 9dc:	a1 e8 11 00 00       	mov    0x11e8,%eax
+ 9e1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 9e4:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 9e8:	75 23                	jne    a0d <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 9ea:	c7 45 f0 e0 11 00 00 	movl   $0x11e0,-0x10(%ebp)
+ 9f1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9f4:	a3 e8 11 00 00       	mov    %eax,0x11e8
+ 9f9:	a1 e8 11 00 00       	mov    0x11e8,%eax
+ 9fe:	a3 e0 11 00 00       	mov    %eax,0x11e0
+    base.s.size = 0;
+ a03:	c7 05 e4 11 00 00 00 	movl   $0x0,0x11e4
+ a0a:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a0d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a10:	8b 00                	mov    (%eax),%eax
+ a12:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ a15:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a18:	8b 40 04             	mov    0x4(%eax),%eax
+ a1b:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ a1e:	72 4d                	jb     a6d <malloc+0xa6>
+      if(p->s.size == nunits)
+ a20:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a23:	8b 40 04             	mov    0x4(%eax),%eax
+ a26:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ a29:	75 0c                	jne    a37 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ a2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a2e:	8b 10                	mov    (%eax),%edx
+ a30:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a33:	89 10                	mov    %edx,(%eax)
+ a35:	eb 26                	jmp    a5d <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ a37:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a3a:	8b 40 04             	mov    0x4(%eax),%eax
+ a3d:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ a40:	89 c2                	mov    %eax,%edx
+ a42:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a45:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ a48:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a4b:	8b 40 04             	mov    0x4(%eax),%eax
+ a4e:	c1 e0 03             	shl    $0x3,%eax
+ a51:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ a54:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a57:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ a5a:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ a5d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a60:	a3 e8 11 00 00       	mov    %eax,0x11e8
+      return (void*)(p + 1);
+ a65:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a68:	83 c0 08             	add    $0x8,%eax
+ a6b:	eb 3b                	jmp    aa8 <malloc+0xe1>
+    }
+    if(p == freep)
+ a6d:	a1 e8 11 00 00       	mov    0x11e8,%eax
+ a72:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ a75:	75 1e                	jne    a95 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ a77:	83 ec 0c             	sub    $0xc,%esp
+ a7a:	ff 75 ec             	push   -0x14(%ebp)
+ a7d:	e8 e5 fe ff ff       	call   967 <morecore>
+ a82:	83 c4 10             	add    $0x10,%esp
+ a85:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ a88:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a8c:	75 07                	jne    a95 <malloc+0xce>
+        return 0;
+ a8e:	b8 00 00 00 00       	mov    $0x0,%eax
+ a93:	eb 13                	jmp    aa8 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a95:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a98:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ a9b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a9e:	8b 00                	mov    (%eax),%eax
+ aa0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ aa3:	e9 6d ff ff ff       	jmp    a15 <malloc+0x4e>
+  }
+}
+ aa8:	c9                   	leave
+ aa9:	c3                   	ret
@@ -7,7 +7,10 @@
 //
 // Interface:
 // * To get a buffer for a particular disk block, call bread.
-// * After changing buffer data, call bwrite to write it to disk.
+// * After changing buffer data, call bwrite to write it to disk,
+//     or bwritev to write several at once.
+// * To have blocks read into the cache before they are needed,
+//     call breadahead; it doesn't wait for the disk.
 // * When done with the buffer, call brelse.
 // * Do not use the buffer after calling brelse.
 // * Only one process at a time can use a buffer,
@@ -17,36 +20,97 @@
 // * B_VALID: the buffer data has been read from the disk.
 // * B_DIRTY: the buffer data has been modified
 //     and needs to be written to disk.
+//
+// The cache is sized at boot from the memory kinit2 freed. Blocks
+// are found through a hash table on (dev, blockno) whose buckets
+// have a lock each, so lookups of different blocks don't contend.
+// Every buffer is also on an LRU list, which bcache.lock protects;
+// a miss recycles the least recently released unused buffer. Only
+// one process recycles at a time, under bcache.lock, and it is the
+// only one that ever holds two bucket locks, so acquiring bcache.lock
+// before bucket locks is the only order needed.
 
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
 
+struct bucket {
+  struct spinlock lock;
+  struct buf *head;  // chain through hnext
+};
+
 struct {
   struct spinlock lock;
-  struct buf buf[NBUF];
+  int nbuf;
+  int nbucket;
+  struct buf *buf;
+  struct bucket *bucket;
 
   // Linked list of all buffers, through prev/next.
   // head.next is most recently used.
   struct buf head;
 } bcache;
 
+// Allocate n contiguous bytes for the cache, or panic.
+static void*
+bcachealloc(uint n)
+{
+  char *p;
+
+  if((p = kallocn(PGROUNDUP(n) / PGSIZE)) == 0)
+    panic("binit: out of memory");
+  memset(p, 0, n);
+  return p;
+}
+
+static struct bucket*
+bucket(uint dev, uint blockno)
+{
+  return &bcache.bucket[(blockno ^ dev * 0x9e3779b1) % bcache.nbucket];
+}
+
 void
 binit(void)
 {
   struct buf *b;
+  struct bucket *bk;
+  char *data;
+  int n;
 
   initlock(&bcache.lock, "bcache");
 
+  // A sixteenth of free memory, but at least NBUF buffers, and
+  // about four buffers per hash bucket.
+  n = kfreepages() / 16 * PGSIZE / (sizeof(struct buf) + BSIZE);
+  if(n < NBUF)
+    n = NBUF;
+  bcache.nbuf = n;
+  bcache.nbucket = n / 4 + 1;
+  bcache.buf = bcachealloc(n * sizeof(struct buf));
+  bcache.bucket = bcachealloc(bcache.nbucket * sizeof(struct bucket));
+  for(bk = bcache.bucket; bk < bcache.bucket+bcache.nbucket; bk++)
+    initlock(&bk->lock, "bcache.bucket");
+
 //PAGEBREAK!
-  // Create linked list of buffers
+  // Create linked list of buffers. They start out holding
+  // blocks of no device, each its own.
   bcache.head.prev = &bcache.head;
   bcache.head.next = &bcache.head;
-  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+  data = 0;
+  for(b = bcache.buf; b < bcache.buf+n; b++){
+    if((b - bcache.buf) % (PGSIZE / BSIZE) == 0 && (data = kalloc()) == 0)
+      panic("binit: out of memory");
+    b->data = (uchar*)data + (b - bcache.buf) % (PGSIZE / BSIZE) * BSIZE;
+    b->dev = -1;
+    b->blockno = b - bcache.buf;
+    bk = bucket(b->dev, b->blockno);
+    b->hnext = bk->head;
+    bk->head = b;
     b->next = bcache.head.next;
     b->prev = &bcache.head;
     initsleeplock(&b->lock, "buffer");
@@ -55,39 +119,87 @@ binit(void)
   }
 }
 
+// Look for the block in its bucket bk, whose lock the caller holds.
+static struct buf*
+lookup(struct bucket *bk, uint dev, uint blockno)
+{
+  struct buf *b;
+
+  for(b = bk->head; b; b = b->hnext)
+    if(b->dev == dev && b->blockno == blockno)
+      return b;
+  return 0;
+}
+
 // Look through buffer cache for block on device dev.
 // If not found, allocate a buffer.
 // In either case, return locked buffer.
+// For read-ahead (fresh set), only a newly allocated buffer is
+// returned: 0 if the block is cached or no buffer is unused.
 static struct buf*
-bget(uint dev, uint blockno)
+bget(uint dev, uint blockno, int fresh)
 {
-  struct buf *b;
-
-  acquire(&bcache.lock);
+  struct bucket *bk, *vk;
+  struct buf *b, **pp;
 
   // Is the block already cached?
-  for(b = bcache.head.next; b != &bcache.head; b = b->next){
-    if(b->dev == dev && b->blockno == blockno){
+  bk = bucket(dev, blockno);
+  acquire(&bk->lock);
+  if((b = lookup(bk, dev, blockno)) != 0 && !fresh)
+    b->refcnt++;
+  release(&bk->lock);
+  if(b){
+    if(fresh)
+      return 0;
+    acquiresleep(&b->lock);
+    return b;
+  }
+
+  // Not cached; recycle an unused buffer. Another process may
+  // have cached the block meanwhile, so look again.
+  acquire(&bcache.lock);
+  acquire(&bk->lock);
+  if((b = lookup(bk, dev, blockno)) != 0){
+    if(!fresh)
       b->refcnt++;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
-    }
+    release(&bk->lock);
+    release(&bcache.lock);
+    if(fresh)
+      return 0;
+    acquiresleep(&b->lock);
+    return b;
   }
 
-  // Not cached; recycle an unused buffer.
   // Even if refcnt==0, B_DIRTY indicates a buffer is in use
   // because log.c has modified it but not yet committed it.
   for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
+    vk = bucket(b->dev, b->blockno);
+    if(vk != bk)
+      acquire(&vk->lock);
     if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
+      for(pp = &vk->head; *pp != b; pp = &(*pp)->hnext)
+        ;
+      *pp = b->hnext;
+      if(vk != bk)
+        release(&vk->lock);
       b->dev = dev;
       b->blockno = blockno;
       b->flags = 0;
       b->refcnt = 1;
+      b->hnext = bk->head;
+      bk->head = b;
+      release(&bk->lock);
       release(&bcache.lock);
       acquiresleep(&b->lock);
       return b;
     }
+    if(vk != bk)
+      release(&vk->lock);
+  }
+  if(fresh){
+    release(&bk->lock);
+    release(&bcache.lock);
+    return 0;
   }
   panic("bget: no buffers");
 }
@@ -98,7 +210,7 @@ bread(uint dev, uint blockno)
 {
   struct buf *b;
 
-  b = bget(dev, blockno);
+  b = bget(dev, blockno, 0);
   if((b->flags & B_VALID) == 0) {
     iderw(b);
   }
@@ -115,30 +227,94 @@ bwrite(struct buf *b)
   iderw(b);
 }
 
-// Release a locked buffer.
-// Move to the head of the MRU list.
+// Write the contents of n buffers to disk, in whatever order
+// suits the disk.  Must all be locked.
 void
-brelse(struct buf *b)
+bwritev(struct buf **bufs, int n)
 {
-  if(!holdingsleep(&b->lock))
-    panic("brelse");
+  int i;
 
-  releasesleep(&b->lock);
+  for(i = 0; i < n; i++){
+    if(!holdingsleep(&bufs[i]->lock))
+      panic("bwritev");
+    bufs[i]->flags |= B_DIRTY;
+  }
+  iderwv(bufs, n);
+}
 
-  acquire(&bcache.lock);
+// Start reading the n blocks of dev in blocks into the cache,
+// without waiting for them. Blocks that are cached already are
+// left alone; so is the rest if the cache runs out of unused
+// buffers. The disk driver releases the buffers when it is done.
+void
+breadahead(uint dev, uint *blocks, int n)
+{
+  struct buf *b, *bufs[NREADAHEAD];
+  int i, m;
+
+  m = 0;
+  for(i = 0; i < n && m < NREADAHEAD; i++){
+    if((b = bget(dev, blocks[i], 1)) == 0)
+      continue;
+    b->flags |= B_ASYNC;
+    bufs[m++] = b;
+  }
+  iderwv(bufs, m);
+}
+
+// Drop a reference to b, whose sleep-lock is released.
+// Move to the head of the MRU list if it was the last.
+static void
+bunref(struct buf *b)
+{
+  struct bucket *bk;
+  int unused;
+
+  bk = bucket(b->dev, b->blockno);
+  acquire(&bk->lock);
   b->refcnt--;
-  if (b->refcnt == 0) {
+  unused = b->refcnt == 0;
+  release(&bk->lock);
+
+  if (unused) {
     // no one is waiting for it.
+    acquire(&bcache.lock);
     b->next->prev = b->prev;
     b->prev->next = b->next;
     b->next = bcache.head.next;
     b->prev = &bcache.head;
     bcache.head.next->prev = b;
     bcache.head.next = b;
+    release(&bcache.lock);
   }
-  
-  release(&bcache.lock);
+}
+
+// Release a locked buffer.
+// Move to the head of the MRU list.
+void
+brelse(struct buf *b)
+{
+  if(!holdingsleep(&b->lock))
+    panic("brelse");
+
+  releasesleep(&b->lock);
+  bunref(b);
+}
+
+// Called by the disk driver, holding its lock, when it has
+// finished with b. Wakes up the process waiting in iderw, or
+// for read-ahead, where nobody waits, releases the buffer.
+void
+biodone(struct buf *b)
+{
+  b->flags |= B_VALID;
+  b->flags &= ~B_DIRTY;
+  if(b->flags & B_ASYNC){
+    b->flags &= ~B_ASYNC;
+    releasesleep(&b->lock);
+    bunref(b);
+  } else
+    wakeup(b);
 }
 //PAGEBREAK!
 // Blank page.
-
@@ -0,0 +1,708 @@
+// Classic BPF packet filter.
+//
+// Programs are checked by bpf_validate() before they are attached,
+// so the interpreter only has to guard packet accesses. Jumps only
+// go forward and the last instruction is a return, so every program
+// terminates.
+//
+// When a program only uses the common subset of the instruction set
+// (packet loads, immediate ALU ops, conditional jumps and returns,
+// which covers what tcpdump generates for simple expressions) it is
+// also compiled to x86-32 code in a page of its own. Anything else
+// runs in the interpreter.
+//
+// A program runs on a frame and returns how many bytes of it to
+// accept; 0 drops the frame.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "nic.h"
+#include "bpf.h"
+
+typedef uint (*bpf_jitfn)(uchar *pkt, uint len);
+
+struct bpf_prog {
+  int len;
+  bpf_jitfn jit;  // compiled program or 0
+  struct bpf_insn insns[BPF_MAXINSNS];
+};
+
+#define EXTRACT_SHORT(p) ((ushort)((p)[0] << 8 | (p)[1]))
+#define EXTRACT_LONG(p) \
+  ((uint)(p)[0] << 24 | (uint)(p)[1] << 16 | (uint)(p)[2] << 8 | (uint)(p)[3])
+
+// Run the filter program pc on the len bytes at p.
+uint
+bpf_filter(struct bpf_insn *pc, uchar *p, uint len)
+{
+  uint A, X, k;
+  uint mem[BPF_MEMWORDS];
+
+  A = X = 0;
+  memset(mem, 0, sizeof(mem));  // a load before any store must not see the stack
+  --pc;
+  for(;;){
+    ++pc;
+    switch(pc->code){
+    default:
+      return 0;
+    case BPF_RET|BPF_K:
+      return pc->k;
+    case BPF_RET|BPF_A:
+      return A;
+    case BPF_RET|BPF_X:
+      return X;
+
+    case BPF_LD|BPF_W|BPF_ABS:
+      k = pc->k;
+      if(k > len || 4 > len - k)
+        return 0;
+      A = EXTRACT_LONG(&p[k]);
+      continue;
+    case BPF_LD|BPF_H|BPF_ABS:
+      k = pc->k;
+      if(k > len || 2 > len - k)
+        return 0;
+      A = EXTRACT_SHORT(&p[k]);
+      continue;
+    case BPF_LD|BPF_B|BPF_ABS:
+      k = pc->k;
+      if(k >= len)
+        return 0;
+      A = p[k];
+      continue;
+    case BPF_LD|BPF_W|BPF_IND:
+      k = X + pc->k;
+      if(pc->k > len || X > len - pc->k || 4 > len - k)
+        return 0;
+      A = EXTRACT_LONG(&p[k]);
+      continue;
+    case BPF_LD|BPF_H|BPF_IND:
+      k = X + pc->k;
+      if(pc->k > len || X > len - pc->k || 2 > len - k)
+        return 0;
+      A = EXTRACT_SHORT(&p[k]);
+      continue;
+    case BPF_LD|BPF_B|BPF_IND:
+      k = X + pc->k;
+      if(pc->k >= len || X >= len - pc->k)
+        return 0;
+      A = p[k];
+      continue;
+    case BPF_LD|BPF_W|BPF_LEN:
+      A = len;
+      continue;
+    case BPF_LDX|BPF_W|BPF_LEN:
+      X = len;
+      continue;
+    case BPF_LDX|BPF_B|BPF_MSH:
+      k = pc->k;
+      if(k >= len)
+        return 0;
+      X = (p[k] & 0xf) << 2;
+      continue;
+    case BPF_LD|BPF_IMM:
+      A = pc->k;
+      continue;
+    case BPF_LDX|BPF_IMM:
+      X = pc->k;
+      continue;
+    case BPF_LD|BPF_MEM:
+      A = mem[pc->k];
+      continue;
+    case BPF_LDX|BPF_MEM:
+      X = mem[pc->k];
+      continue;
+    case BPF_ST:
+      mem[pc->k] = A;
+      continue;
+    case BPF_STX:
+      mem[pc->k] = X;
+      continue;
+
+    case BPF_JMP|BPF_JA:
+      pc += pc->k;
+      continue;
+    case BPF_JMP|BPF_JGT|BPF_K:
+      pc += (A > pc->k) ? pc->jt : pc->jf;
+      continue;
+    case BPF_JMP|BPF_JGE|BPF_K:
+      pc += (A >= pc->k) ? pc->jt : pc->jf;
+      continue;
+    case BPF_JMP|BPF_JEQ|BPF_K:
+      pc += (A == pc->k) ? pc->jt : pc->jf;
+      continue;
+    case BPF_JMP|BPF_JSET|BPF_K:
+      pc += (A & pc->k) ? pc->jt : pc->jf;
+      continue;
+    case BPF_JMP|BPF_JGT|BPF_X:
+      pc += (A > X) ? pc->jt : pc->jf;
+      continue;
+    case BPF_JMP|BPF_JGE|BPF_X:
+      pc += (A >= X) ? pc->jt : pc->jf;
+      continue;
+    case BPF_JMP|BPF_JEQ|BPF_X:
+      pc += (A == X) ? pc->jt : pc->jf;
+      continue;
+    case BPF_JMP|BPF_JSET|BPF_X:
+      pc += (A & X) ? pc->jt : pc->jf;
+      continue;
+
+    case BPF_ALU|BPF_ADD|BPF_X:
+      A += X;
+      continue;
+    case BPF_ALU|BPF_SUB|BPF_X:
+      A -= X;
+      continue;
+    case BPF_ALU|BPF_MUL|BPF_X:
+      A *= X;
+      continue;
+    case BPF_ALU|BPF_DIV|BPF_X:
+      if(X == 0)
+        return 0;
+      A /= X;
+      continue;
+    case BPF_ALU|BPF_MOD|BPF_X:
+      if(X == 0)
+        return 0;
+      A %= X;
+      continue;
+    case BPF_ALU|BPF_AND|BPF_X:
+      A &= X;
+      continue;
+    case BPF_ALU|BPF_OR|BPF_X:
+      A |= X;
+      continue;
+    case BPF_ALU|BPF_XOR|BPF_X:
+      A ^= X;
+      continue;
+    case BPF_ALU|BPF_LSH|BPF_X:
+      A = X < 32 ? A << X : 0;
+      continue;
+    case BPF_ALU|BPF_RSH|BPF_X:
+      A = X < 32 ? A >> X : 0;
+      continue;
+    case BPF_ALU|BPF_ADD|BPF_K:
+      A += pc->k;
+      continue;
+    case BPF_ALU|BPF_SUB|BPF_K:
+      A -= pc->k;
+      continue;
+    case BPF_ALU|BPF_MUL|BPF_K:
+      A *= pc->k;
+      continue;
+    case BPF_ALU|BPF_DIV|BPF_K:
+      A /= pc->k;
+      continue;
+    case BPF_ALU|BPF_MOD|BPF_K:
+      A %= pc->k;
+      continue;
+    case BPF_ALU|BPF_AND|BPF_K:
+      A &= pc->k;
+      continue;
+    case BPF_ALU|BPF_OR|BPF_K:
+      A |= pc->k;
+      continue;
+    case BPF_ALU|BPF_XOR|BPF_K:
+      A ^= pc->k;
+      continue;
+    case BPF_ALU|BPF_LSH|BPF_K:
+      A <<= pc->k;
+      continue;
+    case BPF_ALU|BPF_RSH|BPF_K:
+      A >>= pc->k;
+      continue;
+    case BPF_ALU|BPF_NEG:
+      A = -A;
+      continue;
+
+    case BPF_MISC|BPF_TAX:
+      X = A;
+      continue;
+    case BPF_MISC|BPF_TXA:
+      A = X;
+      continue;
+    }
+  }
+}
+
+// Is code an instruction the interpreter knows?
+static int
+validcode(ushort code)
+{
+  switch(code){
+  case BPF_RET|BPF_K: case BPF_RET|BPF_A: case BPF_RET|BPF_X:
+  case BPF_LD|BPF_W|BPF_ABS: case BPF_LD|BPF_H|BPF_ABS: case BPF_LD|BPF_B|BPF_ABS:
+  case BPF_LD|BPF_W|BPF_IND: case BPF_LD|BPF_H|BPF_IND: case BPF_LD|BPF_B|BPF_IND:
+  case BPF_LD|BPF_W|BPF_LEN: case BPF_LDX|BPF_W|BPF_LEN: case BPF_LDX|BPF_B|BPF_MSH:
+  case BPF_LD|BPF_IMM: case BPF_LDX|BPF_IMM:
+  case BPF_LD|BPF_MEM: case BPF_LDX|BPF_MEM: case BPF_ST: case BPF_STX:
+  case BPF_JMP|BPF_JA:
+  case BPF_JMP|BPF_JGT|BPF_K: case BPF_JMP|BPF_JGE|BPF_K:
+  case BPF_JMP|BPF_JEQ|BPF_K: case BPF_JMP|BPF_JSET|BPF_K:
+  case BPF_JMP|BPF_JGT|BPF_X: case BPF_JMP|BPF_JGE|BPF_X:
+  case BPF_JMP|BPF_JEQ|BPF_X: case BPF_JMP|BPF_JSET|BPF_X:
+  case BPF_ALU|BPF_ADD|BPF_X: case BPF_ALU|BPF_SUB|BPF_X: case BPF_ALU|BPF_MUL|BPF_X:
+  case BPF_ALU|BPF_DIV|BPF_X: case BPF_ALU|BPF_MOD|BPF_X: case BPF_ALU|BPF_AND|BPF_X:
+  case BPF_ALU|BPF_OR|BPF_X: case BPF_ALU|BPF_XOR|BPF_X:
+  case BPF_ALU|BPF_LSH|BPF_X: case BPF_ALU|BPF_RSH|BPF_X:
+  case BPF_ALU|BPF_ADD|BPF_K: case BPF_ALU|BPF_SUB|BPF_K: case BPF_ALU|BPF_MUL|BPF_K:
+  case BPF_ALU|BPF_DIV|BPF_K: case BPF_ALU|BPF_MOD|BPF_K: case BPF_ALU|BPF_AND|BPF_K:
+  case BPF_ALU|BPF_OR|BPF_K: case BPF_ALU|BPF_XOR|BPF_K:
+  case BPF_ALU|BPF_LSH|BPF_K: case BPF_ALU|BPF_RSH|BPF_K:
+  case BPF_ALU|BPF_NEG:
+  case BPF_MISC|BPF_TAX: case BPF_MISC|BPF_TXA:
+    return 1;
+  }
+  return 0;
+}
+
+// Check that f is a program that is safe to run: known opcodes,
+// scratch memory and jumps within bounds, no division by a constant
+// zero, and a return at the end. Returns 1 if it is.
+int
+bpf_validate(struct bpf_insn *f, int len)
+{
+  struct bpf_insn *p;
+  int i;
+
+  if(len < 1 || len > BPF_MAXINSNS)
+    return 0;
+
+  for(i = 0; i < len; i++){
+    p = &f[i];
+    if(!validcode(p->code))
+      return 0;
+    switch(BPF_CLASS(p->code)){
+    case BPF_LD:
+    case BPF_LDX:
+      if(BPF_MODE(p->code) == BPF_MEM && p->k >= BPF_MEMWORDS)
+        return 0;
+      break;
+    case BPF_ST:
+    case BPF_STX:
+      if(p->k >= BPF_MEMWORDS)
+        return 0;
+      break;
+    case BPF_ALU:
+      if(BPF_SRC(p->code) != BPF_K)
+        break;
+      if((BPF_OP(p->code) == BPF_DIV || BPF_OP(p->code) == BPF_MOD) && p->k == 0)
+        return 0;
+      if((BPF_OP(p->code) == BPF_LSH || BPF_OP(p->code) == BPF_RSH) && p->k >= 32)
+        return 0;
+      break;
+    case BPF_JMP:
+      if(BPF_OP(p->code) == BPF_JA){
+        if(p->k >= len - i - 1)
+          return 0;
+      } else if(i + 1 + p->jt >= len || i + 1 + p->jf >= len)
+        return 0;
+      break;
+    }
+  }
+  return BPF_CLASS(f[len - 1].code) == BPF_RET;
+}
+
+//PAGEBREAK!
+// x86-32 compiler.
+//
+// Generated code is a cdecl function uint f(uchar *pkt, uint len).
+// A lives in %eax, X in %edx, pkt in %esi, len in %edi; %ecx is
+// scratch. Jumps always use 32-bit displacements so instruction
+// sizes don't depend on where the targets are: a first pass only
+// measures, the second emits.
+
+struct jit {
+  uchar *buf;  // 0 in the sizing pass
+  uint n;      // bytes emitted so far
+};
+
+static void
+emit1(struct jit *j, uint b)
+{
+  if(j->buf)
+    j->buf[j->n] = b;
+  j->n++;
+}
+
+static void
+emit4(struct jit *j, uint w)
+{
+  emit1(j, w);
+  emit1(j, w >> 8);
+  emit1(j, w >> 16);
+  emit1(j, w >> 24);
+}
+
+static void
+emitjmp(struct jit *j, uint target)
+{
+  emit1(j, 0xe9);
+  emit4(j, target - (j->n + 4));
+}
+
+static void
+emitjcc(struct jit *j, uint cc, uint target)
+{
+  emit1(j, 0x0f);
+  emit1(j, cc);
+  emit4(j, target - (j->n + 4));
+}
+
+#define JA_   0x87
+#define JAE_  0x83
+#define JB_   0x82
+#define JBE_  0x86
+#define JE_   0x84
+#define JNE_  0x85
+
+// Load size bytes at [%esi + %ecx - size] (ind) or [%esi + k] into
+// %eax in host byte order.
+static void
+emitload(struct jit *j, int size, int ind, uint k)
+{
+  uint disp = ind ? -size : k;
+
+  switch(size){
+  case 4:
+    emit1(j, 0x8b);                      // mov
+    break;
+  case 2:
+    emit1(j, 0x0f); emit1(j, 0xb7);      // movzwl
+    break;
+  case 1:
+    emit1(j, 0x0f); emit1(j, 0xb6);      // movzbl
+    break;
+  }
+  if(ind){
+    emit1(j, 0x84); emit1(j, 0x0e);      // disp32(%esi,%ecx),%eax
+  } else
+    emit1(j, 0x86);                      // disp32(%esi),%eax
+  emit4(j, disp);
+
+  if(size == 4){
+    emit1(j, 0x0f); emit1(j, 0xc8);      // bswap %eax
+  } else if(size == 2){
+    emit1(j, 0x86); emit1(j, 0xc4);      // xchg %al,%ah
+  }
+}
+
+// Emit code for instruction pc. addr[] holds the offset of every
+// instruction, fail is where out of bounds loads go and out is the
+// epilogue. Returns -1 if the instruction isn't supported.
+static int
+jitinsn(struct jit *j, struct bpf_insn *f, int pc, uint *addr, uint fail, uint out)
+{
+  struct bpf_insn *p = &f[pc];
+  uint k = p->k, tcc, fcc;
+  int size;
+
+  switch(p->code){
+  case BPF_RET|BPF_K:
+    emit1(j, 0xb8); emit4(j, k);         // mov $k,%eax
+    emitjmp(j, out);
+    return 0;
+  case BPF_RET|BPF_A:
+    emitjmp(j, out);
+    return 0;
+  case BPF_RET|BPF_X:
+    emit1(j, 0x89); emit1(j, 0xd0);      // mov %edx,%eax
+    emitjmp(j, out);
+    return 0;
+
+  case BPF_LD|BPF_W|BPF_ABS:
+  case BPF_LD|BPF_H|BPF_ABS:
+  case BPF_LD|BPF_B|BPF_ABS:
+    size = BPF_SIZE(p->code) == BPF_W ? 4 : BPF_SIZE(p->code) == BPF_H ? 2 : 1;
+    if(k > 0x7fffffff){
+      emitjmp(j, fail);
+      return 0;
+    }
+    emit1(j, 0x81); emit1(j, 0xff);      // cmp $k+size,%edi
+    emit4(j, k + size);
+    emitjcc(j, JB_, fail);
+    emitload(j, size, 0, k);
+    return 0;
+  case BPF_LD|BPF_W|BPF_IND:
+  case BPF_LD|BPF_H|BPF_IND:
+  case BPF_LD|BPF_B|BPF_IND:
+    size = BPF_SIZE(p->code) == BPF_W ? 4 : BPF_SIZE(p->code) == BPF_H ? 2 : 1;
+    if(k > 0x7fffffff){
+      emitjmp(j, fail);
+      return 0;
+    }
+    emit1(j, 0x89); emit1(j, 0xd1);      // mov %edx,%ecx
+    emit1(j, 0x81); emit1(j, 0xc1);      // add $k+size,%ecx
+    emit4(j, k + size);
+    emitjcc(j, JB_, fail);               // carry: wrapped around
+    emit1(j, 0x39); emit1(j, 0xf9);      // cmp %edi,%ecx
+    emitjcc(j, JA_, fail);
+    emitload(j, size, 1, k);
+    return 0;
+  case BPF_LD|BPF_W|BPF_LEN:
+    emit1(j, 0x89); emit1(j, 0xf8);      // mov %edi,%eax
+    return 0;
+  case BPF_LDX|BPF_W|BPF_LEN:
+    emit1(j, 0x89); emit1(j, 0xfa);      // mov %edi,%edx
+    return 0;
+  case BPF_LDX|BPF_B|BPF_MSH:
+    if(k > 0x7fffffff){
+      emitjmp(j, fail);
+      return 0;
+    }
+    emit1(j, 0x81); emit1(j, 0xff);      // cmp $k+1,%edi
+    emit4(j, k + 1);
+    emitjcc(j, JB_, fail);
+    emit1(j, 0x0f); emit1(j, 0xb6);      // movzbl k(%esi),%edx
+    emit1(j, 0x96); emit4(j, k);
+    emit1(j, 0x83); emit1(j, 0xe2); emit1(j, 0x0f);  // and $0xf,%edx
+    emit1(j, 0xc1); emit1(j, 0xe2); emit1(j, 0x02);  // shl $2,%edx
+    return 0;
+  case BPF_LD|BPF_IMM:
+    emit1(j, 0xb8); emit4(j, k);         // mov $k,%eax
+    return 0;
+  case BPF_LDX|BPF_IMM:
+    emit1(j, 0xba); emit4(j, k);         // mov $k,%edx
+    return 0;
+
+  case BPF_ALU|BPF_ADD|BPF_K:
+    emit1(j, 0x05); emit4(j, k);
+    return 0;
+  case BPF_ALU|BPF_SUB|BPF_K:
+    emit1(j, 0x2d); emit4(j, k);
+    return 0;
+  case BPF_ALU|BPF_AND|BPF_K:
+    emit1(j, 0x25); emit4(j, k);
+    return 0;
+  case BPF_ALU|BPF_OR|BPF_K:
+    emit1(j, 0x0d); emit4(j, k);
+    return 0;
+  case BPF_ALU|BPF_XOR|BPF_K:
+    emit1(j, 0x35); emit4(j, k);
+    return 0;
+  case BPF_ALU|BPF_MUL|BPF_K:
+    emit1(j, 0x69); emit1(j, 0xc0);      // imul $k,%eax,%eax
+    emit4(j, k);
+    return 0;
+  case BPF_ALU|BPF_LSH|BPF_K:
+    emit1(j, 0xc1); emit1(j, 0xe0); emit1(j, k);
+    return 0;
+  case BPF_ALU|BPF_RSH|BPF_K:
+    emit1(j, 0xc1); emit1(j, 0xe8); emit1(j, k);
+    return 0;
+  case BPF_ALU|BPF_NEG:
+    emit1(j, 0xf7); emit1(j, 0xd8);
+    return 0;
+  case BPF_ALU|BPF_ADD|BPF_X:
+    emit1(j, 0x01); emit1(j, 0xd0);
+    return 0;
+  case BPF_ALU|BPF_SUB|BPF_X:
+    emit1(j, 0x29); emit1(j, 0xd0);
+    return 0;
+  case BPF_ALU|BPF_AND|BPF_X:
+    emit1(j, 0x21); emit1(j, 0xd0);
+    return 0;
+  case BPF_ALU|BPF_OR|BPF_X:
+    emit1(j, 0x09); emit1(j, 0xd0);
+    return 0;
+  case BPF_ALU|BPF_XOR|BPF_X:
+    emit1(j, 0x31); emit1(j, 0xd0);
+    return 0;
+  case BPF_ALU|BPF_MUL|BPF_X:
+    emit1(j, 0x0f); emit1(j, 0xaf); emit1(j, 0xc2);
+    return 0;
+
+  case BPF_MISC|BPF_TAX:
+    emit1(j, 0x89); emit1(j, 0xc2);      // mov %eax,%edx
+    return 0;
+  case BPF_MISC|BPF_TXA:
+    emit1(j, 0x89); emit1(j, 0xd0);      // mov %edx,%eax
+    return 0;
+
+  case BPF_JMP|BPF_JA:
+    emitjmp(j, addr[pc + 1 + k]);
+    return 0;
+  }
+
+  if(BPF_CLASS(p->code) != BPF_JMP)
+    return -1;
+
+  switch(BPF_OP(p->code)){
+  case BPF_JEQ:
+    tcc = JE_; fcc = JNE_;
+    break;
+  case BPF_JGT:
+    tcc = JA_; fcc = JBE_;
+    break;
+  case BPF_JGE:
+    tcc = JAE_; fcc = JB_;
+    break;
+  case BPF_JSET:
+    tcc = JNE_; fcc = JE_;
+    break;
+  default:
+    return -1;
+  }
+
+  if(BPF_OP(p->code) == BPF_JSET){
+    if(BPF_SRC(p->code) == BPF_K){
+      emit1(j, 0xa9); emit4(j, k);       // test $k,%eax
+    } else {
+      emit1(j, 0x85); emit1(j, 0xd0);    // test %edx,%eax
+    }
+  } else {
+    if(BPF_SRC(p->code) == BPF_K){
+      emit1(j, 0x3d); emit4(j, k);       // cmp $k,%eax
+    } else {
+      emit1(j, 0x39); emit1(j, 0xd0);    // cmp %edx,%eax
+    }
+  }
+
+  if(p->jt && p->jf){
+    emitjcc(j, tcc, addr[pc + 1 + p->jt]);
+    emitjmp(j, addr[pc + 1 + p->jf]);
+  } else if(p->jt)
+    emitjcc(j, tcc, addr[pc + 1 + p->jt]);
+  else if(p->jf)
+    emitjcc(j, fcc, addr[pc + 1 + p->jf]);
+  return 0;
+}
+
+// One pass over the program. Fills in addr[] and returns the code
+// size, or -1 if an instruction can't be compiled.
+static int
+jitpass(struct jit *j, struct bpf_prog *prog, uint *addr)
+{
+  uint fail = addr[prog->len];
+  int pc;
+
+  j->n = 0;
+  emit1(j, 0x55);                        // push %ebp
+  emit1(j, 0x89); emit1(j, 0xe5);        // mov %esp,%ebp
+  emit1(j, 0x56);                        // push %esi
+  emit1(j, 0x57);                        // push %edi
+  emit1(j, 0x8b); emit1(j, 0x75); emit1(j, 0x08);  // mov 8(%ebp),%esi
+  emit1(j, 0x8b); emit1(j, 0x7d); emit1(j, 0x0c);  // mov 12(%ebp),%edi
+  emit1(j, 0x31); emit1(j, 0xc0);        // xor %eax,%eax
+  emit1(j, 0x31); emit1(j, 0xd2);        // xor %edx,%edx
+
+  for(pc = 0; pc < prog->len; pc++){
+    addr[pc] = j->n;
+    if(jitinsn(j, prog->insns, pc, addr, fail, fail + 2) < 0)
+      return -1;
+  }
+
+  addr[prog->len] = j->n;
+  emit1(j, 0x31); emit1(j, 0xc0);        // fail: xor %eax,%eax
+  emit1(j, 0x5f);                        // pop %edi
+  emit1(j, 0x5e);                        // pop %esi
+  emit1(j, 0x5d);                        // pop %ebp
+  emit1(j, 0xc3);                        // ret
+  return j->n;
+}
+
+// Compile prog into a page of its own. Leaves prog->jit 0 if the
+// program uses instructions the compiler doesn't handle or doesn't
+// fit in a page.
+static void
+bpf_jit(struct bpf_prog *prog)
+{
+  struct jit j;
+  uint *addr;
+  char *code;
+
+  prog->jit = 0;
+  if((addr = (uint*)kalloc()) == 0)
+    return;
+  memset(addr, 0, (prog->len + 1) * sizeof(uint));
+
+  // Sizes don't depend on the jump targets, so after the sizing
+  // pass addr[] holds the final offsets.
+  j.buf = 0;
+  if(jitpass(&j, prog, addr) < 0 || j.n > PGSIZE || (code = kalloc()) == 0){
+    kfree((char*)addr);
+    return;
+  }
+  j.buf = (uchar*)code;
+  jitpass(&j, prog, addr);
+  kfree((char*)addr);
+
+  prog->jit = (bpf_jitfn)code;
+}
+
+static void
+bpf_free(struct bpf_prog *prog)
+{
+  if(prog == 0)
+    return;
+  if(prog->jit)
+    kfree((char*)prog->jit);
+  kfree((char*)prog);
+}
+
+//PAGEBREAK!
+// Attachment points.
+
+void
+bpf_hookinit(struct bpf_hook *h, char *name)
+{
+  initlock(&h->lock, name);
+  h->prog = 0;
+}
+
+// Validate the n instructions at insns and attach them to h,
+// replacing what was there. n == 0 detaches.
+int
+bpf_attach(struct bpf_hook *h, struct bpf_insn *insns, int n)
+{
+  struct bpf_prog *prog, *old;
+
+  prog = 0;
+  if(n != 0){
+    if(n < 0 || n > BPF_MAXINSNS)
+      return -1;
+    if((prog = (struct bpf_prog*)kalloc()) == 0)
+      return -1;
+    // Copy first, so the program can't change after validation.
+    prog->len = n;
+    prog->jit = 0;
+    memmove(prog->insns, insns, n * sizeof(struct bpf_insn));
+    if(!bpf_validate(prog->insns, n)){
+      kfree((char*)prog);
+      return -1;
+    }
+    bpf_jit(prog);
+  }
+
+  acquire(&h->lock);
+  old = h->prog;
+  h->prog = prog;
+  release(&h->lock);
+
+  bpf_free(old);
+  return 0;
+}
+
+// Run the program attached to h on a frame. Returns how many bytes
+// of the frame to accept, 0 to drop it. With nothing attached every
+// frame is accepted whole.
+uint
+bpf_run(struct bpf_hook *h, uchar *pkt, uint len)
+{
+  uint r;
+
+  acquire(&h->lock);
+  if(h->prog == 0)
+    r = len;
+  else if(h->prog->jit)
+    r = h->prog->jit(pkt, len);
+  else
+    r = bpf_filter(h->prog->insns, pkt, len);
+  release(&h->lock);
+
+  return r;
+}
@@ -0,0 +1,82 @@
+#ifndef __XV6_NETSTACK_BPF_H__
+#define __XV6_NETSTACK_BPF_H__
+// Classic BPF packet filter programs.
+// Both the kernel and user programs use this header file.
+//
+// The instruction set and encoding are those of the BSD packet
+// filter (McCanne & Jacobson), so existing filter programs, such as
+// the output of `tcpdump -dd`, can be attached unchanged.
+
+struct bpf_insn {
+  ushort code;
+  uchar jt;    // forward jump offset if true
+  uchar jf;    // forward jump offset if false
+  uint k;      // generic field
+};
+
+#define BPF_MAXINSNS 256
+#define BPF_MEMWORDS 16   // scratch memory words
+
+// instruction classes
+#define BPF_CLASS(code) ((code) & 0x07)
+#define BPF_LD    0x00
+#define BPF_LDX   0x01
+#define BPF_ST    0x02
+#define BPF_STX   0x03
+#define BPF_ALU   0x04
+#define BPF_JMP   0x05
+#define BPF_RET   0x06
+#define BPF_MISC  0x07
+
+// ld/ldx fields
+#define BPF_SIZE(code) ((code) & 0x18)
+#define BPF_W     0x00
+#define BPF_H     0x08
+#define BPF_B     0x10
+#define BPF_MODE(code) ((code) & 0xe0)
+#define BPF_IMM   0x00
+#define BPF_ABS   0x20
+#define BPF_IND   0x40
+#define BPF_MEM   0x60
+#define BPF_LEN   0x80
+#define BPF_MSH   0xa0
+
+// alu/jmp fields
+#define BPF_OP(code) ((code) & 0xf0)
+#define BPF_ADD   0x00
+#define BPF_SUB   0x10
+#define BPF_MUL   0x20
+#define BPF_DIV   0x30
+#define BPF_OR    0x40
+#define BPF_AND   0x50
+#define BPF_LSH   0x60
+#define BPF_RSH   0x70
+#define BPF_NEG   0x80
+#define BPF_MOD   0x90
+#define BPF_XOR   0xa0
+#define BPF_JA    0x00
+#define BPF_JEQ   0x10
+#define BPF_JGT   0x20
+#define BPF_JGE   0x30
+#define BPF_JSET  0x40
+#define BPF_SRC(code) ((code) & 0x08)
+#define BPF_K     0x00
+#define BPF_X     0x08
+
+// ret - BPF_K and BPF_X also apply
+#define BPF_RVAL(code) ((code) & 0x18)
+#define BPF_A     0x10
+
+// misc
+#define BPF_MISCOP(code) ((code) & 0xf8)
+#define BPF_TAX   0x00
+#define BPF_TXA   0x80
+
+// Macros for building filter programs.
+#define BPF_STMT(code, k) { (ushort)(code), 0, 0, k }
+#define BPF_JUMP(code, k, jt, jf) { (ushort)(code), jt, jf, k }
+
+// bpfattach targets other than an interface index
+#define BPF_CAPTURE (-1)  // the packet capture ring
+
+#endif
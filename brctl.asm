@@ -0,0 +1,1699 @@
+
+_brctl:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <usage>:
+
+struct brfdb fdb[BR_NFDB];
+
+static void
+usage(void)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 08             	sub    $0x8,%esp
+  printf(2, "usage: brctl addif|delif ifindex\n"
+   6:	83 ec 08             	sub    $0x8,%esp
+   9:	68 78 0d 00 00       	push   $0xd78
+   e:	6a 02                	push   $0x2
+  10:	e8 85 09 00 00       	call   99a <printf>
+  15:	83 c4 10             	add    $0x10,%esp
+            "       brctl ageing seconds\n"
+            "       brctl show|showmacs\n");
+  exit();
+  18:	e8 c1 07 00 00       	call   7de <exit>
+
+0000001d <show>:
+}
+
+static void
+show(void)
+{
+  1d:	55                   	push   %ebp
+  1e:	89 e5                	mov    %esp,%ebp
+  20:	53                   	push   %ebx
+  21:	83 ec 24             	sub    $0x24,%esp
+  struct brstat st;
+  int i;
+
+  if(brctl(BR_STAT, 0, &st) < 0){
+  24:	83 ec 04             	sub    $0x4,%esp
+  27:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  2a:	50                   	push   %eax
+  2b:	6a 00                	push   $0x0
+  2d:	6a 04                	push   $0x4
+  2f:	e8 82 08 00 00       	call   8b6 <brctl>
+  34:	83 c4 10             	add    $0x10,%esp
+  37:	85 c0                	test   %eax,%eax
+  39:	79 17                	jns    52 <show+0x35>
+    printf(2, "brctl: no bridge\n");
+  3b:	83 ec 08             	sub    $0x8,%esp
+  3e:	68 d1 0d 00 00       	push   $0xdd1
+  43:	6a 02                	push   $0x2
+  45:	e8 50 09 00 00       	call   99a <printf>
+  4a:	83 c4 10             	add    $0x10,%esp
+  4d:	e9 8a 00 00 00       	jmp    dc <show+0xbf>
+    return;
+  }
+  printf(1, "ports:");
+  52:	83 ec 08             	sub    $0x8,%esp
+  55:	68 e3 0d 00 00       	push   $0xde3
+  5a:	6a 01                	push   $0x1
+  5c:	e8 39 09 00 00       	call   99a <printf>
+  61:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 32; i++)
+  64:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  6b:	eb 30                	jmp    9d <show+0x80>
+    if(st.ports & (1 << i))
+  6d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  70:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  73:	bb 01 00 00 00       	mov    $0x1,%ebx
+  78:	89 c1                	mov    %eax,%ecx
+  7a:	d3 e3                	shl    %cl,%ebx
+  7c:	89 d8                	mov    %ebx,%eax
+  7e:	21 d0                	and    %edx,%eax
+  80:	85 c0                	test   %eax,%eax
+  82:	74 15                	je     99 <show+0x7c>
+      printf(1, " eth%d", i);
+  84:	83 ec 04             	sub    $0x4,%esp
+  87:	ff 75 f4             	push   -0xc(%ebp)
+  8a:	68 ea 0d 00 00       	push   $0xdea
+  8f:	6a 01                	push   $0x1
+  91:	e8 04 09 00 00       	call   99a <printf>
+  96:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 32; i++)
+  99:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  9d:	83 7d f4 1f          	cmpl   $0x1f,-0xc(%ebp)
+  a1:	7e ca                	jle    6d <show+0x50>
+  printf(1, "\nageing %d s, %d addresses learned\n", st.ageing, st.entries);
+  a3:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  a6:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  a9:	52                   	push   %edx
+  aa:	50                   	push   %eax
+  ab:	68 f4 0d 00 00       	push   $0xdf4
+  b0:	6a 01                	push   $0x1
+  b2:	e8 e3 08 00 00       	call   99a <printf>
+  b7:	83 c4 10             	add    $0x10,%esp
+  printf(1, "forwarded %d flooded %d filtered %d local %d\n",
+  ba:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  bd:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+  c0:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  c3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  c6:	83 ec 08             	sub    $0x8,%esp
+  c9:	53                   	push   %ebx
+  ca:	51                   	push   %ecx
+  cb:	52                   	push   %edx
+  cc:	50                   	push   %eax
+  cd:	68 18 0e 00 00       	push   $0xe18
+  d2:	6a 01                	push   $0x1
+  d4:	e8 c1 08 00 00       	call   99a <printf>
+  d9:	83 c4 20             	add    $0x20,%esp
+         st.forwarded, st.flooded, st.filtered, st.local);
+}
+  dc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  df:	c9                   	leave
+  e0:	c3                   	ret
+
+000000e1 <showmacs>:
+
+static void
+showmacs(void)
+{
+  e1:	55                   	push   %ebp
+  e2:	89 e5                	mov    %esp,%ebp
+  e4:	83 ec 18             	sub    $0x18,%esp
+  int i, j, n;
+
+  if((n = brctl(BR_FDB, BR_NFDB, fdb)) < 0){
+  e7:	83 ec 04             	sub    $0x4,%esp
+  ea:	68 40 16 00 00       	push   $0x1640
+  ef:	68 00 04 00 00       	push   $0x400
+  f4:	6a 05                	push   $0x5
+  f6:	e8 bb 07 00 00       	call   8b6 <brctl>
+  fb:	83 c4 10             	add    $0x10,%esp
+  fe:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 101:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 105:	79 17                	jns    11e <showmacs+0x3d>
+    printf(2, "brctl: no bridge\n");
+ 107:	83 ec 08             	sub    $0x8,%esp
+ 10a:	68 d1 0d 00 00       	push   $0xdd1
+ 10f:	6a 02                	push   $0x2
+ 111:	e8 84 08 00 00       	call   99a <printf>
+ 116:	83 c4 10             	add    $0x10,%esp
+    return;
+ 119:	e9 ce 00 00 00       	jmp    1ec <showmacs+0x10b>
+  }
+  printf(1, "port mac address       age\n");
+ 11e:	83 ec 08             	sub    $0x8,%esp
+ 121:	68 46 0e 00 00       	push   $0xe46
+ 126:	6a 01                	push   $0x1
+ 128:	e8 6d 08 00 00       	call   99a <printf>
+ 12d:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i++){
+ 130:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 137:	e9 a4 00 00 00       	jmp    1e0 <showmacs+0xff>
+    printf(1, "eth%d ", fdb[i].ifindex);
+ 13c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 13f:	89 d0                	mov    %edx,%eax
+ 141:	01 c0                	add    %eax,%eax
+ 143:	01 d0                	add    %edx,%eax
+ 145:	c1 e0 02             	shl    $0x2,%eax
+ 148:	05 46 16 00 00       	add    $0x1646,%eax
+ 14d:	0f b6 00             	movzbl (%eax),%eax
+ 150:	0f b6 c0             	movzbl %al,%eax
+ 153:	83 ec 04             	sub    $0x4,%esp
+ 156:	50                   	push   %eax
+ 157:	68 62 0e 00 00       	push   $0xe62
+ 15c:	6a 01                	push   $0x1
+ 15e:	e8 37 08 00 00       	call   99a <printf>
+ 163:	83 c4 10             	add    $0x10,%esp
+    for(j = 0; j < 6; j++)
+ 166:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 16d:	eb 41                	jmp    1b0 <showmacs+0xcf>
+      printf(1, j ? ":%x" : "%x", fdb[i].mac[j]);
+ 16f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 172:	89 d0                	mov    %edx,%eax
+ 174:	01 c0                	add    %eax,%eax
+ 176:	01 d0                	add    %edx,%eax
+ 178:	c1 e0 02             	shl    $0x2,%eax
+ 17b:	8b 55 f0             	mov    -0x10(%ebp),%edx
+ 17e:	01 d0                	add    %edx,%eax
+ 180:	05 40 16 00 00       	add    $0x1640,%eax
+ 185:	0f b6 00             	movzbl (%eax),%eax
+ 188:	0f b6 c0             	movzbl %al,%eax
+ 18b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 18f:	74 07                	je     198 <showmacs+0xb7>
+ 191:	ba 69 0e 00 00       	mov    $0xe69,%edx
+ 196:	eb 05                	jmp    19d <showmacs+0xbc>
+ 198:	ba 6d 0e 00 00       	mov    $0xe6d,%edx
+ 19d:	83 ec 04             	sub    $0x4,%esp
+ 1a0:	50                   	push   %eax
+ 1a1:	52                   	push   %edx
+ 1a2:	6a 01                	push   $0x1
+ 1a4:	e8 f1 07 00 00       	call   99a <printf>
+ 1a9:	83 c4 10             	add    $0x10,%esp
+    for(j = 0; j < 6; j++)
+ 1ac:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 1b0:	83 7d f0 05          	cmpl   $0x5,-0x10(%ebp)
+ 1b4:	7e b9                	jle    16f <showmacs+0x8e>
+    printf(1, " %d\n", fdb[i].age);
+ 1b6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1b9:	89 d0                	mov    %edx,%eax
+ 1bb:	01 c0                	add    %eax,%eax
+ 1bd:	01 d0                	add    %edx,%eax
+ 1bf:	c1 e0 02             	shl    $0x2,%eax
+ 1c2:	05 48 16 00 00       	add    $0x1648,%eax
+ 1c7:	8b 00                	mov    (%eax),%eax
+ 1c9:	83 ec 04             	sub    $0x4,%esp
+ 1cc:	50                   	push   %eax
+ 1cd:	68 70 0e 00 00       	push   $0xe70
+ 1d2:	6a 01                	push   $0x1
+ 1d4:	e8 c1 07 00 00       	call   99a <printf>
+ 1d9:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i++){
+ 1dc:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 1e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1e3:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 1e6:	0f 8c 50 ff ff ff    	jl     13c <showmacs+0x5b>
+  }
+}
+ 1ec:	c9                   	leave
+ 1ed:	c3                   	ret
+
+000001ee <main>:
+
+int
+main(int argc, char *argv[])
+{
+ 1ee:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 1f2:	83 e4 f0             	and    $0xfffffff0,%esp
+ 1f5:	ff 71 fc             	push   -0x4(%ecx)
+ 1f8:	55                   	push   %ebp
+ 1f9:	89 e5                	mov    %esp,%ebp
+ 1fb:	53                   	push   %ebx
+ 1fc:	51                   	push   %ecx
+ 1fd:	83 ec 10             	sub    $0x10,%esp
+ 200:	89 cb                	mov    %ecx,%ebx
+  int cmd;
+
+  if(argc == 2 && strcmp(argv[1], "show") == 0)
+ 202:	83 3b 02             	cmpl   $0x2,(%ebx)
+ 205:	75 27                	jne    22e <main+0x40>
+ 207:	8b 43 04             	mov    0x4(%ebx),%eax
+ 20a:	83 c0 04             	add    $0x4,%eax
+ 20d:	8b 00                	mov    (%eax),%eax
+ 20f:	83 ec 08             	sub    $0x8,%esp
+ 212:	68 75 0e 00 00       	push   $0xe75
+ 217:	50                   	push   %eax
+ 218:	e8 4f 03 00 00       	call   56c <strcmp>
+ 21d:	83 c4 10             	add    $0x10,%esp
+ 220:	85 c0                	test   %eax,%eax
+ 222:	75 0a                	jne    22e <main+0x40>
+    show();
+ 224:	e8 f4 fd ff ff       	call   1d <show>
+ 229:	e9 fd 00 00 00       	jmp    32b <main+0x13d>
+  else if(argc == 2 && strcmp(argv[1], "showmacs") == 0)
+ 22e:	83 3b 02             	cmpl   $0x2,(%ebx)
+ 231:	75 27                	jne    25a <main+0x6c>
+ 233:	8b 43 04             	mov    0x4(%ebx),%eax
+ 236:	83 c0 04             	add    $0x4,%eax
+ 239:	8b 00                	mov    (%eax),%eax
+ 23b:	83 ec 08             	sub    $0x8,%esp
+ 23e:	68 7a 0e 00 00       	push   $0xe7a
+ 243:	50                   	push   %eax
+ 244:	e8 23 03 00 00       	call   56c <strcmp>
+ 249:	83 c4 10             	add    $0x10,%esp
+ 24c:	85 c0                	test   %eax,%eax
+ 24e:	75 0a                	jne    25a <main+0x6c>
+    showmacs();
+ 250:	e8 8c fe ff ff       	call   e1 <showmacs>
+ 255:	e9 d1 00 00 00       	jmp    32b <main+0x13d>
+  else if(argc == 3){
+ 25a:	83 3b 03             	cmpl   $0x3,(%ebx)
+ 25d:	0f 85 c3 00 00 00    	jne    326 <main+0x138>
+    if(strcmp(argv[1], "addif") == 0)
+ 263:	8b 43 04             	mov    0x4(%ebx),%eax
+ 266:	83 c0 04             	add    $0x4,%eax
+ 269:	8b 00                	mov    (%eax),%eax
+ 26b:	83 ec 08             	sub    $0x8,%esp
+ 26e:	68 83 0e 00 00       	push   $0xe83
+ 273:	50                   	push   %eax
+ 274:	e8 f3 02 00 00       	call   56c <strcmp>
+ 279:	83 c4 10             	add    $0x10,%esp
+ 27c:	85 c0                	test   %eax,%eax
+ 27e:	75 09                	jne    289 <main+0x9b>
+      cmd = BR_ADDIF;
+ 280:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+ 287:	eb 51                	jmp    2da <main+0xec>
+    else if(strcmp(argv[1], "delif") == 0)
+ 289:	8b 43 04             	mov    0x4(%ebx),%eax
+ 28c:	83 c0 04             	add    $0x4,%eax
+ 28f:	8b 00                	mov    (%eax),%eax
+ 291:	83 ec 08             	sub    $0x8,%esp
+ 294:	68 89 0e 00 00       	push   $0xe89
+ 299:	50                   	push   %eax
+ 29a:	e8 cd 02 00 00       	call   56c <strcmp>
+ 29f:	83 c4 10             	add    $0x10,%esp
+ 2a2:	85 c0                	test   %eax,%eax
+ 2a4:	75 09                	jne    2af <main+0xc1>
+      cmd = BR_DELIF;
+ 2a6:	c7 45 f4 02 00 00 00 	movl   $0x2,-0xc(%ebp)
+ 2ad:	eb 2b                	jmp    2da <main+0xec>
+    else if(strcmp(argv[1], "ageing") == 0)
+ 2af:	8b 43 04             	mov    0x4(%ebx),%eax
+ 2b2:	83 c0 04             	add    $0x4,%eax
+ 2b5:	8b 00                	mov    (%eax),%eax
+ 2b7:	83 ec 08             	sub    $0x8,%esp
+ 2ba:	68 8f 0e 00 00       	push   $0xe8f
+ 2bf:	50                   	push   %eax
+ 2c0:	e8 a7 02 00 00       	call   56c <strcmp>
+ 2c5:	83 c4 10             	add    $0x10,%esp
+ 2c8:	85 c0                	test   %eax,%eax
+ 2ca:	75 09                	jne    2d5 <main+0xe7>
+      cmd = BR_AGEING;
+ 2cc:	c7 45 f4 03 00 00 00 	movl   $0x3,-0xc(%ebp)
+ 2d3:	eb 05                	jmp    2da <main+0xec>
+    else
+      usage();
+ 2d5:	e8 26 fd ff ff       	call   0 <usage>
+    if(brctl(cmd, atoi(argv[2]), 0) < 0)
+ 2da:	8b 43 04             	mov    0x4(%ebx),%eax
+ 2dd:	83 c0 08             	add    $0x8,%eax
+ 2e0:	8b 00                	mov    (%eax),%eax
+ 2e2:	83 ec 0c             	sub    $0xc,%esp
+ 2e5:	50                   	push   %eax
+ 2e6:	e8 34 02 00 00       	call   51f <atoi>
+ 2eb:	83 c4 10             	add    $0x10,%esp
+ 2ee:	83 ec 04             	sub    $0x4,%esp
+ 2f1:	6a 00                	push   $0x0
+ 2f3:	50                   	push   %eax
+ 2f4:	ff 75 f4             	push   -0xc(%ebp)
+ 2f7:	e8 ba 05 00 00       	call   8b6 <brctl>
+ 2fc:	83 c4 10             	add    $0x10,%esp
+ 2ff:	85 c0                	test   %eax,%eax
+ 301:	79 28                	jns    32b <main+0x13d>
+      printf(2, "brctl: %s %s failed\n", argv[1], argv[2]);
+ 303:	8b 43 04             	mov    0x4(%ebx),%eax
+ 306:	83 c0 08             	add    $0x8,%eax
+ 309:	8b 10                	mov    (%eax),%edx
+ 30b:	8b 43 04             	mov    0x4(%ebx),%eax
+ 30e:	83 c0 04             	add    $0x4,%eax
+ 311:	8b 00                	mov    (%eax),%eax
+ 313:	52                   	push   %edx
+ 314:	50                   	push   %eax
+ 315:	68 96 0e 00 00       	push   $0xe96
+ 31a:	6a 02                	push   $0x2
+ 31c:	e8 79 06 00 00       	call   99a <printf>
+ 321:	83 c4 10             	add    $0x10,%esp
+ 324:	eb 05                	jmp    32b <main+0x13d>
+  } else
+    usage();
+ 326:	e8 d5 fc ff ff       	call   0 <usage>
+  exit();
+ 32b:	e8 ae 04 00 00       	call   7de <exit>
+
+00000330 <stosb>:
+}
+
+int
+stat(char *n, struct stat *st)
+{
+  int fd;
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	57                   	push   %edi
+ 334:	53                   	push   %ebx
+  int r;
+ 335:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 338:	8b 55 10             	mov    0x10(%ebp),%edx
+ 33b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 33e:	89 cb                	mov    %ecx,%ebx
+ 340:	89 df                	mov    %ebx,%edi
+ 342:	89 d1                	mov    %edx,%ecx
+ 344:	fc                   	cld
+ 345:	f3 aa                	rep stos %al,%es:(%edi)
+ 347:	89 ca                	mov    %ecx,%edx
+ 349:	89 fb                	mov    %edi,%ebx
+ 34b:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 34e:	89 55 10             	mov    %edx,0x10(%ebp)
+
+  fd = open(n, O_RDONLY);
+  if(fd < 0)
+    return -1;
+ 351:	90                   	nop
+ 352:	5b                   	pop    %ebx
+ 353:	5f                   	pop    %edi
+ 354:	5d                   	pop    %ebp
+ 355:	c3                   	ret
+
+00000356 <strcpy>:
+{
+ 356:	55                   	push   %ebp
+ 357:	89 e5                	mov    %esp,%ebp
+ 359:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 35c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 35f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 362:	90                   	nop
+ 363:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 366:	8d 42 01             	lea    0x1(%edx),%eax
+ 369:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 36c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 36f:	8d 48 01             	lea    0x1(%eax),%ecx
+ 372:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 375:	0f b6 12             	movzbl (%edx),%edx
+ 378:	88 10                	mov    %dl,(%eax)
+ 37a:	0f b6 00             	movzbl (%eax),%eax
+ 37d:	84 c0                	test   %al,%al
+ 37f:	75 e2                	jne    363 <strcpy+0xd>
+  return os;
+ 381:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 384:	c9                   	leave
+ 385:	c3                   	ret
+
+00000386 <strlen>:
+{
+ 386:	55                   	push   %ebp
+ 387:	89 e5                	mov    %esp,%ebp
+ 389:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 38c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 393:	eb 04                	jmp    399 <strlen+0x13>
+ 395:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 399:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 39c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 39f:	01 d0                	add    %edx,%eax
+ 3a1:	0f b6 00             	movzbl (%eax),%eax
+ 3a4:	84 c0                	test   %al,%al
+ 3a6:	75 ed                	jne    395 <strlen+0xf>
+  return n;
+ 3a8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3ab:	c9                   	leave
+ 3ac:	c3                   	ret
+
+000003ad <memset>:
+{
+ 3ad:	55                   	push   %ebp
+ 3ae:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 3b0:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3b3:	50                   	push   %eax
+ 3b4:	ff 75 0c             	push   0xc(%ebp)
+ 3b7:	ff 75 08             	push   0x8(%ebp)
+ 3ba:	e8 71 ff ff ff       	call   330 <stosb>
+ 3bf:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 3c2:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3c5:	c9                   	leave
+ 3c6:	c3                   	ret
+
+000003c7 <strchr>:
+{
+ 3c7:	55                   	push   %ebp
+ 3c8:	89 e5                	mov    %esp,%ebp
+ 3ca:	83 ec 04             	sub    $0x4,%esp
+ 3cd:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3d0:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 3d3:	eb 14                	jmp    3e9 <strchr+0x22>
+    if(*s == c)
+ 3d5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d8:	0f b6 00             	movzbl (%eax),%eax
+ 3db:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 3de:	75 05                	jne    3e5 <strchr+0x1e>
+      return (char*)s;
+ 3e0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e3:	eb 13                	jmp    3f8 <strchr+0x31>
+  for(; *s; s++)
+ 3e5:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 3e9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3ec:	0f b6 00             	movzbl (%eax),%eax
+ 3ef:	84 c0                	test   %al,%al
+ 3f1:	75 e2                	jne    3d5 <strchr+0xe>
+  return 0;
+ 3f3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 3f8:	c9                   	leave
+ 3f9:	c3                   	ret
+
+000003fa <gets>:
+{
+ 3fa:	55                   	push   %ebp
+ 3fb:	89 e5                	mov    %esp,%ebp
+ 3fd:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 400:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 407:	eb 42                	jmp    44b <gets+0x51>
+    cc = read(0, &c, 1);
+ 409:	83 ec 04             	sub    $0x4,%esp
+ 40c:	6a 01                	push   $0x1
+ 40e:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 411:	50                   	push   %eax
+ 412:	6a 00                	push   $0x0
+ 414:	e8 dd 03 00 00       	call   7f6 <read>
+ 419:	83 c4 10             	add    $0x10,%esp
+ 41c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 41f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 423:	7e 33                	jle    458 <gets+0x5e>
+    buf[i++] = c;
+ 425:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 428:	8d 50 01             	lea    0x1(%eax),%edx
+ 42b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 42e:	89 c2                	mov    %eax,%edx
+ 430:	8b 45 08             	mov    0x8(%ebp),%eax
+ 433:	01 c2                	add    %eax,%edx
+ 435:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 439:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 43b:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 43f:	3c 0a                	cmp    $0xa,%al
+ 441:	74 16                	je     459 <gets+0x5f>
+ 443:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 447:	3c 0d                	cmp    $0xd,%al
+ 449:	74 0e                	je     459 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 44b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 44e:	83 c0 01             	add    $0x1,%eax
+ 451:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 454:	7f b3                	jg     409 <gets+0xf>
+ 456:	eb 01                	jmp    459 <gets+0x5f>
+      break;
+ 458:	90                   	nop
+  buf[i] = '\0';
+ 459:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 45c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 45f:	01 d0                	add    %edx,%eax
+ 461:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 464:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 467:	c9                   	leave
+ 468:	c3                   	ret
+
+00000469 <stat>:
+{
+ 469:	55                   	push   %ebp
+ 46a:	89 e5                	mov    %esp,%ebp
+ 46c:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+ 46f:	83 ec 08             	sub    $0x8,%esp
+ 472:	6a 00                	push   $0x0
+ 474:	ff 75 08             	push   0x8(%ebp)
+ 477:	e8 a2 03 00 00       	call   81e <open>
+ 47c:	83 c4 10             	add    $0x10,%esp
+ 47f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 482:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 486:	79 07                	jns    48f <stat+0x26>
+    return -1;
+ 488:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 48d:	eb 25                	jmp    4b4 <stat+0x4b>
+  r = fstat(fd, st);
+ 48f:	83 ec 08             	sub    $0x8,%esp
+ 492:	ff 75 0c             	push   0xc(%ebp)
+ 495:	ff 75 f4             	push   -0xc(%ebp)
+ 498:	e8 99 03 00 00       	call   836 <fstat>
+ 49d:	83 c4 10             	add    $0x10,%esp
+ 4a0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 4a3:	83 ec 0c             	sub    $0xc,%esp
+ 4a6:	ff 75 f4             	push   -0xc(%ebp)
+ 4a9:	e8 58 03 00 00       	call   806 <close>
+ 4ae:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 4b1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 4b4:	c9                   	leave
+ 4b5:	c3                   	ret
+
+000004b6 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 4b6:	55                   	push   %ebp
+ 4b7:	89 e5                	mov    %esp,%ebp
+ 4b9:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+
+  dst = vdst;
+ 4bc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4bf:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 4c2:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4c5:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 4c8:	eb 17                	jmp    4e1 <memmove+0x2b>
+    *dst++ = *src++;
+ 4ca:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 4cd:	8d 42 01             	lea    0x1(%edx),%eax
+ 4d0:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 4d3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 4d6:	8d 48 01             	lea    0x1(%eax),%ecx
+ 4d9:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 4dc:	0f b6 12             	movzbl (%edx),%edx
+ 4df:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 4e1:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4e4:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 4e7:	89 55 10             	mov    %edx,0x10(%ebp)
+ 4ea:	85 c0                	test   %eax,%eax
+ 4ec:	7f dc                	jg     4ca <memmove+0x14>
+  return vdst;
+ 4ee:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 4f1:	c9                   	leave
+ 4f2:	c3                   	ret
+
+000004f3 <cpuinfo>:
+ 4f3:	55                   	push   %ebp
+ 4f4:	89 e5                	mov    %esp,%ebp
+ 4f6:	56                   	push   %esi
+ 4f7:	53                   	push   %ebx
+ 4f8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4fb:	ba 00 00 00 00       	mov    $0x0,%edx
+ 500:	89 d1                	mov    %edx,%ecx
+ 502:	0f a2                	cpuid
+ 504:	89 c6                	mov    %eax,%esi
+ 506:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 509:	89 30                	mov    %esi,(%eax)
+ 50b:	8b 45 10             	mov    0x10(%ebp),%eax
+ 50e:	89 18                	mov    %ebx,(%eax)
+ 510:	8b 45 14             	mov    0x14(%ebp),%eax
+ 513:	89 08                	mov    %ecx,(%eax)
+ 515:	8b 45 18             	mov    0x18(%ebp),%eax
+ 518:	89 10                	mov    %edx,(%eax)
+ 51a:	90                   	nop
+ 51b:	5b                   	pop    %ebx
+ 51c:	5e                   	pop    %esi
+ 51d:	5d                   	pop    %ebp
+ 51e:	c3                   	ret
+
+0000051f <atoi>:
+{
+ 51f:	55                   	push   %ebp
+ 520:	89 e5                	mov    %esp,%ebp
+ 522:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+ 525:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 52c:	eb 25                	jmp    553 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 52e:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 531:	89 d0                	mov    %edx,%eax
+ 533:	c1 e0 02             	shl    $0x2,%eax
+ 536:	01 d0                	add    %edx,%eax
+ 538:	01 c0                	add    %eax,%eax
+ 53a:	89 c1                	mov    %eax,%ecx
+ 53c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 53f:	8d 50 01             	lea    0x1(%eax),%edx
+ 542:	89 55 08             	mov    %edx,0x8(%ebp)
+ 545:	0f b6 00             	movzbl (%eax),%eax
+ 548:	0f be c0             	movsbl %al,%eax
+ 54b:	01 c8                	add    %ecx,%eax
+ 54d:	83 e8 30             	sub    $0x30,%eax
+ 550:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 553:	8b 45 08             	mov    0x8(%ebp),%eax
+ 556:	0f b6 00             	movzbl (%eax),%eax
+ 559:	3c 2f                	cmp    $0x2f,%al
+ 55b:	7e 0a                	jle    567 <atoi+0x48>
+ 55d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 560:	0f b6 00             	movzbl (%eax),%eax
+ 563:	3c 39                	cmp    $0x39,%al
+ 565:	7e c7                	jle    52e <atoi+0xf>
+  return n;
+ 567:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 56a:	c9                   	leave
+ 56b:	c3                   	ret
+
+0000056c <strcmp>:
+{
+ 56c:	55                   	push   %ebp
+ 56d:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 56f:	eb 08                	jmp    579 <strcmp+0xd>
+    p++, q++;
+ 571:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 575:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 579:	8b 45 08             	mov    0x8(%ebp),%eax
+ 57c:	0f b6 00             	movzbl (%eax),%eax
+ 57f:	84 c0                	test   %al,%al
+ 581:	74 10                	je     593 <strcmp+0x27>
+ 583:	8b 45 08             	mov    0x8(%ebp),%eax
+ 586:	0f b6 10             	movzbl (%eax),%edx
+ 589:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 58c:	0f b6 00             	movzbl (%eax),%eax
+ 58f:	38 c2                	cmp    %al,%dl
+ 591:	74 de                	je     571 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 593:	8b 45 08             	mov    0x8(%ebp),%eax
+ 596:	0f b6 00             	movzbl (%eax),%eax
+ 599:	0f b6 d0             	movzbl %al,%edx
+ 59c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 59f:	0f b6 00             	movzbl (%eax),%eax
+ 5a2:	0f b6 c0             	movzbl %al,%eax
+ 5a5:	29 c2                	sub    %eax,%edx
+ 5a7:	89 d0                	mov    %edx,%eax
+}
+ 5a9:	5d                   	pop    %ebp
+ 5aa:	c3                   	ret
+
+000005ab <udiv64>:
+{
+ 5ab:	55                   	push   %ebp
+ 5ac:	89 e5                	mov    %esp,%ebp
+ 5ae:	57                   	push   %edi
+ 5af:	56                   	push   %esi
+ 5b0:	83 ec 38             	sub    $0x38,%esp
+ 5b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5b6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 5b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5bc:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 5bf:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5c2:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 5c5:	8b 45 14             	mov    0x14(%ebp),%eax
+ 5c8:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  q = r = 0;
+ 5cb:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 5d2:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 5d9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5dc:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 5df:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 5e2:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 5e5:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 5ec:	e9 85 00 00 00       	jmp    676 <udiv64+0xcb>
+    r = (r << 1) | ((n >> i) & 1);
+ 5f1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5f4:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 5f7:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 5fb:	01 c0                	add    %eax,%eax
+ 5fd:	89 c6                	mov    %eax,%esi
+ 5ff:	89 d7                	mov    %edx,%edi
+ 601:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 604:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 607:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 60a:	0f ad d0             	shrd   %cl,%edx,%eax
+ 60d:	d3 ea                	shr    %cl,%edx
+ 60f:	f6 c1 20             	test   $0x20,%cl
+ 612:	74 04                	je     618 <udiv64+0x6d>
+ 614:	89 d0                	mov    %edx,%eax
+ 616:	31 d2                	xor    %edx,%edx
+ 618:	83 e0 01             	and    $0x1,%eax
+ 61b:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 61e:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+ 625:	89 f0                	mov    %esi,%eax
+ 627:	89 fa                	mov    %edi,%edx
+ 629:	0b 45 c0             	or     -0x40(%ebp),%eax
+ 62c:	0b 55 c4             	or     -0x3c(%ebp),%edx
+ 62f:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 632:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 635:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 638:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 63b:	3b 45 c8             	cmp    -0x38(%ebp),%eax
+ 63e:	89 d0                	mov    %edx,%eax
+ 640:	1b 45 cc             	sbb    -0x34(%ebp),%eax
+ 643:	72 2d                	jb     672 <udiv64+0xc7>
+      r -= d;
+ 645:	8b 45 c8             	mov    -0x38(%ebp),%eax
+ 648:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 64b:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 64e:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64_t)1 << i;
+ 651:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 654:	b8 01 00 00 00       	mov    $0x1,%eax
+ 659:	ba 00 00 00 00       	mov    $0x0,%edx
+ 65e:	0f a5 c2             	shld   %cl,%eax,%edx
+ 661:	d3 e0                	shl    %cl,%eax
+ 663:	f6 c1 20             	test   $0x20,%cl
+ 666:	74 04                	je     66c <udiv64+0xc1>
+ 668:	89 c2                	mov    %eax,%edx
+ 66a:	31 c0                	xor    %eax,%eax
+ 66c:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 66f:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 672:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 676:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 67a:	0f 89 71 ff ff ff    	jns    5f1 <udiv64+0x46>
+  if(rem)
+ 680:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+ 684:	74 0e                	je     694 <udiv64+0xe9>
+    *rem = r;
+ 686:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 689:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 68c:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 68f:	89 01                	mov    %eax,(%ecx)
+ 691:	89 51 04             	mov    %edx,0x4(%ecx)
+  return q;
+ 694:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 697:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 69a:	83 c4 38             	add    $0x38,%esp
+ 69d:	5e                   	pop    %esi
+ 69e:	5f                   	pop    %edi
+ 69f:	5d                   	pop    %ebp
+ 6a0:	c3                   	ret
+
+000006a1 <crc32cinit>:
+{
+ 6a1:	55                   	push   %ebp
+ 6a2:	89 e5                	mov    %esp,%ebp
+ 6a4:	83 ec 20             	sub    $0x20,%esp
+  for(i = 0; i < 256; i++){
+ 6a7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 6ae:	eb 4c                	jmp    6fc <crc32cinit+0x5b>
+    r = i;
+ 6b0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6b3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+ 6b6:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+ 6bd:	eb 26                	jmp    6e5 <crc32cinit+0x44>
+      r = (r >> 1) ^ ((r & 1) ? CRC32C_POLY : 0);
+ 6bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6c2:	d1 e8                	shr    %eax
+ 6c4:	89 c2                	mov    %eax,%edx
+ 6c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6c9:	83 e0 01             	and    $0x1,%eax
+ 6cc:	85 c0                	test   %eax,%eax
+ 6ce:	74 07                	je     6d7 <crc32cinit+0x36>
+ 6d0:	b8 78 3b f6 82       	mov    $0x82f63b78,%eax
+ 6d5:	eb 05                	jmp    6dc <crc32cinit+0x3b>
+ 6d7:	b8 00 00 00 00       	mov    $0x0,%eax
+ 6dc:	31 d0                	xor    %edx,%eax
+ 6de:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+ 6e1:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+ 6e5:	83 7d f8 07          	cmpl   $0x7,-0x8(%ebp)
+ 6e9:	76 d4                	jbe    6bf <crc32cinit+0x1e>
+    crc32ctab[i] = r;
+ 6eb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6ee:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 6f1:	89 14 85 20 12 00 00 	mov    %edx,0x1220(,%eax,4)
+  for(i = 0; i < 256; i++){
+ 6f8:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 6fc:	81 7d fc ff 00 00 00 	cmpl   $0xff,-0x4(%ebp)
+ 703:	76 ab                	jbe    6b0 <crc32cinit+0xf>
+  cpuinfo(1, &a, &b, &c, &d);
+ 705:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 708:	50                   	push   %eax
+ 709:	8d 45 e8             	lea    -0x18(%ebp),%eax
+ 70c:	50                   	push   %eax
+ 70d:	8d 45 ec             	lea    -0x14(%ebp),%eax
+ 710:	50                   	push   %eax
+ 711:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 714:	50                   	push   %eax
+ 715:	6a 01                	push   $0x1
+ 717:	e8 d7 fd ff ff       	call   4f3 <cpuinfo>
+ 71c:	83 c4 14             	add    $0x14,%esp
+  crc32chw = (c & CPUID_SSE42) != 0;
+ 71f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 722:	25 00 00 10 00       	and    $0x100000,%eax
+ 727:	85 c0                	test   %eax,%eax
+ 729:	0f 95 c0             	setne  %al
+ 72c:	0f b6 c0             	movzbl %al,%eax
+ 72f:	a3 ec 11 00 00       	mov    %eax,0x11ec
+}
+ 734:	90                   	nop
+ 735:	c9                   	leave
+ 736:	c3                   	ret
+
+00000737 <crc32c>:
+{
+ 737:	55                   	push   %ebp
+ 738:	89 e5                	mov    %esp,%ebp
+ 73a:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s = p;
+ 73d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 740:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(crc32chw < 0)
+ 743:	a1 ec 11 00 00       	mov    0x11ec,%eax
+ 748:	85 c0                	test   %eax,%eax
+ 74a:	79 05                	jns    751 <crc32c+0x1a>
+    crc32cinit();
+ 74c:	e8 50 ff ff ff       	call   6a1 <crc32cinit>
+  crc = ~crc;
+ 751:	f7 55 08             	notl   0x8(%ebp)
+  if(crc32chw){
+ 754:	a1 ec 11 00 00       	mov    0x11ec,%eax
+ 759:	85 c0                	test   %eax,%eax
+ 75b:	74 6c                	je     7c9 <crc32c+0x92>
+    for(; n >= 4; n -= 4, s += 4)
+ 75d:	eb 18                	jmp    777 <crc32c+0x40>
+      asm("crc32l %1, %0" : "+r" (crc) : "rm" (*(const uint*)s));
+ 75f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 762:	8b 10                	mov    (%eax),%edx
+ 764:	8b 45 08             	mov    0x8(%ebp),%eax
+ 767:	f2 0f 38 f1 c2       	crc32  %edx,%eax
+ 76c:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n >= 4; n -= 4, s += 4)
+ 76f:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+ 773:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+ 777:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+ 77b:	77 e2                	ja     75f <crc32c+0x28>
+    for(; n > 0; n--, s++)
+ 77d:	eb 19                	jmp    798 <crc32c+0x61>
+      asm("crc32b %1, %0" : "+r" (crc) : "qm" (*s));
+ 77f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 782:	0f b6 10             	movzbl (%eax),%edx
+ 785:	8b 45 08             	mov    0x8(%ebp),%eax
+ 788:	f2 0f 38 f0 c2       	crc32  %dl,%eax
+ 78d:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+ 790:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+ 794:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 798:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 79c:	75 e1                	jne    77f <crc32c+0x48>
+ 79e:	eb 2f                	jmp    7cf <crc32c+0x98>
+      crc = crc32ctab[(crc ^ *s) & 0xff] ^ (crc >> 8);
+ 7a0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7a3:	0f b6 00             	movzbl (%eax),%eax
+ 7a6:	0f b6 c0             	movzbl %al,%eax
+ 7a9:	33 45 08             	xor    0x8(%ebp),%eax
+ 7ac:	0f b6 c0             	movzbl %al,%eax
+ 7af:	8b 04 85 20 12 00 00 	mov    0x1220(,%eax,4),%eax
+ 7b6:	8b 55 08             	mov    0x8(%ebp),%edx
+ 7b9:	c1 ea 08             	shr    $0x8,%edx
+ 7bc:	31 d0                	xor    %edx,%eax
+ 7be:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+ 7c1:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+ 7c5:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 7c9:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 7cd:	75 d1                	jne    7a0 <crc32c+0x69>
+  return ~crc;
+ 7cf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7d2:	f7 d0                	not    %eax
+}
+ 7d4:	c9                   	leave
+ 7d5:	c3                   	ret
+
+000007d6 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 7d6:	b8 01 00 00 00       	mov    $0x1,%eax
+ 7db:	cd 40                	int    $0x40
+ 7dd:	c3                   	ret
+
+000007de <exit>:
+SYSCALL(exit)
+ 7de:	b8 02 00 00 00       	mov    $0x2,%eax
+ 7e3:	cd 40                	int    $0x40
+ 7e5:	c3                   	ret
+
+000007e6 <wait>:
+SYSCALL(wait)
+ 7e6:	b8 03 00 00 00       	mov    $0x3,%eax
+ 7eb:	cd 40                	int    $0x40
+ 7ed:	c3                   	ret
+
+000007ee <pipe>:
+SYSCALL(pipe)
+ 7ee:	b8 04 00 00 00       	mov    $0x4,%eax
+ 7f3:	cd 40                	int    $0x40
+ 7f5:	c3                   	ret
+
+000007f6 <read>:
+SYSCALL(read)
+ 7f6:	b8 05 00 00 00       	mov    $0x5,%eax
+ 7fb:	cd 40                	int    $0x40
+ 7fd:	c3                   	ret
+
+000007fe <write>:
+SYSCALL(write)
+ 7fe:	b8 10 00 00 00       	mov    $0x10,%eax
+ 803:	cd 40                	int    $0x40
+ 805:	c3                   	ret
+
+00000806 <close>:
+SYSCALL(close)
+ 806:	b8 15 00 00 00       	mov    $0x15,%eax
+ 80b:	cd 40                	int    $0x40
+ 80d:	c3                   	ret
+
+0000080e <kill>:
+SYSCALL(kill)
+ 80e:	b8 06 00 00 00       	mov    $0x6,%eax
+ 813:	cd 40                	int    $0x40
+ 815:	c3                   	ret
+
+00000816 <exec>:
+SYSCALL(exec)
+ 816:	b8 07 00 00 00       	mov    $0x7,%eax
+ 81b:	cd 40                	int    $0x40
+ 81d:	c3                   	ret
+
+0000081e <open>:
+SYSCALL(open)
+ 81e:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 823:	cd 40                	int    $0x40
+ 825:	c3                   	ret
+
+00000826 <mknod>:
+SYSCALL(mknod)
+ 826:	b8 11 00 00 00       	mov    $0x11,%eax
+ 82b:	cd 40                	int    $0x40
+ 82d:	c3                   	ret
+
+0000082e <unlink>:
+SYSCALL(unlink)
+ 82e:	b8 12 00 00 00       	mov    $0x12,%eax
+ 833:	cd 40                	int    $0x40
+ 835:	c3                   	ret
+
+00000836 <fstat>:
+SYSCALL(fstat)
+ 836:	b8 08 00 00 00       	mov    $0x8,%eax
+ 83b:	cd 40                	int    $0x40
+ 83d:	c3                   	ret
+
+0000083e <link>:
+SYSCALL(link)
+ 83e:	b8 13 00 00 00       	mov    $0x13,%eax
+ 843:	cd 40                	int    $0x40
+ 845:	c3                   	ret
+
+00000846 <mkdir>:
+SYSCALL(mkdir)
+ 846:	b8 14 00 00 00       	mov    $0x14,%eax
+ 84b:	cd 40                	int    $0x40
+ 84d:	c3                   	ret
+
+0000084e <chdir>:
+SYSCALL(chdir)
+ 84e:	b8 09 00 00 00       	mov    $0x9,%eax
+ 853:	cd 40                	int    $0x40
+ 855:	c3                   	ret
+
+00000856 <dup>:
+SYSCALL(dup)
+ 856:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 85b:	cd 40                	int    $0x40
+ 85d:	c3                   	ret
+
+0000085e <getpid>:
+SYSCALL(getpid)
+ 85e:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 863:	cd 40                	int    $0x40
+ 865:	c3                   	ret
+
+00000866 <sbrk>:
+SYSCALL(sbrk)
+ 866:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 86b:	cd 40                	int    $0x40
+ 86d:	c3                   	ret
+
+0000086e <sleep>:
+SYSCALL(sleep)
+ 86e:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 873:	cd 40                	int    $0x40
+ 875:	c3                   	ret
+
+00000876 <uptime>:
+SYSCALL(uptime)
+ 876:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 87b:	cd 40                	int    $0x40
+ 87d:	c3                   	ret
+
+0000087e <arp>:
+SYSCALL(arp)
+ 87e:	b8 16 00 00 00       	mov    $0x16,%eax
+ 883:	cd 40                	int    $0x40
+ 885:	c3                   	ret
+
+00000886 <ifstat>:
+SYSCALL(ifstat)
+ 886:	b8 17 00 00 00       	mov    $0x17,%eax
+ 88b:	cd 40                	int    $0x40
+ 88d:	c3                   	ret
+
+0000088e <pcapctl>:
+SYSCALL(pcapctl)
+ 88e:	b8 18 00 00 00       	mov    $0x18,%eax
+ 893:	cd 40                	int    $0x40
+ 895:	c3                   	ret
+
+00000896 <pcapread>:
+SYSCALL(pcapread)
+ 896:	b8 19 00 00 00       	mov    $0x19,%eax
+ 89b:	cd 40                	int    $0x40
+ 89d:	c3                   	ret
+
+0000089e <bpfattach>:
+SYSCALL(bpfattach)
+ 89e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 8a3:	cd 40                	int    $0x40
+ 8a5:	c3                   	ret
+
+000008a6 <pktgen>:
+SYSCALL(pktgen)
+ 8a6:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 8ab:	cd 40                	int    $0x40
+ 8ad:	c3                   	ret
+
+000008ae <reflect>:
+SYSCALL(reflect)
+ 8ae:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 8b3:	cd 40                	int    $0x40
+ 8b5:	c3                   	ret
+
+000008b6 <brctl>:
+SYSCALL(brctl)
+ 8b6:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 8bb:	cd 40                	int    $0x40
+ 8bd:	c3                   	ret
+
+000008be <hostopen>:
+SYSCALL(hostopen)
+ 8be:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 8c3:	cd 40                	int    $0x40
+ 8c5:	c3                   	ret
+
+000008c6 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 8c6:	55                   	push   %ebp
+ 8c7:	89 e5                	mov    %esp,%ebp
+ 8c9:	83 ec 18             	sub    $0x18,%esp
+ 8cc:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 8cf:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 8d2:	83 ec 04             	sub    $0x4,%esp
+ 8d5:	6a 01                	push   $0x1
+ 8d7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 8da:	50                   	push   %eax
+ 8db:	ff 75 08             	push   0x8(%ebp)
+ 8de:	e8 1b ff ff ff       	call   7fe <write>
+ 8e3:	83 c4 10             	add    $0x10,%esp
+}
+ 8e6:	90                   	nop
+ 8e7:	c9                   	leave
+ 8e8:	c3                   	ret
+
+000008e9 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 8e9:	55                   	push   %ebp
+ 8ea:	89 e5                	mov    %esp,%ebp
+ 8ec:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 8ef:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 8f6:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 8fa:	74 17                	je     913 <printint+0x2a>
+ 8fc:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 900:	79 11                	jns    913 <printint+0x2a>
+    neg = 1;
+ 902:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 909:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 90c:	f7 d8                	neg    %eax
+ 90e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 911:	eb 06                	jmp    919 <printint+0x30>
+  } else {
+    x = xx;
+ 913:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 916:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 919:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 920:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 923:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 926:	ba 00 00 00 00       	mov    $0x0,%edx
+ 92b:	f7 f1                	div    %ecx
+ 92d:	89 d1                	mov    %edx,%ecx
+ 92f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 932:	8d 50 01             	lea    0x1(%eax),%edx
+ 935:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 938:	0f b6 91 f0 11 00 00 	movzbl 0x11f0(%ecx),%edx
+ 93f:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 943:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 946:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 949:	ba 00 00 00 00       	mov    $0x0,%edx
+ 94e:	f7 f1                	div    %ecx
+ 950:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 953:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 957:	75 c7                	jne    920 <printint+0x37>
+  if(neg)
+ 959:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 95d:	74 2d                	je     98c <printint+0xa3>
+    buf[i++] = '-';
+ 95f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 962:	8d 50 01             	lea    0x1(%eax),%edx
+ 965:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 968:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 96d:	eb 1d                	jmp    98c <printint+0xa3>
+    putc(fd, buf[i]);
+ 96f:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 972:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 975:	01 d0                	add    %edx,%eax
+ 977:	0f b6 00             	movzbl (%eax),%eax
+ 97a:	0f be c0             	movsbl %al,%eax
+ 97d:	83 ec 08             	sub    $0x8,%esp
+ 980:	50                   	push   %eax
+ 981:	ff 75 08             	push   0x8(%ebp)
+ 984:	e8 3d ff ff ff       	call   8c6 <putc>
+ 989:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 98c:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 990:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 994:	79 d9                	jns    96f <printint+0x86>
+}
+ 996:	90                   	nop
+ 997:	90                   	nop
+ 998:	c9                   	leave
+ 999:	c3                   	ret
+
+0000099a <printf>:
+
+// Print to the given fd. Only understands %d, %u, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 99a:	55                   	push   %ebp
+ 99b:	89 e5                	mov    %esp,%ebp
+ 99d:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 9a0:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 9a7:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 9aa:	83 c0 04             	add    $0x4,%eax
+ 9ad:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 9b0:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 9b7:	e9 7d 01 00 00       	jmp    b39 <printf+0x19f>
+    c = fmt[i] & 0xff;
+ 9bc:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 9bf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9c2:	01 d0                	add    %edx,%eax
+ 9c4:	0f b6 00             	movzbl (%eax),%eax
+ 9c7:	0f be c0             	movsbl %al,%eax
+ 9ca:	25 ff 00 00 00       	and    $0xff,%eax
+ 9cf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 9d2:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 9d6:	75 2c                	jne    a04 <printf+0x6a>
+      if(c == '%'){
+ 9d8:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 9dc:	75 0c                	jne    9ea <printf+0x50>
+        state = '%';
+ 9de:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 9e5:	e9 4b 01 00 00       	jmp    b35 <printf+0x19b>
+      } else {
+        putc(fd, c);
+ 9ea:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9ed:	0f be c0             	movsbl %al,%eax
+ 9f0:	83 ec 08             	sub    $0x8,%esp
+ 9f3:	50                   	push   %eax
+ 9f4:	ff 75 08             	push   0x8(%ebp)
+ 9f7:	e8 ca fe ff ff       	call   8c6 <putc>
+ 9fc:	83 c4 10             	add    $0x10,%esp
+ 9ff:	e9 31 01 00 00       	jmp    b35 <printf+0x19b>
+      }
+    } else if(state == '%'){
+ a04:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ a08:	0f 85 27 01 00 00    	jne    b35 <printf+0x19b>
+      if(c == 'd'){
+ a0e:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ a12:	75 1e                	jne    a32 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ a14:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a17:	8b 00                	mov    (%eax),%eax
+ a19:	6a 01                	push   $0x1
+ a1b:	6a 0a                	push   $0xa
+ a1d:	50                   	push   %eax
+ a1e:	ff 75 08             	push   0x8(%ebp)
+ a21:	e8 c3 fe ff ff       	call   8e9 <printint>
+ a26:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a29:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a2d:	e9 fc 00 00 00       	jmp    b2e <printf+0x194>
+      } else if(c == 'u'){
+ a32:	83 7d e4 75          	cmpl   $0x75,-0x1c(%ebp)
+ a36:	75 1e                	jne    a56 <printf+0xbc>
+        printint(fd, *ap, 10, 0);
+ a38:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a3b:	8b 00                	mov    (%eax),%eax
+ a3d:	6a 00                	push   $0x0
+ a3f:	6a 0a                	push   $0xa
+ a41:	50                   	push   %eax
+ a42:	ff 75 08             	push   0x8(%ebp)
+ a45:	e8 9f fe ff ff       	call   8e9 <printint>
+ a4a:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a4d:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a51:	e9 d8 00 00 00       	jmp    b2e <printf+0x194>
+      } else if(c == 'x' || c == 'p'){
+ a56:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ a5a:	74 06                	je     a62 <printf+0xc8>
+ a5c:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ a60:	75 1e                	jne    a80 <printf+0xe6>
+        printint(fd, *ap, 16, 0);
+ a62:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a65:	8b 00                	mov    (%eax),%eax
+ a67:	6a 00                	push   $0x0
+ a69:	6a 10                	push   $0x10
+ a6b:	50                   	push   %eax
+ a6c:	ff 75 08             	push   0x8(%ebp)
+ a6f:	e8 75 fe ff ff       	call   8e9 <printint>
+ a74:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a77:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a7b:	e9 ae 00 00 00       	jmp    b2e <printf+0x194>
+      } else if(c == 's'){
+ a80:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ a84:	75 43                	jne    ac9 <printf+0x12f>
+        s = (char*)*ap;
+ a86:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a89:	8b 00                	mov    (%eax),%eax
+ a8b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ a8e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ a92:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a96:	75 25                	jne    abd <printf+0x123>
+          s = "(null)";
+ a98:	c7 45 f4 ab 0e 00 00 	movl   $0xeab,-0xc(%ebp)
+        while(*s != 0){
+ a9f:	eb 1c                	jmp    abd <printf+0x123>
+          putc(fd, *s);
+ aa1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aa4:	0f b6 00             	movzbl (%eax),%eax
+ aa7:	0f be c0             	movsbl %al,%eax
+ aaa:	83 ec 08             	sub    $0x8,%esp
+ aad:	50                   	push   %eax
+ aae:	ff 75 08             	push   0x8(%ebp)
+ ab1:	e8 10 fe ff ff       	call   8c6 <putc>
+ ab6:	83 c4 10             	add    $0x10,%esp
+          s++;
+ ab9:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ abd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ac0:	0f b6 00             	movzbl (%eax),%eax
+ ac3:	84 c0                	test   %al,%al
+ ac5:	75 da                	jne    aa1 <printf+0x107>
+ ac7:	eb 65                	jmp    b2e <printf+0x194>
+        }
+      } else if(c == 'c'){
+ ac9:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ acd:	75 1d                	jne    aec <printf+0x152>
+        putc(fd, *ap);
+ acf:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ ad2:	8b 00                	mov    (%eax),%eax
+ ad4:	0f be c0             	movsbl %al,%eax
+ ad7:	83 ec 08             	sub    $0x8,%esp
+ ada:	50                   	push   %eax
+ adb:	ff 75 08             	push   0x8(%ebp)
+ ade:	e8 e3 fd ff ff       	call   8c6 <putc>
+ ae3:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ ae6:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ aea:	eb 42                	jmp    b2e <printf+0x194>
+      } else if(c == '%'){
+ aec:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ af0:	75 17                	jne    b09 <printf+0x16f>
+        putc(fd, c);
+ af2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ af5:	0f be c0             	movsbl %al,%eax
+ af8:	83 ec 08             	sub    $0x8,%esp
+ afb:	50                   	push   %eax
+ afc:	ff 75 08             	push   0x8(%ebp)
+ aff:	e8 c2 fd ff ff       	call   8c6 <putc>
+ b04:	83 c4 10             	add    $0x10,%esp
+ b07:	eb 25                	jmp    b2e <printf+0x194>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ b09:	83 ec 08             	sub    $0x8,%esp
+ b0c:	6a 25                	push   $0x25
+ b0e:	ff 75 08             	push   0x8(%ebp)
+ b11:	e8 b0 fd ff ff       	call   8c6 <putc>
+ b16:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ b19:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ b1c:	0f be c0             	movsbl %al,%eax
+ b1f:	83 ec 08             	sub    $0x8,%esp
+ b22:	50                   	push   %eax
+ b23:	ff 75 08             	push   0x8(%ebp)
+ b26:	e8 9b fd ff ff       	call   8c6 <putc>
+ b2b:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ b2e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ b35:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ b39:	8b 55 0c             	mov    0xc(%ebp),%edx
+ b3c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b3f:	01 d0                	add    %edx,%eax
+ b41:	0f b6 00             	movzbl (%eax),%eax
+ b44:	84 c0                	test   %al,%al
+ b46:	0f 85 70 fe ff ff    	jne    9bc <printf+0x22>
+    }
+  }
+}
+ b4c:	90                   	nop
+ b4d:	90                   	nop
+ b4e:	c9                   	leave
+ b4f:	c3                   	ret
+
+00000b50 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ b50:	55                   	push   %ebp
+ b51:	89 e5                	mov    %esp,%ebp
+ b53:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ b56:	8b 45 08             	mov    0x8(%ebp),%eax
+ b59:	83 e8 08             	sub    $0x8,%eax
+ b5c:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b5f:	a1 28 16 00 00       	mov    0x1628,%eax
+ b64:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ b67:	eb 24                	jmp    b8d <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b69:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b6c:	8b 00                	mov    (%eax),%eax
+ b6e:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b71:	72 12                	jb     b85 <free+0x35>
+ b73:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b76:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b79:	72 24                	jb     b9f <free+0x4f>
+ b7b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b7e:	8b 00                	mov    (%eax),%eax
+ b80:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ b83:	72 1a                	jb     b9f <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b85:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b88:	8b 00                	mov    (%eax),%eax
+ b8a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ b8d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b90:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b93:	73 d4                	jae    b69 <free+0x19>
+ b95:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b98:	8b 00                	mov    (%eax),%eax
+ b9a:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ b9d:	73 ca                	jae    b69 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ b9f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ba2:	8b 40 04             	mov    0x4(%eax),%eax
+ ba5:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ bac:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ baf:	01 c2                	add    %eax,%edx
+ bb1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bb4:	8b 00                	mov    (%eax),%eax
+ bb6:	39 c2                	cmp    %eax,%edx
+ bb8:	75 24                	jne    bde <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ bba:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bbd:	8b 50 04             	mov    0x4(%eax),%edx
+ bc0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bc3:	8b 00                	mov    (%eax),%eax
+ bc5:	8b 40 04             	mov    0x4(%eax),%eax
+ bc8:	01 c2                	add    %eax,%edx
+ bca:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bcd:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ bd0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bd3:	8b 00                	mov    (%eax),%eax
+ bd5:	8b 10                	mov    (%eax),%edx
+ bd7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bda:	89 10                	mov    %edx,(%eax)
+ bdc:	eb 0a                	jmp    be8 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ bde:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ be1:	8b 10                	mov    (%eax),%edx
+ be3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ be6:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ be8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ beb:	8b 40 04             	mov    0x4(%eax),%eax
+ bee:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ bf5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bf8:	01 d0                	add    %edx,%eax
+ bfa:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ bfd:	75 20                	jne    c1f <free+0xcf>
+    p->s.size += bp->s.size;
+ bff:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c02:	8b 50 04             	mov    0x4(%eax),%edx
+ c05:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c08:	8b 40 04             	mov    0x4(%eax),%eax
+ c0b:	01 c2                	add    %eax,%edx
+ c0d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c10:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ c13:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c16:	8b 10                	mov    (%eax),%edx
+ c18:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c1b:	89 10                	mov    %edx,(%eax)
+ c1d:	eb 08                	jmp    c27 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ c1f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c22:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ c25:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ c27:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c2a:	a3 28 16 00 00       	mov    %eax,0x1628
+}
+ c2f:	90                   	nop
+ c30:	c9                   	leave
+ c31:	c3                   	ret
+
+00000c32 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ c32:	55                   	push   %ebp
+ c33:	89 e5                	mov    %esp,%ebp
+ c35:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ c38:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ c3f:	77 07                	ja     c48 <morecore+0x16>
+    nu = 4096;
+ c41:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ c48:	8b 45 08             	mov    0x8(%ebp),%eax
+ c4b:	c1 e0 03             	shl    $0x3,%eax
+ c4e:	83 ec 0c             	sub    $0xc,%esp
+ c51:	50                   	push   %eax
+ c52:	e8 0f fc ff ff       	call   866 <sbrk>
+ c57:	83 c4 10             	add    $0x10,%esp
+ c5a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ c5d:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ c61:	75 07                	jne    c6a <morecore+0x38>
+    return 0;
+ c63:	b8 00 00 00 00       	mov    $0x0,%eax
+ c68:	eb 26                	jmp    c90 <morecore+0x5e>
+  hp = (Header*)p;
+ c6a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c6d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ c70:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c73:	8b 55 08             	mov    0x8(%ebp),%edx
+ c76:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ c79:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c7c:	83 c0 08             	add    $0x8,%eax
+ c7f:	83 ec 0c             	sub    $0xc,%esp
+ c82:	50                   	push   %eax
+ c83:	e8 c8 fe ff ff       	call   b50 <free>
+ c88:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ c8b:	a1 28 16 00 00       	mov    0x1628,%eax
+}
+ c90:	c9                   	leave
+ c91:	c3                   	ret
+
+00000c92 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ c92:	55                   	push   %ebp
+ c93:	89 e5                	mov    %esp,%ebp
+ c95:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c98:	8b 45 08             	mov    0x8(%ebp),%eax
+ c9b:	83 c0 07             	add    $0x7,%eax
+ c9e:	c1 e8 03             	shr    $0x3,%eax
+ ca1:	83 c0 01             	add    $0x1,%eax
+ ca4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ ca7:	a1 28 16 00 00       	mov    0x1628,%eax
+ cac:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ caf:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ cb3:	75 23                	jne    cd8 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ cb5:	c7 45 f0 20 16 00 00 	movl   $0x1620,-0x10(%ebp)
+ cbc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cbf:	a3 28 16 00 00       	mov    %eax,0x1628
+ cc4:	a1 28 16 00 00       	mov    0x1628,%eax
+ cc9:	a3 20 16 00 00       	mov    %eax,0x1620
+    base.s.size = 0;
+ cce:	c7 05 24 16 00 00 00 	movl   $0x0,0x1624
+ cd5:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cd8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cdb:	8b 00                	mov    (%eax),%eax
+ cdd:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ ce0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ce3:	8b 40 04             	mov    0x4(%eax),%eax
+ ce6:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ ce9:	72 4d                	jb     d38 <malloc+0xa6>
+      if(p->s.size == nunits)
+ ceb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cee:	8b 40 04             	mov    0x4(%eax),%eax
+ cf1:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ cf4:	75 0c                	jne    d02 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ cf6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cf9:	8b 10                	mov    (%eax),%edx
+ cfb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cfe:	89 10                	mov    %edx,(%eax)
+ d00:	eb 26                	jmp    d28 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ d02:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d05:	8b 40 04             	mov    0x4(%eax),%eax
+ d08:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ d0b:	89 c2                	mov    %eax,%edx
+ d0d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d10:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ d13:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d16:	8b 40 04             	mov    0x4(%eax),%eax
+ d19:	c1 e0 03             	shl    $0x3,%eax
+ d1c:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ d1f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d22:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ d25:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ d28:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d2b:	a3 28 16 00 00       	mov    %eax,0x1628
+      return (void*)(p + 1);
+ d30:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d33:	83 c0 08             	add    $0x8,%eax
+ d36:	eb 3b                	jmp    d73 <malloc+0xe1>
+    }
+    if(p == freep)
+ d38:	a1 28 16 00 00       	mov    0x1628,%eax
+ d3d:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ d40:	75 1e                	jne    d60 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ d42:	83 ec 0c             	sub    $0xc,%esp
+ d45:	ff 75 ec             	push   -0x14(%ebp)
+ d48:	e8 e5 fe ff ff       	call   c32 <morecore>
+ d4d:	83 c4 10             	add    $0x10,%esp
+ d50:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d53:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d57:	75 07                	jne    d60 <malloc+0xce>
+        return 0;
+ d59:	b8 00 00 00 00       	mov    $0x0,%eax
+ d5e:	eb 13                	jmp    d73 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d60:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d63:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ d66:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d69:	8b 00                	mov    (%eax),%eax
+ d6b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ d6e:	e9 6d ff ff ff       	jmp    ce0 <malloc+0x4e>
+  }
+}
+ d73:	c9                   	leave
+ d74:	c3                   	ret
@@ -0,0 +1,85 @@
+// brctl: configure the layer 2 bridge.
+//
+//   brctl addif ifindex    make an interface a bridge port
+//   brctl delif ifindex    take it out again
+//   brctl ageing seconds   how long learned addresses are kept
+//   brctl show             ports and forwarding counters
+//   brctl showmacs         learned addresses
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "bridge.h"
+
+struct brfdb fdb[BR_NFDB];
+
+static void
+usage(void)
+{
+  printf(2, "usage: brctl addif|delif ifindex\n"
+            "       brctl ageing seconds\n"
+            "       brctl show|showmacs\n");
+  exit();
+}
+
+static void
+show(void)
+{
+  struct brstat st;
+  int i;
+
+  if(brctl(BR_STAT, 0, &st) < 0){
+    printf(2, "brctl: no bridge\n");
+    return;
+  }
+  printf(1, "ports:");
+  for(i = 0; i < 32; i++)
+    if(st.ports & (1 << i))
+      printf(1, " eth%d", i);
+  printf(1, "\nageing %d s, %d addresses learned\n", st.ageing, st.entries);
+  printf(1, "forwarded %d flooded %d filtered %d local %d\n",
+         st.forwarded, st.flooded, st.filtered, st.local);
+}
+
+static void
+showmacs(void)
+{
+  int i, j, n;
+
+  if((n = brctl(BR_FDB, BR_NFDB, fdb)) < 0){
+    printf(2, "brctl: no bridge\n");
+    return;
+  }
+  printf(1, "port mac address       age\n");
+  for(i = 0; i < n; i++){
+    printf(1, "eth%d ", fdb[i].ifindex);
+    for(j = 0; j < 6; j++)
+      printf(1, j ? ":%x" : "%x", fdb[i].mac[j]);
+    printf(1, " %d\n", fdb[i].age);
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  int cmd;
+
+  if(argc == 2 && strcmp(argv[1], "show") == 0)
+    show();
+  else if(argc == 2 && strcmp(argv[1], "showmacs") == 0)
+    showmacs();
+  else if(argc == 3){
+    if(strcmp(argv[1], "addif") == 0)
+      cmd = BR_ADDIF;
+    else if(strcmp(argv[1], "delif") == 0)
+      cmd = BR_DELIF;
+    else if(strcmp(argv[1], "ageing") == 0)
+      cmd = BR_AGEING;
+    else
+      usage();
+    if(brctl(cmd, atoi(argv[2]), 0) < 0)
+      printf(2, "brctl: %s %s failed\n", argv[1], argv[2]);
+  } else
+    usage();
+  exit();
+}
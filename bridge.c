@@ -0,0 +1,233 @@
+// Layer 2 bridge.
+//
+// Interfaces added to the bridge become its ports. A frame received
+// on a port teaches the bridge which port its source address lives
+// behind, and is then sent straight out of the port its destination
+// was learned on, or out of every other port if the destination is
+// unknown or a group address. Forwarding hands the receive buffer to
+// the other driver's send_packet from the interrupt handler, so a
+// bridged frame is never copied up into the protocol layers.
+//
+// The forwarding database is a hash table of NFDBSET sets of NFDBWAY
+// entries. A new address takes a free way of its set or, if there is
+// none, the one that was seen least recently. Addresses that have
+// not been seen for `ageing` ticks count as free.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "spinlock.h"
+#include "nic.h"
+#include "bridge.h"
+
+#define NFDBWAY  4
+#define NFDBSET  (BR_NFDB / NFDBWAY)
+
+struct fdbent {
+  uchar mac[6];
+  uchar port;
+  uchar valid;
+  uint seen;      // ticks when the address was last a source
+};
+
+struct {
+  struct spinlock lock;
+  uint ports;     // bit i set: nic_devices[i] is a port
+  uint ageing;    // ticks
+  uint forwarded;
+  uint flooded;
+  uint filtered;
+  uint local;
+  struct fdbent fdb[NFDBSET][NFDBWAY];
+} bridge;
+
+void
+bridgeinit(void)
+{
+  initlock(&bridge.lock, "bridge");
+  bridge.ageing = 300 * HZ;
+}
+
+static uint
+hash(uchar *mac)
+{
+  uint h = 2166136261;
+
+  for(int i = 0; i < 6; i++)
+    h = (h ^ mac[i]) * 16777619;
+  return h % NFDBSET;
+}
+
+static int
+live(struct fdbent *e, uint now)
+{
+  return e->valid && now - e->seen < bridge.ageing;
+}
+
+// Look mac up in the forwarding database. Caller holds bridge.lock.
+static struct fdbent*
+lookup(uchar *mac, uint now)
+{
+  struct fdbent *e, *set = bridge.fdb[hash(mac)];
+
+  for(e = set; e < set + NFDBWAY; e++)
+    if(live(e, now) && memcmp(e->mac, mac, 6) == 0)
+      return e;
+  return 0;
+}
+
+// Record that mac was seen on port. Caller holds bridge.lock.
+static void
+learn(uchar *mac, int port, uint now)
+{
+  struct fdbent *e, *victim, *set = bridge.fdb[hash(mac)];
+
+  victim = 0;
+  for(e = set; e < set + NFDBWAY; e++){
+    if(e->valid && memcmp(e->mac, mac, 6) == 0){
+      e->port = port;
+      e->seen = now;
+      return;
+    }
+    if(victim == 0 || (live(victim, now) &&
+       (!live(e, now) || now - e->seen > now - victim->seen)))
+      victim = e;
+  }
+  memmove(victim->mac, mac, 6);
+  victim->port = port;
+  victim->valid = 1;
+  victim->seen = now;
+}
+
+static void
+send(int port, uchar *pkt, uint len)
+{
+  struct nic_device *nd = &nic_devices[port];
+
+  nd->send_packet(nd->driver, pkt, len);
+}
+
+/**
+ * Called from nic_rx for every frame an interface receives. Returns 1
+ * if the bridge consumed the frame, 0 if it should also be delivered
+ * locally: because the interface is not a port, because the frame is
+ * addressed to one of the ports, or because it went to a group.
+ */
+int
+bridge_input(struct nic_device *nd, uchar *pkt, uint len)
+{
+  struct fdbent *e;
+  uint ports, now;
+  int in, out, i;
+
+  in = nd - nic_devices;
+  if((bridge.ports & (1 << in)) == 0 || len < 14)
+    return 0;
+  now = ticks;
+
+  acquire(&bridge.lock);
+  if((pkt[6] & 1) == 0)
+    learn(pkt + 6, in, now);
+  ports = bridge.ports;
+
+  for(i = 0; i < nnic; i++){
+    if((ports & (1 << i)) && memcmp(pkt, nic_devices[i].mac_addr, 6) == 0){
+      bridge.local++;
+      release(&bridge.lock);
+      return 0;
+    }
+  }
+
+  out = -1;
+  if((pkt[0] & 1) == 0 && (e = lookup(pkt, now)) != 0)
+    out = e->port;
+  if(out == in){
+    bridge.filtered++;
+    release(&bridge.lock);
+    return 1;
+  }
+  if(out >= 0)
+    bridge.forwarded++;
+  else
+    bridge.flooded++;
+  release(&bridge.lock);
+
+  if(out >= 0){
+    send(out, pkt, len);
+    return 1;
+  }
+  for(i = 0; i < nnic; i++)
+    if(i != in && (ports & (1 << i)))
+      send(i, pkt, len);
+  return pkt[0] & 1 ? 0 : 1;
+}
+
+/**
+ * Implements the brctl system call, see bridge.h. buf has room for
+ * what cmd returns. Returns -1 on a bad argument.
+ */
+int
+bridgectl(int cmd, int arg, char *buf)
+{
+  struct brstat *st;
+  struct brfdb *out;
+  struct fdbent *e;
+  uint now;
+  int n;
+
+  acquire(&bridge.lock);
+  now = ticks;
+  n = 0;
+  switch(cmd){
+  case BR_ADDIF:
+  case BR_DELIF:
+    if(arg < 0 || arg >= nnic){
+      n = -1;
+      break;
+    }
+    if(cmd == BR_ADDIF){
+      bridge.ports |= 1 << arg;
+      break;
+    }
+    bridge.ports &= ~(1 << arg);
+    for(e = &bridge.fdb[0][0]; e < &bridge.fdb[NFDBSET][0]; e++)
+      if(e->port == arg)
+        e->valid = 0;
+    break;
+  case BR_AGEING:
+    if(arg <= 0)
+      n = -1;
+    else
+      bridge.ageing = arg * HZ;
+    break;
+  case BR_STAT:
+    st = (struct brstat*)buf;
+    st->ports = bridge.ports;
+    st->ageing = bridge.ageing / HZ;
+    st->entries = 0;
+    for(e = &bridge.fdb[0][0]; e < &bridge.fdb[NFDBSET][0]; e++)
+      if(live(e, now))
+        st->entries++;
+    st->forwarded = bridge.forwarded;
+    st->flooded = bridge.flooded;
+    st->filtered = bridge.filtered;
+    st->local = bridge.local;
+    break;
+  case BR_FDB:
+    out = (struct brfdb*)buf;
+    for(e = &bridge.fdb[0][0]; e < &bridge.fdb[NFDBSET][0] && n < arg; e++){
+      if(!live(e, now))
+        continue;
+      memmove(out[n].mac, e->mac, 6);
+      out[n].ifindex = e->port;
+      out[n].pad = 0;
+      out[n].age = (now - e->seen) / HZ;
+      n++;
+    }
+    break;
+  default:
+    n = -1;
+  }
+  release(&bridge.lock);
+  return n;
+}
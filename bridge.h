@@ -0,0 +1,33 @@
+#ifndef __XV6_NETSTACK_BRIDGE_H__
+#define __XV6_NETSTACK_BRIDGE_H__
+// Layer 2 bridge between the loaded NICs.
+// Both the kernel and user programs use this header file.
+
+// brctl commands
+#define BR_ADDIF   1  // arg: interface index to add to the bridge
+#define BR_DELIF   2  // arg: interface index to take out of the bridge
+#define BR_AGEING  3  // arg: seconds a learned address is kept
+#define BR_STAT    4  // fill in a struct brstat
+#define BR_FDB     5  // copy up to arg struct brfdb entries out
+
+#define BR_NFDB    1024  // learned addresses the bridge can hold
+
+struct brstat {
+  uint ports;      // bit i set: interface i is a port
+  uint ageing;     // seconds
+  uint entries;    // addresses currently learned
+  uint forwarded;  // frames sent out of the one port their address was learned on
+  uint flooded;    // frames sent out of every other port
+  uint filtered;   // frames dropped because they came from their own port
+  uint local;      // frames addressed to the receiving interface itself
+};
+
+// A learned address as returned by BR_FDB.
+struct brfdb {
+  uchar mac[6];
+  uchar ifindex;   // port the address was last seen on
+  uchar pad;
+  uint age;        // seconds since it was last seen
+};
+
+#endif
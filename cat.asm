@@ -0,0 +1,1488 @@
+
+_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <cat>:
+
+char buf[512];
+
+void
+cat(int fd)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 18             	sub    $0x18,%esp
+  int n;
+
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+   6:	eb 31                	jmp    39 <cat+0x39>
+    if (write(1, buf, n) != n) {
+   8:	83 ec 04             	sub    $0x4,%esp
+   b:	ff 75 f4             	push   -0xc(%ebp)
+   e:	68 e0 12 00 00       	push   $0x12e0
+  13:	6a 01                	push   $0x1
+  15:	e8 df 05 00 00       	call   5f9 <write>
+  1a:	83 c4 10             	add    $0x10,%esp
+  1d:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+  20:	74 17                	je     39 <cat+0x39>
+      printf(1, "cat: write error\n");
+  22:	83 ec 08             	sub    $0x8,%esp
+  25:	68 70 0b 00 00       	push   $0xb70
+  2a:	6a 01                	push   $0x1
+  2c:	e8 64 07 00 00       	call   795 <printf>
+  31:	83 c4 10             	add    $0x10,%esp
+      exit();
+  34:	e8 a0 05 00 00       	call   5d9 <exit>
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+  39:	83 ec 04             	sub    $0x4,%esp
+  3c:	68 00 02 00 00       	push   $0x200
+  41:	68 e0 12 00 00       	push   $0x12e0
+  46:	ff 75 08             	push   0x8(%ebp)
+  49:	e8 a3 05 00 00       	call   5f1 <read>
+  4e:	83 c4 10             	add    $0x10,%esp
+  51:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  54:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  58:	7f ae                	jg     8 <cat+0x8>
+    }
+  }
+  if(n < 0){
+  5a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  5e:	79 17                	jns    77 <cat+0x77>
+    printf(1, "cat: read error\n");
+  60:	83 ec 08             	sub    $0x8,%esp
+  63:	68 82 0b 00 00       	push   $0xb82
+  68:	6a 01                	push   $0x1
+  6a:	e8 26 07 00 00       	call   795 <printf>
+  6f:	83 c4 10             	add    $0x10,%esp
+    exit();
+  72:	e8 62 05 00 00       	call   5d9 <exit>
+  }
+}
+  77:	90                   	nop
+  78:	c9                   	leave
+  79:	c3                   	ret
+
+0000007a <main>:
+
+int
+main(int argc, char *argv[])
+{
+  7a:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  7e:	83 e4 f0             	and    $0xfffffff0,%esp
+  81:	ff 71 fc             	push   -0x4(%ecx)
+  84:	55                   	push   %ebp
+  85:	89 e5                	mov    %esp,%ebp
+  87:	53                   	push   %ebx
+  88:	51                   	push   %ecx
+  89:	83 ec 10             	sub    $0x10,%esp
+  8c:	89 cb                	mov    %ecx,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+  8e:	83 3b 01             	cmpl   $0x1,(%ebx)
+  91:	7f 12                	jg     a5 <main+0x2b>
+    cat(0);
+  93:	83 ec 0c             	sub    $0xc,%esp
+  96:	6a 00                	push   $0x0
+  98:	e8 63 ff ff ff       	call   0 <cat>
+  9d:	83 c4 10             	add    $0x10,%esp
+    exit();
+  a0:	e8 34 05 00 00       	call   5d9 <exit>
+  }
+
+  for(i = 1; i < argc; i++){
+  a5:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  ac:	eb 71                	jmp    11f <main+0xa5>
+    if((fd = open(argv[i], 0)) < 0){
+  ae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  b1:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  b8:	8b 43 04             	mov    0x4(%ebx),%eax
+  bb:	01 d0                	add    %edx,%eax
+  bd:	8b 00                	mov    (%eax),%eax
+  bf:	83 ec 08             	sub    $0x8,%esp
+  c2:	6a 00                	push   $0x0
+  c4:	50                   	push   %eax
+  c5:	e8 4f 05 00 00       	call   619 <open>
+  ca:	83 c4 10             	add    $0x10,%esp
+  cd:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  d0:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  d4:	79 29                	jns    ff <main+0x85>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+  d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  d9:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  e0:	8b 43 04             	mov    0x4(%ebx),%eax
+  e3:	01 d0                	add    %edx,%eax
+  e5:	8b 00                	mov    (%eax),%eax
+  e7:	83 ec 04             	sub    $0x4,%esp
+  ea:	50                   	push   %eax
+  eb:	68 93 0b 00 00       	push   $0xb93
+  f0:	6a 01                	push   $0x1
+  f2:	e8 9e 06 00 00       	call   795 <printf>
+  f7:	83 c4 10             	add    $0x10,%esp
+      exit();
+  fa:	e8 da 04 00 00       	call   5d9 <exit>
+    }
+    cat(fd);
+  ff:	83 ec 0c             	sub    $0xc,%esp
+ 102:	ff 75 f0             	push   -0x10(%ebp)
+ 105:	e8 f6 fe ff ff       	call   0 <cat>
+ 10a:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+ 10d:	83 ec 0c             	sub    $0xc,%esp
+ 110:	ff 75 f0             	push   -0x10(%ebp)
+ 113:	e8 e9 04 00 00       	call   601 <close>
+ 118:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < argc; i++){
+ 11b:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 11f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 122:	3b 03                	cmp    (%ebx),%eax
+ 124:	7c 88                	jl     ae <main+0x34>
+  }
+  exit();
+ 126:	e8 ae 04 00 00       	call   5d9 <exit>
+
+0000012b <stosb>:
+}
+
+int
+stat(char *n, struct stat *st)
+{
+  int fd;
+ 12b:	55                   	push   %ebp
+ 12c:	89 e5                	mov    %esp,%ebp
+ 12e:	57                   	push   %edi
+ 12f:	53                   	push   %ebx
+  int r;
+ 130:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 133:	8b 55 10             	mov    0x10(%ebp),%edx
+ 136:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 139:	89 cb                	mov    %ecx,%ebx
+ 13b:	89 df                	mov    %ebx,%edi
+ 13d:	89 d1                	mov    %edx,%ecx
+ 13f:	fc                   	cld
+ 140:	f3 aa                	rep stos %al,%es:(%edi)
+ 142:	89 ca                	mov    %ecx,%edx
+ 144:	89 fb                	mov    %edi,%ebx
+ 146:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 149:	89 55 10             	mov    %edx,0x10(%ebp)
+
+  fd = open(n, O_RDONLY);
+  if(fd < 0)
+    return -1;
+ 14c:	90                   	nop
+ 14d:	5b                   	pop    %ebx
+ 14e:	5f                   	pop    %edi
+ 14f:	5d                   	pop    %ebp
+ 150:	c3                   	ret
+
+00000151 <strcpy>:
+{
+ 151:	55                   	push   %ebp
+ 152:	89 e5                	mov    %esp,%ebp
+ 154:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 157:	8b 45 08             	mov    0x8(%ebp),%eax
+ 15a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 15d:	90                   	nop
+ 15e:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 161:	8d 42 01             	lea    0x1(%edx),%eax
+ 164:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 167:	8b 45 08             	mov    0x8(%ebp),%eax
+ 16a:	8d 48 01             	lea    0x1(%eax),%ecx
+ 16d:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 170:	0f b6 12             	movzbl (%edx),%edx
+ 173:	88 10                	mov    %dl,(%eax)
+ 175:	0f b6 00             	movzbl (%eax),%eax
+ 178:	84 c0                	test   %al,%al
+ 17a:	75 e2                	jne    15e <strcpy+0xd>
+  return os;
+ 17c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 17f:	c9                   	leave
+ 180:	c3                   	ret
+
+00000181 <strlen>:
+{
+ 181:	55                   	push   %ebp
+ 182:	89 e5                	mov    %esp,%ebp
+ 184:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 187:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 18e:	eb 04                	jmp    194 <strlen+0x13>
+ 190:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 194:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 197:	8b 45 08             	mov    0x8(%ebp),%eax
+ 19a:	01 d0                	add    %edx,%eax
+ 19c:	0f b6 00             	movzbl (%eax),%eax
+ 19f:	84 c0                	test   %al,%al
+ 1a1:	75 ed                	jne    190 <strlen+0xf>
+  return n;
+ 1a3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1a6:	c9                   	leave
+ 1a7:	c3                   	ret
+
+000001a8 <memset>:
+{
+ 1a8:	55                   	push   %ebp
+ 1a9:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 1ab:	8b 45 10             	mov    0x10(%ebp),%eax
+ 1ae:	50                   	push   %eax
+ 1af:	ff 75 0c             	push   0xc(%ebp)
+ 1b2:	ff 75 08             	push   0x8(%ebp)
+ 1b5:	e8 71 ff ff ff       	call   12b <stosb>
+ 1ba:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 1bd:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1c0:	c9                   	leave
+ 1c1:	c3                   	ret
+
+000001c2 <strchr>:
+{
+ 1c2:	55                   	push   %ebp
+ 1c3:	89 e5                	mov    %esp,%ebp
+ 1c5:	83 ec 04             	sub    $0x4,%esp
+ 1c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1cb:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 1ce:	eb 14                	jmp    1e4 <strchr+0x22>
+    if(*s == c)
+ 1d0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d3:	0f b6 00             	movzbl (%eax),%eax
+ 1d6:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 1d9:	75 05                	jne    1e0 <strchr+0x1e>
+      return (char*)s;
+ 1db:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1de:	eb 13                	jmp    1f3 <strchr+0x31>
+  for(; *s; s++)
+ 1e0:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1e4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e7:	0f b6 00             	movzbl (%eax),%eax
+ 1ea:	84 c0                	test   %al,%al
+ 1ec:	75 e2                	jne    1d0 <strchr+0xe>
+  return 0;
+ 1ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 1f3:	c9                   	leave
+ 1f4:	c3                   	ret
+
+000001f5 <gets>:
+{
+ 1f5:	55                   	push   %ebp
+ 1f6:	89 e5                	mov    %esp,%ebp
+ 1f8:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 1fb:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 202:	eb 42                	jmp    246 <gets+0x51>
+    cc = read(0, &c, 1);
+ 204:	83 ec 04             	sub    $0x4,%esp
+ 207:	6a 01                	push   $0x1
+ 209:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 20c:	50                   	push   %eax
+ 20d:	6a 00                	push   $0x0
+ 20f:	e8 dd 03 00 00       	call   5f1 <read>
+ 214:	83 c4 10             	add    $0x10,%esp
+ 217:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 21a:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 21e:	7e 33                	jle    253 <gets+0x5e>
+    buf[i++] = c;
+ 220:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 223:	8d 50 01             	lea    0x1(%eax),%edx
+ 226:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 229:	89 c2                	mov    %eax,%edx
+ 22b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 22e:	01 c2                	add    %eax,%edx
+ 230:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 234:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 236:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 23a:	3c 0a                	cmp    $0xa,%al
+ 23c:	74 16                	je     254 <gets+0x5f>
+ 23e:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 242:	3c 0d                	cmp    $0xd,%al
+ 244:	74 0e                	je     254 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 246:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 249:	83 c0 01             	add    $0x1,%eax
+ 24c:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 24f:	7f b3                	jg     204 <gets+0xf>
+ 251:	eb 01                	jmp    254 <gets+0x5f>
+      break;
+ 253:	90                   	nop
+  buf[i] = '\0';
+ 254:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 257:	8b 45 08             	mov    0x8(%ebp),%eax
+ 25a:	01 d0                	add    %edx,%eax
+ 25c:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 25f:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 262:	c9                   	leave
+ 263:	c3                   	ret
+
+00000264 <stat>:
+{
+ 264:	55                   	push   %ebp
+ 265:	89 e5                	mov    %esp,%ebp
+ 267:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+ 26a:	83 ec 08             	sub    $0x8,%esp
+ 26d:	6a 00                	push   $0x0
+ 26f:	ff 75 08             	push   0x8(%ebp)
+ 272:	e8 a2 03 00 00       	call   619 <open>
+ 277:	83 c4 10             	add    $0x10,%esp
+ 27a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 27d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 281:	79 07                	jns    28a <stat+0x26>
+    return -1;
+ 283:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 288:	eb 25                	jmp    2af <stat+0x4b>
+  r = fstat(fd, st);
+ 28a:	83 ec 08             	sub    $0x8,%esp
+ 28d:	ff 75 0c             	push   0xc(%ebp)
+ 290:	ff 75 f4             	push   -0xc(%ebp)
+ 293:	e8 99 03 00 00       	call   631 <fstat>
+ 298:	83 c4 10             	add    $0x10,%esp
+ 29b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 29e:	83 ec 0c             	sub    $0xc,%esp
+ 2a1:	ff 75 f4             	push   -0xc(%ebp)
+ 2a4:	e8 58 03 00 00       	call   601 <close>
+ 2a9:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 2ac:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 2af:	c9                   	leave
+ 2b0:	c3                   	ret
+
+000002b1 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 2b1:	55                   	push   %ebp
+ 2b2:	89 e5                	mov    %esp,%ebp
+ 2b4:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+
+  dst = vdst;
+ 2b7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ba:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 2bd:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2c0:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 2c3:	eb 17                	jmp    2dc <memmove+0x2b>
+    *dst++ = *src++;
+ 2c5:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 2c8:	8d 42 01             	lea    0x1(%edx),%eax
+ 2cb:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 2ce:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2d1:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2d4:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 2d7:	0f b6 12             	movzbl (%edx),%edx
+ 2da:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 2dc:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2df:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 2e2:	89 55 10             	mov    %edx,0x10(%ebp)
+ 2e5:	85 c0                	test   %eax,%eax
+ 2e7:	7f dc                	jg     2c5 <memmove+0x14>
+  return vdst;
+ 2e9:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2ec:	c9                   	leave
+ 2ed:	c3                   	ret
+
+000002ee <cpuinfo>:
+ 2ee:	55                   	push   %ebp
+ 2ef:	89 e5                	mov    %esp,%ebp
+ 2f1:	56                   	push   %esi
+ 2f2:	53                   	push   %ebx
+ 2f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2f6:	ba 00 00 00 00       	mov    $0x0,%edx
+ 2fb:	89 d1                	mov    %edx,%ecx
+ 2fd:	0f a2                	cpuid
+ 2ff:	89 c6                	mov    %eax,%esi
+ 301:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 304:	89 30                	mov    %esi,(%eax)
+ 306:	8b 45 10             	mov    0x10(%ebp),%eax
+ 309:	89 18                	mov    %ebx,(%eax)
+ 30b:	8b 45 14             	mov    0x14(%ebp),%eax
+ 30e:	89 08                	mov    %ecx,(%eax)
+ 310:	8b 45 18             	mov    0x18(%ebp),%eax
+ 313:	89 10                	mov    %edx,(%eax)
+ 315:	90                   	nop
+ 316:	5b                   	pop    %ebx
+ 317:	5e                   	pop    %esi
+ 318:	5d                   	pop    %ebp
+ 319:	c3                   	ret
+
+0000031a <atoi>:
+{
+ 31a:	55                   	push   %ebp
+ 31b:	89 e5                	mov    %esp,%ebp
+ 31d:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+ 320:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 327:	eb 25                	jmp    34e <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 329:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 32c:	89 d0                	mov    %edx,%eax
+ 32e:	c1 e0 02             	shl    $0x2,%eax
+ 331:	01 d0                	add    %edx,%eax
+ 333:	01 c0                	add    %eax,%eax
+ 335:	89 c1                	mov    %eax,%ecx
+ 337:	8b 45 08             	mov    0x8(%ebp),%eax
+ 33a:	8d 50 01             	lea    0x1(%eax),%edx
+ 33d:	89 55 08             	mov    %edx,0x8(%ebp)
+ 340:	0f b6 00             	movzbl (%eax),%eax
+ 343:	0f be c0             	movsbl %al,%eax
+ 346:	01 c8                	add    %ecx,%eax
+ 348:	83 e8 30             	sub    $0x30,%eax
+ 34b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 34e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 351:	0f b6 00             	movzbl (%eax),%eax
+ 354:	3c 2f                	cmp    $0x2f,%al
+ 356:	7e 0a                	jle    362 <atoi+0x48>
+ 358:	8b 45 08             	mov    0x8(%ebp),%eax
+ 35b:	0f b6 00             	movzbl (%eax),%eax
+ 35e:	3c 39                	cmp    $0x39,%al
+ 360:	7e c7                	jle    329 <atoi+0xf>
+  return n;
+ 362:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 365:	c9                   	leave
+ 366:	c3                   	ret
+
+00000367 <strcmp>:
+{
+ 367:	55                   	push   %ebp
+ 368:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 36a:	eb 08                	jmp    374 <strcmp+0xd>
+    p++, q++;
+ 36c:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 370:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 374:	8b 45 08             	mov    0x8(%ebp),%eax
+ 377:	0f b6 00             	movzbl (%eax),%eax
+ 37a:	84 c0                	test   %al,%al
+ 37c:	74 10                	je     38e <strcmp+0x27>
+ 37e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 381:	0f b6 10             	movzbl (%eax),%edx
+ 384:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 387:	0f b6 00             	movzbl (%eax),%eax
+ 38a:	38 c2                	cmp    %al,%dl
+ 38c:	74 de                	je     36c <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 38e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 391:	0f b6 00             	movzbl (%eax),%eax
+ 394:	0f b6 d0             	movzbl %al,%edx
+ 397:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 39a:	0f b6 00             	movzbl (%eax),%eax
+ 39d:	0f b6 c0             	movzbl %al,%eax
+ 3a0:	29 c2                	sub    %eax,%edx
+ 3a2:	89 d0                	mov    %edx,%eax
+}
+ 3a4:	5d                   	pop    %ebp
+ 3a5:	c3                   	ret
+
+000003a6 <udiv64>:
+{
+ 3a6:	55                   	push   %ebp
+ 3a7:	89 e5                	mov    %esp,%ebp
+ 3a9:	57                   	push   %edi
+ 3aa:	56                   	push   %esi
+ 3ab:	83 ec 38             	sub    $0x38,%esp
+ 3ae:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 3b4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3b7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 3ba:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3bd:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 3c0:	8b 45 14             	mov    0x14(%ebp),%eax
+ 3c3:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  q = r = 0;
+ 3c6:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 3cd:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 3d4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 3d7:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 3da:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 3dd:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 3e0:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 3e7:	e9 85 00 00 00       	jmp    471 <udiv64+0xcb>
+    r = (r << 1) | ((n >> i) & 1);
+ 3ec:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 3ef:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 3f2:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 3f6:	01 c0                	add    %eax,%eax
+ 3f8:	89 c6                	mov    %eax,%esi
+ 3fa:	89 d7                	mov    %edx,%edi
+ 3fc:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 3ff:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 402:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 405:	0f ad d0             	shrd   %cl,%edx,%eax
+ 408:	d3 ea                	shr    %cl,%edx
+ 40a:	f6 c1 20             	test   $0x20,%cl
+ 40d:	74 04                	je     413 <udiv64+0x6d>
+ 40f:	89 d0                	mov    %edx,%eax
+ 411:	31 d2                	xor    %edx,%edx
+ 413:	83 e0 01             	and    $0x1,%eax
+ 416:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 419:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+ 420:	89 f0                	mov    %esi,%eax
+ 422:	89 fa                	mov    %edi,%edx
+ 424:	0b 45 c0             	or     -0x40(%ebp),%eax
+ 427:	0b 55 c4             	or     -0x3c(%ebp),%edx
+ 42a:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 42d:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 430:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 433:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 436:	3b 45 c8             	cmp    -0x38(%ebp),%eax
+ 439:	89 d0                	mov    %edx,%eax
+ 43b:	1b 45 cc             	sbb    -0x34(%ebp),%eax
+ 43e:	72 2d                	jb     46d <udiv64+0xc7>
+      r -= d;
+ 440:	8b 45 c8             	mov    -0x38(%ebp),%eax
+ 443:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 446:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 449:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64_t)1 << i;
+ 44c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 44f:	b8 01 00 00 00       	mov    $0x1,%eax
+ 454:	ba 00 00 00 00       	mov    $0x0,%edx
+ 459:	0f a5 c2             	shld   %cl,%eax,%edx
+ 45c:	d3 e0                	shl    %cl,%eax
+ 45e:	f6 c1 20             	test   $0x20,%cl
+ 461:	74 04                	je     467 <udiv64+0xc1>
+ 463:	89 c2                	mov    %eax,%edx
+ 465:	31 c0                	xor    %eax,%eax
+ 467:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 46a:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 46d:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 471:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 475:	0f 89 71 ff ff ff    	jns    3ec <udiv64+0x46>
+  if(rem)
+ 47b:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+ 47f:	74 0e                	je     48f <udiv64+0xe9>
+    *rem = r;
+ 481:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 484:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 487:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 48a:	89 01                	mov    %eax,(%ecx)
+ 48c:	89 51 04             	mov    %edx,0x4(%ecx)
+  return q;
+ 48f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 492:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 495:	83 c4 38             	add    $0x38,%esp
+ 498:	5e                   	pop    %esi
+ 499:	5f                   	pop    %edi
+ 49a:	5d                   	pop    %ebp
+ 49b:	c3                   	ret
+
+0000049c <crc32cinit>:
+{
+ 49c:	55                   	push   %ebp
+ 49d:	89 e5                	mov    %esp,%ebp
+ 49f:	83 ec 20             	sub    $0x20,%esp
+  for(i = 0; i < 256; i++){
+ 4a2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 4a9:	eb 4c                	jmp    4f7 <crc32cinit+0x5b>
+    r = i;
+ 4ab:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 4ae:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+ 4b1:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+ 4b8:	eb 26                	jmp    4e0 <crc32cinit+0x44>
+      r = (r >> 1) ^ ((r & 1) ? CRC32C_POLY : 0);
+ 4ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4bd:	d1 e8                	shr    %eax
+ 4bf:	89 c2                	mov    %eax,%edx
+ 4c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4c4:	83 e0 01             	and    $0x1,%eax
+ 4c7:	85 c0                	test   %eax,%eax
+ 4c9:	74 07                	je     4d2 <crc32cinit+0x36>
+ 4cb:	b8 78 3b f6 82       	mov    $0x82f63b78,%eax
+ 4d0:	eb 05                	jmp    4d7 <crc32cinit+0x3b>
+ 4d2:	b8 00 00 00 00       	mov    $0x0,%eax
+ 4d7:	31 d0                	xor    %edx,%eax
+ 4d9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+ 4dc:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+ 4e0:	83 7d f8 07          	cmpl   $0x7,-0x8(%ebp)
+ 4e4:	76 d4                	jbe    4ba <crc32cinit+0x1e>
+    crc32ctab[i] = r;
+ 4e6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 4e9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 4ec:	89 14 85 c0 0e 00 00 	mov    %edx,0xec0(,%eax,4)
+  for(i = 0; i < 256; i++){
+ 4f3:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 4f7:	81 7d fc ff 00 00 00 	cmpl   $0xff,-0x4(%ebp)
+ 4fe:	76 ab                	jbe    4ab <crc32cinit+0xf>
+  cpuinfo(1, &a, &b, &c, &d);
+ 500:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 503:	50                   	push   %eax
+ 504:	8d 45 e8             	lea    -0x18(%ebp),%eax
+ 507:	50                   	push   %eax
+ 508:	8d 45 ec             	lea    -0x14(%ebp),%eax
+ 50b:	50                   	push   %eax
+ 50c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 50f:	50                   	push   %eax
+ 510:	6a 01                	push   $0x1
+ 512:	e8 d7 fd ff ff       	call   2ee <cpuinfo>
+ 517:	83 c4 14             	add    $0x14,%esp
+  crc32chw = (c & CPUID_SSE42) != 0;
+ 51a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 51d:	25 00 00 10 00       	and    $0x100000,%eax
+ 522:	85 c0                	test   %eax,%eax
+ 524:	0f 95 c0             	setne  %al
+ 527:	0f b6 c0             	movzbl %al,%eax
+ 52a:	a3 a8 0e 00 00       	mov    %eax,0xea8
+}
+ 52f:	90                   	nop
+ 530:	c9                   	leave
+ 531:	c3                   	ret
+
+00000532 <crc32c>:
+{
+ 532:	55                   	push   %ebp
+ 533:	89 e5                	mov    %esp,%ebp
+ 535:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s = p;
+ 538:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 53b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(crc32chw < 0)
+ 53e:	a1 a8 0e 00 00       	mov    0xea8,%eax
+ 543:	85 c0                	test   %eax,%eax
+ 545:	79 05                	jns    54c <crc32c+0x1a>
+    crc32cinit();
+ 547:	e8 50 ff ff ff       	call   49c <crc32cinit>
+  crc = ~crc;
+ 54c:	f7 55 08             	notl   0x8(%ebp)
+  if(crc32chw){
+ 54f:	a1 a8 0e 00 00       	mov    0xea8,%eax
+ 554:	85 c0                	test   %eax,%eax
+ 556:	74 6c                	je     5c4 <crc32c+0x92>
+    for(; n >= 4; n -= 4, s += 4)
+ 558:	eb 18                	jmp    572 <crc32c+0x40>
+      asm("crc32l %1, %0" : "+r" (crc) : "rm" (*(const uint*)s));
+ 55a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 55d:	8b 10                	mov    (%eax),%edx
+ 55f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 562:	f2 0f 38 f1 c2       	crc32  %edx,%eax
+ 567:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n >= 4; n -= 4, s += 4)
+ 56a:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+ 56e:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+ 572:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+ 576:	77 e2                	ja     55a <crc32c+0x28>
+    for(; n > 0; n--, s++)
+ 578:	eb 19                	jmp    593 <crc32c+0x61>
+      asm("crc32b %1, %0" : "+r" (crc) : "qm" (*s));
+ 57a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 57d:	0f b6 10             	movzbl (%eax),%edx
+ 580:	8b 45 08             	mov    0x8(%ebp),%eax
+ 583:	f2 0f 38 f0 c2       	crc32  %dl,%eax
+ 588:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+ 58b:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+ 58f:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 593:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 597:	75 e1                	jne    57a <crc32c+0x48>
+ 599:	eb 2f                	jmp    5ca <crc32c+0x98>
+      crc = crc32ctab[(crc ^ *s) & 0xff] ^ (crc >> 8);
+ 59b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 59e:	0f b6 00             	movzbl (%eax),%eax
+ 5a1:	0f b6 c0             	movzbl %al,%eax
+ 5a4:	33 45 08             	xor    0x8(%ebp),%eax
+ 5a7:	0f b6 c0             	movzbl %al,%eax
+ 5aa:	8b 04 85 c0 0e 00 00 	mov    0xec0(,%eax,4),%eax
+ 5b1:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5b4:	c1 ea 08             	shr    $0x8,%edx
+ 5b7:	31 d0                	xor    %edx,%eax
+ 5b9:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+ 5bc:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+ 5c0:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 5c4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 5c8:	75 d1                	jne    59b <crc32c+0x69>
+  return ~crc;
+ 5ca:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5cd:	f7 d0                	not    %eax
+}
+ 5cf:	c9                   	leave
+ 5d0:	c3                   	ret
+
+000005d1 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 5d1:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5d6:	cd 40                	int    $0x40
+ 5d8:	c3                   	ret
+
+000005d9 <exit>:
+SYSCALL(exit)
+ 5d9:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5de:	cd 40                	int    $0x40
+ 5e0:	c3                   	ret
+
+000005e1 <wait>:
+SYSCALL(wait)
+ 5e1:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5e6:	cd 40                	int    $0x40
+ 5e8:	c3                   	ret
+
+000005e9 <pipe>:
+SYSCALL(pipe)
+ 5e9:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5ee:	cd 40                	int    $0x40
+ 5f0:	c3                   	ret
+
+000005f1 <read>:
+SYSCALL(read)
+ 5f1:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5f6:	cd 40                	int    $0x40
+ 5f8:	c3                   	ret
+
+000005f9 <write>:
+SYSCALL(write)
+ 5f9:	b8 10 00 00 00       	mov    $0x10,%eax
+ 5fe:	cd 40                	int    $0x40
+ 600:	c3                   	ret
+
+00000601 <close>:
+SYSCALL(close)
+ 601:	b8 15 00 00 00       	mov    $0x15,%eax
+ 606:	cd 40                	int    $0x40
+ 608:	c3                   	ret
+
+00000609 <kill>:
+SYSCALL(kill)
+ 609:	b8 06 00 00 00       	mov    $0x6,%eax
+ 60e:	cd 40                	int    $0x40
+ 610:	c3                   	ret
+
+00000611 <exec>:
+SYSCALL(exec)
+ 611:	b8 07 00 00 00       	mov    $0x7,%eax
+ 616:	cd 40                	int    $0x40
+ 618:	c3                   	ret
+
+00000619 <open>:
+SYSCALL(open)
+ 619:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 61e:	cd 40                	int    $0x40
+ 620:	c3                   	ret
+
+00000621 <mknod>:
+SYSCALL(mknod)
+ 621:	b8 11 00 00 00       	mov    $0x11,%eax
+ 626:	cd 40                	int    $0x40
+ 628:	c3                   	ret
+
+00000629 <unlink>:
+SYSCALL(unlink)
+ 629:	b8 12 00 00 00       	mov    $0x12,%eax
+ 62e:	cd 40                	int    $0x40
+ 630:	c3                   	ret
+
+00000631 <fstat>:
+SYSCALL(fstat)
+ 631:	b8 08 00 00 00       	mov    $0x8,%eax
+ 636:	cd 40                	int    $0x40
+ 638:	c3                   	ret
+
+00000639 <link>:
+SYSCALL(link)
+ 639:	b8 13 00 00 00       	mov    $0x13,%eax
+ 63e:	cd 40                	int    $0x40
+ 640:	c3                   	ret
+
+00000641 <mkdir>:
+SYSCALL(mkdir)
+ 641:	b8 14 00 00 00       	mov    $0x14,%eax
+ 646:	cd 40                	int    $0x40
+ 648:	c3                   	ret
+
+00000649 <chdir>:
+SYSCALL(chdir)
+ 649:	b8 09 00 00 00       	mov    $0x9,%eax
+ 64e:	cd 40                	int    $0x40
+ 650:	c3                   	ret
+
+00000651 <dup>:
+SYSCALL(dup)
+ 651:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 656:	cd 40                	int    $0x40
+ 658:	c3                   	ret
+
+00000659 <getpid>:
+SYSCALL(getpid)
+ 659:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 65e:	cd 40                	int    $0x40
+ 660:	c3                   	ret
+
+00000661 <sbrk>:
+SYSCALL(sbrk)
+ 661:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 666:	cd 40                	int    $0x40
+ 668:	c3                   	ret
+
+00000669 <sleep>:
+SYSCALL(sleep)
+ 669:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 66e:	cd 40                	int    $0x40
+ 670:	c3                   	ret
+
+00000671 <uptime>:
+SYSCALL(uptime)
+ 671:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 676:	cd 40                	int    $0x40
+ 678:	c3                   	ret
+
+00000679 <arp>:
+SYSCALL(arp)
+ 679:	b8 16 00 00 00       	mov    $0x16,%eax
+ 67e:	cd 40                	int    $0x40
+ 680:	c3                   	ret
+
+00000681 <ifstat>:
+SYSCALL(ifstat)
+ 681:	b8 17 00 00 00       	mov    $0x17,%eax
+ 686:	cd 40                	int    $0x40
+ 688:	c3                   	ret
+
+00000689 <pcapctl>:
+SYSCALL(pcapctl)
+ 689:	b8 18 00 00 00       	mov    $0x18,%eax
+ 68e:	cd 40                	int    $0x40
+ 690:	c3                   	ret
+
+00000691 <pcapread>:
+SYSCALL(pcapread)
+ 691:	b8 19 00 00 00       	mov    $0x19,%eax
+ 696:	cd 40                	int    $0x40
+ 698:	c3                   	ret
+
+00000699 <bpfattach>:
+SYSCALL(bpfattach)
+ 699:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 69e:	cd 40                	int    $0x40
+ 6a0:	c3                   	ret
+
+000006a1 <pktgen>:
+SYSCALL(pktgen)
+ 6a1:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6a6:	cd 40                	int    $0x40
+ 6a8:	c3                   	ret
+
+000006a9 <reflect>:
+SYSCALL(reflect)
+ 6a9:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6ae:	cd 40                	int    $0x40
+ 6b0:	c3                   	ret
+
+000006b1 <brctl>:
+SYSCALL(brctl)
+ 6b1:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6b6:	cd 40                	int    $0x40
+ 6b8:	c3                   	ret
+
+000006b9 <hostopen>:
+SYSCALL(hostopen)
+ 6b9:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6be:	cd 40                	int    $0x40
+ 6c0:	c3                   	ret
+
+000006c1 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 6c1:	55                   	push   %ebp
+ 6c2:	89 e5                	mov    %esp,%ebp
+ 6c4:	83 ec 18             	sub    $0x18,%esp
+ 6c7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6ca:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 6cd:	83 ec 04             	sub    $0x4,%esp
+ 6d0:	6a 01                	push   $0x1
+ 6d2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 6d5:	50                   	push   %eax
+ 6d6:	ff 75 08             	push   0x8(%ebp)
+ 6d9:	e8 1b ff ff ff       	call   5f9 <write>
+ 6de:	83 c4 10             	add    $0x10,%esp
+}
+ 6e1:	90                   	nop
+ 6e2:	c9                   	leave
+ 6e3:	c3                   	ret
+
+000006e4 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6e4:	55                   	push   %ebp
+ 6e5:	89 e5                	mov    %esp,%ebp
+ 6e7:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 6ea:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 6f1:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 6f5:	74 17                	je     70e <printint+0x2a>
+ 6f7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 6fb:	79 11                	jns    70e <printint+0x2a>
+    neg = 1;
+ 6fd:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 704:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 707:	f7 d8                	neg    %eax
+ 709:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 70c:	eb 06                	jmp    714 <printint+0x30>
+  } else {
+    x = xx;
+ 70e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 711:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 714:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 71b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 71e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 721:	ba 00 00 00 00       	mov    $0x0,%edx
+ 726:	f7 f1                	div    %ecx
+ 728:	89 d1                	mov    %edx,%ecx
+ 72a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 72d:	8d 50 01             	lea    0x1(%eax),%edx
+ 730:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 733:	0f b6 91 ac 0e 00 00 	movzbl 0xeac(%ecx),%edx
+ 73a:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 73e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 741:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 744:	ba 00 00 00 00       	mov    $0x0,%edx
+ 749:	f7 f1                	div    %ecx
+ 74b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 74e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 752:	75 c7                	jne    71b <printint+0x37>
+  if(neg)
+ 754:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 758:	74 2d                	je     787 <printint+0xa3>
+    buf[i++] = '-';
+ 75a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 75d:	8d 50 01             	lea    0x1(%eax),%edx
+ 760:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 763:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 768:	eb 1d                	jmp    787 <printint+0xa3>
+    putc(fd, buf[i]);
+ 76a:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 76d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 770:	01 d0                	add    %edx,%eax
+ 772:	0f b6 00             	movzbl (%eax),%eax
+ 775:	0f be c0             	movsbl %al,%eax
+ 778:	83 ec 08             	sub    $0x8,%esp
+ 77b:	50                   	push   %eax
+ 77c:	ff 75 08             	push   0x8(%ebp)
+ 77f:	e8 3d ff ff ff       	call   6c1 <putc>
+ 784:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 787:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 78b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 78f:	79 d9                	jns    76a <printint+0x86>
+}
+ 791:	90                   	nop
+ 792:	90                   	nop
+ 793:	c9                   	leave
+ 794:	c3                   	ret
+
+00000795 <printf>:
+
+// Print to the given fd. Only understands %d, %u, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 795:	55                   	push   %ebp
+ 796:	89 e5                	mov    %esp,%ebp
+ 798:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 79b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 7a2:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 7a5:	83 c0 04             	add    $0x4,%eax
+ 7a8:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 7ab:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 7b2:	e9 7d 01 00 00       	jmp    934 <printf+0x19f>
+    c = fmt[i] & 0xff;
+ 7b7:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 7ba:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7bd:	01 d0                	add    %edx,%eax
+ 7bf:	0f b6 00             	movzbl (%eax),%eax
+ 7c2:	0f be c0             	movsbl %al,%eax
+ 7c5:	25 ff 00 00 00       	and    $0xff,%eax
+ 7ca:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 7cd:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 7d1:	75 2c                	jne    7ff <printf+0x6a>
+      if(c == '%'){
+ 7d3:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 7d7:	75 0c                	jne    7e5 <printf+0x50>
+        state = '%';
+ 7d9:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 7e0:	e9 4b 01 00 00       	jmp    930 <printf+0x19b>
+      } else {
+        putc(fd, c);
+ 7e5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7e8:	0f be c0             	movsbl %al,%eax
+ 7eb:	83 ec 08             	sub    $0x8,%esp
+ 7ee:	50                   	push   %eax
+ 7ef:	ff 75 08             	push   0x8(%ebp)
+ 7f2:	e8 ca fe ff ff       	call   6c1 <putc>
+ 7f7:	83 c4 10             	add    $0x10,%esp
+ 7fa:	e9 31 01 00 00       	jmp    930 <printf+0x19b>
+      }
+    } else if(state == '%'){
+ 7ff:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 803:	0f 85 27 01 00 00    	jne    930 <printf+0x19b>
+      if(c == 'd'){
+ 809:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 80d:	75 1e                	jne    82d <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 80f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 812:	8b 00                	mov    (%eax),%eax
+ 814:	6a 01                	push   $0x1
+ 816:	6a 0a                	push   $0xa
+ 818:	50                   	push   %eax
+ 819:	ff 75 08             	push   0x8(%ebp)
+ 81c:	e8 c3 fe ff ff       	call   6e4 <printint>
+ 821:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 824:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 828:	e9 fc 00 00 00       	jmp    929 <printf+0x194>
+      } else if(c == 'u'){
+ 82d:	83 7d e4 75          	cmpl   $0x75,-0x1c(%ebp)
+ 831:	75 1e                	jne    851 <printf+0xbc>
+        printint(fd, *ap, 10, 0);
+ 833:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 836:	8b 00                	mov    (%eax),%eax
+ 838:	6a 00                	push   $0x0
+ 83a:	6a 0a                	push   $0xa
+ 83c:	50                   	push   %eax
+ 83d:	ff 75 08             	push   0x8(%ebp)
+ 840:	e8 9f fe ff ff       	call   6e4 <printint>
+ 845:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 848:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 84c:	e9 d8 00 00 00       	jmp    929 <printf+0x194>
+      } else if(c == 'x' || c == 'p'){
+ 851:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 855:	74 06                	je     85d <printf+0xc8>
+ 857:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 85b:	75 1e                	jne    87b <printf+0xe6>
+        printint(fd, *ap, 16, 0);
+ 85d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 860:	8b 00                	mov    (%eax),%eax
+ 862:	6a 00                	push   $0x0
+ 864:	6a 10                	push   $0x10
+ 866:	50                   	push   %eax
+ 867:	ff 75 08             	push   0x8(%ebp)
+ 86a:	e8 75 fe ff ff       	call   6e4 <printint>
+ 86f:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 872:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 876:	e9 ae 00 00 00       	jmp    929 <printf+0x194>
+      } else if(c == 's'){
+ 87b:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 87f:	75 43                	jne    8c4 <printf+0x12f>
+        s = (char*)*ap;
+ 881:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 884:	8b 00                	mov    (%eax),%eax
+ 886:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 889:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 88d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 891:	75 25                	jne    8b8 <printf+0x123>
+          s = "(null)";
+ 893:	c7 45 f4 a8 0b 00 00 	movl   $0xba8,-0xc(%ebp)
+        while(*s != 0){
+ 89a:	eb 1c                	jmp    8b8 <printf+0x123>
+          putc(fd, *s);
+ 89c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 89f:	0f b6 00             	movzbl (%eax),%eax
+ 8a2:	0f be c0             	movsbl %al,%eax
+ 8a5:	83 ec 08             	sub    $0x8,%esp
+ 8a8:	50                   	push   %eax
+ 8a9:	ff 75 08             	push   0x8(%ebp)
+ 8ac:	e8 10 fe ff ff       	call   6c1 <putc>
+ 8b1:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 8b4:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 8b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8bb:	0f b6 00             	movzbl (%eax),%eax
+ 8be:	84 c0                	test   %al,%al
+ 8c0:	75 da                	jne    89c <printf+0x107>
+ 8c2:	eb 65                	jmp    929 <printf+0x194>
+        }
+      } else if(c == 'c'){
+ 8c4:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 8c8:	75 1d                	jne    8e7 <printf+0x152>
+        putc(fd, *ap);
+ 8ca:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8cd:	8b 00                	mov    (%eax),%eax
+ 8cf:	0f be c0             	movsbl %al,%eax
+ 8d2:	83 ec 08             	sub    $0x8,%esp
+ 8d5:	50                   	push   %eax
+ 8d6:	ff 75 08             	push   0x8(%ebp)
+ 8d9:	e8 e3 fd ff ff       	call   6c1 <putc>
+ 8de:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 8e1:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 8e5:	eb 42                	jmp    929 <printf+0x194>
+      } else if(c == '%'){
+ 8e7:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 8eb:	75 17                	jne    904 <printf+0x16f>
+        putc(fd, c);
+ 8ed:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8f0:	0f be c0             	movsbl %al,%eax
+ 8f3:	83 ec 08             	sub    $0x8,%esp
+ 8f6:	50                   	push   %eax
+ 8f7:	ff 75 08             	push   0x8(%ebp)
+ 8fa:	e8 c2 fd ff ff       	call   6c1 <putc>
+ 8ff:	83 c4 10             	add    $0x10,%esp
+ 902:	eb 25                	jmp    929 <printf+0x194>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 904:	83 ec 08             	sub    $0x8,%esp
+ 907:	6a 25                	push   $0x25
+ 909:	ff 75 08             	push   0x8(%ebp)
+ 90c:	e8 b0 fd ff ff       	call   6c1 <putc>
+ 911:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 914:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 917:	0f be c0             	movsbl %al,%eax
+ 91a:	83 ec 08             	sub    $0x8,%esp
+ 91d:	50                   	push   %eax
+ 91e:	ff 75 08             	push   0x8(%ebp)
+ 921:	e8 9b fd ff ff       	call   6c1 <putc>
+ 926:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 929:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 930:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 934:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 937:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 93a:	01 d0                	add    %edx,%eax
+ 93c:	0f b6 00             	movzbl (%eax),%eax
+ 93f:	84 c0                	test   %al,%al
+ 941:	0f 85 70 fe ff ff    	jne    7b7 <printf+0x22>
+    }
+  }
+}
+ 947:	90                   	nop
+ 948:	90                   	nop
+ 949:	c9                   	leave
+ 94a:	c3                   	ret
+
+0000094b <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 94b:	55                   	push   %ebp
+ 94c:	89 e5                	mov    %esp,%ebp
+ 94e:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 951:	8b 45 08             	mov    0x8(%ebp),%eax
+ 954:	83 e8 08             	sub    $0x8,%eax
+ 957:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 95a:	a1 c8 12 00 00       	mov    0x12c8,%eax
+ 95f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 962:	eb 24                	jmp    988 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 964:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 967:	8b 00                	mov    (%eax),%eax
+ 969:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 96c:	72 12                	jb     980 <free+0x35>
+ 96e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 971:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 974:	72 24                	jb     99a <free+0x4f>
+ 976:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 979:	8b 00                	mov    (%eax),%eax
+ 97b:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 97e:	72 1a                	jb     99a <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 980:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 983:	8b 00                	mov    (%eax),%eax
+ 985:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 988:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 98b:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 98e:	73 d4                	jae    964 <free+0x19>
+ 990:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 993:	8b 00                	mov    (%eax),%eax
+ 995:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 998:	73 ca                	jae    964 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 99a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 99d:	8b 40 04             	mov    0x4(%eax),%eax
+ 9a0:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 9a7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9aa:	01 c2                	add    %eax,%edx
+ 9ac:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9af:	8b 00                	mov    (%eax),%eax
+ 9b1:	39 c2                	cmp    %eax,%edx
+ 9b3:	75 24                	jne    9d9 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 9b5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9b8:	8b 50 04             	mov    0x4(%eax),%edx
+ 9bb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9be:	8b 00                	mov    (%eax),%eax
+ 9c0:	8b 40 04             	mov    0x4(%eax),%eax
+ 9c3:	01 c2                	add    %eax,%edx
+ 9c5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9c8:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9cb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9ce:	8b 00                	mov    (%eax),%eax
+ 9d0:	8b 10                	mov    (%eax),%edx
+ 9d2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9d5:	89 10                	mov    %edx,(%eax)
+ 9d7:	eb 0a                	jmp    9e3 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 9d9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9dc:	8b 10                	mov    (%eax),%edx
+ 9de:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9e1:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 9e3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9e6:	8b 40 04             	mov    0x4(%eax),%eax
+ 9e9:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 9f0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9f3:	01 d0                	add    %edx,%eax
+ 9f5:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 9f8:	75 20                	jne    a1a <free+0xcf>
+    p->s.size += bp->s.size;
+ 9fa:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9fd:	8b 50 04             	mov    0x4(%eax),%edx
+ a00:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a03:	8b 40 04             	mov    0x4(%eax),%eax
+ a06:	01 c2                	add    %eax,%edx
+ a08:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a0b:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ a0e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a11:	8b 10                	mov    (%eax),%edx
+ a13:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a16:	89 10                	mov    %edx,(%eax)
+ a18:	eb 08                	jmp    a22 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ a1a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a1d:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ a20:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ a22:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a25:	a3 c8 12 00 00       	mov    %eax,0x12c8
+}
+ a2a:	90                   	nop
+ a2b:	c9                   	leave
+ a2c:	c3                   	ret
+
+00000a2d <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ a2d:	55                   	push   %ebp
+ a2e:	89 e5                	mov    %esp,%ebp
+ a30:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ a33:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ a3a:	77 07                	ja     a43 <morecore+0x16>
+    nu = 4096;
+ a3c:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ a43:	8b 45 08             	mov    0x8(%ebp),%eax
+ a46:	c1 e0 03             	shl    $0x3,%eax
+ a49:	83 ec 0c             	sub    $0xc,%esp
+ a4c:	50                   	push   %eax
+ a4d:	e8 0f fc ff ff       	call   661 <sbrk>
+ a52:	83 c4 10             	add    $0x10,%esp
+ a55:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ a58:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ a5c:	75 07                	jne    a65 <morecore+0x38>
+    return 0;
+ a5e:	b8 00 00 00 00       	mov    $0x0,%eax
+ a63:	eb 26                	jmp    a8b <morecore+0x5e>
+  hp = (Header*)p;
+ a65:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a68:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ a6b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a6e:	8b 55 08             	mov    0x8(%ebp),%edx
+ a71:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ a74:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a77:	83 c0 08             	add    $0x8,%eax
+ a7a:	83 ec 0c             	sub    $0xc,%esp
+ a7d:	50                   	push   %eax
+ a7e:	e8 c8 fe ff ff       	call   94b <free>
+ a83:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ a86:	a1 c8 12 00 00       	mov    0x12c8,%eax
+}
+ a8b:	c9                   	leave
+ a8c:	c3                   	ret
+
+00000a8d <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ a8d:	55                   	push   %ebp
+ a8e:	89 e5                	mov    %esp,%ebp
+ a90:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a93:	8b 45 08             	mov    0x8(%ebp),%eax
+ a96:	83 c0 07             	add    $0x7,%eax
+ a99:	c1 e8 03             	shr    $0x3,%eax
+ a9c:	83 c0 01             	add    $0x1,%eax
+ a9f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ aa2:	a1 c8 12 00 00       	mov    0x12c8,%eax
+ aa7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ aaa:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ aae:	75 23                	jne    ad3 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ ab0:	c7 45 f0 c0 12 00 00 	movl   $0x12c0,-0x10(%ebp)
+ ab7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ aba:	a3 c8 12 00 00       	mov    %eax,0x12c8
+ abf:	a1 c8 12 00 00       	mov    0x12c8,%eax
+ ac4:	a3 c0 12 00 00       	mov    %eax,0x12c0
+    base.s.size = 0;
+ ac9:	c7 05 c4 12 00 00 00 	movl   $0x0,0x12c4
+ ad0:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ad3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ad6:	8b 00                	mov    (%eax),%eax
+ ad8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ adb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ade:	8b 40 04             	mov    0x4(%eax),%eax
+ ae1:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ ae4:	72 4d                	jb     b33 <malloc+0xa6>
+      if(p->s.size == nunits)
+ ae6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ae9:	8b 40 04             	mov    0x4(%eax),%eax
+ aec:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ aef:	75 0c                	jne    afd <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ af1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ af4:	8b 10                	mov    (%eax),%edx
+ af6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ af9:	89 10                	mov    %edx,(%eax)
+ afb:	eb 26                	jmp    b23 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ afd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b00:	8b 40 04             	mov    0x4(%eax),%eax
+ b03:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ b06:	89 c2                	mov    %eax,%edx
+ b08:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b0b:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ b0e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b11:	8b 40 04             	mov    0x4(%eax),%eax
+ b14:	c1 e0 03             	shl    $0x3,%eax
+ b17:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ b1a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b1d:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ b20:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ b23:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b26:	a3 c8 12 00 00       	mov    %eax,0x12c8
+      return (void*)(p + 1);
+ b2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b2e:	83 c0 08             	add    $0x8,%eax
+ b31:	eb 3b                	jmp    b6e <malloc+0xe1>
+    }
+    if(p == freep)
+ b33:	a1 c8 12 00 00       	mov    0x12c8,%eax
+ b38:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ b3b:	75 1e                	jne    b5b <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ b3d:	83 ec 0c             	sub    $0xc,%esp
+ b40:	ff 75 ec             	push   -0x14(%ebp)
+ b43:	e8 e5 fe ff ff       	call   a2d <morecore>
+ b48:	83 c4 10             	add    $0x10,%esp
+ b4b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ b4e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b52:	75 07                	jne    b5b <malloc+0xce>
+        return 0;
+ b54:	b8 00 00 00 00       	mov    $0x0,%eax
+ b59:	eb 13                	jmp    b6e <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b5b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b5e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ b61:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b64:	8b 00                	mov    (%eax),%eax
+ b66:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ b69:	e9 6d ff ff ff       	jmp    adb <malloc+0x4e>
+  }
+}
+ b6e:	c9                   	leave
+ b6f:	c3                   	ret
@@ -99,6 +99,8 @@ cprintf(char *fmt, ...)
     }
   }
 
+  virtcons_flush();
+
   if(locking)
     release(&cons.lock);
 }
@@ -162,19 +164,40 @@ cgaputc(int c)
   crt[pos] = ' ' | 0x0700;
 }
 
+// Print n bytes on the serial port and the screen, for a virtio
+// console that can't take them.
+void
+consfallback(char *s, int n)
+{
+  for(; n > 0; s++, n--){
+    uartputc(*s);
+    cgaputc(*s == '\b' ? BACKSPACE : *s);
+  }
+}
+
 void
 consputc(int c)
 {
+  char ch;
+
   if(panicked){
     cli();
     for(;;)
       ;
   }
 
+  // A virtio console, once there is one, replaces the serial port
+  // and the screen.
   if(c == BACKSPACE){
+    if(virtcons_write("\b \b", 3) == 0)
+      return;
     uartputc('\b'); uartputc(' '); uartputc('\b');
-  } else
+  } else {
+    ch = c;
+    if(virtcons_write(&ch, 1) == 0)
+      return;
     uartputc(c);
+  }
   cgaputc(c);
 }
 
@@ -226,6 +249,7 @@ consoleintr(int (*getc)(void))
       break;
     }
   }
+  virtcons_flush();
   release(&cons.lock);
   if(doprocdump) {
     procdump();  // now call procdump() wo. cons.lock held
@@ -277,8 +301,11 @@ consolewrite(struct inode *ip, char *buf, int n)
 
   iunlock(ip);
   acquire(&cons.lock);
-  for(i = 0; i < n; i++)
-    consputc(buf[i] & 0xff);
+  if(virtcons_write(buf, n) == 0)
+    virtcons_flush();
+  else
+    for(i = 0; i < n; i++)
+      consputc(buf[i] & 0xff);
   release(&cons.lock);
   ilock(ip);
 
@@ -12,20 +12,46 @@ struct sleeplock;
 struct stat;
 struct superblock;
 struct pci_device;
+struct pci_driver;
 struct virt_queue;
 struct virtio_device;
 struct virtq_desc;
+struct nic_device;
+struct pcapstat;
+struct bpf_hook;
+struct bpf_insn;
+struct pktgen_conf;
+struct pktgen_result;
+
+// acpi.c
+void*           acpitable(char*);
 
 // bio.c
 void            binit(void);
 struct buf*     bread(uint, uint);
 void            brelse(struct buf*);
 void            bwrite(struct buf*);
+void            bwritev(struct buf**, int);
+void            breadahead(uint, uint*, int);
+void            biodone(struct buf*);
+
+// bpf.c
+int             bpf_attach(struct bpf_hook*, struct bpf_insn*, int);
+uint            bpf_filter(struct bpf_insn*, uchar*, uint);
+void            bpf_hookinit(struct bpf_hook*, char*);
+uint            bpf_run(struct bpf_hook*, uchar*, uint);
+int             bpf_validate(struct bpf_insn*, int);
+
+// bridge.c
+void            bridgeinit(void);
+int             bridgectl(int, int, char*);
+int             bridge_input(struct nic_device*, uchar*, uint);
 
 // console.c
 void            consoleinit(void);
 void            cprintf(char*, ...);
 void            consoleintr(int(*)(void));
+void            consfallback(char*, int);
 void            panic(char*) __attribute__((noreturn));
 
 // exec.c
@@ -63,6 +89,7 @@ int             writei(struct inode*, char*, uint, uint);
 void            ideinit(void);
 void            ideintr(void);
 void            iderw(struct buf*);
+void            iderwv(struct buf**, int);
 
 // ioapic.c
 void            ioapicenable(int irq, int cpu);
@@ -71,6 +98,8 @@ void            ioapicinit(void);
 
 // kalloc.c
 char*           kalloc(void);
+char*           kallocn(int);
+int             kfreepages(void);
 void            kfree(char*);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
@@ -101,6 +130,14 @@ void            mpinit(void);
 void            picenable(int);
 void            picinit(void);
 
+// pcap.c
+extern int      pcapon;
+void            pcapinit(void);
+void            pcap_capture(struct nic_device*, int, uchar*, uint);
+int             pcapctl(int, struct pcapstat*);
+int             pcapread(char*, int);
+int             pcap_setfilter(struct bpf_insn*, int);
+
 // pipe.c
 int             pipealloc(struct file**, struct file**);
 void            pipeclose(struct pipe*, int);
@@ -108,12 +145,18 @@ int             piperead(struct pipe*, char*, int);
 int             pipewrite(struct pipe*, char*, int);
 
 //PAGEBREAK: 16
+// pktgen.c
+void            pktgeninit(void);
+int             pktgen_run(struct pktgen_conf*, struct pktgen_result*);
+void            pktgen_rx(struct nic_device*, uchar*, uint);
+
 // proc.c
 int             cpuid(void);
 void            exit(void);
 int             fork(void);
 int             growproc(int);
 int             kill(int);
+int             kthread(char*, void (*)(void));
 struct cpu*     mycpu(void);
 struct proc*    myproc();
 void            pinit(void);
@@ -164,6 +207,8 @@ void            syscall(void);
 
 // timer.c
 void            timerinit(void);
+extern uint     tsckhz;
+void            tscinit(void);
 
 // trap.c
 void            idtinit(void);
@@ -180,6 +225,8 @@ void            uartputc(int);
 void            seginit(void);
 void            kvmalloc(void);
 pde_t*          setupkvm(void);
+void*           ioremap(uint, uint, int);
+void            patinit(void);
 char*           uva2ka(pde_t*, char*);
 int             allocuvm(pde_t*, uint, uint);
 int             deallocuvm(pde_t*, uint, uint);
@@ -194,12 +241,40 @@ void            clearpteu(pde_t *pgdir, char *uva);
 
 // virtio.c
 int             alloc_virt_dev(int);
-int             conf_virtio_mem(int, void(*)(uint32*));
-int             virtio_init(int);
+int             conf_virtio_mem(int, void(*)(uint64_t*));
+void            virtioinit(void);
+int             virtio_probe(struct pci_device*);
+void*           virtio_device_cfg(struct virtio_device*);
 void            virtio_enable_intr(struct virt_queue*);
 void            virtio_disable_intr(struct virt_queue*);
-void            virtio_fill_buffer(struct virtio_device*, uint16 queue, struct virtq_desc*, uint32);
+int             virtio_fill_buffer(struct virtio_device*, uint16 queue, struct virtq_desc*, uint32);
+int             virtio_post(struct virtio_device*, uint16 queue, struct virtq_desc*, uint32);
 void            notify_queue(struct virtio_device*, uint16);
+void            virtio_kick(struct virtio_device*, uint16);
+uint8           virtio_isr(struct virtio_device*);
+uint8*          virtio_buffer(struct virt_queue*, uint16);
+int             virtio_next_used(struct virt_queue*, uint16*, uint32*);
+int             virtio_reclaim_used(struct virt_queue*);
+void            virtio_requeue(struct virt_queue*, uint16);
+int             virtiointr(int);
+
+// virt9p.c
+void            virt9pinit(void);
+int             virt9p_open(char*);
+int             virt9p_read(int, uint, char*, int);
+void            virt9p_close(int);
+
+// virtblk.c
+void            virtioblkinit(void);
+int             virtioblk_rwv(struct buf**, int);
+
+// virtcons.c
+void            virtconsinit(void);
+int             virtcons_write(char*, int);
+void            virtcons_flush(void);
+
+// virtnet.c
+void            virtionetinit(void);
 
 // netcard.c
 void            net_init(void);
@@ -209,7 +284,10 @@ int send_arpRequest(char* interface, char* ipAddr, char* arpResp);
 
 //pci.c
 int             pci_init(void);
+int             pci_register_driver(struct pci_driver*);
 int             get_pci_dev(int);
+int             config_pci(struct pci_device*);
+void            pci_set_master(struct pci_device*);
 
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))
@@ -76,7 +76,8 @@ fileclose(struct file *f)
     begin_op();
     iput(ff.ip);
     end_op();
-  }
+  } else if(ff.type == FD_HOST)
+    virt9p_close(ff.fid);
 }
 
 // Get metadata about file f.
@@ -109,6 +110,11 @@ fileread(struct file *f, char *addr, int n)
     iunlock(f->ip);
     return r;
   }
+  if(f->type == FD_HOST){
+    if((r = virt9p_read(f->fid, f->off, addr, n)) > 0)
+      f->off += r;
+    return r;
+  }
   panic("fileread");
 }
 
@@ -126,11 +132,11 @@ filewrite(struct file *f, char *addr, int n)
   if(f->type == FD_INODE){
     // write a few blocks at a time to avoid exceeding
     // the maximum log transaction size, including
-    // i-node, indirect block, allocation blocks,
+    // i-node, 2 indirect blocks, allocation blocks,
     // and 2 blocks of slop for non-aligned writes.
     // this really belongs lower down, since writei()
     // might be writing a device like the console.
-    int max = ((LOGSIZE-1-1-2) / 2) * 512;
+    int max = ((MAXOPBLOCKS-1-2-1-2) / 2) * BSIZE;
     int i = 0;
     while(i < n){
       int n1 = n - i;
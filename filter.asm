@@ -0,0 +1,1761 @@
+
+_filter:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <number>:
+
+// Parse a decimal or 0x-prefixed hex number at *sp and advance *sp
+// past it. Returns -1 if there is no number there.
+static int
+number(char **sp, uint *v)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 10             	sub    $0x10,%esp
+  char *s = *sp;
+   6:	8b 45 08             	mov    0x8(%ebp),%eax
+   9:	8b 00                	mov    (%eax),%eax
+   b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  int base, d, n;
+
+  while(*s == ' ' || *s == '\t' || *s == ',' || *s == '{')
+   e:	eb 04                	jmp    14 <number+0x14>
+    s++;
+  10:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  while(*s == ' ' || *s == '\t' || *s == ',' || *s == '{')
+  14:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  17:	0f b6 00             	movzbl (%eax),%eax
+  1a:	3c 20                	cmp    $0x20,%al
+  1c:	74 f2                	je     10 <number+0x10>
+  1e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  21:	0f b6 00             	movzbl (%eax),%eax
+  24:	3c 09                	cmp    $0x9,%al
+  26:	74 e8                	je     10 <number+0x10>
+  28:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  2b:	0f b6 00             	movzbl (%eax),%eax
+  2e:	3c 2c                	cmp    $0x2c,%al
+  30:	74 de                	je     10 <number+0x10>
+  32:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  35:	0f b6 00             	movzbl (%eax),%eax
+  38:	3c 7b                	cmp    $0x7b,%al
+  3a:	74 d4                	je     10 <number+0x10>
+  base = 10;
+  3c:	c7 45 f8 0a 00 00 00 	movl   $0xa,-0x8(%ebp)
+  if(s[0] == '0' && (s[1] == 'x' || s[1] == 'X')){
+  43:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  46:	0f b6 00             	movzbl (%eax),%eax
+  49:	3c 30                	cmp    $0x30,%al
+  4b:	75 25                	jne    72 <number+0x72>
+  4d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  50:	83 c0 01             	add    $0x1,%eax
+  53:	0f b6 00             	movzbl (%eax),%eax
+  56:	3c 78                	cmp    $0x78,%al
+  58:	74 0d                	je     67 <number+0x67>
+  5a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  5d:	83 c0 01             	add    $0x1,%eax
+  60:	0f b6 00             	movzbl (%eax),%eax
+  63:	3c 58                	cmp    $0x58,%al
+  65:	75 0b                	jne    72 <number+0x72>
+    base = 16;
+  67:	c7 45 f8 10 00 00 00 	movl   $0x10,-0x8(%ebp)
+    s += 2;
+  6e:	83 45 fc 02          	addl   $0x2,-0x4(%ebp)
+  }
+  *v = 0;
+  72:	8b 45 0c             	mov    0xc(%ebp),%eax
+  75:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  for(n = 0; ; n++, s++){
+  7b:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    if(*s >= '0' && *s <= '9')
+  82:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  85:	0f b6 00             	movzbl (%eax),%eax
+  88:	3c 2f                	cmp    $0x2f,%al
+  8a:	7e 1b                	jle    a7 <number+0xa7>
+  8c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  8f:	0f b6 00             	movzbl (%eax),%eax
+  92:	3c 39                	cmp    $0x39,%al
+  94:	7f 11                	jg     a7 <number+0xa7>
+      d = *s - '0';
+  96:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  99:	0f b6 00             	movzbl (%eax),%eax
+  9c:	0f be c0             	movsbl %al,%eax
+  9f:	83 e8 30             	sub    $0x30,%eax
+  a2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  a5:	eb 54                	jmp    fb <number+0xfb>
+    else if(base == 16 && *s >= 'a' && *s <= 'f')
+  a7:	83 7d f8 10          	cmpl   $0x10,-0x8(%ebp)
+  ab:	75 25                	jne    d2 <number+0xd2>
+  ad:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  b0:	0f b6 00             	movzbl (%eax),%eax
+  b3:	3c 60                	cmp    $0x60,%al
+  b5:	7e 1b                	jle    d2 <number+0xd2>
+  b7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  ba:	0f b6 00             	movzbl (%eax),%eax
+  bd:	3c 66                	cmp    $0x66,%al
+  bf:	7f 11                	jg     d2 <number+0xd2>
+      d = *s - 'a' + 10;
+  c1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  c4:	0f b6 00             	movzbl (%eax),%eax
+  c7:	0f be c0             	movsbl %al,%eax
+  ca:	83 e8 57             	sub    $0x57,%eax
+  cd:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  d0:	eb 29                	jmp    fb <number+0xfb>
+    else if(base == 16 && *s >= 'A' && *s <= 'F')
+  d2:	83 7d f8 10          	cmpl   $0x10,-0x8(%ebp)
+  d6:	75 45                	jne    11d <number+0x11d>
+  d8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  db:	0f b6 00             	movzbl (%eax),%eax
+  de:	3c 40                	cmp    $0x40,%al
+  e0:	7e 3b                	jle    11d <number+0x11d>
+  e2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  e5:	0f b6 00             	movzbl (%eax),%eax
+  e8:	3c 46                	cmp    $0x46,%al
+  ea:	7f 31                	jg     11d <number+0x11d>
+      d = *s - 'A' + 10;
+  ec:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  ef:	0f b6 00             	movzbl (%eax),%eax
+  f2:	0f be c0             	movsbl %al,%eax
+  f5:	83 e8 37             	sub    $0x37,%eax
+  f8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    else
+      break;
+    *v = *v * base + d;
+  fb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  fe:	8b 10                	mov    (%eax),%edx
+ 100:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 103:	0f af d0             	imul   %eax,%edx
+ 106:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 109:	01 c2                	add    %eax,%edx
+ 10b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 10e:	89 10                	mov    %edx,(%eax)
+  for(n = 0; ; n++, s++){
+ 110:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 114:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+    if(*s >= '0' && *s <= '9')
+ 118:	e9 65 ff ff ff       	jmp    82 <number+0x82>
+  }
+  *sp = s;
+ 11d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 120:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 123:	89 10                	mov    %edx,(%eax)
+  return n > 0 ? 0 : -1;
+ 125:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 129:	7e 07                	jle    132 <number+0x132>
+ 12b:	b8 00 00 00 00       	mov    $0x0,%eax
+ 130:	eb 05                	jmp    137 <number+0x137>
+ 132:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ 137:	c9                   	leave
+ 138:	c3                   	ret
+
+00000139 <parse>:
+
+// Parse the program in buf into prog[]. Returns the instruction count.
+static int
+parse(char *s)
+{
+ 139:	55                   	push   %ebp
+ 13a:	89 e5                	mov    %esp,%ebp
+ 13c:	83 ec 28             	sub    $0x28,%esp
+  uint code, jt, jf, k;
+  int n;
+
+  n = 0;
+ 13f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  while((s = strchr(s, '{')) != 0){
+ 146:	e9 9f 00 00 00       	jmp    1ea <parse+0xb1>
+    if(n == BPF_MAXINSNS ||
+ 14b:	81 7d f4 00 01 00 00 	cmpl   $0x100,-0xc(%ebp)
+ 152:	74 50                	je     1a4 <parse+0x6b>
+       number(&s, &code) < 0 || number(&s, &jt) < 0 ||
+ 154:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 157:	50                   	push   %eax
+ 158:	8d 45 08             	lea    0x8(%ebp),%eax
+ 15b:	50                   	push   %eax
+ 15c:	e8 9f fe ff ff       	call   0 <number>
+ 161:	83 c4 08             	add    $0x8,%esp
+    if(n == BPF_MAXINSNS ||
+ 164:	85 c0                	test   %eax,%eax
+ 166:	78 3c                	js     1a4 <parse+0x6b>
+       number(&s, &code) < 0 || number(&s, &jt) < 0 ||
+ 168:	8d 45 ec             	lea    -0x14(%ebp),%eax
+ 16b:	50                   	push   %eax
+ 16c:	8d 45 08             	lea    0x8(%ebp),%eax
+ 16f:	50                   	push   %eax
+ 170:	e8 8b fe ff ff       	call   0 <number>
+ 175:	83 c4 08             	add    $0x8,%esp
+ 178:	85 c0                	test   %eax,%eax
+ 17a:	78 28                	js     1a4 <parse+0x6b>
+       number(&s, &jf) < 0 || number(&s, &k) < 0)
+ 17c:	8d 45 e8             	lea    -0x18(%ebp),%eax
+ 17f:	50                   	push   %eax
+ 180:	8d 45 08             	lea    0x8(%ebp),%eax
+ 183:	50                   	push   %eax
+ 184:	e8 77 fe ff ff       	call   0 <number>
+ 189:	83 c4 08             	add    $0x8,%esp
+       number(&s, &code) < 0 || number(&s, &jt) < 0 ||
+ 18c:	85 c0                	test   %eax,%eax
+ 18e:	78 14                	js     1a4 <parse+0x6b>
+       number(&s, &jf) < 0 || number(&s, &k) < 0)
+ 190:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 193:	50                   	push   %eax
+ 194:	8d 45 08             	lea    0x8(%ebp),%eax
+ 197:	50                   	push   %eax
+ 198:	e8 63 fe ff ff       	call   0 <number>
+ 19d:	83 c4 08             	add    $0x8,%esp
+ 1a0:	85 c0                	test   %eax,%eax
+ 1a2:	79 07                	jns    1ab <parse+0x72>
+      return -1;
+ 1a4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 1a9:	eb 61                	jmp    20c <parse+0xd3>
+    prog[n].code = code;
+ 1ab:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 1ae:	89 c2                	mov    %eax,%edx
+ 1b0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1b3:	66 89 14 c5 c0 15 00 	mov    %dx,0x15c0(,%eax,8)
+ 1ba:	00 
+    prog[n].jt = jt;
+ 1bb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 1be:	89 c2                	mov    %eax,%edx
+ 1c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1c3:	88 14 c5 c2 15 00 00 	mov    %dl,0x15c2(,%eax,8)
+    prog[n].jf = jf;
+ 1ca:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 1cd:	89 c2                	mov    %eax,%edx
+ 1cf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1d2:	88 14 c5 c3 15 00 00 	mov    %dl,0x15c3(,%eax,8)
+    prog[n].k = k;
+ 1d9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 1dc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1df:	89 14 c5 c4 15 00 00 	mov    %edx,0x15c4(,%eax,8)
+    n++;
+ 1e6:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  while((s = strchr(s, '{')) != 0){
+ 1ea:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1ed:	83 ec 08             	sub    $0x8,%esp
+ 1f0:	6a 7b                	push   $0x7b
+ 1f2:	50                   	push   %eax
+ 1f3:	e8 4b 02 00 00       	call   443 <strchr>
+ 1f8:	83 c4 10             	add    $0x10,%esp
+ 1fb:	89 45 08             	mov    %eax,0x8(%ebp)
+ 1fe:	8b 45 08             	mov    0x8(%ebp),%eax
+ 201:	85 c0                	test   %eax,%eax
+ 203:	0f 85 42 ff ff ff    	jne    14b <parse+0x12>
+  }
+  return n;
+ 209:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 20c:	c9                   	leave
+ 20d:	c3                   	ret
+
+0000020e <main>:
+
+int
+main(int argc, char *argv[])
+{
+ 20e:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 212:	83 e4 f0             	and    $0xfffffff0,%esp
+ 215:	ff 71 fc             	push   -0x4(%ecx)
+ 218:	55                   	push   %ebp
+ 219:	89 e5                	mov    %esp,%ebp
+ 21b:	53                   	push   %ebx
+ 21c:	51                   	push   %ecx
+ 21d:	83 ec 10             	sub    $0x10,%esp
+ 220:	89 cb                	mov    %ecx,%ebx
+  int target, fd, n, m;
+
+  if(argc != 3){
+ 222:	83 3b 03             	cmpl   $0x3,(%ebx)
+ 225:	74 17                	je     23e <main+0x30>
+    printf(2, "usage: filter ifindex|cap file|-\n");
+ 227:	83 ec 08             	sub    $0x8,%esp
+ 22a:	68 f4 0d 00 00       	push   $0xdf4
+ 22f:	6a 02                	push   $0x2
+ 231:	e8 e0 07 00 00       	call   a16 <printf>
+ 236:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 239:	e8 1c 06 00 00       	call   85a <exit>
+  }
+  target = strcmp(argv[1], "cap") == 0 ? BPF_CAPTURE : atoi(argv[1]);
+ 23e:	8b 43 04             	mov    0x4(%ebx),%eax
+ 241:	83 c0 04             	add    $0x4,%eax
+ 244:	8b 00                	mov    (%eax),%eax
+ 246:	83 ec 08             	sub    $0x8,%esp
+ 249:	68 16 0e 00 00       	push   $0xe16
+ 24e:	50                   	push   %eax
+ 24f:	e8 94 03 00 00       	call   5e8 <strcmp>
+ 254:	83 c4 10             	add    $0x10,%esp
+ 257:	85 c0                	test   %eax,%eax
+ 259:	74 16                	je     271 <main+0x63>
+ 25b:	8b 43 04             	mov    0x4(%ebx),%eax
+ 25e:	83 c0 04             	add    $0x4,%eax
+ 261:	8b 00                	mov    (%eax),%eax
+ 263:	83 ec 0c             	sub    $0xc,%esp
+ 266:	50                   	push   %eax
+ 267:	e8 2f 03 00 00       	call   59b <atoi>
+ 26c:	83 c4 10             	add    $0x10,%esp
+ 26f:	eb 05                	jmp    276 <main+0x68>
+ 271:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 276:	89 45 ec             	mov    %eax,-0x14(%ebp)
+
+  n = 0;
+ 279:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  if(strcmp(argv[2], "-") != 0){
+ 280:	8b 43 04             	mov    0x4(%ebx),%eax
+ 283:	83 c0 08             	add    $0x8,%eax
+ 286:	8b 00                	mov    (%eax),%eax
+ 288:	83 ec 08             	sub    $0x8,%esp
+ 28b:	68 1a 0e 00 00       	push   $0xe1a
+ 290:	50                   	push   %eax
+ 291:	e8 52 03 00 00       	call   5e8 <strcmp>
+ 296:	83 c4 10             	add    $0x10,%esp
+ 299:	85 c0                	test   %eax,%eax
+ 29b:	0f 84 d5 00 00 00    	je     376 <main+0x168>
+    if((fd = open(argv[2], O_RDONLY)) < 0){
+ 2a1:	8b 43 04             	mov    0x4(%ebx),%eax
+ 2a4:	83 c0 08             	add    $0x8,%eax
+ 2a7:	8b 00                	mov    (%eax),%eax
+ 2a9:	83 ec 08             	sub    $0x8,%esp
+ 2ac:	6a 00                	push   $0x0
+ 2ae:	50                   	push   %eax
+ 2af:	e8 e6 05 00 00       	call   89a <open>
+ 2b4:	83 c4 10             	add    $0x10,%esp
+ 2b7:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 2ba:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 2be:	79 20                	jns    2e0 <main+0xd2>
+      printf(2, "filter: cannot open %s\n", argv[2]);
+ 2c0:	8b 43 04             	mov    0x4(%ebx),%eax
+ 2c3:	83 c0 08             	add    $0x8,%eax
+ 2c6:	8b 00                	mov    (%eax),%eax
+ 2c8:	83 ec 04             	sub    $0x4,%esp
+ 2cb:	50                   	push   %eax
+ 2cc:	68 1c 0e 00 00       	push   $0xe1c
+ 2d1:	6a 02                	push   $0x2
+ 2d3:	e8 3e 07 00 00       	call   a16 <printf>
+ 2d8:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 2db:	e8 7a 05 00 00       	call   85a <exit>
+    }
+    m = 0;
+ 2e0:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    while(m < sizeof(buf) - 1 && (n = read(fd, buf + m, sizeof(buf) - 1 - m)) > 0)
+ 2e7:	eb 06                	jmp    2ef <main+0xe1>
+      m += n;
+ 2e9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2ec:	01 45 f0             	add    %eax,-0x10(%ebp)
+    while(m < sizeof(buf) - 1 && (n = read(fd, buf + m, sizeof(buf) - 1 - m)) > 0)
+ 2ef:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 2f2:	3d fe 2f 00 00       	cmp    $0x2ffe,%eax
+ 2f7:	77 2b                	ja     324 <main+0x116>
+ 2f9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 2fc:	ba ff 2f 00 00       	mov    $0x2fff,%edx
+ 301:	29 c2                	sub    %eax,%edx
+ 303:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 306:	05 c0 1d 00 00       	add    $0x1dc0,%eax
+ 30b:	83 ec 04             	sub    $0x4,%esp
+ 30e:	52                   	push   %edx
+ 30f:	50                   	push   %eax
+ 310:	ff 75 e8             	push   -0x18(%ebp)
+ 313:	e8 5a 05 00 00       	call   872 <read>
+ 318:	83 c4 10             	add    $0x10,%esp
+ 31b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 31e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 322:	7f c5                	jg     2e9 <main+0xdb>
+    buf[m] = 0;
+ 324:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 327:	05 c0 1d 00 00       	add    $0x1dc0,%eax
+ 32c:	c6 00 00             	movb   $0x0,(%eax)
+    close(fd);
+ 32f:	83 ec 0c             	sub    $0xc,%esp
+ 332:	ff 75 e8             	push   -0x18(%ebp)
+ 335:	e8 48 05 00 00       	call   882 <close>
+ 33a:	83 c4 10             	add    $0x10,%esp
+    if((n = parse(buf)) <= 0){
+ 33d:	83 ec 0c             	sub    $0xc,%esp
+ 340:	68 c0 1d 00 00       	push   $0x1dc0
+ 345:	e8 ef fd ff ff       	call   139 <parse>
+ 34a:	83 c4 10             	add    $0x10,%esp
+ 34d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 350:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 354:	7f 20                	jg     376 <main+0x168>
+      printf(2, "filter: %s: bad program\n", argv[2]);
+ 356:	8b 43 04             	mov    0x4(%ebx),%eax
+ 359:	83 c0 08             	add    $0x8,%eax
+ 35c:	8b 00                	mov    (%eax),%eax
+ 35e:	83 ec 04             	sub    $0x4,%esp
+ 361:	50                   	push   %eax
+ 362:	68 34 0e 00 00       	push   $0xe34
+ 367:	6a 02                	push   $0x2
+ 369:	e8 a8 06 00 00       	call   a16 <printf>
+ 36e:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 371:	e8 e4 04 00 00       	call   85a <exit>
+    }
+  }
+
+  if(bpfattach(target, prog, n) < 0){
+ 376:	83 ec 04             	sub    $0x4,%esp
+ 379:	ff 75 f4             	push   -0xc(%ebp)
+ 37c:	68 c0 15 00 00       	push   $0x15c0
+ 381:	ff 75 ec             	push   -0x14(%ebp)
+ 384:	e8 91 05 00 00       	call   91a <bpfattach>
+ 389:	83 c4 10             	add    $0x10,%esp
+ 38c:	85 c0                	test   %eax,%eax
+ 38e:	79 17                	jns    3a7 <main+0x199>
+    printf(2, "filter: rejected\n");
+ 390:	83 ec 08             	sub    $0x8,%esp
+ 393:	68 4d 0e 00 00       	push   $0xe4d
+ 398:	6a 02                	push   $0x2
+ 39a:	e8 77 06 00 00       	call   a16 <printf>
+ 39f:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 3a2:	e8 b3 04 00 00       	call   85a <exit>
+  }
+  exit();
+ 3a7:	e8 ae 04 00 00       	call   85a <exit>
+
+000003ac <stosb>:
+}
+
+int
+stat(char *n, struct stat *st)
+{
+  int fd;
+ 3ac:	55                   	push   %ebp
+ 3ad:	89 e5                	mov    %esp,%ebp
+ 3af:	57                   	push   %edi
+ 3b0:	53                   	push   %ebx
+  int r;
+ 3b1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 3b4:	8b 55 10             	mov    0x10(%ebp),%edx
+ 3b7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3ba:	89 cb                	mov    %ecx,%ebx
+ 3bc:	89 df                	mov    %ebx,%edi
+ 3be:	89 d1                	mov    %edx,%ecx
+ 3c0:	fc                   	cld
+ 3c1:	f3 aa                	rep stos %al,%es:(%edi)
+ 3c3:	89 ca                	mov    %ecx,%edx
+ 3c5:	89 fb                	mov    %edi,%ebx
+ 3c7:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 3ca:	89 55 10             	mov    %edx,0x10(%ebp)
+
+  fd = open(n, O_RDONLY);
+  if(fd < 0)
+    return -1;
+ 3cd:	90                   	nop
+ 3ce:	5b                   	pop    %ebx
+ 3cf:	5f                   	pop    %edi
+ 3d0:	5d                   	pop    %ebp
+ 3d1:	c3                   	ret
+
+000003d2 <strcpy>:
+{
+ 3d2:	55                   	push   %ebp
+ 3d3:	89 e5                	mov    %esp,%ebp
+ 3d5:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 3d8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3db:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 3de:	90                   	nop
+ 3df:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 3e2:	8d 42 01             	lea    0x1(%edx),%eax
+ 3e5:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 3e8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3eb:	8d 48 01             	lea    0x1(%eax),%ecx
+ 3ee:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 3f1:	0f b6 12             	movzbl (%edx),%edx
+ 3f4:	88 10                	mov    %dl,(%eax)
+ 3f6:	0f b6 00             	movzbl (%eax),%eax
+ 3f9:	84 c0                	test   %al,%al
+ 3fb:	75 e2                	jne    3df <strcpy+0xd>
+  return os;
+ 3fd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 400:	c9                   	leave
+ 401:	c3                   	ret
+
+00000402 <strlen>:
+{
+ 402:	55                   	push   %ebp
+ 403:	89 e5                	mov    %esp,%ebp
+ 405:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 408:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 40f:	eb 04                	jmp    415 <strlen+0x13>
+ 411:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 415:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 418:	8b 45 08             	mov    0x8(%ebp),%eax
+ 41b:	01 d0                	add    %edx,%eax
+ 41d:	0f b6 00             	movzbl (%eax),%eax
+ 420:	84 c0                	test   %al,%al
+ 422:	75 ed                	jne    411 <strlen+0xf>
+  return n;
+ 424:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 427:	c9                   	leave
+ 428:	c3                   	ret
+
+00000429 <memset>:
+{
+ 429:	55                   	push   %ebp
+ 42a:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 42c:	8b 45 10             	mov    0x10(%ebp),%eax
+ 42f:	50                   	push   %eax
+ 430:	ff 75 0c             	push   0xc(%ebp)
+ 433:	ff 75 08             	push   0x8(%ebp)
+ 436:	e8 71 ff ff ff       	call   3ac <stosb>
+ 43b:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 43e:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 441:	c9                   	leave
+ 442:	c3                   	ret
+
+00000443 <strchr>:
+{
+ 443:	55                   	push   %ebp
+ 444:	89 e5                	mov    %esp,%ebp
+ 446:	83 ec 04             	sub    $0x4,%esp
+ 449:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 44c:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 44f:	eb 14                	jmp    465 <strchr+0x22>
+    if(*s == c)
+ 451:	8b 45 08             	mov    0x8(%ebp),%eax
+ 454:	0f b6 00             	movzbl (%eax),%eax
+ 457:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 45a:	75 05                	jne    461 <strchr+0x1e>
+      return (char*)s;
+ 45c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 45f:	eb 13                	jmp    474 <strchr+0x31>
+  for(; *s; s++)
+ 461:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 465:	8b 45 08             	mov    0x8(%ebp),%eax
+ 468:	0f b6 00             	movzbl (%eax),%eax
+ 46b:	84 c0                	test   %al,%al
+ 46d:	75 e2                	jne    451 <strchr+0xe>
+  return 0;
+ 46f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 474:	c9                   	leave
+ 475:	c3                   	ret
+
+00000476 <gets>:
+{
+ 476:	55                   	push   %ebp
+ 477:	89 e5                	mov    %esp,%ebp
+ 479:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 47c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 483:	eb 42                	jmp    4c7 <gets+0x51>
+    cc = read(0, &c, 1);
+ 485:	83 ec 04             	sub    $0x4,%esp
+ 488:	6a 01                	push   $0x1
+ 48a:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 48d:	50                   	push   %eax
+ 48e:	6a 00                	push   $0x0
+ 490:	e8 dd 03 00 00       	call   872 <read>
+ 495:	83 c4 10             	add    $0x10,%esp
+ 498:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 49b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 49f:	7e 33                	jle    4d4 <gets+0x5e>
+    buf[i++] = c;
+ 4a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4a4:	8d 50 01             	lea    0x1(%eax),%edx
+ 4a7:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 4aa:	89 c2                	mov    %eax,%edx
+ 4ac:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4af:	01 c2                	add    %eax,%edx
+ 4b1:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 4b5:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 4b7:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 4bb:	3c 0a                	cmp    $0xa,%al
+ 4bd:	74 16                	je     4d5 <gets+0x5f>
+ 4bf:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 4c3:	3c 0d                	cmp    $0xd,%al
+ 4c5:	74 0e                	je     4d5 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 4c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4ca:	83 c0 01             	add    $0x1,%eax
+ 4cd:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 4d0:	7f b3                	jg     485 <gets+0xf>
+ 4d2:	eb 01                	jmp    4d5 <gets+0x5f>
+      break;
+ 4d4:	90                   	nop
+  buf[i] = '\0';
+ 4d5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 4d8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4db:	01 d0                	add    %edx,%eax
+ 4dd:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 4e0:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 4e3:	c9                   	leave
+ 4e4:	c3                   	ret
+
+000004e5 <stat>:
+{
+ 4e5:	55                   	push   %ebp
+ 4e6:	89 e5                	mov    %esp,%ebp
+ 4e8:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+ 4eb:	83 ec 08             	sub    $0x8,%esp
+ 4ee:	6a 00                	push   $0x0
+ 4f0:	ff 75 08             	push   0x8(%ebp)
+ 4f3:	e8 a2 03 00 00       	call   89a <open>
+ 4f8:	83 c4 10             	add    $0x10,%esp
+ 4fb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 4fe:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 502:	79 07                	jns    50b <stat+0x26>
+    return -1;
+ 504:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 509:	eb 25                	jmp    530 <stat+0x4b>
+  r = fstat(fd, st);
+ 50b:	83 ec 08             	sub    $0x8,%esp
+ 50e:	ff 75 0c             	push   0xc(%ebp)
+ 511:	ff 75 f4             	push   -0xc(%ebp)
+ 514:	e8 99 03 00 00       	call   8b2 <fstat>
+ 519:	83 c4 10             	add    $0x10,%esp
+ 51c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 51f:	83 ec 0c             	sub    $0xc,%esp
+ 522:	ff 75 f4             	push   -0xc(%ebp)
+ 525:	e8 58 03 00 00       	call   882 <close>
+ 52a:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 52d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 530:	c9                   	leave
+ 531:	c3                   	ret
+
+00000532 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 532:	55                   	push   %ebp
+ 533:	89 e5                	mov    %esp,%ebp
+ 535:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+
+  dst = vdst;
+ 538:	8b 45 08             	mov    0x8(%ebp),%eax
+ 53b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 53e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 541:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 544:	eb 17                	jmp    55d <memmove+0x2b>
+    *dst++ = *src++;
+ 546:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 549:	8d 42 01             	lea    0x1(%edx),%eax
+ 54c:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 54f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 552:	8d 48 01             	lea    0x1(%eax),%ecx
+ 555:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 558:	0f b6 12             	movzbl (%edx),%edx
+ 55b:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 55d:	8b 45 10             	mov    0x10(%ebp),%eax
+ 560:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 563:	89 55 10             	mov    %edx,0x10(%ebp)
+ 566:	85 c0                	test   %eax,%eax
+ 568:	7f dc                	jg     546 <memmove+0x14>
+  return vdst;
+ 56a:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 56d:	c9                   	leave
+ 56e:	c3                   	ret
+
+0000056f <cpuinfo>:
+ 56f:	55                   	push   %ebp
+ 570:	89 e5                	mov    %esp,%ebp
+ 572:	56                   	push   %esi
+ 573:	53                   	push   %ebx
+ 574:	8b 45 08             	mov    0x8(%ebp),%eax
+ 577:	ba 00 00 00 00       	mov    $0x0,%edx
+ 57c:	89 d1                	mov    %edx,%ecx
+ 57e:	0f a2                	cpuid
+ 580:	89 c6                	mov    %eax,%esi
+ 582:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 585:	89 30                	mov    %esi,(%eax)
+ 587:	8b 45 10             	mov    0x10(%ebp),%eax
+ 58a:	89 18                	mov    %ebx,(%eax)
+ 58c:	8b 45 14             	mov    0x14(%ebp),%eax
+ 58f:	89 08                	mov    %ecx,(%eax)
+ 591:	8b 45 18             	mov    0x18(%ebp),%eax
+ 594:	89 10                	mov    %edx,(%eax)
+ 596:	90                   	nop
+ 597:	5b                   	pop    %ebx
+ 598:	5e                   	pop    %esi
+ 599:	5d                   	pop    %ebp
+ 59a:	c3                   	ret
+
+0000059b <atoi>:
+{
+ 59b:	55                   	push   %ebp
+ 59c:	89 e5                	mov    %esp,%ebp
+ 59e:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+ 5a1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 5a8:	eb 25                	jmp    5cf <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 5aa:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 5ad:	89 d0                	mov    %edx,%eax
+ 5af:	c1 e0 02             	shl    $0x2,%eax
+ 5b2:	01 d0                	add    %edx,%eax
+ 5b4:	01 c0                	add    %eax,%eax
+ 5b6:	89 c1                	mov    %eax,%ecx
+ 5b8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5bb:	8d 50 01             	lea    0x1(%eax),%edx
+ 5be:	89 55 08             	mov    %edx,0x8(%ebp)
+ 5c1:	0f b6 00             	movzbl (%eax),%eax
+ 5c4:	0f be c0             	movsbl %al,%eax
+ 5c7:	01 c8                	add    %ecx,%eax
+ 5c9:	83 e8 30             	sub    $0x30,%eax
+ 5cc:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 5cf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5d2:	0f b6 00             	movzbl (%eax),%eax
+ 5d5:	3c 2f                	cmp    $0x2f,%al
+ 5d7:	7e 0a                	jle    5e3 <atoi+0x48>
+ 5d9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5dc:	0f b6 00             	movzbl (%eax),%eax
+ 5df:	3c 39                	cmp    $0x39,%al
+ 5e1:	7e c7                	jle    5aa <atoi+0xf>
+  return n;
+ 5e3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 5e6:	c9                   	leave
+ 5e7:	c3                   	ret
+
+000005e8 <strcmp>:
+{
+ 5e8:	55                   	push   %ebp
+ 5e9:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 5eb:	eb 08                	jmp    5f5 <strcmp+0xd>
+    p++, q++;
+ 5ed:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 5f1:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 5f5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5f8:	0f b6 00             	movzbl (%eax),%eax
+ 5fb:	84 c0                	test   %al,%al
+ 5fd:	74 10                	je     60f <strcmp+0x27>
+ 5ff:	8b 45 08             	mov    0x8(%ebp),%eax
+ 602:	0f b6 10             	movzbl (%eax),%edx
+ 605:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 608:	0f b6 00             	movzbl (%eax),%eax
+ 60b:	38 c2                	cmp    %al,%dl
+ 60d:	74 de                	je     5ed <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 60f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 612:	0f b6 00             	movzbl (%eax),%eax
+ 615:	0f b6 d0             	movzbl %al,%edx
+ 618:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 61b:	0f b6 00             	movzbl (%eax),%eax
+ 61e:	0f b6 c0             	movzbl %al,%eax
+ 621:	29 c2                	sub    %eax,%edx
+ 623:	89 d0                	mov    %edx,%eax
+}
+ 625:	5d                   	pop    %ebp
+ 626:	c3                   	ret
+
+00000627 <udiv64>:
+{
+ 627:	55                   	push   %ebp
+ 628:	89 e5                	mov    %esp,%ebp
+ 62a:	57                   	push   %edi
+ 62b:	56                   	push   %esi
+ 62c:	83 ec 38             	sub    $0x38,%esp
+ 62f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 632:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 635:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 638:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 63b:	8b 45 10             	mov    0x10(%ebp),%eax
+ 63e:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 641:	8b 45 14             	mov    0x14(%ebp),%eax
+ 644:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  q = r = 0;
+ 647:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 64e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 655:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 658:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 65b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 65e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 661:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 668:	e9 85 00 00 00       	jmp    6f2 <udiv64+0xcb>
+    r = (r << 1) | ((n >> i) & 1);
+ 66d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 670:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 673:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 677:	01 c0                	add    %eax,%eax
+ 679:	89 c6                	mov    %eax,%esi
+ 67b:	89 d7                	mov    %edx,%edi
+ 67d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 680:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 683:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 686:	0f ad d0             	shrd   %cl,%edx,%eax
+ 689:	d3 ea                	shr    %cl,%edx
+ 68b:	f6 c1 20             	test   $0x20,%cl
+ 68e:	74 04                	je     694 <udiv64+0x6d>
+ 690:	89 d0                	mov    %edx,%eax
+ 692:	31 d2                	xor    %edx,%edx
+ 694:	83 e0 01             	and    $0x1,%eax
+ 697:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 69a:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+ 6a1:	89 f0                	mov    %esi,%eax
+ 6a3:	89 fa                	mov    %edi,%edx
+ 6a5:	0b 45 c0             	or     -0x40(%ebp),%eax
+ 6a8:	0b 55 c4             	or     -0x3c(%ebp),%edx
+ 6ab:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 6ae:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 6b1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6b4:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 6b7:	3b 45 c8             	cmp    -0x38(%ebp),%eax
+ 6ba:	89 d0                	mov    %edx,%eax
+ 6bc:	1b 45 cc             	sbb    -0x34(%ebp),%eax
+ 6bf:	72 2d                	jb     6ee <udiv64+0xc7>
+      r -= d;
+ 6c1:	8b 45 c8             	mov    -0x38(%ebp),%eax
+ 6c4:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 6c7:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 6ca:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64_t)1 << i;
+ 6cd:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 6d0:	b8 01 00 00 00       	mov    $0x1,%eax
+ 6d5:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6da:	0f a5 c2             	shld   %cl,%eax,%edx
+ 6dd:	d3 e0                	shl    %cl,%eax
+ 6df:	f6 c1 20             	test   $0x20,%cl
+ 6e2:	74 04                	je     6e8 <udiv64+0xc1>
+ 6e4:	89 c2                	mov    %eax,%edx
+ 6e6:	31 c0                	xor    %eax,%eax
+ 6e8:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 6eb:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 6ee:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 6f2:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 6f6:	0f 89 71 ff ff ff    	jns    66d <udiv64+0x46>
+  if(rem)
+ 6fc:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+ 700:	74 0e                	je     710 <udiv64+0xe9>
+    *rem = r;
+ 702:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 705:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 708:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 70b:	89 01                	mov    %eax,(%ecx)
+ 70d:	89 51 04             	mov    %edx,0x4(%ecx)
+  return q;
+ 710:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 713:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 716:	83 c4 38             	add    $0x38,%esp
+ 719:	5e                   	pop    %esi
+ 71a:	5f                   	pop    %edi
+ 71b:	5d                   	pop    %ebp
+ 71c:	c3                   	ret
+
+0000071d <crc32cinit>:
+{
+ 71d:	55                   	push   %ebp
+ 71e:	89 e5                	mov    %esp,%ebp
+ 720:	83 ec 20             	sub    $0x20,%esp
+  for(i = 0; i < 256; i++){
+ 723:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 72a:	eb 4c                	jmp    778 <crc32cinit+0x5b>
+    r = i;
+ 72c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 72f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+ 732:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+ 739:	eb 26                	jmp    761 <crc32cinit+0x44>
+      r = (r >> 1) ^ ((r & 1) ? CRC32C_POLY : 0);
+ 73b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 73e:	d1 e8                	shr    %eax
+ 740:	89 c2                	mov    %eax,%edx
+ 742:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 745:	83 e0 01             	and    $0x1,%eax
+ 748:	85 c0                	test   %eax,%eax
+ 74a:	74 07                	je     753 <crc32cinit+0x36>
+ 74c:	b8 78 3b f6 82       	mov    $0x82f63b78,%eax
+ 751:	eb 05                	jmp    758 <crc32cinit+0x3b>
+ 753:	b8 00 00 00 00       	mov    $0x0,%eax
+ 758:	31 d0                	xor    %edx,%eax
+ 75a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+ 75d:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+ 761:	83 7d f8 07          	cmpl   $0x7,-0x8(%ebp)
+ 765:	76 d4                	jbe    73b <crc32cinit+0x1e>
+    crc32ctab[i] = r;
+ 767:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 76a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 76d:	89 14 85 a0 11 00 00 	mov    %edx,0x11a0(,%eax,4)
+  for(i = 0; i < 256; i++){
+ 774:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 778:	81 7d fc ff 00 00 00 	cmpl   $0xff,-0x4(%ebp)
+ 77f:	76 ab                	jbe    72c <crc32cinit+0xf>
+  cpuinfo(1, &a, &b, &c, &d);
+ 781:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 784:	50                   	push   %eax
+ 785:	8d 45 e8             	lea    -0x18(%ebp),%eax
+ 788:	50                   	push   %eax
+ 789:	8d 45 ec             	lea    -0x14(%ebp),%eax
+ 78c:	50                   	push   %eax
+ 78d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 790:	50                   	push   %eax
+ 791:	6a 01                	push   $0x1
+ 793:	e8 d7 fd ff ff       	call   56f <cpuinfo>
+ 798:	83 c4 14             	add    $0x14,%esp
+  crc32chw = (c & CPUID_SSE42) != 0;
+ 79b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 79e:	25 00 00 10 00       	and    $0x100000,%eax
+ 7a3:	85 c0                	test   %eax,%eax
+ 7a5:	0f 95 c0             	setne  %al
+ 7a8:	0f b6 c0             	movzbl %al,%eax
+ 7ab:	a3 80 11 00 00       	mov    %eax,0x1180
+}
+ 7b0:	90                   	nop
+ 7b1:	c9                   	leave
+ 7b2:	c3                   	ret
+
+000007b3 <crc32c>:
+{
+ 7b3:	55                   	push   %ebp
+ 7b4:	89 e5                	mov    %esp,%ebp
+ 7b6:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s = p;
+ 7b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7bc:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(crc32chw < 0)
+ 7bf:	a1 80 11 00 00       	mov    0x1180,%eax
+ 7c4:	85 c0                	test   %eax,%eax
+ 7c6:	79 05                	jns    7cd <crc32c+0x1a>
+    crc32cinit();
+ 7c8:	e8 50 ff ff ff       	call   71d <crc32cinit>
+  crc = ~crc;
+ 7cd:	f7 55 08             	notl   0x8(%ebp)
+  if(crc32chw){
+ 7d0:	a1 80 11 00 00       	mov    0x1180,%eax
+ 7d5:	85 c0                	test   %eax,%eax
+ 7d7:	74 6c                	je     845 <crc32c+0x92>
+    for(; n >= 4; n -= 4, s += 4)
+ 7d9:	eb 18                	jmp    7f3 <crc32c+0x40>
+      asm("crc32l %1, %0" : "+r" (crc) : "rm" (*(const uint*)s));
+ 7db:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7de:	8b 10                	mov    (%eax),%edx
+ 7e0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7e3:	f2 0f 38 f1 c2       	crc32  %edx,%eax
+ 7e8:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n >= 4; n -= 4, s += 4)
+ 7eb:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+ 7ef:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+ 7f3:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+ 7f7:	77 e2                	ja     7db <crc32c+0x28>
+    for(; n > 0; n--, s++)
+ 7f9:	eb 19                	jmp    814 <crc32c+0x61>
+      asm("crc32b %1, %0" : "+r" (crc) : "qm" (*s));
+ 7fb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7fe:	0f b6 10             	movzbl (%eax),%edx
+ 801:	8b 45 08             	mov    0x8(%ebp),%eax
+ 804:	f2 0f 38 f0 c2       	crc32  %dl,%eax
+ 809:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+ 80c:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+ 810:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 814:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 818:	75 e1                	jne    7fb <crc32c+0x48>
+ 81a:	eb 2f                	jmp    84b <crc32c+0x98>
+      crc = crc32ctab[(crc ^ *s) & 0xff] ^ (crc >> 8);
+ 81c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 81f:	0f b6 00             	movzbl (%eax),%eax
+ 822:	0f b6 c0             	movzbl %al,%eax
+ 825:	33 45 08             	xor    0x8(%ebp),%eax
+ 828:	0f b6 c0             	movzbl %al,%eax
+ 82b:	8b 04 85 a0 11 00 00 	mov    0x11a0(,%eax,4),%eax
+ 832:	8b 55 08             	mov    0x8(%ebp),%edx
+ 835:	c1 ea 08             	shr    $0x8,%edx
+ 838:	31 d0                	xor    %edx,%eax
+ 83a:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+ 83d:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+ 841:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 845:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 849:	75 d1                	jne    81c <crc32c+0x69>
+  return ~crc;
+ 84b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 84e:	f7 d0                	not    %eax
+}
+ 850:	c9                   	leave
+ 851:	c3                   	ret
+
+00000852 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 852:	b8 01 00 00 00       	mov    $0x1,%eax
+ 857:	cd 40                	int    $0x40
+ 859:	c3                   	ret
+
+0000085a <exit>:
+SYSCALL(exit)
+ 85a:	b8 02 00 00 00       	mov    $0x2,%eax
+ 85f:	cd 40                	int    $0x40
+ 861:	c3                   	ret
+
+00000862 <wait>:
+SYSCALL(wait)
+ 862:	b8 03 00 00 00       	mov    $0x3,%eax
+ 867:	cd 40                	int    $0x40
+ 869:	c3                   	ret
+
+0000086a <pipe>:
+SYSCALL(pipe)
+ 86a:	b8 04 00 00 00       	mov    $0x4,%eax
+ 86f:	cd 40                	int    $0x40
+ 871:	c3                   	ret
+
+00000872 <read>:
+SYSCALL(read)
+ 872:	b8 05 00 00 00       	mov    $0x5,%eax
+ 877:	cd 40                	int    $0x40
+ 879:	c3                   	ret
+
+0000087a <write>:
+SYSCALL(write)
+ 87a:	b8 10 00 00 00       	mov    $0x10,%eax
+ 87f:	cd 40                	int    $0x40
+ 881:	c3                   	ret
+
+00000882 <close>:
+SYSCALL(close)
+ 882:	b8 15 00 00 00       	mov    $0x15,%eax
+ 887:	cd 40                	int    $0x40
+ 889:	c3                   	ret
+
+0000088a <kill>:
+SYSCALL(kill)
+ 88a:	b8 06 00 00 00       	mov    $0x6,%eax
+ 88f:	cd 40                	int    $0x40
+ 891:	c3                   	ret
+
+00000892 <exec>:
+SYSCALL(exec)
+ 892:	b8 07 00 00 00       	mov    $0x7,%eax
+ 897:	cd 40                	int    $0x40
+ 899:	c3                   	ret
+
+0000089a <open>:
+SYSCALL(open)
+ 89a:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 89f:	cd 40                	int    $0x40
+ 8a1:	c3                   	ret
+
+000008a2 <mknod>:
+SYSCALL(mknod)
+ 8a2:	b8 11 00 00 00       	mov    $0x11,%eax
+ 8a7:	cd 40                	int    $0x40
+ 8a9:	c3                   	ret
+
+000008aa <unlink>:
+SYSCALL(unlink)
+ 8aa:	b8 12 00 00 00       	mov    $0x12,%eax
+ 8af:	cd 40                	int    $0x40
+ 8b1:	c3                   	ret
+
+000008b2 <fstat>:
+SYSCALL(fstat)
+ 8b2:	b8 08 00 00 00       	mov    $0x8,%eax
+ 8b7:	cd 40                	int    $0x40
+ 8b9:	c3                   	ret
+
+000008ba <link>:
+SYSCALL(link)
+ 8ba:	b8 13 00 00 00       	mov    $0x13,%eax
+ 8bf:	cd 40                	int    $0x40
+ 8c1:	c3                   	ret
+
+000008c2 <mkdir>:
+SYSCALL(mkdir)
+ 8c2:	b8 14 00 00 00       	mov    $0x14,%eax
+ 8c7:	cd 40                	int    $0x40
+ 8c9:	c3                   	ret
+
+000008ca <chdir>:
+SYSCALL(chdir)
+ 8ca:	b8 09 00 00 00       	mov    $0x9,%eax
+ 8cf:	cd 40                	int    $0x40
+ 8d1:	c3                   	ret
+
+000008d2 <dup>:
+SYSCALL(dup)
+ 8d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 8d7:	cd 40                	int    $0x40
+ 8d9:	c3                   	ret
+
+000008da <getpid>:
+SYSCALL(getpid)
+ 8da:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 8df:	cd 40                	int    $0x40
+ 8e1:	c3                   	ret
+
+000008e2 <sbrk>:
+SYSCALL(sbrk)
+ 8e2:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 8e7:	cd 40                	int    $0x40
+ 8e9:	c3                   	ret
+
+000008ea <sleep>:
+SYSCALL(sleep)
+ 8ea:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 8ef:	cd 40                	int    $0x40
+ 8f1:	c3                   	ret
+
+000008f2 <uptime>:
+SYSCALL(uptime)
+ 8f2:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 8f7:	cd 40                	int    $0x40
+ 8f9:	c3                   	ret
+
+000008fa <arp>:
+SYSCALL(arp)
+ 8fa:	b8 16 00 00 00       	mov    $0x16,%eax
+ 8ff:	cd 40                	int    $0x40
+ 901:	c3                   	ret
+
+00000902 <ifstat>:
+SYSCALL(ifstat)
+ 902:	b8 17 00 00 00       	mov    $0x17,%eax
+ 907:	cd 40                	int    $0x40
+ 909:	c3                   	ret
+
+0000090a <pcapctl>:
+SYSCALL(pcapctl)
+ 90a:	b8 18 00 00 00       	mov    $0x18,%eax
+ 90f:	cd 40                	int    $0x40
+ 911:	c3                   	ret
+
+00000912 <pcapread>:
+SYSCALL(pcapread)
+ 912:	b8 19 00 00 00       	mov    $0x19,%eax
+ 917:	cd 40                	int    $0x40
+ 919:	c3                   	ret
+
+0000091a <bpfattach>:
+SYSCALL(bpfattach)
+ 91a:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 91f:	cd 40                	int    $0x40
+ 921:	c3                   	ret
+
+00000922 <pktgen>:
+SYSCALL(pktgen)
+ 922:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 927:	cd 40                	int    $0x40
+ 929:	c3                   	ret
+
+0000092a <reflect>:
+SYSCALL(reflect)
+ 92a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 92f:	cd 40                	int    $0x40
+ 931:	c3                   	ret
+
+00000932 <brctl>:
+SYSCALL(brctl)
+ 932:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 937:	cd 40                	int    $0x40
+ 939:	c3                   	ret
+
+0000093a <hostopen>:
+SYSCALL(hostopen)
+ 93a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 93f:	cd 40                	int    $0x40
+ 941:	c3                   	ret
+
+00000942 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 942:	55                   	push   %ebp
+ 943:	89 e5                	mov    %esp,%ebp
+ 945:	83 ec 18             	sub    $0x18,%esp
+ 948:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 94b:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 94e:	83 ec 04             	sub    $0x4,%esp
+ 951:	6a 01                	push   $0x1
+ 953:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 956:	50                   	push   %eax
+ 957:	ff 75 08             	push   0x8(%ebp)
+ 95a:	e8 1b ff ff ff       	call   87a <write>
+ 95f:	83 c4 10             	add    $0x10,%esp
+}
+ 962:	90                   	nop
+ 963:	c9                   	leave
+ 964:	c3                   	ret
+
+00000965 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 965:	55                   	push   %ebp
+ 966:	89 e5                	mov    %esp,%ebp
+ 968:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 96b:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 972:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 976:	74 17                	je     98f <printint+0x2a>
+ 978:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 97c:	79 11                	jns    98f <printint+0x2a>
+    neg = 1;
+ 97e:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 985:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 988:	f7 d8                	neg    %eax
+ 98a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 98d:	eb 06                	jmp    995 <printint+0x30>
+  } else {
+    x = xx;
+ 98f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 992:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 995:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 99c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 99f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 9a2:	ba 00 00 00 00       	mov    $0x0,%edx
+ 9a7:	f7 f1                	div    %ecx
+ 9a9:	89 d1                	mov    %edx,%ecx
+ 9ab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9ae:	8d 50 01             	lea    0x1(%eax),%edx
+ 9b1:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 9b4:	0f b6 91 84 11 00 00 	movzbl 0x1184(%ecx),%edx
+ 9bb:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 9bf:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 9c2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 9c5:	ba 00 00 00 00       	mov    $0x0,%edx
+ 9ca:	f7 f1                	div    %ecx
+ 9cc:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 9cf:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 9d3:	75 c7                	jne    99c <printint+0x37>
+  if(neg)
+ 9d5:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 9d9:	74 2d                	je     a08 <printint+0xa3>
+    buf[i++] = '-';
+ 9db:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9de:	8d 50 01             	lea    0x1(%eax),%edx
+ 9e1:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 9e4:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 9e9:	eb 1d                	jmp    a08 <printint+0xa3>
+    putc(fd, buf[i]);
+ 9eb:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 9ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9f1:	01 d0                	add    %edx,%eax
+ 9f3:	0f b6 00             	movzbl (%eax),%eax
+ 9f6:	0f be c0             	movsbl %al,%eax
+ 9f9:	83 ec 08             	sub    $0x8,%esp
+ 9fc:	50                   	push   %eax
+ 9fd:	ff 75 08             	push   0x8(%ebp)
+ a00:	e8 3d ff ff ff       	call   942 <putc>
+ a05:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ a08:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ a0c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a10:	79 d9                	jns    9eb <printint+0x86>
+}
+ a12:	90                   	nop
+ a13:	90                   	nop
+ a14:	c9                   	leave
+ a15:	c3                   	ret
+
+00000a16 <printf>:
+
+// Print to the given fd. Only understands %d, %u, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ a16:	55                   	push   %ebp
+ a17:	89 e5                	mov    %esp,%ebp
+ a19:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ a1c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ a23:	8d 45 0c             	lea    0xc(%ebp),%eax
+ a26:	83 c0 04             	add    $0x4,%eax
+ a29:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ a2c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ a33:	e9 7d 01 00 00       	jmp    bb5 <printf+0x19f>
+    c = fmt[i] & 0xff;
+ a38:	8b 55 0c             	mov    0xc(%ebp),%edx
+ a3b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a3e:	01 d0                	add    %edx,%eax
+ a40:	0f b6 00             	movzbl (%eax),%eax
+ a43:	0f be c0             	movsbl %al,%eax
+ a46:	25 ff 00 00 00       	and    $0xff,%eax
+ a4b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ a4e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ a52:	75 2c                	jne    a80 <printf+0x6a>
+      if(c == '%'){
+ a54:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ a58:	75 0c                	jne    a66 <printf+0x50>
+        state = '%';
+ a5a:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ a61:	e9 4b 01 00 00       	jmp    bb1 <printf+0x19b>
+      } else {
+        putc(fd, c);
+ a66:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a69:	0f be c0             	movsbl %al,%eax
+ a6c:	83 ec 08             	sub    $0x8,%esp
+ a6f:	50                   	push   %eax
+ a70:	ff 75 08             	push   0x8(%ebp)
+ a73:	e8 ca fe ff ff       	call   942 <putc>
+ a78:	83 c4 10             	add    $0x10,%esp
+ a7b:	e9 31 01 00 00       	jmp    bb1 <printf+0x19b>
+      }
+    } else if(state == '%'){
+ a80:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ a84:	0f 85 27 01 00 00    	jne    bb1 <printf+0x19b>
+      if(c == 'd'){
+ a8a:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ a8e:	75 1e                	jne    aae <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ a90:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a93:	8b 00                	mov    (%eax),%eax
+ a95:	6a 01                	push   $0x1
+ a97:	6a 0a                	push   $0xa
+ a99:	50                   	push   %eax
+ a9a:	ff 75 08             	push   0x8(%ebp)
+ a9d:	e8 c3 fe ff ff       	call   965 <printint>
+ aa2:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ aa5:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ aa9:	e9 fc 00 00 00       	jmp    baa <printf+0x194>
+      } else if(c == 'u'){
+ aae:	83 7d e4 75          	cmpl   $0x75,-0x1c(%ebp)
+ ab2:	75 1e                	jne    ad2 <printf+0xbc>
+        printint(fd, *ap, 10, 0);
+ ab4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ ab7:	8b 00                	mov    (%eax),%eax
+ ab9:	6a 00                	push   $0x0
+ abb:	6a 0a                	push   $0xa
+ abd:	50                   	push   %eax
+ abe:	ff 75 08             	push   0x8(%ebp)
+ ac1:	e8 9f fe ff ff       	call   965 <printint>
+ ac6:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ ac9:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ acd:	e9 d8 00 00 00       	jmp    baa <printf+0x194>
+      } else if(c == 'x' || c == 'p'){
+ ad2:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ ad6:	74 06                	je     ade <printf+0xc8>
+ ad8:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ adc:	75 1e                	jne    afc <printf+0xe6>
+        printint(fd, *ap, 16, 0);
+ ade:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ ae1:	8b 00                	mov    (%eax),%eax
+ ae3:	6a 00                	push   $0x0
+ ae5:	6a 10                	push   $0x10
+ ae7:	50                   	push   %eax
+ ae8:	ff 75 08             	push   0x8(%ebp)
+ aeb:	e8 75 fe ff ff       	call   965 <printint>
+ af0:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ af3:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ af7:	e9 ae 00 00 00       	jmp    baa <printf+0x194>
+      } else if(c == 's'){
+ afc:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ b00:	75 43                	jne    b45 <printf+0x12f>
+        s = (char*)*ap;
+ b02:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ b05:	8b 00                	mov    (%eax),%eax
+ b07:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ b0a:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ b0e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b12:	75 25                	jne    b39 <printf+0x123>
+          s = "(null)";
+ b14:	c7 45 f4 5f 0e 00 00 	movl   $0xe5f,-0xc(%ebp)
+        while(*s != 0){
+ b1b:	eb 1c                	jmp    b39 <printf+0x123>
+          putc(fd, *s);
+ b1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b20:	0f b6 00             	movzbl (%eax),%eax
+ b23:	0f be c0             	movsbl %al,%eax
+ b26:	83 ec 08             	sub    $0x8,%esp
+ b29:	50                   	push   %eax
+ b2a:	ff 75 08             	push   0x8(%ebp)
+ b2d:	e8 10 fe ff ff       	call   942 <putc>
+ b32:	83 c4 10             	add    $0x10,%esp
+          s++;
+ b35:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ b39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b3c:	0f b6 00             	movzbl (%eax),%eax
+ b3f:	84 c0                	test   %al,%al
+ b41:	75 da                	jne    b1d <printf+0x107>
+ b43:	eb 65                	jmp    baa <printf+0x194>
+        }
+      } else if(c == 'c'){
+ b45:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ b49:	75 1d                	jne    b68 <printf+0x152>
+        putc(fd, *ap);
+ b4b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ b4e:	8b 00                	mov    (%eax),%eax
+ b50:	0f be c0             	movsbl %al,%eax
+ b53:	83 ec 08             	sub    $0x8,%esp
+ b56:	50                   	push   %eax
+ b57:	ff 75 08             	push   0x8(%ebp)
+ b5a:	e8 e3 fd ff ff       	call   942 <putc>
+ b5f:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ b62:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ b66:	eb 42                	jmp    baa <printf+0x194>
+      } else if(c == '%'){
+ b68:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ b6c:	75 17                	jne    b85 <printf+0x16f>
+        putc(fd, c);
+ b6e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ b71:	0f be c0             	movsbl %al,%eax
+ b74:	83 ec 08             	sub    $0x8,%esp
+ b77:	50                   	push   %eax
+ b78:	ff 75 08             	push   0x8(%ebp)
+ b7b:	e8 c2 fd ff ff       	call   942 <putc>
+ b80:	83 c4 10             	add    $0x10,%esp
+ b83:	eb 25                	jmp    baa <printf+0x194>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ b85:	83 ec 08             	sub    $0x8,%esp
+ b88:	6a 25                	push   $0x25
+ b8a:	ff 75 08             	push   0x8(%ebp)
+ b8d:	e8 b0 fd ff ff       	call   942 <putc>
+ b92:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ b95:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ b98:	0f be c0             	movsbl %al,%eax
+ b9b:	83 ec 08             	sub    $0x8,%esp
+ b9e:	50                   	push   %eax
+ b9f:	ff 75 08             	push   0x8(%ebp)
+ ba2:	e8 9b fd ff ff       	call   942 <putc>
+ ba7:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ baa:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ bb1:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ bb5:	8b 55 0c             	mov    0xc(%ebp),%edx
+ bb8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ bbb:	01 d0                	add    %edx,%eax
+ bbd:	0f b6 00             	movzbl (%eax),%eax
+ bc0:	84 c0                	test   %al,%al
+ bc2:	0f 85 70 fe ff ff    	jne    a38 <printf+0x22>
+    }
+  }
+}
+ bc8:	90                   	nop
+ bc9:	90                   	nop
+ bca:	c9                   	leave
+ bcb:	c3                   	ret
+
+00000bcc <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ bcc:	55                   	push   %ebp
+ bcd:	89 e5                	mov    %esp,%ebp
+ bcf:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ bd2:	8b 45 08             	mov    0x8(%ebp),%eax
+ bd5:	83 e8 08             	sub    $0x8,%eax
+ bd8:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bdb:	a1 a8 15 00 00       	mov    0x15a8,%eax
+ be0:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ be3:	eb 24                	jmp    c09 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ be5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ be8:	8b 00                	mov    (%eax),%eax
+ bea:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ bed:	72 12                	jb     c01 <free+0x35>
+ bef:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bf2:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ bf5:	72 24                	jb     c1b <free+0x4f>
+ bf7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bfa:	8b 00                	mov    (%eax),%eax
+ bfc:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ bff:	72 1a                	jb     c1b <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c01:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c04:	8b 00                	mov    (%eax),%eax
+ c06:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ c09:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c0c:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ c0f:	73 d4                	jae    be5 <free+0x19>
+ c11:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c14:	8b 00                	mov    (%eax),%eax
+ c16:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ c19:	73 ca                	jae    be5 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ c1b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c1e:	8b 40 04             	mov    0x4(%eax),%eax
+ c21:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ c28:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c2b:	01 c2                	add    %eax,%edx
+ c2d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c30:	8b 00                	mov    (%eax),%eax
+ c32:	39 c2                	cmp    %eax,%edx
+ c34:	75 24                	jne    c5a <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ c36:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c39:	8b 50 04             	mov    0x4(%eax),%edx
+ c3c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c3f:	8b 00                	mov    (%eax),%eax
+ c41:	8b 40 04             	mov    0x4(%eax),%eax
+ c44:	01 c2                	add    %eax,%edx
+ c46:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c49:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c4c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c4f:	8b 00                	mov    (%eax),%eax
+ c51:	8b 10                	mov    (%eax),%edx
+ c53:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c56:	89 10                	mov    %edx,(%eax)
+ c58:	eb 0a                	jmp    c64 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ c5a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c5d:	8b 10                	mov    (%eax),%edx
+ c5f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c62:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ c64:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c67:	8b 40 04             	mov    0x4(%eax),%eax
+ c6a:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ c71:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c74:	01 d0                	add    %edx,%eax
+ c76:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ c79:	75 20                	jne    c9b <free+0xcf>
+    p->s.size += bp->s.size;
+ c7b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c7e:	8b 50 04             	mov    0x4(%eax),%edx
+ c81:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c84:	8b 40 04             	mov    0x4(%eax),%eax
+ c87:	01 c2                	add    %eax,%edx
+ c89:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c8c:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ c8f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c92:	8b 10                	mov    (%eax),%edx
+ c94:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c97:	89 10                	mov    %edx,(%eax)
+ c99:	eb 08                	jmp    ca3 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ c9b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c9e:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ ca1:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ ca3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ca6:	a3 a8 15 00 00       	mov    %eax,0x15a8
+}
+ cab:	90                   	nop
+ cac:	c9                   	leave
+ cad:	c3                   	ret
+
+00000cae <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ cae:	55                   	push   %ebp
+ caf:	89 e5                	mov    %esp,%ebp
+ cb1:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ cb4:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ cbb:	77 07                	ja     cc4 <morecore+0x16>
+    nu = 4096;
+ cbd:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ cc4:	8b 45 08             	mov    0x8(%ebp),%eax
+ cc7:	c1 e0 03             	shl    $0x3,%eax
+ cca:	83 ec 0c             	sub    $0xc,%esp
+ ccd:	50                   	push   %eax
+ cce:	e8 0f fc ff ff       	call   8e2 <sbrk>
+ cd3:	83 c4 10             	add    $0x10,%esp
+ cd6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ cd9:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ cdd:	75 07                	jne    ce6 <morecore+0x38>
+    return 0;
+ cdf:	b8 00 00 00 00       	mov    $0x0,%eax
+ ce4:	eb 26                	jmp    d0c <morecore+0x5e>
+  hp = (Header*)p;
+ ce6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ce9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ cec:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cef:	8b 55 08             	mov    0x8(%ebp),%edx
+ cf2:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ cf5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cf8:	83 c0 08             	add    $0x8,%eax
+ cfb:	83 ec 0c             	sub    $0xc,%esp
+ cfe:	50                   	push   %eax
+ cff:	e8 c8 fe ff ff       	call   bcc <free>
+ d04:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ d07:	a1 a8 15 00 00       	mov    0x15a8,%eax
+}
+ d0c:	c9                   	leave
+ d0d:	c3                   	ret
+
+00000d0e <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ d0e:	55                   	push   %ebp
+ d0f:	89 e5                	mov    %esp,%ebp
+ d11:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d14:	8b 45 08             	mov    0x8(%ebp),%eax
+ d17:	83 c0 07             	add    $0x7,%eax
+ d1a:	c1 e8 03             	shr    $0x3,%eax
+ d1d:	83 c0 01             	add    $0x1,%eax
+ d20:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ d23:	a1 a8 15 00 00       	mov    0x15a8,%eax
+ d28:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ d2b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ d2f:	75 23                	jne    d54 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ d31:	c7 45 f0 a0 15 00 00 	movl   $0x15a0,-0x10(%ebp)
+ d38:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d3b:	a3 a8 15 00 00       	mov    %eax,0x15a8
+ d40:	a1 a8 15 00 00       	mov    0x15a8,%eax
+ d45:	a3 a0 15 00 00       	mov    %eax,0x15a0
+    base.s.size = 0;
+ d4a:	c7 05 a4 15 00 00 00 	movl   $0x0,0x15a4
+ d51:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d54:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d57:	8b 00                	mov    (%eax),%eax
+ d59:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ d5c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d5f:	8b 40 04             	mov    0x4(%eax),%eax
+ d62:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ d65:	72 4d                	jb     db4 <malloc+0xa6>
+      if(p->s.size == nunits)
+ d67:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d6a:	8b 40 04             	mov    0x4(%eax),%eax
+ d6d:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ d70:	75 0c                	jne    d7e <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ d72:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d75:	8b 10                	mov    (%eax),%edx
+ d77:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d7a:	89 10                	mov    %edx,(%eax)
+ d7c:	eb 26                	jmp    da4 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ d7e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d81:	8b 40 04             	mov    0x4(%eax),%eax
+ d84:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ d87:	89 c2                	mov    %eax,%edx
+ d89:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d8c:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ d8f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d92:	8b 40 04             	mov    0x4(%eax),%eax
+ d95:	c1 e0 03             	shl    $0x3,%eax
+ d98:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ d9b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d9e:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ da1:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ da4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ da7:	a3 a8 15 00 00       	mov    %eax,0x15a8
+      return (void*)(p + 1);
+ dac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ daf:	83 c0 08             	add    $0x8,%eax
+ db2:	eb 3b                	jmp    def <malloc+0xe1>
+    }
+    if(p == freep)
+ db4:	a1 a8 15 00 00       	mov    0x15a8,%eax
+ db9:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ dbc:	75 1e                	jne    ddc <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ dbe:	83 ec 0c             	sub    $0xc,%esp
+ dc1:	ff 75 ec             	push   -0x14(%ebp)
+ dc4:	e8 e5 fe ff ff       	call   cae <morecore>
+ dc9:	83 c4 10             	add    $0x10,%esp
+ dcc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ dcf:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ dd3:	75 07                	jne    ddc <malloc+0xce>
+        return 0;
+ dd5:	b8 00 00 00 00       	mov    $0x0,%eax
+ dda:	eb 13                	jmp    def <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ddc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ddf:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ de2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ de5:	8b 00                	mov    (%eax),%eax
+ de7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ dea:	e9 6d ff ff ff       	jmp    d5c <malloc+0x4e>
+  }
+}
+ def:	c9                   	leave
+ df0:	c3                   	ret
@@ -0,0 +1,105 @@
+// filter: attach a BPF program to an interface or to the capture ring.
+//
+//   filter ifindex file   attach the program in file to interface ifindex
+//   filter cap file       attach it to the packet capture (pcapdump)
+//   filter ifindex -      detach
+//
+// The file holds one instruction per line in the format printed by
+// `tcpdump -dd`, e.g. { 0x28, 0, 0, 0x0000000c },
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "bpf.h"
+
+struct bpf_insn prog[BPF_MAXINSNS];
+char buf[BPF_MAXINSNS * 48];
+
+// Parse a decimal or 0x-prefixed hex number at *sp and advance *sp
+// past it. Returns -1 if there is no number there.
+static int
+number(char **sp, uint *v)
+{
+  char *s = *sp;
+  int base, d, n;
+
+  while(*s == ' ' || *s == '\t' || *s == ',' || *s == '{')
+    s++;
+  base = 10;
+  if(s[0] == '0' && (s[1] == 'x' || s[1] == 'X')){
+    base = 16;
+    s += 2;
+  }
+  *v = 0;
+  for(n = 0; ; n++, s++){
+    if(*s >= '0' && *s <= '9')
+      d = *s - '0';
+    else if(base == 16 && *s >= 'a' && *s <= 'f')
+      d = *s - 'a' + 10;
+    else if(base == 16 && *s >= 'A' && *s <= 'F')
+      d = *s - 'A' + 10;
+    else
+      break;
+    *v = *v * base + d;
+  }
+  *sp = s;
+  return n > 0 ? 0 : -1;
+}
+
+// Parse the program in buf into prog[]. Returns the instruction count.
+static int
+parse(char *s)
+{
+  uint code, jt, jf, k;
+  int n;
+
+  n = 0;
+  while((s = strchr(s, '{')) != 0){
+    if(n == BPF_MAXINSNS ||
+       number(&s, &code) < 0 || number(&s, &jt) < 0 ||
+       number(&s, &jf) < 0 || number(&s, &k) < 0)
+      return -1;
+    prog[n].code = code;
+    prog[n].jt = jt;
+    prog[n].jf = jf;
+    prog[n].k = k;
+    n++;
+  }
+  return n;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int target, fd, n, m;
+
+  if(argc != 3){
+    printf(2, "usage: filter ifindex|cap file|-\n");
+    exit();
+  }
+  target = strcmp(argv[1], "cap") == 0 ? BPF_CAPTURE : atoi(argv[1]);
+
+  n = 0;
+  if(strcmp(argv[2], "-") != 0){
+    if((fd = open(argv[2], O_RDONLY)) < 0){
+      printf(2, "filter: cannot open %s\n", argv[2]);
+      exit();
+    }
+    m = 0;
+    while(m < sizeof(buf) - 1 && (n = read(fd, buf + m, sizeof(buf) - 1 - m)) > 0)
+      m += n;
+    buf[m] = 0;
+    close(fd);
+    if((n = parse(buf)) <= 0){
+      printf(2, "filter: %s: bad program\n", argv[2]);
+      exit();
+    }
+  }
+
+  if(bpfattach(target, prog, n) < 0){
+    printf(2, "filter: rejected\n");
+    exit();
+  }
+  exit();
+}
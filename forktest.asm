@@ -0,0 +1,913 @@
+
+_forktest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <printf>:
+
+#define N  1000
+
+void
+printf(int fd, char *s, ...)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 08             	sub    $0x8,%esp
+  write(fd, s, strlen(s));
+   6:	83 ec 0c             	sub    $0xc,%esp
+   9:	ff 75 0c             	push   0xc(%ebp)
+   c:	e8 4d 01 00 00       	call   15e <strlen>
+  11:	83 c4 10             	add    $0x10,%esp
+  14:	83 ec 04             	sub    $0x4,%esp
+  17:	50                   	push   %eax
+  18:	ff 75 0c             	push   0xc(%ebp)
+  1b:	ff 75 08             	push   0x8(%ebp)
+  1e:	e8 b3 05 00 00       	call   5d6 <write>
+  23:	83 c4 10             	add    $0x10,%esp
+}
+  26:	90                   	nop
+  27:	c9                   	leave
+  28:	c3                   	ret
+
+00000029 <forktest>:
+
+void
+forktest(void)
+{
+  29:	55                   	push   %ebp
+  2a:	89 e5                	mov    %esp,%ebp
+  2c:	83 ec 18             	sub    $0x18,%esp
+  int n, pid;
+
+  printf(1, "fork test\n");
+  2f:	83 ec 08             	sub    $0x8,%esp
+  32:	68 a0 06 00 00       	push   $0x6a0
+  37:	6a 01                	push   $0x1
+  39:	e8 c2 ff ff ff       	call   0 <printf>
+  3e:	83 c4 10             	add    $0x10,%esp
+
+  for(n=0; n<N; n++){
+  41:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  48:	eb 1d                	jmp    67 <forktest+0x3e>
+    pid = fork();
+  4a:	e8 5f 05 00 00       	call   5ae <fork>
+  4f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(pid < 0)
+  52:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  56:	78 1a                	js     72 <forktest+0x49>
+      break;
+    if(pid == 0)
+  58:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  5c:	75 05                	jne    63 <forktest+0x3a>
+      exit();
+  5e:	e8 53 05 00 00       	call   5b6 <exit>
+  for(n=0; n<N; n++){
+  63:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  67:	81 7d f4 e7 03 00 00 	cmpl   $0x3e7,-0xc(%ebp)
+  6e:	7e da                	jle    4a <forktest+0x21>
+  70:	eb 01                	jmp    73 <forktest+0x4a>
+      break;
+  72:	90                   	nop
+  }
+
+  if(n == N){
+  73:	81 7d f4 e8 03 00 00 	cmpl   $0x3e8,-0xc(%ebp)
+  7a:	75 40                	jne    bc <forktest+0x93>
+    printf(1, "fork claimed to work N times!\n", N);
+  7c:	83 ec 04             	sub    $0x4,%esp
+  7f:	68 e8 03 00 00       	push   $0x3e8
+  84:	68 ac 06 00 00       	push   $0x6ac
+  89:	6a 01                	push   $0x1
+  8b:	e8 70 ff ff ff       	call   0 <printf>
+  90:	83 c4 10             	add    $0x10,%esp
+    exit();
+  93:	e8 1e 05 00 00       	call   5b6 <exit>
+  }
+
+  for(; n > 0; n--){
+    if(wait() < 0){
+  98:	e8 21 05 00 00       	call   5be <wait>
+  9d:	85 c0                	test   %eax,%eax
+  9f:	79 17                	jns    b8 <forktest+0x8f>
+      printf(1, "wait stopped early\n");
+  a1:	83 ec 08             	sub    $0x8,%esp
+  a4:	68 cb 06 00 00       	push   $0x6cb
+  a9:	6a 01                	push   $0x1
+  ab:	e8 50 ff ff ff       	call   0 <printf>
+  b0:	83 c4 10             	add    $0x10,%esp
+      exit();
+  b3:	e8 fe 04 00 00       	call   5b6 <exit>
+  for(; n > 0; n--){
+  b8:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+  bc:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  c0:	7f d6                	jg     98 <forktest+0x6f>
+    }
+  }
+
+  if(wait() != -1){
+  c2:	e8 f7 04 00 00       	call   5be <wait>
+  c7:	83 f8 ff             	cmp    $0xffffffff,%eax
+  ca:	74 17                	je     e3 <forktest+0xba>
+    printf(1, "wait got too many\n");
+  cc:	83 ec 08             	sub    $0x8,%esp
+  cf:	68 df 06 00 00       	push   $0x6df
+  d4:	6a 01                	push   $0x1
+  d6:	e8 25 ff ff ff       	call   0 <printf>
+  db:	83 c4 10             	add    $0x10,%esp
+    exit();
+  de:	e8 d3 04 00 00       	call   5b6 <exit>
+  }
+
+  printf(1, "fork test OK\n");
+  e3:	83 ec 08             	sub    $0x8,%esp
+  e6:	68 f2 06 00 00       	push   $0x6f2
+  eb:	6a 01                	push   $0x1
+  ed:	e8 0e ff ff ff       	call   0 <printf>
+  f2:	83 c4 10             	add    $0x10,%esp
+}
+  f5:	90                   	nop
+  f6:	c9                   	leave
+  f7:	c3                   	ret
+
+000000f8 <main>:
+
+int
+main(void)
+{
+  f8:	55                   	push   %ebp
+  f9:	89 e5                	mov    %esp,%ebp
+  fb:	83 e4 f0             	and    $0xfffffff0,%esp
+  forktest();
+  fe:	e8 26 ff ff ff       	call   29 <forktest>
+  exit();
+ 103:	e8 ae 04 00 00       	call   5b6 <exit>
+
+00000108 <stosb>:
+}
+
+int
+stat(char *n, struct stat *st)
+{
+  int fd;
+ 108:	55                   	push   %ebp
+ 109:	89 e5                	mov    %esp,%ebp
+ 10b:	57                   	push   %edi
+ 10c:	53                   	push   %ebx
+  int r;
+ 10d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 110:	8b 55 10             	mov    0x10(%ebp),%edx
+ 113:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 116:	89 cb                	mov    %ecx,%ebx
+ 118:	89 df                	mov    %ebx,%edi
+ 11a:	89 d1                	mov    %edx,%ecx
+ 11c:	fc                   	cld
+ 11d:	f3 aa                	rep stos %al,%es:(%edi)
+ 11f:	89 ca                	mov    %ecx,%edx
+ 121:	89 fb                	mov    %edi,%ebx
+ 123:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 126:	89 55 10             	mov    %edx,0x10(%ebp)
+
+  fd = open(n, O_RDONLY);
+  if(fd < 0)
+    return -1;
+ 129:	90                   	nop
+ 12a:	5b                   	pop    %ebx
+ 12b:	5f                   	pop    %edi
+ 12c:	5d                   	pop    %ebp
+ 12d:	c3                   	ret
+
+0000012e <strcpy>:
+{
+ 12e:	55                   	push   %ebp
+ 12f:	89 e5                	mov    %esp,%ebp
+ 131:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 134:	8b 45 08             	mov    0x8(%ebp),%eax
+ 137:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 13a:	90                   	nop
+ 13b:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 13e:	8d 42 01             	lea    0x1(%edx),%eax
+ 141:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 144:	8b 45 08             	mov    0x8(%ebp),%eax
+ 147:	8d 48 01             	lea    0x1(%eax),%ecx
+ 14a:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 14d:	0f b6 12             	movzbl (%edx),%edx
+ 150:	88 10                	mov    %dl,(%eax)
+ 152:	0f b6 00             	movzbl (%eax),%eax
+ 155:	84 c0                	test   %al,%al
+ 157:	75 e2                	jne    13b <strcpy+0xd>
+  return os;
+ 159:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 15c:	c9                   	leave
+ 15d:	c3                   	ret
+
+0000015e <strlen>:
+{
+ 15e:	55                   	push   %ebp
+ 15f:	89 e5                	mov    %esp,%ebp
+ 161:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 164:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 16b:	eb 04                	jmp    171 <strlen+0x13>
+ 16d:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 171:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 174:	8b 45 08             	mov    0x8(%ebp),%eax
+ 177:	01 d0                	add    %edx,%eax
+ 179:	0f b6 00             	movzbl (%eax),%eax
+ 17c:	84 c0                	test   %al,%al
+ 17e:	75 ed                	jne    16d <strlen+0xf>
+  return n;
+ 180:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 183:	c9                   	leave
+ 184:	c3                   	ret
+
+00000185 <memset>:
+{
+ 185:	55                   	push   %ebp
+ 186:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 188:	8b 45 10             	mov    0x10(%ebp),%eax
+ 18b:	50                   	push   %eax
+ 18c:	ff 75 0c             	push   0xc(%ebp)
+ 18f:	ff 75 08             	push   0x8(%ebp)
+ 192:	e8 71 ff ff ff       	call   108 <stosb>
+ 197:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 19a:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 19d:	c9                   	leave
+ 19e:	c3                   	ret
+
+0000019f <strchr>:
+{
+ 19f:	55                   	push   %ebp
+ 1a0:	89 e5                	mov    %esp,%ebp
+ 1a2:	83 ec 04             	sub    $0x4,%esp
+ 1a5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1a8:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 1ab:	eb 14                	jmp    1c1 <strchr+0x22>
+    if(*s == c)
+ 1ad:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b0:	0f b6 00             	movzbl (%eax),%eax
+ 1b3:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 1b6:	75 05                	jne    1bd <strchr+0x1e>
+      return (char*)s;
+ 1b8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1bb:	eb 13                	jmp    1d0 <strchr+0x31>
+  for(; *s; s++)
+ 1bd:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1c1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c4:	0f b6 00             	movzbl (%eax),%eax
+ 1c7:	84 c0                	test   %al,%al
+ 1c9:	75 e2                	jne    1ad <strchr+0xe>
+  return 0;
+ 1cb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 1d0:	c9                   	leave
+ 1d1:	c3                   	ret
+
+000001d2 <gets>:
+{
+ 1d2:	55                   	push   %ebp
+ 1d3:	89 e5                	mov    %esp,%ebp
+ 1d5:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 1d8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 1df:	eb 42                	jmp    223 <gets+0x51>
+    cc = read(0, &c, 1);
+ 1e1:	83 ec 04             	sub    $0x4,%esp
+ 1e4:	6a 01                	push   $0x1
+ 1e6:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 1e9:	50                   	push   %eax
+ 1ea:	6a 00                	push   $0x0
+ 1ec:	e8 dd 03 00 00       	call   5ce <read>
+ 1f1:	83 c4 10             	add    $0x10,%esp
+ 1f4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 1f7:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 1fb:	7e 33                	jle    230 <gets+0x5e>
+    buf[i++] = c;
+ 1fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 200:	8d 50 01             	lea    0x1(%eax),%edx
+ 203:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 206:	89 c2                	mov    %eax,%edx
+ 208:	8b 45 08             	mov    0x8(%ebp),%eax
+ 20b:	01 c2                	add    %eax,%edx
+ 20d:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 211:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 213:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 217:	3c 0a                	cmp    $0xa,%al
+ 219:	74 16                	je     231 <gets+0x5f>
+ 21b:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 21f:	3c 0d                	cmp    $0xd,%al
+ 221:	74 0e                	je     231 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 223:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 226:	83 c0 01             	add    $0x1,%eax
+ 229:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 22c:	7f b3                	jg     1e1 <gets+0xf>
+ 22e:	eb 01                	jmp    231 <gets+0x5f>
+      break;
+ 230:	90                   	nop
+  buf[i] = '\0';
+ 231:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 234:	8b 45 08             	mov    0x8(%ebp),%eax
+ 237:	01 d0                	add    %edx,%eax
+ 239:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 23c:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 23f:	c9                   	leave
+ 240:	c3                   	ret
+
+00000241 <stat>:
+{
+ 241:	55                   	push   %ebp
+ 242:	89 e5                	mov    %esp,%ebp
+ 244:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+ 247:	83 ec 08             	sub    $0x8,%esp
+ 24a:	6a 00                	push   $0x0
+ 24c:	ff 75 08             	push   0x8(%ebp)
+ 24f:	e8 a2 03 00 00       	call   5f6 <open>
+ 254:	83 c4 10             	add    $0x10,%esp
+ 257:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 25a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 25e:	79 07                	jns    267 <stat+0x26>
+    return -1;
+ 260:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 265:	eb 25                	jmp    28c <stat+0x4b>
+  r = fstat(fd, st);
+ 267:	83 ec 08             	sub    $0x8,%esp
+ 26a:	ff 75 0c             	push   0xc(%ebp)
+ 26d:	ff 75 f4             	push   -0xc(%ebp)
+ 270:	e8 99 03 00 00       	call   60e <fstat>
+ 275:	83 c4 10             	add    $0x10,%esp
+ 278:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 27b:	83 ec 0c             	sub    $0xc,%esp
+ 27e:	ff 75 f4             	push   -0xc(%ebp)
+ 281:	e8 58 03 00 00       	call   5de <close>
+ 286:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 289:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 28c:	c9                   	leave
+ 28d:	c3                   	ret
+
+0000028e <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 28e:	55                   	push   %ebp
+ 28f:	89 e5                	mov    %esp,%ebp
+ 291:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+
+  dst = vdst;
+ 294:	8b 45 08             	mov    0x8(%ebp),%eax
+ 297:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 29a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 29d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 2a0:	eb 17                	jmp    2b9 <memmove+0x2b>
+    *dst++ = *src++;
+ 2a2:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 2a5:	8d 42 01             	lea    0x1(%edx),%eax
+ 2a8:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 2ab:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2ae:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2b1:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 2b4:	0f b6 12             	movzbl (%edx),%edx
+ 2b7:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 2b9:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2bc:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 2bf:	89 55 10             	mov    %edx,0x10(%ebp)
+ 2c2:	85 c0                	test   %eax,%eax
+ 2c4:	7f dc                	jg     2a2 <memmove+0x14>
+  return vdst;
+ 2c6:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2c9:	c9                   	leave
+ 2ca:	c3                   	ret
+
+000002cb <cpuinfo>:
+ 2cb:	55                   	push   %ebp
+ 2cc:	89 e5                	mov    %esp,%ebp
+ 2ce:	56                   	push   %esi
+ 2cf:	53                   	push   %ebx
+ 2d0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d3:	ba 00 00 00 00       	mov    $0x0,%edx
+ 2d8:	89 d1                	mov    %edx,%ecx
+ 2da:	0f a2                	cpuid
+ 2dc:	89 c6                	mov    %eax,%esi
+ 2de:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2e1:	89 30                	mov    %esi,(%eax)
+ 2e3:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2e6:	89 18                	mov    %ebx,(%eax)
+ 2e8:	8b 45 14             	mov    0x14(%ebp),%eax
+ 2eb:	89 08                	mov    %ecx,(%eax)
+ 2ed:	8b 45 18             	mov    0x18(%ebp),%eax
+ 2f0:	89 10                	mov    %edx,(%eax)
+ 2f2:	90                   	nop
+ 2f3:	5b                   	pop    %ebx
+ 2f4:	5e                   	pop    %esi
+ 2f5:	5d                   	pop    %ebp
+ 2f6:	c3                   	ret
+
+000002f7 <atoi>:
+{
+ 2f7:	55                   	push   %ebp
+ 2f8:	89 e5                	mov    %esp,%ebp
+ 2fa:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+ 2fd:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 304:	eb 25                	jmp    32b <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 306:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 309:	89 d0                	mov    %edx,%eax
+ 30b:	c1 e0 02             	shl    $0x2,%eax
+ 30e:	01 d0                	add    %edx,%eax
+ 310:	01 c0                	add    %eax,%eax
+ 312:	89 c1                	mov    %eax,%ecx
+ 314:	8b 45 08             	mov    0x8(%ebp),%eax
+ 317:	8d 50 01             	lea    0x1(%eax),%edx
+ 31a:	89 55 08             	mov    %edx,0x8(%ebp)
+ 31d:	0f b6 00             	movzbl (%eax),%eax
+ 320:	0f be c0             	movsbl %al,%eax
+ 323:	01 c8                	add    %ecx,%eax
+ 325:	83 e8 30             	sub    $0x30,%eax
+ 328:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 32b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 32e:	0f b6 00             	movzbl (%eax),%eax
+ 331:	3c 2f                	cmp    $0x2f,%al
+ 333:	7e 0a                	jle    33f <atoi+0x48>
+ 335:	8b 45 08             	mov    0x8(%ebp),%eax
+ 338:	0f b6 00             	movzbl (%eax),%eax
+ 33b:	3c 39                	cmp    $0x39,%al
+ 33d:	7e c7                	jle    306 <atoi+0xf>
+  return n;
+ 33f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 342:	c9                   	leave
+ 343:	c3                   	ret
+
+00000344 <strcmp>:
+{
+ 344:	55                   	push   %ebp
+ 345:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 347:	eb 08                	jmp    351 <strcmp+0xd>
+    p++, q++;
+ 349:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 34d:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 351:	8b 45 08             	mov    0x8(%ebp),%eax
+ 354:	0f b6 00             	movzbl (%eax),%eax
+ 357:	84 c0                	test   %al,%al
+ 359:	74 10                	je     36b <strcmp+0x27>
+ 35b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 35e:	0f b6 10             	movzbl (%eax),%edx
+ 361:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 364:	0f b6 00             	movzbl (%eax),%eax
+ 367:	38 c2                	cmp    %al,%dl
+ 369:	74 de                	je     349 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 36b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 36e:	0f b6 00             	movzbl (%eax),%eax
+ 371:	0f b6 d0             	movzbl %al,%edx
+ 374:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 377:	0f b6 00             	movzbl (%eax),%eax
+ 37a:	0f b6 c0             	movzbl %al,%eax
+ 37d:	29 c2                	sub    %eax,%edx
+ 37f:	89 d0                	mov    %edx,%eax
+}
+ 381:	5d                   	pop    %ebp
+ 382:	c3                   	ret
+
+00000383 <udiv64>:
+{
+ 383:	55                   	push   %ebp
+ 384:	89 e5                	mov    %esp,%ebp
+ 386:	57                   	push   %edi
+ 387:	56                   	push   %esi
+ 388:	83 ec 38             	sub    $0x38,%esp
+ 38b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 38e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 391:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 394:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 397:	8b 45 10             	mov    0x10(%ebp),%eax
+ 39a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 39d:	8b 45 14             	mov    0x14(%ebp),%eax
+ 3a0:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  q = r = 0;
+ 3a3:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 3aa:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 3b1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 3b4:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 3b7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 3ba:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 3bd:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 3c4:	e9 85 00 00 00       	jmp    44e <udiv64+0xcb>
+    r = (r << 1) | ((n >> i) & 1);
+ 3c9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 3cc:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 3cf:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 3d3:	01 c0                	add    %eax,%eax
+ 3d5:	89 c6                	mov    %eax,%esi
+ 3d7:	89 d7                	mov    %edx,%edi
+ 3d9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 3dc:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 3df:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 3e2:	0f ad d0             	shrd   %cl,%edx,%eax
+ 3e5:	d3 ea                	shr    %cl,%edx
+ 3e7:	f6 c1 20             	test   $0x20,%cl
+ 3ea:	74 04                	je     3f0 <udiv64+0x6d>
+ 3ec:	89 d0                	mov    %edx,%eax
+ 3ee:	31 d2                	xor    %edx,%edx
+ 3f0:	83 e0 01             	and    $0x1,%eax
+ 3f3:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 3f6:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+ 3fd:	89 f0                	mov    %esi,%eax
+ 3ff:	89 fa                	mov    %edi,%edx
+ 401:	0b 45 c0             	or     -0x40(%ebp),%eax
+ 404:	0b 55 c4             	or     -0x3c(%ebp),%edx
+ 407:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 40a:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 40d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 410:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 413:	3b 45 c8             	cmp    -0x38(%ebp),%eax
+ 416:	89 d0                	mov    %edx,%eax
+ 418:	1b 45 cc             	sbb    -0x34(%ebp),%eax
+ 41b:	72 2d                	jb     44a <udiv64+0xc7>
+      r -= d;
+ 41d:	8b 45 c8             	mov    -0x38(%ebp),%eax
+ 420:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 423:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 426:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64_t)1 << i;
+ 429:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 42c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 431:	ba 00 00 00 00       	mov    $0x0,%edx
+ 436:	0f a5 c2             	shld   %cl,%eax,%edx
+ 439:	d3 e0                	shl    %cl,%eax
+ 43b:	f6 c1 20             	test   $0x20,%cl
+ 43e:	74 04                	je     444 <udiv64+0xc1>
+ 440:	89 c2                	mov    %eax,%edx
+ 442:	31 c0                	xor    %eax,%eax
+ 444:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 447:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 44a:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 44e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 452:	0f 89 71 ff ff ff    	jns    3c9 <udiv64+0x46>
+  if(rem)
+ 458:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+ 45c:	74 0e                	je     46c <udiv64+0xe9>
+    *rem = r;
+ 45e:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 461:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 464:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 467:	89 01                	mov    %eax,(%ecx)
+ 469:	89 51 04             	mov    %edx,0x4(%ecx)
+  return q;
+ 46c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 46f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 472:	83 c4 38             	add    $0x38,%esp
+ 475:	5e                   	pop    %esi
+ 476:	5f                   	pop    %edi
+ 477:	5d                   	pop    %ebp
+ 478:	c3                   	ret
+
+00000479 <crc32cinit>:
+{
+ 479:	55                   	push   %ebp
+ 47a:	89 e5                	mov    %esp,%ebp
+ 47c:	83 ec 20             	sub    $0x20,%esp
+  for(i = 0; i < 256; i++){
+ 47f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 486:	eb 4c                	jmp    4d4 <crc32cinit+0x5b>
+    r = i;
+ 488:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 48b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+ 48e:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+ 495:	eb 26                	jmp    4bd <crc32cinit+0x44>
+      r = (r >> 1) ^ ((r & 1) ? CRC32C_POLY : 0);
+ 497:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 49a:	d1 e8                	shr    %eax
+ 49c:	89 c2                	mov    %eax,%edx
+ 49e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4a1:	83 e0 01             	and    $0x1,%eax
+ 4a4:	85 c0                	test   %eax,%eax
+ 4a6:	74 07                	je     4af <crc32cinit+0x36>
+ 4a8:	b8 78 3b f6 82       	mov    $0x82f63b78,%eax
+ 4ad:	eb 05                	jmp    4b4 <crc32cinit+0x3b>
+ 4af:	b8 00 00 00 00       	mov    $0x0,%eax
+ 4b4:	31 d0                	xor    %edx,%eax
+ 4b6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+ 4b9:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+ 4bd:	83 7d f8 07          	cmpl   $0x7,-0x8(%ebp)
+ 4c1:	76 d4                	jbe    497 <crc32cinit+0x1e>
+    crc32ctab[i] = r;
+ 4c3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 4c6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 4c9:	89 14 85 60 09 00 00 	mov    %edx,0x960(,%eax,4)
+  for(i = 0; i < 256; i++){
+ 4d0:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 4d4:	81 7d fc ff 00 00 00 	cmpl   $0xff,-0x4(%ebp)
+ 4db:	76 ab                	jbe    488 <crc32cinit+0xf>
+  cpuinfo(1, &a, &b, &c, &d);
+ 4dd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 4e0:	50                   	push   %eax
+ 4e1:	8d 45 e8             	lea    -0x18(%ebp),%eax
+ 4e4:	50                   	push   %eax
+ 4e5:	8d 45 ec             	lea    -0x14(%ebp),%eax
+ 4e8:	50                   	push   %eax
+ 4e9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 4ec:	50                   	push   %eax
+ 4ed:	6a 01                	push   $0x1
+ 4ef:	e8 d7 fd ff ff       	call   2cb <cpuinfo>
+ 4f4:	83 c4 14             	add    $0x14,%esp
+  crc32chw = (c & CPUID_SSE42) != 0;
+ 4f7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 4fa:	25 00 00 10 00       	and    $0x100000,%eax
+ 4ff:	85 c0                	test   %eax,%eax
+ 501:	0f 95 c0             	setne  %al
+ 504:	0f b6 c0             	movzbl %al,%eax
+ 507:	a3 4c 09 00 00       	mov    %eax,0x94c
+}
+ 50c:	90                   	nop
+ 50d:	c9                   	leave
+ 50e:	c3                   	ret
+
+0000050f <crc32c>:
+{
+ 50f:	55                   	push   %ebp
+ 510:	89 e5                	mov    %esp,%ebp
+ 512:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s = p;
+ 515:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 518:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(crc32chw < 0)
+ 51b:	a1 4c 09 00 00       	mov    0x94c,%eax
+ 520:	85 c0                	test   %eax,%eax
+ 522:	79 05                	jns    529 <crc32c+0x1a>
+    crc32cinit();
+ 524:	e8 50 ff ff ff       	call   479 <crc32cinit>
+  crc = ~crc;
+ 529:	f7 55 08             	notl   0x8(%ebp)
+  if(crc32chw){
+ 52c:	a1 4c 09 00 00       	mov    0x94c,%eax
+ 531:	85 c0                	test   %eax,%eax
+ 533:	74 6c                	je     5a1 <crc32c+0x92>
+    for(; n >= 4; n -= 4, s += 4)
+ 535:	eb 18                	jmp    54f <crc32c+0x40>
+      asm("crc32l %1, %0" : "+r" (crc) : "rm" (*(const uint*)s));
+ 537:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 53a:	8b 10                	mov    (%eax),%edx
+ 53c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 53f:	f2 0f 38 f1 c2       	crc32  %edx,%eax
+ 544:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n >= 4; n -= 4, s += 4)
+ 547:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+ 54b:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+ 54f:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+ 553:	77 e2                	ja     537 <crc32c+0x28>
+    for(; n > 0; n--, s++)
+ 555:	eb 19                	jmp    570 <crc32c+0x61>
+      asm("crc32b %1, %0" : "+r" (crc) : "qm" (*s));
+ 557:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 55a:	0f b6 10             	movzbl (%eax),%edx
+ 55d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 560:	f2 0f 38 f0 c2       	crc32  %dl,%eax
+ 565:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+ 568:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+ 56c:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 570:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 574:	75 e1                	jne    557 <crc32c+0x48>
+ 576:	eb 2f                	jmp    5a7 <crc32c+0x98>
+      crc = crc32ctab[(crc ^ *s) & 0xff] ^ (crc >> 8);
+ 578:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 57b:	0f b6 00             	movzbl (%eax),%eax
+ 57e:	0f b6 c0             	movzbl %al,%eax
+ 581:	33 45 08             	xor    0x8(%ebp),%eax
+ 584:	0f b6 c0             	movzbl %al,%eax
+ 587:	8b 04 85 60 09 00 00 	mov    0x960(,%eax,4),%eax
+ 58e:	8b 55 08             	mov    0x8(%ebp),%edx
+ 591:	c1 ea 08             	shr    $0x8,%edx
+ 594:	31 d0                	xor    %edx,%eax
+ 596:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+ 599:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+ 59d:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 5a1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 5a5:	75 d1                	jne    578 <crc32c+0x69>
+  return ~crc;
+ 5a7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5aa:	f7 d0                	not    %eax
+}
+ 5ac:	c9                   	leave
+ 5ad:	c3                   	ret
+
+000005ae <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 5ae:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5b3:	cd 40                	int    $0x40
+ 5b5:	c3                   	ret
+
+000005b6 <exit>:
+SYSCALL(exit)
+ 5b6:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5bb:	cd 40                	int    $0x40
+ 5bd:	c3                   	ret
+
+000005be <wait>:
+SYSCALL(wait)
+ 5be:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5c3:	cd 40                	int    $0x40
+ 5c5:	c3                   	ret
+
+000005c6 <pipe>:
+SYSCALL(pipe)
+ 5c6:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5cb:	cd 40                	int    $0x40
+ 5cd:	c3                   	ret
+
+000005ce <read>:
+SYSCALL(read)
+ 5ce:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5d3:	cd 40                	int    $0x40
+ 5d5:	c3                   	ret
+
+000005d6 <write>:
+SYSCALL(write)
+ 5d6:	b8 10 00 00 00       	mov    $0x10,%eax
+ 5db:	cd 40                	int    $0x40
+ 5dd:	c3                   	ret
+
+000005de <close>:
+SYSCALL(close)
+ 5de:	b8 15 00 00 00       	mov    $0x15,%eax
+ 5e3:	cd 40                	int    $0x40
+ 5e5:	c3                   	ret
+
+000005e6 <kill>:
+SYSCALL(kill)
+ 5e6:	b8 06 00 00 00       	mov    $0x6,%eax
+ 5eb:	cd 40                	int    $0x40
+ 5ed:	c3                   	ret
+
+000005ee <exec>:
+SYSCALL(exec)
+ 5ee:	b8 07 00 00 00       	mov    $0x7,%eax
+ 5f3:	cd 40                	int    $0x40
+ 5f5:	c3                   	ret
+
+000005f6 <open>:
+SYSCALL(open)
+ 5f6:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 5fb:	cd 40                	int    $0x40
+ 5fd:	c3                   	ret
+
+000005fe <mknod>:
+SYSCALL(mknod)
+ 5fe:	b8 11 00 00 00       	mov    $0x11,%eax
+ 603:	cd 40                	int    $0x40
+ 605:	c3                   	ret
+
+00000606 <unlink>:
+SYSCALL(unlink)
+ 606:	b8 12 00 00 00       	mov    $0x12,%eax
+ 60b:	cd 40                	int    $0x40
+ 60d:	c3                   	ret
+
+0000060e <fstat>:
+SYSCALL(fstat)
+ 60e:	b8 08 00 00 00       	mov    $0x8,%eax
+ 613:	cd 40                	int    $0x40
+ 615:	c3                   	ret
+
+00000616 <link>:
+SYSCALL(link)
+ 616:	b8 13 00 00 00       	mov    $0x13,%eax
+ 61b:	cd 40                	int    $0x40
+ 61d:	c3                   	ret
+
+0000061e <mkdir>:
+SYSCALL(mkdir)
+ 61e:	b8 14 00 00 00       	mov    $0x14,%eax
+ 623:	cd 40                	int    $0x40
+ 625:	c3                   	ret
+
+00000626 <chdir>:
+SYSCALL(chdir)
+ 626:	b8 09 00 00 00       	mov    $0x9,%eax
+ 62b:	cd 40                	int    $0x40
+ 62d:	c3                   	ret
+
+0000062e <dup>:
+SYSCALL(dup)
+ 62e:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 633:	cd 40                	int    $0x40
+ 635:	c3                   	ret
+
+00000636 <getpid>:
+SYSCALL(getpid)
+ 636:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 63b:	cd 40                	int    $0x40
+ 63d:	c3                   	ret
+
+0000063e <sbrk>:
+SYSCALL(sbrk)
+ 63e:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 643:	cd 40                	int    $0x40
+ 645:	c3                   	ret
+
+00000646 <sleep>:
+SYSCALL(sleep)
+ 646:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 64b:	cd 40                	int    $0x40
+ 64d:	c3                   	ret
+
+0000064e <uptime>:
+SYSCALL(uptime)
+ 64e:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 653:	cd 40                	int    $0x40
+ 655:	c3                   	ret
+
+00000656 <arp>:
+SYSCALL(arp)
+ 656:	b8 16 00 00 00       	mov    $0x16,%eax
+ 65b:	cd 40                	int    $0x40
+ 65d:	c3                   	ret
+
+0000065e <ifstat>:
+SYSCALL(ifstat)
+ 65e:	b8 17 00 00 00       	mov    $0x17,%eax
+ 663:	cd 40                	int    $0x40
+ 665:	c3                   	ret
+
+00000666 <pcapctl>:
+SYSCALL(pcapctl)
+ 666:	b8 18 00 00 00       	mov    $0x18,%eax
+ 66b:	cd 40                	int    $0x40
+ 66d:	c3                   	ret
+
+0000066e <pcapread>:
+SYSCALL(pcapread)
+ 66e:	b8 19 00 00 00       	mov    $0x19,%eax
+ 673:	cd 40                	int    $0x40
+ 675:	c3                   	ret
+
+00000676 <bpfattach>:
+SYSCALL(bpfattach)
+ 676:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 67b:	cd 40                	int    $0x40
+ 67d:	c3                   	ret
+
+0000067e <pktgen>:
+SYSCALL(pktgen)
+ 67e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 683:	cd 40                	int    $0x40
+ 685:	c3                   	ret
+
+00000686 <reflect>:
+SYSCALL(reflect)
+ 686:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 68b:	cd 40                	int    $0x40
+ 68d:	c3                   	ret
+
+0000068e <brctl>:
+SYSCALL(brctl)
+ 68e:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 693:	cd 40                	int    $0x40
+ 695:	c3                   	ret
+
+00000696 <hostopen>:
+SYSCALL(hostopen)
+ 696:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 69b:	cd 40                	int    $0x40
+ 69d:	c3                   	ret
@@ -52,17 +52,22 @@ bzero(int dev, int bno)
 
 // Blocks.
 
-// Allocate a zeroed disk block.
+// Allocate a zeroed disk block, the first free one at or
+// after goal, so that a file that grows gets consecutive blocks,
+// or else the first free one.
 static uint
-balloc(uint dev)
+balloc(uint dev, uint goal)
 {
-  int b, bi, m;
+  int b, bi, m, start;
   struct buf *bp;
 
+  if(goal >= sb.size)
+    goal = 0;
   bp = 0;
-  for(b = 0; b < sb.size; b += BPB){
+  start = goal % BPB;
+  for(b = goal - start; ; ){
     bp = bread(dev, BBLOCK(b, sb));
-    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
+    for(bi = start; bi < BPB && b + bi < sb.size; bi++){
       m = 1 << (bi % 8);
       if((bp->data[bi/8] & m) == 0){  // Is block free?
         bp->data[bi/8] |= m;  // Mark block in use.
@@ -73,6 +78,14 @@ balloc(uint dev)
       }
     }
     brelse(bp);
+    if(goal != 0 && b + BPB >= sb.size){
+      // Wrap around for the blocks before goal.
+      b = goal = start = 0;
+      continue;
+    }
+    if((b += BPB) >= sb.size)
+      break;
+    start = 0;
   }
   panic("balloc: out of blocks");
 }
@@ -267,6 +280,8 @@ iget(uint dev, uint inum)
   ip->inum = inum;
   ip->ref = 1;
   ip->valid = 0;
+  ip->ranext = 0;
+  ip->raend = 0;
   release(&icache.lock);
 
   return ip;
@@ -366,19 +381,40 @@ iunlockput(struct inode *ip)
 // The content (data) associated with each inode is stored
 // in blocks on the disk. The first NDIRECT block numbers
 // are listed in ip->addrs[].  The next NINDIRECT blocks are
-// listed in block ip->addrs[NDIRECT].
+// listed in block ip->addrs[NDIRECT], and the next NDINDIRECT
+// in the NINDIRECT blocks listed in block ip->addrs[NDIRECT+1].
+
+// Return entry i of indirect block addr of ip, allocating a
+// block for it, next to goal, if there is none.
+static uint
+indirect(struct inode *ip, uint addr, uint i, uint goal)
+{
+  struct buf *bp;
+  uint *a;
+
+  bp = bread(ip->dev, addr);
+  a = (uint*)bp->data;
+  if(i > 0 && a[i-1])
+    goal = a[i-1] + 1;
+  if((addr = a[i]) == 0){
+    a[i] = addr = balloc(ip->dev, goal);
+    log_write(bp);
+  }
+  brelse(bp);
+  return addr;
+}
 
 // Return the disk block address of the nth block in inode ip.
-// If there is no such block, bmap allocates one.
+// If there is no such block, bmap allocates one, following the
+// block before it if it can.
 static uint
 bmap(struct inode *ip, uint bn)
 {
-  uint addr, *a;
-  struct buf *bp;
+  uint addr;
 
   if(bn < NDIRECT){
     if((addr = ip->addrs[bn]) == 0)
-      ip->addrs[bn] = addr = balloc(ip->dev);
+      ip->addrs[bn] = addr = balloc(ip->dev, bn > 0 ? ip->addrs[bn-1] + 1 : 0);
     return addr;
   }
   bn -= NDIRECT;
@@ -386,20 +422,46 @@ bmap(struct inode *ip, uint bn)
   if(bn < NINDIRECT){
     // Load indirect block, allocating if necessary.
     if((addr = ip->addrs[NDIRECT]) == 0)
-      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
-    bp = bread(ip->dev, addr);
-    a = (uint*)bp->data;
-    if((addr = a[bn]) == 0){
-      a[bn] = addr = balloc(ip->dev);
-      log_write(bp);
-    }
-    brelse(bp);
-    return addr;
+      ip->addrs[NDIRECT] = addr = balloc(ip->dev, ip->addrs[NDIRECT-1] + 1);
+    return indirect(ip, addr, bn, addr + 1);
+  }
+  bn -= NINDIRECT;
+
+  if(bn < NDINDIRECT){
+    // Load the double indirect block, then the indirect
+    // block it lists, allocating if necessary.
+    if((addr = ip->addrs[NDIRECT+1]) == 0)
+      ip->addrs[NDIRECT+1] = addr = balloc(ip->dev, 0);
+    addr = indirect(ip, addr, bn / NINDIRECT, 0);
+    return indirect(ip, addr, bn % NINDIRECT, addr + 1);
   }
 
   panic("bmap: out of range");
 }
 
+// Free the blocks listed in indirect block addr, and, if depth
+// is 2, the blocks listed in those, then addr itself.
+static void
+ifree(uint dev, uint addr, int depth)
+{
+  struct buf *bp;
+  uint *a;
+  int j;
+
+  bp = bread(dev, addr);
+  a = (uint*)bp->data;
+  for(j = 0; j < NINDIRECT; j++){
+    if(a[j] == 0)
+      continue;
+    if(depth > 1)
+      ifree(dev, a[j], depth - 1);
+    else
+      bfree(dev, a[j]);
+  }
+  brelse(bp);
+  bfree(dev, addr);
+}
+
 // Truncate inode (discard contents).
 // Only called when the inode has no links
 // to it (no directory entries referring to it)
@@ -408,9 +470,7 @@ bmap(struct inode *ip, uint bn)
 static void
 itrunc(struct inode *ip)
 {
-  int i, j;
-  struct buf *bp;
-  uint *a;
+  int i;
 
   for(i = 0; i < NDIRECT; i++){
     if(ip->addrs[i]){
@@ -419,22 +479,50 @@ itrunc(struct inode *ip)
     }
   }
 
-  if(ip->addrs[NDIRECT]){
-    bp = bread(ip->dev, ip->addrs[NDIRECT]);
-    a = (uint*)bp->data;
-    for(j = 0; j < NINDIRECT; j++){
-      if(a[j])
-        bfree(ip->dev, a[j]);
+  for(i = 1; i <= 2; i++){
+    if(ip->addrs[NDIRECT+i-1]){
+      ifree(ip->dev, ip->addrs[NDIRECT+i-1], i);
+      ip->addrs[NDIRECT+i-1] = 0;
     }
-    brelse(bp);
-    bfree(ip->dev, ip->addrs[NDIRECT]);
-    ip->addrs[NDIRECT] = 0;
   }
 
   ip->size = 0;
   iupdate(ip);
 }
 
+// Called by readi before it reads block bn of ip. If the reads of
+// ip go front to back, start reading the next NREADAHEAD blocks,
+// and again whenever half of them have been used up, so they are
+// in the cache by the time they are needed. Caller must hold
+// ip->lock.
+static void
+readahead(struct inode *ip, uint bn)
+{
+  uint blocks[NREADAHEAD];
+  uint b, end, n;
+
+  if(bn != ip->ranext && bn + 1 != ip->ranext){
+    // Not sequential; stop reading ahead until it is again.
+    ip->ranext = bn + 1;
+    ip->raend = bn + 1;
+    return;
+  }
+  ip->ranext = bn + 1;
+
+  if(ip->raend < bn + 1)
+    ip->raend = bn + 1;
+  if(ip->raend - (bn + 1) > NREADAHEAD/2)
+    return;
+
+  // Only blocks within the file, which bmap doesn't allocate.
+  end = min(bn + 1 + NREADAHEAD, (ip->size + BSIZE - 1) / BSIZE);
+  for(n = 0, b = ip->raend; b < end; b++)
+    blocks[n++] = bmap(ip, b);
+  if(n > 0)
+    breadahead(ip->dev, blocks, n);
+  ip->raend = b;
+}
+
 // Copy stat information from inode.
 // Caller must hold ip->lock.
 void
@@ -468,6 +556,7 @@ readi(struct inode *ip, char *dst, uint off, uint n)
     n = ip->size - off;
 
   for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+    readahead(ip, off/BSIZE);
     bp = bread(ip->dev, bmap(ip, off/BSIZE));
     m = min(n - tot, BSIZE - off%BSIZE);
     memmove(dst, bp->data + off%BSIZE, m);
@@ -493,7 +582,7 @@ writei(struct inode *ip, char *src, uint off, uint n)
 
   if(off > ip->size || off + n < off)
     return -1;
-  if(off + n > MAXFILE*BSIZE)
+  if((uint64)off + n > (uint64)MAXFILE*BSIZE)
     return -1;
 
   for(tot=0; tot<n; tot+=m, off+=m, src+=m){
@@ -520,18 +609,201 @@ namecmp(const char *s, const char *t)
   return strncmp(s, t, DIRSIZ);
 }
 
+// Directories of more than one block are hashed, see struct
+// dxroot. A lookup reads block 0 and the one bucket the name
+// hashes to. A full bucket is split in two, doubling the table
+// if it is the only entry pointing at the bucket. Directories
+// of one block, or larger ones without the index, are searched
+// linearly.
+
+static uint
+dxhash(char *name)
+{
+  uint h = 2166136261;
+  int i;
+
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = (h ^ (uchar)name[i]) * 16777619;
+  return h;
+}
+
+// Return block 0 of dp, locked, if dp is indexed, else 0.
+static struct buf*
+dxread(struct inode *dp)
+{
+  struct buf *bp;
+
+  if(dp->size <= BSIZE)
+    return 0;
+  bp = bread(dp->dev, bmap(dp, 0));
+  if(((struct dxroot*)bp->data)->magic != DXMAGIC){
+    brelse(bp);
+    return 0;
+  }
+  return bp;
+}
+
+// Return the block of the bucket hash h belongs in.
+static uint
+dxbucket(struct buf *rbp, uint h)
+{
+  struct dxroot *r = (struct dxroot*)rbp->data;
+
+  return DXBLK(r, h & ((1 << r->depth) - 1));
+}
+
+// Index dp, which has one full block: its entries move to a
+// new block, the only bucket, and block 0 becomes the root.
+static void
+dxindex(struct inode *dp)
+{
+  struct buf *rbp, *bp;
+  struct dxroot *r;
+  struct dirent *de;
+
+  rbp = bread(dp->dev, bmap(dp, 0));
+  bp = bread(dp->dev, bmap(dp, 1));
+  memmove(bp->data, rbp->data, BSIZE);
+  memset(rbp->data, 0, BSIZE);
+  r = (struct dxroot*)rbp->data;
+  for(de = (struct dirent*)bp->data; de < (struct dirent*)(bp->data + BSIZE); de++){
+    if(de->inum == 0)
+      continue;
+    if(namecmp(de->name, ".") == 0)
+      r->dot = *de;
+    else if(namecmp(de->name, "..") == 0)
+      r->dotdot = *de;
+    else
+      continue;
+    memset(de, 0, sizeof(*de));
+  }
+  r->magic = DXMAGIC;
+  r->depth = 0;
+  DXBLK(r, 0) = 1;
+  log_write(bp);
+  brelse(bp);
+  log_write(rbp);
+  brelse(rbp);
+  dp->size = 2*BSIZE;
+  iupdate(dp);
+}
+
+// Split the bucket hash h belongs in, moving half of its
+// entries to a new block at the end of dp. Returns -1 if the
+// bucket can't be split because the table is as large as it
+// gets and has only one entry for it.
+static int
+dxsplit(struct inode *dp, uint h)
+{
+  struct buf *rbp, *bp, *nbp;
+  struct dxroot *r;
+  struct dirent *de, *nde;
+  uint i, n, bn, nbn, mask, bit;
+
+  rbp = bread(dp->dev, bmap(dp, 0));
+  r = (struct dxroot*)rbp->data;
+  mask = (1 << r->depth) - 1;
+  bn = DXBLK(r, h & mask);
+  n = 0;
+  for(i = 0; i <= mask; i++)
+    if(DXBLK(r, i) == bn)
+      n++;
+  if(n == 1){
+    if(r->depth == DXMAXDEPTH){
+      brelse(rbp);
+      return -1;
+    }
+    for(i = 0; i <= mask; i++)
+      DXBLK(r, mask + 1 + i) = DXBLK(r, i);
+    r->depth++;
+    mask = 2*mask + 1;
+    n = 2;
+  }
+
+  // The n entries pointing at bn agree in their low bits up
+  // to bit; those with bit set now point at the new bucket.
+  bit = (mask + 1) / n;
+  nbn = dp->size / BSIZE;
+  for(i = 0; i <= mask; i++)
+    if(DXBLK(r, i) == bn && (i & bit))
+      DXBLK(r, i) = nbn;
+  log_write(rbp);
+  brelse(rbp);
+
+  bp = bread(dp->dev, bmap(dp, bn));
+  nbp = bread(dp->dev, bmap(dp, nbn));
+  nde = (struct dirent*)nbp->data;
+  for(de = (struct dirent*)bp->data; de < (struct dirent*)(bp->data + BSIZE); de++){
+    if(de->inum == 0 || (dxhash(de->name) & bit) == 0)
+      continue;
+    *nde++ = *de;
+    memset(de, 0, sizeof(*de));
+  }
+  log_write(nbp);
+  brelse(nbp);
+  log_write(bp);
+  brelse(bp);
+  dp->size = (nbn + 1) * BSIZE;
+  iupdate(dp);
+  return 0;
+}
+
+// Return the offset of a free entry in the bucket name belongs
+// in, or -1 if there is none. Splits a full bucket once: more
+// could overrun the transaction's MAXOPBLOCKS, and only names
+// whose hashes agree in their low bits fill both halves.
+static int
+dxfree(struct inode *dp, char *name)
+{
+  struct buf *bp;
+  struct dirent *de;
+  uint h, bn;
+  int split;
+
+  h = dxhash(name);
+  for(split = 0; ; split++){
+    bp = dxread(dp);
+    bn = dxbucket(bp, h);
+    brelse(bp);
+    bp = bread(dp->dev, bmap(dp, bn));
+    for(de = (struct dirent*)bp->data; de < (struct dirent*)(bp->data + BSIZE); de++){
+      if(de->inum == 0){
+        brelse(bp);
+        return bn*BSIZE + ((uchar*)de - bp->data);
+      }
+    }
+    brelse(bp);
+    if(split || dxsplit(dp, h) < 0)
+      return -1;
+  }
+}
+
 // Look for a directory entry in a directory.
 // If found, set *poff to byte offset of entry.
 struct inode*
 dirlookup(struct inode *dp, char *name, uint *poff)
 {
-  uint off, inum;
+  uint off, end, inum;
   struct dirent de;
+  struct buf *bp;
 
   if(dp->type != T_DIR)
     panic("dirlookup not DIR");
 
-  for(off = 0; off < dp->size; off += sizeof(de)){
+  off = 0;
+  end = dp->size;
+  if((bp = dxread(dp)) != 0){
+    // Only "." and "..", or the name's bucket.
+    if(namecmp(name, ".") == 0 || namecmp(name, "..") == 0)
+      end = 2*sizeof(de);
+    else {
+      off = dxbucket(bp, dxhash(name)) * BSIZE;
+      end = off + BSIZE;
+    }
+    brelse(bp);
+  }
+
+  for(; off < end; off += sizeof(de)){
     if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
       panic("dirlookup read");
     if(de.inum == 0)
@@ -549,12 +821,15 @@ dirlookup(struct inode *dp, char *name, uint *poff)
 }
 
 // Write a new directory entry (name, inum) into the directory dp.
+// Returns -1 if name is present, or if dp is indexed and there is
+// no room for name in its bucket.
 int
 dirlink(struct inode *dp, char *name, uint inum)
 {
   int off;
   struct dirent de;
   struct inode *ip;
+  struct buf *bp;
 
   // Check that name is not present.
   if((ip = dirlookup(dp, name, 0)) != 0){
@@ -563,11 +838,22 @@ dirlink(struct inode *dp, char *name, uint inum)
   }
 
   // Look for an empty dirent.
-  for(off = 0; off < dp->size; off += sizeof(de)){
-    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
-      panic("dirlink read");
-    if(de.inum == 0)
-      break;
+  if((bp = dxread(dp)) != 0){
+    brelse(bp);
+    if((off = dxfree(dp, name)) < 0)
+      return -1;
+  } else {
+    for(off = 0; off < dp->size; off += sizeof(de)){
+      if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+        panic("dirlink read");
+      if(de.inum == 0)
+        break;
+    }
+    if(off == BSIZE && dp->size == BSIZE){
+      // The first block is full; index the directory.
+      dxindex(dp);
+      off = dxfree(dp, name);
+    }
   }
 
   strncpy(de.name, name, DIRSIZ);
@@ -3,7 +3,7 @@
 
 
 #define ROOTINO 1  // root i-number
-#define BSIZE 512  // block size
+#define BSIZE 4096  // block size, one page
 
 // Disk layout:
 // [ boot block | super block | log | inode blocks |
@@ -21,9 +21,10 @@ struct superblock {
   uint bmapstart;    // Block number of first free map block
 };
 
-#define NDIRECT 12
+#define NDIRECT 11
 #define NINDIRECT (BSIZE / sizeof(uint))
-#define MAXFILE (NDIRECT + NINDIRECT)
+#define NDINDIRECT (NINDIRECT * NINDIRECT)
+#define MAXFILE (NDIRECT + NINDIRECT + NDINDIRECT)
 
 // On-disk inode structure
 struct dinode {
@@ -32,7 +33,7 @@ struct dinode {
   short minor;          // Minor device number (T_DEV only)
   short nlink;          // Number of links to inode in file system
   uint size;            // Size of file (bytes)
-  uint addrs[NDIRECT+1];   // Data block addresses
+  uint addrs[NDIRECT+2];   // Data block addresses
 };
 
 // Inodes per block.
@@ -55,3 +56,29 @@ struct dirent {
   char name[DIRSIZ];
 };
 
+// A directory that outgrows one block is indexed by a hash of the
+// entry names. Block 0 then holds "." and ".." and a table that maps
+// the low depth bits of the hash to the directory block, or bucket,
+// where the entry is. The table hides in entries with inum 0, so the
+// directory still reads as a sequence of dirents.
+#define DXMAGIC     0x7864
+#define DXPERSLOT   7
+#define DXSLOTS     (BSIZE / sizeof(struct dirent) - 3)
+#define DXMAXDEPTH  10      // 1 << DXMAXDEPTH <= DXSLOTS * DXPERSLOT
+
+struct dxroot {
+  struct dirent dot;
+  struct dirent dotdot;
+  ushort zero;          // 0, a free entry to readers
+  ushort magic;         // DXMAGIC
+  ushort depth;         // The table has 1 << depth entries
+  ushort pad[5];
+  struct {
+    ushort zero;
+    ushort blk[DXPERSLOT];
+  } tab[DXSLOTS];
+};
+
+// Table entry i of dxroot r
+#define DXBLK(r, i)   ((r)->tab[(i) / DXPERSLOT].blk[(i) % DXPERSLOT])
+
@@ -0,0 +1,1730 @@
+
+_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <grep>:
+char buf[1024];
+int match(char*, char*);
+
+void
+grep(char *pattern, int fd)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 18             	sub    $0x18,%esp
+  int n, m;
+  char *p, *q;
+
+  m = 0;
+   6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+   d:	e9 ae 00 00 00       	jmp    c0 <grep+0xc0>
+    m += n;
+  12:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  15:	01 45 f4             	add    %eax,-0xc(%ebp)
+    buf[m] = '\0';
+  18:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  1b:	05 40 15 00 00       	add    $0x1540,%eax
+  20:	c6 00 00             	movb   $0x0,(%eax)
+    p = buf;
+  23:	c7 45 f0 40 15 00 00 	movl   $0x1540,-0x10(%ebp)
+    while((q = strchr(p, '\n')) != 0){
+  2a:	eb 44                	jmp    70 <grep+0x70>
+      *q = 0;
+  2c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  2f:	c6 00 00             	movb   $0x0,(%eax)
+      if(match(pattern, p)){
+  32:	83 ec 08             	sub    $0x8,%esp
+  35:	ff 75 f0             	push   -0x10(%ebp)
+  38:	ff 75 08             	push   0x8(%ebp)
+  3b:	e8 8f 01 00 00       	call   1cf <match>
+  40:	83 c4 10             	add    $0x10,%esp
+  43:	85 c0                	test   %eax,%eax
+  45:	74 20                	je     67 <grep+0x67>
+        *q = '\n';
+  47:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  4a:	c6 00 0a             	movb   $0xa,(%eax)
+        write(1, p, q+1 - p);
+  4d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  50:	83 c0 01             	add    $0x1,%eax
+  53:	2b 45 f0             	sub    -0x10(%ebp),%eax
+  56:	83 ec 04             	sub    $0x4,%esp
+  59:	50                   	push   %eax
+  5a:	ff 75 f0             	push   -0x10(%ebp)
+  5d:	6a 01                	push   $0x1
+  5f:	e8 95 07 00 00       	call   7f9 <write>
+  64:	83 c4 10             	add    $0x10,%esp
+      }
+      p = q+1;
+  67:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  6a:	83 c0 01             	add    $0x1,%eax
+  6d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    while((q = strchr(p, '\n')) != 0){
+  70:	83 ec 08             	sub    $0x8,%esp
+  73:	6a 0a                	push   $0xa
+  75:	ff 75 f0             	push   -0x10(%ebp)
+  78:	e8 45 03 00 00       	call   3c2 <strchr>
+  7d:	83 c4 10             	add    $0x10,%esp
+  80:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  83:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+  87:	75 a3                	jne    2c <grep+0x2c>
+    }
+    if(p == buf)
+  89:	81 7d f0 40 15 00 00 	cmpl   $0x1540,-0x10(%ebp)
+  90:	75 07                	jne    99 <grep+0x99>
+      m = 0;
+  92:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(m > 0){
+  99:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  9d:	7e 21                	jle    c0 <grep+0xc0>
+      m -= p - buf;
+  9f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  a2:	2d 40 15 00 00       	sub    $0x1540,%eax
+  a7:	29 45 f4             	sub    %eax,-0xc(%ebp)
+      memmove(buf, p, m);
+  aa:	83 ec 04             	sub    $0x4,%esp
+  ad:	ff 75 f4             	push   -0xc(%ebp)
+  b0:	ff 75 f0             	push   -0x10(%ebp)
+  b3:	68 40 15 00 00       	push   $0x1540
+  b8:	e8 f4 03 00 00       	call   4b1 <memmove>
+  bd:	83 c4 10             	add    $0x10,%esp
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+  c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  c3:	ba ff 03 00 00       	mov    $0x3ff,%edx
+  c8:	29 c2                	sub    %eax,%edx
+  ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  cd:	05 40 15 00 00       	add    $0x1540,%eax
+  d2:	83 ec 04             	sub    $0x4,%esp
+  d5:	52                   	push   %edx
+  d6:	50                   	push   %eax
+  d7:	ff 75 0c             	push   0xc(%ebp)
+  da:	e8 12 07 00 00       	call   7f1 <read>
+  df:	83 c4 10             	add    $0x10,%esp
+  e2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  e5:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+  e9:	0f 8f 23 ff ff ff    	jg     12 <grep+0x12>
+    }
+  }
+}
+  ef:	90                   	nop
+  f0:	90                   	nop
+  f1:	c9                   	leave
+  f2:	c3                   	ret
+
+000000f3 <main>:
+
+int
+main(int argc, char *argv[])
+{
+  f3:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  f7:	83 e4 f0             	and    $0xfffffff0,%esp
+  fa:	ff 71 fc             	push   -0x4(%ecx)
+  fd:	55                   	push   %ebp
+  fe:	89 e5                	mov    %esp,%ebp
+ 100:	53                   	push   %ebx
+ 101:	51                   	push   %ecx
+ 102:	83 ec 10             	sub    $0x10,%esp
+ 105:	89 cb                	mov    %ecx,%ebx
+  int fd, i;
+  char *pattern;
+
+  if(argc <= 1){
+ 107:	83 3b 01             	cmpl   $0x1,(%ebx)
+ 10a:	7f 17                	jg     123 <main+0x30>
+    printf(2, "usage: grep pattern [file ...]\n");
+ 10c:	83 ec 08             	sub    $0x8,%esp
+ 10f:	68 70 0d 00 00       	push   $0xd70
+ 114:	6a 02                	push   $0x2
+ 116:	e8 7a 08 00 00       	call   995 <printf>
+ 11b:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 11e:	e8 b6 06 00 00       	call   7d9 <exit>
+  }
+  pattern = argv[1];
+ 123:	8b 43 04             	mov    0x4(%ebx),%eax
+ 126:	8b 40 04             	mov    0x4(%eax),%eax
+ 129:	89 45 f0             	mov    %eax,-0x10(%ebp)
+
+  if(argc <= 2){
+ 12c:	83 3b 02             	cmpl   $0x2,(%ebx)
+ 12f:	7f 15                	jg     146 <main+0x53>
+    grep(pattern, 0);
+ 131:	83 ec 08             	sub    $0x8,%esp
+ 134:	6a 00                	push   $0x0
+ 136:	ff 75 f0             	push   -0x10(%ebp)
+ 139:	e8 c2 fe ff ff       	call   0 <grep>
+ 13e:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 141:	e8 93 06 00 00       	call   7d9 <exit>
+  }
+
+  for(i = 2; i < argc; i++){
+ 146:	c7 45 f4 02 00 00 00 	movl   $0x2,-0xc(%ebp)
+ 14d:	eb 74                	jmp    1c3 <main+0xd0>
+    if((fd = open(argv[i], 0)) < 0){
+ 14f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 152:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 159:	8b 43 04             	mov    0x4(%ebx),%eax
+ 15c:	01 d0                	add    %edx,%eax
+ 15e:	8b 00                	mov    (%eax),%eax
+ 160:	83 ec 08             	sub    $0x8,%esp
+ 163:	6a 00                	push   $0x0
+ 165:	50                   	push   %eax
+ 166:	e8 ae 06 00 00       	call   819 <open>
+ 16b:	83 c4 10             	add    $0x10,%esp
+ 16e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 171:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 175:	79 29                	jns    1a0 <main+0xad>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+ 177:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 17a:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 181:	8b 43 04             	mov    0x4(%ebx),%eax
+ 184:	01 d0                	add    %edx,%eax
+ 186:	8b 00                	mov    (%eax),%eax
+ 188:	83 ec 04             	sub    $0x4,%esp
+ 18b:	50                   	push   %eax
+ 18c:	68 90 0d 00 00       	push   $0xd90
+ 191:	6a 01                	push   $0x1
+ 193:	e8 fd 07 00 00       	call   995 <printf>
+ 198:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 19b:	e8 39 06 00 00       	call   7d9 <exit>
+    }
+    grep(pattern, fd);
+ 1a0:	83 ec 08             	sub    $0x8,%esp
+ 1a3:	ff 75 ec             	push   -0x14(%ebp)
+ 1a6:	ff 75 f0             	push   -0x10(%ebp)
+ 1a9:	e8 52 fe ff ff       	call   0 <grep>
+ 1ae:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+ 1b1:	83 ec 0c             	sub    $0xc,%esp
+ 1b4:	ff 75 ec             	push   -0x14(%ebp)
+ 1b7:	e8 45 06 00 00       	call   801 <close>
+ 1bc:	83 c4 10             	add    $0x10,%esp
+  for(i = 2; i < argc; i++){
+ 1bf:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 1c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1c6:	3b 03                	cmp    (%ebx),%eax
+ 1c8:	7c 85                	jl     14f <main+0x5c>
+  }
+  exit();
+ 1ca:	e8 0a 06 00 00       	call   7d9 <exit>
+
+000001cf <match>:
+int matchhere(char*, char*);
+int matchstar(int, char*, char*);
+
+int
+match(char *re, char *text)
+{
+ 1cf:	55                   	push   %ebp
+ 1d0:	89 e5                	mov    %esp,%ebp
+ 1d2:	83 ec 08             	sub    $0x8,%esp
+  if(re[0] == '^')
+ 1d5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d8:	0f b6 00             	movzbl (%eax),%eax
+ 1db:	3c 5e                	cmp    $0x5e,%al
+ 1dd:	75 17                	jne    1f6 <match+0x27>
+    return matchhere(re+1, text);
+ 1df:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e2:	83 c0 01             	add    $0x1,%eax
+ 1e5:	83 ec 08             	sub    $0x8,%esp
+ 1e8:	ff 75 0c             	push   0xc(%ebp)
+ 1eb:	50                   	push   %eax
+ 1ec:	e8 38 00 00 00       	call   229 <matchhere>
+ 1f1:	83 c4 10             	add    $0x10,%esp
+ 1f4:	eb 31                	jmp    227 <match+0x58>
+  do{  // must look at empty string
+    if(matchhere(re, text))
+ 1f6:	83 ec 08             	sub    $0x8,%esp
+ 1f9:	ff 75 0c             	push   0xc(%ebp)
+ 1fc:	ff 75 08             	push   0x8(%ebp)
+ 1ff:	e8 25 00 00 00       	call   229 <matchhere>
+ 204:	83 c4 10             	add    $0x10,%esp
+ 207:	85 c0                	test   %eax,%eax
+ 209:	74 07                	je     212 <match+0x43>
+      return 1;
+ 20b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 210:	eb 15                	jmp    227 <match+0x58>
+  }while(*text++ != '\0');
+ 212:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 215:	8d 50 01             	lea    0x1(%eax),%edx
+ 218:	89 55 0c             	mov    %edx,0xc(%ebp)
+ 21b:	0f b6 00             	movzbl (%eax),%eax
+ 21e:	84 c0                	test   %al,%al
+ 220:	75 d4                	jne    1f6 <match+0x27>
+  return 0;
+ 222:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 227:	c9                   	leave
+ 228:	c3                   	ret
+
+00000229 <matchhere>:
+
+// matchhere: search for re at beginning of text
+int matchhere(char *re, char *text)
+{
+ 229:	55                   	push   %ebp
+ 22a:	89 e5                	mov    %esp,%ebp
+ 22c:	83 ec 08             	sub    $0x8,%esp
+  if(re[0] == '\0')
+ 22f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 232:	0f b6 00             	movzbl (%eax),%eax
+ 235:	84 c0                	test   %al,%al
+ 237:	75 0a                	jne    243 <matchhere+0x1a>
+    return 1;
+ 239:	b8 01 00 00 00       	mov    $0x1,%eax
+ 23e:	e9 99 00 00 00       	jmp    2dc <matchhere+0xb3>
+  if(re[1] == '*')
+ 243:	8b 45 08             	mov    0x8(%ebp),%eax
+ 246:	83 c0 01             	add    $0x1,%eax
+ 249:	0f b6 00             	movzbl (%eax),%eax
+ 24c:	3c 2a                	cmp    $0x2a,%al
+ 24e:	75 21                	jne    271 <matchhere+0x48>
+    return matchstar(re[0], re+2, text);
+ 250:	8b 45 08             	mov    0x8(%ebp),%eax
+ 253:	8d 50 02             	lea    0x2(%eax),%edx
+ 256:	8b 45 08             	mov    0x8(%ebp),%eax
+ 259:	0f b6 00             	movzbl (%eax),%eax
+ 25c:	0f be c0             	movsbl %al,%eax
+ 25f:	83 ec 04             	sub    $0x4,%esp
+ 262:	ff 75 0c             	push   0xc(%ebp)
+ 265:	52                   	push   %edx
+ 266:	50                   	push   %eax
+ 267:	e8 72 00 00 00       	call   2de <matchstar>
+ 26c:	83 c4 10             	add    $0x10,%esp
+ 26f:	eb 6b                	jmp    2dc <matchhere+0xb3>
+  if(re[0] == '$' && re[1] == '\0')
+ 271:	8b 45 08             	mov    0x8(%ebp),%eax
+ 274:	0f b6 00             	movzbl (%eax),%eax
+ 277:	3c 24                	cmp    $0x24,%al
+ 279:	75 1d                	jne    298 <matchhere+0x6f>
+ 27b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 27e:	83 c0 01             	add    $0x1,%eax
+ 281:	0f b6 00             	movzbl (%eax),%eax
+ 284:	84 c0                	test   %al,%al
+ 286:	75 10                	jne    298 <matchhere+0x6f>
+    return *text == '\0';
+ 288:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 28b:	0f b6 00             	movzbl (%eax),%eax
+ 28e:	84 c0                	test   %al,%al
+ 290:	0f 94 c0             	sete   %al
+ 293:	0f b6 c0             	movzbl %al,%eax
+ 296:	eb 44                	jmp    2dc <matchhere+0xb3>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 298:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 29b:	0f b6 00             	movzbl (%eax),%eax
+ 29e:	84 c0                	test   %al,%al
+ 2a0:	74 35                	je     2d7 <matchhere+0xae>
+ 2a2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a5:	0f b6 00             	movzbl (%eax),%eax
+ 2a8:	3c 2e                	cmp    $0x2e,%al
+ 2aa:	74 10                	je     2bc <matchhere+0x93>
+ 2ac:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2af:	0f b6 10             	movzbl (%eax),%edx
+ 2b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2b5:	0f b6 00             	movzbl (%eax),%eax
+ 2b8:	38 c2                	cmp    %al,%dl
+ 2ba:	75 1b                	jne    2d7 <matchhere+0xae>
+    return matchhere(re+1, text+1);
+ 2bc:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2bf:	8d 50 01             	lea    0x1(%eax),%edx
+ 2c2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c5:	83 c0 01             	add    $0x1,%eax
+ 2c8:	83 ec 08             	sub    $0x8,%esp
+ 2cb:	52                   	push   %edx
+ 2cc:	50                   	push   %eax
+ 2cd:	e8 57 ff ff ff       	call   229 <matchhere>
+ 2d2:	83 c4 10             	add    $0x10,%esp
+ 2d5:	eb 05                	jmp    2dc <matchhere+0xb3>
+  return 0;
+ 2d7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 2dc:	c9                   	leave
+ 2dd:	c3                   	ret
+
+000002de <matchstar>:
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+{
+ 2de:	55                   	push   %ebp
+ 2df:	89 e5                	mov    %esp,%ebp
+ 2e1:	83 ec 08             	sub    $0x8,%esp
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+ 2e4:	83 ec 08             	sub    $0x8,%esp
+ 2e7:	ff 75 10             	push   0x10(%ebp)
+ 2ea:	ff 75 0c             	push   0xc(%ebp)
+ 2ed:	e8 37 ff ff ff       	call   229 <matchhere>
+ 2f2:	83 c4 10             	add    $0x10,%esp
+ 2f5:	85 c0                	test   %eax,%eax
+ 2f7:	74 07                	je     300 <matchstar+0x22>
+      return 1;
+ 2f9:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2fe:	eb 29                	jmp    329 <matchstar+0x4b>
+  }while(*text!='\0' && (*text++==c || c=='.'));
+ 300:	8b 45 10             	mov    0x10(%ebp),%eax
+ 303:	0f b6 00             	movzbl (%eax),%eax
+ 306:	84 c0                	test   %al,%al
+ 308:	74 1a                	je     324 <matchstar+0x46>
+ 30a:	8b 45 10             	mov    0x10(%ebp),%eax
+ 30d:	8d 50 01             	lea    0x1(%eax),%edx
+ 310:	89 55 10             	mov    %edx,0x10(%ebp)
+ 313:	0f b6 00             	movzbl (%eax),%eax
+ 316:	0f be c0             	movsbl %al,%eax
+ 319:	39 45 08             	cmp    %eax,0x8(%ebp)
+ 31c:	74 c6                	je     2e4 <matchstar+0x6>
+ 31e:	83 7d 08 2e          	cmpl   $0x2e,0x8(%ebp)
+ 322:	74 c0                	je     2e4 <matchstar+0x6>
+  return 0;
+ 324:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 329:	c9                   	leave
+ 32a:	c3                   	ret
+
+0000032b <stosb>:
+}
+
+int
+stat(char *n, struct stat *st)
+{
+  int fd;
+ 32b:	55                   	push   %ebp
+ 32c:	89 e5                	mov    %esp,%ebp
+ 32e:	57                   	push   %edi
+ 32f:	53                   	push   %ebx
+  int r;
+ 330:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 333:	8b 55 10             	mov    0x10(%ebp),%edx
+ 336:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 339:	89 cb                	mov    %ecx,%ebx
+ 33b:	89 df                	mov    %ebx,%edi
+ 33d:	89 d1                	mov    %edx,%ecx
+ 33f:	fc                   	cld
+ 340:	f3 aa                	rep stos %al,%es:(%edi)
+ 342:	89 ca                	mov    %ecx,%edx
+ 344:	89 fb                	mov    %edi,%ebx
+ 346:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 349:	89 55 10             	mov    %edx,0x10(%ebp)
+
+  fd = open(n, O_RDONLY);
+  if(fd < 0)
+    return -1;
+ 34c:	90                   	nop
+ 34d:	5b                   	pop    %ebx
+ 34e:	5f                   	pop    %edi
+ 34f:	5d                   	pop    %ebp
+ 350:	c3                   	ret
+
+00000351 <strcpy>:
+{
+ 351:	55                   	push   %ebp
+ 352:	89 e5                	mov    %esp,%ebp
+ 354:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 357:	8b 45 08             	mov    0x8(%ebp),%eax
+ 35a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 35d:	90                   	nop
+ 35e:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 361:	8d 42 01             	lea    0x1(%edx),%eax
+ 364:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 367:	8b 45 08             	mov    0x8(%ebp),%eax
+ 36a:	8d 48 01             	lea    0x1(%eax),%ecx
+ 36d:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 370:	0f b6 12             	movzbl (%edx),%edx
+ 373:	88 10                	mov    %dl,(%eax)
+ 375:	0f b6 00             	movzbl (%eax),%eax
+ 378:	84 c0                	test   %al,%al
+ 37a:	75 e2                	jne    35e <strcpy+0xd>
+  return os;
+ 37c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 37f:	c9                   	leave
+ 380:	c3                   	ret
+
+00000381 <strlen>:
+{
+ 381:	55                   	push   %ebp
+ 382:	89 e5                	mov    %esp,%ebp
+ 384:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 387:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 38e:	eb 04                	jmp    394 <strlen+0x13>
+ 390:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 394:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 397:	8b 45 08             	mov    0x8(%ebp),%eax
+ 39a:	01 d0                	add    %edx,%eax
+ 39c:	0f b6 00             	movzbl (%eax),%eax
+ 39f:	84 c0                	test   %al,%al
+ 3a1:	75 ed                	jne    390 <strlen+0xf>
+  return n;
+ 3a3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3a6:	c9                   	leave
+ 3a7:	c3                   	ret
+
+000003a8 <memset>:
+{
+ 3a8:	55                   	push   %ebp
+ 3a9:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 3ab:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3ae:	50                   	push   %eax
+ 3af:	ff 75 0c             	push   0xc(%ebp)
+ 3b2:	ff 75 08             	push   0x8(%ebp)
+ 3b5:	e8 71 ff ff ff       	call   32b <stosb>
+ 3ba:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 3bd:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3c0:	c9                   	leave
+ 3c1:	c3                   	ret
+
+000003c2 <strchr>:
+{
+ 3c2:	55                   	push   %ebp
+ 3c3:	89 e5                	mov    %esp,%ebp
+ 3c5:	83 ec 04             	sub    $0x4,%esp
+ 3c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3cb:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 3ce:	eb 14                	jmp    3e4 <strchr+0x22>
+    if(*s == c)
+ 3d0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d3:	0f b6 00             	movzbl (%eax),%eax
+ 3d6:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 3d9:	75 05                	jne    3e0 <strchr+0x1e>
+      return (char*)s;
+ 3db:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3de:	eb 13                	jmp    3f3 <strchr+0x31>
+  for(; *s; s++)
+ 3e0:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 3e4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e7:	0f b6 00             	movzbl (%eax),%eax
+ 3ea:	84 c0                	test   %al,%al
+ 3ec:	75 e2                	jne    3d0 <strchr+0xe>
+  return 0;
+ 3ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 3f3:	c9                   	leave
+ 3f4:	c3                   	ret
+
+000003f5 <gets>:
+{
+ 3f5:	55                   	push   %ebp
+ 3f6:	89 e5                	mov    %esp,%ebp
+ 3f8:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 3fb:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 402:	eb 42                	jmp    446 <gets+0x51>
+    cc = read(0, &c, 1);
+ 404:	83 ec 04             	sub    $0x4,%esp
+ 407:	6a 01                	push   $0x1
+ 409:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 40c:	50                   	push   %eax
+ 40d:	6a 00                	push   $0x0
+ 40f:	e8 dd 03 00 00       	call   7f1 <read>
+ 414:	83 c4 10             	add    $0x10,%esp
+ 417:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 41a:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 41e:	7e 33                	jle    453 <gets+0x5e>
+    buf[i++] = c;
+ 420:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 423:	8d 50 01             	lea    0x1(%eax),%edx
+ 426:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 429:	89 c2                	mov    %eax,%edx
+ 42b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 42e:	01 c2                	add    %eax,%edx
+ 430:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 434:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 436:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 43a:	3c 0a                	cmp    $0xa,%al
+ 43c:	74 16                	je     454 <gets+0x5f>
+ 43e:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 442:	3c 0d                	cmp    $0xd,%al
+ 444:	74 0e                	je     454 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 446:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 449:	83 c0 01             	add    $0x1,%eax
+ 44c:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 44f:	7f b3                	jg     404 <gets+0xf>
+ 451:	eb 01                	jmp    454 <gets+0x5f>
+      break;
+ 453:	90                   	nop
+  buf[i] = '\0';
+ 454:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 457:	8b 45 08             	mov    0x8(%ebp),%eax
+ 45a:	01 d0                	add    %edx,%eax
+ 45c:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 45f:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 462:	c9                   	leave
+ 463:	c3                   	ret
+
+00000464 <stat>:
+{
+ 464:	55                   	push   %ebp
+ 465:	89 e5                	mov    %esp,%ebp
+ 467:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+ 46a:	83 ec 08             	sub    $0x8,%esp
+ 46d:	6a 00                	push   $0x0
+ 46f:	ff 75 08             	push   0x8(%ebp)
+ 472:	e8 a2 03 00 00       	call   819 <open>
+ 477:	83 c4 10             	add    $0x10,%esp
+ 47a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 47d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 481:	79 07                	jns    48a <stat+0x26>
+    return -1;
+ 483:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 488:	eb 25                	jmp    4af <stat+0x4b>
+  r = fstat(fd, st);
+ 48a:	83 ec 08             	sub    $0x8,%esp
+ 48d:	ff 75 0c             	push   0xc(%ebp)
+ 490:	ff 75 f4             	push   -0xc(%ebp)
+ 493:	e8 99 03 00 00       	call   831 <fstat>
+ 498:	83 c4 10             	add    $0x10,%esp
+ 49b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 49e:	83 ec 0c             	sub    $0xc,%esp
+ 4a1:	ff 75 f4             	push   -0xc(%ebp)
+ 4a4:	e8 58 03 00 00       	call   801 <close>
+ 4a9:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 4ac:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 4af:	c9                   	leave
+ 4b0:	c3                   	ret
+
+000004b1 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 4b1:	55                   	push   %ebp
+ 4b2:	89 e5                	mov    %esp,%ebp
+ 4b4:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+
+  dst = vdst;
+ 4b7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4ba:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 4bd:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4c0:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 4c3:	eb 17                	jmp    4dc <memmove+0x2b>
+    *dst++ = *src++;
+ 4c5:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 4c8:	8d 42 01             	lea    0x1(%edx),%eax
+ 4cb:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 4ce:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 4d1:	8d 48 01             	lea    0x1(%eax),%ecx
+ 4d4:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 4d7:	0f b6 12             	movzbl (%edx),%edx
+ 4da:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 4dc:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4df:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 4e2:	89 55 10             	mov    %edx,0x10(%ebp)
+ 4e5:	85 c0                	test   %eax,%eax
+ 4e7:	7f dc                	jg     4c5 <memmove+0x14>
+  return vdst;
+ 4e9:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 4ec:	c9                   	leave
+ 4ed:	c3                   	ret
+
+000004ee <cpuinfo>:
+ 4ee:	55                   	push   %ebp
+ 4ef:	89 e5                	mov    %esp,%ebp
+ 4f1:	56                   	push   %esi
+ 4f2:	53                   	push   %ebx
+ 4f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4f6:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4fb:	89 d1                	mov    %edx,%ecx
+ 4fd:	0f a2                	cpuid
+ 4ff:	89 c6                	mov    %eax,%esi
+ 501:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 504:	89 30                	mov    %esi,(%eax)
+ 506:	8b 45 10             	mov    0x10(%ebp),%eax
+ 509:	89 18                	mov    %ebx,(%eax)
+ 50b:	8b 45 14             	mov    0x14(%ebp),%eax
+ 50e:	89 08                	mov    %ecx,(%eax)
+ 510:	8b 45 18             	mov    0x18(%ebp),%eax
+ 513:	89 10                	mov    %edx,(%eax)
+ 515:	90                   	nop
+ 516:	5b                   	pop    %ebx
+ 517:	5e                   	pop    %esi
+ 518:	5d                   	pop    %ebp
+ 519:	c3                   	ret
+
+0000051a <atoi>:
+{
+ 51a:	55                   	push   %ebp
+ 51b:	89 e5                	mov    %esp,%ebp
+ 51d:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+ 520:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 527:	eb 25                	jmp    54e <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 529:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 52c:	89 d0                	mov    %edx,%eax
+ 52e:	c1 e0 02             	shl    $0x2,%eax
+ 531:	01 d0                	add    %edx,%eax
+ 533:	01 c0                	add    %eax,%eax
+ 535:	89 c1                	mov    %eax,%ecx
+ 537:	8b 45 08             	mov    0x8(%ebp),%eax
+ 53a:	8d 50 01             	lea    0x1(%eax),%edx
+ 53d:	89 55 08             	mov    %edx,0x8(%ebp)
+ 540:	0f b6 00             	movzbl (%eax),%eax
+ 543:	0f be c0             	movsbl %al,%eax
+ 546:	01 c8                	add    %ecx,%eax
+ 548:	83 e8 30             	sub    $0x30,%eax
+ 54b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 54e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 551:	0f b6 00             	movzbl (%eax),%eax
+ 554:	3c 2f                	cmp    $0x2f,%al
+ 556:	7e 0a                	jle    562 <atoi+0x48>
+ 558:	8b 45 08             	mov    0x8(%ebp),%eax
+ 55b:	0f b6 00             	movzbl (%eax),%eax
+ 55e:	3c 39                	cmp    $0x39,%al
+ 560:	7e c7                	jle    529 <atoi+0xf>
+  return n;
+ 562:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 565:	c9                   	leave
+ 566:	c3                   	ret
+
+00000567 <strcmp>:
+{
+ 567:	55                   	push   %ebp
+ 568:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 56a:	eb 08                	jmp    574 <strcmp+0xd>
+    p++, q++;
+ 56c:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 570:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 574:	8b 45 08             	mov    0x8(%ebp),%eax
+ 577:	0f b6 00             	movzbl (%eax),%eax
+ 57a:	84 c0                	test   %al,%al
+ 57c:	74 10                	je     58e <strcmp+0x27>
+ 57e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 581:	0f b6 10             	movzbl (%eax),%edx
+ 584:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 587:	0f b6 00             	movzbl (%eax),%eax
+ 58a:	38 c2                	cmp    %al,%dl
+ 58c:	74 de                	je     56c <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 58e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 591:	0f b6 00             	movzbl (%eax),%eax
+ 594:	0f b6 d0             	movzbl %al,%edx
+ 597:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 59a:	0f b6 00             	movzbl (%eax),%eax
+ 59d:	0f b6 c0             	movzbl %al,%eax
+ 5a0:	29 c2                	sub    %eax,%edx
+ 5a2:	89 d0                	mov    %edx,%eax
+}
+ 5a4:	5d                   	pop    %ebp
+ 5a5:	c3                   	ret
+
+000005a6 <udiv64>:
+{
+ 5a6:	55                   	push   %ebp
+ 5a7:	89 e5                	mov    %esp,%ebp
+ 5a9:	57                   	push   %edi
+ 5aa:	56                   	push   %esi
+ 5ab:	83 ec 38             	sub    $0x38,%esp
+ 5ae:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5b1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 5b4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5b7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 5ba:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5bd:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 5c0:	8b 45 14             	mov    0x14(%ebp),%eax
+ 5c3:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  q = r = 0;
+ 5c6:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 5cd:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 5d4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5d7:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 5da:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 5dd:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 5e0:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 5e7:	e9 85 00 00 00       	jmp    671 <udiv64+0xcb>
+    r = (r << 1) | ((n >> i) & 1);
+ 5ec:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5ef:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 5f2:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 5f6:	01 c0                	add    %eax,%eax
+ 5f8:	89 c6                	mov    %eax,%esi
+ 5fa:	89 d7                	mov    %edx,%edi
+ 5fc:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 5ff:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 602:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 605:	0f ad d0             	shrd   %cl,%edx,%eax
+ 608:	d3 ea                	shr    %cl,%edx
+ 60a:	f6 c1 20             	test   $0x20,%cl
+ 60d:	74 04                	je     613 <udiv64+0x6d>
+ 60f:	89 d0                	mov    %edx,%eax
+ 611:	31 d2                	xor    %edx,%edx
+ 613:	83 e0 01             	and    $0x1,%eax
+ 616:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 619:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+ 620:	89 f0                	mov    %esi,%eax
+ 622:	89 fa                	mov    %edi,%edx
+ 624:	0b 45 c0             	or     -0x40(%ebp),%eax
+ 627:	0b 55 c4             	or     -0x3c(%ebp),%edx
+ 62a:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 62d:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 630:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 633:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 636:	3b 45 c8             	cmp    -0x38(%ebp),%eax
+ 639:	89 d0                	mov    %edx,%eax
+ 63b:	1b 45 cc             	sbb    -0x34(%ebp),%eax
+ 63e:	72 2d                	jb     66d <udiv64+0xc7>
+      r -= d;
+ 640:	8b 45 c8             	mov    -0x38(%ebp),%eax
+ 643:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 646:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 649:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64_t)1 << i;
+ 64c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 64f:	b8 01 00 00 00       	mov    $0x1,%eax
+ 654:	ba 00 00 00 00       	mov    $0x0,%edx
+ 659:	0f a5 c2             	shld   %cl,%eax,%edx
+ 65c:	d3 e0                	shl    %cl,%eax
+ 65e:	f6 c1 20             	test   $0x20,%cl
+ 661:	74 04                	je     667 <udiv64+0xc1>
+ 663:	89 c2                	mov    %eax,%edx
+ 665:	31 c0                	xor    %eax,%eax
+ 667:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 66a:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 66d:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 671:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 675:	0f 89 71 ff ff ff    	jns    5ec <udiv64+0x46>
+  if(rem)
+ 67b:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+ 67f:	74 0e                	je     68f <udiv64+0xe9>
+    *rem = r;
+ 681:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 684:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 687:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 68a:	89 01                	mov    %eax,(%ecx)
+ 68c:	89 51 04             	mov    %edx,0x4(%ecx)
+  return q;
+ 68f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 692:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 695:	83 c4 38             	add    $0x38,%esp
+ 698:	5e                   	pop    %esi
+ 699:	5f                   	pop    %edi
+ 69a:	5d                   	pop    %ebp
+ 69b:	c3                   	ret
+
+0000069c <crc32cinit>:
+{
+ 69c:	55                   	push   %ebp
+ 69d:	89 e5                	mov    %esp,%ebp
+ 69f:	83 ec 20             	sub    $0x20,%esp
+  for(i = 0; i < 256; i++){
+ 6a2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 6a9:	eb 4c                	jmp    6f7 <crc32cinit+0x5b>
+    r = i;
+ 6ab:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6ae:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+ 6b1:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+ 6b8:	eb 26                	jmp    6e0 <crc32cinit+0x44>
+      r = (r >> 1) ^ ((r & 1) ? CRC32C_POLY : 0);
+ 6ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6bd:	d1 e8                	shr    %eax
+ 6bf:	89 c2                	mov    %eax,%edx
+ 6c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6c4:	83 e0 01             	and    $0x1,%eax
+ 6c7:	85 c0                	test   %eax,%eax
+ 6c9:	74 07                	je     6d2 <crc32cinit+0x36>
+ 6cb:	b8 78 3b f6 82       	mov    $0x82f63b78,%eax
+ 6d0:	eb 05                	jmp    6d7 <crc32cinit+0x3b>
+ 6d2:	b8 00 00 00 00       	mov    $0x0,%eax
+ 6d7:	31 d0                	xor    %edx,%eax
+ 6d9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+ 6dc:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+ 6e0:	83 7d f8 07          	cmpl   $0x7,-0x8(%ebp)
+ 6e4:	76 d4                	jbe    6ba <crc32cinit+0x1e>
+    crc32ctab[i] = r;
+ 6e6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6e9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 6ec:	89 14 85 20 11 00 00 	mov    %edx,0x1120(,%eax,4)
+  for(i = 0; i < 256; i++){
+ 6f3:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 6f7:	81 7d fc ff 00 00 00 	cmpl   $0xff,-0x4(%ebp)
+ 6fe:	76 ab                	jbe    6ab <crc32cinit+0xf>
+  cpuinfo(1, &a, &b, &c, &d);
+ 700:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 703:	50                   	push   %eax
+ 704:	8d 45 e8             	lea    -0x18(%ebp),%eax
+ 707:	50                   	push   %eax
+ 708:	8d 45 ec             	lea    -0x14(%ebp),%eax
+ 70b:	50                   	push   %eax
+ 70c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 70f:	50                   	push   %eax
+ 710:	6a 01                	push   $0x1
+ 712:	e8 d7 fd ff ff       	call   4ee <cpuinfo>
+ 717:	83 c4 14             	add    $0x14,%esp
+  crc32chw = (c & CPUID_SSE42) != 0;
+ 71a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 71d:	25 00 00 10 00       	and    $0x100000,%eax
+ 722:	85 c0                	test   %eax,%eax
+ 724:	0f 95 c0             	setne  %al
+ 727:	0f b6 c0             	movzbl %al,%eax
+ 72a:	a3 08 11 00 00       	mov    %eax,0x1108
+}
+ 72f:	90                   	nop
+ 730:	c9                   	leave
+ 731:	c3                   	ret
+
+00000732 <crc32c>:
+{
+ 732:	55                   	push   %ebp
+ 733:	89 e5                	mov    %esp,%ebp
+ 735:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s = p;
+ 738:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 73b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(crc32chw < 0)
+ 73e:	a1 08 11 00 00       	mov    0x1108,%eax
+ 743:	85 c0                	test   %eax,%eax
+ 745:	79 05                	jns    74c <crc32c+0x1a>
+    crc32cinit();
+ 747:	e8 50 ff ff ff       	call   69c <crc32cinit>
+  crc = ~crc;
+ 74c:	f7 55 08             	notl   0x8(%ebp)
+  if(crc32chw){
+ 74f:	a1 08 11 00 00       	mov    0x1108,%eax
+ 754:	85 c0                	test   %eax,%eax
+ 756:	74 6c                	je     7c4 <crc32c+0x92>
+    for(; n >= 4; n -= 4, s += 4)
+ 758:	eb 18                	jmp    772 <crc32c+0x40>
+      asm("crc32l %1, %0" : "+r" (crc) : "rm" (*(const uint*)s));
+ 75a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 75d:	8b 10                	mov    (%eax),%edx
+ 75f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 762:	f2 0f 38 f1 c2       	crc32  %edx,%eax
+ 767:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n >= 4; n -= 4, s += 4)
+ 76a:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+ 76e:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+ 772:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+ 776:	77 e2                	ja     75a <crc32c+0x28>
+    for(; n > 0; n--, s++)
+ 778:	eb 19                	jmp    793 <crc32c+0x61>
+      asm("crc32b %1, %0" : "+r" (crc) : "qm" (*s));
+ 77a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 77d:	0f b6 10             	movzbl (%eax),%edx
+ 780:	8b 45 08             	mov    0x8(%ebp),%eax
+ 783:	f2 0f 38 f0 c2       	crc32  %dl,%eax
+ 788:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+ 78b:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+ 78f:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 793:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 797:	75 e1                	jne    77a <crc32c+0x48>
+ 799:	eb 2f                	jmp    7ca <crc32c+0x98>
+      crc = crc32ctab[(crc ^ *s) & 0xff] ^ (crc >> 8);
+ 79b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 79e:	0f b6 00             	movzbl (%eax),%eax
+ 7a1:	0f b6 c0             	movzbl %al,%eax
+ 7a4:	33 45 08             	xor    0x8(%ebp),%eax
+ 7a7:	0f b6 c0             	movzbl %al,%eax
+ 7aa:	8b 04 85 20 11 00 00 	mov    0x1120(,%eax,4),%eax
+ 7b1:	8b 55 08             	mov    0x8(%ebp),%edx
+ 7b4:	c1 ea 08             	shr    $0x8,%edx
+ 7b7:	31 d0                	xor    %edx,%eax
+ 7b9:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+ 7bc:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+ 7c0:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 7c4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 7c8:	75 d1                	jne    79b <crc32c+0x69>
+  return ~crc;
+ 7ca:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7cd:	f7 d0                	not    %eax
+}
+ 7cf:	c9                   	leave
+ 7d0:	c3                   	ret
+
+000007d1 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 7d1:	b8 01 00 00 00       	mov    $0x1,%eax
+ 7d6:	cd 40                	int    $0x40
+ 7d8:	c3                   	ret
+
+000007d9 <exit>:
+SYSCALL(exit)
+ 7d9:	b8 02 00 00 00       	mov    $0x2,%eax
+ 7de:	cd 40                	int    $0x40
+ 7e0:	c3                   	ret
+
+000007e1 <wait>:
+SYSCALL(wait)
+ 7e1:	b8 03 00 00 00       	mov    $0x3,%eax
+ 7e6:	cd 40                	int    $0x40
+ 7e8:	c3                   	ret
+
+000007e9 <pipe>:
+SYSCALL(pipe)
+ 7e9:	b8 04 00 00 00       	mov    $0x4,%eax
+ 7ee:	cd 40                	int    $0x40
+ 7f0:	c3                   	ret
+
+000007f1 <read>:
+SYSCALL(read)
+ 7f1:	b8 05 00 00 00       	mov    $0x5,%eax
+ 7f6:	cd 40                	int    $0x40
+ 7f8:	c3                   	ret
+
+000007f9 <write>:
+SYSCALL(write)
+ 7f9:	b8 10 00 00 00       	mov    $0x10,%eax
+ 7fe:	cd 40                	int    $0x40
+ 800:	c3                   	ret
+
+00000801 <close>:
+SYSCALL(close)
+ 801:	b8 15 00 00 00       	mov    $0x15,%eax
+ 806:	cd 40                	int    $0x40
+ 808:	c3                   	ret
+
+00000809 <kill>:
+SYSCALL(kill)
+ 809:	b8 06 00 00 00       	mov    $0x6,%eax
+ 80e:	cd 40                	int    $0x40
+ 810:	c3                   	ret
+
+00000811 <exec>:
+SYSCALL(exec)
+ 811:	b8 07 00 00 00       	mov    $0x7,%eax
+ 816:	cd 40                	int    $0x40
+ 818:	c3                   	ret
+
+00000819 <open>:
+SYSCALL(open)
+ 819:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 81e:	cd 40                	int    $0x40
+ 820:	c3                   	ret
+
+00000821 <mknod>:
+SYSCALL(mknod)
+ 821:	b8 11 00 00 00       	mov    $0x11,%eax
+ 826:	cd 40                	int    $0x40
+ 828:	c3                   	ret
+
+00000829 <unlink>:
+SYSCALL(unlink)
+ 829:	b8 12 00 00 00       	mov    $0x12,%eax
+ 82e:	cd 40                	int    $0x40
+ 830:	c3                   	ret
+
+00000831 <fstat>:
+SYSCALL(fstat)
+ 831:	b8 08 00 00 00       	mov    $0x8,%eax
+ 836:	cd 40                	int    $0x40
+ 838:	c3                   	ret
+
+00000839 <link>:
+SYSCALL(link)
+ 839:	b8 13 00 00 00       	mov    $0x13,%eax
+ 83e:	cd 40                	int    $0x40
+ 840:	c3                   	ret
+
+00000841 <mkdir>:
+SYSCALL(mkdir)
+ 841:	b8 14 00 00 00       	mov    $0x14,%eax
+ 846:	cd 40                	int    $0x40
+ 848:	c3                   	ret
+
+00000849 <chdir>:
+SYSCALL(chdir)
+ 849:	b8 09 00 00 00       	mov    $0x9,%eax
+ 84e:	cd 40                	int    $0x40
+ 850:	c3                   	ret
+
+00000851 <dup>:
+SYSCALL(dup)
+ 851:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 856:	cd 40                	int    $0x40
+ 858:	c3                   	ret
+
+00000859 <getpid>:
+SYSCALL(getpid)
+ 859:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 85e:	cd 40                	int    $0x40
+ 860:	c3                   	ret
+
+00000861 <sbrk>:
+SYSCALL(sbrk)
+ 861:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 866:	cd 40                	int    $0x40
+ 868:	c3                   	ret
+
+00000869 <sleep>:
+SYSCALL(sleep)
+ 869:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 86e:	cd 40                	int    $0x40
+ 870:	c3                   	ret
+
+00000871 <uptime>:
+SYSCALL(uptime)
+ 871:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 876:	cd 40                	int    $0x40
+ 878:	c3                   	ret
+
+00000879 <arp>:
+SYSCALL(arp)
+ 879:	b8 16 00 00 00       	mov    $0x16,%eax
+ 87e:	cd 40                	int    $0x40
+ 880:	c3                   	ret
+
+00000881 <ifstat>:
+SYSCALL(ifstat)
+ 881:	b8 17 00 00 00       	mov    $0x17,%eax
+ 886:	cd 40                	int    $0x40
+ 888:	c3                   	ret
+
+00000889 <pcapctl>:
+SYSCALL(pcapctl)
+ 889:	b8 18 00 00 00       	mov    $0x18,%eax
+ 88e:	cd 40                	int    $0x40
+ 890:	c3                   	ret
+
+00000891 <pcapread>:
+SYSCALL(pcapread)
+ 891:	b8 19 00 00 00       	mov    $0x19,%eax
+ 896:	cd 40                	int    $0x40
+ 898:	c3                   	ret
+
+00000899 <bpfattach>:
+SYSCALL(bpfattach)
+ 899:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 89e:	cd 40                	int    $0x40
+ 8a0:	c3                   	ret
+
+000008a1 <pktgen>:
+SYSCALL(pktgen)
+ 8a1:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 8a6:	cd 40                	int    $0x40
+ 8a8:	c3                   	ret
+
+000008a9 <reflect>:
+SYSCALL(reflect)
+ 8a9:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 8ae:	cd 40                	int    $0x40
+ 8b0:	c3                   	ret
+
+000008b1 <brctl>:
+SYSCALL(brctl)
+ 8b1:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 8b6:	cd 40                	int    $0x40
+ 8b8:	c3                   	ret
+
+000008b9 <hostopen>:
+SYSCALL(hostopen)
+ 8b9:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 8be:	cd 40                	int    $0x40
+ 8c0:	c3                   	ret
+
+000008c1 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 8c1:	55                   	push   %ebp
+ 8c2:	89 e5                	mov    %esp,%ebp
+ 8c4:	83 ec 18             	sub    $0x18,%esp
+ 8c7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 8ca:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 8cd:	83 ec 04             	sub    $0x4,%esp
+ 8d0:	6a 01                	push   $0x1
+ 8d2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 8d5:	50                   	push   %eax
+ 8d6:	ff 75 08             	push   0x8(%ebp)
+ 8d9:	e8 1b ff ff ff       	call   7f9 <write>
+ 8de:	83 c4 10             	add    $0x10,%esp
+}
+ 8e1:	90                   	nop
+ 8e2:	c9                   	leave
+ 8e3:	c3                   	ret
+
+000008e4 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 8e4:	55                   	push   %ebp
+ 8e5:	89 e5                	mov    %esp,%ebp
+ 8e7:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 8ea:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 8f1:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 8f5:	74 17                	je     90e <printint+0x2a>
+ 8f7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 8fb:	79 11                	jns    90e <printint+0x2a>
+    neg = 1;
+ 8fd:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 904:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 907:	f7 d8                	neg    %eax
+ 909:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 90c:	eb 06                	jmp    914 <printint+0x30>
+  } else {
+    x = xx;
+ 90e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 911:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 914:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 91b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 91e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 921:	ba 00 00 00 00       	mov    $0x0,%edx
+ 926:	f7 f1                	div    %ecx
+ 928:	89 d1                	mov    %edx,%ecx
+ 92a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 92d:	8d 50 01             	lea    0x1(%eax),%edx
+ 930:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 933:	0f b6 91 0c 11 00 00 	movzbl 0x110c(%ecx),%edx
+ 93a:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 93e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 941:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 944:	ba 00 00 00 00       	mov    $0x0,%edx
+ 949:	f7 f1                	div    %ecx
+ 94b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 94e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 952:	75 c7                	jne    91b <printint+0x37>
+  if(neg)
+ 954:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 958:	74 2d                	je     987 <printint+0xa3>
+    buf[i++] = '-';
+ 95a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 95d:	8d 50 01             	lea    0x1(%eax),%edx
+ 960:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 963:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 968:	eb 1d                	jmp    987 <printint+0xa3>
+    putc(fd, buf[i]);
+ 96a:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 96d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 970:	01 d0                	add    %edx,%eax
+ 972:	0f b6 00             	movzbl (%eax),%eax
+ 975:	0f be c0             	movsbl %al,%eax
+ 978:	83 ec 08             	sub    $0x8,%esp
+ 97b:	50                   	push   %eax
+ 97c:	ff 75 08             	push   0x8(%ebp)
+ 97f:	e8 3d ff ff ff       	call   8c1 <putc>
+ 984:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 987:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 98b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 98f:	79 d9                	jns    96a <printint+0x86>
+}
+ 991:	90                   	nop
+ 992:	90                   	nop
+ 993:	c9                   	leave
+ 994:	c3                   	ret
+
+00000995 <printf>:
+
+// Print to the given fd. Only understands %d, %u, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 995:	55                   	push   %ebp
+ 996:	89 e5                	mov    %esp,%ebp
+ 998:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 99b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 9a2:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 9a5:	83 c0 04             	add    $0x4,%eax
+ 9a8:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 9ab:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 9b2:	e9 7d 01 00 00       	jmp    b34 <printf+0x19f>
+    c = fmt[i] & 0xff;
+ 9b7:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 9ba:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9bd:	01 d0                	add    %edx,%eax
+ 9bf:	0f b6 00             	movzbl (%eax),%eax
+ 9c2:	0f be c0             	movsbl %al,%eax
+ 9c5:	25 ff 00 00 00       	and    $0xff,%eax
+ 9ca:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 9cd:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 9d1:	75 2c                	jne    9ff <printf+0x6a>
+      if(c == '%'){
+ 9d3:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 9d7:	75 0c                	jne    9e5 <printf+0x50>
+        state = '%';
+ 9d9:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 9e0:	e9 4b 01 00 00       	jmp    b30 <printf+0x19b>
+      } else {
+        putc(fd, c);
+ 9e5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9e8:	0f be c0             	movsbl %al,%eax
+ 9eb:	83 ec 08             	sub    $0x8,%esp
+ 9ee:	50                   	push   %eax
+ 9ef:	ff 75 08             	push   0x8(%ebp)
+ 9f2:	e8 ca fe ff ff       	call   8c1 <putc>
+ 9f7:	83 c4 10             	add    $0x10,%esp
+ 9fa:	e9 31 01 00 00       	jmp    b30 <printf+0x19b>
+      }
+    } else if(state == '%'){
+ 9ff:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ a03:	0f 85 27 01 00 00    	jne    b30 <printf+0x19b>
+      if(c == 'd'){
+ a09:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ a0d:	75 1e                	jne    a2d <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ a0f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a12:	8b 00                	mov    (%eax),%eax
+ a14:	6a 01                	push   $0x1
+ a16:	6a 0a                	push   $0xa
+ a18:	50                   	push   %eax
+ a19:	ff 75 08             	push   0x8(%ebp)
+ a1c:	e8 c3 fe ff ff       	call   8e4 <printint>
+ a21:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a24:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a28:	e9 fc 00 00 00       	jmp    b29 <printf+0x194>
+      } else if(c == 'u'){
+ a2d:	83 7d e4 75          	cmpl   $0x75,-0x1c(%ebp)
+ a31:	75 1e                	jne    a51 <printf+0xbc>
+        printint(fd, *ap, 10, 0);
+ a33:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a36:	8b 00                	mov    (%eax),%eax
+ a38:	6a 00                	push   $0x0
+ a3a:	6a 0a                	push   $0xa
+ a3c:	50                   	push   %eax
+ a3d:	ff 75 08             	push   0x8(%ebp)
+ a40:	e8 9f fe ff ff       	call   8e4 <printint>
+ a45:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a48:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a4c:	e9 d8 00 00 00       	jmp    b29 <printf+0x194>
+      } else if(c == 'x' || c == 'p'){
+ a51:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ a55:	74 06                	je     a5d <printf+0xc8>
+ a57:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ a5b:	75 1e                	jne    a7b <printf+0xe6>
+        printint(fd, *ap, 16, 0);
+ a5d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a60:	8b 00                	mov    (%eax),%eax
+ a62:	6a 00                	push   $0x0
+ a64:	6a 10                	push   $0x10
+ a66:	50                   	push   %eax
+ a67:	ff 75 08             	push   0x8(%ebp)
+ a6a:	e8 75 fe ff ff       	call   8e4 <printint>
+ a6f:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a72:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a76:	e9 ae 00 00 00       	jmp    b29 <printf+0x194>
+      } else if(c == 's'){
+ a7b:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ a7f:	75 43                	jne    ac4 <printf+0x12f>
+        s = (char*)*ap;
+ a81:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a84:	8b 00                	mov    (%eax),%eax
+ a86:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ a89:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ a8d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a91:	75 25                	jne    ab8 <printf+0x123>
+          s = "(null)";
+ a93:	c7 45 f4 a6 0d 00 00 	movl   $0xda6,-0xc(%ebp)
+        while(*s != 0){
+ a9a:	eb 1c                	jmp    ab8 <printf+0x123>
+          putc(fd, *s);
+ a9c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a9f:	0f b6 00             	movzbl (%eax),%eax
+ aa2:	0f be c0             	movsbl %al,%eax
+ aa5:	83 ec 08             	sub    $0x8,%esp
+ aa8:	50                   	push   %eax
+ aa9:	ff 75 08             	push   0x8(%ebp)
+ aac:	e8 10 fe ff ff       	call   8c1 <putc>
+ ab1:	83 c4 10             	add    $0x10,%esp
+          s++;
+ ab4:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ ab8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ abb:	0f b6 00             	movzbl (%eax),%eax
+ abe:	84 c0                	test   %al,%al
+ ac0:	75 da                	jne    a9c <printf+0x107>
+ ac2:	eb 65                	jmp    b29 <printf+0x194>
+        }
+      } else if(c == 'c'){
+ ac4:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ ac8:	75 1d                	jne    ae7 <printf+0x152>
+        putc(fd, *ap);
+ aca:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ acd:	8b 00                	mov    (%eax),%eax
+ acf:	0f be c0             	movsbl %al,%eax
+ ad2:	83 ec 08             	sub    $0x8,%esp
+ ad5:	50                   	push   %eax
+ ad6:	ff 75 08             	push   0x8(%ebp)
+ ad9:	e8 e3 fd ff ff       	call   8c1 <putc>
+ ade:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ ae1:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ ae5:	eb 42                	jmp    b29 <printf+0x194>
+      } else if(c == '%'){
+ ae7:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ aeb:	75 17                	jne    b04 <printf+0x16f>
+        putc(fd, c);
+ aed:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ af0:	0f be c0             	movsbl %al,%eax
+ af3:	83 ec 08             	sub    $0x8,%esp
+ af6:	50                   	push   %eax
+ af7:	ff 75 08             	push   0x8(%ebp)
+ afa:	e8 c2 fd ff ff       	call   8c1 <putc>
+ aff:	83 c4 10             	add    $0x10,%esp
+ b02:	eb 25                	jmp    b29 <printf+0x194>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ b04:	83 ec 08             	sub    $0x8,%esp
+ b07:	6a 25                	push   $0x25
+ b09:	ff 75 08             	push   0x8(%ebp)
+ b0c:	e8 b0 fd ff ff       	call   8c1 <putc>
+ b11:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ b14:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ b17:	0f be c0             	movsbl %al,%eax
+ b1a:	83 ec 08             	sub    $0x8,%esp
+ b1d:	50                   	push   %eax
+ b1e:	ff 75 08             	push   0x8(%ebp)
+ b21:	e8 9b fd ff ff       	call   8c1 <putc>
+ b26:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ b29:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ b30:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ b34:	8b 55 0c             	mov    0xc(%ebp),%edx
+ b37:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b3a:	01 d0                	add    %edx,%eax
+ b3c:	0f b6 00             	movzbl (%eax),%eax
+ b3f:	84 c0                	test   %al,%al
+ b41:	0f 85 70 fe ff ff    	jne    9b7 <printf+0x22>
+    }
+  }
+}
+ b47:	90                   	nop
+ b48:	90                   	nop
+ b49:	c9                   	leave
+ b4a:	c3                   	ret
+
+00000b4b <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ b4b:	55                   	push   %ebp
+ b4c:	89 e5                	mov    %esp,%ebp
+ b4e:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ b51:	8b 45 08             	mov    0x8(%ebp),%eax
+ b54:	83 e8 08             	sub    $0x8,%eax
+ b57:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b5a:	a1 28 15 00 00       	mov    0x1528,%eax
+ b5f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ b62:	eb 24                	jmp    b88 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b64:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b67:	8b 00                	mov    (%eax),%eax
+ b69:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b6c:	72 12                	jb     b80 <free+0x35>
+ b6e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b71:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b74:	72 24                	jb     b9a <free+0x4f>
+ b76:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b79:	8b 00                	mov    (%eax),%eax
+ b7b:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ b7e:	72 1a                	jb     b9a <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b80:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b83:	8b 00                	mov    (%eax),%eax
+ b85:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ b88:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b8b:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b8e:	73 d4                	jae    b64 <free+0x19>
+ b90:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b93:	8b 00                	mov    (%eax),%eax
+ b95:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ b98:	73 ca                	jae    b64 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ b9a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b9d:	8b 40 04             	mov    0x4(%eax),%eax
+ ba0:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ ba7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ baa:	01 c2                	add    %eax,%edx
+ bac:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ baf:	8b 00                	mov    (%eax),%eax
+ bb1:	39 c2                	cmp    %eax,%edx
+ bb3:	75 24                	jne    bd9 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ bb5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bb8:	8b 50 04             	mov    0x4(%eax),%edx
+ bbb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bbe:	8b 00                	mov    (%eax),%eax
+ bc0:	8b 40 04             	mov    0x4(%eax),%eax
+ bc3:	01 c2                	add    %eax,%edx
+ bc5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bc8:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ bcb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bce:	8b 00                	mov    (%eax),%eax
+ bd0:	8b 10                	mov    (%eax),%edx
+ bd2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bd5:	89 10                	mov    %edx,(%eax)
+ bd7:	eb 0a                	jmp    be3 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ bd9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bdc:	8b 10                	mov    (%eax),%edx
+ bde:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ be1:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ be3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ be6:	8b 40 04             	mov    0x4(%eax),%eax
+ be9:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ bf0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bf3:	01 d0                	add    %edx,%eax
+ bf5:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ bf8:	75 20                	jne    c1a <free+0xcf>
+    p->s.size += bp->s.size;
+ bfa:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bfd:	8b 50 04             	mov    0x4(%eax),%edx
+ c00:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c03:	8b 40 04             	mov    0x4(%eax),%eax
+ c06:	01 c2                	add    %eax,%edx
+ c08:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c0b:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ c0e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c11:	8b 10                	mov    (%eax),%edx
+ c13:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c16:	89 10                	mov    %edx,(%eax)
+ c18:	eb 08                	jmp    c22 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ c1a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c1d:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ c20:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ c22:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c25:	a3 28 15 00 00       	mov    %eax,0x1528
+}
+ c2a:	90                   	nop
+ c2b:	c9                   	leave
+ c2c:	c3                   	ret
+
+00000c2d <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ c2d:	55                   	push   %ebp
+ c2e:	89 e5                	mov    %esp,%ebp
+ c30:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ c33:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ c3a:	77 07                	ja     c43 <morecore+0x16>
+    nu = 4096;
+ c3c:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ c43:	8b 45 08             	mov    0x8(%ebp),%eax
+ c46:	c1 e0 03             	shl    $0x3,%eax
+ c49:	83 ec 0c             	sub    $0xc,%esp
+ c4c:	50                   	push   %eax
+ c4d:	e8 0f fc ff ff       	call   861 <sbrk>
+ c52:	83 c4 10             	add    $0x10,%esp
+ c55:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ c58:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ c5c:	75 07                	jne    c65 <morecore+0x38>
+    return 0;
+ c5e:	b8 00 00 00 00       	mov    $0x0,%eax
+ c63:	eb 26                	jmp    c8b <morecore+0x5e>
+  hp = (Header*)p;
+ c65:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c68:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ c6b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c6e:	8b 55 08             	mov    0x8(%ebp),%edx
+ c71:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ c74:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c77:	83 c0 08             	add    $0x8,%eax
+ c7a:	83 ec 0c             	sub    $0xc,%esp
+ c7d:	50                   	push   %eax
+ c7e:	e8 c8 fe ff ff       	call   b4b <free>
+ c83:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ c86:	a1 28 15 00 00       	mov    0x1528,%eax
+}
+ c8b:	c9                   	leave
+ c8c:	c3                   	ret
+
+00000c8d <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ c8d:	55                   	push   %ebp
+ c8e:	89 e5                	mov    %esp,%ebp
+ c90:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c93:	8b 45 08             	mov    0x8(%ebp),%eax
+ c96:	83 c0 07             	add    $0x7,%eax
+ c99:	c1 e8 03             	shr    $0x3,%eax
+ c9c:	83 c0 01             	add    $0x1,%eax
+ c9f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ ca2:	a1 28 15 00 00       	mov    0x1528,%eax
+ ca7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ caa:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ cae:	75 23                	jne    cd3 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ cb0:	c7 45 f0 20 15 00 00 	movl   $0x1520,-0x10(%ebp)
+ cb7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cba:	a3 28 15 00 00       	mov    %eax,0x1528
+ cbf:	a1 28 15 00 00       	mov    0x1528,%eax
+ cc4:	a3 20 15 00 00       	mov    %eax,0x1520
+    base.s.size = 0;
+ cc9:	c7 05 24 15 00 00 00 	movl   $0x0,0x1524
+ cd0:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cd3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cd6:	8b 00                	mov    (%eax),%eax
+ cd8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ cdb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cde:	8b 40 04             	mov    0x4(%eax),%eax
+ ce1:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ ce4:	72 4d                	jb     d33 <malloc+0xa6>
+      if(p->s.size == nunits)
+ ce6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ce9:	8b 40 04             	mov    0x4(%eax),%eax
+ cec:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ cef:	75 0c                	jne    cfd <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ cf1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cf4:	8b 10                	mov    (%eax),%edx
+ cf6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cf9:	89 10                	mov    %edx,(%eax)
+ cfb:	eb 26                	jmp    d23 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ cfd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d00:	8b 40 04             	mov    0x4(%eax),%eax
+ d03:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ d06:	89 c2                	mov    %eax,%edx
+ d08:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d0b:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ d0e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d11:	8b 40 04             	mov    0x4(%eax),%eax
+ d14:	c1 e0 03             	shl    $0x3,%eax
+ d17:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ d1a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d1d:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ d20:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ d23:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d26:	a3 28 15 00 00       	mov    %eax,0x1528
+      return (void*)(p + 1);
+ d2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d2e:	83 c0 08             	add    $0x8,%eax
+ d31:	eb 3b                	jmp    d6e <malloc+0xe1>
+    }
+    if(p == freep)
+ d33:	a1 28 15 00 00       	mov    0x1528,%eax
+ d38:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ d3b:	75 1e                	jne    d5b <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ d3d:	83 ec 0c             	sub    $0xc,%esp
+ d40:	ff 75 ec             	push   -0x14(%ebp)
+ d43:	e8 e5 fe ff ff       	call   c2d <morecore>
+ d48:	83 c4 10             	add    $0x10,%esp
+ d4b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d4e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d52:	75 07                	jne    d5b <malloc+0xce>
+        return 0;
+ d54:	b8 00 00 00 00       	mov    $0x0,%eax
+ d59:	eb 13                	jmp    d6e <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d5b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d5e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ d61:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d64:	8b 00                	mov    (%eax),%eax
+ d66:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ d69:	e9 6d ff ff ff       	jmp    cdb <malloc+0x4e>
+  }
+}
+ d6e:	c9                   	leave
+ d6f:	c3                   	ret
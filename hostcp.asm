@@ -0,0 +1,1504 @@
+
+_hostcp:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char buf[8192];
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	83 ec 10             	sub    $0x10,%esp
+  12:	89 cb                	mov    %ecx,%ebx
+  int in, out, n, total;
+
+  if(argc != 2 && argc != 3){
+  14:	83 3b 02             	cmpl   $0x2,(%ebx)
+  17:	74 1c                	je     35 <main+0x35>
+  19:	83 3b 03             	cmpl   $0x3,(%ebx)
+  1c:	74 17                	je     35 <main+0x35>
+    printf(2, "usage: hostcp hostpath [file]\n");
+  1e:	83 ec 08             	sub    $0x8,%esp
+  21:	68 bc 0b 00 00       	push   $0xbbc
+  26:	6a 02                	push   $0x2
+  28:	e8 b2 07 00 00       	call   7df <printf>
+  2d:	83 c4 10             	add    $0x10,%esp
+    exit();
+  30:	e8 ee 05 00 00       	call   623 <exit>
+  }
+  if((in = hostopen(argv[1])) < 0){
+  35:	8b 43 04             	mov    0x4(%ebx),%eax
+  38:	83 c0 04             	add    $0x4,%eax
+  3b:	8b 00                	mov    (%eax),%eax
+  3d:	83 ec 0c             	sub    $0xc,%esp
+  40:	50                   	push   %eax
+  41:	e8 bd 06 00 00       	call   703 <hostopen>
+  46:	83 c4 10             	add    $0x10,%esp
+  49:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  4c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+  50:	79 20                	jns    72 <main+0x72>
+    printf(2, "hostcp: cannot open %s on the host\n", argv[1]);
+  52:	8b 43 04             	mov    0x4(%ebx),%eax
+  55:	83 c0 04             	add    $0x4,%eax
+  58:	8b 00                	mov    (%eax),%eax
+  5a:	83 ec 04             	sub    $0x4,%esp
+  5d:	50                   	push   %eax
+  5e:	68 dc 0b 00 00       	push   $0xbdc
+  63:	6a 02                	push   $0x2
+  65:	e8 75 07 00 00       	call   7df <printf>
+  6a:	83 c4 10             	add    $0x10,%esp
+    exit();
+  6d:	e8 b1 05 00 00       	call   623 <exit>
+  }
+  out = 1;
+  72:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  if(argc == 3 && (out = open(argv[2], O_CREATE|O_WRONLY)) < 0){
+  79:	83 3b 03             	cmpl   $0x3,(%ebx)
+  7c:	75 42                	jne    c0 <main+0xc0>
+  7e:	8b 43 04             	mov    0x4(%ebx),%eax
+  81:	83 c0 08             	add    $0x8,%eax
+  84:	8b 00                	mov    (%eax),%eax
+  86:	83 ec 08             	sub    $0x8,%esp
+  89:	68 01 02 00 00       	push   $0x201
+  8e:	50                   	push   %eax
+  8f:	e8 cf 05 00 00       	call   663 <open>
+  94:	83 c4 10             	add    $0x10,%esp
+  97:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  9a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  9e:	79 20                	jns    c0 <main+0xc0>
+    printf(2, "hostcp: cannot create %s\n", argv[2]);
+  a0:	8b 43 04             	mov    0x4(%ebx),%eax
+  a3:	83 c0 08             	add    $0x8,%eax
+  a6:	8b 00                	mov    (%eax),%eax
+  a8:	83 ec 04             	sub    $0x4,%esp
+  ab:	50                   	push   %eax
+  ac:	68 00 0c 00 00       	push   $0xc00
+  b1:	6a 02                	push   $0x2
+  b3:	e8 27 07 00 00       	call   7df <printf>
+  b8:	83 c4 10             	add    $0x10,%esp
+    exit();
+  bb:	e8 63 05 00 00       	call   623 <exit>
+  }
+
+  total = 0;
+  c0:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  while((n = read(in, buf, sizeof(buf))) > 0){
+  c7:	eb 38                	jmp    101 <main+0x101>
+    if(write(out, buf, n) != n){
+  c9:	83 ec 04             	sub    $0x4,%esp
+  cc:	ff 75 e8             	push   -0x18(%ebp)
+  cf:	68 80 13 00 00       	push   $0x1380
+  d4:	ff 75 f4             	push   -0xc(%ebp)
+  d7:	e8 67 05 00 00       	call   643 <write>
+  dc:	83 c4 10             	add    $0x10,%esp
+  df:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+  e2:	74 17                	je     fb <main+0xfb>
+      printf(2, "hostcp: write error\n");
+  e4:	83 ec 08             	sub    $0x8,%esp
+  e7:	68 1a 0c 00 00       	push   $0xc1a
+  ec:	6a 02                	push   $0x2
+  ee:	e8 ec 06 00 00       	call   7df <printf>
+  f3:	83 c4 10             	add    $0x10,%esp
+      exit();
+  f6:	e8 28 05 00 00       	call   623 <exit>
+    }
+    total += n;
+  fb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  fe:	01 45 f0             	add    %eax,-0x10(%ebp)
+  while((n = read(in, buf, sizeof(buf))) > 0){
+ 101:	83 ec 04             	sub    $0x4,%esp
+ 104:	68 00 20 00 00       	push   $0x2000
+ 109:	68 80 13 00 00       	push   $0x1380
+ 10e:	ff 75 ec             	push   -0x14(%ebp)
+ 111:	e8 25 05 00 00       	call   63b <read>
+ 116:	83 c4 10             	add    $0x10,%esp
+ 119:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 11c:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 120:	7f a7                	jg     c9 <main+0xc9>
+  }
+  if(n < 0)
+ 122:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 126:	79 12                	jns    13a <main+0x13a>
+    printf(2, "hostcp: read error\n");
+ 128:	83 ec 08             	sub    $0x8,%esp
+ 12b:	68 2f 0c 00 00       	push   $0xc2f
+ 130:	6a 02                	push   $0x2
+ 132:	e8 a8 06 00 00       	call   7df <printf>
+ 137:	83 c4 10             	add    $0x10,%esp
+  if(argc == 3){
+ 13a:	83 3b 03             	cmpl   $0x3,(%ebx)
+ 13d:	75 23                	jne    162 <main+0x162>
+    printf(1, "%d bytes\n", total);
+ 13f:	83 ec 04             	sub    $0x4,%esp
+ 142:	ff 75 f0             	push   -0x10(%ebp)
+ 145:	68 43 0c 00 00       	push   $0xc43
+ 14a:	6a 01                	push   $0x1
+ 14c:	e8 8e 06 00 00       	call   7df <printf>
+ 151:	83 c4 10             	add    $0x10,%esp
+    close(out);
+ 154:	83 ec 0c             	sub    $0xc,%esp
+ 157:	ff 75 f4             	push   -0xc(%ebp)
+ 15a:	e8 ec 04 00 00       	call   64b <close>
+ 15f:	83 c4 10             	add    $0x10,%esp
+  }
+  close(in);
+ 162:	83 ec 0c             	sub    $0xc,%esp
+ 165:	ff 75 ec             	push   -0x14(%ebp)
+ 168:	e8 de 04 00 00       	call   64b <close>
+ 16d:	83 c4 10             	add    $0x10,%esp
+  exit();
+ 170:	e8 ae 04 00 00       	call   623 <exit>
+
+00000175 <stosb>:
+}
+
+int
+stat(char *n, struct stat *st)
+{
+  int fd;
+ 175:	55                   	push   %ebp
+ 176:	89 e5                	mov    %esp,%ebp
+ 178:	57                   	push   %edi
+ 179:	53                   	push   %ebx
+  int r;
+ 17a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 17d:	8b 55 10             	mov    0x10(%ebp),%edx
+ 180:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 183:	89 cb                	mov    %ecx,%ebx
+ 185:	89 df                	mov    %ebx,%edi
+ 187:	89 d1                	mov    %edx,%ecx
+ 189:	fc                   	cld
+ 18a:	f3 aa                	rep stos %al,%es:(%edi)
+ 18c:	89 ca                	mov    %ecx,%edx
+ 18e:	89 fb                	mov    %edi,%ebx
+ 190:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 193:	89 55 10             	mov    %edx,0x10(%ebp)
+
+  fd = open(n, O_RDONLY);
+  if(fd < 0)
+    return -1;
+ 196:	90                   	nop
+ 197:	5b                   	pop    %ebx
+ 198:	5f                   	pop    %edi
+ 199:	5d                   	pop    %ebp
+ 19a:	c3                   	ret
+
+0000019b <strcpy>:
+{
+ 19b:	55                   	push   %ebp
+ 19c:	89 e5                	mov    %esp,%ebp
+ 19e:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 1a1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a4:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 1a7:	90                   	nop
+ 1a8:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 1ab:	8d 42 01             	lea    0x1(%edx),%eax
+ 1ae:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 1b1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b4:	8d 48 01             	lea    0x1(%eax),%ecx
+ 1b7:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 1ba:	0f b6 12             	movzbl (%edx),%edx
+ 1bd:	88 10                	mov    %dl,(%eax)
+ 1bf:	0f b6 00             	movzbl (%eax),%eax
+ 1c2:	84 c0                	test   %al,%al
+ 1c4:	75 e2                	jne    1a8 <strcpy+0xd>
+  return os;
+ 1c6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1c9:	c9                   	leave
+ 1ca:	c3                   	ret
+
+000001cb <strlen>:
+{
+ 1cb:	55                   	push   %ebp
+ 1cc:	89 e5                	mov    %esp,%ebp
+ 1ce:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 1d1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 1d8:	eb 04                	jmp    1de <strlen+0x13>
+ 1da:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 1de:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1e1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e4:	01 d0                	add    %edx,%eax
+ 1e6:	0f b6 00             	movzbl (%eax),%eax
+ 1e9:	84 c0                	test   %al,%al
+ 1eb:	75 ed                	jne    1da <strlen+0xf>
+  return n;
+ 1ed:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1f0:	c9                   	leave
+ 1f1:	c3                   	ret
+
+000001f2 <memset>:
+{
+ 1f2:	55                   	push   %ebp
+ 1f3:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 1f5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 1f8:	50                   	push   %eax
+ 1f9:	ff 75 0c             	push   0xc(%ebp)
+ 1fc:	ff 75 08             	push   0x8(%ebp)
+ 1ff:	e8 71 ff ff ff       	call   175 <stosb>
+ 204:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 207:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 20a:	c9                   	leave
+ 20b:	c3                   	ret
+
+0000020c <strchr>:
+{
+ 20c:	55                   	push   %ebp
+ 20d:	89 e5                	mov    %esp,%ebp
+ 20f:	83 ec 04             	sub    $0x4,%esp
+ 212:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 215:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 218:	eb 14                	jmp    22e <strchr+0x22>
+    if(*s == c)
+ 21a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 21d:	0f b6 00             	movzbl (%eax),%eax
+ 220:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 223:	75 05                	jne    22a <strchr+0x1e>
+      return (char*)s;
+ 225:	8b 45 08             	mov    0x8(%ebp),%eax
+ 228:	eb 13                	jmp    23d <strchr+0x31>
+  for(; *s; s++)
+ 22a:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 22e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 231:	0f b6 00             	movzbl (%eax),%eax
+ 234:	84 c0                	test   %al,%al
+ 236:	75 e2                	jne    21a <strchr+0xe>
+  return 0;
+ 238:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 23d:	c9                   	leave
+ 23e:	c3                   	ret
+
+0000023f <gets>:
+{
+ 23f:	55                   	push   %ebp
+ 240:	89 e5                	mov    %esp,%ebp
+ 242:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 245:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 24c:	eb 42                	jmp    290 <gets+0x51>
+    cc = read(0, &c, 1);
+ 24e:	83 ec 04             	sub    $0x4,%esp
+ 251:	6a 01                	push   $0x1
+ 253:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 256:	50                   	push   %eax
+ 257:	6a 00                	push   $0x0
+ 259:	e8 dd 03 00 00       	call   63b <read>
+ 25e:	83 c4 10             	add    $0x10,%esp
+ 261:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 264:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 268:	7e 33                	jle    29d <gets+0x5e>
+    buf[i++] = c;
+ 26a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 26d:	8d 50 01             	lea    0x1(%eax),%edx
+ 270:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 273:	89 c2                	mov    %eax,%edx
+ 275:	8b 45 08             	mov    0x8(%ebp),%eax
+ 278:	01 c2                	add    %eax,%edx
+ 27a:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 27e:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 280:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 284:	3c 0a                	cmp    $0xa,%al
+ 286:	74 16                	je     29e <gets+0x5f>
+ 288:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 28c:	3c 0d                	cmp    $0xd,%al
+ 28e:	74 0e                	je     29e <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 290:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 293:	83 c0 01             	add    $0x1,%eax
+ 296:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 299:	7f b3                	jg     24e <gets+0xf>
+ 29b:	eb 01                	jmp    29e <gets+0x5f>
+      break;
+ 29d:	90                   	nop
+  buf[i] = '\0';
+ 29e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 2a1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a4:	01 d0                	add    %edx,%eax
+ 2a6:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 2a9:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2ac:	c9                   	leave
+ 2ad:	c3                   	ret
+
+000002ae <stat>:
+{
+ 2ae:	55                   	push   %ebp
+ 2af:	89 e5                	mov    %esp,%ebp
+ 2b1:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+ 2b4:	83 ec 08             	sub    $0x8,%esp
+ 2b7:	6a 00                	push   $0x0
+ 2b9:	ff 75 08             	push   0x8(%ebp)
+ 2bc:	e8 a2 03 00 00       	call   663 <open>
+ 2c1:	83 c4 10             	add    $0x10,%esp
+ 2c4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 2c7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 2cb:	79 07                	jns    2d4 <stat+0x26>
+    return -1;
+ 2cd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2d2:	eb 25                	jmp    2f9 <stat+0x4b>
+  r = fstat(fd, st);
+ 2d4:	83 ec 08             	sub    $0x8,%esp
+ 2d7:	ff 75 0c             	push   0xc(%ebp)
+ 2da:	ff 75 f4             	push   -0xc(%ebp)
+ 2dd:	e8 99 03 00 00       	call   67b <fstat>
+ 2e2:	83 c4 10             	add    $0x10,%esp
+ 2e5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 2e8:	83 ec 0c             	sub    $0xc,%esp
+ 2eb:	ff 75 f4             	push   -0xc(%ebp)
+ 2ee:	e8 58 03 00 00       	call   64b <close>
+ 2f3:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 2f6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 2f9:	c9                   	leave
+ 2fa:	c3                   	ret
+
+000002fb <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 2fb:	55                   	push   %ebp
+ 2fc:	89 e5                	mov    %esp,%ebp
+ 2fe:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+
+  dst = vdst;
+ 301:	8b 45 08             	mov    0x8(%ebp),%eax
+ 304:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 307:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 30a:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 30d:	eb 17                	jmp    326 <memmove+0x2b>
+    *dst++ = *src++;
+ 30f:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 312:	8d 42 01             	lea    0x1(%edx),%eax
+ 315:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 318:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 31b:	8d 48 01             	lea    0x1(%eax),%ecx
+ 31e:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 321:	0f b6 12             	movzbl (%edx),%edx
+ 324:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 326:	8b 45 10             	mov    0x10(%ebp),%eax
+ 329:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 32c:	89 55 10             	mov    %edx,0x10(%ebp)
+ 32f:	85 c0                	test   %eax,%eax
+ 331:	7f dc                	jg     30f <memmove+0x14>
+  return vdst;
+ 333:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 336:	c9                   	leave
+ 337:	c3                   	ret
+
+00000338 <cpuinfo>:
+ 338:	55                   	push   %ebp
+ 339:	89 e5                	mov    %esp,%ebp
+ 33b:	56                   	push   %esi
+ 33c:	53                   	push   %ebx
+ 33d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 340:	ba 00 00 00 00       	mov    $0x0,%edx
+ 345:	89 d1                	mov    %edx,%ecx
+ 347:	0f a2                	cpuid
+ 349:	89 c6                	mov    %eax,%esi
+ 34b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 34e:	89 30                	mov    %esi,(%eax)
+ 350:	8b 45 10             	mov    0x10(%ebp),%eax
+ 353:	89 18                	mov    %ebx,(%eax)
+ 355:	8b 45 14             	mov    0x14(%ebp),%eax
+ 358:	89 08                	mov    %ecx,(%eax)
+ 35a:	8b 45 18             	mov    0x18(%ebp),%eax
+ 35d:	89 10                	mov    %edx,(%eax)
+ 35f:	90                   	nop
+ 360:	5b                   	pop    %ebx
+ 361:	5e                   	pop    %esi
+ 362:	5d                   	pop    %ebp
+ 363:	c3                   	ret
+
+00000364 <atoi>:
+{
+ 364:	55                   	push   %ebp
+ 365:	89 e5                	mov    %esp,%ebp
+ 367:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+ 36a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 371:	eb 25                	jmp    398 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 373:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 376:	89 d0                	mov    %edx,%eax
+ 378:	c1 e0 02             	shl    $0x2,%eax
+ 37b:	01 d0                	add    %edx,%eax
+ 37d:	01 c0                	add    %eax,%eax
+ 37f:	89 c1                	mov    %eax,%ecx
+ 381:	8b 45 08             	mov    0x8(%ebp),%eax
+ 384:	8d 50 01             	lea    0x1(%eax),%edx
+ 387:	89 55 08             	mov    %edx,0x8(%ebp)
+ 38a:	0f b6 00             	movzbl (%eax),%eax
+ 38d:	0f be c0             	movsbl %al,%eax
+ 390:	01 c8                	add    %ecx,%eax
+ 392:	83 e8 30             	sub    $0x30,%eax
+ 395:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 398:	8b 45 08             	mov    0x8(%ebp),%eax
+ 39b:	0f b6 00             	movzbl (%eax),%eax
+ 39e:	3c 2f                	cmp    $0x2f,%al
+ 3a0:	7e 0a                	jle    3ac <atoi+0x48>
+ 3a2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a5:	0f b6 00             	movzbl (%eax),%eax
+ 3a8:	3c 39                	cmp    $0x39,%al
+ 3aa:	7e c7                	jle    373 <atoi+0xf>
+  return n;
+ 3ac:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3af:	c9                   	leave
+ 3b0:	c3                   	ret
+
+000003b1 <strcmp>:
+{
+ 3b1:	55                   	push   %ebp
+ 3b2:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 3b4:	eb 08                	jmp    3be <strcmp+0xd>
+    p++, q++;
+ 3b6:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 3ba:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 3be:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c1:	0f b6 00             	movzbl (%eax),%eax
+ 3c4:	84 c0                	test   %al,%al
+ 3c6:	74 10                	je     3d8 <strcmp+0x27>
+ 3c8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3cb:	0f b6 10             	movzbl (%eax),%edx
+ 3ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3d1:	0f b6 00             	movzbl (%eax),%eax
+ 3d4:	38 c2                	cmp    %al,%dl
+ 3d6:	74 de                	je     3b6 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 3d8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3db:	0f b6 00             	movzbl (%eax),%eax
+ 3de:	0f b6 d0             	movzbl %al,%edx
+ 3e1:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3e4:	0f b6 00             	movzbl (%eax),%eax
+ 3e7:	0f b6 c0             	movzbl %al,%eax
+ 3ea:	29 c2                	sub    %eax,%edx
+ 3ec:	89 d0                	mov    %edx,%eax
+}
+ 3ee:	5d                   	pop    %ebp
+ 3ef:	c3                   	ret
+
+000003f0 <udiv64>:
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	57                   	push   %edi
+ 3f4:	56                   	push   %esi
+ 3f5:	83 ec 38             	sub    $0x38,%esp
+ 3f8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3fb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 3fe:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 401:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 404:	8b 45 10             	mov    0x10(%ebp),%eax
+ 407:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 40a:	8b 45 14             	mov    0x14(%ebp),%eax
+ 40d:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  q = r = 0;
+ 410:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 417:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 41e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 421:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 424:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 427:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 42a:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 431:	e9 85 00 00 00       	jmp    4bb <udiv64+0xcb>
+    r = (r << 1) | ((n >> i) & 1);
+ 436:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 439:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 43c:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 440:	01 c0                	add    %eax,%eax
+ 442:	89 c6                	mov    %eax,%esi
+ 444:	89 d7                	mov    %edx,%edi
+ 446:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 449:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 44c:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 44f:	0f ad d0             	shrd   %cl,%edx,%eax
+ 452:	d3 ea                	shr    %cl,%edx
+ 454:	f6 c1 20             	test   $0x20,%cl
+ 457:	74 04                	je     45d <udiv64+0x6d>
+ 459:	89 d0                	mov    %edx,%eax
+ 45b:	31 d2                	xor    %edx,%edx
+ 45d:	83 e0 01             	and    $0x1,%eax
+ 460:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 463:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+ 46a:	89 f0                	mov    %esi,%eax
+ 46c:	89 fa                	mov    %edi,%edx
+ 46e:	0b 45 c0             	or     -0x40(%ebp),%eax
+ 471:	0b 55 c4             	or     -0x3c(%ebp),%edx
+ 474:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 477:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 47a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 47d:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 480:	3b 45 c8             	cmp    -0x38(%ebp),%eax
+ 483:	89 d0                	mov    %edx,%eax
+ 485:	1b 45 cc             	sbb    -0x34(%ebp),%eax
+ 488:	72 2d                	jb     4b7 <udiv64+0xc7>
+      r -= d;
+ 48a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+ 48d:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 490:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 493:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64_t)1 << i;
+ 496:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 499:	b8 01 00 00 00       	mov    $0x1,%eax
+ 49e:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4a3:	0f a5 c2             	shld   %cl,%eax,%edx
+ 4a6:	d3 e0                	shl    %cl,%eax
+ 4a8:	f6 c1 20             	test   $0x20,%cl
+ 4ab:	74 04                	je     4b1 <udiv64+0xc1>
+ 4ad:	89 c2                	mov    %eax,%edx
+ 4af:	31 c0                	xor    %eax,%eax
+ 4b1:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 4b4:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 4b7:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 4bb:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 4bf:	0f 89 71 ff ff ff    	jns    436 <udiv64+0x46>
+  if(rem)
+ 4c5:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+ 4c9:	74 0e                	je     4d9 <udiv64+0xe9>
+    *rem = r;
+ 4cb:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 4ce:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 4d1:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 4d4:	89 01                	mov    %eax,(%ecx)
+ 4d6:	89 51 04             	mov    %edx,0x4(%ecx)
+  return q;
+ 4d9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 4dc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 4df:	83 c4 38             	add    $0x38,%esp
+ 4e2:	5e                   	pop    %esi
+ 4e3:	5f                   	pop    %edi
+ 4e4:	5d                   	pop    %ebp
+ 4e5:	c3                   	ret
+
+000004e6 <crc32cinit>:
+{
+ 4e6:	55                   	push   %ebp
+ 4e7:	89 e5                	mov    %esp,%ebp
+ 4e9:	83 ec 20             	sub    $0x20,%esp
+  for(i = 0; i < 256; i++){
+ 4ec:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 4f3:	eb 4c                	jmp    541 <crc32cinit+0x5b>
+    r = i;
+ 4f5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 4f8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+ 4fb:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+ 502:	eb 26                	jmp    52a <crc32cinit+0x44>
+      r = (r >> 1) ^ ((r & 1) ? CRC32C_POLY : 0);
+ 504:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 507:	d1 e8                	shr    %eax
+ 509:	89 c2                	mov    %eax,%edx
+ 50b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 50e:	83 e0 01             	and    $0x1,%eax
+ 511:	85 c0                	test   %eax,%eax
+ 513:	74 07                	je     51c <crc32cinit+0x36>
+ 515:	b8 78 3b f6 82       	mov    $0x82f63b78,%eax
+ 51a:	eb 05                	jmp    521 <crc32cinit+0x3b>
+ 51c:	b8 00 00 00 00       	mov    $0x0,%eax
+ 521:	31 d0                	xor    %edx,%eax
+ 523:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+ 526:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+ 52a:	83 7d f8 07          	cmpl   $0x7,-0x8(%ebp)
+ 52e:	76 d4                	jbe    504 <crc32cinit+0x1e>
+    crc32ctab[i] = r;
+ 530:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 533:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 536:	89 14 85 60 0f 00 00 	mov    %edx,0xf60(,%eax,4)
+  for(i = 0; i < 256; i++){
+ 53d:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 541:	81 7d fc ff 00 00 00 	cmpl   $0xff,-0x4(%ebp)
+ 548:	76 ab                	jbe    4f5 <crc32cinit+0xf>
+  cpuinfo(1, &a, &b, &c, &d);
+ 54a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 54d:	50                   	push   %eax
+ 54e:	8d 45 e8             	lea    -0x18(%ebp),%eax
+ 551:	50                   	push   %eax
+ 552:	8d 45 ec             	lea    -0x14(%ebp),%eax
+ 555:	50                   	push   %eax
+ 556:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 559:	50                   	push   %eax
+ 55a:	6a 01                	push   $0x1
+ 55c:	e8 d7 fd ff ff       	call   338 <cpuinfo>
+ 561:	83 c4 14             	add    $0x14,%esp
+  crc32chw = (c & CPUID_SSE42) != 0;
+ 564:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 567:	25 00 00 10 00       	and    $0x100000,%eax
+ 56c:	85 c0                	test   %eax,%eax
+ 56e:	0f 95 c0             	setne  %al
+ 571:	0f b6 c0             	movzbl %al,%eax
+ 574:	a3 2c 0f 00 00       	mov    %eax,0xf2c
+}
+ 579:	90                   	nop
+ 57a:	c9                   	leave
+ 57b:	c3                   	ret
+
+0000057c <crc32c>:
+{
+ 57c:	55                   	push   %ebp
+ 57d:	89 e5                	mov    %esp,%ebp
+ 57f:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s = p;
+ 582:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 585:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(crc32chw < 0)
+ 588:	a1 2c 0f 00 00       	mov    0xf2c,%eax
+ 58d:	85 c0                	test   %eax,%eax
+ 58f:	79 05                	jns    596 <crc32c+0x1a>
+    crc32cinit();
+ 591:	e8 50 ff ff ff       	call   4e6 <crc32cinit>
+  crc = ~crc;
+ 596:	f7 55 08             	notl   0x8(%ebp)
+  if(crc32chw){
+ 599:	a1 2c 0f 00 00       	mov    0xf2c,%eax
+ 59e:	85 c0                	test   %eax,%eax
+ 5a0:	74 6c                	je     60e <crc32c+0x92>
+    for(; n >= 4; n -= 4, s += 4)
+ 5a2:	eb 18                	jmp    5bc <crc32c+0x40>
+      asm("crc32l %1, %0" : "+r" (crc) : "rm" (*(const uint*)s));
+ 5a4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 5a7:	8b 10                	mov    (%eax),%edx
+ 5a9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5ac:	f2 0f 38 f1 c2       	crc32  %edx,%eax
+ 5b1:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n >= 4; n -= 4, s += 4)
+ 5b4:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+ 5b8:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+ 5bc:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+ 5c0:	77 e2                	ja     5a4 <crc32c+0x28>
+    for(; n > 0; n--, s++)
+ 5c2:	eb 19                	jmp    5dd <crc32c+0x61>
+      asm("crc32b %1, %0" : "+r" (crc) : "qm" (*s));
+ 5c4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 5c7:	0f b6 10             	movzbl (%eax),%edx
+ 5ca:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5cd:	f2 0f 38 f0 c2       	crc32  %dl,%eax
+ 5d2:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+ 5d5:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+ 5d9:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 5dd:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 5e1:	75 e1                	jne    5c4 <crc32c+0x48>
+ 5e3:	eb 2f                	jmp    614 <crc32c+0x98>
+      crc = crc32ctab[(crc ^ *s) & 0xff] ^ (crc >> 8);
+ 5e5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 5e8:	0f b6 00             	movzbl (%eax),%eax
+ 5eb:	0f b6 c0             	movzbl %al,%eax
+ 5ee:	33 45 08             	xor    0x8(%ebp),%eax
+ 5f1:	0f b6 c0             	movzbl %al,%eax
+ 5f4:	8b 04 85 60 0f 00 00 	mov    0xf60(,%eax,4),%eax
+ 5fb:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5fe:	c1 ea 08             	shr    $0x8,%edx
+ 601:	31 d0                	xor    %edx,%eax
+ 603:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+ 606:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+ 60a:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 60e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 612:	75 d1                	jne    5e5 <crc32c+0x69>
+  return ~crc;
+ 614:	8b 45 08             	mov    0x8(%ebp),%eax
+ 617:	f7 d0                	not    %eax
+}
+ 619:	c9                   	leave
+ 61a:	c3                   	ret
+
+0000061b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 61b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <exit>:
+SYSCALL(exit)
+ 623:	b8 02 00 00 00       	mov    $0x2,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <wait>:
+SYSCALL(wait)
+ 62b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <pipe>:
+SYSCALL(pipe)
+ 633:	b8 04 00 00 00       	mov    $0x4,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <read>:
+SYSCALL(read)
+ 63b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <write>:
+SYSCALL(write)
+ 643:	b8 10 00 00 00       	mov    $0x10,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <close>:
+SYSCALL(close)
+ 64b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <kill>:
+SYSCALL(kill)
+ 653:	b8 06 00 00 00       	mov    $0x6,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <exec>:
+SYSCALL(exec)
+ 65b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <open>:
+SYSCALL(open)
+ 663:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <mknod>:
+SYSCALL(mknod)
+ 66b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <unlink>:
+SYSCALL(unlink)
+ 673:	b8 12 00 00 00       	mov    $0x12,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+
+0000067b <fstat>:
+SYSCALL(fstat)
+ 67b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <link>:
+SYSCALL(link)
+ 683:	b8 13 00 00 00       	mov    $0x13,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <mkdir>:
+SYSCALL(mkdir)
+ 68b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <chdir>:
+SYSCALL(chdir)
+ 693:	b8 09 00 00 00       	mov    $0x9,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <dup>:
+SYSCALL(dup)
+ 69b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <getpid>:
+SYSCALL(getpid)
+ 6a3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 6a8:	cd 40                	int    $0x40
+ 6aa:	c3                   	ret
+
+000006ab <sbrk>:
+SYSCALL(sbrk)
+ 6ab:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <sleep>:
+SYSCALL(sleep)
+ 6b3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+
+000006bb <uptime>:
+SYSCALL(uptime)
+ 6bb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 6c0:	cd 40                	int    $0x40
+ 6c2:	c3                   	ret
+
+000006c3 <arp>:
+SYSCALL(arp)
+ 6c3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+
+000006cb <ifstat>:
+SYSCALL(ifstat)
+ 6cb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 6d0:	cd 40                	int    $0x40
+ 6d2:	c3                   	ret
+
+000006d3 <pcapctl>:
+SYSCALL(pcapctl)
+ 6d3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 6d8:	cd 40                	int    $0x40
+ 6da:	c3                   	ret
+
+000006db <pcapread>:
+SYSCALL(pcapread)
+ 6db:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6e0:	cd 40                	int    $0x40
+ 6e2:	c3                   	ret
+
+000006e3 <bpfattach>:
+SYSCALL(bpfattach)
+ 6e3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6e8:	cd 40                	int    $0x40
+ 6ea:	c3                   	ret
+
+000006eb <pktgen>:
+SYSCALL(pktgen)
+ 6eb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6f0:	cd 40                	int    $0x40
+ 6f2:	c3                   	ret
+
+000006f3 <reflect>:
+SYSCALL(reflect)
+ 6f3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6f8:	cd 40                	int    $0x40
+ 6fa:	c3                   	ret
+
+000006fb <brctl>:
+SYSCALL(brctl)
+ 6fb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 700:	cd 40                	int    $0x40
+ 702:	c3                   	ret
+
+00000703 <hostopen>:
+SYSCALL(hostopen)
+ 703:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 708:	cd 40                	int    $0x40
+ 70a:	c3                   	ret
+
+0000070b <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 70b:	55                   	push   %ebp
+ 70c:	89 e5                	mov    %esp,%ebp
+ 70e:	83 ec 18             	sub    $0x18,%esp
+ 711:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 714:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 717:	83 ec 04             	sub    $0x4,%esp
+ 71a:	6a 01                	push   $0x1
+ 71c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 71f:	50                   	push   %eax
+ 720:	ff 75 08             	push   0x8(%ebp)
+ 723:	e8 1b ff ff ff       	call   643 <write>
+ 728:	83 c4 10             	add    $0x10,%esp
+}
+ 72b:	90                   	nop
+ 72c:	c9                   	leave
+ 72d:	c3                   	ret
+
+0000072e <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 72e:	55                   	push   %ebp
+ 72f:	89 e5                	mov    %esp,%ebp
+ 731:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 734:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 73b:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 73f:	74 17                	je     758 <printint+0x2a>
+ 741:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 745:	79 11                	jns    758 <printint+0x2a>
+    neg = 1;
+ 747:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 74e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 751:	f7 d8                	neg    %eax
+ 753:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 756:	eb 06                	jmp    75e <printint+0x30>
+  } else {
+    x = xx;
+ 758:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 75b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 75e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 765:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 768:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 76b:	ba 00 00 00 00       	mov    $0x0,%edx
+ 770:	f7 f1                	div    %ecx
+ 772:	89 d1                	mov    %edx,%ecx
+ 774:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 777:	8d 50 01             	lea    0x1(%eax),%edx
+ 77a:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 77d:	0f b6 91 30 0f 00 00 	movzbl 0xf30(%ecx),%edx
+ 784:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 788:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 78b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 78e:	ba 00 00 00 00       	mov    $0x0,%edx
+ 793:	f7 f1                	div    %ecx
+ 795:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 798:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 79c:	75 c7                	jne    765 <printint+0x37>
+  if(neg)
+ 79e:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 7a2:	74 2d                	je     7d1 <printint+0xa3>
+    buf[i++] = '-';
+ 7a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7a7:	8d 50 01             	lea    0x1(%eax),%edx
+ 7aa:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 7ad:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 7b2:	eb 1d                	jmp    7d1 <printint+0xa3>
+    putc(fd, buf[i]);
+ 7b4:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 7b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7ba:	01 d0                	add    %edx,%eax
+ 7bc:	0f b6 00             	movzbl (%eax),%eax
+ 7bf:	0f be c0             	movsbl %al,%eax
+ 7c2:	83 ec 08             	sub    $0x8,%esp
+ 7c5:	50                   	push   %eax
+ 7c6:	ff 75 08             	push   0x8(%ebp)
+ 7c9:	e8 3d ff ff ff       	call   70b <putc>
+ 7ce:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 7d1:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 7d5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 7d9:	79 d9                	jns    7b4 <printint+0x86>
+}
+ 7db:	90                   	nop
+ 7dc:	90                   	nop
+ 7dd:	c9                   	leave
+ 7de:	c3                   	ret
+
+000007df <printf>:
+
+// Print to the given fd. Only understands %d, %u, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 7df:	55                   	push   %ebp
+ 7e0:	89 e5                	mov    %esp,%ebp
+ 7e2:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 7e5:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 7ec:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 7ef:	83 c0 04             	add    $0x4,%eax
+ 7f2:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 7f5:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 7fc:	e9 7d 01 00 00       	jmp    97e <printf+0x19f>
+    c = fmt[i] & 0xff;
+ 801:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 804:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 807:	01 d0                	add    %edx,%eax
+ 809:	0f b6 00             	movzbl (%eax),%eax
+ 80c:	0f be c0             	movsbl %al,%eax
+ 80f:	25 ff 00 00 00       	and    $0xff,%eax
+ 814:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 817:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 81b:	75 2c                	jne    849 <printf+0x6a>
+      if(c == '%'){
+ 81d:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 821:	75 0c                	jne    82f <printf+0x50>
+        state = '%';
+ 823:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 82a:	e9 4b 01 00 00       	jmp    97a <printf+0x19b>
+      } else {
+        putc(fd, c);
+ 82f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 832:	0f be c0             	movsbl %al,%eax
+ 835:	83 ec 08             	sub    $0x8,%esp
+ 838:	50                   	push   %eax
+ 839:	ff 75 08             	push   0x8(%ebp)
+ 83c:	e8 ca fe ff ff       	call   70b <putc>
+ 841:	83 c4 10             	add    $0x10,%esp
+ 844:	e9 31 01 00 00       	jmp    97a <printf+0x19b>
+      }
+    } else if(state == '%'){
+ 849:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 84d:	0f 85 27 01 00 00    	jne    97a <printf+0x19b>
+      if(c == 'd'){
+ 853:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 857:	75 1e                	jne    877 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 859:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 85c:	8b 00                	mov    (%eax),%eax
+ 85e:	6a 01                	push   $0x1
+ 860:	6a 0a                	push   $0xa
+ 862:	50                   	push   %eax
+ 863:	ff 75 08             	push   0x8(%ebp)
+ 866:	e8 c3 fe ff ff       	call   72e <printint>
+ 86b:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 86e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 872:	e9 fc 00 00 00       	jmp    973 <printf+0x194>
+      } else if(c == 'u'){
+ 877:	83 7d e4 75          	cmpl   $0x75,-0x1c(%ebp)
+ 87b:	75 1e                	jne    89b <printf+0xbc>
+        printint(fd, *ap, 10, 0);
+ 87d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 880:	8b 00                	mov    (%eax),%eax
+ 882:	6a 00                	push   $0x0
+ 884:	6a 0a                	push   $0xa
+ 886:	50                   	push   %eax
+ 887:	ff 75 08             	push   0x8(%ebp)
+ 88a:	e8 9f fe ff ff       	call   72e <printint>
+ 88f:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 892:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 896:	e9 d8 00 00 00       	jmp    973 <printf+0x194>
+      } else if(c == 'x' || c == 'p'){
+ 89b:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 89f:	74 06                	je     8a7 <printf+0xc8>
+ 8a1:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 8a5:	75 1e                	jne    8c5 <printf+0xe6>
+        printint(fd, *ap, 16, 0);
+ 8a7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8aa:	8b 00                	mov    (%eax),%eax
+ 8ac:	6a 00                	push   $0x0
+ 8ae:	6a 10                	push   $0x10
+ 8b0:	50                   	push   %eax
+ 8b1:	ff 75 08             	push   0x8(%ebp)
+ 8b4:	e8 75 fe ff ff       	call   72e <printint>
+ 8b9:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 8bc:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 8c0:	e9 ae 00 00 00       	jmp    973 <printf+0x194>
+      } else if(c == 's'){
+ 8c5:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 8c9:	75 43                	jne    90e <printf+0x12f>
+        s = (char*)*ap;
+ 8cb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8ce:	8b 00                	mov    (%eax),%eax
+ 8d0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 8d3:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 8d7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 8db:	75 25                	jne    902 <printf+0x123>
+          s = "(null)";
+ 8dd:	c7 45 f4 4d 0c 00 00 	movl   $0xc4d,-0xc(%ebp)
+        while(*s != 0){
+ 8e4:	eb 1c                	jmp    902 <printf+0x123>
+          putc(fd, *s);
+ 8e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8e9:	0f b6 00             	movzbl (%eax),%eax
+ 8ec:	0f be c0             	movsbl %al,%eax
+ 8ef:	83 ec 08             	sub    $0x8,%esp
+ 8f2:	50                   	push   %eax
+ 8f3:	ff 75 08             	push   0x8(%ebp)
+ 8f6:	e8 10 fe ff ff       	call   70b <putc>
+ 8fb:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 8fe:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 902:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 905:	0f b6 00             	movzbl (%eax),%eax
+ 908:	84 c0                	test   %al,%al
+ 90a:	75 da                	jne    8e6 <printf+0x107>
+ 90c:	eb 65                	jmp    973 <printf+0x194>
+        }
+      } else if(c == 'c'){
+ 90e:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 912:	75 1d                	jne    931 <printf+0x152>
+        putc(fd, *ap);
+ 914:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 917:	8b 00                	mov    (%eax),%eax
+ 919:	0f be c0             	movsbl %al,%eax
+ 91c:	83 ec 08             	sub    $0x8,%esp
+ 91f:	50                   	push   %eax
+ 920:	ff 75 08             	push   0x8(%ebp)
+ 923:	e8 e3 fd ff ff       	call   70b <putc>
+ 928:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 92b:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 92f:	eb 42                	jmp    973 <printf+0x194>
+      } else if(c == '%'){
+ 931:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 935:	75 17                	jne    94e <printf+0x16f>
+        putc(fd, c);
+ 937:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 93a:	0f be c0             	movsbl %al,%eax
+ 93d:	83 ec 08             	sub    $0x8,%esp
+ 940:	50                   	push   %eax
+ 941:	ff 75 08             	push   0x8(%ebp)
+ 944:	e8 c2 fd ff ff       	call   70b <putc>
+ 949:	83 c4 10             	add    $0x10,%esp
+ 94c:	eb 25                	jmp    973 <printf+0x194>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 94e:	83 ec 08             	sub    $0x8,%esp
+ 951:	6a 25                	push   $0x25
+ 953:	ff 75 08             	push   0x8(%ebp)
+ 956:	e8 b0 fd ff ff       	call   70b <putc>
+ 95b:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 95e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 961:	0f be c0             	movsbl %al,%eax
+ 964:	83 ec 08             	sub    $0x8,%esp
+ 967:	50                   	push   %eax
+ 968:	ff 75 08             	push   0x8(%ebp)
+ 96b:	e8 9b fd ff ff       	call   70b <putc>
+ 970:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 973:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 97a:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 97e:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 981:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 984:	01 d0                	add    %edx,%eax
+ 986:	0f b6 00             	movzbl (%eax),%eax
+ 989:	84 c0                	test   %al,%al
+ 98b:	0f 85 70 fe ff ff    	jne    801 <printf+0x22>
+    }
+  }
+}
+ 991:	90                   	nop
+ 992:	90                   	nop
+ 993:	c9                   	leave
+ 994:	c3                   	ret
+
+00000995 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 995:	55                   	push   %ebp
+ 996:	89 e5                	mov    %esp,%ebp
+ 998:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 99b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 99e:	83 e8 08             	sub    $0x8,%eax
+ 9a1:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9a4:	a1 68 13 00 00       	mov    0x1368,%eax
+ 9a9:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 9ac:	eb 24                	jmp    9d2 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9ae:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9b1:	8b 00                	mov    (%eax),%eax
+ 9b3:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 9b6:	72 12                	jb     9ca <free+0x35>
+ 9b8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9bb:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 9be:	72 24                	jb     9e4 <free+0x4f>
+ 9c0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9c3:	8b 00                	mov    (%eax),%eax
+ 9c5:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 9c8:	72 1a                	jb     9e4 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9ca:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9cd:	8b 00                	mov    (%eax),%eax
+ 9cf:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 9d2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9d5:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 9d8:	73 d4                	jae    9ae <free+0x19>
+ 9da:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9dd:	8b 00                	mov    (%eax),%eax
+ 9df:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 9e2:	73 ca                	jae    9ae <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 9e4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9e7:	8b 40 04             	mov    0x4(%eax),%eax
+ 9ea:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 9f1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9f4:	01 c2                	add    %eax,%edx
+ 9f6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9f9:	8b 00                	mov    (%eax),%eax
+ 9fb:	39 c2                	cmp    %eax,%edx
+ 9fd:	75 24                	jne    a23 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 9ff:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a02:	8b 50 04             	mov    0x4(%eax),%edx
+ a05:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a08:	8b 00                	mov    (%eax),%eax
+ a0a:	8b 40 04             	mov    0x4(%eax),%eax
+ a0d:	01 c2                	add    %eax,%edx
+ a0f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a12:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a15:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a18:	8b 00                	mov    (%eax),%eax
+ a1a:	8b 10                	mov    (%eax),%edx
+ a1c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a1f:	89 10                	mov    %edx,(%eax)
+ a21:	eb 0a                	jmp    a2d <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ a23:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a26:	8b 10                	mov    (%eax),%edx
+ a28:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a2b:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ a2d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a30:	8b 40 04             	mov    0x4(%eax),%eax
+ a33:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ a3a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a3d:	01 d0                	add    %edx,%eax
+ a3f:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a42:	75 20                	jne    a64 <free+0xcf>
+    p->s.size += bp->s.size;
+ a44:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a47:	8b 50 04             	mov    0x4(%eax),%edx
+ a4a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a4d:	8b 40 04             	mov    0x4(%eax),%eax
+ a50:	01 c2                	add    %eax,%edx
+ a52:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a55:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ a58:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a5b:	8b 10                	mov    (%eax),%edx
+ a5d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a60:	89 10                	mov    %edx,(%eax)
+ a62:	eb 08                	jmp    a6c <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ a64:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a67:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ a6a:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ a6c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a6f:	a3 68 13 00 00       	mov    %eax,0x1368
+}
+ a74:	90                   	nop
+ a75:	c9                   	leave
+ a76:	c3                   	ret
+
+00000a77 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ a77:	55                   	push   %ebp
+ a78:	89 e5                	mov    %esp,%ebp
+ a7a:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ a7d:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ a84:	77 07                	ja     a8d <morecore+0x16>
+    nu = 4096;
+ a86:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ a8d:	8b 45 08             	mov    0x8(%ebp),%eax
+ a90:	c1 e0 03             	shl    $0x3,%eax
+ a93:	83 ec 0c             	sub    $0xc,%esp
+ a96:	50                   	push   %eax
+ a97:	e8 0f fc ff ff       	call   6ab <sbrk>
+ a9c:	83 c4 10             	add    $0x10,%esp
+ a9f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ aa2:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ aa6:	75 07                	jne    aaf <morecore+0x38>
+    return 0;
+ aa8:	b8 00 00 00 00       	mov    $0x0,%eax
+ aad:	eb 26                	jmp    ad5 <morecore+0x5e>
+  hp = (Header*)p;
+ aaf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ab2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ ab5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ab8:	8b 55 08             	mov    0x8(%ebp),%edx
+ abb:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ abe:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ac1:	83 c0 08             	add    $0x8,%eax
+ ac4:	83 ec 0c             	sub    $0xc,%esp
+ ac7:	50                   	push   %eax
+ ac8:	e8 c8 fe ff ff       	call   995 <free>
+ acd:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ ad0:	a1 68 13 00 00       	mov    0x1368,%eax
+}
+ ad5:	c9                   	leave
+ ad6:	c3                   	ret
+
+00000ad7 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ ad7:	55                   	push   %ebp
+ ad8:	89 e5                	mov    %esp,%ebp
+ ada:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ add:	8b 45 08             	mov    0x8(%ebp),%eax
+ ae0:	83 c0 07             	add    $0x7,%eax
+ ae3:	c1 e8 03             	shr    $0x3,%eax
+ ae6:	83 c0 01             	add    $0x1,%eax
+ ae9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ aec:	a1 68 13 00 00       	mov    0x1368,%eax
+ af1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ af4:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ af8:	75 23                	jne    b1d <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ afa:	c7 45 f0 60 13 00 00 	movl   $0x1360,-0x10(%ebp)
+ b01:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b04:	a3 68 13 00 00       	mov    %eax,0x1368
+ b09:	a1 68 13 00 00       	mov    0x1368,%eax
+ b0e:	a3 60 13 00 00       	mov    %eax,0x1360
+    base.s.size = 0;
+ b13:	c7 05 64 13 00 00 00 	movl   $0x0,0x1364
+ b1a:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b1d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b20:	8b 00                	mov    (%eax),%eax
+ b22:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ b25:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b28:	8b 40 04             	mov    0x4(%eax),%eax
+ b2b:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ b2e:	72 4d                	jb     b7d <malloc+0xa6>
+      if(p->s.size == nunits)
+ b30:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b33:	8b 40 04             	mov    0x4(%eax),%eax
+ b36:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ b39:	75 0c                	jne    b47 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ b3b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b3e:	8b 10                	mov    (%eax),%edx
+ b40:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b43:	89 10                	mov    %edx,(%eax)
+ b45:	eb 26                	jmp    b6d <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ b47:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b4a:	8b 40 04             	mov    0x4(%eax),%eax
+ b4d:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ b50:	89 c2                	mov    %eax,%edx
+ b52:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b55:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ b58:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b5b:	8b 40 04             	mov    0x4(%eax),%eax
+ b5e:	c1 e0 03             	shl    $0x3,%eax
+ b61:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ b64:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b67:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ b6a:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ b6d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b70:	a3 68 13 00 00       	mov    %eax,0x1368
+      return (void*)(p + 1);
+ b75:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b78:	83 c0 08             	add    $0x8,%eax
+ b7b:	eb 3b                	jmp    bb8 <malloc+0xe1>
+    }
+    if(p == freep)
+ b7d:	a1 68 13 00 00       	mov    0x1368,%eax
+ b82:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ b85:	75 1e                	jne    ba5 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ b87:	83 ec 0c             	sub    $0xc,%esp
+ b8a:	ff 75 ec             	push   -0x14(%ebp)
+ b8d:	e8 e5 fe ff ff       	call   a77 <morecore>
+ b92:	83 c4 10             	add    $0x10,%esp
+ b95:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ b98:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b9c:	75 07                	jne    ba5 <malloc+0xce>
+        return 0;
+ b9e:	b8 00 00 00 00       	mov    $0x0,%eax
+ ba3:	eb 13                	jmp    bb8 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ba5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ba8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ bab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bae:	8b 00                	mov    (%eax),%eax
+ bb0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ bb3:	e9 6d ff ff ff       	jmp    b25 <malloc+0x4e>
+  }
+}
+ bb8:	c9                   	leave
+ bb9:	c3                   	ret
@@ -0,0 +1,48 @@
+// hostcp: copy a file out of the host directory exported over virtio 9p.
+//
+//   hostcp hostpath         write it to standard output
+//   hostcp hostpath file    write it to file
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+char buf[8192];
+
+int
+main(int argc, char *argv[])
+{
+  int in, out, n, total;
+
+  if(argc != 2 && argc != 3){
+    printf(2, "usage: hostcp hostpath [file]\n");
+    exit();
+  }
+  if((in = hostopen(argv[1])) < 0){
+    printf(2, "hostcp: cannot open %s on the host\n", argv[1]);
+    exit();
+  }
+  out = 1;
+  if(argc == 3 && (out = open(argv[2], O_CREATE|O_WRONLY)) < 0){
+    printf(2, "hostcp: cannot create %s\n", argv[2]);
+    exit();
+  }
+
+  total = 0;
+  while((n = read(in, buf, sizeof(buf))) > 0){
+    if(write(out, buf, n) != n){
+      printf(2, "hostcp: write error\n");
+      exit();
+    }
+    total += n;
+  }
+  if(n < 0)
+    printf(2, "hostcp: read error\n");
+  if(argc == 3){
+    printf(1, "%d bytes\n", total);
+    close(out);
+  }
+  close(in);
+  exit();
+}
@@ -1,4 +1,5 @@
-// Simple PIO-based (non-DMA) IDE driver code.
+// Simple IDE driver code. Blocks move by bus master DMA if the PCI
+// IDE controller can do it (PIIX and friends), by PIO otherwise.
 
 #include "types.h"
 #include "defs.h"
@@ -6,7 +7,7 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "proc.h"
-#include "x86.h"
+#include "pci.h"
 #include "traps.h"
 #include "spinlock.h"
 #include "sleeplock.h"
@@ -23,16 +24,58 @@
 #define IDE_CMD_WRITE 0x30
 #define IDE_CMD_RDMUL 0xc4
 #define IDE_CMD_WRMUL 0xc5
+#define IDE_CMD_SETMUL 0xc6
+#define IDE_CMD_RDDMA 0xc8
+#define IDE_CMD_WRDMA 0xca
 
-// idequeue points to the buf now being read/written to the disk.
-// idequeue->qnext points to the next buf to be processed.
-// You must hold idelock while manipulating queue.
+// Bus master IDE registers of the primary channel, at the I/O
+// address in BAR 4 of the controller.
+#define BM_CMD        0       // command
+#define BM_STATUS     2       // status, the error and interrupt bits clear on write
+#define BM_PRDT       4       // physical address of the PRD table
+
+#define BM_CMD_START  0x01
+#define BM_CMD_READ   0x08    // device to memory
+#define BM_ST_ERR     0x02
+#define BM_ST_INTR    0x04
+
+// Mass storage, IDE, bus master capable.
+#define PCI_CLASS_IDE_BM   0x01018000
+#define PCI_CLASS_IDE_MASK 0xffff8000
+
+// A physical region descriptor: a piece of memory the controller
+// moves data to or from. It must not cross a 64 KiB boundary.
+struct prd {
+  uint addr;
+  ushort len;         // bytes, 0 is 64 KiB
+  ushort flags;
+};
+
+#define PRD_EOT       0x8000  // last descriptor of the table
+
+#define MAXSECTORS    128     // per command
+
+// idebusy points to the bufs now being read/written to the disk,
+// linked through qnext. idequeue points to the bufs waiting for it,
+// in the order they will be done.
+// You must hold idelock while manipulating the queues.
+//
+// The queue is an elevator that sweeps the disk upwards: the bufs at
+// or past idepos, where the last command ended, come first in block
+// order, then the ones below it, for the next sweep. With DMA a run
+// of queued bufs for adjacent blocks that go the same way is done by
+// one command.
 
 static struct spinlock idelock;
+static struct buf *idebusy;
 static struct buf *idequeue;
+static uint idepos;
 
 static int havedisk1;
-static void idestart(struct buf*);
+static void idestart(void);
+
+static uint bmbase;       // bus master registers, 0 to use PIO
+static struct prd *prdt;  // PRD table of the command being done
 
 // Wait for IDE disk to become ready.
 static int
@@ -47,6 +90,25 @@ idewait(int checkerr)
   return 0;
 }
 
+// Switch to DMA for a bus master IDE controller found by pci_init.
+// Disks work by PIO until then.
+static int
+ideprobe(struct pci_device *pci)
+{
+  struct prd *t;
+
+  if(pci->reg_base[4] == 0 || (t = (struct prd*)kalloc()) == 0)
+    return -1;
+  pci_set_master(pci);
+
+  acquire(&idelock);
+  prdt = t;
+  bmbase = pci->reg_base[4];
+  release(&idelock);
+  cprintf("ide: bus master dma at 0x%x\n", bmbase);
+  return 0;
+}
+
 void
 ideinit(void)
 {
@@ -67,31 +129,122 @@ ideinit(void)
 
   // Switch back to disk 0.
   outb(0x1f6, 0xe0 | (0<<4));
+
+  // PIO moves a block per interrupt: READ/WRITE MULTIPLE with a
+  // block's worth of sectors.
+  if(BSIZE/SECTOR_SIZE > 1){
+    for(i = 0; i <= havedisk1; i++){
+      outb(0x1f6, 0xe0 | (i<<4));
+      outb(0x1f2, BSIZE/SECTOR_SIZE);
+      outb(0x1f7, IDE_CMD_SETMUL);
+      idewait(0);
+    }
+    outb(0x1f6, 0xe0 | (0<<4));
+  }
+
+  struct pci_driver d = {
+    .name = "ide", .vendor = PCI_ANY_ID, .device = PCI_ANY_ID,
+    .class = PCI_CLASS_IDE_BM, .class_mask = PCI_CLASS_IDE_MASK,
+    .probe = &ideprobe,
+  };
+  pci_register_driver(&d);
 }
 
-// Start the request for b.  Caller must hold idelock.
+// Describe the data of the bufs in the PRD table and point the
+// controller at it.
 static void
-idestart(struct buf *b)
+dmaprep(struct buf *b)
 {
-  if(b == 0)
+  uint pa, n, left;
+  int write;
+  struct prd *p;
+
+  write = b->flags & B_DIRTY;
+  for(p = prdt; b; b = b->qnext){
+    pa = V2P(b->data);
+    for(left = BSIZE; left > 0; p++){
+      n = 0x10000 - (pa & 0xffff);
+      if(n > left)
+        n = left;
+      p->addr = pa;
+      p->len = n;
+      p->flags = 0;
+      pa += n;
+      left -= n;
+    }
+  }
+  p[-1].flags = PRD_EOT;
+
+  outl(bmbase + BM_PRDT, V2P(prdt));
+  outb(bmbase + BM_CMD, write ? 0 : BM_CMD_READ);
+  outb(bmbase + BM_STATUS, inb(bmbase + BM_STATUS) | BM_ST_ERR | BM_ST_INTR);
+}
+
+// Position of b in the elevator's sweep.
+static uint
+bpos(struct buf *b)
+{
+  return b->dev << 28 | b->blockno;
+}
+
+// Does a come before b in the elevator's order?
+static int
+before(struct buf *a, struct buf *b)
+{
+  uint pa = bpos(a), pb = bpos(b);
+
+  if((pa >= idepos) != (pb >= idepos))
+    return pa >= idepos;
+  return pa < pb;
+}
+
+// Can b be done by the same command as a, which comes right before it?
+static int
+mergeable(struct buf *a, struct buf *b)
+{
+  return a->dev == b->dev && a->blockno + 1 == b->blockno &&
+    (a->flags & B_DIRTY) == (b->flags & B_DIRTY);
+}
+
+// Start the bufs at the head of idequeue, merged into one command if
+// they can be. Caller must hold idelock, and the disk must be idle.
+static void
+idestart(void)
+{
+  struct buf *b, *last;
+  int n;
+
+  if((b = idequeue) == 0 || idebusy != 0)
     panic("idestart");
-  if(b->blockno >= FSSIZE)
-    panic("incorrect blockno");
   int sector_per_block =  BSIZE/SECTOR_SIZE;
   int sector = b->blockno * sector_per_block;
   int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
   int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
 
-  if (sector_per_block > 7) panic("idestart");
+  if (sector_per_block > 16) panic("idestart");
+
+  // PIO moves one block per command.
+  last = b;
+  for(n = 1; bmbase && last->qnext && mergeable(last, last->qnext) &&
+             (n+1)*sector_per_block <= MAXSECTORS; n++)
+    last = last->qnext;
+  idequeue = last->qnext;
+  last->qnext = 0;
+  idebusy = b;
+  idepos = bpos(last) + 1;
 
   idewait(0);
   outb(0x3f6, 0);  // generate interrupt
-  outb(0x1f2, sector_per_block);  // number of sectors
+  outb(0x1f2, n * sector_per_block);  // number of sectors
   outb(0x1f3, sector & 0xff);
   outb(0x1f4, (sector >> 8) & 0xff);
   outb(0x1f5, (sector >> 16) & 0xff);
   outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
-  if(b->flags & B_DIRTY){
+  if(bmbase){
+    dmaprep(b);
+    outb(0x1f7, (b->flags & B_DIRTY) ? IDE_CMD_WRDMA : IDE_CMD_RDDMA);
+    outb(bmbase + BM_CMD, inb(bmbase + BM_CMD) | BM_CMD_START);
+  } else if(b->flags & B_DIRTY){
     outb(0x1f7, write_cmd);
     outsl(0x1f0, b->data, BSIZE/4);
   } else {
@@ -103,29 +256,55 @@ idestart(struct buf *b)
 void
 ideintr(void)
 {
-  struct buf *b;
+  struct buf *b, *next;
+  int st;
 
-  // First queued buffer is the active request.
+  // The busy bufs are the active command.
   acquire(&idelock);
 
-  if((b = idequeue) == 0){
+  if((b = idebusy) == 0){
     release(&idelock);
     return;
   }
-  idequeue = b->qnext;
 
-  // Read data if needed.
-  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
+  if(bmbase){
+    st = inb(bmbase + BM_STATUS);
+    if((st & (BM_ST_INTR|BM_ST_ERR)) == 0){
+      // Not the end of the transfer.
+      release(&idelock);
+      return;
+    }
+    outb(bmbase + BM_CMD, 0);
+    outb(bmbase + BM_STATUS, st);
+    idewait(0);
+    if(st & BM_ST_ERR){
+      // Put the bufs back in front of the queue and redo them.
+      cprintf("ide: dma error, using pio\n");
+      bmbase = 0;
+      for(next = b; next->qnext; next = next->qnext)
+        ;
+      next->qnext = idequeue;
+      idequeue = b;
+      idebusy = 0;
+      idestart();
+      release(&idelock);
+      return;
+    }
+  } else if(!(b->flags & B_DIRTY) && idewait(1) >= 0){
+    // Read data if needed.
     insl(0x1f0, b->data, BSIZE/4);
+  }
+  idebusy = 0;
 
-  // Wake process waiting for this buf.
-  b->flags |= B_VALID;
-  b->flags &= ~B_DIRTY;
-  wakeup(b);
+  // Wake processes waiting for these bufs.
+  for(; b; b = next){
+    next = b->qnext;
+    biodone(b);
+  }
 
-  // Start disk on next buf in queue.
+  // Start disk on next bufs in queue.
   if(idequeue != 0)
-    idestart(idequeue);
+    idestart();
 
   release(&idelock);
 }
@@ -137,32 +316,62 @@ ideintr(void)
 void
 iderw(struct buf *b)
 {
-  struct buf **pp;
+  iderwv(&b, 1);
+}
 
-  if(!holdingsleep(&b->lock))
-    panic("iderw: buf not locked");
-  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
-    panic("iderw: nothing to do");
-  if(b->dev != 0 && !havedisk1)
-    panic("iderw: ide disk 1 not present");
+// Sync n bufs, all of one disk, as iderw does. They are all
+// queued before waiting for any, so the elevator can sort and
+// merge them, or, on a virtio disk, all posted in one go.
+// Read-ahead bufs (B_ASYNC) are not waited for; a batch is either
+// all read-ahead or none.
+void
+iderwv(struct buf **bufs, int n)
+{
+  struct buf *b, **pp;
+  int i, async;
 
-  acquire(&idelock);  //DOC:acquire-lock
+  async = n > 0 && (bufs[0]->flags & B_ASYNC);
+  for(i = 0; i < n; i++){
+    b = bufs[i];
+    if(!holdingsleep(&b->lock))
+      panic("iderw: buf not locked");
+    if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+      panic("iderw: nothing to do");
+    if(b->blockno >= FSSIZE)
+      panic("incorrect blockno");
+    if(((b->flags & B_ASYNC) != 0) != async || b->dev != bufs[0]->dev)
+      panic("iderw: mixed batch");
+  }
 
-  // Append b to idequeue.
-  b->qnext = 0;
-  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
-    ;
-  *pp = b;
+  // A virtio disk, if there is one, takes over disk 1.
+  if(n > 0 && bufs[0]->dev != 0 && virtioblk_rwv(bufs, n) == 0)
+    return;
 
-  // Start disk if necessary.
-  if(idequeue == b)
-    idestart(b);
+  for(i = 0; i < n; i++){
+    b = bufs[i];
+    if(b->dev != 0 && !havedisk1)
+      panic("iderw: ide disk 1 not present");
 
-  // Wait for request to finish.
-  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
-    sleep(b, &idelock);
+    acquire(&idelock);  //DOC:acquire-lock
+    for(pp=&idequeue; *pp && !before(b, *pp); pp=&(*pp)->qnext)  //DOC:insert-queue
+      ;
+    b->qnext = *pp;
+    *pp = b;
+    release(&idelock);
   }
 
+  acquire(&idelock);
+
+  // Start disk if necessary.
+  if(idebusy == 0 && idequeue != 0)
+    idestart();
+
+  // Wait for requests to finish.
+  for(i = 0; i < n && !async; i++){
+    while((bufs[i]->flags & (B_VALID|B_DIRTY)) != B_VALID){
+      sleep(bufs[i], &idelock);
+    }
+  }
 
   release(&idelock);
 }
@@ -0,0 +1,30 @@
+#ifndef __XV6_NETSTACK_IFSTAT_H__
+#define __XV6_NETSTACK_IFSTAT_H__
+// Network interface statistics.
+// Both the kernel and user programs use this header file.
+
+#define IFNAMSIZ    8  // interface name, including the terminating 0
+
+#define NIC_NQUEUE  2  // queues tracked per interface
+#define NIC_RXQ     0  // receive queue
+#define NIC_TXQ     1  // transmit queue
+
+// Counters for one queue. They are free running and wrap around,
+// so consumers should only ever look at differences.
+struct ifqstat {
+  uint packets;   // frames moved through the queue
+  uint bytes;     // payload bytes of those frames
+  uint drops;     // frames dropped by the driver
+  uint ringfull;  // submissions that found no free descriptor
+  uint notifies;  // doorbell writes to the device
+  uint intrs;     // interrupts that found work on the queue
+};
+
+// Per-interface snapshot returned by the ifstat system call.
+struct ifstat {
+  char name[IFNAMSIZ];
+  uchar mac[6];
+  struct ifqstat q[NIC_NQUEUE];
+};
+
+#endif
@@ -0,0 +1,1456 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char *argv[] = { "sh", 0 };
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 14             	sub    $0x14,%esp
+  int pid, wpid;
+
+  if(open("console", O_RDWR) < 0){
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	6a 02                	push   $0x2
+  16:	68 49 0b 00 00       	push   $0xb49
+  1b:	e8 cf 05 00 00       	call   5ef <open>
+  20:	83 c4 10             	add    $0x10,%esp
+  23:	85 c0                	test   %eax,%eax
+  25:	79 26                	jns    4d <main+0x4d>
+    mknod("console", 1, 1);
+  27:	83 ec 04             	sub    $0x4,%esp
+  2a:	6a 01                	push   $0x1
+  2c:	6a 01                	push   $0x1
+  2e:	68 49 0b 00 00       	push   $0xb49
+  33:	e8 bf 05 00 00       	call   5f7 <mknod>
+  38:	83 c4 10             	add    $0x10,%esp
+    open("console", O_RDWR);
+  3b:	83 ec 08             	sub    $0x8,%esp
+  3e:	6a 02                	push   $0x2
+  40:	68 49 0b 00 00       	push   $0xb49
+  45:	e8 a5 05 00 00       	call   5ef <open>
+  4a:	83 c4 10             	add    $0x10,%esp
+  }
+  dup(0);  // stdout
+  4d:	83 ec 0c             	sub    $0xc,%esp
+  50:	6a 00                	push   $0x0
+  52:	e8 d0 05 00 00       	call   627 <dup>
+  57:	83 c4 10             	add    $0x10,%esp
+  dup(0);  // stderr
+  5a:	83 ec 0c             	sub    $0xc,%esp
+  5d:	6a 00                	push   $0x0
+  5f:	e8 c3 05 00 00       	call   627 <dup>
+  64:	83 c4 10             	add    $0x10,%esp
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+  67:	83 ec 08             	sub    $0x8,%esp
+  6a:	68 51 0b 00 00       	push   $0xb51
+  6f:	6a 01                	push   $0x1
+  71:	e8 f5 06 00 00       	call   76b <printf>
+  76:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+  79:	e8 29 05 00 00       	call   5a7 <fork>
+  7e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(pid < 0){
+  81:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  85:	79 17                	jns    9e <main+0x9e>
+      printf(1, "init: fork failed\n");
+  87:	83 ec 08             	sub    $0x8,%esp
+  8a:	68 64 0b 00 00       	push   $0xb64
+  8f:	6a 01                	push   $0x1
+  91:	e8 d5 06 00 00       	call   76b <printf>
+  96:	83 c4 10             	add    $0x10,%esp
+      exit();
+  99:	e8 11 05 00 00       	call   5af <exit>
+    }
+    if(pid == 0){
+  9e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  a2:	75 3e                	jne    e2 <main+0xe2>
+      exec("sh", argv);
+  a4:	83 ec 08             	sub    $0x8,%esp
+  a7:	68 74 0e 00 00       	push   $0xe74
+  ac:	68 46 0b 00 00       	push   $0xb46
+  b1:	e8 31 05 00 00       	call   5e7 <exec>
+  b6:	83 c4 10             	add    $0x10,%esp
+      printf(1, "init: exec sh failed\n");
+  b9:	83 ec 08             	sub    $0x8,%esp
+  bc:	68 77 0b 00 00       	push   $0xb77
+  c1:	6a 01                	push   $0x1
+  c3:	e8 a3 06 00 00       	call   76b <printf>
+  c8:	83 c4 10             	add    $0x10,%esp
+      exit();
+  cb:	e8 df 04 00 00       	call   5af <exit>
+    }
+    while((wpid=wait()) >= 0 && wpid != pid)
+      printf(1, "zombie!\n");
+  d0:	83 ec 08             	sub    $0x8,%esp
+  d3:	68 8d 0b 00 00       	push   $0xb8d
+  d8:	6a 01                	push   $0x1
+  da:	e8 8c 06 00 00       	call   76b <printf>
+  df:	83 c4 10             	add    $0x10,%esp
+    while((wpid=wait()) >= 0 && wpid != pid)
+  e2:	e8 d0 04 00 00       	call   5b7 <wait>
+  e7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  ea:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  ee:	0f 88 73 ff ff ff    	js     67 <main+0x67>
+  f4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  f7:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+  fa:	75 d4                	jne    d0 <main+0xd0>
+    printf(1, "init: starting sh\n");
+  fc:	e9 66 ff ff ff       	jmp    67 <main+0x67>
+
+00000101 <stosb>:
+}
+
+int
+stat(char *n, struct stat *st)
+{
+  int fd;
+ 101:	55                   	push   %ebp
+ 102:	89 e5                	mov    %esp,%ebp
+ 104:	57                   	push   %edi
+ 105:	53                   	push   %ebx
+  int r;
+ 106:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 109:	8b 55 10             	mov    0x10(%ebp),%edx
+ 10c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 10f:	89 cb                	mov    %ecx,%ebx
+ 111:	89 df                	mov    %ebx,%edi
+ 113:	89 d1                	mov    %edx,%ecx
+ 115:	fc                   	cld
+ 116:	f3 aa                	rep stos %al,%es:(%edi)
+ 118:	89 ca                	mov    %ecx,%edx
+ 11a:	89 fb                	mov    %edi,%ebx
+ 11c:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 11f:	89 55 10             	mov    %edx,0x10(%ebp)
+
+  fd = open(n, O_RDONLY);
+  if(fd < 0)
+    return -1;
+ 122:	90                   	nop
+ 123:	5b                   	pop    %ebx
+ 124:	5f                   	pop    %edi
+ 125:	5d                   	pop    %ebp
+ 126:	c3                   	ret
+
+00000127 <strcpy>:
+{
+ 127:	55                   	push   %ebp
+ 128:	89 e5                	mov    %esp,%ebp
+ 12a:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 12d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 130:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 133:	90                   	nop
+ 134:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 137:	8d 42 01             	lea    0x1(%edx),%eax
+ 13a:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 13d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 140:	8d 48 01             	lea    0x1(%eax),%ecx
+ 143:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 146:	0f b6 12             	movzbl (%edx),%edx
+ 149:	88 10                	mov    %dl,(%eax)
+ 14b:	0f b6 00             	movzbl (%eax),%eax
+ 14e:	84 c0                	test   %al,%al
+ 150:	75 e2                	jne    134 <strcpy+0xd>
+  return os;
+ 152:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 155:	c9                   	leave
+ 156:	c3                   	ret
+
+00000157 <strlen>:
+{
+ 157:	55                   	push   %ebp
+ 158:	89 e5                	mov    %esp,%ebp
+ 15a:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 15d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 164:	eb 04                	jmp    16a <strlen+0x13>
+ 166:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 16a:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 16d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 170:	01 d0                	add    %edx,%eax
+ 172:	0f b6 00             	movzbl (%eax),%eax
+ 175:	84 c0                	test   %al,%al
+ 177:	75 ed                	jne    166 <strlen+0xf>
+  return n;
+ 179:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 17c:	c9                   	leave
+ 17d:	c3                   	ret
+
+0000017e <memset>:
+{
+ 17e:	55                   	push   %ebp
+ 17f:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 181:	8b 45 10             	mov    0x10(%ebp),%eax
+ 184:	50                   	push   %eax
+ 185:	ff 75 0c             	push   0xc(%ebp)
+ 188:	ff 75 08             	push   0x8(%ebp)
+ 18b:	e8 71 ff ff ff       	call   101 <stosb>
+ 190:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 193:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 196:	c9                   	leave
+ 197:	c3                   	ret
+
+00000198 <strchr>:
+{
+ 198:	55                   	push   %ebp
+ 199:	89 e5                	mov    %esp,%ebp
+ 19b:	83 ec 04             	sub    $0x4,%esp
+ 19e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1a1:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 1a4:	eb 14                	jmp    1ba <strchr+0x22>
+    if(*s == c)
+ 1a6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a9:	0f b6 00             	movzbl (%eax),%eax
+ 1ac:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 1af:	75 05                	jne    1b6 <strchr+0x1e>
+      return (char*)s;
+ 1b1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b4:	eb 13                	jmp    1c9 <strchr+0x31>
+  for(; *s; s++)
+ 1b6:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1ba:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1bd:	0f b6 00             	movzbl (%eax),%eax
+ 1c0:	84 c0                	test   %al,%al
+ 1c2:	75 e2                	jne    1a6 <strchr+0xe>
+  return 0;
+ 1c4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 1c9:	c9                   	leave
+ 1ca:	c3                   	ret
+
+000001cb <gets>:
+{
+ 1cb:	55                   	push   %ebp
+ 1cc:	89 e5                	mov    %esp,%ebp
+ 1ce:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 1d1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 1d8:	eb 42                	jmp    21c <gets+0x51>
+    cc = read(0, &c, 1);
+ 1da:	83 ec 04             	sub    $0x4,%esp
+ 1dd:	6a 01                	push   $0x1
+ 1df:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 1e2:	50                   	push   %eax
+ 1e3:	6a 00                	push   $0x0
+ 1e5:	e8 dd 03 00 00       	call   5c7 <read>
+ 1ea:	83 c4 10             	add    $0x10,%esp
+ 1ed:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 1f0:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 1f4:	7e 33                	jle    229 <gets+0x5e>
+    buf[i++] = c;
+ 1f6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1f9:	8d 50 01             	lea    0x1(%eax),%edx
+ 1fc:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1ff:	89 c2                	mov    %eax,%edx
+ 201:	8b 45 08             	mov    0x8(%ebp),%eax
+ 204:	01 c2                	add    %eax,%edx
+ 206:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 20a:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 20c:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 210:	3c 0a                	cmp    $0xa,%al
+ 212:	74 16                	je     22a <gets+0x5f>
+ 214:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 218:	3c 0d                	cmp    $0xd,%al
+ 21a:	74 0e                	je     22a <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 21c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 21f:	83 c0 01             	add    $0x1,%eax
+ 222:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 225:	7f b3                	jg     1da <gets+0xf>
+ 227:	eb 01                	jmp    22a <gets+0x5f>
+      break;
+ 229:	90                   	nop
+  buf[i] = '\0';
+ 22a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 22d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 230:	01 d0                	add    %edx,%eax
+ 232:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 235:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 238:	c9                   	leave
+ 239:	c3                   	ret
+
+0000023a <stat>:
+{
+ 23a:	55                   	push   %ebp
+ 23b:	89 e5                	mov    %esp,%ebp
+ 23d:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+ 240:	83 ec 08             	sub    $0x8,%esp
+ 243:	6a 00                	push   $0x0
+ 245:	ff 75 08             	push   0x8(%ebp)
+ 248:	e8 a2 03 00 00       	call   5ef <open>
+ 24d:	83 c4 10             	add    $0x10,%esp
+ 250:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 253:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 257:	79 07                	jns    260 <stat+0x26>
+    return -1;
+ 259:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 25e:	eb 25                	jmp    285 <stat+0x4b>
+  r = fstat(fd, st);
+ 260:	83 ec 08             	sub    $0x8,%esp
+ 263:	ff 75 0c             	push   0xc(%ebp)
+ 266:	ff 75 f4             	push   -0xc(%ebp)
+ 269:	e8 99 03 00 00       	call   607 <fstat>
+ 26e:	83 c4 10             	add    $0x10,%esp
+ 271:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 274:	83 ec 0c             	sub    $0xc,%esp
+ 277:	ff 75 f4             	push   -0xc(%ebp)
+ 27a:	e8 58 03 00 00       	call   5d7 <close>
+ 27f:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 282:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 285:	c9                   	leave
+ 286:	c3                   	ret
+
+00000287 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 287:	55                   	push   %ebp
+ 288:	89 e5                	mov    %esp,%ebp
+ 28a:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+
+  dst = vdst;
+ 28d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 290:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 293:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 296:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 299:	eb 17                	jmp    2b2 <memmove+0x2b>
+    *dst++ = *src++;
+ 29b:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 29e:	8d 42 01             	lea    0x1(%edx),%eax
+ 2a1:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 2a4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2a7:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2aa:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 2ad:	0f b6 12             	movzbl (%edx),%edx
+ 2b0:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 2b2:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2b5:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 2b8:	89 55 10             	mov    %edx,0x10(%ebp)
+ 2bb:	85 c0                	test   %eax,%eax
+ 2bd:	7f dc                	jg     29b <memmove+0x14>
+  return vdst;
+ 2bf:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2c2:	c9                   	leave
+ 2c3:	c3                   	ret
+
+000002c4 <cpuinfo>:
+ 2c4:	55                   	push   %ebp
+ 2c5:	89 e5                	mov    %esp,%ebp
+ 2c7:	56                   	push   %esi
+ 2c8:	53                   	push   %ebx
+ 2c9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2cc:	ba 00 00 00 00       	mov    $0x0,%edx
+ 2d1:	89 d1                	mov    %edx,%ecx
+ 2d3:	0f a2                	cpuid
+ 2d5:	89 c6                	mov    %eax,%esi
+ 2d7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2da:	89 30                	mov    %esi,(%eax)
+ 2dc:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2df:	89 18                	mov    %ebx,(%eax)
+ 2e1:	8b 45 14             	mov    0x14(%ebp),%eax
+ 2e4:	89 08                	mov    %ecx,(%eax)
+ 2e6:	8b 45 18             	mov    0x18(%ebp),%eax
+ 2e9:	89 10                	mov    %edx,(%eax)
+ 2eb:	90                   	nop
+ 2ec:	5b                   	pop    %ebx
+ 2ed:	5e                   	pop    %esi
+ 2ee:	5d                   	pop    %ebp
+ 2ef:	c3                   	ret
+
+000002f0 <atoi>:
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+ 2f6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 2fd:	eb 25                	jmp    324 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 2ff:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 302:	89 d0                	mov    %edx,%eax
+ 304:	c1 e0 02             	shl    $0x2,%eax
+ 307:	01 d0                	add    %edx,%eax
+ 309:	01 c0                	add    %eax,%eax
+ 30b:	89 c1                	mov    %eax,%ecx
+ 30d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 310:	8d 50 01             	lea    0x1(%eax),%edx
+ 313:	89 55 08             	mov    %edx,0x8(%ebp)
+ 316:	0f b6 00             	movzbl (%eax),%eax
+ 319:	0f be c0             	movsbl %al,%eax
+ 31c:	01 c8                	add    %ecx,%eax
+ 31e:	83 e8 30             	sub    $0x30,%eax
+ 321:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 324:	8b 45 08             	mov    0x8(%ebp),%eax
+ 327:	0f b6 00             	movzbl (%eax),%eax
+ 32a:	3c 2f                	cmp    $0x2f,%al
+ 32c:	7e 0a                	jle    338 <atoi+0x48>
+ 32e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 331:	0f b6 00             	movzbl (%eax),%eax
+ 334:	3c 39                	cmp    $0x39,%al
+ 336:	7e c7                	jle    2ff <atoi+0xf>
+  return n;
+ 338:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 33b:	c9                   	leave
+ 33c:	c3                   	ret
+
+0000033d <strcmp>:
+{
+ 33d:	55                   	push   %ebp
+ 33e:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 340:	eb 08                	jmp    34a <strcmp+0xd>
+    p++, q++;
+ 342:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 346:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 34a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 34d:	0f b6 00             	movzbl (%eax),%eax
+ 350:	84 c0                	test   %al,%al
+ 352:	74 10                	je     364 <strcmp+0x27>
+ 354:	8b 45 08             	mov    0x8(%ebp),%eax
+ 357:	0f b6 10             	movzbl (%eax),%edx
+ 35a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 35d:	0f b6 00             	movzbl (%eax),%eax
+ 360:	38 c2                	cmp    %al,%dl
+ 362:	74 de                	je     342 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 364:	8b 45 08             	mov    0x8(%ebp),%eax
+ 367:	0f b6 00             	movzbl (%eax),%eax
+ 36a:	0f b6 d0             	movzbl %al,%edx
+ 36d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 370:	0f b6 00             	movzbl (%eax),%eax
+ 373:	0f b6 c0             	movzbl %al,%eax
+ 376:	29 c2                	sub    %eax,%edx
+ 378:	89 d0                	mov    %edx,%eax
+}
+ 37a:	5d                   	pop    %ebp
+ 37b:	c3                   	ret
+
+0000037c <udiv64>:
+{
+ 37c:	55                   	push   %ebp
+ 37d:	89 e5                	mov    %esp,%ebp
+ 37f:	57                   	push   %edi
+ 380:	56                   	push   %esi
+ 381:	83 ec 38             	sub    $0x38,%esp
+ 384:	8b 45 08             	mov    0x8(%ebp),%eax
+ 387:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 38a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 38d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 390:	8b 45 10             	mov    0x10(%ebp),%eax
+ 393:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 396:	8b 45 14             	mov    0x14(%ebp),%eax
+ 399:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  q = r = 0;
+ 39c:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 3a3:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 3aa:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 3ad:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 3b0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 3b3:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 3b6:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 3bd:	e9 85 00 00 00       	jmp    447 <udiv64+0xcb>
+    r = (r << 1) | ((n >> i) & 1);
+ 3c2:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 3c5:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 3c8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 3cc:	01 c0                	add    %eax,%eax
+ 3ce:	89 c6                	mov    %eax,%esi
+ 3d0:	89 d7                	mov    %edx,%edi
+ 3d2:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 3d5:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 3d8:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 3db:	0f ad d0             	shrd   %cl,%edx,%eax
+ 3de:	d3 ea                	shr    %cl,%edx
+ 3e0:	f6 c1 20             	test   $0x20,%cl
+ 3e3:	74 04                	je     3e9 <udiv64+0x6d>
+ 3e5:	89 d0                	mov    %edx,%eax
+ 3e7:	31 d2                	xor    %edx,%edx
+ 3e9:	83 e0 01             	and    $0x1,%eax
+ 3ec:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 3ef:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+ 3f6:	89 f0                	mov    %esi,%eax
+ 3f8:	89 fa                	mov    %edi,%edx
+ 3fa:	0b 45 c0             	or     -0x40(%ebp),%eax
+ 3fd:	0b 55 c4             	or     -0x3c(%ebp),%edx
+ 400:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 403:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 406:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 409:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 40c:	3b 45 c8             	cmp    -0x38(%ebp),%eax
+ 40f:	89 d0                	mov    %edx,%eax
+ 411:	1b 45 cc             	sbb    -0x34(%ebp),%eax
+ 414:	72 2d                	jb     443 <udiv64+0xc7>
+      r -= d;
+ 416:	8b 45 c8             	mov    -0x38(%ebp),%eax
+ 419:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 41c:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 41f:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64_t)1 << i;
+ 422:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 425:	b8 01 00 00 00       	mov    $0x1,%eax
+ 42a:	ba 00 00 00 00       	mov    $0x0,%edx
+ 42f:	0f a5 c2             	shld   %cl,%eax,%edx
+ 432:	d3 e0                	shl    %cl,%eax
+ 434:	f6 c1 20             	test   $0x20,%cl
+ 437:	74 04                	je     43d <udiv64+0xc1>
+ 439:	89 c2                	mov    %eax,%edx
+ 43b:	31 c0                	xor    %eax,%eax
+ 43d:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 440:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 443:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 447:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 44b:	0f 89 71 ff ff ff    	jns    3c2 <udiv64+0x46>
+  if(rem)
+ 451:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+ 455:	74 0e                	je     465 <udiv64+0xe9>
+    *rem = r;
+ 457:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 45a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 45d:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 460:	89 01                	mov    %eax,(%ecx)
+ 462:	89 51 04             	mov    %edx,0x4(%ecx)
+  return q;
+ 465:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 468:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 46b:	83 c4 38             	add    $0x38,%esp
+ 46e:	5e                   	pop    %esi
+ 46f:	5f                   	pop    %edi
+ 470:	5d                   	pop    %ebp
+ 471:	c3                   	ret
+
+00000472 <crc32cinit>:
+{
+ 472:	55                   	push   %ebp
+ 473:	89 e5                	mov    %esp,%ebp
+ 475:	83 ec 20             	sub    $0x20,%esp
+  for(i = 0; i < 256; i++){
+ 478:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 47f:	eb 4c                	jmp    4cd <crc32cinit+0x5b>
+    r = i;
+ 481:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 484:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+ 487:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+ 48e:	eb 26                	jmp    4b6 <crc32cinit+0x44>
+      r = (r >> 1) ^ ((r & 1) ? CRC32C_POLY : 0);
+ 490:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 493:	d1 e8                	shr    %eax
+ 495:	89 c2                	mov    %eax,%edx
+ 497:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 49a:	83 e0 01             	and    $0x1,%eax
+ 49d:	85 c0                	test   %eax,%eax
+ 49f:	74 07                	je     4a8 <crc32cinit+0x36>
+ 4a1:	b8 78 3b f6 82       	mov    $0x82f63b78,%eax
+ 4a6:	eb 05                	jmp    4ad <crc32cinit+0x3b>
+ 4a8:	b8 00 00 00 00       	mov    $0x0,%eax
+ 4ad:	31 d0                	xor    %edx,%eax
+ 4af:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+ 4b2:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+ 4b6:	83 7d f8 07          	cmpl   $0x7,-0x8(%ebp)
+ 4ba:	76 d4                	jbe    490 <crc32cinit+0x1e>
+    crc32ctab[i] = r;
+ 4bc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 4bf:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 4c2:	89 14 85 a0 0e 00 00 	mov    %edx,0xea0(,%eax,4)
+  for(i = 0; i < 256; i++){
+ 4c9:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 4cd:	81 7d fc ff 00 00 00 	cmpl   $0xff,-0x4(%ebp)
+ 4d4:	76 ab                	jbe    481 <crc32cinit+0xf>
+  cpuinfo(1, &a, &b, &c, &d);
+ 4d6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 4d9:	50                   	push   %eax
+ 4da:	8d 45 e8             	lea    -0x18(%ebp),%eax
+ 4dd:	50                   	push   %eax
+ 4de:	8d 45 ec             	lea    -0x14(%ebp),%eax
+ 4e1:	50                   	push   %eax
+ 4e2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 4e5:	50                   	push   %eax
+ 4e6:	6a 01                	push   $0x1
+ 4e8:	e8 d7 fd ff ff       	call   2c4 <cpuinfo>
+ 4ed:	83 c4 14             	add    $0x14,%esp
+  crc32chw = (c & CPUID_SSE42) != 0;
+ 4f0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 4f3:	25 00 00 10 00       	and    $0x100000,%eax
+ 4f8:	85 c0                	test   %eax,%eax
+ 4fa:	0f 95 c0             	setne  %al
+ 4fd:	0f b6 c0             	movzbl %al,%eax
+ 500:	a3 7c 0e 00 00       	mov    %eax,0xe7c
+}
+ 505:	90                   	nop
+ 506:	c9                   	leave
+ 507:	c3                   	ret
+
+00000508 <crc32c>:
+{
+ 508:	55                   	push   %ebp
+ 509:	89 e5                	mov    %esp,%ebp
+ 50b:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s = p;
+ 50e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 511:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(crc32chw < 0)
+ 514:	a1 7c 0e 00 00       	mov    0xe7c,%eax
+ 519:	85 c0                	test   %eax,%eax
+ 51b:	79 05                	jns    522 <crc32c+0x1a>
+    crc32cinit();
+ 51d:	e8 50 ff ff ff       	call   472 <crc32cinit>
+  crc = ~crc;
+ 522:	f7 55 08             	notl   0x8(%ebp)
+  if(crc32chw){
+ 525:	a1 7c 0e 00 00       	mov    0xe7c,%eax
+ 52a:	85 c0                	test   %eax,%eax
+ 52c:	74 6c                	je     59a <crc32c+0x92>
+    for(; n >= 4; n -= 4, s += 4)
+ 52e:	eb 18                	jmp    548 <crc32c+0x40>
+      asm("crc32l %1, %0" : "+r" (crc) : "rm" (*(const uint*)s));
+ 530:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 533:	8b 10                	mov    (%eax),%edx
+ 535:	8b 45 08             	mov    0x8(%ebp),%eax
+ 538:	f2 0f 38 f1 c2       	crc32  %edx,%eax
+ 53d:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n >= 4; n -= 4, s += 4)
+ 540:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+ 544:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+ 548:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+ 54c:	77 e2                	ja     530 <crc32c+0x28>
+    for(; n > 0; n--, s++)
+ 54e:	eb 19                	jmp    569 <crc32c+0x61>
+      asm("crc32b %1, %0" : "+r" (crc) : "qm" (*s));
+ 550:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 553:	0f b6 10             	movzbl (%eax),%edx
+ 556:	8b 45 08             	mov    0x8(%ebp),%eax
+ 559:	f2 0f 38 f0 c2       	crc32  %dl,%eax
+ 55e:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+ 561:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+ 565:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 569:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 56d:	75 e1                	jne    550 <crc32c+0x48>
+ 56f:	eb 2f                	jmp    5a0 <crc32c+0x98>
+      crc = crc32ctab[(crc ^ *s) & 0xff] ^ (crc >> 8);
+ 571:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 574:	0f b6 00             	movzbl (%eax),%eax
+ 577:	0f b6 c0             	movzbl %al,%eax
+ 57a:	33 45 08             	xor    0x8(%ebp),%eax
+ 57d:	0f b6 c0             	movzbl %al,%eax
+ 580:	8b 04 85 a0 0e 00 00 	mov    0xea0(,%eax,4),%eax
+ 587:	8b 55 08             	mov    0x8(%ebp),%edx
+ 58a:	c1 ea 08             	shr    $0x8,%edx
+ 58d:	31 d0                	xor    %edx,%eax
+ 58f:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+ 592:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+ 596:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 59a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 59e:	75 d1                	jne    571 <crc32c+0x69>
+  return ~crc;
+ 5a0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5a3:	f7 d0                	not    %eax
+}
+ 5a5:	c9                   	leave
+ 5a6:	c3                   	ret
+
+000005a7 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 5a7:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5ac:	cd 40                	int    $0x40
+ 5ae:	c3                   	ret
+
+000005af <exit>:
+SYSCALL(exit)
+ 5af:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5b4:	cd 40                	int    $0x40
+ 5b6:	c3                   	ret
+
+000005b7 <wait>:
+SYSCALL(wait)
+ 5b7:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5bc:	cd 40                	int    $0x40
+ 5be:	c3                   	ret
+
+000005bf <pipe>:
+SYSCALL(pipe)
+ 5bf:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5c4:	cd 40                	int    $0x40
+ 5c6:	c3                   	ret
+
+000005c7 <read>:
+SYSCALL(read)
+ 5c7:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5cc:	cd 40                	int    $0x40
+ 5ce:	c3                   	ret
+
+000005cf <write>:
+SYSCALL(write)
+ 5cf:	b8 10 00 00 00       	mov    $0x10,%eax
+ 5d4:	cd 40                	int    $0x40
+ 5d6:	c3                   	ret
+
+000005d7 <close>:
+SYSCALL(close)
+ 5d7:	b8 15 00 00 00       	mov    $0x15,%eax
+ 5dc:	cd 40                	int    $0x40
+ 5de:	c3                   	ret
+
+000005df <kill>:
+SYSCALL(kill)
+ 5df:	b8 06 00 00 00       	mov    $0x6,%eax
+ 5e4:	cd 40                	int    $0x40
+ 5e6:	c3                   	ret
+
+000005e7 <exec>:
+SYSCALL(exec)
+ 5e7:	b8 07 00 00 00       	mov    $0x7,%eax
+ 5ec:	cd 40                	int    $0x40
+ 5ee:	c3                   	ret
+
+000005ef <open>:
+SYSCALL(open)
+ 5ef:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 5f4:	cd 40                	int    $0x40
+ 5f6:	c3                   	ret
+
+000005f7 <mknod>:
+SYSCALL(mknod)
+ 5f7:	b8 11 00 00 00       	mov    $0x11,%eax
+ 5fc:	cd 40                	int    $0x40
+ 5fe:	c3                   	ret
+
+000005ff <unlink>:
+SYSCALL(unlink)
+ 5ff:	b8 12 00 00 00       	mov    $0x12,%eax
+ 604:	cd 40                	int    $0x40
+ 606:	c3                   	ret
+
+00000607 <fstat>:
+SYSCALL(fstat)
+ 607:	b8 08 00 00 00       	mov    $0x8,%eax
+ 60c:	cd 40                	int    $0x40
+ 60e:	c3                   	ret
+
+0000060f <link>:
+SYSCALL(link)
+ 60f:	b8 13 00 00 00       	mov    $0x13,%eax
+ 614:	cd 40                	int    $0x40
+ 616:	c3                   	ret
+
+00000617 <mkdir>:
+SYSCALL(mkdir)
+ 617:	b8 14 00 00 00       	mov    $0x14,%eax
+ 61c:	cd 40                	int    $0x40
+ 61e:	c3                   	ret
+
+0000061f <chdir>:
+SYSCALL(chdir)
+ 61f:	b8 09 00 00 00       	mov    $0x9,%eax
+ 624:	cd 40                	int    $0x40
+ 626:	c3                   	ret
+
+00000627 <dup>:
+SYSCALL(dup)
+ 627:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 62c:	cd 40                	int    $0x40
+ 62e:	c3                   	ret
+
+0000062f <getpid>:
+SYSCALL(getpid)
+ 62f:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 634:	cd 40                	int    $0x40
+ 636:	c3                   	ret
+
+00000637 <sbrk>:
+SYSCALL(sbrk)
+ 637:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 63c:	cd 40                	int    $0x40
+ 63e:	c3                   	ret
+
+0000063f <sleep>:
+SYSCALL(sleep)
+ 63f:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 644:	cd 40                	int    $0x40
+ 646:	c3                   	ret
+
+00000647 <uptime>:
+SYSCALL(uptime)
+ 647:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 64c:	cd 40                	int    $0x40
+ 64e:	c3                   	ret
+
+0000064f <arp>:
+SYSCALL(arp)
+ 64f:	b8 16 00 00 00       	mov    $0x16,%eax
+ 654:	cd 40                	int    $0x40
+ 656:	c3                   	ret
+
+00000657 <ifstat>:
+SYSCALL(ifstat)
+ 657:	b8 17 00 00 00       	mov    $0x17,%eax
+ 65c:	cd 40                	int    $0x40
+ 65e:	c3                   	ret
+
+0000065f <pcapctl>:
+SYSCALL(pcapctl)
+ 65f:	b8 18 00 00 00       	mov    $0x18,%eax
+ 664:	cd 40                	int    $0x40
+ 666:	c3                   	ret
+
+00000667 <pcapread>:
+SYSCALL(pcapread)
+ 667:	b8 19 00 00 00       	mov    $0x19,%eax
+ 66c:	cd 40                	int    $0x40
+ 66e:	c3                   	ret
+
+0000066f <bpfattach>:
+SYSCALL(bpfattach)
+ 66f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 674:	cd 40                	int    $0x40
+ 676:	c3                   	ret
+
+00000677 <pktgen>:
+SYSCALL(pktgen)
+ 677:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 67c:	cd 40                	int    $0x40
+ 67e:	c3                   	ret
+
+0000067f <reflect>:
+SYSCALL(reflect)
+ 67f:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 684:	cd 40                	int    $0x40
+ 686:	c3                   	ret
+
+00000687 <brctl>:
+SYSCALL(brctl)
+ 687:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 68c:	cd 40                	int    $0x40
+ 68e:	c3                   	ret
+
+0000068f <hostopen>:
+SYSCALL(hostopen)
+ 68f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 694:	cd 40                	int    $0x40
+ 696:	c3                   	ret
+
+00000697 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 697:	55                   	push   %ebp
+ 698:	89 e5                	mov    %esp,%ebp
+ 69a:	83 ec 18             	sub    $0x18,%esp
+ 69d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6a0:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 6a3:	83 ec 04             	sub    $0x4,%esp
+ 6a6:	6a 01                	push   $0x1
+ 6a8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 6ab:	50                   	push   %eax
+ 6ac:	ff 75 08             	push   0x8(%ebp)
+ 6af:	e8 1b ff ff ff       	call   5cf <write>
+ 6b4:	83 c4 10             	add    $0x10,%esp
+}
+ 6b7:	90                   	nop
+ 6b8:	c9                   	leave
+ 6b9:	c3                   	ret
+
+000006ba <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6ba:	55                   	push   %ebp
+ 6bb:	89 e5                	mov    %esp,%ebp
+ 6bd:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 6c0:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 6c7:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 6cb:	74 17                	je     6e4 <printint+0x2a>
+ 6cd:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 6d1:	79 11                	jns    6e4 <printint+0x2a>
+    neg = 1;
+ 6d3:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 6da:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6dd:	f7 d8                	neg    %eax
+ 6df:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 6e2:	eb 06                	jmp    6ea <printint+0x30>
+  } else {
+    x = xx;
+ 6e4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6e7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 6ea:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 6f1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 6f4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 6f7:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6fc:	f7 f1                	div    %ecx
+ 6fe:	89 d1                	mov    %edx,%ecx
+ 700:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 703:	8d 50 01             	lea    0x1(%eax),%edx
+ 706:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 709:	0f b6 91 80 0e 00 00 	movzbl 0xe80(%ecx),%edx
+ 710:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 714:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 717:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 71a:	ba 00 00 00 00       	mov    $0x0,%edx
+ 71f:	f7 f1                	div    %ecx
+ 721:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 724:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 728:	75 c7                	jne    6f1 <printint+0x37>
+  if(neg)
+ 72a:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 72e:	74 2d                	je     75d <printint+0xa3>
+    buf[i++] = '-';
+ 730:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 733:	8d 50 01             	lea    0x1(%eax),%edx
+ 736:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 739:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 73e:	eb 1d                	jmp    75d <printint+0xa3>
+    putc(fd, buf[i]);
+ 740:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 743:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 746:	01 d0                	add    %edx,%eax
+ 748:	0f b6 00             	movzbl (%eax),%eax
+ 74b:	0f be c0             	movsbl %al,%eax
+ 74e:	83 ec 08             	sub    $0x8,%esp
+ 751:	50                   	push   %eax
+ 752:	ff 75 08             	push   0x8(%ebp)
+ 755:	e8 3d ff ff ff       	call   697 <putc>
+ 75a:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 75d:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 761:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 765:	79 d9                	jns    740 <printint+0x86>
+}
+ 767:	90                   	nop
+ 768:	90                   	nop
+ 769:	c9                   	leave
+ 76a:	c3                   	ret
+
+0000076b <printf>:
+
+// Print to the given fd. Only understands %d, %u, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 76b:	55                   	push   %ebp
+ 76c:	89 e5                	mov    %esp,%ebp
+ 76e:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 771:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 778:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 77b:	83 c0 04             	add    $0x4,%eax
+ 77e:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 781:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 788:	e9 7d 01 00 00       	jmp    90a <printf+0x19f>
+    c = fmt[i] & 0xff;
+ 78d:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 790:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 793:	01 d0                	add    %edx,%eax
+ 795:	0f b6 00             	movzbl (%eax),%eax
+ 798:	0f be c0             	movsbl %al,%eax
+ 79b:	25 ff 00 00 00       	and    $0xff,%eax
+ 7a0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 7a3:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 7a7:	75 2c                	jne    7d5 <printf+0x6a>
+      if(c == '%'){
+ 7a9:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 7ad:	75 0c                	jne    7bb <printf+0x50>
+        state = '%';
+ 7af:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 7b6:	e9 4b 01 00 00       	jmp    906 <printf+0x19b>
+      } else {
+        putc(fd, c);
+ 7bb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7be:	0f be c0             	movsbl %al,%eax
+ 7c1:	83 ec 08             	sub    $0x8,%esp
+ 7c4:	50                   	push   %eax
+ 7c5:	ff 75 08             	push   0x8(%ebp)
+ 7c8:	e8 ca fe ff ff       	call   697 <putc>
+ 7cd:	83 c4 10             	add    $0x10,%esp
+ 7d0:	e9 31 01 00 00       	jmp    906 <printf+0x19b>
+      }
+    } else if(state == '%'){
+ 7d5:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 7d9:	0f 85 27 01 00 00    	jne    906 <printf+0x19b>
+      if(c == 'd'){
+ 7df:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 7e3:	75 1e                	jne    803 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 7e5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7e8:	8b 00                	mov    (%eax),%eax
+ 7ea:	6a 01                	push   $0x1
+ 7ec:	6a 0a                	push   $0xa
+ 7ee:	50                   	push   %eax
+ 7ef:	ff 75 08             	push   0x8(%ebp)
+ 7f2:	e8 c3 fe ff ff       	call   6ba <printint>
+ 7f7:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 7fa:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7fe:	e9 fc 00 00 00       	jmp    8ff <printf+0x194>
+      } else if(c == 'u'){
+ 803:	83 7d e4 75          	cmpl   $0x75,-0x1c(%ebp)
+ 807:	75 1e                	jne    827 <printf+0xbc>
+        printint(fd, *ap, 10, 0);
+ 809:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 80c:	8b 00                	mov    (%eax),%eax
+ 80e:	6a 00                	push   $0x0
+ 810:	6a 0a                	push   $0xa
+ 812:	50                   	push   %eax
+ 813:	ff 75 08             	push   0x8(%ebp)
+ 816:	e8 9f fe ff ff       	call   6ba <printint>
+ 81b:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 81e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 822:	e9 d8 00 00 00       	jmp    8ff <printf+0x194>
+      } else if(c == 'x' || c == 'p'){
+ 827:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 82b:	74 06                	je     833 <printf+0xc8>
+ 82d:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 831:	75 1e                	jne    851 <printf+0xe6>
+        printint(fd, *ap, 16, 0);
+ 833:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 836:	8b 00                	mov    (%eax),%eax
+ 838:	6a 00                	push   $0x0
+ 83a:	6a 10                	push   $0x10
+ 83c:	50                   	push   %eax
+ 83d:	ff 75 08             	push   0x8(%ebp)
+ 840:	e8 75 fe ff ff       	call   6ba <printint>
+ 845:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 848:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 84c:	e9 ae 00 00 00       	jmp    8ff <printf+0x194>
+      } else if(c == 's'){
+ 851:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 855:	75 43                	jne    89a <printf+0x12f>
+        s = (char*)*ap;
+ 857:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 85a:	8b 00                	mov    (%eax),%eax
+ 85c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 85f:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 863:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 867:	75 25                	jne    88e <printf+0x123>
+          s = "(null)";
+ 869:	c7 45 f4 96 0b 00 00 	movl   $0xb96,-0xc(%ebp)
+        while(*s != 0){
+ 870:	eb 1c                	jmp    88e <printf+0x123>
+          putc(fd, *s);
+ 872:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 875:	0f b6 00             	movzbl (%eax),%eax
+ 878:	0f be c0             	movsbl %al,%eax
+ 87b:	83 ec 08             	sub    $0x8,%esp
+ 87e:	50                   	push   %eax
+ 87f:	ff 75 08             	push   0x8(%ebp)
+ 882:	e8 10 fe ff ff       	call   697 <putc>
+ 887:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 88a:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 88e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 891:	0f b6 00             	movzbl (%eax),%eax
+ 894:	84 c0                	test   %al,%al
+ 896:	75 da                	jne    872 <printf+0x107>
+ 898:	eb 65                	jmp    8ff <printf+0x194>
+        }
+      } else if(c == 'c'){
+ 89a:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 89e:	75 1d                	jne    8bd <printf+0x152>
+        putc(fd, *ap);
+ 8a0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8a3:	8b 00                	mov    (%eax),%eax
+ 8a5:	0f be c0             	movsbl %al,%eax
+ 8a8:	83 ec 08             	sub    $0x8,%esp
+ 8ab:	50                   	push   %eax
+ 8ac:	ff 75 08             	push   0x8(%ebp)
+ 8af:	e8 e3 fd ff ff       	call   697 <putc>
+ 8b4:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 8b7:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 8bb:	eb 42                	jmp    8ff <printf+0x194>
+      } else if(c == '%'){
+ 8bd:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 8c1:	75 17                	jne    8da <printf+0x16f>
+        putc(fd, c);
+ 8c3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8c6:	0f be c0             	movsbl %al,%eax
+ 8c9:	83 ec 08             	sub    $0x8,%esp
+ 8cc:	50                   	push   %eax
+ 8cd:	ff 75 08             	push   0x8(%ebp)
+ 8d0:	e8 c2 fd ff ff       	call   697 <putc>
+ 8d5:	83 c4 10             	add    $0x10,%esp
+ 8d8:	eb 25                	jmp    8ff <printf+0x194>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 8da:	83 ec 08             	sub    $0x8,%esp
+ 8dd:	6a 25                	push   $0x25
+ 8df:	ff 75 08             	push   0x8(%ebp)
+ 8e2:	e8 b0 fd ff ff       	call   697 <putc>
+ 8e7:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 8ea:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8ed:	0f be c0             	movsbl %al,%eax
+ 8f0:	83 ec 08             	sub    $0x8,%esp
+ 8f3:	50                   	push   %eax
+ 8f4:	ff 75 08             	push   0x8(%ebp)
+ 8f7:	e8 9b fd ff ff       	call   697 <putc>
+ 8fc:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 8ff:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 906:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 90a:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 90d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 910:	01 d0                	add    %edx,%eax
+ 912:	0f b6 00             	movzbl (%eax),%eax
+ 915:	84 c0                	test   %al,%al
+ 917:	0f 85 70 fe ff ff    	jne    78d <printf+0x22>
+    }
+  }
+}
+ 91d:	90                   	nop
+ 91e:	90                   	nop
+ 91f:	c9                   	leave
+ 920:	c3                   	ret
+
+00000921 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 921:	55                   	push   %ebp
+ 922:	89 e5                	mov    %esp,%ebp
+ 924:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 927:	8b 45 08             	mov    0x8(%ebp),%eax
+ 92a:	83 e8 08             	sub    $0x8,%eax
+ 92d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 930:	a1 a8 12 00 00       	mov    0x12a8,%eax
+ 935:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 938:	eb 24                	jmp    95e <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 93a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 93d:	8b 00                	mov    (%eax),%eax
+ 93f:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 942:	72 12                	jb     956 <free+0x35>
+ 944:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 947:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 94a:	72 24                	jb     970 <free+0x4f>
+ 94c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 94f:	8b 00                	mov    (%eax),%eax
+ 951:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 954:	72 1a                	jb     970 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 956:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 959:	8b 00                	mov    (%eax),%eax
+ 95b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 95e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 961:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 964:	73 d4                	jae    93a <free+0x19>
+ 966:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 969:	8b 00                	mov    (%eax),%eax
+ 96b:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 96e:	73 ca                	jae    93a <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 970:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 973:	8b 40 04             	mov    0x4(%eax),%eax
+ 976:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 97d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 980:	01 c2                	add    %eax,%edx
+ 982:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 985:	8b 00                	mov    (%eax),%eax
+ 987:	39 c2                	cmp    %eax,%edx
+ 989:	75 24                	jne    9af <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 98b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 98e:	8b 50 04             	mov    0x4(%eax),%edx
+ 991:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 994:	8b 00                	mov    (%eax),%eax
+ 996:	8b 40 04             	mov    0x4(%eax),%eax
+ 999:	01 c2                	add    %eax,%edx
+ 99b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 99e:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9a1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9a4:	8b 00                	mov    (%eax),%eax
+ 9a6:	8b 10                	mov    (%eax),%edx
+ 9a8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9ab:	89 10                	mov    %edx,(%eax)
+ 9ad:	eb 0a                	jmp    9b9 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 9af:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9b2:	8b 10                	mov    (%eax),%edx
+ 9b4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9b7:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 9b9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9bc:	8b 40 04             	mov    0x4(%eax),%eax
+ 9bf:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 9c6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9c9:	01 d0                	add    %edx,%eax
+ 9cb:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 9ce:	75 20                	jne    9f0 <free+0xcf>
+    p->s.size += bp->s.size;
+ 9d0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9d3:	8b 50 04             	mov    0x4(%eax),%edx
+ 9d6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9d9:	8b 40 04             	mov    0x4(%eax),%eax
+ 9dc:	01 c2                	add    %eax,%edx
+ 9de:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9e1:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 9e4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9e7:	8b 10                	mov    (%eax),%edx
+ 9e9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9ec:	89 10                	mov    %edx,(%eax)
+ 9ee:	eb 08                	jmp    9f8 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 9f0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9f3:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 9f6:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 9f8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9fb:	a3 a8 12 00 00       	mov    %eax,0x12a8
+}
+ a00:	90                   	nop
+ a01:	c9                   	leave
+ a02:	c3                   	ret
+
+00000a03 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ a03:	55                   	push   %ebp
+ a04:	89 e5                	mov    %esp,%ebp
+ a06:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ a09:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ a10:	77 07                	ja     a19 <morecore+0x16>
+    nu = 4096;
+ a12:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ a19:	8b 45 08             	mov    0x8(%ebp),%eax
+ a1c:	c1 e0 03             	shl    $0x3,%eax
+ a1f:	83 ec 0c             	sub    $0xc,%esp
+ a22:	50                   	push   %eax
+ a23:	e8 0f fc ff ff       	call   637 <sbrk>
+ a28:	83 c4 10             	add    $0x10,%esp
+ a2b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ a2e:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ a32:	75 07                	jne    a3b <morecore+0x38>
+    return 0;
+ a34:	b8 00 00 00 00       	mov    $0x0,%eax
+ a39:	eb 26                	jmp    a61 <morecore+0x5e>
+  hp = (Header*)p;
+ a3b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a3e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ a41:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a44:	8b 55 08             	mov    0x8(%ebp),%edx
+ a47:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ a4a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a4d:	83 c0 08             	add    $0x8,%eax
+ a50:	83 ec 0c             	sub    $0xc,%esp
+ a53:	50                   	push   %eax
+ a54:	e8 c8 fe ff ff       	call   921 <free>
+ a59:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ a5c:	a1 a8 12 00 00       	mov    0x12a8,%eax
+}
+ a61:	c9                   	leave
+ a62:	c3                   	ret
+
+00000a63 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ a63:	55                   	push   %ebp
+ a64:	89 e5                	mov    %esp,%ebp
+ a66:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a69:	8b 45 08             	mov    0x8(%ebp),%eax
+ a6c:	83 c0 07             	add    $0x7,%eax
+ a6f:	c1 e8 03             	shr    $0x3,%eax
+ a72:	83 c0 01             	add    $0x1,%eax
+ a75:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ a78:	a1 a8 12 00 00       	mov    0x12a8,%eax
+ a7d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ a80:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ a84:	75 23                	jne    aa9 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ a86:	c7 45 f0 a0 12 00 00 	movl   $0x12a0,-0x10(%ebp)
+ a8d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a90:	a3 a8 12 00 00       	mov    %eax,0x12a8
+ a95:	a1 a8 12 00 00       	mov    0x12a8,%eax
+ a9a:	a3 a0 12 00 00       	mov    %eax,0x12a0
+    base.s.size = 0;
+ a9f:	c7 05 a4 12 00 00 00 	movl   $0x0,0x12a4
+ aa6:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ aa9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ aac:	8b 00                	mov    (%eax),%eax
+ aae:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ ab1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ab4:	8b 40 04             	mov    0x4(%eax),%eax
+ ab7:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ aba:	72 4d                	jb     b09 <malloc+0xa6>
+      if(p->s.size == nunits)
+ abc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ abf:	8b 40 04             	mov    0x4(%eax),%eax
+ ac2:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ ac5:	75 0c                	jne    ad3 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ ac7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aca:	8b 10                	mov    (%eax),%edx
+ acc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ acf:	89 10                	mov    %edx,(%eax)
+ ad1:	eb 26                	jmp    af9 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ ad3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ad6:	8b 40 04             	mov    0x4(%eax),%eax
+ ad9:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ adc:	89 c2                	mov    %eax,%edx
+ ade:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ae1:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ ae4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ae7:	8b 40 04             	mov    0x4(%eax),%eax
+ aea:	c1 e0 03             	shl    $0x3,%eax
+ aed:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ af0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ af3:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ af6:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ af9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ afc:	a3 a8 12 00 00       	mov    %eax,0x12a8
+      return (void*)(p + 1);
+ b01:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b04:	83 c0 08             	add    $0x8,%eax
+ b07:	eb 3b                	jmp    b44 <malloc+0xe1>
+    }
+    if(p == freep)
+ b09:	a1 a8 12 00 00       	mov    0x12a8,%eax
+ b0e:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ b11:	75 1e                	jne    b31 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ b13:	83 ec 0c             	sub    $0xc,%esp
+ b16:	ff 75 ec             	push   -0x14(%ebp)
+ b19:	e8 e5 fe ff ff       	call   a03 <morecore>
+ b1e:	83 c4 10             	add    $0x10,%esp
+ b21:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ b24:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b28:	75 07                	jne    b31 <malloc+0xce>
+        return 0;
+ b2a:	b8 00 00 00 00       	mov    $0x0,%eax
+ b2f:	eb 13                	jmp    b44 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b31:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b34:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ b37:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b3a:	8b 00                	mov    (%eax),%eax
+ b3c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ b3f:	e9 6d ff ff ff       	jmp    ab1 <malloc+0x4e>
+  }
+}
+ b44:	c9                   	leave
+ b45:	c3                   	ret
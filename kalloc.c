@@ -20,6 +20,7 @@ struct run {
 struct {
   struct spinlock lock;
   int use_lock;
+  int nfree;      // pages on freelist
   struct run *freelist;
 } kmem;
 
@@ -72,6 +73,7 @@ kfree(char *v)
   r = (struct run*)v;
   r->next = kmem.freelist;
   kmem.freelist = r;
+  kmem.nfree++;
   if(kmem.use_lock)
     release(&kmem.lock);
 }
@@ -87,10 +89,47 @@ kalloc(void)
   if(kmem.use_lock)
     acquire(&kmem.lock);
   r = kmem.freelist;
-  if(r)
+  if(r){
     kmem.freelist = r->next;
+    kmem.nfree--;
+  }
   if(kmem.use_lock)
     release(&kmem.lock);
   return (char*)r;
 }
 
+// Allocate n physically contiguous pages, for device rings.
+// Only runs of the free list that are still in the descending
+// order freerange() put them in are found, so this is meant to be
+// called at boot. Returns the lowest page, or 0 if there is no run.
+char*
+kallocn(int n)
+{
+  struct run **pp, *r, *s;
+  int i;
+
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  for(pp = &kmem.freelist; (r = *pp) != 0; pp = &r->next){
+    s = r->next;
+    for(i = 1; i < n && s == (struct run*)((char*)r - i*PGSIZE); i++)
+      s = s->next;
+    if(i == n){
+      *pp = s;
+      kmem.nfree -= n;
+      if(kmem.use_lock)
+        release(&kmem.lock);
+      return (char*)r - (n-1)*PGSIZE;
+    }
+  }
+  if(kmem.use_lock)
+    release(&kmem.lock);
+  return 0;
+}
+
+// Number of free pages, for sizing caches at boot.
+int
+kfreepages(void)
+{
+  return kmem.nfree;
+}
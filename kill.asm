@@ -0,0 +1,1404 @@
+
+_kill:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char **argv)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	83 ec 10             	sub    $0x10,%esp
+  12:	89 cb                	mov    %ecx,%ebx
+  int i;
+
+  if(argc < 2){
+  14:	83 3b 01             	cmpl   $0x1,(%ebx)
+  17:	7f 17                	jg     30 <main+0x30>
+    printf(2, "usage: kill pid...\n");
+  19:	83 ec 08             	sub    $0x8,%esp
+  1c:	68 b7 0a 00 00       	push   $0xab7
+  21:	6a 02                	push   $0x2
+  23:	e8 b4 06 00 00       	call   6dc <printf>
+  28:	83 c4 10             	add    $0x10,%esp
+    exit();
+  2b:	e8 f0 04 00 00       	call   520 <exit>
+  }
+  for(i=1; i<argc; i++)
+  30:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  37:	eb 2d                	jmp    66 <main+0x66>
+    kill(atoi(argv[i]));
+  39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  3c:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  43:	8b 43 04             	mov    0x4(%ebx),%eax
+  46:	01 d0                	add    %edx,%eax
+  48:	8b 00                	mov    (%eax),%eax
+  4a:	83 ec 0c             	sub    $0xc,%esp
+  4d:	50                   	push   %eax
+  4e:	e8 0e 02 00 00       	call   261 <atoi>
+  53:	83 c4 10             	add    $0x10,%esp
+  56:	83 ec 0c             	sub    $0xc,%esp
+  59:	50                   	push   %eax
+  5a:	e8 f1 04 00 00       	call   550 <kill>
+  5f:	83 c4 10             	add    $0x10,%esp
+  for(i=1; i<argc; i++)
+  62:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  66:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  69:	3b 03                	cmp    (%ebx),%eax
+  6b:	7c cc                	jl     39 <main+0x39>
+  exit();
+  6d:	e8 ae 04 00 00       	call   520 <exit>
+
+00000072 <stosb>:
+}
+
+int
+stat(char *n, struct stat *st)
+{
+  int fd;
+  72:	55                   	push   %ebp
+  73:	89 e5                	mov    %esp,%ebp
+  75:	57                   	push   %edi
+  76:	53                   	push   %ebx
+  int r;
+  77:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  7a:	8b 55 10             	mov    0x10(%ebp),%edx
+  7d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80:	89 cb                	mov    %ecx,%ebx
+  82:	89 df                	mov    %ebx,%edi
+  84:	89 d1                	mov    %edx,%ecx
+  86:	fc                   	cld
+  87:	f3 aa                	rep stos %al,%es:(%edi)
+  89:	89 ca                	mov    %ecx,%edx
+  8b:	89 fb                	mov    %edi,%ebx
+  8d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  90:	89 55 10             	mov    %edx,0x10(%ebp)
+
+  fd = open(n, O_RDONLY);
+  if(fd < 0)
+    return -1;
+  93:	90                   	nop
+  94:	5b                   	pop    %ebx
+  95:	5f                   	pop    %edi
+  96:	5d                   	pop    %ebp
+  97:	c3                   	ret
+
+00000098 <strcpy>:
+{
+  98:	55                   	push   %ebp
+  99:	89 e5                	mov    %esp,%ebp
+  9b:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+  9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  a1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  a4:	90                   	nop
+  a5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  a8:	8d 42 01             	lea    0x1(%edx),%eax
+  ab:	89 45 0c             	mov    %eax,0xc(%ebp)
+  ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  b1:	8d 48 01             	lea    0x1(%eax),%ecx
+  b4:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  b7:	0f b6 12             	movzbl (%edx),%edx
+  ba:	88 10                	mov    %dl,(%eax)
+  bc:	0f b6 00             	movzbl (%eax),%eax
+  bf:	84 c0                	test   %al,%al
+  c1:	75 e2                	jne    a5 <strcpy+0xd>
+  return os;
+  c3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  c6:	c9                   	leave
+  c7:	c3                   	ret
+
+000000c8 <strlen>:
+{
+  c8:	55                   	push   %ebp
+  c9:	89 e5                	mov    %esp,%ebp
+  cb:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+  ce:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  d5:	eb 04                	jmp    db <strlen+0x13>
+  d7:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  db:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  de:	8b 45 08             	mov    0x8(%ebp),%eax
+  e1:	01 d0                	add    %edx,%eax
+  e3:	0f b6 00             	movzbl (%eax),%eax
+  e6:	84 c0                	test   %al,%al
+  e8:	75 ed                	jne    d7 <strlen+0xf>
+  return n;
+  ea:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  ed:	c9                   	leave
+  ee:	c3                   	ret
+
+000000ef <memset>:
+{
+  ef:	55                   	push   %ebp
+  f0:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+  f2:	8b 45 10             	mov    0x10(%ebp),%eax
+  f5:	50                   	push   %eax
+  f6:	ff 75 0c             	push   0xc(%ebp)
+  f9:	ff 75 08             	push   0x8(%ebp)
+  fc:	e8 71 ff ff ff       	call   72 <stosb>
+ 101:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 104:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 107:	c9                   	leave
+ 108:	c3                   	ret
+
+00000109 <strchr>:
+{
+ 109:	55                   	push   %ebp
+ 10a:	89 e5                	mov    %esp,%ebp
+ 10c:	83 ec 04             	sub    $0x4,%esp
+ 10f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 112:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 115:	eb 14                	jmp    12b <strchr+0x22>
+    if(*s == c)
+ 117:	8b 45 08             	mov    0x8(%ebp),%eax
+ 11a:	0f b6 00             	movzbl (%eax),%eax
+ 11d:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 120:	75 05                	jne    127 <strchr+0x1e>
+      return (char*)s;
+ 122:	8b 45 08             	mov    0x8(%ebp),%eax
+ 125:	eb 13                	jmp    13a <strchr+0x31>
+  for(; *s; s++)
+ 127:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 12b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 12e:	0f b6 00             	movzbl (%eax),%eax
+ 131:	84 c0                	test   %al,%al
+ 133:	75 e2                	jne    117 <strchr+0xe>
+  return 0;
+ 135:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 13a:	c9                   	leave
+ 13b:	c3                   	ret
+
+0000013c <gets>:
+{
+ 13c:	55                   	push   %ebp
+ 13d:	89 e5                	mov    %esp,%ebp
+ 13f:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 142:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 149:	eb 42                	jmp    18d <gets+0x51>
+    cc = read(0, &c, 1);
+ 14b:	83 ec 04             	sub    $0x4,%esp
+ 14e:	6a 01                	push   $0x1
+ 150:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 153:	50                   	push   %eax
+ 154:	6a 00                	push   $0x0
+ 156:	e8 dd 03 00 00       	call   538 <read>
+ 15b:	83 c4 10             	add    $0x10,%esp
+ 15e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 161:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 165:	7e 33                	jle    19a <gets+0x5e>
+    buf[i++] = c;
+ 167:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 16a:	8d 50 01             	lea    0x1(%eax),%edx
+ 16d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 170:	89 c2                	mov    %eax,%edx
+ 172:	8b 45 08             	mov    0x8(%ebp),%eax
+ 175:	01 c2                	add    %eax,%edx
+ 177:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 17b:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 17d:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 181:	3c 0a                	cmp    $0xa,%al
+ 183:	74 16                	je     19b <gets+0x5f>
+ 185:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 189:	3c 0d                	cmp    $0xd,%al
+ 18b:	74 0e                	je     19b <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 18d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 190:	83 c0 01             	add    $0x1,%eax
+ 193:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 196:	7f b3                	jg     14b <gets+0xf>
+ 198:	eb 01                	jmp    19b <gets+0x5f>
+      break;
+ 19a:	90                   	nop
+  buf[i] = '\0';
+ 19b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 19e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a1:	01 d0                	add    %edx,%eax
+ 1a3:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 1a6:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1a9:	c9                   	leave
+ 1aa:	c3                   	ret
+
+000001ab <stat>:
+{
+ 1ab:	55                   	push   %ebp
+ 1ac:	89 e5                	mov    %esp,%ebp
+ 1ae:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+ 1b1:	83 ec 08             	sub    $0x8,%esp
+ 1b4:	6a 00                	push   $0x0
+ 1b6:	ff 75 08             	push   0x8(%ebp)
+ 1b9:	e8 a2 03 00 00       	call   560 <open>
+ 1be:	83 c4 10             	add    $0x10,%esp
+ 1c1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 1c4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 1c8:	79 07                	jns    1d1 <stat+0x26>
+    return -1;
+ 1ca:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 1cf:	eb 25                	jmp    1f6 <stat+0x4b>
+  r = fstat(fd, st);
+ 1d1:	83 ec 08             	sub    $0x8,%esp
+ 1d4:	ff 75 0c             	push   0xc(%ebp)
+ 1d7:	ff 75 f4             	push   -0xc(%ebp)
+ 1da:	e8 99 03 00 00       	call   578 <fstat>
+ 1df:	83 c4 10             	add    $0x10,%esp
+ 1e2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 1e5:	83 ec 0c             	sub    $0xc,%esp
+ 1e8:	ff 75 f4             	push   -0xc(%ebp)
+ 1eb:	e8 58 03 00 00       	call   548 <close>
+ 1f0:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 1f3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 1f6:	c9                   	leave
+ 1f7:	c3                   	ret
+
+000001f8 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 1f8:	55                   	push   %ebp
+ 1f9:	89 e5                	mov    %esp,%ebp
+ 1fb:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+
+  dst = vdst;
+ 1fe:	8b 45 08             	mov    0x8(%ebp),%eax
+ 201:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 204:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 207:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 20a:	eb 17                	jmp    223 <memmove+0x2b>
+    *dst++ = *src++;
+ 20c:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 20f:	8d 42 01             	lea    0x1(%edx),%eax
+ 212:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 215:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 218:	8d 48 01             	lea    0x1(%eax),%ecx
+ 21b:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 21e:	0f b6 12             	movzbl (%edx),%edx
+ 221:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 223:	8b 45 10             	mov    0x10(%ebp),%eax
+ 226:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 229:	89 55 10             	mov    %edx,0x10(%ebp)
+ 22c:	85 c0                	test   %eax,%eax
+ 22e:	7f dc                	jg     20c <memmove+0x14>
+  return vdst;
+ 230:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 233:	c9                   	leave
+ 234:	c3                   	ret
+
+00000235 <cpuinfo>:
+ 235:	55                   	push   %ebp
+ 236:	89 e5                	mov    %esp,%ebp
+ 238:	56                   	push   %esi
+ 239:	53                   	push   %ebx
+ 23a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 23d:	ba 00 00 00 00       	mov    $0x0,%edx
+ 242:	89 d1                	mov    %edx,%ecx
+ 244:	0f a2                	cpuid
+ 246:	89 c6                	mov    %eax,%esi
+ 248:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 24b:	89 30                	mov    %esi,(%eax)
+ 24d:	8b 45 10             	mov    0x10(%ebp),%eax
+ 250:	89 18                	mov    %ebx,(%eax)
+ 252:	8b 45 14             	mov    0x14(%ebp),%eax
+ 255:	89 08                	mov    %ecx,(%eax)
+ 257:	8b 45 18             	mov    0x18(%ebp),%eax
+ 25a:	89 10                	mov    %edx,(%eax)
+ 25c:	90                   	nop
+ 25d:	5b                   	pop    %ebx
+ 25e:	5e                   	pop    %esi
+ 25f:	5d                   	pop    %ebp
+ 260:	c3                   	ret
+
+00000261 <atoi>:
+{
+ 261:	55                   	push   %ebp
+ 262:	89 e5                	mov    %esp,%ebp
+ 264:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+ 267:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 26e:	eb 25                	jmp    295 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 270:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 273:	89 d0                	mov    %edx,%eax
+ 275:	c1 e0 02             	shl    $0x2,%eax
+ 278:	01 d0                	add    %edx,%eax
+ 27a:	01 c0                	add    %eax,%eax
+ 27c:	89 c1                	mov    %eax,%ecx
+ 27e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 281:	8d 50 01             	lea    0x1(%eax),%edx
+ 284:	89 55 08             	mov    %edx,0x8(%ebp)
+ 287:	0f b6 00             	movzbl (%eax),%eax
+ 28a:	0f be c0             	movsbl %al,%eax
+ 28d:	01 c8                	add    %ecx,%eax
+ 28f:	83 e8 30             	sub    $0x30,%eax
+ 292:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 295:	8b 45 08             	mov    0x8(%ebp),%eax
+ 298:	0f b6 00             	movzbl (%eax),%eax
+ 29b:	3c 2f                	cmp    $0x2f,%al
+ 29d:	7e 0a                	jle    2a9 <atoi+0x48>
+ 29f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a2:	0f b6 00             	movzbl (%eax),%eax
+ 2a5:	3c 39                	cmp    $0x39,%al
+ 2a7:	7e c7                	jle    270 <atoi+0xf>
+  return n;
+ 2a9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2ac:	c9                   	leave
+ 2ad:	c3                   	ret
+
+000002ae <strcmp>:
+{
+ 2ae:	55                   	push   %ebp
+ 2af:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 2b1:	eb 08                	jmp    2bb <strcmp+0xd>
+    p++, q++;
+ 2b3:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 2b7:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 2bb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2be:	0f b6 00             	movzbl (%eax),%eax
+ 2c1:	84 c0                	test   %al,%al
+ 2c3:	74 10                	je     2d5 <strcmp+0x27>
+ 2c5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c8:	0f b6 10             	movzbl (%eax),%edx
+ 2cb:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2ce:	0f b6 00             	movzbl (%eax),%eax
+ 2d1:	38 c2                	cmp    %al,%dl
+ 2d3:	74 de                	je     2b3 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 2d5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d8:	0f b6 00             	movzbl (%eax),%eax
+ 2db:	0f b6 d0             	movzbl %al,%edx
+ 2de:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2e1:	0f b6 00             	movzbl (%eax),%eax
+ 2e4:	0f b6 c0             	movzbl %al,%eax
+ 2e7:	29 c2                	sub    %eax,%edx
+ 2e9:	89 d0                	mov    %edx,%eax
+}
+ 2eb:	5d                   	pop    %ebp
+ 2ec:	c3                   	ret
+
+000002ed <udiv64>:
+{
+ 2ed:	55                   	push   %ebp
+ 2ee:	89 e5                	mov    %esp,%ebp
+ 2f0:	57                   	push   %edi
+ 2f1:	56                   	push   %esi
+ 2f2:	83 ec 38             	sub    $0x38,%esp
+ 2f5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2f8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 2fb:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2fe:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 301:	8b 45 10             	mov    0x10(%ebp),%eax
+ 304:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 307:	8b 45 14             	mov    0x14(%ebp),%eax
+ 30a:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  q = r = 0;
+ 30d:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 314:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 31b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 31e:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 321:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 324:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 327:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 32e:	e9 85 00 00 00       	jmp    3b8 <udiv64+0xcb>
+    r = (r << 1) | ((n >> i) & 1);
+ 333:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 336:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 339:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 33d:	01 c0                	add    %eax,%eax
+ 33f:	89 c6                	mov    %eax,%esi
+ 341:	89 d7                	mov    %edx,%edi
+ 343:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 346:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 349:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 34c:	0f ad d0             	shrd   %cl,%edx,%eax
+ 34f:	d3 ea                	shr    %cl,%edx
+ 351:	f6 c1 20             	test   $0x20,%cl
+ 354:	74 04                	je     35a <udiv64+0x6d>
+ 356:	89 d0                	mov    %edx,%eax
+ 358:	31 d2                	xor    %edx,%edx
+ 35a:	83 e0 01             	and    $0x1,%eax
+ 35d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 360:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+ 367:	89 f0                	mov    %esi,%eax
+ 369:	89 fa                	mov    %edi,%edx
+ 36b:	0b 45 c0             	or     -0x40(%ebp),%eax
+ 36e:	0b 55 c4             	or     -0x3c(%ebp),%edx
+ 371:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 374:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 377:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 37a:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 37d:	3b 45 c8             	cmp    -0x38(%ebp),%eax
+ 380:	89 d0                	mov    %edx,%eax
+ 382:	1b 45 cc             	sbb    -0x34(%ebp),%eax
+ 385:	72 2d                	jb     3b4 <udiv64+0xc7>
+      r -= d;
+ 387:	8b 45 c8             	mov    -0x38(%ebp),%eax
+ 38a:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 38d:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 390:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64_t)1 << i;
+ 393:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 396:	b8 01 00 00 00       	mov    $0x1,%eax
+ 39b:	ba 00 00 00 00       	mov    $0x0,%edx
+ 3a0:	0f a5 c2             	shld   %cl,%eax,%edx
+ 3a3:	d3 e0                	shl    %cl,%eax
+ 3a5:	f6 c1 20             	test   $0x20,%cl
+ 3a8:	74 04                	je     3ae <udiv64+0xc1>
+ 3aa:	89 c2                	mov    %eax,%edx
+ 3ac:	31 c0                	xor    %eax,%eax
+ 3ae:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 3b1:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 3b4:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 3b8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 3bc:	0f 89 71 ff ff ff    	jns    333 <udiv64+0x46>
+  if(rem)
+ 3c2:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+ 3c6:	74 0e                	je     3d6 <udiv64+0xe9>
+    *rem = r;
+ 3c8:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 3cb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 3ce:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 3d1:	89 01                	mov    %eax,(%ecx)
+ 3d3:	89 51 04             	mov    %edx,0x4(%ecx)
+  return q;
+ 3d6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 3d9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 3dc:	83 c4 38             	add    $0x38,%esp
+ 3df:	5e                   	pop    %esi
+ 3e0:	5f                   	pop    %edi
+ 3e1:	5d                   	pop    %ebp
+ 3e2:	c3                   	ret
+
+000003e3 <crc32cinit>:
+{
+ 3e3:	55                   	push   %ebp
+ 3e4:	89 e5                	mov    %esp,%ebp
+ 3e6:	83 ec 20             	sub    $0x20,%esp
+  for(i = 0; i < 256; i++){
+ 3e9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 3f0:	eb 4c                	jmp    43e <crc32cinit+0x5b>
+    r = i;
+ 3f2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 3f5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+ 3f8:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+ 3ff:	eb 26                	jmp    427 <crc32cinit+0x44>
+      r = (r >> 1) ^ ((r & 1) ? CRC32C_POLY : 0);
+ 401:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 404:	d1 e8                	shr    %eax
+ 406:	89 c2                	mov    %eax,%edx
+ 408:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 40b:	83 e0 01             	and    $0x1,%eax
+ 40e:	85 c0                	test   %eax,%eax
+ 410:	74 07                	je     419 <crc32cinit+0x36>
+ 412:	b8 78 3b f6 82       	mov    $0x82f63b78,%eax
+ 417:	eb 05                	jmp    41e <crc32cinit+0x3b>
+ 419:	b8 00 00 00 00       	mov    $0x0,%eax
+ 41e:	31 d0                	xor    %edx,%eax
+ 420:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+ 423:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+ 427:	83 7d f8 07          	cmpl   $0x7,-0x8(%ebp)
+ 42b:	76 d4                	jbe    401 <crc32cinit+0x1e>
+    crc32ctab[i] = r;
+ 42d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 430:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 433:	89 14 85 e0 0d 00 00 	mov    %edx,0xde0(,%eax,4)
+  for(i = 0; i < 256; i++){
+ 43a:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 43e:	81 7d fc ff 00 00 00 	cmpl   $0xff,-0x4(%ebp)
+ 445:	76 ab                	jbe    3f2 <crc32cinit+0xf>
+  cpuinfo(1, &a, &b, &c, &d);
+ 447:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 44a:	50                   	push   %eax
+ 44b:	8d 45 e8             	lea    -0x18(%ebp),%eax
+ 44e:	50                   	push   %eax
+ 44f:	8d 45 ec             	lea    -0x14(%ebp),%eax
+ 452:	50                   	push   %eax
+ 453:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 456:	50                   	push   %eax
+ 457:	6a 01                	push   $0x1
+ 459:	e8 d7 fd ff ff       	call   235 <cpuinfo>
+ 45e:	83 c4 14             	add    $0x14,%esp
+  crc32chw = (c & CPUID_SSE42) != 0;
+ 461:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 464:	25 00 00 10 00       	and    $0x100000,%eax
+ 469:	85 c0                	test   %eax,%eax
+ 46b:	0f 95 c0             	setne  %al
+ 46e:	0f b6 c0             	movzbl %al,%eax
+ 471:	a3 ac 0d 00 00       	mov    %eax,0xdac
+}
+ 476:	90                   	nop
+ 477:	c9                   	leave
+ 478:	c3                   	ret
+
+00000479 <crc32c>:
+{
+ 479:	55                   	push   %ebp
+ 47a:	89 e5                	mov    %esp,%ebp
+ 47c:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s = p;
+ 47f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 482:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(crc32chw < 0)
+ 485:	a1 ac 0d 00 00       	mov    0xdac,%eax
+ 48a:	85 c0                	test   %eax,%eax
+ 48c:	79 05                	jns    493 <crc32c+0x1a>
+    crc32cinit();
+ 48e:	e8 50 ff ff ff       	call   3e3 <crc32cinit>
+  crc = ~crc;
+ 493:	f7 55 08             	notl   0x8(%ebp)
+  if(crc32chw){
+ 496:	a1 ac 0d 00 00       	mov    0xdac,%eax
+ 49b:	85 c0                	test   %eax,%eax
+ 49d:	74 6c                	je     50b <crc32c+0x92>
+    for(; n >= 4; n -= 4, s += 4)
+ 49f:	eb 18                	jmp    4b9 <crc32c+0x40>
+      asm("crc32l %1, %0" : "+r" (crc) : "rm" (*(const uint*)s));
+ 4a1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 4a4:	8b 10                	mov    (%eax),%edx
+ 4a6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4a9:	f2 0f 38 f1 c2       	crc32  %edx,%eax
+ 4ae:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n >= 4; n -= 4, s += 4)
+ 4b1:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+ 4b5:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+ 4b9:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+ 4bd:	77 e2                	ja     4a1 <crc32c+0x28>
+    for(; n > 0; n--, s++)
+ 4bf:	eb 19                	jmp    4da <crc32c+0x61>
+      asm("crc32b %1, %0" : "+r" (crc) : "qm" (*s));
+ 4c1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 4c4:	0f b6 10             	movzbl (%eax),%edx
+ 4c7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4ca:	f2 0f 38 f0 c2       	crc32  %dl,%eax
+ 4cf:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+ 4d2:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+ 4d6:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 4da:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 4de:	75 e1                	jne    4c1 <crc32c+0x48>
+ 4e0:	eb 2f                	jmp    511 <crc32c+0x98>
+      crc = crc32ctab[(crc ^ *s) & 0xff] ^ (crc >> 8);
+ 4e2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 4e5:	0f b6 00             	movzbl (%eax),%eax
+ 4e8:	0f b6 c0             	movzbl %al,%eax
+ 4eb:	33 45 08             	xor    0x8(%ebp),%eax
+ 4ee:	0f b6 c0             	movzbl %al,%eax
+ 4f1:	8b 04 85 e0 0d 00 00 	mov    0xde0(,%eax,4),%eax
+ 4f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4fb:	c1 ea 08             	shr    $0x8,%edx
+ 4fe:	31 d0                	xor    %edx,%eax
+ 500:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+ 503:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+ 507:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 50b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 50f:	75 d1                	jne    4e2 <crc32c+0x69>
+  return ~crc;
+ 511:	8b 45 08             	mov    0x8(%ebp),%eax
+ 514:	f7 d0                	not    %eax
+}
+ 516:	c9                   	leave
+ 517:	c3                   	ret
+
+00000518 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 518:	b8 01 00 00 00       	mov    $0x1,%eax
+ 51d:	cd 40                	int    $0x40
+ 51f:	c3                   	ret
+
+00000520 <exit>:
+SYSCALL(exit)
+ 520:	b8 02 00 00 00       	mov    $0x2,%eax
+ 525:	cd 40                	int    $0x40
+ 527:	c3                   	ret
+
+00000528 <wait>:
+SYSCALL(wait)
+ 528:	b8 03 00 00 00       	mov    $0x3,%eax
+ 52d:	cd 40                	int    $0x40
+ 52f:	c3                   	ret
+
+00000530 <pipe>:
+SYSCALL(pipe)
+ 530:	b8 04 00 00 00       	mov    $0x4,%eax
+ 535:	cd 40                	int    $0x40
+ 537:	c3                   	ret
+
+00000538 <read>:
+SYSCALL(read)
+ 538:	b8 05 00 00 00       	mov    $0x5,%eax
+ 53d:	cd 40                	int    $0x40
+ 53f:	c3                   	ret
+
+00000540 <write>:
+SYSCALL(write)
+ 540:	b8 10 00 00 00       	mov    $0x10,%eax
+ 545:	cd 40                	int    $0x40
+ 547:	c3                   	ret
+
+00000548 <close>:
+SYSCALL(close)
+ 548:	b8 15 00 00 00       	mov    $0x15,%eax
+ 54d:	cd 40                	int    $0x40
+ 54f:	c3                   	ret
+
+00000550 <kill>:
+SYSCALL(kill)
+ 550:	b8 06 00 00 00       	mov    $0x6,%eax
+ 555:	cd 40                	int    $0x40
+ 557:	c3                   	ret
+
+00000558 <exec>:
+SYSCALL(exec)
+ 558:	b8 07 00 00 00       	mov    $0x7,%eax
+ 55d:	cd 40                	int    $0x40
+ 55f:	c3                   	ret
+
+00000560 <open>:
+SYSCALL(open)
+ 560:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 565:	cd 40                	int    $0x40
+ 567:	c3                   	ret
+
+00000568 <mknod>:
+SYSCALL(mknod)
+ 568:	b8 11 00 00 00       	mov    $0x11,%eax
+ 56d:	cd 40                	int    $0x40
+ 56f:	c3                   	ret
+
+00000570 <unlink>:
+SYSCALL(unlink)
+ 570:	b8 12 00 00 00       	mov    $0x12,%eax
+ 575:	cd 40                	int    $0x40
+ 577:	c3                   	ret
+
+00000578 <fstat>:
+SYSCALL(fstat)
+ 578:	b8 08 00 00 00       	mov    $0x8,%eax
+ 57d:	cd 40                	int    $0x40
+ 57f:	c3                   	ret
+
+00000580 <link>:
+SYSCALL(link)
+ 580:	b8 13 00 00 00       	mov    $0x13,%eax
+ 585:	cd 40                	int    $0x40
+ 587:	c3                   	ret
+
+00000588 <mkdir>:
+SYSCALL(mkdir)
+ 588:	b8 14 00 00 00       	mov    $0x14,%eax
+ 58d:	cd 40                	int    $0x40
+ 58f:	c3                   	ret
+
+00000590 <chdir>:
+SYSCALL(chdir)
+ 590:	b8 09 00 00 00       	mov    $0x9,%eax
+ 595:	cd 40                	int    $0x40
+ 597:	c3                   	ret
+
+00000598 <dup>:
+SYSCALL(dup)
+ 598:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 59d:	cd 40                	int    $0x40
+ 59f:	c3                   	ret
+
+000005a0 <getpid>:
+SYSCALL(getpid)
+ 5a0:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5a5:	cd 40                	int    $0x40
+ 5a7:	c3                   	ret
+
+000005a8 <sbrk>:
+SYSCALL(sbrk)
+ 5a8:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5ad:	cd 40                	int    $0x40
+ 5af:	c3                   	ret
+
+000005b0 <sleep>:
+SYSCALL(sleep)
+ 5b0:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5b5:	cd 40                	int    $0x40
+ 5b7:	c3                   	ret
+
+000005b8 <uptime>:
+SYSCALL(uptime)
+ 5b8:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5bd:	cd 40                	int    $0x40
+ 5bf:	c3                   	ret
+
+000005c0 <arp>:
+SYSCALL(arp)
+ 5c0:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5c5:	cd 40                	int    $0x40
+ 5c7:	c3                   	ret
+
+000005c8 <ifstat>:
+SYSCALL(ifstat)
+ 5c8:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5cd:	cd 40                	int    $0x40
+ 5cf:	c3                   	ret
+
+000005d0 <pcapctl>:
+SYSCALL(pcapctl)
+ 5d0:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5d5:	cd 40                	int    $0x40
+ 5d7:	c3                   	ret
+
+000005d8 <pcapread>:
+SYSCALL(pcapread)
+ 5d8:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5dd:	cd 40                	int    $0x40
+ 5df:	c3                   	ret
+
+000005e0 <bpfattach>:
+SYSCALL(bpfattach)
+ 5e0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5e5:	cd 40                	int    $0x40
+ 5e7:	c3                   	ret
+
+000005e8 <pktgen>:
+SYSCALL(pktgen)
+ 5e8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5ed:	cd 40                	int    $0x40
+ 5ef:	c3                   	ret
+
+000005f0 <reflect>:
+SYSCALL(reflect)
+ 5f0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5f5:	cd 40                	int    $0x40
+ 5f7:	c3                   	ret
+
+000005f8 <brctl>:
+SYSCALL(brctl)
+ 5f8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5fd:	cd 40                	int    $0x40
+ 5ff:	c3                   	ret
+
+00000600 <hostopen>:
+SYSCALL(hostopen)
+ 600:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 605:	cd 40                	int    $0x40
+ 607:	c3                   	ret
+
+00000608 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 608:	55                   	push   %ebp
+ 609:	89 e5                	mov    %esp,%ebp
+ 60b:	83 ec 18             	sub    $0x18,%esp
+ 60e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 611:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 614:	83 ec 04             	sub    $0x4,%esp
+ 617:	6a 01                	push   $0x1
+ 619:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 61c:	50                   	push   %eax
+ 61d:	ff 75 08             	push   0x8(%ebp)
+ 620:	e8 1b ff ff ff       	call   540 <write>
+ 625:	83 c4 10             	add    $0x10,%esp
+}
+ 628:	90                   	nop
+ 629:	c9                   	leave
+ 62a:	c3                   	ret
+
+0000062b <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 62b:	55                   	push   %ebp
+ 62c:	89 e5                	mov    %esp,%ebp
+ 62e:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 631:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 638:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 63c:	74 17                	je     655 <printint+0x2a>
+ 63e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 642:	79 11                	jns    655 <printint+0x2a>
+    neg = 1;
+ 644:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 64b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 64e:	f7 d8                	neg    %eax
+ 650:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 653:	eb 06                	jmp    65b <printint+0x30>
+  } else {
+    x = xx;
+ 655:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 658:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 65b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 662:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 665:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 668:	ba 00 00 00 00       	mov    $0x0,%edx
+ 66d:	f7 f1                	div    %ecx
+ 66f:	89 d1                	mov    %edx,%ecx
+ 671:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 674:	8d 50 01             	lea    0x1(%eax),%edx
+ 677:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 67a:	0f b6 91 b0 0d 00 00 	movzbl 0xdb0(%ecx),%edx
+ 681:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 685:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 688:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 68b:	ba 00 00 00 00       	mov    $0x0,%edx
+ 690:	f7 f1                	div    %ecx
+ 692:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 695:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 699:	75 c7                	jne    662 <printint+0x37>
+  if(neg)
+ 69b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 69f:	74 2d                	je     6ce <printint+0xa3>
+    buf[i++] = '-';
+ 6a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6a4:	8d 50 01             	lea    0x1(%eax),%edx
+ 6a7:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 6aa:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 6af:	eb 1d                	jmp    6ce <printint+0xa3>
+    putc(fd, buf[i]);
+ 6b1:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 6b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6b7:	01 d0                	add    %edx,%eax
+ 6b9:	0f b6 00             	movzbl (%eax),%eax
+ 6bc:	0f be c0             	movsbl %al,%eax
+ 6bf:	83 ec 08             	sub    $0x8,%esp
+ 6c2:	50                   	push   %eax
+ 6c3:	ff 75 08             	push   0x8(%ebp)
+ 6c6:	e8 3d ff ff ff       	call   608 <putc>
+ 6cb:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 6ce:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 6d2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 6d6:	79 d9                	jns    6b1 <printint+0x86>
+}
+ 6d8:	90                   	nop
+ 6d9:	90                   	nop
+ 6da:	c9                   	leave
+ 6db:	c3                   	ret
+
+000006dc <printf>:
+
+// Print to the given fd. Only understands %d, %u, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 6dc:	55                   	push   %ebp
+ 6dd:	89 e5                	mov    %esp,%ebp
+ 6df:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 6e2:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 6e9:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 6ec:	83 c0 04             	add    $0x4,%eax
+ 6ef:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 6f2:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 6f9:	e9 7d 01 00 00       	jmp    87b <printf+0x19f>
+    c = fmt[i] & 0xff;
+ 6fe:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 701:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 704:	01 d0                	add    %edx,%eax
+ 706:	0f b6 00             	movzbl (%eax),%eax
+ 709:	0f be c0             	movsbl %al,%eax
+ 70c:	25 ff 00 00 00       	and    $0xff,%eax
+ 711:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 714:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 718:	75 2c                	jne    746 <printf+0x6a>
+      if(c == '%'){
+ 71a:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 71e:	75 0c                	jne    72c <printf+0x50>
+        state = '%';
+ 720:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 727:	e9 4b 01 00 00       	jmp    877 <printf+0x19b>
+      } else {
+        putc(fd, c);
+ 72c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 72f:	0f be c0             	movsbl %al,%eax
+ 732:	83 ec 08             	sub    $0x8,%esp
+ 735:	50                   	push   %eax
+ 736:	ff 75 08             	push   0x8(%ebp)
+ 739:	e8 ca fe ff ff       	call   608 <putc>
+ 73e:	83 c4 10             	add    $0x10,%esp
+ 741:	e9 31 01 00 00       	jmp    877 <printf+0x19b>
+      }
+    } else if(state == '%'){
+ 746:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 74a:	0f 85 27 01 00 00    	jne    877 <printf+0x19b>
+      if(c == 'd'){
+ 750:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 754:	75 1e                	jne    774 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 756:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 759:	8b 00                	mov    (%eax),%eax
+ 75b:	6a 01                	push   $0x1
+ 75d:	6a 0a                	push   $0xa
+ 75f:	50                   	push   %eax
+ 760:	ff 75 08             	push   0x8(%ebp)
+ 763:	e8 c3 fe ff ff       	call   62b <printint>
+ 768:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 76b:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 76f:	e9 fc 00 00 00       	jmp    870 <printf+0x194>
+      } else if(c == 'u'){
+ 774:	83 7d e4 75          	cmpl   $0x75,-0x1c(%ebp)
+ 778:	75 1e                	jne    798 <printf+0xbc>
+        printint(fd, *ap, 10, 0);
+ 77a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 77d:	8b 00                	mov    (%eax),%eax
+ 77f:	6a 00                	push   $0x0
+ 781:	6a 0a                	push   $0xa
+ 783:	50                   	push   %eax
+ 784:	ff 75 08             	push   0x8(%ebp)
+ 787:	e8 9f fe ff ff       	call   62b <printint>
+ 78c:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 78f:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 793:	e9 d8 00 00 00       	jmp    870 <printf+0x194>
+      } else if(c == 'x' || c == 'p'){
+ 798:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 79c:	74 06                	je     7a4 <printf+0xc8>
+ 79e:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 7a2:	75 1e                	jne    7c2 <printf+0xe6>
+        printint(fd, *ap, 16, 0);
+ 7a4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7a7:	8b 00                	mov    (%eax),%eax
+ 7a9:	6a 00                	push   $0x0
+ 7ab:	6a 10                	push   $0x10
+ 7ad:	50                   	push   %eax
+ 7ae:	ff 75 08             	push   0x8(%ebp)
+ 7b1:	e8 75 fe ff ff       	call   62b <printint>
+ 7b6:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 7b9:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7bd:	e9 ae 00 00 00       	jmp    870 <printf+0x194>
+      } else if(c == 's'){
+ 7c2:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 7c6:	75 43                	jne    80b <printf+0x12f>
+        s = (char*)*ap;
+ 7c8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7cb:	8b 00                	mov    (%eax),%eax
+ 7cd:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 7d0:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 7d4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 7d8:	75 25                	jne    7ff <printf+0x123>
+          s = "(null)";
+ 7da:	c7 45 f4 cb 0a 00 00 	movl   $0xacb,-0xc(%ebp)
+        while(*s != 0){
+ 7e1:	eb 1c                	jmp    7ff <printf+0x123>
+          putc(fd, *s);
+ 7e3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7e6:	0f b6 00             	movzbl (%eax),%eax
+ 7e9:	0f be c0             	movsbl %al,%eax
+ 7ec:	83 ec 08             	sub    $0x8,%esp
+ 7ef:	50                   	push   %eax
+ 7f0:	ff 75 08             	push   0x8(%ebp)
+ 7f3:	e8 10 fe ff ff       	call   608 <putc>
+ 7f8:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 7fb:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 7ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 802:	0f b6 00             	movzbl (%eax),%eax
+ 805:	84 c0                	test   %al,%al
+ 807:	75 da                	jne    7e3 <printf+0x107>
+ 809:	eb 65                	jmp    870 <printf+0x194>
+        }
+      } else if(c == 'c'){
+ 80b:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 80f:	75 1d                	jne    82e <printf+0x152>
+        putc(fd, *ap);
+ 811:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 814:	8b 00                	mov    (%eax),%eax
+ 816:	0f be c0             	movsbl %al,%eax
+ 819:	83 ec 08             	sub    $0x8,%esp
+ 81c:	50                   	push   %eax
+ 81d:	ff 75 08             	push   0x8(%ebp)
+ 820:	e8 e3 fd ff ff       	call   608 <putc>
+ 825:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 828:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 82c:	eb 42                	jmp    870 <printf+0x194>
+      } else if(c == '%'){
+ 82e:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 832:	75 17                	jne    84b <printf+0x16f>
+        putc(fd, c);
+ 834:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 837:	0f be c0             	movsbl %al,%eax
+ 83a:	83 ec 08             	sub    $0x8,%esp
+ 83d:	50                   	push   %eax
+ 83e:	ff 75 08             	push   0x8(%ebp)
+ 841:	e8 c2 fd ff ff       	call   608 <putc>
+ 846:	83 c4 10             	add    $0x10,%esp
+ 849:	eb 25                	jmp    870 <printf+0x194>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 84b:	83 ec 08             	sub    $0x8,%esp
+ 84e:	6a 25                	push   $0x25
+ 850:	ff 75 08             	push   0x8(%ebp)
+ 853:	e8 b0 fd ff ff       	call   608 <putc>
+ 858:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 85b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 85e:	0f be c0             	movsbl %al,%eax
+ 861:	83 ec 08             	sub    $0x8,%esp
+ 864:	50                   	push   %eax
+ 865:	ff 75 08             	push   0x8(%ebp)
+ 868:	e8 9b fd ff ff       	call   608 <putc>
+ 86d:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 870:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 877:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 87b:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 87e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 881:	01 d0                	add    %edx,%eax
+ 883:	0f b6 00             	movzbl (%eax),%eax
+ 886:	84 c0                	test   %al,%al
+ 888:	0f 85 70 fe ff ff    	jne    6fe <printf+0x22>
+    }
+  }
+}
+ 88e:	90                   	nop
+ 88f:	90                   	nop
+ 890:	c9                   	leave
+ 891:	c3                   	ret
+
+00000892 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 892:	55                   	push   %ebp
+ 893:	89 e5                	mov    %esp,%ebp
+ 895:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 898:	8b 45 08             	mov    0x8(%ebp),%eax
+ 89b:	83 e8 08             	sub    $0x8,%eax
+ 89e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8a1:	a1 e8 11 00 00       	mov    0x11e8,%eax
+ 8a6:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 8a9:	eb 24                	jmp    8cf <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8ab:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8ae:	8b 00                	mov    (%eax),%eax
+ 8b0:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 8b3:	72 12                	jb     8c7 <free+0x35>
+ 8b5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8b8:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 8bb:	72 24                	jb     8e1 <free+0x4f>
+ 8bd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8c0:	8b 00                	mov    (%eax),%eax
+ 8c2:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 8c5:	72 1a                	jb     8e1 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8c7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8ca:	8b 00                	mov    (%eax),%eax
+ 8cc:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 8cf:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8d2:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 8d5:	73 d4                	jae    8ab <free+0x19>
+ 8d7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8da:	8b 00                	mov    (%eax),%eax
+ 8dc:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 8df:	73 ca                	jae    8ab <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 8e1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8e4:	8b 40 04             	mov    0x4(%eax),%eax
+ 8e7:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 8ee:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8f1:	01 c2                	add    %eax,%edx
+ 8f3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8f6:	8b 00                	mov    (%eax),%eax
+ 8f8:	39 c2                	cmp    %eax,%edx
+ 8fa:	75 24                	jne    920 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 8fc:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8ff:	8b 50 04             	mov    0x4(%eax),%edx
+ 902:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 905:	8b 00                	mov    (%eax),%eax
+ 907:	8b 40 04             	mov    0x4(%eax),%eax
+ 90a:	01 c2                	add    %eax,%edx
+ 90c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 90f:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 912:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 915:	8b 00                	mov    (%eax),%eax
+ 917:	8b 10                	mov    (%eax),%edx
+ 919:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 91c:	89 10                	mov    %edx,(%eax)
+ 91e:	eb 0a                	jmp    92a <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 920:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 923:	8b 10                	mov    (%eax),%edx
+ 925:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 928:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 92a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 92d:	8b 40 04             	mov    0x4(%eax),%eax
+ 930:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 937:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 93a:	01 d0                	add    %edx,%eax
+ 93c:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 93f:	75 20                	jne    961 <free+0xcf>
+    p->s.size += bp->s.size;
+ 941:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 944:	8b 50 04             	mov    0x4(%eax),%edx
+ 947:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 94a:	8b 40 04             	mov    0x4(%eax),%eax
+ 94d:	01 c2                	add    %eax,%edx
+ 94f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 952:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 955:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 958:	8b 10                	mov    (%eax),%edx
+ 95a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 95d:	89 10                	mov    %edx,(%eax)
+ 95f:	eb 08                	jmp    969 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 961:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 964:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 967:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 969:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 96c:	a3 e8 11 00 00       	mov    %eax,0x11e8
+}
+ 971:	90                   	nop
+ 972:	c9                   	leave
+ 973:	c3                   	ret
+
+00000974 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 974:	55                   	push   %ebp
+ 975:	89 e5                	mov    %esp,%ebp
+ 977:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 97a:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 981:	77 07                	ja     98a <morecore+0x16>
+    nu = 4096;
+ 983:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 98a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 98d:	c1 e0 03             	shl    $0x3,%eax
+ 990:	83 ec 0c             	sub    $0xc,%esp
+ 993:	50                   	push   %eax
+ 994:	e8 0f fc ff ff       	call   5a8 <sbrk>
+ 999:	83 c4 10             	add    $0x10,%esp
+ 99c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 99f:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 9a3:	75 07                	jne    9ac <morecore+0x38>
+    return 0;
+ 9a5:	b8 00 00 00 00       	mov    $0x0,%eax
+ 9aa:	eb 26                	jmp    9d2 <morecore+0x5e>
+  hp = (Header*)p;
+ 9ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9af:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 9b2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9b5:	8b 55 08             	mov    0x8(%ebp),%edx
+ 9b8:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 9bb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9be:	83 c0 08             	add    $0x8,%eax
+ 9c1:	83 ec 0c             	sub    $0xc,%esp
+ 9c4:	50                   	push   %eax
+ 9c5:	e8 c8 fe ff ff       	call   892 <free>
+ 9ca:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 9cd:	a1 e8 11 00 00       	mov    0x11e8,%eax
+}
+ 9d2:	c9                   	leave
+ 9d3:	c3                   	ret
+
+000009d4 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 9d4:	55                   	push   %ebp
+ 9d5:	89 e5                	mov    %esp,%ebp
+ 9d7:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9da:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9dd:	83 c0 07             	add    $0x7,%eax
+ 9e0:	c1 e8 03             	shr    $0x3,%eax
+ 9e3:	83 c0 01             	add    $0x1,%eax
+ 9e6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 9e9:	a1 e8 11 00 00       	mov    0x11e8,%eax
+ 9ee:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 9f1:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 9f5:	75 23                	jne    a1a <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 9f7:	c7 45 f0 e0 11 00 00 	movl   $0x11e0,-0x10(%ebp)
+ 9fe:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a01:	a3 e8 11 00 00       	mov    %eax,0x11e8
+ a06:	a1 e8 11 00 00       	mov    0x11e8,%eax
+ a0b:	a3 e0 11 00 00       	mov    %eax,0x11e0
+    base.s.size = 0;
+ a10:	c7 05 e4 11 00 00 00 	movl   $0x0,0x11e4
+ a17:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a1a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a1d:	8b 00                	mov    (%eax),%eax
+ a1f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ a22:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a25:	8b 40 04             	mov    0x4(%eax),%eax
+ a28:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ a2b:	72 4d                	jb     a7a <malloc+0xa6>
+      if(p->s.size == nunits)
+ a2d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a30:	8b 40 04             	mov    0x4(%eax),%eax
+ a33:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ a36:	75 0c                	jne    a44 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ a38:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a3b:	8b 10                	mov    (%eax),%edx
+ a3d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a40:	89 10                	mov    %edx,(%eax)
+ a42:	eb 26                	jmp    a6a <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ a44:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a47:	8b 40 04             	mov    0x4(%eax),%eax
+ a4a:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ a4d:	89 c2                	mov    %eax,%edx
+ a4f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a52:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ a55:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a58:	8b 40 04             	mov    0x4(%eax),%eax
+ a5b:	c1 e0 03             	shl    $0x3,%eax
+ a5e:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ a61:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a64:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ a67:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ a6a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a6d:	a3 e8 11 00 00       	mov    %eax,0x11e8
+      return (void*)(p + 1);
+ a72:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a75:	83 c0 08             	add    $0x8,%eax
+ a78:	eb 3b                	jmp    ab5 <malloc+0xe1>
+    }
+    if(p == freep)
+ a7a:	a1 e8 11 00 00       	mov    0x11e8,%eax
+ a7f:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ a82:	75 1e                	jne    aa2 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ a84:	83 ec 0c             	sub    $0xc,%esp
+ a87:	ff 75 ec             	push   -0x14(%ebp)
+ a8a:	e8 e5 fe ff ff       	call   974 <morecore>
+ a8f:	83 c4 10             	add    $0x10,%esp
+ a92:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ a95:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a99:	75 07                	jne    aa2 <malloc+0xce>
+        return 0;
+ a9b:	b8 00 00 00 00       	mov    $0x0,%eax
+ aa0:	eb 13                	jmp    ab5 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ aa2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aa5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ aa8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aab:	8b 00                	mov    (%eax),%eax
+ aad:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ ab0:	e9 6d ff ff ff       	jmp    a22 <malloc+0x4e>
+  }
+}
+ ab5:	c9                   	leave
+ ab6:	c3                   	ret
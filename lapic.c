@@ -41,6 +41,8 @@
 #define TCCR    (0x0390/4)   // Timer Current Count
 #define TDCR    (0x03E0/4)   // Timer Divide Configuration
 
+#define BUSHZ   1000000000   // the bus frequency qemu's timer counts at
+
 volatile uint *lapic;  // Initialized in mp.c
 
 //PAGEBREAK!
@@ -61,12 +63,13 @@ lapicinit(void)
   lapicw(SVR, ENABLE | (T_IRQ0 + IRQ_SPURIOUS));
 
   // The timer repeatedly counts down at bus frequency
-  // from lapic[TICR] and then issues an interrupt.
+  // from lapic[TICR] and then issues an interrupt, HZ
+  // times a second if the bus runs at BUSHZ.
   // If xv6 cared more about precise timekeeping,
   // TICR would be calibrated using an external time source.
   lapicw(TDCR, X1);
   lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
-  lapicw(TICR, 10000000);
+  lapicw(TICR, BUSHZ / HZ);
 
   // Disable logical interrupt lines.
   lapicw(LINT0, MASKED);
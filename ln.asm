@@ -0,0 +1,1406 @@
+
+_ln:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	89 cb                	mov    %ecx,%ebx
+  if(argc != 3){
+  11:	83 3b 03             	cmpl   $0x3,(%ebx)
+  14:	74 17                	je     2d <main+0x2d>
+    printf(2, "Usage: ln old new\n");
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	68 b9 0a 00 00       	push   $0xab9
+  1e:	6a 02                	push   $0x2
+  20:	e8 b9 06 00 00       	call   6de <printf>
+  25:	83 c4 10             	add    $0x10,%esp
+    exit();
+  28:	e8 f5 04 00 00       	call   522 <exit>
+  }
+  if(link(argv[1], argv[2]) < 0)
+  2d:	8b 43 04             	mov    0x4(%ebx),%eax
+  30:	83 c0 08             	add    $0x8,%eax
+  33:	8b 10                	mov    (%eax),%edx
+  35:	8b 43 04             	mov    0x4(%ebx),%eax
+  38:	83 c0 04             	add    $0x4,%eax
+  3b:	8b 00                	mov    (%eax),%eax
+  3d:	83 ec 08             	sub    $0x8,%esp
+  40:	52                   	push   %edx
+  41:	50                   	push   %eax
+  42:	e8 3b 05 00 00       	call   582 <link>
+  47:	83 c4 10             	add    $0x10,%esp
+  4a:	85 c0                	test   %eax,%eax
+  4c:	79 21                	jns    6f <main+0x6f>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  4e:	8b 43 04             	mov    0x4(%ebx),%eax
+  51:	83 c0 08             	add    $0x8,%eax
+  54:	8b 10                	mov    (%eax),%edx
+  56:	8b 43 04             	mov    0x4(%ebx),%eax
+  59:	83 c0 04             	add    $0x4,%eax
+  5c:	8b 00                	mov    (%eax),%eax
+  5e:	52                   	push   %edx
+  5f:	50                   	push   %eax
+  60:	68 cc 0a 00 00       	push   $0xacc
+  65:	6a 02                	push   $0x2
+  67:	e8 72 06 00 00       	call   6de <printf>
+  6c:	83 c4 10             	add    $0x10,%esp
+  exit();
+  6f:	e8 ae 04 00 00       	call   522 <exit>
+
+00000074 <stosb>:
+}
+
+int
+stat(char *n, struct stat *st)
+{
+  int fd;
+  74:	55                   	push   %ebp
+  75:	89 e5                	mov    %esp,%ebp
+  77:	57                   	push   %edi
+  78:	53                   	push   %ebx
+  int r;
+  79:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  7c:	8b 55 10             	mov    0x10(%ebp),%edx
+  7f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  82:	89 cb                	mov    %ecx,%ebx
+  84:	89 df                	mov    %ebx,%edi
+  86:	89 d1                	mov    %edx,%ecx
+  88:	fc                   	cld
+  89:	f3 aa                	rep stos %al,%es:(%edi)
+  8b:	89 ca                	mov    %ecx,%edx
+  8d:	89 fb                	mov    %edi,%ebx
+  8f:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  92:	89 55 10             	mov    %edx,0x10(%ebp)
+
+  fd = open(n, O_RDONLY);
+  if(fd < 0)
+    return -1;
+  95:	90                   	nop
+  96:	5b                   	pop    %ebx
+  97:	5f                   	pop    %edi
+  98:	5d                   	pop    %ebp
+  99:	c3                   	ret
+
+0000009a <strcpy>:
+{
+  9a:	55                   	push   %ebp
+  9b:	89 e5                	mov    %esp,%ebp
+  9d:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+  a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  a3:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  a6:	90                   	nop
+  a7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  aa:	8d 42 01             	lea    0x1(%edx),%eax
+  ad:	89 45 0c             	mov    %eax,0xc(%ebp)
+  b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  b3:	8d 48 01             	lea    0x1(%eax),%ecx
+  b6:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  b9:	0f b6 12             	movzbl (%edx),%edx
+  bc:	88 10                	mov    %dl,(%eax)
+  be:	0f b6 00             	movzbl (%eax),%eax
+  c1:	84 c0                	test   %al,%al
+  c3:	75 e2                	jne    a7 <strcpy+0xd>
+  return os;
+  c5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  c8:	c9                   	leave
+  c9:	c3                   	ret
+
+000000ca <strlen>:
+{
+  ca:	55                   	push   %ebp
+  cb:	89 e5                	mov    %esp,%ebp
+  cd:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+  d0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  d7:	eb 04                	jmp    dd <strlen+0x13>
+  d9:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  dd:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  e3:	01 d0                	add    %edx,%eax
+  e5:	0f b6 00             	movzbl (%eax),%eax
+  e8:	84 c0                	test   %al,%al
+  ea:	75 ed                	jne    d9 <strlen+0xf>
+  return n;
+  ec:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  ef:	c9                   	leave
+  f0:	c3                   	ret
+
+000000f1 <memset>:
+{
+  f1:	55                   	push   %ebp
+  f2:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+  f4:	8b 45 10             	mov    0x10(%ebp),%eax
+  f7:	50                   	push   %eax
+  f8:	ff 75 0c             	push   0xc(%ebp)
+  fb:	ff 75 08             	push   0x8(%ebp)
+  fe:	e8 71 ff ff ff       	call   74 <stosb>
+ 103:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 106:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 109:	c9                   	leave
+ 10a:	c3                   	ret
+
+0000010b <strchr>:
+{
+ 10b:	55                   	push   %ebp
+ 10c:	89 e5                	mov    %esp,%ebp
+ 10e:	83 ec 04             	sub    $0x4,%esp
+ 111:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 114:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 117:	eb 14                	jmp    12d <strchr+0x22>
+    if(*s == c)
+ 119:	8b 45 08             	mov    0x8(%ebp),%eax
+ 11c:	0f b6 00             	movzbl (%eax),%eax
+ 11f:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 122:	75 05                	jne    129 <strchr+0x1e>
+      return (char*)s;
+ 124:	8b 45 08             	mov    0x8(%ebp),%eax
+ 127:	eb 13                	jmp    13c <strchr+0x31>
+  for(; *s; s++)
+ 129:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 12d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 130:	0f b6 00             	movzbl (%eax),%eax
+ 133:	84 c0                	test   %al,%al
+ 135:	75 e2                	jne    119 <strchr+0xe>
+  return 0;
+ 137:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 13c:	c9                   	leave
+ 13d:	c3                   	ret
+
+0000013e <gets>:
+{
+ 13e:	55                   	push   %ebp
+ 13f:	89 e5                	mov    %esp,%ebp
+ 141:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 144:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 14b:	eb 42                	jmp    18f <gets+0x51>
+    cc = read(0, &c, 1);
+ 14d:	83 ec 04             	sub    $0x4,%esp
+ 150:	6a 01                	push   $0x1
+ 152:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 155:	50                   	push   %eax
+ 156:	6a 00                	push   $0x0
+ 158:	e8 dd 03 00 00       	call   53a <read>
+ 15d:	83 c4 10             	add    $0x10,%esp
+ 160:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 163:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 167:	7e 33                	jle    19c <gets+0x5e>
+    buf[i++] = c;
+ 169:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 16c:	8d 50 01             	lea    0x1(%eax),%edx
+ 16f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 172:	89 c2                	mov    %eax,%edx
+ 174:	8b 45 08             	mov    0x8(%ebp),%eax
+ 177:	01 c2                	add    %eax,%edx
+ 179:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 17d:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 17f:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 183:	3c 0a                	cmp    $0xa,%al
+ 185:	74 16                	je     19d <gets+0x5f>
+ 187:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 18b:	3c 0d                	cmp    $0xd,%al
+ 18d:	74 0e                	je     19d <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 18f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 192:	83 c0 01             	add    $0x1,%eax
+ 195:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 198:	7f b3                	jg     14d <gets+0xf>
+ 19a:	eb 01                	jmp    19d <gets+0x5f>
+      break;
+ 19c:	90                   	nop
+  buf[i] = '\0';
+ 19d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1a0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a3:	01 d0                	add    %edx,%eax
+ 1a5:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 1a8:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1ab:	c9                   	leave
+ 1ac:	c3                   	ret
+
+000001ad <stat>:
+{
+ 1ad:	55                   	push   %ebp
+ 1ae:	89 e5                	mov    %esp,%ebp
+ 1b0:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+ 1b3:	83 ec 08             	sub    $0x8,%esp
+ 1b6:	6a 00                	push   $0x0
+ 1b8:	ff 75 08             	push   0x8(%ebp)
+ 1bb:	e8 a2 03 00 00       	call   562 <open>
+ 1c0:	83 c4 10             	add    $0x10,%esp
+ 1c3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 1c6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 1ca:	79 07                	jns    1d3 <stat+0x26>
+    return -1;
+ 1cc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 1d1:	eb 25                	jmp    1f8 <stat+0x4b>
+  r = fstat(fd, st);
+ 1d3:	83 ec 08             	sub    $0x8,%esp
+ 1d6:	ff 75 0c             	push   0xc(%ebp)
+ 1d9:	ff 75 f4             	push   -0xc(%ebp)
+ 1dc:	e8 99 03 00 00       	call   57a <fstat>
+ 1e1:	83 c4 10             	add    $0x10,%esp
+ 1e4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 1e7:	83 ec 0c             	sub    $0xc,%esp
+ 1ea:	ff 75 f4             	push   -0xc(%ebp)
+ 1ed:	e8 58 03 00 00       	call   54a <close>
+ 1f2:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 1f5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 1f8:	c9                   	leave
+ 1f9:	c3                   	ret
+
+000001fa <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 1fa:	55                   	push   %ebp
+ 1fb:	89 e5                	mov    %esp,%ebp
+ 1fd:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+
+  dst = vdst;
+ 200:	8b 45 08             	mov    0x8(%ebp),%eax
+ 203:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 206:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 209:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 20c:	eb 17                	jmp    225 <memmove+0x2b>
+    *dst++ = *src++;
+ 20e:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 211:	8d 42 01             	lea    0x1(%edx),%eax
+ 214:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 217:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 21a:	8d 48 01             	lea    0x1(%eax),%ecx
+ 21d:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 220:	0f b6 12             	movzbl (%edx),%edx
+ 223:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 225:	8b 45 10             	mov    0x10(%ebp),%eax
+ 228:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 22b:	89 55 10             	mov    %edx,0x10(%ebp)
+ 22e:	85 c0                	test   %eax,%eax
+ 230:	7f dc                	jg     20e <memmove+0x14>
+  return vdst;
+ 232:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 235:	c9                   	leave
+ 236:	c3                   	ret
+
+00000237 <cpuinfo>:
+ 237:	55                   	push   %ebp
+ 238:	89 e5                	mov    %esp,%ebp
+ 23a:	56                   	push   %esi
+ 23b:	53                   	push   %ebx
+ 23c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 23f:	ba 00 00 00 00       	mov    $0x0,%edx
+ 244:	89 d1                	mov    %edx,%ecx
+ 246:	0f a2                	cpuid
+ 248:	89 c6                	mov    %eax,%esi
+ 24a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 24d:	89 30                	mov    %esi,(%eax)
+ 24f:	8b 45 10             	mov    0x10(%ebp),%eax
+ 252:	89 18                	mov    %ebx,(%eax)
+ 254:	8b 45 14             	mov    0x14(%ebp),%eax
+ 257:	89 08                	mov    %ecx,(%eax)
+ 259:	8b 45 18             	mov    0x18(%ebp),%eax
+ 25c:	89 10                	mov    %edx,(%eax)
+ 25e:	90                   	nop
+ 25f:	5b                   	pop    %ebx
+ 260:	5e                   	pop    %esi
+ 261:	5d                   	pop    %ebp
+ 262:	c3                   	ret
+
+00000263 <atoi>:
+{
+ 263:	55                   	push   %ebp
+ 264:	89 e5                	mov    %esp,%ebp
+ 266:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+ 269:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 270:	eb 25                	jmp    297 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 272:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 275:	89 d0                	mov    %edx,%eax
+ 277:	c1 e0 02             	shl    $0x2,%eax
+ 27a:	01 d0                	add    %edx,%eax
+ 27c:	01 c0                	add    %eax,%eax
+ 27e:	89 c1                	mov    %eax,%ecx
+ 280:	8b 45 08             	mov    0x8(%ebp),%eax
+ 283:	8d 50 01             	lea    0x1(%eax),%edx
+ 286:	89 55 08             	mov    %edx,0x8(%ebp)
+ 289:	0f b6 00             	movzbl (%eax),%eax
+ 28c:	0f be c0             	movsbl %al,%eax
+ 28f:	01 c8                	add    %ecx,%eax
+ 291:	83 e8 30             	sub    $0x30,%eax
+ 294:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 297:	8b 45 08             	mov    0x8(%ebp),%eax
+ 29a:	0f b6 00             	movzbl (%eax),%eax
+ 29d:	3c 2f                	cmp    $0x2f,%al
+ 29f:	7e 0a                	jle    2ab <atoi+0x48>
+ 2a1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a4:	0f b6 00             	movzbl (%eax),%eax
+ 2a7:	3c 39                	cmp    $0x39,%al
+ 2a9:	7e c7                	jle    272 <atoi+0xf>
+  return n;
+ 2ab:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2ae:	c9                   	leave
+ 2af:	c3                   	ret
+
+000002b0 <strcmp>:
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 2b3:	eb 08                	jmp    2bd <strcmp+0xd>
+    p++, q++;
+ 2b5:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 2b9:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 2bd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c0:	0f b6 00             	movzbl (%eax),%eax
+ 2c3:	84 c0                	test   %al,%al
+ 2c5:	74 10                	je     2d7 <strcmp+0x27>
+ 2c7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ca:	0f b6 10             	movzbl (%eax),%edx
+ 2cd:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2d0:	0f b6 00             	movzbl (%eax),%eax
+ 2d3:	38 c2                	cmp    %al,%dl
+ 2d5:	74 de                	je     2b5 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 2d7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2da:	0f b6 00             	movzbl (%eax),%eax
+ 2dd:	0f b6 d0             	movzbl %al,%edx
+ 2e0:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2e3:	0f b6 00             	movzbl (%eax),%eax
+ 2e6:	0f b6 c0             	movzbl %al,%eax
+ 2e9:	29 c2                	sub    %eax,%edx
+ 2eb:	89 d0                	mov    %edx,%eax
+}
+ 2ed:	5d                   	pop    %ebp
+ 2ee:	c3                   	ret
+
+000002ef <udiv64>:
+{
+ 2ef:	55                   	push   %ebp
+ 2f0:	89 e5                	mov    %esp,%ebp
+ 2f2:	57                   	push   %edi
+ 2f3:	56                   	push   %esi
+ 2f4:	83 ec 38             	sub    $0x38,%esp
+ 2f7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2fa:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 2fd:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 300:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 303:	8b 45 10             	mov    0x10(%ebp),%eax
+ 306:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 309:	8b 45 14             	mov    0x14(%ebp),%eax
+ 30c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  q = r = 0;
+ 30f:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 316:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 31d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 320:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 323:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 326:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 329:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 330:	e9 85 00 00 00       	jmp    3ba <udiv64+0xcb>
+    r = (r << 1) | ((n >> i) & 1);
+ 335:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 338:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 33b:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 33f:	01 c0                	add    %eax,%eax
+ 341:	89 c6                	mov    %eax,%esi
+ 343:	89 d7                	mov    %edx,%edi
+ 345:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 348:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 34b:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 34e:	0f ad d0             	shrd   %cl,%edx,%eax
+ 351:	d3 ea                	shr    %cl,%edx
+ 353:	f6 c1 20             	test   $0x20,%cl
+ 356:	74 04                	je     35c <udiv64+0x6d>
+ 358:	89 d0                	mov    %edx,%eax
+ 35a:	31 d2                	xor    %edx,%edx
+ 35c:	83 e0 01             	and    $0x1,%eax
+ 35f:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 362:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+ 369:	89 f0                	mov    %esi,%eax
+ 36b:	89 fa                	mov    %edi,%edx
+ 36d:	0b 45 c0             	or     -0x40(%ebp),%eax
+ 370:	0b 55 c4             	or     -0x3c(%ebp),%edx
+ 373:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 376:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 379:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 37c:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 37f:	3b 45 c8             	cmp    -0x38(%ebp),%eax
+ 382:	89 d0                	mov    %edx,%eax
+ 384:	1b 45 cc             	sbb    -0x34(%ebp),%eax
+ 387:	72 2d                	jb     3b6 <udiv64+0xc7>
+      r -= d;
+ 389:	8b 45 c8             	mov    -0x38(%ebp),%eax
+ 38c:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 38f:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 392:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64_t)1 << i;
+ 395:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 398:	b8 01 00 00 00       	mov    $0x1,%eax
+ 39d:	ba 00 00 00 00       	mov    $0x0,%edx
+ 3a2:	0f a5 c2             	shld   %cl,%eax,%edx
+ 3a5:	d3 e0                	shl    %cl,%eax
+ 3a7:	f6 c1 20             	test   $0x20,%cl
+ 3aa:	74 04                	je     3b0 <udiv64+0xc1>
+ 3ac:	89 c2                	mov    %eax,%edx
+ 3ae:	31 c0                	xor    %eax,%eax
+ 3b0:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 3b3:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 3b6:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 3ba:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 3be:	0f 89 71 ff ff ff    	jns    335 <udiv64+0x46>
+  if(rem)
+ 3c4:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+ 3c8:	74 0e                	je     3d8 <udiv64+0xe9>
+    *rem = r;
+ 3ca:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 3cd:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 3d0:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 3d3:	89 01                	mov    %eax,(%ecx)
+ 3d5:	89 51 04             	mov    %edx,0x4(%ecx)
+  return q;
+ 3d8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 3db:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 3de:	83 c4 38             	add    $0x38,%esp
+ 3e1:	5e                   	pop    %esi
+ 3e2:	5f                   	pop    %edi
+ 3e3:	5d                   	pop    %ebp
+ 3e4:	c3                   	ret
+
+000003e5 <crc32cinit>:
+{
+ 3e5:	55                   	push   %ebp
+ 3e6:	89 e5                	mov    %esp,%ebp
+ 3e8:	83 ec 20             	sub    $0x20,%esp
+  for(i = 0; i < 256; i++){
+ 3eb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 3f2:	eb 4c                	jmp    440 <crc32cinit+0x5b>
+    r = i;
+ 3f4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 3f7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+ 3fa:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+ 401:	eb 26                	jmp    429 <crc32cinit+0x44>
+      r = (r >> 1) ^ ((r & 1) ? CRC32C_POLY : 0);
+ 403:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 406:	d1 e8                	shr    %eax
+ 408:	89 c2                	mov    %eax,%edx
+ 40a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 40d:	83 e0 01             	and    $0x1,%eax
+ 410:	85 c0                	test   %eax,%eax
+ 412:	74 07                	je     41b <crc32cinit+0x36>
+ 414:	b8 78 3b f6 82       	mov    $0x82f63b78,%eax
+ 419:	eb 05                	jmp    420 <crc32cinit+0x3b>
+ 41b:	b8 00 00 00 00       	mov    $0x0,%eax
+ 420:	31 d0                	xor    %edx,%eax
+ 422:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+ 425:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+ 429:	83 7d f8 07          	cmpl   $0x7,-0x8(%ebp)
+ 42d:	76 d4                	jbe    403 <crc32cinit+0x1e>
+    crc32ctab[i] = r;
+ 42f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 432:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 435:	89 14 85 e0 0d 00 00 	mov    %edx,0xde0(,%eax,4)
+  for(i = 0; i < 256; i++){
+ 43c:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 440:	81 7d fc ff 00 00 00 	cmpl   $0xff,-0x4(%ebp)
+ 447:	76 ab                	jbe    3f4 <crc32cinit+0xf>
+  cpuinfo(1, &a, &b, &c, &d);
+ 449:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 44c:	50                   	push   %eax
+ 44d:	8d 45 e8             	lea    -0x18(%ebp),%eax
+ 450:	50                   	push   %eax
+ 451:	8d 45 ec             	lea    -0x14(%ebp),%eax
+ 454:	50                   	push   %eax
+ 455:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 458:	50                   	push   %eax
+ 459:	6a 01                	push   $0x1
+ 45b:	e8 d7 fd ff ff       	call   237 <cpuinfo>
+ 460:	83 c4 14             	add    $0x14,%esp
+  crc32chw = (c & CPUID_SSE42) != 0;
+ 463:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 466:	25 00 00 10 00       	and    $0x100000,%eax
+ 46b:	85 c0                	test   %eax,%eax
+ 46d:	0f 95 c0             	setne  %al
+ 470:	0f b6 c0             	movzbl %al,%eax
+ 473:	a3 c0 0d 00 00       	mov    %eax,0xdc0
+}
+ 478:	90                   	nop
+ 479:	c9                   	leave
+ 47a:	c3                   	ret
+
+0000047b <crc32c>:
+{
+ 47b:	55                   	push   %ebp
+ 47c:	89 e5                	mov    %esp,%ebp
+ 47e:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s = p;
+ 481:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 484:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(crc32chw < 0)
+ 487:	a1 c0 0d 00 00       	mov    0xdc0,%eax
+ 48c:	85 c0                	test   %eax,%eax
+ 48e:	79 05                	jns    495 <crc32c+0x1a>
+    crc32cinit();
+ 490:	e8 50 ff ff ff       	call   3e5 <crc32cinit>
+  crc = ~crc;
+ 495:	f7 55 08             	notl   0x8(%ebp)
+  if(crc32chw){
+ 498:	a1 c0 0d 00 00       	mov    0xdc0,%eax
+ 49d:	85 c0                	test   %eax,%eax
+ 49f:	74 6c                	je     50d <crc32c+0x92>
+    for(; n >= 4; n -= 4, s += 4)
+ 4a1:	eb 18                	jmp    4bb <crc32c+0x40>
+      asm("crc32l %1, %0" : "+r" (crc) : "rm" (*(const uint*)s));
+ 4a3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 4a6:	8b 10                	mov    (%eax),%edx
+ 4a8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4ab:	f2 0f 38 f1 c2       	crc32  %edx,%eax
+ 4b0:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n >= 4; n -= 4, s += 4)
+ 4b3:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+ 4b7:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+ 4bb:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+ 4bf:	77 e2                	ja     4a3 <crc32c+0x28>
+    for(; n > 0; n--, s++)
+ 4c1:	eb 19                	jmp    4dc <crc32c+0x61>
+      asm("crc32b %1, %0" : "+r" (crc) : "qm" (*s));
+ 4c3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 4c6:	0f b6 10             	movzbl (%eax),%edx
+ 4c9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4cc:	f2 0f 38 f0 c2       	crc32  %dl,%eax
+ 4d1:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+ 4d4:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+ 4d8:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 4dc:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 4e0:	75 e1                	jne    4c3 <crc32c+0x48>
+ 4e2:	eb 2f                	jmp    513 <crc32c+0x98>
+      crc = crc32ctab[(crc ^ *s) & 0xff] ^ (crc >> 8);
+ 4e4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 4e7:	0f b6 00             	movzbl (%eax),%eax
+ 4ea:	0f b6 c0             	movzbl %al,%eax
+ 4ed:	33 45 08             	xor    0x8(%ebp),%eax
+ 4f0:	0f b6 c0             	movzbl %al,%eax
+ 4f3:	8b 04 85 e0 0d 00 00 	mov    0xde0(,%eax,4),%eax
+ 4fa:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4fd:	c1 ea 08             	shr    $0x8,%edx
+ 500:	31 d0                	xor    %edx,%eax
+ 502:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+ 505:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+ 509:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 50d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 511:	75 d1                	jne    4e4 <crc32c+0x69>
+  return ~crc;
+ 513:	8b 45 08             	mov    0x8(%ebp),%eax
+ 516:	f7 d0                	not    %eax
+}
+ 518:	c9                   	leave
+ 519:	c3                   	ret
+
+0000051a <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 51a:	b8 01 00 00 00       	mov    $0x1,%eax
+ 51f:	cd 40                	int    $0x40
+ 521:	c3                   	ret
+
+00000522 <exit>:
+SYSCALL(exit)
+ 522:	b8 02 00 00 00       	mov    $0x2,%eax
+ 527:	cd 40                	int    $0x40
+ 529:	c3                   	ret
+
+0000052a <wait>:
+SYSCALL(wait)
+ 52a:	b8 03 00 00 00       	mov    $0x3,%eax
+ 52f:	cd 40                	int    $0x40
+ 531:	c3                   	ret
+
+00000532 <pipe>:
+SYSCALL(pipe)
+ 532:	b8 04 00 00 00       	mov    $0x4,%eax
+ 537:	cd 40                	int    $0x40
+ 539:	c3                   	ret
+
+0000053a <read>:
+SYSCALL(read)
+ 53a:	b8 05 00 00 00       	mov    $0x5,%eax
+ 53f:	cd 40                	int    $0x40
+ 541:	c3                   	ret
+
+00000542 <write>:
+SYSCALL(write)
+ 542:	b8 10 00 00 00       	mov    $0x10,%eax
+ 547:	cd 40                	int    $0x40
+ 549:	c3                   	ret
+
+0000054a <close>:
+SYSCALL(close)
+ 54a:	b8 15 00 00 00       	mov    $0x15,%eax
+ 54f:	cd 40                	int    $0x40
+ 551:	c3                   	ret
+
+00000552 <kill>:
+SYSCALL(kill)
+ 552:	b8 06 00 00 00       	mov    $0x6,%eax
+ 557:	cd 40                	int    $0x40
+ 559:	c3                   	ret
+
+0000055a <exec>:
+SYSCALL(exec)
+ 55a:	b8 07 00 00 00       	mov    $0x7,%eax
+ 55f:	cd 40                	int    $0x40
+ 561:	c3                   	ret
+
+00000562 <open>:
+SYSCALL(open)
+ 562:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 567:	cd 40                	int    $0x40
+ 569:	c3                   	ret
+
+0000056a <mknod>:
+SYSCALL(mknod)
+ 56a:	b8 11 00 00 00       	mov    $0x11,%eax
+ 56f:	cd 40                	int    $0x40
+ 571:	c3                   	ret
+
+00000572 <unlink>:
+SYSCALL(unlink)
+ 572:	b8 12 00 00 00       	mov    $0x12,%eax
+ 577:	cd 40                	int    $0x40
+ 579:	c3                   	ret
+
+0000057a <fstat>:
+SYSCALL(fstat)
+ 57a:	b8 08 00 00 00       	mov    $0x8,%eax
+ 57f:	cd 40                	int    $0x40
+ 581:	c3                   	ret
+
+00000582 <link>:
+SYSCALL(link)
+ 582:	b8 13 00 00 00       	mov    $0x13,%eax
+ 587:	cd 40                	int    $0x40
+ 589:	c3                   	ret
+
+0000058a <mkdir>:
+SYSCALL(mkdir)
+ 58a:	b8 14 00 00 00       	mov    $0x14,%eax
+ 58f:	cd 40                	int    $0x40
+ 591:	c3                   	ret
+
+00000592 <chdir>:
+SYSCALL(chdir)
+ 592:	b8 09 00 00 00       	mov    $0x9,%eax
+ 597:	cd 40                	int    $0x40
+ 599:	c3                   	ret
+
+0000059a <dup>:
+SYSCALL(dup)
+ 59a:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 59f:	cd 40                	int    $0x40
+ 5a1:	c3                   	ret
+
+000005a2 <getpid>:
+SYSCALL(getpid)
+ 5a2:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5a7:	cd 40                	int    $0x40
+ 5a9:	c3                   	ret
+
+000005aa <sbrk>:
+SYSCALL(sbrk)
+ 5aa:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5af:	cd 40                	int    $0x40
+ 5b1:	c3                   	ret
+
+000005b2 <sleep>:
+SYSCALL(sleep)
+ 5b2:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5b7:	cd 40                	int    $0x40
+ 5b9:	c3                   	ret
+
+000005ba <uptime>:
+SYSCALL(uptime)
+ 5ba:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5bf:	cd 40                	int    $0x40
+ 5c1:	c3                   	ret
+
+000005c2 <arp>:
+SYSCALL(arp)
+ 5c2:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5c7:	cd 40                	int    $0x40
+ 5c9:	c3                   	ret
+
+000005ca <ifstat>:
+SYSCALL(ifstat)
+ 5ca:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5cf:	cd 40                	int    $0x40
+ 5d1:	c3                   	ret
+
+000005d2 <pcapctl>:
+SYSCALL(pcapctl)
+ 5d2:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5d7:	cd 40                	int    $0x40
+ 5d9:	c3                   	ret
+
+000005da <pcapread>:
+SYSCALL(pcapread)
+ 5da:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5df:	cd 40                	int    $0x40
+ 5e1:	c3                   	ret
+
+000005e2 <bpfattach>:
+SYSCALL(bpfattach)
+ 5e2:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5e7:	cd 40                	int    $0x40
+ 5e9:	c3                   	ret
+
+000005ea <pktgen>:
+SYSCALL(pktgen)
+ 5ea:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5ef:	cd 40                	int    $0x40
+ 5f1:	c3                   	ret
+
+000005f2 <reflect>:
+SYSCALL(reflect)
+ 5f2:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5f7:	cd 40                	int    $0x40
+ 5f9:	c3                   	ret
+
+000005fa <brctl>:
+SYSCALL(brctl)
+ 5fa:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5ff:	cd 40                	int    $0x40
+ 601:	c3                   	ret
+
+00000602 <hostopen>:
+SYSCALL(hostopen)
+ 602:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 607:	cd 40                	int    $0x40
+ 609:	c3                   	ret
+
+0000060a <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 60a:	55                   	push   %ebp
+ 60b:	89 e5                	mov    %esp,%ebp
+ 60d:	83 ec 18             	sub    $0x18,%esp
+ 610:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 613:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 616:	83 ec 04             	sub    $0x4,%esp
+ 619:	6a 01                	push   $0x1
+ 61b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 61e:	50                   	push   %eax
+ 61f:	ff 75 08             	push   0x8(%ebp)
+ 622:	e8 1b ff ff ff       	call   542 <write>
+ 627:	83 c4 10             	add    $0x10,%esp
+}
+ 62a:	90                   	nop
+ 62b:	c9                   	leave
+ 62c:	c3                   	ret
+
+0000062d <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 62d:	55                   	push   %ebp
+ 62e:	89 e5                	mov    %esp,%ebp
+ 630:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 633:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 63a:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 63e:	74 17                	je     657 <printint+0x2a>
+ 640:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 644:	79 11                	jns    657 <printint+0x2a>
+    neg = 1;
+ 646:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 64d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 650:	f7 d8                	neg    %eax
+ 652:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 655:	eb 06                	jmp    65d <printint+0x30>
+  } else {
+    x = xx;
+ 657:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 65a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 65d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 664:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 667:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 66a:	ba 00 00 00 00       	mov    $0x0,%edx
+ 66f:	f7 f1                	div    %ecx
+ 671:	89 d1                	mov    %edx,%ecx
+ 673:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 676:	8d 50 01             	lea    0x1(%eax),%edx
+ 679:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 67c:	0f b6 91 c4 0d 00 00 	movzbl 0xdc4(%ecx),%edx
+ 683:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 687:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 68a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 68d:	ba 00 00 00 00       	mov    $0x0,%edx
+ 692:	f7 f1                	div    %ecx
+ 694:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 697:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 69b:	75 c7                	jne    664 <printint+0x37>
+  if(neg)
+ 69d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 6a1:	74 2d                	je     6d0 <printint+0xa3>
+    buf[i++] = '-';
+ 6a3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6a6:	8d 50 01             	lea    0x1(%eax),%edx
+ 6a9:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 6ac:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 6b1:	eb 1d                	jmp    6d0 <printint+0xa3>
+    putc(fd, buf[i]);
+ 6b3:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 6b6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6b9:	01 d0                	add    %edx,%eax
+ 6bb:	0f b6 00             	movzbl (%eax),%eax
+ 6be:	0f be c0             	movsbl %al,%eax
+ 6c1:	83 ec 08             	sub    $0x8,%esp
+ 6c4:	50                   	push   %eax
+ 6c5:	ff 75 08             	push   0x8(%ebp)
+ 6c8:	e8 3d ff ff ff       	call   60a <putc>
+ 6cd:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 6d0:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 6d4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 6d8:	79 d9                	jns    6b3 <printint+0x86>
+}
+ 6da:	90                   	nop
+ 6db:	90                   	nop
+ 6dc:	c9                   	leave
+ 6dd:	c3                   	ret
+
+000006de <printf>:
+
+// Print to the given fd. Only understands %d, %u, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 6de:	55                   	push   %ebp
+ 6df:	89 e5                	mov    %esp,%ebp
+ 6e1:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 6e4:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 6eb:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 6ee:	83 c0 04             	add    $0x4,%eax
+ 6f1:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 6f4:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 6fb:	e9 7d 01 00 00       	jmp    87d <printf+0x19f>
+    c = fmt[i] & 0xff;
+ 700:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 703:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 706:	01 d0                	add    %edx,%eax
+ 708:	0f b6 00             	movzbl (%eax),%eax
+ 70b:	0f be c0             	movsbl %al,%eax
+ 70e:	25 ff 00 00 00       	and    $0xff,%eax
+ 713:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 716:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 71a:	75 2c                	jne    748 <printf+0x6a>
+      if(c == '%'){
+ 71c:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 720:	75 0c                	jne    72e <printf+0x50>
+        state = '%';
+ 722:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 729:	e9 4b 01 00 00       	jmp    879 <printf+0x19b>
+      } else {
+        putc(fd, c);
+ 72e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 731:	0f be c0             	movsbl %al,%eax
+ 734:	83 ec 08             	sub    $0x8,%esp
+ 737:	50                   	push   %eax
+ 738:	ff 75 08             	push   0x8(%ebp)
+ 73b:	e8 ca fe ff ff       	call   60a <putc>
+ 740:	83 c4 10             	add    $0x10,%esp
+ 743:	e9 31 01 00 00       	jmp    879 <printf+0x19b>
+      }
+    } else if(state == '%'){
+ 748:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 74c:	0f 85 27 01 00 00    	jne    879 <printf+0x19b>
+      if(c == 'd'){
+ 752:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 756:	75 1e                	jne    776 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 758:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 75b:	8b 00                	mov    (%eax),%eax
+ 75d:	6a 01                	push   $0x1
+ 75f:	6a 0a                	push   $0xa
+ 761:	50                   	push   %eax
+ 762:	ff 75 08             	push   0x8(%ebp)
+ 765:	e8 c3 fe ff ff       	call   62d <printint>
+ 76a:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 76d:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 771:	e9 fc 00 00 00       	jmp    872 <printf+0x194>
+      } else if(c == 'u'){
+ 776:	83 7d e4 75          	cmpl   $0x75,-0x1c(%ebp)
+ 77a:	75 1e                	jne    79a <printf+0xbc>
+        printint(fd, *ap, 10, 0);
+ 77c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 77f:	8b 00                	mov    (%eax),%eax
+ 781:	6a 00                	push   $0x0
+ 783:	6a 0a                	push   $0xa
+ 785:	50                   	push   %eax
+ 786:	ff 75 08             	push   0x8(%ebp)
+ 789:	e8 9f fe ff ff       	call   62d <printint>
+ 78e:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 791:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 795:	e9 d8 00 00 00       	jmp    872 <printf+0x194>
+      } else if(c == 'x' || c == 'p'){
+ 79a:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 79e:	74 06                	je     7a6 <printf+0xc8>
+ 7a0:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 7a4:	75 1e                	jne    7c4 <printf+0xe6>
+        printint(fd, *ap, 16, 0);
+ 7a6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7a9:	8b 00                	mov    (%eax),%eax
+ 7ab:	6a 00                	push   $0x0
+ 7ad:	6a 10                	push   $0x10
+ 7af:	50                   	push   %eax
+ 7b0:	ff 75 08             	push   0x8(%ebp)
+ 7b3:	e8 75 fe ff ff       	call   62d <printint>
+ 7b8:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 7bb:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7bf:	e9 ae 00 00 00       	jmp    872 <printf+0x194>
+      } else if(c == 's'){
+ 7c4:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 7c8:	75 43                	jne    80d <printf+0x12f>
+        s = (char*)*ap;
+ 7ca:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7cd:	8b 00                	mov    (%eax),%eax
+ 7cf:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 7d2:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 7d6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 7da:	75 25                	jne    801 <printf+0x123>
+          s = "(null)";
+ 7dc:	c7 45 f4 e0 0a 00 00 	movl   $0xae0,-0xc(%ebp)
+        while(*s != 0){
+ 7e3:	eb 1c                	jmp    801 <printf+0x123>
+          putc(fd, *s);
+ 7e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7e8:	0f b6 00             	movzbl (%eax),%eax
+ 7eb:	0f be c0             	movsbl %al,%eax
+ 7ee:	83 ec 08             	sub    $0x8,%esp
+ 7f1:	50                   	push   %eax
+ 7f2:	ff 75 08             	push   0x8(%ebp)
+ 7f5:	e8 10 fe ff ff       	call   60a <putc>
+ 7fa:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 7fd:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 801:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 804:	0f b6 00             	movzbl (%eax),%eax
+ 807:	84 c0                	test   %al,%al
+ 809:	75 da                	jne    7e5 <printf+0x107>
+ 80b:	eb 65                	jmp    872 <printf+0x194>
+        }
+      } else if(c == 'c'){
+ 80d:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 811:	75 1d                	jne    830 <printf+0x152>
+        putc(fd, *ap);
+ 813:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 816:	8b 00                	mov    (%eax),%eax
+ 818:	0f be c0             	movsbl %al,%eax
+ 81b:	83 ec 08             	sub    $0x8,%esp
+ 81e:	50                   	push   %eax
+ 81f:	ff 75 08             	push   0x8(%ebp)
+ 822:	e8 e3 fd ff ff       	call   60a <putc>
+ 827:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 82a:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 82e:	eb 42                	jmp    872 <printf+0x194>
+      } else if(c == '%'){
+ 830:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 834:	75 17                	jne    84d <printf+0x16f>
+        putc(fd, c);
+ 836:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 839:	0f be c0             	movsbl %al,%eax
+ 83c:	83 ec 08             	sub    $0x8,%esp
+ 83f:	50                   	push   %eax
+ 840:	ff 75 08             	push   0x8(%ebp)
+ 843:	e8 c2 fd ff ff       	call   60a <putc>
+ 848:	83 c4 10             	add    $0x10,%esp
+ 84b:	eb 25                	jmp    872 <printf+0x194>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 84d:	83 ec 08             	sub    $0x8,%esp
+ 850:	6a 25                	push   $0x25
+ 852:	ff 75 08             	push   0x8(%ebp)
+ 855:	e8 b0 fd ff ff       	call   60a <putc>
+ 85a:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 85d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 860:	0f be c0             	movsbl %al,%eax
+ 863:	83 ec 08             	sub    $0x8,%esp
+ 866:	50                   	push   %eax
+ 867:	ff 75 08             	push   0x8(%ebp)
+ 86a:	e8 9b fd ff ff       	call   60a <putc>
+ 86f:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 872:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 879:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 87d:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 880:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 883:	01 d0                	add    %edx,%eax
+ 885:	0f b6 00             	movzbl (%eax),%eax
+ 888:	84 c0                	test   %al,%al
+ 88a:	0f 85 70 fe ff ff    	jne    700 <printf+0x22>
+    }
+  }
+}
+ 890:	90                   	nop
+ 891:	90                   	nop
+ 892:	c9                   	leave
+ 893:	c3                   	ret
+
+00000894 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 894:	55                   	push   %ebp
+ 895:	89 e5                	mov    %esp,%ebp
+ 897:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 89a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 89d:	83 e8 08             	sub    $0x8,%eax
+ 8a0:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8a3:	a1 e8 11 00 00       	mov    0x11e8,%eax
+ 8a8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 8ab:	eb 24                	jmp    8d1 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8ad:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8b0:	8b 00                	mov    (%eax),%eax
+ 8b2:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 8b5:	72 12                	jb     8c9 <free+0x35>
+ 8b7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8ba:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 8bd:	72 24                	jb     8e3 <free+0x4f>
+ 8bf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8c2:	8b 00                	mov    (%eax),%eax
+ 8c4:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 8c7:	72 1a                	jb     8e3 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8c9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8cc:	8b 00                	mov    (%eax),%eax
+ 8ce:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 8d1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8d4:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 8d7:	73 d4                	jae    8ad <free+0x19>
+ 8d9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8dc:	8b 00                	mov    (%eax),%eax
+ 8de:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 8e1:	73 ca                	jae    8ad <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 8e3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8e6:	8b 40 04             	mov    0x4(%eax),%eax
+ 8e9:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 8f0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8f3:	01 c2                	add    %eax,%edx
+ 8f5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8f8:	8b 00                	mov    (%eax),%eax
+ 8fa:	39 c2                	cmp    %eax,%edx
+ 8fc:	75 24                	jne    922 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 8fe:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 901:	8b 50 04             	mov    0x4(%eax),%edx
+ 904:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 907:	8b 00                	mov    (%eax),%eax
+ 909:	8b 40 04             	mov    0x4(%eax),%eax
+ 90c:	01 c2                	add    %eax,%edx
+ 90e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 911:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 914:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 917:	8b 00                	mov    (%eax),%eax
+ 919:	8b 10                	mov    (%eax),%edx
+ 91b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 91e:	89 10                	mov    %edx,(%eax)
+ 920:	eb 0a                	jmp    92c <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 922:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 925:	8b 10                	mov    (%eax),%edx
+ 927:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 92a:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 92c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 92f:	8b 40 04             	mov    0x4(%eax),%eax
+ 932:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 939:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 93c:	01 d0                	add    %edx,%eax
+ 93e:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 941:	75 20                	jne    963 <free+0xcf>
+    p->s.size += bp->s.size;
+ 943:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 946:	8b 50 04             	mov    0x4(%eax),%edx
+ 949:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 94c:	8b 40 04             	mov    0x4(%eax),%eax
+ 94f:	01 c2                	add    %eax,%edx
+ 951:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 954:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 957:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 95a:	8b 10                	mov    (%eax),%edx
+ 95c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 95f:	89 10                	mov    %edx,(%eax)
+ 961:	eb 08                	jmp    96b <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 963:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 966:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 969:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 96b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 96e:	a3 e8 11 00 00       	mov    %eax,0x11e8
+}
+ 973:	90                   	nop
+ 974:	c9                   	leave
+ 975:	c3                   	ret
+
+00000976 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 976:	55                   	push   %ebp
+ 977:	89 e5                	mov    %esp,%ebp
+ 979:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 97c:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 983:	77 07                	ja     98c <morecore+0x16>
+    nu = 4096;
+ 985:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 98c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 98f:	c1 e0 03             	shl    $0x3,%eax
+ 992:	83 ec 0c             	sub    $0xc,%esp
+ 995:	50                   	push   %eax
+ 996:	e8 0f fc ff ff       	call   5aa <sbrk>
+ 99b:	83 c4 10             	add    $0x10,%esp
+ 99e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 9a1:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 9a5:	75 07                	jne    9ae <morecore+0x38>
+    return 0;
+ 9a7:	b8 00 00 00 00       	mov    $0x0,%eax
+ 9ac:	eb 26                	jmp    9d4 <morecore+0x5e>
+  hp = (Header*)p;
+ 9ae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9b1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 9b4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9b7:	8b 55 08             	mov    0x8(%ebp),%edx
+ 9ba:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 9bd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9c0:	83 c0 08             	add    $0x8,%eax
+ 9c3:	83 ec 0c             	sub    $0xc,%esp
+ 9c6:	50                   	push   %eax
+ 9c7:	e8 c8 fe ff ff       	call   894 <free>
+ 9cc:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 9cf:	a1 e8 11 00 00       	mov    0x11e8,%eax
+}
+ 9d4:	c9                   	leave
+ 9d5:	c3                   	ret
+
+000009d6 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 9d6:	55                   	push   %ebp
+ 9d7:	89 e5                	mov    %esp,%ebp
+ 9d9:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9dc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9df:	83 c0 07             	add    $0x7,%eax
+ 9e2:	c1 e8 03             	shr    $0x3,%eax
+ 9e5:	83 c0 01             	add    $0x1,%eax
+ 9e8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 9eb:	a1 e8 11 00 00       	mov    0x11e8,%eax
+ 9f0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 9f3:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 9f7:	75 23                	jne    a1c <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 9f9:	c7 45 f0 e0 11 00 00 	movl   $0x11e0,-0x10(%ebp)
+ a00:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a03:	a3 e8 11 00 00       	mov    %eax,0x11e8
+ a08:	a1 e8 11 00 00       	mov    0x11e8,%eax
+ a0d:	a3 e0 11 00 00       	mov    %eax,0x11e0
+    base.s.size = 0;
+ a12:	c7 05 e4 11 00 00 00 	movl   $0x0,0x11e4
+ a19:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a1c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a1f:	8b 00                	mov    (%eax),%eax
+ a21:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ a24:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a27:	8b 40 04             	mov    0x4(%eax),%eax
+ a2a:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ a2d:	72 4d                	jb     a7c <malloc+0xa6>
+      if(p->s.size == nunits)
+ a2f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a32:	8b 40 04             	mov    0x4(%eax),%eax
+ a35:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ a38:	75 0c                	jne    a46 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ a3a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a3d:	8b 10                	mov    (%eax),%edx
+ a3f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a42:	89 10                	mov    %edx,(%eax)
+ a44:	eb 26                	jmp    a6c <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ a46:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a49:	8b 40 04             	mov    0x4(%eax),%eax
+ a4c:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ a4f:	89 c2                	mov    %eax,%edx
+ a51:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a54:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ a57:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a5a:	8b 40 04             	mov    0x4(%eax),%eax
+ a5d:	c1 e0 03             	shl    $0x3,%eax
+ a60:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ a63:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a66:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ a69:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ a6c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a6f:	a3 e8 11 00 00       	mov    %eax,0x11e8
+      return (void*)(p + 1);
+ a74:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a77:	83 c0 08             	add    $0x8,%eax
+ a7a:	eb 3b                	jmp    ab7 <malloc+0xe1>
+    }
+    if(p == freep)
+ a7c:	a1 e8 11 00 00       	mov    0x11e8,%eax
+ a81:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ a84:	75 1e                	jne    aa4 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ a86:	83 ec 0c             	sub    $0xc,%esp
+ a89:	ff 75 ec             	push   -0x14(%ebp)
+ a8c:	e8 e5 fe ff ff       	call   976 <morecore>
+ a91:	83 c4 10             	add    $0x10,%esp
+ a94:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ a97:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a9b:	75 07                	jne    aa4 <malloc+0xce>
+        return 0;
+ a9d:	b8 00 00 00 00       	mov    $0x0,%eax
+ aa2:	eb 13                	jmp    ab7 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ aa4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aa7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ aaa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aad:	8b 00                	mov    (%eax),%eax
+ aaf:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ ab2:	e9 6d ff ff ff       	jmp    a24 <malloc+0x4e>
+  }
+}
+ ab7:	c9                   	leave
+ ab8:	c3                   	ret
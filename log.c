@@ -5,12 +5,13 @@
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "util.h"
 
 // Simple logging that allows concurrent FS system calls.
 //
 // A log transaction contains the updates of multiple FS system
-// calls. The logging system only commits when there are
-// no FS system calls active. Thus there is never
+// calls. The logging system only closes a transaction when there
+// are no FS system calls active in it. Thus there is never
 // any reasoning required about whether a commit might
 // write an uncommitted system call's updates to disk.
 //
@@ -18,22 +19,41 @@
 // its start and end. Usually begin_op() just increments
 // the count of in-progress FS system calls and returns.
 // But if it thinks the log is close to running out, it
-// sleeps until the last outstanding end_op() commits.
+// sleeps until the running transaction has been closed.
+// end_op() returns once the transaction is committed.
+//
+// Commits are done by the flusher thread, one transaction at a
+// time: it closes the running transaction, copies its blocks
+// into the buffers of their log blocks and lets the next
+// transaction begin. That one gathers system calls, which may
+// change the same blocks again, while the flusher writes the log
+// with its header and then, in one sorted batch, the copies to
+// the home locations; then the flusher commits it in turn, so
+// that a stream of small system calls gets committed in a few
+// large groups. A block stays pinned in the cache (B_DIRTY) from
+// log_write until its last logged version is home.
 //
 // The log is a physical re-do log containing disk blocks.
 // The on-disk log format:
 //   header block, containing block #s for block A, B, C, ...
+//     and a CRC-32C over them and the logged blocks
 //   block A
 //   block B
 //   block C
 //   ...
-// Log appends are synchronous.
+// Log appends are synchronous. The header and the blocks are
+// written in one go; a crash in the middle leaves a header whose
+// checksum doesn't match, and recovery ignores it. The header
+// isn't cleared after installation: replaying the transaction of
+// the last commit again is harmless, since nothing changes the
+// home locations of its blocks until the next commit replaces it.
 
 // Contents of the header block, used for both the on-disk header block
 // and to keep track in memory of logged block# before commit.
 struct logheader {
   int n;
   int block[LOGSIZE];
+  uint crc;
 };
 
 struct log {
@@ -41,14 +61,21 @@ struct log {
   int start;
   int size;
   int outstanding; // how many FS sys calls are executing.
-  int committing;  // in commit(), please wait.
+  int committing;  // flusher is copying the closed transaction, please wait.
+  int nwait;       // end_op()s waiting for the running transaction
+  uint seq;        // number of the running transaction
+  uint committed;  // number of the last committed one
   int dev;
   struct logheader lh;
 };
 struct log log;
 
+// Buffers, outside the cache, for writing a transaction's blocks
+// from their log copies to their home locations.
+static struct buf ibuf[LOGSIZE];
+
 static void recover_from_log(void);
-static void commit();
+static void flusher(void);
 
 void
 initlog(int dev)
@@ -62,23 +89,70 @@ initlog(int dev)
   log.start = sb.logstart;
   log.size = sb.nlog;
   log.dev = dev;
+  log.seq = 1;
+  for (int i = 0; i < LOGSIZE; i++)
+    initsleeplock(&ibuf[i].lock, "install");
   recover_from_log();
+  if(kthread("flusher", flusher) < 0)
+    panic("initlog: no flusher");
 }
 
-// Copy committed blocks from log to their home location
+// Write the committed transaction lh, whose blocks are in the
+// log buffers lbuf, to the home locations. They are written
+// together, so the disk can sort them and merge neighbours.
+// The cached home blocks aren't touched: they may already hold
+// changes of the next transaction.
 static void
-install_trans(void)
+install_trans(struct logheader *lh, struct buf **lbuf)
 {
+  struct buf *dbuf[LOGSIZE];
   int tail;
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
-    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
-    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
-    bwrite(dbuf);  // write dst to disk
-    brelse(lbuf);
-    brelse(dbuf);
+  for (tail = 0; tail < lh->n; tail++) {
+    dbuf[tail] = &ibuf[tail];
+    acquiresleep(&ibuf[tail].lock);
+    ibuf[tail].dev = log.dev;
+    ibuf[tail].blockno = lh->block[tail];
+    ibuf[tail].data = lbuf[tail]->data;
+    ibuf[tail].flags = B_VALID;
   }
+  bwritev(dbuf, lh->n);  // write dst to disk
+  for (tail = 0; tail < lh->n; tail++)
+    releasesleep(&ibuf[tail].lock);
+}
+
+// Let the cache evict the blocks of the installed transaction lh
+// again, except those the running transaction has logged since.
+static void
+unpin(struct logheader *lh)
+{
+  struct buf *b;
+  int tail, i;
+
+  for (tail = 0; tail < lh->n; tail++) {
+    b = bread(log.dev, lh->block[tail]);
+    acquire(&log.lock);
+    for (i = 0; i < log.lh.n && log.lh.block[i] != b->blockno; i++)
+      ;
+    if (i == log.lh.n)
+      b->flags &= ~B_DIRTY;
+    release(&log.lock);
+    brelse(b);
+  }
+}
+
+// Checksum of the transaction in lh, whose blocks hold the data.
+static uint
+logcrc(struct logheader *lh, struct buf **bufs)
+{
+  uint crc;
+  int i;
+
+  crc = crc32c(0, &lh->n, sizeof(lh->n));
+  crc = crc32c(crc, lh->block, lh->n * sizeof(lh->block[0]));
+  for (i = 0; i < lh->n; i++)
+    crc = crc32c(crc, bufs[i]->data, BSIZE);
+  return crc;
 }
 
 // Read the log header from disk into the in-memory log header
@@ -89,25 +163,29 @@ read_head(void)
   struct logheader *lh = (struct logheader *) (buf->data);
   int i;
   log.lh.n = lh->n;
+  if (log.lh.n < 0 || log.lh.n > LOGSIZE)
+    log.lh.n = 0;  // torn header
   for (i = 0; i < log.lh.n; i++) {
     log.lh.block[i] = lh->block[i];
   }
+  log.lh.crc = lh->crc;
   brelse(buf);
 }
 
-// Write in-memory log header to disk.
-// This is the true point at which the
-// current transaction commits.
+// Write in-memory log header lh to disk. Only recovery uses
+// this, to clear the log; a commit writes the header together
+// with the blocks.
 static void
-write_head(void)
+write_head(struct logheader *lh)
 {
   struct buf *buf = bread(log.dev, log.start);
   struct logheader *hb = (struct logheader *) (buf->data);
   int i;
-  hb->n = log.lh.n;
-  for (i = 0; i < log.lh.n; i++) {
-    hb->block[i] = log.lh.block[i];
+  hb->n = lh->n;
+  for (i = 0; i < lh->n; i++) {
+    hb->block[i] = lh->block[i];
   }
+  hb->crc = lh->crc;
   bwrite(buf);
   brelse(buf);
 }
@@ -115,10 +193,25 @@ write_head(void)
 static void
 recover_from_log(void)
 {
+  struct buf *lbuf[LOGSIZE];
+  int tail;
+
   read_head();
-  install_trans(); // if committed, copy from log to disk
+  for (tail = 0; tail < log.lh.n; tail++)
+    lbuf[tail] = bread(log.dev, log.start+tail+1); // read log block
+  if (log.lh.n > 0 && logcrc(&log.lh, lbuf) != log.lh.crc) {
+    cprintf("log: ignoring a torn commit\n");
+    for (tail = 0; tail < log.lh.n; tail++)
+      brelse(lbuf[tail]);
+    log.lh.n = 0;
+  }
+  // if committed, copy from log to disk
+  install_trans(&log.lh, lbuf);
+  for (tail = 0; tail < log.lh.n; tail++)
+    brelse(lbuf[tail]);
   log.lh.n = 0;
-  write_head(); // clear the log
+  log.lh.crc = 0;
+  write_head(&log.lh); // clear the log
 }
 
 // called at the start of each FS system call.
@@ -141,69 +234,111 @@ begin_op(void)
 }
 
 // called at the end of each FS system call.
-// commits if this was the last outstanding operation.
+// waits until the transaction it was part of has committed.
 void
 end_op(void)
 {
-  int do_commit = 0;
+  uint seq;
 
   acquire(&log.lock);
   log.outstanding -= 1;
   if(log.committing)
     panic("log.committing");
-  if(log.outstanding == 0){
-    do_commit = 1;
-    log.committing = 1;
-  } else {
-    // begin_op() may be waiting for log space,
-    // and decrementing log.outstanding has decreased
-    // the amount of reserved space.
-    wakeup(&log);
-  }
-  release(&log.lock);
+  seq = log.seq;
 
-  if(do_commit){
-    // call commit w/o holding locks, since not allowed
-    // to sleep with locks.
-    commit();
-    acquire(&log.lock);
-    log.committing = 0;
-    wakeup(&log);
+  // begin_op() may be waiting for log space,
+  // and decrementing log.outstanding has decreased
+  // the amount of reserved space.
+  wakeup(&log);
+
+  if(log.outstanding == 0 && log.lh.n == 0 && log.nwait == 0){
+    // Nothing was written, and nobody waits for a commit.
     release(&log.lock);
+    return;
   }
+
+  log.nwait++;
+  if(log.outstanding == 0)
+    wakeup(&log.nwait);  // the flusher can close the transaction
+  while(log.committed < seq)
+    sleep(&log.committed, &log.lock);
+  release(&log.lock);
 }
 
-// Copy modified blocks from cache to log.
+// Write the log blocks in lbuf with the header, which carries
+// their checksum. This is the true point at which the transaction
+// commits.
 static void
-write_log(void)
+write_log(struct logheader *lh, struct buf **lbuf)
 {
+  struct buf *to[LOGSIZE+1];
   int tail;
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *to = bread(log.dev, log.start+tail+1); // log block
-    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
-    memmove(to->data, from->data, BSIZE);
-    bwrite(to);  // write the log
-    brelse(from);
-    brelse(to);
-  }
+  for (tail = 0; tail < lh->n; tail++)
+    to[tail+1] = lbuf[tail];
+  lh->crc = logcrc(lh, lbuf);
+  to[0] = bread(log.dev, log.start);
+  memmove(to[0]->data, lh, sizeof(*lh));
+  bwritev(to, lh->n+1);  // write the log
+  brelse(to[0]);
 }
 
+// Kernel thread that commits and installs transactions.
 static void
-commit()
+flusher(void)
 {
-  if (log.lh.n > 0) {
-    write_log();     // Write modified blocks from cache to log
-    write_head();    // Write header to disk -- the real commit
-    install_trans(); // Now install writes to home locations
+  static struct logheader lh;
+  struct buf *lbuf[LOGSIZE], *b;
+  int tail;
+  uint seq;
+
+  for (;;) {
+    acquire(&log.lock);
+    while (log.outstanding > 0 || (log.lh.n == 0 && log.nwait == 0))
+      sleep(&log.nwait, &log.lock);
+
+    // Close the running transaction; system calls that
+    // begin from now on are part of the next one.
+    lh = log.lh;
+    seq = log.seq++;
     log.lh.n = 0;
-    write_head();    // Erase the transaction from the log
+    log.nwait = 0;
+    log.committing = 1;
+    release(&log.lock);
+
+    // Copy the blocks, cached and pinned by B_DIRTY since
+    // log_write, to their log blocks, which only the flusher
+    // uses. No system call runs, so none holds them.
+    for (tail = 0; tail < lh.n; tail++) {
+      lbuf[tail] = bread(log.dev, log.start+tail+1);
+      b = bread(log.dev, lh.block[tail]);
+      memmove(lbuf[tail]->data, b->data, BSIZE);
+      brelse(b);
+    }
+
+    acquire(&log.lock);
+    log.committing = 0;
+    wakeup(&log);
+    release(&log.lock);
+
+    if (lh.n > 0)
+      write_log(&lh, lbuf);  // Write log blocks and header -- the real commit
+
+    acquire(&log.lock);
+    log.committed = seq;
+    wakeup(&log.committed);
+    release(&log.lock);
+
+    install_trans(&lh, lbuf);  // Now install writes to home locations
+    unpin(&lh);
+    for (tail = 0; tail < lh.n; tail++)
+      brelse(lbuf[tail]);
   }
 }
 
 // Caller has modified b->data and is done with the buffer.
 // Record the block number and pin in the cache with B_DIRTY.
-// commit()/write_log() will do the disk write.
+// The flusher will do the disk write when it commits.
 //
 // log_write() replaces bwrite(); a typical use is:
 //   bp = bread(...)
@@ -0,0 +1,1700 @@
+
+_ls:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <fmtname>:
+#include "user.h"
+#include "fs.h"
+
+char*
+fmtname(char *path)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	53                   	push   %ebx
+   4:	83 ec 14             	sub    $0x14,%esp
+  static char buf[DIRSIZ+1];
+  char *p;
+
+  // Find first character after last slash.
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+   7:	83 ec 0c             	sub    $0xc,%esp
+   a:	ff 75 08             	push   0x8(%ebp)
+   d:	e8 88 03 00 00       	call   39a <strlen>
+  12:	83 c4 10             	add    $0x10,%esp
+  15:	8b 55 08             	mov    0x8(%ebp),%edx
+  18:	01 d0                	add    %edx,%eax
+  1a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  1d:	eb 04                	jmp    23 <fmtname+0x23>
+  1f:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+  23:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  26:	3b 45 08             	cmp    0x8(%ebp),%eax
+  29:	72 0a                	jb     35 <fmtname+0x35>
+  2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  2e:	0f b6 00             	movzbl (%eax),%eax
+  31:	3c 2f                	cmp    $0x2f,%al
+  33:	75 ea                	jne    1f <fmtname+0x1f>
+    ;
+  p++;
+  35:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+
+  // Return blank-padded name.
+  if(strlen(p) >= DIRSIZ)
+  39:	83 ec 0c             	sub    $0xc,%esp
+  3c:	ff 75 f4             	push   -0xc(%ebp)
+  3f:	e8 56 03 00 00       	call   39a <strlen>
+  44:	83 c4 10             	add    $0x10,%esp
+  47:	83 f8 0d             	cmp    $0xd,%eax
+  4a:	76 05                	jbe    51 <fmtname+0x51>
+    return p;
+  4c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  4f:	eb 60                	jmp    b1 <fmtname+0xb1>
+  memmove(buf, p, strlen(p));
+  51:	83 ec 0c             	sub    $0xc,%esp
+  54:	ff 75 f4             	push   -0xc(%ebp)
+  57:	e8 3e 03 00 00       	call   39a <strlen>
+  5c:	83 c4 10             	add    $0x10,%esp
+  5f:	83 ec 04             	sub    $0x4,%esp
+  62:	50                   	push   %eax
+  63:	ff 75 f4             	push   -0xc(%ebp)
+  66:	68 20 11 00 00       	push   $0x1120
+  6b:	e8 5a 04 00 00       	call   4ca <memmove>
+  70:	83 c4 10             	add    $0x10,%esp
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  73:	83 ec 0c             	sub    $0xc,%esp
+  76:	ff 75 f4             	push   -0xc(%ebp)
+  79:	e8 1c 03 00 00       	call   39a <strlen>
+  7e:	83 c4 10             	add    $0x10,%esp
+  81:	ba 0e 00 00 00       	mov    $0xe,%edx
+  86:	89 d3                	mov    %edx,%ebx
+  88:	29 c3                	sub    %eax,%ebx
+  8a:	83 ec 0c             	sub    $0xc,%esp
+  8d:	ff 75 f4             	push   -0xc(%ebp)
+  90:	e8 05 03 00 00       	call   39a <strlen>
+  95:	83 c4 10             	add    $0x10,%esp
+  98:	05 20 11 00 00       	add    $0x1120,%eax
+  9d:	83 ec 04             	sub    $0x4,%esp
+  a0:	53                   	push   %ebx
+  a1:	6a 20                	push   $0x20
+  a3:	50                   	push   %eax
+  a4:	e8 18 03 00 00       	call   3c1 <memset>
+  a9:	83 c4 10             	add    $0x10,%esp
+  return buf;
+  ac:	b8 20 11 00 00       	mov    $0x1120,%eax
+}
+  b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  b4:	c9                   	leave
+  b5:	c3                   	ret
+
+000000b6 <ls>:
+
+void
+ls(char *path)
+{
+  b6:	55                   	push   %ebp
+  b7:	89 e5                	mov    %esp,%ebp
+  b9:	57                   	push   %edi
+  ba:	56                   	push   %esi
+  bb:	53                   	push   %ebx
+  bc:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  char buf[512], *p;
+  int fd;
+  struct dirent de;
+  struct stat st;
+
+  if((fd = open(path, 0)) < 0){
+  c2:	83 ec 08             	sub    $0x8,%esp
+  c5:	6a 00                	push   $0x0
+  c7:	ff 75 08             	push   0x8(%ebp)
+  ca:	e8 63 07 00 00       	call   832 <open>
+  cf:	83 c4 10             	add    $0x10,%esp
+  d2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  d5:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  d9:	79 1a                	jns    f5 <ls+0x3f>
+    printf(2, "ls: cannot open %s\n", path);
+  db:	83 ec 04             	sub    $0x4,%esp
+  de:	ff 75 08             	push   0x8(%ebp)
+  e1:	68 89 0d 00 00       	push   $0xd89
+  e6:	6a 02                	push   $0x2
+  e8:	e8 c1 08 00 00       	call   9ae <printf>
+  ed:	83 c4 10             	add    $0x10,%esp
+    return;
+  f0:	e9 e3 01 00 00       	jmp    2d8 <ls+0x222>
+  }
+
+  if(fstat(fd, &st) < 0){
+  f5:	83 ec 08             	sub    $0x8,%esp
+  f8:	8d 85 bc fd ff ff    	lea    -0x244(%ebp),%eax
+  fe:	50                   	push   %eax
+  ff:	ff 75 e4             	push   -0x1c(%ebp)
+ 102:	e8 43 07 00 00       	call   84a <fstat>
+ 107:	83 c4 10             	add    $0x10,%esp
+ 10a:	85 c0                	test   %eax,%eax
+ 10c:	79 28                	jns    136 <ls+0x80>
+    printf(2, "ls: cannot stat %s\n", path);
+ 10e:	83 ec 04             	sub    $0x4,%esp
+ 111:	ff 75 08             	push   0x8(%ebp)
+ 114:	68 9d 0d 00 00       	push   $0xd9d
+ 119:	6a 02                	push   $0x2
+ 11b:	e8 8e 08 00 00       	call   9ae <printf>
+ 120:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+ 123:	83 ec 0c             	sub    $0xc,%esp
+ 126:	ff 75 e4             	push   -0x1c(%ebp)
+ 129:	e8 ec 06 00 00       	call   81a <close>
+ 12e:	83 c4 10             	add    $0x10,%esp
+    return;
+ 131:	e9 a2 01 00 00       	jmp    2d8 <ls+0x222>
+  }
+
+  switch(st.type){
+ 136:	0f b7 85 bc fd ff ff 	movzwl -0x244(%ebp),%eax
+ 13d:	98                   	cwtl
+ 13e:	83 f8 01             	cmp    $0x1,%eax
+ 141:	74 48                	je     18b <ls+0xd5>
+ 143:	83 f8 02             	cmp    $0x2,%eax
+ 146:	0f 85 7e 01 00 00    	jne    2ca <ls+0x214>
+  case T_FILE:
+    printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+ 14c:	8b bd cc fd ff ff    	mov    -0x234(%ebp),%edi
+ 152:	8b b5 c4 fd ff ff    	mov    -0x23c(%ebp),%esi
+ 158:	0f b7 85 bc fd ff ff 	movzwl -0x244(%ebp),%eax
+ 15f:	0f bf d8             	movswl %ax,%ebx
+ 162:	83 ec 0c             	sub    $0xc,%esp
+ 165:	ff 75 08             	push   0x8(%ebp)
+ 168:	e8 93 fe ff ff       	call   0 <fmtname>
+ 16d:	83 c4 10             	add    $0x10,%esp
+ 170:	83 ec 08             	sub    $0x8,%esp
+ 173:	57                   	push   %edi
+ 174:	56                   	push   %esi
+ 175:	53                   	push   %ebx
+ 176:	50                   	push   %eax
+ 177:	68 b1 0d 00 00       	push   $0xdb1
+ 17c:	6a 01                	push   $0x1
+ 17e:	e8 2b 08 00 00       	call   9ae <printf>
+ 183:	83 c4 20             	add    $0x20,%esp
+    break;
+ 186:	e9 3f 01 00 00       	jmp    2ca <ls+0x214>
+
+  case T_DIR:
+    if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
+ 18b:	83 ec 0c             	sub    $0xc,%esp
+ 18e:	ff 75 08             	push   0x8(%ebp)
+ 191:	e8 04 02 00 00       	call   39a <strlen>
+ 196:	83 c4 10             	add    $0x10,%esp
+ 199:	83 c0 10             	add    $0x10,%eax
+ 19c:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 1a1:	76 17                	jbe    1ba <ls+0x104>
+      printf(1, "ls: path too long\n");
+ 1a3:	83 ec 08             	sub    $0x8,%esp
+ 1a6:	68 be 0d 00 00       	push   $0xdbe
+ 1ab:	6a 01                	push   $0x1
+ 1ad:	e8 fc 07 00 00       	call   9ae <printf>
+ 1b2:	83 c4 10             	add    $0x10,%esp
+      break;
+ 1b5:	e9 10 01 00 00       	jmp    2ca <ls+0x214>
+    }
+    strcpy(buf, path);
+ 1ba:	83 ec 08             	sub    $0x8,%esp
+ 1bd:	ff 75 08             	push   0x8(%ebp)
+ 1c0:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+ 1c6:	50                   	push   %eax
+ 1c7:	e8 9e 01 00 00       	call   36a <strcpy>
+ 1cc:	83 c4 10             	add    $0x10,%esp
+    p = buf+strlen(buf);
+ 1cf:	83 ec 0c             	sub    $0xc,%esp
+ 1d2:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+ 1d8:	50                   	push   %eax
+ 1d9:	e8 bc 01 00 00       	call   39a <strlen>
+ 1de:	83 c4 10             	add    $0x10,%esp
+ 1e1:	8d 95 e0 fd ff ff    	lea    -0x220(%ebp),%edx
+ 1e7:	01 d0                	add    %edx,%eax
+ 1e9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    *p++ = '/';
+ 1ec:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 1ef:	8d 50 01             	lea    0x1(%eax),%edx
+ 1f2:	89 55 e0             	mov    %edx,-0x20(%ebp)
+ 1f5:	c6 00 2f             	movb   $0x2f,(%eax)
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 1f8:	e9 ac 00 00 00       	jmp    2a9 <ls+0x1f3>
+      if(de.inum == 0)
+ 1fd:	0f b7 85 d0 fd ff ff 	movzwl -0x230(%ebp),%eax
+ 204:	66 85 c0             	test   %ax,%ax
+ 207:	0f 84 9b 00 00 00    	je     2a8 <ls+0x1f2>
+        continue;
+      memmove(p, de.name, DIRSIZ);
+ 20d:	83 ec 04             	sub    $0x4,%esp
+ 210:	6a 0e                	push   $0xe
+ 212:	8d 85 d0 fd ff ff    	lea    -0x230(%ebp),%eax
+ 218:	83 c0 02             	add    $0x2,%eax
+ 21b:	50                   	push   %eax
+ 21c:	ff 75 e0             	push   -0x20(%ebp)
+ 21f:	e8 a6 02 00 00       	call   4ca <memmove>
+ 224:	83 c4 10             	add    $0x10,%esp
+      p[DIRSIZ] = 0;
+ 227:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 22a:	83 c0 0e             	add    $0xe,%eax
+ 22d:	c6 00 00             	movb   $0x0,(%eax)
+      if(stat(buf, &st) < 0){
+ 230:	83 ec 08             	sub    $0x8,%esp
+ 233:	8d 85 bc fd ff ff    	lea    -0x244(%ebp),%eax
+ 239:	50                   	push   %eax
+ 23a:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+ 240:	50                   	push   %eax
+ 241:	e8 37 02 00 00       	call   47d <stat>
+ 246:	83 c4 10             	add    $0x10,%esp
+ 249:	85 c0                	test   %eax,%eax
+ 24b:	79 1b                	jns    268 <ls+0x1b2>
+        printf(1, "ls: cannot stat %s\n", buf);
+ 24d:	83 ec 04             	sub    $0x4,%esp
+ 250:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+ 256:	50                   	push   %eax
+ 257:	68 9d 0d 00 00       	push   $0xd9d
+ 25c:	6a 01                	push   $0x1
+ 25e:	e8 4b 07 00 00       	call   9ae <printf>
+ 263:	83 c4 10             	add    $0x10,%esp
+        continue;
+ 266:	eb 41                	jmp    2a9 <ls+0x1f3>
+      }
+      printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
+ 268:	8b bd cc fd ff ff    	mov    -0x234(%ebp),%edi
+ 26e:	8b b5 c4 fd ff ff    	mov    -0x23c(%ebp),%esi
+ 274:	0f b7 85 bc fd ff ff 	movzwl -0x244(%ebp),%eax
+ 27b:	0f bf d8             	movswl %ax,%ebx
+ 27e:	83 ec 0c             	sub    $0xc,%esp
+ 281:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+ 287:	50                   	push   %eax
+ 288:	e8 73 fd ff ff       	call   0 <fmtname>
+ 28d:	83 c4 10             	add    $0x10,%esp
+ 290:	83 ec 08             	sub    $0x8,%esp
+ 293:	57                   	push   %edi
+ 294:	56                   	push   %esi
+ 295:	53                   	push   %ebx
+ 296:	50                   	push   %eax
+ 297:	68 b1 0d 00 00       	push   $0xdb1
+ 29c:	6a 01                	push   $0x1
+ 29e:	e8 0b 07 00 00       	call   9ae <printf>
+ 2a3:	83 c4 20             	add    $0x20,%esp
+ 2a6:	eb 01                	jmp    2a9 <ls+0x1f3>
+        continue;
+ 2a8:	90                   	nop
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 2a9:	83 ec 04             	sub    $0x4,%esp
+ 2ac:	6a 10                	push   $0x10
+ 2ae:	8d 85 d0 fd ff ff    	lea    -0x230(%ebp),%eax
+ 2b4:	50                   	push   %eax
+ 2b5:	ff 75 e4             	push   -0x1c(%ebp)
+ 2b8:	e8 4d 05 00 00       	call   80a <read>
+ 2bd:	83 c4 10             	add    $0x10,%esp
+ 2c0:	83 f8 10             	cmp    $0x10,%eax
+ 2c3:	0f 84 34 ff ff ff    	je     1fd <ls+0x147>
+    }
+    break;
+ 2c9:	90                   	nop
+  }
+  close(fd);
+ 2ca:	83 ec 0c             	sub    $0xc,%esp
+ 2cd:	ff 75 e4             	push   -0x1c(%ebp)
+ 2d0:	e8 45 05 00 00       	call   81a <close>
+ 2d5:	83 c4 10             	add    $0x10,%esp
+}
+ 2d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2db:	5b                   	pop    %ebx
+ 2dc:	5e                   	pop    %esi
+ 2dd:	5f                   	pop    %edi
+ 2de:	5d                   	pop    %ebp
+ 2df:	c3                   	ret
+
+000002e0 <main>:
+
+int
+main(int argc, char *argv[])
+{
+ 2e0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 2e4:	83 e4 f0             	and    $0xfffffff0,%esp
+ 2e7:	ff 71 fc             	push   -0x4(%ecx)
+ 2ea:	55                   	push   %ebp
+ 2eb:	89 e5                	mov    %esp,%ebp
+ 2ed:	53                   	push   %ebx
+ 2ee:	51                   	push   %ecx
+ 2ef:	83 ec 10             	sub    $0x10,%esp
+ 2f2:	89 cb                	mov    %ecx,%ebx
+  int i;
+
+  if(argc < 2){
+ 2f4:	83 3b 01             	cmpl   $0x1,(%ebx)
+ 2f7:	7f 15                	jg     30e <main+0x2e>
+    ls(".");
+ 2f9:	83 ec 0c             	sub    $0xc,%esp
+ 2fc:	68 d1 0d 00 00       	push   $0xdd1
+ 301:	e8 b0 fd ff ff       	call   b6 <ls>
+ 306:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 309:	e8 e4 04 00 00       	call   7f2 <exit>
+  }
+  for(i=1; i<argc; i++)
+ 30e:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+ 315:	eb 21                	jmp    338 <main+0x58>
+    ls(argv[i]);
+ 317:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 31a:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 321:	8b 43 04             	mov    0x4(%ebx),%eax
+ 324:	01 d0                	add    %edx,%eax
+ 326:	8b 00                	mov    (%eax),%eax
+ 328:	83 ec 0c             	sub    $0xc,%esp
+ 32b:	50                   	push   %eax
+ 32c:	e8 85 fd ff ff       	call   b6 <ls>
+ 331:	83 c4 10             	add    $0x10,%esp
+  for(i=1; i<argc; i++)
+ 334:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 338:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 33b:	3b 03                	cmp    (%ebx),%eax
+ 33d:	7c d8                	jl     317 <main+0x37>
+  exit();
+ 33f:	e8 ae 04 00 00       	call   7f2 <exit>
+
+00000344 <stosb>:
+}
+
+int
+stat(char *n, struct stat *st)
+{
+  int fd;
+ 344:	55                   	push   %ebp
+ 345:	89 e5                	mov    %esp,%ebp
+ 347:	57                   	push   %edi
+ 348:	53                   	push   %ebx
+  int r;
+ 349:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 34c:	8b 55 10             	mov    0x10(%ebp),%edx
+ 34f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 352:	89 cb                	mov    %ecx,%ebx
+ 354:	89 df                	mov    %ebx,%edi
+ 356:	89 d1                	mov    %edx,%ecx
+ 358:	fc                   	cld
+ 359:	f3 aa                	rep stos %al,%es:(%edi)
+ 35b:	89 ca                	mov    %ecx,%edx
+ 35d:	89 fb                	mov    %edi,%ebx
+ 35f:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 362:	89 55 10             	mov    %edx,0x10(%ebp)
+
+  fd = open(n, O_RDONLY);
+  if(fd < 0)
+    return -1;
+ 365:	90                   	nop
+ 366:	5b                   	pop    %ebx
+ 367:	5f                   	pop    %edi
+ 368:	5d                   	pop    %ebp
+ 369:	c3                   	ret
+
+0000036a <strcpy>:
+{
+ 36a:	55                   	push   %ebp
+ 36b:	89 e5                	mov    %esp,%ebp
+ 36d:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 370:	8b 45 08             	mov    0x8(%ebp),%eax
+ 373:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 376:	90                   	nop
+ 377:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 37a:	8d 42 01             	lea    0x1(%edx),%eax
+ 37d:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 380:	8b 45 08             	mov    0x8(%ebp),%eax
+ 383:	8d 48 01             	lea    0x1(%eax),%ecx
+ 386:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 389:	0f b6 12             	movzbl (%edx),%edx
+ 38c:	88 10                	mov    %dl,(%eax)
+ 38e:	0f b6 00             	movzbl (%eax),%eax
+ 391:	84 c0                	test   %al,%al
+ 393:	75 e2                	jne    377 <strcpy+0xd>
+  return os;
+ 395:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 398:	c9                   	leave
+ 399:	c3                   	ret
+
+0000039a <strlen>:
+{
+ 39a:	55                   	push   %ebp
+ 39b:	89 e5                	mov    %esp,%ebp
+ 39d:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 3a0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 3a7:	eb 04                	jmp    3ad <strlen+0x13>
+ 3a9:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 3ad:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 3b0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b3:	01 d0                	add    %edx,%eax
+ 3b5:	0f b6 00             	movzbl (%eax),%eax
+ 3b8:	84 c0                	test   %al,%al
+ 3ba:	75 ed                	jne    3a9 <strlen+0xf>
+  return n;
+ 3bc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3bf:	c9                   	leave
+ 3c0:	c3                   	ret
+
+000003c1 <memset>:
+{
+ 3c1:	55                   	push   %ebp
+ 3c2:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 3c4:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3c7:	50                   	push   %eax
+ 3c8:	ff 75 0c             	push   0xc(%ebp)
+ 3cb:	ff 75 08             	push   0x8(%ebp)
+ 3ce:	e8 71 ff ff ff       	call   344 <stosb>
+ 3d3:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 3d6:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3d9:	c9                   	leave
+ 3da:	c3                   	ret
+
+000003db <strchr>:
+{
+ 3db:	55                   	push   %ebp
+ 3dc:	89 e5                	mov    %esp,%ebp
+ 3de:	83 ec 04             	sub    $0x4,%esp
+ 3e1:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3e4:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 3e7:	eb 14                	jmp    3fd <strchr+0x22>
+    if(*s == c)
+ 3e9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3ec:	0f b6 00             	movzbl (%eax),%eax
+ 3ef:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 3f2:	75 05                	jne    3f9 <strchr+0x1e>
+      return (char*)s;
+ 3f4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3f7:	eb 13                	jmp    40c <strchr+0x31>
+  for(; *s; s++)
+ 3f9:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 3fd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 400:	0f b6 00             	movzbl (%eax),%eax
+ 403:	84 c0                	test   %al,%al
+ 405:	75 e2                	jne    3e9 <strchr+0xe>
+  return 0;
+ 407:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 40c:	c9                   	leave
+ 40d:	c3                   	ret
+
+0000040e <gets>:
+{
+ 40e:	55                   	push   %ebp
+ 40f:	89 e5                	mov    %esp,%ebp
+ 411:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 414:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 41b:	eb 42                	jmp    45f <gets+0x51>
+    cc = read(0, &c, 1);
+ 41d:	83 ec 04             	sub    $0x4,%esp
+ 420:	6a 01                	push   $0x1
+ 422:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 425:	50                   	push   %eax
+ 426:	6a 00                	push   $0x0
+ 428:	e8 dd 03 00 00       	call   80a <read>
+ 42d:	83 c4 10             	add    $0x10,%esp
+ 430:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 433:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 437:	7e 33                	jle    46c <gets+0x5e>
+    buf[i++] = c;
+ 439:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 43c:	8d 50 01             	lea    0x1(%eax),%edx
+ 43f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 442:	89 c2                	mov    %eax,%edx
+ 444:	8b 45 08             	mov    0x8(%ebp),%eax
+ 447:	01 c2                	add    %eax,%edx
+ 449:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 44d:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 44f:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 453:	3c 0a                	cmp    $0xa,%al
+ 455:	74 16                	je     46d <gets+0x5f>
+ 457:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 45b:	3c 0d                	cmp    $0xd,%al
+ 45d:	74 0e                	je     46d <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 45f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 462:	83 c0 01             	add    $0x1,%eax
+ 465:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 468:	7f b3                	jg     41d <gets+0xf>
+ 46a:	eb 01                	jmp    46d <gets+0x5f>
+      break;
+ 46c:	90                   	nop
+  buf[i] = '\0';
+ 46d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 470:	8b 45 08             	mov    0x8(%ebp),%eax
+ 473:	01 d0                	add    %edx,%eax
+ 475:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 478:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 47b:	c9                   	leave
+ 47c:	c3                   	ret
+
+0000047d <stat>:
+{
+ 47d:	55                   	push   %ebp
+ 47e:	89 e5                	mov    %esp,%ebp
+ 480:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+ 483:	83 ec 08             	sub    $0x8,%esp
+ 486:	6a 00                	push   $0x0
+ 488:	ff 75 08             	push   0x8(%ebp)
+ 48b:	e8 a2 03 00 00       	call   832 <open>
+ 490:	83 c4 10             	add    $0x10,%esp
+ 493:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 496:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 49a:	79 07                	jns    4a3 <stat+0x26>
+    return -1;
+ 49c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 4a1:	eb 25                	jmp    4c8 <stat+0x4b>
+  r = fstat(fd, st);
+ 4a3:	83 ec 08             	sub    $0x8,%esp
+ 4a6:	ff 75 0c             	push   0xc(%ebp)
+ 4a9:	ff 75 f4             	push   -0xc(%ebp)
+ 4ac:	e8 99 03 00 00       	call   84a <fstat>
+ 4b1:	83 c4 10             	add    $0x10,%esp
+ 4b4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 4b7:	83 ec 0c             	sub    $0xc,%esp
+ 4ba:	ff 75 f4             	push   -0xc(%ebp)
+ 4bd:	e8 58 03 00 00       	call   81a <close>
+ 4c2:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 4c5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 4c8:	c9                   	leave
+ 4c9:	c3                   	ret
+
+000004ca <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 4ca:	55                   	push   %ebp
+ 4cb:	89 e5                	mov    %esp,%ebp
+ 4cd:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+
+  dst = vdst;
+ 4d0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4d3:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 4d6:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4d9:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 4dc:	eb 17                	jmp    4f5 <memmove+0x2b>
+    *dst++ = *src++;
+ 4de:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 4e1:	8d 42 01             	lea    0x1(%edx),%eax
+ 4e4:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 4e7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 4ea:	8d 48 01             	lea    0x1(%eax),%ecx
+ 4ed:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 4f0:	0f b6 12             	movzbl (%edx),%edx
+ 4f3:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 4f5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4f8:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 4fb:	89 55 10             	mov    %edx,0x10(%ebp)
+ 4fe:	85 c0                	test   %eax,%eax
+ 500:	7f dc                	jg     4de <memmove+0x14>
+  return vdst;
+ 502:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 505:	c9                   	leave
+ 506:	c3                   	ret
+
+00000507 <cpuinfo>:
+ 507:	55                   	push   %ebp
+ 508:	89 e5                	mov    %esp,%ebp
+ 50a:	56                   	push   %esi
+ 50b:	53                   	push   %ebx
+ 50c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 50f:	ba 00 00 00 00       	mov    $0x0,%edx
+ 514:	89 d1                	mov    %edx,%ecx
+ 516:	0f a2                	cpuid
+ 518:	89 c6                	mov    %eax,%esi
+ 51a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 51d:	89 30                	mov    %esi,(%eax)
+ 51f:	8b 45 10             	mov    0x10(%ebp),%eax
+ 522:	89 18                	mov    %ebx,(%eax)
+ 524:	8b 45 14             	mov    0x14(%ebp),%eax
+ 527:	89 08                	mov    %ecx,(%eax)
+ 529:	8b 45 18             	mov    0x18(%ebp),%eax
+ 52c:	89 10                	mov    %edx,(%eax)
+ 52e:	90                   	nop
+ 52f:	5b                   	pop    %ebx
+ 530:	5e                   	pop    %esi
+ 531:	5d                   	pop    %ebp
+ 532:	c3                   	ret
+
+00000533 <atoi>:
+{
+ 533:	55                   	push   %ebp
+ 534:	89 e5                	mov    %esp,%ebp
+ 536:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+ 539:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 540:	eb 25                	jmp    567 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 542:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 545:	89 d0                	mov    %edx,%eax
+ 547:	c1 e0 02             	shl    $0x2,%eax
+ 54a:	01 d0                	add    %edx,%eax
+ 54c:	01 c0                	add    %eax,%eax
+ 54e:	89 c1                	mov    %eax,%ecx
+ 550:	8b 45 08             	mov    0x8(%ebp),%eax
+ 553:	8d 50 01             	lea    0x1(%eax),%edx
+ 556:	89 55 08             	mov    %edx,0x8(%ebp)
+ 559:	0f b6 00             	movzbl (%eax),%eax
+ 55c:	0f be c0             	movsbl %al,%eax
+ 55f:	01 c8                	add    %ecx,%eax
+ 561:	83 e8 30             	sub    $0x30,%eax
+ 564:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 567:	8b 45 08             	mov    0x8(%ebp),%eax
+ 56a:	0f b6 00             	movzbl (%eax),%eax
+ 56d:	3c 2f                	cmp    $0x2f,%al
+ 56f:	7e 0a                	jle    57b <atoi+0x48>
+ 571:	8b 45 08             	mov    0x8(%ebp),%eax
+ 574:	0f b6 00             	movzbl (%eax),%eax
+ 577:	3c 39                	cmp    $0x39,%al
+ 579:	7e c7                	jle    542 <atoi+0xf>
+  return n;
+ 57b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 57e:	c9                   	leave
+ 57f:	c3                   	ret
+
+00000580 <strcmp>:
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 583:	eb 08                	jmp    58d <strcmp+0xd>
+    p++, q++;
+ 585:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 589:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 58d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 590:	0f b6 00             	movzbl (%eax),%eax
+ 593:	84 c0                	test   %al,%al
+ 595:	74 10                	je     5a7 <strcmp+0x27>
+ 597:	8b 45 08             	mov    0x8(%ebp),%eax
+ 59a:	0f b6 10             	movzbl (%eax),%edx
+ 59d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5a0:	0f b6 00             	movzbl (%eax),%eax
+ 5a3:	38 c2                	cmp    %al,%dl
+ 5a5:	74 de                	je     585 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 5a7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5aa:	0f b6 00             	movzbl (%eax),%eax
+ 5ad:	0f b6 d0             	movzbl %al,%edx
+ 5b0:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5b3:	0f b6 00             	movzbl (%eax),%eax
+ 5b6:	0f b6 c0             	movzbl %al,%eax
+ 5b9:	29 c2                	sub    %eax,%edx
+ 5bb:	89 d0                	mov    %edx,%eax
+}
+ 5bd:	5d                   	pop    %ebp
+ 5be:	c3                   	ret
+
+000005bf <udiv64>:
+{
+ 5bf:	55                   	push   %ebp
+ 5c0:	89 e5                	mov    %esp,%ebp
+ 5c2:	57                   	push   %edi
+ 5c3:	56                   	push   %esi
+ 5c4:	83 ec 38             	sub    $0x38,%esp
+ 5c7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5ca:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 5cd:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5d0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 5d3:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5d6:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 5d9:	8b 45 14             	mov    0x14(%ebp),%eax
+ 5dc:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  q = r = 0;
+ 5df:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 5e6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 5ed:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5f0:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 5f3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 5f6:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 5f9:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 600:	e9 85 00 00 00       	jmp    68a <udiv64+0xcb>
+    r = (r << 1) | ((n >> i) & 1);
+ 605:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 608:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 60b:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 60f:	01 c0                	add    %eax,%eax
+ 611:	89 c6                	mov    %eax,%esi
+ 613:	89 d7                	mov    %edx,%edi
+ 615:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 618:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 61b:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 61e:	0f ad d0             	shrd   %cl,%edx,%eax
+ 621:	d3 ea                	shr    %cl,%edx
+ 623:	f6 c1 20             	test   $0x20,%cl
+ 626:	74 04                	je     62c <udiv64+0x6d>
+ 628:	89 d0                	mov    %edx,%eax
+ 62a:	31 d2                	xor    %edx,%edx
+ 62c:	83 e0 01             	and    $0x1,%eax
+ 62f:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 632:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+ 639:	89 f0                	mov    %esi,%eax
+ 63b:	89 fa                	mov    %edi,%edx
+ 63d:	0b 45 c0             	or     -0x40(%ebp),%eax
+ 640:	0b 55 c4             	or     -0x3c(%ebp),%edx
+ 643:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 646:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 649:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 64c:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 64f:	3b 45 c8             	cmp    -0x38(%ebp),%eax
+ 652:	89 d0                	mov    %edx,%eax
+ 654:	1b 45 cc             	sbb    -0x34(%ebp),%eax
+ 657:	72 2d                	jb     686 <udiv64+0xc7>
+      r -= d;
+ 659:	8b 45 c8             	mov    -0x38(%ebp),%eax
+ 65c:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 65f:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 662:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64_t)1 << i;
+ 665:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 668:	b8 01 00 00 00       	mov    $0x1,%eax
+ 66d:	ba 00 00 00 00       	mov    $0x0,%edx
+ 672:	0f a5 c2             	shld   %cl,%eax,%edx
+ 675:	d3 e0                	shl    %cl,%eax
+ 677:	f6 c1 20             	test   $0x20,%cl
+ 67a:	74 04                	je     680 <udiv64+0xc1>
+ 67c:	89 c2                	mov    %eax,%edx
+ 67e:	31 c0                	xor    %eax,%eax
+ 680:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 683:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 686:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 68a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 68e:	0f 89 71 ff ff ff    	jns    605 <udiv64+0x46>
+  if(rem)
+ 694:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+ 698:	74 0e                	je     6a8 <udiv64+0xe9>
+    *rem = r;
+ 69a:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 69d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6a0:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 6a3:	89 01                	mov    %eax,(%ecx)
+ 6a5:	89 51 04             	mov    %edx,0x4(%ecx)
+  return q;
+ 6a8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 6ab:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 6ae:	83 c4 38             	add    $0x38,%esp
+ 6b1:	5e                   	pop    %esi
+ 6b2:	5f                   	pop    %edi
+ 6b3:	5d                   	pop    %ebp
+ 6b4:	c3                   	ret
+
+000006b5 <crc32cinit>:
+{
+ 6b5:	55                   	push   %ebp
+ 6b6:	89 e5                	mov    %esp,%ebp
+ 6b8:	83 ec 20             	sub    $0x20,%esp
+  for(i = 0; i < 256; i++){
+ 6bb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 6c2:	eb 4c                	jmp    710 <crc32cinit+0x5b>
+    r = i;
+ 6c4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6c7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+ 6ca:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+ 6d1:	eb 26                	jmp    6f9 <crc32cinit+0x44>
+      r = (r >> 1) ^ ((r & 1) ? CRC32C_POLY : 0);
+ 6d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6d6:	d1 e8                	shr    %eax
+ 6d8:	89 c2                	mov    %eax,%edx
+ 6da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6dd:	83 e0 01             	and    $0x1,%eax
+ 6e0:	85 c0                	test   %eax,%eax
+ 6e2:	74 07                	je     6eb <crc32cinit+0x36>
+ 6e4:	b8 78 3b f6 82       	mov    $0x82f63b78,%eax
+ 6e9:	eb 05                	jmp    6f0 <crc32cinit+0x3b>
+ 6eb:	b8 00 00 00 00       	mov    $0x0,%eax
+ 6f0:	31 d0                	xor    %edx,%eax
+ 6f2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+ 6f5:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+ 6f9:	83 7d f8 07          	cmpl   $0x7,-0x8(%ebp)
+ 6fd:	76 d4                	jbe    6d3 <crc32cinit+0x1e>
+    crc32ctab[i] = r;
+ 6ff:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 702:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 705:	89 14 85 40 11 00 00 	mov    %edx,0x1140(,%eax,4)
+  for(i = 0; i < 256; i++){
+ 70c:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 710:	81 7d fc ff 00 00 00 	cmpl   $0xff,-0x4(%ebp)
+ 717:	76 ab                	jbe    6c4 <crc32cinit+0xf>
+  cpuinfo(1, &a, &b, &c, &d);
+ 719:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 71c:	50                   	push   %eax
+ 71d:	8d 45 e8             	lea    -0x18(%ebp),%eax
+ 720:	50                   	push   %eax
+ 721:	8d 45 ec             	lea    -0x14(%ebp),%eax
+ 724:	50                   	push   %eax
+ 725:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 728:	50                   	push   %eax
+ 729:	6a 01                	push   $0x1
+ 72b:	e8 d7 fd ff ff       	call   507 <cpuinfo>
+ 730:	83 c4 14             	add    $0x14,%esp
+  crc32chw = (c & CPUID_SSE42) != 0;
+ 733:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 736:	25 00 00 10 00       	and    $0x100000,%eax
+ 73b:	85 c0                	test   %eax,%eax
+ 73d:	0f 95 c0             	setne  %al
+ 740:	0f b6 c0             	movzbl %al,%eax
+ 743:	a3 08 11 00 00       	mov    %eax,0x1108
+}
+ 748:	90                   	nop
+ 749:	c9                   	leave
+ 74a:	c3                   	ret
+
+0000074b <crc32c>:
+{
+ 74b:	55                   	push   %ebp
+ 74c:	89 e5                	mov    %esp,%ebp
+ 74e:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s = p;
+ 751:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 754:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(crc32chw < 0)
+ 757:	a1 08 11 00 00       	mov    0x1108,%eax
+ 75c:	85 c0                	test   %eax,%eax
+ 75e:	79 05                	jns    765 <crc32c+0x1a>
+    crc32cinit();
+ 760:	e8 50 ff ff ff       	call   6b5 <crc32cinit>
+  crc = ~crc;
+ 765:	f7 55 08             	notl   0x8(%ebp)
+  if(crc32chw){
+ 768:	a1 08 11 00 00       	mov    0x1108,%eax
+ 76d:	85 c0                	test   %eax,%eax
+ 76f:	74 6c                	je     7dd <crc32c+0x92>
+    for(; n >= 4; n -= 4, s += 4)
+ 771:	eb 18                	jmp    78b <crc32c+0x40>
+      asm("crc32l %1, %0" : "+r" (crc) : "rm" (*(const uint*)s));
+ 773:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 776:	8b 10                	mov    (%eax),%edx
+ 778:	8b 45 08             	mov    0x8(%ebp),%eax
+ 77b:	f2 0f 38 f1 c2       	crc32  %edx,%eax
+ 780:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n >= 4; n -= 4, s += 4)
+ 783:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+ 787:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+ 78b:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+ 78f:	77 e2                	ja     773 <crc32c+0x28>
+    for(; n > 0; n--, s++)
+ 791:	eb 19                	jmp    7ac <crc32c+0x61>
+      asm("crc32b %1, %0" : "+r" (crc) : "qm" (*s));
+ 793:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 796:	0f b6 10             	movzbl (%eax),%edx
+ 799:	8b 45 08             	mov    0x8(%ebp),%eax
+ 79c:	f2 0f 38 f0 c2       	crc32  %dl,%eax
+ 7a1:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+ 7a4:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+ 7a8:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 7ac:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 7b0:	75 e1                	jne    793 <crc32c+0x48>
+ 7b2:	eb 2f                	jmp    7e3 <crc32c+0x98>
+      crc = crc32ctab[(crc ^ *s) & 0xff] ^ (crc >> 8);
+ 7b4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7b7:	0f b6 00             	movzbl (%eax),%eax
+ 7ba:	0f b6 c0             	movzbl %al,%eax
+ 7bd:	33 45 08             	xor    0x8(%ebp),%eax
+ 7c0:	0f b6 c0             	movzbl %al,%eax
+ 7c3:	8b 04 85 40 11 00 00 	mov    0x1140(,%eax,4),%eax
+ 7ca:	8b 55 08             	mov    0x8(%ebp),%edx
+ 7cd:	c1 ea 08             	shr    $0x8,%edx
+ 7d0:	31 d0                	xor    %edx,%eax
+ 7d2:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+ 7d5:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+ 7d9:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 7dd:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 7e1:	75 d1                	jne    7b4 <crc32c+0x69>
+  return ~crc;
+ 7e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7e6:	f7 d0                	not    %eax
+}
+ 7e8:	c9                   	leave
+ 7e9:	c3                   	ret
+
+000007ea <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 7ea:	b8 01 00 00 00       	mov    $0x1,%eax
+ 7ef:	cd 40                	int    $0x40
+ 7f1:	c3                   	ret
+
+000007f2 <exit>:
+SYSCALL(exit)
+ 7f2:	b8 02 00 00 00       	mov    $0x2,%eax
+ 7f7:	cd 40                	int    $0x40
+ 7f9:	c3                   	ret
+
+000007fa <wait>:
+SYSCALL(wait)
+ 7fa:	b8 03 00 00 00       	mov    $0x3,%eax
+ 7ff:	cd 40                	int    $0x40
+ 801:	c3                   	ret
+
+00000802 <pipe>:
+SYSCALL(pipe)
+ 802:	b8 04 00 00 00       	mov    $0x4,%eax
+ 807:	cd 40                	int    $0x40
+ 809:	c3                   	ret
+
+0000080a <read>:
+SYSCALL(read)
+ 80a:	b8 05 00 00 00       	mov    $0x5,%eax
+ 80f:	cd 40                	int    $0x40
+ 811:	c3                   	ret
+
+00000812 <write>:
+SYSCALL(write)
+ 812:	b8 10 00 00 00       	mov    $0x10,%eax
+ 817:	cd 40                	int    $0x40
+ 819:	c3                   	ret
+
+0000081a <close>:
+SYSCALL(close)
+ 81a:	b8 15 00 00 00       	mov    $0x15,%eax
+ 81f:	cd 40                	int    $0x40
+ 821:	c3                   	ret
+
+00000822 <kill>:
+SYSCALL(kill)
+ 822:	b8 06 00 00 00       	mov    $0x6,%eax
+ 827:	cd 40                	int    $0x40
+ 829:	c3                   	ret
+
+0000082a <exec>:
+SYSCALL(exec)
+ 82a:	b8 07 00 00 00       	mov    $0x7,%eax
+ 82f:	cd 40                	int    $0x40
+ 831:	c3                   	ret
+
+00000832 <open>:
+SYSCALL(open)
+ 832:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 837:	cd 40                	int    $0x40
+ 839:	c3                   	ret
+
+0000083a <mknod>:
+SYSCALL(mknod)
+ 83a:	b8 11 00 00 00       	mov    $0x11,%eax
+ 83f:	cd 40                	int    $0x40
+ 841:	c3                   	ret
+
+00000842 <unlink>:
+SYSCALL(unlink)
+ 842:	b8 12 00 00 00       	mov    $0x12,%eax
+ 847:	cd 40                	int    $0x40
+ 849:	c3                   	ret
+
+0000084a <fstat>:
+SYSCALL(fstat)
+ 84a:	b8 08 00 00 00       	mov    $0x8,%eax
+ 84f:	cd 40                	int    $0x40
+ 851:	c3                   	ret
+
+00000852 <link>:
+SYSCALL(link)
+ 852:	b8 13 00 00 00       	mov    $0x13,%eax
+ 857:	cd 40                	int    $0x40
+ 859:	c3                   	ret
+
+0000085a <mkdir>:
+SYSCALL(mkdir)
+ 85a:	b8 14 00 00 00       	mov    $0x14,%eax
+ 85f:	cd 40                	int    $0x40
+ 861:	c3                   	ret
+
+00000862 <chdir>:
+SYSCALL(chdir)
+ 862:	b8 09 00 00 00       	mov    $0x9,%eax
+ 867:	cd 40                	int    $0x40
+ 869:	c3                   	ret
+
+0000086a <dup>:
+SYSCALL(dup)
+ 86a:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 86f:	cd 40                	int    $0x40
+ 871:	c3                   	ret
+
+00000872 <getpid>:
+SYSCALL(getpid)
+ 872:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 877:	cd 40                	int    $0x40
+ 879:	c3                   	ret
+
+0000087a <sbrk>:
+SYSCALL(sbrk)
+ 87a:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 87f:	cd 40                	int    $0x40
+ 881:	c3                   	ret
+
+00000882 <sleep>:
+SYSCALL(sleep)
+ 882:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 887:	cd 40                	int    $0x40
+ 889:	c3                   	ret
+
+0000088a <uptime>:
+SYSCALL(uptime)
+ 88a:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 88f:	cd 40                	int    $0x40
+ 891:	c3                   	ret
+
+00000892 <arp>:
+SYSCALL(arp)
+ 892:	b8 16 00 00 00       	mov    $0x16,%eax
+ 897:	cd 40                	int    $0x40
+ 899:	c3                   	ret
+
+0000089a <ifstat>:
+SYSCALL(ifstat)
+ 89a:	b8 17 00 00 00       	mov    $0x17,%eax
+ 89f:	cd 40                	int    $0x40
+ 8a1:	c3                   	ret
+
+000008a2 <pcapctl>:
+SYSCALL(pcapctl)
+ 8a2:	b8 18 00 00 00       	mov    $0x18,%eax
+ 8a7:	cd 40                	int    $0x40
+ 8a9:	c3                   	ret
+
+000008aa <pcapread>:
+SYSCALL(pcapread)
+ 8aa:	b8 19 00 00 00       	mov    $0x19,%eax
+ 8af:	cd 40                	int    $0x40
+ 8b1:	c3                   	ret
+
+000008b2 <bpfattach>:
+SYSCALL(bpfattach)
+ 8b2:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 8b7:	cd 40                	int    $0x40
+ 8b9:	c3                   	ret
+
+000008ba <pktgen>:
+SYSCALL(pktgen)
+ 8ba:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 8bf:	cd 40                	int    $0x40
+ 8c1:	c3                   	ret
+
+000008c2 <reflect>:
+SYSCALL(reflect)
+ 8c2:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 8c7:	cd 40                	int    $0x40
+ 8c9:	c3                   	ret
+
+000008ca <brctl>:
+SYSCALL(brctl)
+ 8ca:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 8cf:	cd 40                	int    $0x40
+ 8d1:	c3                   	ret
+
+000008d2 <hostopen>:
+SYSCALL(hostopen)
+ 8d2:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 8d7:	cd 40                	int    $0x40
+ 8d9:	c3                   	ret
+
+000008da <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 8da:	55                   	push   %ebp
+ 8db:	89 e5                	mov    %esp,%ebp
+ 8dd:	83 ec 18             	sub    $0x18,%esp
+ 8e0:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 8e3:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 8e6:	83 ec 04             	sub    $0x4,%esp
+ 8e9:	6a 01                	push   $0x1
+ 8eb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 8ee:	50                   	push   %eax
+ 8ef:	ff 75 08             	push   0x8(%ebp)
+ 8f2:	e8 1b ff ff ff       	call   812 <write>
+ 8f7:	83 c4 10             	add    $0x10,%esp
+}
+ 8fa:	90                   	nop
+ 8fb:	c9                   	leave
+ 8fc:	c3                   	ret
+
+000008fd <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 8fd:	55                   	push   %ebp
+ 8fe:	89 e5                	mov    %esp,%ebp
+ 900:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 903:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 90a:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 90e:	74 17                	je     927 <printint+0x2a>
+ 910:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 914:	79 11                	jns    927 <printint+0x2a>
+    neg = 1;
+ 916:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 91d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 920:	f7 d8                	neg    %eax
+ 922:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 925:	eb 06                	jmp    92d <printint+0x30>
+  } else {
+    x = xx;
+ 927:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 92a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 92d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 934:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 937:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 93a:	ba 00 00 00 00       	mov    $0x0,%edx
+ 93f:	f7 f1                	div    %ecx
+ 941:	89 d1                	mov    %edx,%ecx
+ 943:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 946:	8d 50 01             	lea    0x1(%eax),%edx
+ 949:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 94c:	0f b6 91 0c 11 00 00 	movzbl 0x110c(%ecx),%edx
+ 953:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 957:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 95a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 95d:	ba 00 00 00 00       	mov    $0x0,%edx
+ 962:	f7 f1                	div    %ecx
+ 964:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 967:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 96b:	75 c7                	jne    934 <printint+0x37>
+  if(neg)
+ 96d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 971:	74 2d                	je     9a0 <printint+0xa3>
+    buf[i++] = '-';
+ 973:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 976:	8d 50 01             	lea    0x1(%eax),%edx
+ 979:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 97c:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 981:	eb 1d                	jmp    9a0 <printint+0xa3>
+    putc(fd, buf[i]);
+ 983:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 986:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 989:	01 d0                	add    %edx,%eax
+ 98b:	0f b6 00             	movzbl (%eax),%eax
+ 98e:	0f be c0             	movsbl %al,%eax
+ 991:	83 ec 08             	sub    $0x8,%esp
+ 994:	50                   	push   %eax
+ 995:	ff 75 08             	push   0x8(%ebp)
+ 998:	e8 3d ff ff ff       	call   8da <putc>
+ 99d:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 9a0:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 9a4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 9a8:	79 d9                	jns    983 <printint+0x86>
+}
+ 9aa:	90                   	nop
+ 9ab:	90                   	nop
+ 9ac:	c9                   	leave
+ 9ad:	c3                   	ret
+
+000009ae <printf>:
+
+// Print to the given fd. Only understands %d, %u, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 9ae:	55                   	push   %ebp
+ 9af:	89 e5                	mov    %esp,%ebp
+ 9b1:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 9b4:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 9bb:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 9be:	83 c0 04             	add    $0x4,%eax
+ 9c1:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 9c4:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 9cb:	e9 7d 01 00 00       	jmp    b4d <printf+0x19f>
+    c = fmt[i] & 0xff;
+ 9d0:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 9d3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9d6:	01 d0                	add    %edx,%eax
+ 9d8:	0f b6 00             	movzbl (%eax),%eax
+ 9db:	0f be c0             	movsbl %al,%eax
+ 9de:	25 ff 00 00 00       	and    $0xff,%eax
+ 9e3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 9e6:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 9ea:	75 2c                	jne    a18 <printf+0x6a>
+      if(c == '%'){
+ 9ec:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 9f0:	75 0c                	jne    9fe <printf+0x50>
+        state = '%';
+ 9f2:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 9f9:	e9 4b 01 00 00       	jmp    b49 <printf+0x19b>
+      } else {
+        putc(fd, c);
+ 9fe:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a01:	0f be c0             	movsbl %al,%eax
+ a04:	83 ec 08             	sub    $0x8,%esp
+ a07:	50                   	push   %eax
+ a08:	ff 75 08             	push   0x8(%ebp)
+ a0b:	e8 ca fe ff ff       	call   8da <putc>
+ a10:	83 c4 10             	add    $0x10,%esp
+ a13:	e9 31 01 00 00       	jmp    b49 <printf+0x19b>
+      }
+    } else if(state == '%'){
+ a18:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ a1c:	0f 85 27 01 00 00    	jne    b49 <printf+0x19b>
+      if(c == 'd'){
+ a22:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ a26:	75 1e                	jne    a46 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ a28:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a2b:	8b 00                	mov    (%eax),%eax
+ a2d:	6a 01                	push   $0x1
+ a2f:	6a 0a                	push   $0xa
+ a31:	50                   	push   %eax
+ a32:	ff 75 08             	push   0x8(%ebp)
+ a35:	e8 c3 fe ff ff       	call   8fd <printint>
+ a3a:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a3d:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a41:	e9 fc 00 00 00       	jmp    b42 <printf+0x194>
+      } else if(c == 'u'){
+ a46:	83 7d e4 75          	cmpl   $0x75,-0x1c(%ebp)
+ a4a:	75 1e                	jne    a6a <printf+0xbc>
+        printint(fd, *ap, 10, 0);
+ a4c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a4f:	8b 00                	mov    (%eax),%eax
+ a51:	6a 00                	push   $0x0
+ a53:	6a 0a                	push   $0xa
+ a55:	50                   	push   %eax
+ a56:	ff 75 08             	push   0x8(%ebp)
+ a59:	e8 9f fe ff ff       	call   8fd <printint>
+ a5e:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a61:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a65:	e9 d8 00 00 00       	jmp    b42 <printf+0x194>
+      } else if(c == 'x' || c == 'p'){
+ a6a:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ a6e:	74 06                	je     a76 <printf+0xc8>
+ a70:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ a74:	75 1e                	jne    a94 <printf+0xe6>
+        printint(fd, *ap, 16, 0);
+ a76:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a79:	8b 00                	mov    (%eax),%eax
+ a7b:	6a 00                	push   $0x0
+ a7d:	6a 10                	push   $0x10
+ a7f:	50                   	push   %eax
+ a80:	ff 75 08             	push   0x8(%ebp)
+ a83:	e8 75 fe ff ff       	call   8fd <printint>
+ a88:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a8b:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a8f:	e9 ae 00 00 00       	jmp    b42 <printf+0x194>
+      } else if(c == 's'){
+ a94:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ a98:	75 43                	jne    add <printf+0x12f>
+        s = (char*)*ap;
+ a9a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a9d:	8b 00                	mov    (%eax),%eax
+ a9f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ aa2:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ aa6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ aaa:	75 25                	jne    ad1 <printf+0x123>
+          s = "(null)";
+ aac:	c7 45 f4 d3 0d 00 00 	movl   $0xdd3,-0xc(%ebp)
+        while(*s != 0){
+ ab3:	eb 1c                	jmp    ad1 <printf+0x123>
+          putc(fd, *s);
+ ab5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ab8:	0f b6 00             	movzbl (%eax),%eax
+ abb:	0f be c0             	movsbl %al,%eax
+ abe:	83 ec 08             	sub    $0x8,%esp
+ ac1:	50                   	push   %eax
+ ac2:	ff 75 08             	push   0x8(%ebp)
+ ac5:	e8 10 fe ff ff       	call   8da <putc>
+ aca:	83 c4 10             	add    $0x10,%esp
+          s++;
+ acd:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ ad1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ad4:	0f b6 00             	movzbl (%eax),%eax
+ ad7:	84 c0                	test   %al,%al
+ ad9:	75 da                	jne    ab5 <printf+0x107>
+ adb:	eb 65                	jmp    b42 <printf+0x194>
+        }
+      } else if(c == 'c'){
+ add:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ ae1:	75 1d                	jne    b00 <printf+0x152>
+        putc(fd, *ap);
+ ae3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ ae6:	8b 00                	mov    (%eax),%eax
+ ae8:	0f be c0             	movsbl %al,%eax
+ aeb:	83 ec 08             	sub    $0x8,%esp
+ aee:	50                   	push   %eax
+ aef:	ff 75 08             	push   0x8(%ebp)
+ af2:	e8 e3 fd ff ff       	call   8da <putc>
+ af7:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ afa:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ afe:	eb 42                	jmp    b42 <printf+0x194>
+      } else if(c == '%'){
+ b00:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ b04:	75 17                	jne    b1d <printf+0x16f>
+        putc(fd, c);
+ b06:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ b09:	0f be c0             	movsbl %al,%eax
+ b0c:	83 ec 08             	sub    $0x8,%esp
+ b0f:	50                   	push   %eax
+ b10:	ff 75 08             	push   0x8(%ebp)
+ b13:	e8 c2 fd ff ff       	call   8da <putc>
+ b18:	83 c4 10             	add    $0x10,%esp
+ b1b:	eb 25                	jmp    b42 <printf+0x194>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ b1d:	83 ec 08             	sub    $0x8,%esp
+ b20:	6a 25                	push   $0x25
+ b22:	ff 75 08             	push   0x8(%ebp)
+ b25:	e8 b0 fd ff ff       	call   8da <putc>
+ b2a:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ b2d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ b30:	0f be c0             	movsbl %al,%eax
+ b33:	83 ec 08             	sub    $0x8,%esp
+ b36:	50                   	push   %eax
+ b37:	ff 75 08             	push   0x8(%ebp)
+ b3a:	e8 9b fd ff ff       	call   8da <putc>
+ b3f:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ b42:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ b49:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ b4d:	8b 55 0c             	mov    0xc(%ebp),%edx
+ b50:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b53:	01 d0                	add    %edx,%eax
+ b55:	0f b6 00             	movzbl (%eax),%eax
+ b58:	84 c0                	test   %al,%al
+ b5a:	0f 85 70 fe ff ff    	jne    9d0 <printf+0x22>
+    }
+  }
+}
+ b60:	90                   	nop
+ b61:	90                   	nop
+ b62:	c9                   	leave
+ b63:	c3                   	ret
+
+00000b64 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ b64:	55                   	push   %ebp
+ b65:	89 e5                	mov    %esp,%ebp
+ b67:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ b6a:	8b 45 08             	mov    0x8(%ebp),%eax
+ b6d:	83 e8 08             	sub    $0x8,%eax
+ b70:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b73:	a1 48 15 00 00       	mov    0x1548,%eax
+ b78:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ b7b:	eb 24                	jmp    ba1 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b7d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b80:	8b 00                	mov    (%eax),%eax
+ b82:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b85:	72 12                	jb     b99 <free+0x35>
+ b87:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b8a:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b8d:	72 24                	jb     bb3 <free+0x4f>
+ b8f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b92:	8b 00                	mov    (%eax),%eax
+ b94:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ b97:	72 1a                	jb     bb3 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b99:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b9c:	8b 00                	mov    (%eax),%eax
+ b9e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ ba1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ba4:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ ba7:	73 d4                	jae    b7d <free+0x19>
+ ba9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bac:	8b 00                	mov    (%eax),%eax
+ bae:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ bb1:	73 ca                	jae    b7d <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ bb3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bb6:	8b 40 04             	mov    0x4(%eax),%eax
+ bb9:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ bc0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bc3:	01 c2                	add    %eax,%edx
+ bc5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bc8:	8b 00                	mov    (%eax),%eax
+ bca:	39 c2                	cmp    %eax,%edx
+ bcc:	75 24                	jne    bf2 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ bce:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bd1:	8b 50 04             	mov    0x4(%eax),%edx
+ bd4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bd7:	8b 00                	mov    (%eax),%eax
+ bd9:	8b 40 04             	mov    0x4(%eax),%eax
+ bdc:	01 c2                	add    %eax,%edx
+ bde:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ be1:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ be4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ be7:	8b 00                	mov    (%eax),%eax
+ be9:	8b 10                	mov    (%eax),%edx
+ beb:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bee:	89 10                	mov    %edx,(%eax)
+ bf0:	eb 0a                	jmp    bfc <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ bf2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bf5:	8b 10                	mov    (%eax),%edx
+ bf7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bfa:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ bfc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bff:	8b 40 04             	mov    0x4(%eax),%eax
+ c02:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ c09:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c0c:	01 d0                	add    %edx,%eax
+ c0e:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ c11:	75 20                	jne    c33 <free+0xcf>
+    p->s.size += bp->s.size;
+ c13:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c16:	8b 50 04             	mov    0x4(%eax),%edx
+ c19:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c1c:	8b 40 04             	mov    0x4(%eax),%eax
+ c1f:	01 c2                	add    %eax,%edx
+ c21:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c24:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ c27:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c2a:	8b 10                	mov    (%eax),%edx
+ c2c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c2f:	89 10                	mov    %edx,(%eax)
+ c31:	eb 08                	jmp    c3b <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ c33:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c36:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ c39:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ c3b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c3e:	a3 48 15 00 00       	mov    %eax,0x1548
+}
+ c43:	90                   	nop
+ c44:	c9                   	leave
+ c45:	c3                   	ret
+
+00000c46 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ c46:	55                   	push   %ebp
+ c47:	89 e5                	mov    %esp,%ebp
+ c49:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ c4c:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ c53:	77 07                	ja     c5c <morecore+0x16>
+    nu = 4096;
+ c55:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ c5c:	8b 45 08             	mov    0x8(%ebp),%eax
+ c5f:	c1 e0 03             	shl    $0x3,%eax
+ c62:	83 ec 0c             	sub    $0xc,%esp
+ c65:	50                   	push   %eax
+ c66:	e8 0f fc ff ff       	call   87a <sbrk>
+ c6b:	83 c4 10             	add    $0x10,%esp
+ c6e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ c71:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ c75:	75 07                	jne    c7e <morecore+0x38>
+    return 0;
+ c77:	b8 00 00 00 00       	mov    $0x0,%eax
+ c7c:	eb 26                	jmp    ca4 <morecore+0x5e>
+  hp = (Header*)p;
+ c7e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c81:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ c84:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c87:	8b 55 08             	mov    0x8(%ebp),%edx
+ c8a:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ c8d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c90:	83 c0 08             	add    $0x8,%eax
+ c93:	83 ec 0c             	sub    $0xc,%esp
+ c96:	50                   	push   %eax
+ c97:	e8 c8 fe ff ff       	call   b64 <free>
+ c9c:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ c9f:	a1 48 15 00 00       	mov    0x1548,%eax
+}
+ ca4:	c9                   	leave
+ ca5:	c3                   	ret
+
+00000ca6 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ ca6:	55                   	push   %ebp
+ ca7:	89 e5                	mov    %esp,%ebp
+ ca9:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ cac:	8b 45 08             	mov    0x8(%ebp),%eax
+ caf:	83 c0 07             	add    $0x7,%eax
+ cb2:	c1 e8 03             	shr    $0x3,%eax
+ cb5:	83 c0 01             	add    $0x1,%eax
+ cb8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ cbb:	a1 48 15 00 00       	mov    0x1548,%eax
+ cc0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ cc3:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ cc7:	75 23                	jne    cec <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ cc9:	c7 45 f0 40 15 00 00 	movl   $0x1540,-0x10(%ebp)
+ cd0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cd3:	a3 48 15 00 00       	mov    %eax,0x1548
+ cd8:	a1 48 15 00 00       	mov    0x1548,%eax
+ cdd:	a3 40 15 00 00       	mov    %eax,0x1540
+    base.s.size = 0;
+ ce2:	c7 05 44 15 00 00 00 	movl   $0x0,0x1544
+ ce9:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cec:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cef:	8b 00                	mov    (%eax),%eax
+ cf1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ cf4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cf7:	8b 40 04             	mov    0x4(%eax),%eax
+ cfa:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ cfd:	72 4d                	jb     d4c <malloc+0xa6>
+      if(p->s.size == nunits)
+ cff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d02:	8b 40 04             	mov    0x4(%eax),%eax
+ d05:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ d08:	75 0c                	jne    d16 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ d0a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d0d:	8b 10                	mov    (%eax),%edx
+ d0f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d12:	89 10                	mov    %edx,(%eax)
+ d14:	eb 26                	jmp    d3c <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ d16:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d19:	8b 40 04             	mov    0x4(%eax),%eax
+ d1c:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ d1f:	89 c2                	mov    %eax,%edx
+ d21:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d24:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ d27:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d2a:	8b 40 04             	mov    0x4(%eax),%eax
+ d2d:	c1 e0 03             	shl    $0x3,%eax
+ d30:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ d33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d36:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ d39:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ d3c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d3f:	a3 48 15 00 00       	mov    %eax,0x1548
+      return (void*)(p + 1);
+ d44:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d47:	83 c0 08             	add    $0x8,%eax
+ d4a:	eb 3b                	jmp    d87 <malloc+0xe1>
+    }
+    if(p == freep)
+ d4c:	a1 48 15 00 00       	mov    0x1548,%eax
+ d51:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ d54:	75 1e                	jne    d74 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ d56:	83 ec 0c             	sub    $0xc,%esp
+ d59:	ff 75 ec             	push   -0x14(%ebp)
+ d5c:	e8 e5 fe ff ff       	call   c46 <morecore>
+ d61:	83 c4 10             	add    $0x10,%esp
+ d64:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d67:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d6b:	75 07                	jne    d74 <malloc+0xce>
+        return 0;
+ d6d:	b8 00 00 00 00       	mov    $0x0,%eax
+ d72:	eb 13                	jmp    d87 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d74:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d77:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ d7a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d7d:	8b 00                	mov    (%eax),%eax
+ d7f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ d82:	e9 6d ff ff ff       	jmp    cf4 <malloc+0x4e>
+  }
+}
+ d87:	c9                   	leave
+ d88:	c3                   	ret
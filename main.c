@@ -19,6 +19,7 @@ main(void)
 {
   kinit1(end, P2V(4*1024*1024)); // phys page allocator
   kvmalloc();      // kernel page table
+  patinit();       // page attribute table, for ioremap
   mpinit();        // detect other processors
   lapicinit();     // interrupt controller
   seginit();       // segment descriptors
@@ -26,15 +27,23 @@ main(void)
   ioapicinit();    // another interrupt controller
   consoleinit();   // console hardware
   uartinit();      // serial port
+  tscinit();       // calibrate time-stamp counter
   pinit();         // process table
   tvinit();        // trap vectors
-  binit();         // buffer cache
   fileinit();      // file table
   ideinit();       // disk
   startothers();   // start other processors
   kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
+  binit();         // buffer cache, sized from the memory kinit2 freed
+  pcapinit();      // packet capture
+  pktgeninit();    // packet generator
+  bridgeinit();    // layer 2 bridge
+  virtioinit();    // virtio core, takes the functions of the virtio vendor
+  net_init();      // network drivers, before pci_init probes for cards
+  virtioblkinit(); // virtio disk driver, takes disk 1 over from ide
+  virtconsinit();  // virtio console driver, takes console output over
+  virt9pinit();    // virtio 9p driver, files shared by the host
   pci_init();      // PCI devices
-  net_init();
   userinit();      // first user process
   mpmain();        // finish this processor's setup
 }
@@ -44,6 +53,7 @@ static void
 mpenter(void)
 {
   switchkvm();
+  patinit();
   seginit();
   lapicinit();
   mpmain();
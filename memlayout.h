@@ -3,6 +3,12 @@
 #define EXTMEM  0x100000            // Start of extended memory
 #define PHYSTOP 0xE000000           // Top physical memory
 #define DEVSPACE 0xFE000000         // Other devices are at high addresses
+#define IOREMAPBASE 0x90000000      // Device memory mapped by ioremap, up to DEVSPACE
+
+// Memory types for ioremap
+#define IOREMAP_UC  0               // uncached: device registers
+#define IOREMAP_WC  1               // write combining: doorbells, frame buffers
+#define IOREMAP_WB  2               // write back: firmware tables in memory
 
 // Key addresses for address space layout (see kmap in vm.c for layout)
 #define KERNBASE 0x80000000         // First kernel virtual address
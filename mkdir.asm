@@ -0,0 +1,1420 @@
+
+_mkdir:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	83 ec 10             	sub    $0x10,%esp
+  12:	89 cb                	mov    %ecx,%ebx
+  int i;
+
+  if(argc < 2){
+  14:	83 3b 01             	cmpl   $0x1,(%ebx)
+  17:	7f 17                	jg     30 <main+0x30>
+    printf(2, "Usage: mkdir files...\n");
+  19:	83 ec 08             	sub    $0x8,%esp
+  1c:	68 d5 0a 00 00       	push   $0xad5
+  21:	6a 02                	push   $0x2
+  23:	e8 d2 06 00 00       	call   6fa <printf>
+  28:	83 c4 10             	add    $0x10,%esp
+    exit();
+  2b:	e8 0e 05 00 00       	call   53e <exit>
+  }
+
+  for(i = 1; i < argc; i++){
+  30:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  37:	eb 4b                	jmp    84 <main+0x84>
+    if(mkdir(argv[i]) < 0){
+  39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  3c:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  43:	8b 43 04             	mov    0x4(%ebx),%eax
+  46:	01 d0                	add    %edx,%eax
+  48:	8b 00                	mov    (%eax),%eax
+  4a:	83 ec 0c             	sub    $0xc,%esp
+  4d:	50                   	push   %eax
+  4e:	e8 53 05 00 00       	call   5a6 <mkdir>
+  53:	83 c4 10             	add    $0x10,%esp
+  56:	85 c0                	test   %eax,%eax
+  58:	79 26                	jns    80 <main+0x80>
+      printf(2, "mkdir: %s failed to create\n", argv[i]);
+  5a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  5d:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  64:	8b 43 04             	mov    0x4(%ebx),%eax
+  67:	01 d0                	add    %edx,%eax
+  69:	8b 00                	mov    (%eax),%eax
+  6b:	83 ec 04             	sub    $0x4,%esp
+  6e:	50                   	push   %eax
+  6f:	68 ec 0a 00 00       	push   $0xaec
+  74:	6a 02                	push   $0x2
+  76:	e8 7f 06 00 00       	call   6fa <printf>
+  7b:	83 c4 10             	add    $0x10,%esp
+      break;
+  7e:	eb 0b                	jmp    8b <main+0x8b>
+  for(i = 1; i < argc; i++){
+  80:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  84:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  87:	3b 03                	cmp    (%ebx),%eax
+  89:	7c ae                	jl     39 <main+0x39>
+    }
+  }
+
+  exit();
+  8b:	e8 ae 04 00 00       	call   53e <exit>
+
+00000090 <stosb>:
+}
+
+int
+stat(char *n, struct stat *st)
+{
+  int fd;
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	57                   	push   %edi
+  94:	53                   	push   %ebx
+  int r;
+  95:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  98:	8b 55 10             	mov    0x10(%ebp),%edx
+  9b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  9e:	89 cb                	mov    %ecx,%ebx
+  a0:	89 df                	mov    %ebx,%edi
+  a2:	89 d1                	mov    %edx,%ecx
+  a4:	fc                   	cld
+  a5:	f3 aa                	rep stos %al,%es:(%edi)
+  a7:	89 ca                	mov    %ecx,%edx
+  a9:	89 fb                	mov    %edi,%ebx
+  ab:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  ae:	89 55 10             	mov    %edx,0x10(%ebp)
+
+  fd = open(n, O_RDONLY);
+  if(fd < 0)
+    return -1;
+  b1:	90                   	nop
+  b2:	5b                   	pop    %ebx
+  b3:	5f                   	pop    %edi
+  b4:	5d                   	pop    %ebp
+  b5:	c3                   	ret
+
+000000b6 <strcpy>:
+{
+  b6:	55                   	push   %ebp
+  b7:	89 e5                	mov    %esp,%ebp
+  b9:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+  bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  bf:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  c2:	90                   	nop
+  c3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  c6:	8d 42 01             	lea    0x1(%edx),%eax
+  c9:	89 45 0c             	mov    %eax,0xc(%ebp)
+  cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  cf:	8d 48 01             	lea    0x1(%eax),%ecx
+  d2:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  d5:	0f b6 12             	movzbl (%edx),%edx
+  d8:	88 10                	mov    %dl,(%eax)
+  da:	0f b6 00             	movzbl (%eax),%eax
+  dd:	84 c0                	test   %al,%al
+  df:	75 e2                	jne    c3 <strcpy+0xd>
+  return os;
+  e1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  e4:	c9                   	leave
+  e5:	c3                   	ret
+
+000000e6 <strlen>:
+{
+  e6:	55                   	push   %ebp
+  e7:	89 e5                	mov    %esp,%ebp
+  e9:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+  ec:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  f3:	eb 04                	jmp    f9 <strlen+0x13>
+  f5:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  f9:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  ff:	01 d0                	add    %edx,%eax
+ 101:	0f b6 00             	movzbl (%eax),%eax
+ 104:	84 c0                	test   %al,%al
+ 106:	75 ed                	jne    f5 <strlen+0xf>
+  return n;
+ 108:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 10b:	c9                   	leave
+ 10c:	c3                   	ret
+
+0000010d <memset>:
+{
+ 10d:	55                   	push   %ebp
+ 10e:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 110:	8b 45 10             	mov    0x10(%ebp),%eax
+ 113:	50                   	push   %eax
+ 114:	ff 75 0c             	push   0xc(%ebp)
+ 117:	ff 75 08             	push   0x8(%ebp)
+ 11a:	e8 71 ff ff ff       	call   90 <stosb>
+ 11f:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 122:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 125:	c9                   	leave
+ 126:	c3                   	ret
+
+00000127 <strchr>:
+{
+ 127:	55                   	push   %ebp
+ 128:	89 e5                	mov    %esp,%ebp
+ 12a:	83 ec 04             	sub    $0x4,%esp
+ 12d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 130:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 133:	eb 14                	jmp    149 <strchr+0x22>
+    if(*s == c)
+ 135:	8b 45 08             	mov    0x8(%ebp),%eax
+ 138:	0f b6 00             	movzbl (%eax),%eax
+ 13b:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 13e:	75 05                	jne    145 <strchr+0x1e>
+      return (char*)s;
+ 140:	8b 45 08             	mov    0x8(%ebp),%eax
+ 143:	eb 13                	jmp    158 <strchr+0x31>
+  for(; *s; s++)
+ 145:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 149:	8b 45 08             	mov    0x8(%ebp),%eax
+ 14c:	0f b6 00             	movzbl (%eax),%eax
+ 14f:	84 c0                	test   %al,%al
+ 151:	75 e2                	jne    135 <strchr+0xe>
+  return 0;
+ 153:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 158:	c9                   	leave
+ 159:	c3                   	ret
+
+0000015a <gets>:
+{
+ 15a:	55                   	push   %ebp
+ 15b:	89 e5                	mov    %esp,%ebp
+ 15d:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 160:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 167:	eb 42                	jmp    1ab <gets+0x51>
+    cc = read(0, &c, 1);
+ 169:	83 ec 04             	sub    $0x4,%esp
+ 16c:	6a 01                	push   $0x1
+ 16e:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 171:	50                   	push   %eax
+ 172:	6a 00                	push   $0x0
+ 174:	e8 dd 03 00 00       	call   556 <read>
+ 179:	83 c4 10             	add    $0x10,%esp
+ 17c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 17f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 183:	7e 33                	jle    1b8 <gets+0x5e>
+    buf[i++] = c;
+ 185:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 188:	8d 50 01             	lea    0x1(%eax),%edx
+ 18b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 18e:	89 c2                	mov    %eax,%edx
+ 190:	8b 45 08             	mov    0x8(%ebp),%eax
+ 193:	01 c2                	add    %eax,%edx
+ 195:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 199:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 19b:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 19f:	3c 0a                	cmp    $0xa,%al
+ 1a1:	74 16                	je     1b9 <gets+0x5f>
+ 1a3:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1a7:	3c 0d                	cmp    $0xd,%al
+ 1a9:	74 0e                	je     1b9 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 1ab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1ae:	83 c0 01             	add    $0x1,%eax
+ 1b1:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 1b4:	7f b3                	jg     169 <gets+0xf>
+ 1b6:	eb 01                	jmp    1b9 <gets+0x5f>
+      break;
+ 1b8:	90                   	nop
+  buf[i] = '\0';
+ 1b9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1bc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1bf:	01 d0                	add    %edx,%eax
+ 1c1:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 1c4:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1c7:	c9                   	leave
+ 1c8:	c3                   	ret
+
+000001c9 <stat>:
+{
+ 1c9:	55                   	push   %ebp
+ 1ca:	89 e5                	mov    %esp,%ebp
+ 1cc:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+ 1cf:	83 ec 08             	sub    $0x8,%esp
+ 1d2:	6a 00                	push   $0x0
+ 1d4:	ff 75 08             	push   0x8(%ebp)
+ 1d7:	e8 a2 03 00 00       	call   57e <open>
+ 1dc:	83 c4 10             	add    $0x10,%esp
+ 1df:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 1e2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 1e6:	79 07                	jns    1ef <stat+0x26>
+    return -1;
+ 1e8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 1ed:	eb 25                	jmp    214 <stat+0x4b>
+  r = fstat(fd, st);
+ 1ef:	83 ec 08             	sub    $0x8,%esp
+ 1f2:	ff 75 0c             	push   0xc(%ebp)
+ 1f5:	ff 75 f4             	push   -0xc(%ebp)
+ 1f8:	e8 99 03 00 00       	call   596 <fstat>
+ 1fd:	83 c4 10             	add    $0x10,%esp
+ 200:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 203:	83 ec 0c             	sub    $0xc,%esp
+ 206:	ff 75 f4             	push   -0xc(%ebp)
+ 209:	e8 58 03 00 00       	call   566 <close>
+ 20e:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 211:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 214:	c9                   	leave
+ 215:	c3                   	ret
+
+00000216 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 216:	55                   	push   %ebp
+ 217:	89 e5                	mov    %esp,%ebp
+ 219:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+
+  dst = vdst;
+ 21c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 21f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 222:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 225:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 228:	eb 17                	jmp    241 <memmove+0x2b>
+    *dst++ = *src++;
+ 22a:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 22d:	8d 42 01             	lea    0x1(%edx),%eax
+ 230:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 233:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 236:	8d 48 01             	lea    0x1(%eax),%ecx
+ 239:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 23c:	0f b6 12             	movzbl (%edx),%edx
+ 23f:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 241:	8b 45 10             	mov    0x10(%ebp),%eax
+ 244:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 247:	89 55 10             	mov    %edx,0x10(%ebp)
+ 24a:	85 c0                	test   %eax,%eax
+ 24c:	7f dc                	jg     22a <memmove+0x14>
+  return vdst;
+ 24e:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 251:	c9                   	leave
+ 252:	c3                   	ret
+
+00000253 <cpuinfo>:
+ 253:	55                   	push   %ebp
+ 254:	89 e5                	mov    %esp,%ebp
+ 256:	56                   	push   %esi
+ 257:	53                   	push   %ebx
+ 258:	8b 45 08             	mov    0x8(%ebp),%eax
+ 25b:	ba 00 00 00 00       	mov    $0x0,%edx
+ 260:	89 d1                	mov    %edx,%ecx
+ 262:	0f a2                	cpuid
+ 264:	89 c6                	mov    %eax,%esi
+ 266:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 269:	89 30                	mov    %esi,(%eax)
+ 26b:	8b 45 10             	mov    0x10(%ebp),%eax
+ 26e:	89 18                	mov    %ebx,(%eax)
+ 270:	8b 45 14             	mov    0x14(%ebp),%eax
+ 273:	89 08                	mov    %ecx,(%eax)
+ 275:	8b 45 18             	mov    0x18(%ebp),%eax
+ 278:	89 10                	mov    %edx,(%eax)
+ 27a:	90                   	nop
+ 27b:	5b                   	pop    %ebx
+ 27c:	5e                   	pop    %esi
+ 27d:	5d                   	pop    %ebp
+ 27e:	c3                   	ret
+
+0000027f <atoi>:
+{
+ 27f:	55                   	push   %ebp
+ 280:	89 e5                	mov    %esp,%ebp
+ 282:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+ 285:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 28c:	eb 25                	jmp    2b3 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 28e:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 291:	89 d0                	mov    %edx,%eax
+ 293:	c1 e0 02             	shl    $0x2,%eax
+ 296:	01 d0                	add    %edx,%eax
+ 298:	01 c0                	add    %eax,%eax
+ 29a:	89 c1                	mov    %eax,%ecx
+ 29c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 29f:	8d 50 01             	lea    0x1(%eax),%edx
+ 2a2:	89 55 08             	mov    %edx,0x8(%ebp)
+ 2a5:	0f b6 00             	movzbl (%eax),%eax
+ 2a8:	0f be c0             	movsbl %al,%eax
+ 2ab:	01 c8                	add    %ecx,%eax
+ 2ad:	83 e8 30             	sub    $0x30,%eax
+ 2b0:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 2b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b6:	0f b6 00             	movzbl (%eax),%eax
+ 2b9:	3c 2f                	cmp    $0x2f,%al
+ 2bb:	7e 0a                	jle    2c7 <atoi+0x48>
+ 2bd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c0:	0f b6 00             	movzbl (%eax),%eax
+ 2c3:	3c 39                	cmp    $0x39,%al
+ 2c5:	7e c7                	jle    28e <atoi+0xf>
+  return n;
+ 2c7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2ca:	c9                   	leave
+ 2cb:	c3                   	ret
+
+000002cc <strcmp>:
+{
+ 2cc:	55                   	push   %ebp
+ 2cd:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 2cf:	eb 08                	jmp    2d9 <strcmp+0xd>
+    p++, q++;
+ 2d1:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 2d5:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 2d9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2dc:	0f b6 00             	movzbl (%eax),%eax
+ 2df:	84 c0                	test   %al,%al
+ 2e1:	74 10                	je     2f3 <strcmp+0x27>
+ 2e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e6:	0f b6 10             	movzbl (%eax),%edx
+ 2e9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2ec:	0f b6 00             	movzbl (%eax),%eax
+ 2ef:	38 c2                	cmp    %al,%dl
+ 2f1:	74 de                	je     2d1 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 2f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2f6:	0f b6 00             	movzbl (%eax),%eax
+ 2f9:	0f b6 d0             	movzbl %al,%edx
+ 2fc:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2ff:	0f b6 00             	movzbl (%eax),%eax
+ 302:	0f b6 c0             	movzbl %al,%eax
+ 305:	29 c2                	sub    %eax,%edx
+ 307:	89 d0                	mov    %edx,%eax
+}
+ 309:	5d                   	pop    %ebp
+ 30a:	c3                   	ret
+
+0000030b <udiv64>:
+{
+ 30b:	55                   	push   %ebp
+ 30c:	89 e5                	mov    %esp,%ebp
+ 30e:	57                   	push   %edi
+ 30f:	56                   	push   %esi
+ 310:	83 ec 38             	sub    $0x38,%esp
+ 313:	8b 45 08             	mov    0x8(%ebp),%eax
+ 316:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 319:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 31c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 31f:	8b 45 10             	mov    0x10(%ebp),%eax
+ 322:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 325:	8b 45 14             	mov    0x14(%ebp),%eax
+ 328:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  q = r = 0;
+ 32b:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 332:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 339:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 33c:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 33f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 342:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 345:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 34c:	e9 85 00 00 00       	jmp    3d6 <udiv64+0xcb>
+    r = (r << 1) | ((n >> i) & 1);
+ 351:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 354:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 357:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 35b:	01 c0                	add    %eax,%eax
+ 35d:	89 c6                	mov    %eax,%esi
+ 35f:	89 d7                	mov    %edx,%edi
+ 361:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 364:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 367:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 36a:	0f ad d0             	shrd   %cl,%edx,%eax
+ 36d:	d3 ea                	shr    %cl,%edx
+ 36f:	f6 c1 20             	test   $0x20,%cl
+ 372:	74 04                	je     378 <udiv64+0x6d>
+ 374:	89 d0                	mov    %edx,%eax
+ 376:	31 d2                	xor    %edx,%edx
+ 378:	83 e0 01             	and    $0x1,%eax
+ 37b:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 37e:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+ 385:	89 f0                	mov    %esi,%eax
+ 387:	89 fa                	mov    %edi,%edx
+ 389:	0b 45 c0             	or     -0x40(%ebp),%eax
+ 38c:	0b 55 c4             	or     -0x3c(%ebp),%edx
+ 38f:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 392:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 395:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 398:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 39b:	3b 45 c8             	cmp    -0x38(%ebp),%eax
+ 39e:	89 d0                	mov    %edx,%eax
+ 3a0:	1b 45 cc             	sbb    -0x34(%ebp),%eax
+ 3a3:	72 2d                	jb     3d2 <udiv64+0xc7>
+      r -= d;
+ 3a5:	8b 45 c8             	mov    -0x38(%ebp),%eax
+ 3a8:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 3ab:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 3ae:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64_t)1 << i;
+ 3b1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 3b4:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3b9:	ba 00 00 00 00       	mov    $0x0,%edx
+ 3be:	0f a5 c2             	shld   %cl,%eax,%edx
+ 3c1:	d3 e0                	shl    %cl,%eax
+ 3c3:	f6 c1 20             	test   $0x20,%cl
+ 3c6:	74 04                	je     3cc <udiv64+0xc1>
+ 3c8:	89 c2                	mov    %eax,%edx
+ 3ca:	31 c0                	xor    %eax,%eax
+ 3cc:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 3cf:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 3d2:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 3d6:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 3da:	0f 89 71 ff ff ff    	jns    351 <udiv64+0x46>
+  if(rem)
+ 3e0:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+ 3e4:	74 0e                	je     3f4 <udiv64+0xe9>
+    *rem = r;
+ 3e6:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 3e9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 3ec:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 3ef:	89 01                	mov    %eax,(%ecx)
+ 3f1:	89 51 04             	mov    %edx,0x4(%ecx)
+  return q;
+ 3f4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 3f7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 3fa:	83 c4 38             	add    $0x38,%esp
+ 3fd:	5e                   	pop    %esi
+ 3fe:	5f                   	pop    %edi
+ 3ff:	5d                   	pop    %ebp
+ 400:	c3                   	ret
+
+00000401 <crc32cinit>:
+{
+ 401:	55                   	push   %ebp
+ 402:	89 e5                	mov    %esp,%ebp
+ 404:	83 ec 20             	sub    $0x20,%esp
+  for(i = 0; i < 256; i++){
+ 407:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 40e:	eb 4c                	jmp    45c <crc32cinit+0x5b>
+    r = i;
+ 410:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 413:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+ 416:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+ 41d:	eb 26                	jmp    445 <crc32cinit+0x44>
+      r = (r >> 1) ^ ((r & 1) ? CRC32C_POLY : 0);
+ 41f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 422:	d1 e8                	shr    %eax
+ 424:	89 c2                	mov    %eax,%edx
+ 426:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 429:	83 e0 01             	and    $0x1,%eax
+ 42c:	85 c0                	test   %eax,%eax
+ 42e:	74 07                	je     437 <crc32cinit+0x36>
+ 430:	b8 78 3b f6 82       	mov    $0x82f63b78,%eax
+ 435:	eb 05                	jmp    43c <crc32cinit+0x3b>
+ 437:	b8 00 00 00 00       	mov    $0x0,%eax
+ 43c:	31 d0                	xor    %edx,%eax
+ 43e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+ 441:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+ 445:	83 7d f8 07          	cmpl   $0x7,-0x8(%ebp)
+ 449:	76 d4                	jbe    41f <crc32cinit+0x1e>
+    crc32ctab[i] = r;
+ 44b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 44e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 451:	89 14 85 00 0e 00 00 	mov    %edx,0xe00(,%eax,4)
+  for(i = 0; i < 256; i++){
+ 458:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 45c:	81 7d fc ff 00 00 00 	cmpl   $0xff,-0x4(%ebp)
+ 463:	76 ab                	jbe    410 <crc32cinit+0xf>
+  cpuinfo(1, &a, &b, &c, &d);
+ 465:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 468:	50                   	push   %eax
+ 469:	8d 45 e8             	lea    -0x18(%ebp),%eax
+ 46c:	50                   	push   %eax
+ 46d:	8d 45 ec             	lea    -0x14(%ebp),%eax
+ 470:	50                   	push   %eax
+ 471:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 474:	50                   	push   %eax
+ 475:	6a 01                	push   $0x1
+ 477:	e8 d7 fd ff ff       	call   253 <cpuinfo>
+ 47c:	83 c4 14             	add    $0x14,%esp
+  crc32chw = (c & CPUID_SSE42) != 0;
+ 47f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 482:	25 00 00 10 00       	and    $0x100000,%eax
+ 487:	85 c0                	test   %eax,%eax
+ 489:	0f 95 c0             	setne  %al
+ 48c:	0f b6 c0             	movzbl %al,%eax
+ 48f:	a3 e8 0d 00 00       	mov    %eax,0xde8
+}
+ 494:	90                   	nop
+ 495:	c9                   	leave
+ 496:	c3                   	ret
+
+00000497 <crc32c>:
+{
+ 497:	55                   	push   %ebp
+ 498:	89 e5                	mov    %esp,%ebp
+ 49a:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s = p;
+ 49d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4a0:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(crc32chw < 0)
+ 4a3:	a1 e8 0d 00 00       	mov    0xde8,%eax
+ 4a8:	85 c0                	test   %eax,%eax
+ 4aa:	79 05                	jns    4b1 <crc32c+0x1a>
+    crc32cinit();
+ 4ac:	e8 50 ff ff ff       	call   401 <crc32cinit>
+  crc = ~crc;
+ 4b1:	f7 55 08             	notl   0x8(%ebp)
+  if(crc32chw){
+ 4b4:	a1 e8 0d 00 00       	mov    0xde8,%eax
+ 4b9:	85 c0                	test   %eax,%eax
+ 4bb:	74 6c                	je     529 <crc32c+0x92>
+    for(; n >= 4; n -= 4, s += 4)
+ 4bd:	eb 18                	jmp    4d7 <crc32c+0x40>
+      asm("crc32l %1, %0" : "+r" (crc) : "rm" (*(const uint*)s));
+ 4bf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 4c2:	8b 10                	mov    (%eax),%edx
+ 4c4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4c7:	f2 0f 38 f1 c2       	crc32  %edx,%eax
+ 4cc:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n >= 4; n -= 4, s += 4)
+ 4cf:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+ 4d3:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+ 4d7:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+ 4db:	77 e2                	ja     4bf <crc32c+0x28>
+    for(; n > 0; n--, s++)
+ 4dd:	eb 19                	jmp    4f8 <crc32c+0x61>
+      asm("crc32b %1, %0" : "+r" (crc) : "qm" (*s));
+ 4df:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 4e2:	0f b6 10             	movzbl (%eax),%edx
+ 4e5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4e8:	f2 0f 38 f0 c2       	crc32  %dl,%eax
+ 4ed:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+ 4f0:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+ 4f4:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 4f8:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 4fc:	75 e1                	jne    4df <crc32c+0x48>
+ 4fe:	eb 2f                	jmp    52f <crc32c+0x98>
+      crc = crc32ctab[(crc ^ *s) & 0xff] ^ (crc >> 8);
+ 500:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 503:	0f b6 00             	movzbl (%eax),%eax
+ 506:	0f b6 c0             	movzbl %al,%eax
+ 509:	33 45 08             	xor    0x8(%ebp),%eax
+ 50c:	0f b6 c0             	movzbl %al,%eax
+ 50f:	8b 04 85 00 0e 00 00 	mov    0xe00(,%eax,4),%eax
+ 516:	8b 55 08             	mov    0x8(%ebp),%edx
+ 519:	c1 ea 08             	shr    $0x8,%edx
+ 51c:	31 d0                	xor    %edx,%eax
+ 51e:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+ 521:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+ 525:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 529:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 52d:	75 d1                	jne    500 <crc32c+0x69>
+  return ~crc;
+ 52f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 532:	f7 d0                	not    %eax
+}
+ 534:	c9                   	leave
+ 535:	c3                   	ret
+
+00000536 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 536:	b8 01 00 00 00       	mov    $0x1,%eax
+ 53b:	cd 40                	int    $0x40
+ 53d:	c3                   	ret
+
+0000053e <exit>:
+SYSCALL(exit)
+ 53e:	b8 02 00 00 00       	mov    $0x2,%eax
+ 543:	cd 40                	int    $0x40
+ 545:	c3                   	ret
+
+00000546 <wait>:
+SYSCALL(wait)
+ 546:	b8 03 00 00 00       	mov    $0x3,%eax
+ 54b:	cd 40                	int    $0x40
+ 54d:	c3                   	ret
+
+0000054e <pipe>:
+SYSCALL(pipe)
+ 54e:	b8 04 00 00 00       	mov    $0x4,%eax
+ 553:	cd 40                	int    $0x40
+ 555:	c3                   	ret
+
+00000556 <read>:
+SYSCALL(read)
+ 556:	b8 05 00 00 00       	mov    $0x5,%eax
+ 55b:	cd 40                	int    $0x40
+ 55d:	c3                   	ret
+
+0000055e <write>:
+SYSCALL(write)
+ 55e:	b8 10 00 00 00       	mov    $0x10,%eax
+ 563:	cd 40                	int    $0x40
+ 565:	c3                   	ret
+
+00000566 <close>:
+SYSCALL(close)
+ 566:	b8 15 00 00 00       	mov    $0x15,%eax
+ 56b:	cd 40                	int    $0x40
+ 56d:	c3                   	ret
+
+0000056e <kill>:
+SYSCALL(kill)
+ 56e:	b8 06 00 00 00       	mov    $0x6,%eax
+ 573:	cd 40                	int    $0x40
+ 575:	c3                   	ret
+
+00000576 <exec>:
+SYSCALL(exec)
+ 576:	b8 07 00 00 00       	mov    $0x7,%eax
+ 57b:	cd 40                	int    $0x40
+ 57d:	c3                   	ret
+
+0000057e <open>:
+SYSCALL(open)
+ 57e:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 583:	cd 40                	int    $0x40
+ 585:	c3                   	ret
+
+00000586 <mknod>:
+SYSCALL(mknod)
+ 586:	b8 11 00 00 00       	mov    $0x11,%eax
+ 58b:	cd 40                	int    $0x40
+ 58d:	c3                   	ret
+
+0000058e <unlink>:
+SYSCALL(unlink)
+ 58e:	b8 12 00 00 00       	mov    $0x12,%eax
+ 593:	cd 40                	int    $0x40
+ 595:	c3                   	ret
+
+00000596 <fstat>:
+SYSCALL(fstat)
+ 596:	b8 08 00 00 00       	mov    $0x8,%eax
+ 59b:	cd 40                	int    $0x40
+ 59d:	c3                   	ret
+
+0000059e <link>:
+SYSCALL(link)
+ 59e:	b8 13 00 00 00       	mov    $0x13,%eax
+ 5a3:	cd 40                	int    $0x40
+ 5a5:	c3                   	ret
+
+000005a6 <mkdir>:
+SYSCALL(mkdir)
+ 5a6:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5ab:	cd 40                	int    $0x40
+ 5ad:	c3                   	ret
+
+000005ae <chdir>:
+SYSCALL(chdir)
+ 5ae:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5b3:	cd 40                	int    $0x40
+ 5b5:	c3                   	ret
+
+000005b6 <dup>:
+SYSCALL(dup)
+ 5b6:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5bb:	cd 40                	int    $0x40
+ 5bd:	c3                   	ret
+
+000005be <getpid>:
+SYSCALL(getpid)
+ 5be:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5c3:	cd 40                	int    $0x40
+ 5c5:	c3                   	ret
+
+000005c6 <sbrk>:
+SYSCALL(sbrk)
+ 5c6:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5cb:	cd 40                	int    $0x40
+ 5cd:	c3                   	ret
+
+000005ce <sleep>:
+SYSCALL(sleep)
+ 5ce:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5d3:	cd 40                	int    $0x40
+ 5d5:	c3                   	ret
+
+000005d6 <uptime>:
+SYSCALL(uptime)
+ 5d6:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5db:	cd 40                	int    $0x40
+ 5dd:	c3                   	ret
+
+000005de <arp>:
+SYSCALL(arp)
+ 5de:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5e3:	cd 40                	int    $0x40
+ 5e5:	c3                   	ret
+
+000005e6 <ifstat>:
+SYSCALL(ifstat)
+ 5e6:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5eb:	cd 40                	int    $0x40
+ 5ed:	c3                   	ret
+
+000005ee <pcapctl>:
+SYSCALL(pcapctl)
+ 5ee:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5f3:	cd 40                	int    $0x40
+ 5f5:	c3                   	ret
+
+000005f6 <pcapread>:
+SYSCALL(pcapread)
+ 5f6:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5fb:	cd 40                	int    $0x40
+ 5fd:	c3                   	ret
+
+000005fe <bpfattach>:
+SYSCALL(bpfattach)
+ 5fe:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 603:	cd 40                	int    $0x40
+ 605:	c3                   	ret
+
+00000606 <pktgen>:
+SYSCALL(pktgen)
+ 606:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 60b:	cd 40                	int    $0x40
+ 60d:	c3                   	ret
+
+0000060e <reflect>:
+SYSCALL(reflect)
+ 60e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 613:	cd 40                	int    $0x40
+ 615:	c3                   	ret
+
+00000616 <brctl>:
+SYSCALL(brctl)
+ 616:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 61b:	cd 40                	int    $0x40
+ 61d:	c3                   	ret
+
+0000061e <hostopen>:
+SYSCALL(hostopen)
+ 61e:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 623:	cd 40                	int    $0x40
+ 625:	c3                   	ret
+
+00000626 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 626:	55                   	push   %ebp
+ 627:	89 e5                	mov    %esp,%ebp
+ 629:	83 ec 18             	sub    $0x18,%esp
+ 62c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 62f:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 632:	83 ec 04             	sub    $0x4,%esp
+ 635:	6a 01                	push   $0x1
+ 637:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 63a:	50                   	push   %eax
+ 63b:	ff 75 08             	push   0x8(%ebp)
+ 63e:	e8 1b ff ff ff       	call   55e <write>
+ 643:	83 c4 10             	add    $0x10,%esp
+}
+ 646:	90                   	nop
+ 647:	c9                   	leave
+ 648:	c3                   	ret
+
+00000649 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 649:	55                   	push   %ebp
+ 64a:	89 e5                	mov    %esp,%ebp
+ 64c:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 64f:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 656:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 65a:	74 17                	je     673 <printint+0x2a>
+ 65c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 660:	79 11                	jns    673 <printint+0x2a>
+    neg = 1;
+ 662:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 669:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 66c:	f7 d8                	neg    %eax
+ 66e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 671:	eb 06                	jmp    679 <printint+0x30>
+  } else {
+    x = xx;
+ 673:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 676:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 679:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 680:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 683:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 686:	ba 00 00 00 00       	mov    $0x0,%edx
+ 68b:	f7 f1                	div    %ecx
+ 68d:	89 d1                	mov    %edx,%ecx
+ 68f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 692:	8d 50 01             	lea    0x1(%eax),%edx
+ 695:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 698:	0f b6 91 ec 0d 00 00 	movzbl 0xdec(%ecx),%edx
+ 69f:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 6a3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 6a6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 6a9:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6ae:	f7 f1                	div    %ecx
+ 6b0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 6b3:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 6b7:	75 c7                	jne    680 <printint+0x37>
+  if(neg)
+ 6b9:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 6bd:	74 2d                	je     6ec <printint+0xa3>
+    buf[i++] = '-';
+ 6bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6c2:	8d 50 01             	lea    0x1(%eax),%edx
+ 6c5:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 6c8:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 6cd:	eb 1d                	jmp    6ec <printint+0xa3>
+    putc(fd, buf[i]);
+ 6cf:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 6d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6d5:	01 d0                	add    %edx,%eax
+ 6d7:	0f b6 00             	movzbl (%eax),%eax
+ 6da:	0f be c0             	movsbl %al,%eax
+ 6dd:	83 ec 08             	sub    $0x8,%esp
+ 6e0:	50                   	push   %eax
+ 6e1:	ff 75 08             	push   0x8(%ebp)
+ 6e4:	e8 3d ff ff ff       	call   626 <putc>
+ 6e9:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 6ec:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 6f0:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 6f4:	79 d9                	jns    6cf <printint+0x86>
+}
+ 6f6:	90                   	nop
+ 6f7:	90                   	nop
+ 6f8:	c9                   	leave
+ 6f9:	c3                   	ret
+
+000006fa <printf>:
+
+// Print to the given fd. Only understands %d, %u, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 6fa:	55                   	push   %ebp
+ 6fb:	89 e5                	mov    %esp,%ebp
+ 6fd:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 700:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 707:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 70a:	83 c0 04             	add    $0x4,%eax
+ 70d:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 710:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 717:	e9 7d 01 00 00       	jmp    899 <printf+0x19f>
+    c = fmt[i] & 0xff;
+ 71c:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 71f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 722:	01 d0                	add    %edx,%eax
+ 724:	0f b6 00             	movzbl (%eax),%eax
+ 727:	0f be c0             	movsbl %al,%eax
+ 72a:	25 ff 00 00 00       	and    $0xff,%eax
+ 72f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 732:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 736:	75 2c                	jne    764 <printf+0x6a>
+      if(c == '%'){
+ 738:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 73c:	75 0c                	jne    74a <printf+0x50>
+        state = '%';
+ 73e:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 745:	e9 4b 01 00 00       	jmp    895 <printf+0x19b>
+      } else {
+        putc(fd, c);
+ 74a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 74d:	0f be c0             	movsbl %al,%eax
+ 750:	83 ec 08             	sub    $0x8,%esp
+ 753:	50                   	push   %eax
+ 754:	ff 75 08             	push   0x8(%ebp)
+ 757:	e8 ca fe ff ff       	call   626 <putc>
+ 75c:	83 c4 10             	add    $0x10,%esp
+ 75f:	e9 31 01 00 00       	jmp    895 <printf+0x19b>
+      }
+    } else if(state == '%'){
+ 764:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 768:	0f 85 27 01 00 00    	jne    895 <printf+0x19b>
+      if(c == 'd'){
+ 76e:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 772:	75 1e                	jne    792 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 774:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 777:	8b 00                	mov    (%eax),%eax
+ 779:	6a 01                	push   $0x1
+ 77b:	6a 0a                	push   $0xa
+ 77d:	50                   	push   %eax
+ 77e:	ff 75 08             	push   0x8(%ebp)
+ 781:	e8 c3 fe ff ff       	call   649 <printint>
+ 786:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 789:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 78d:	e9 fc 00 00 00       	jmp    88e <printf+0x194>
+      } else if(c == 'u'){
+ 792:	83 7d e4 75          	cmpl   $0x75,-0x1c(%ebp)
+ 796:	75 1e                	jne    7b6 <printf+0xbc>
+        printint(fd, *ap, 10, 0);
+ 798:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 79b:	8b 00                	mov    (%eax),%eax
+ 79d:	6a 00                	push   $0x0
+ 79f:	6a 0a                	push   $0xa
+ 7a1:	50                   	push   %eax
+ 7a2:	ff 75 08             	push   0x8(%ebp)
+ 7a5:	e8 9f fe ff ff       	call   649 <printint>
+ 7aa:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 7ad:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7b1:	e9 d8 00 00 00       	jmp    88e <printf+0x194>
+      } else if(c == 'x' || c == 'p'){
+ 7b6:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 7ba:	74 06                	je     7c2 <printf+0xc8>
+ 7bc:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 7c0:	75 1e                	jne    7e0 <printf+0xe6>
+        printint(fd, *ap, 16, 0);
+ 7c2:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7c5:	8b 00                	mov    (%eax),%eax
+ 7c7:	6a 00                	push   $0x0
+ 7c9:	6a 10                	push   $0x10
+ 7cb:	50                   	push   %eax
+ 7cc:	ff 75 08             	push   0x8(%ebp)
+ 7cf:	e8 75 fe ff ff       	call   649 <printint>
+ 7d4:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 7d7:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7db:	e9 ae 00 00 00       	jmp    88e <printf+0x194>
+      } else if(c == 's'){
+ 7e0:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 7e4:	75 43                	jne    829 <printf+0x12f>
+        s = (char*)*ap;
+ 7e6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7e9:	8b 00                	mov    (%eax),%eax
+ 7eb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 7ee:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 7f2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 7f6:	75 25                	jne    81d <printf+0x123>
+          s = "(null)";
+ 7f8:	c7 45 f4 08 0b 00 00 	movl   $0xb08,-0xc(%ebp)
+        while(*s != 0){
+ 7ff:	eb 1c                	jmp    81d <printf+0x123>
+          putc(fd, *s);
+ 801:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 804:	0f b6 00             	movzbl (%eax),%eax
+ 807:	0f be c0             	movsbl %al,%eax
+ 80a:	83 ec 08             	sub    $0x8,%esp
+ 80d:	50                   	push   %eax
+ 80e:	ff 75 08             	push   0x8(%ebp)
+ 811:	e8 10 fe ff ff       	call   626 <putc>
+ 816:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 819:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 81d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 820:	0f b6 00             	movzbl (%eax),%eax
+ 823:	84 c0                	test   %al,%al
+ 825:	75 da                	jne    801 <printf+0x107>
+ 827:	eb 65                	jmp    88e <printf+0x194>
+        }
+      } else if(c == 'c'){
+ 829:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 82d:	75 1d                	jne    84c <printf+0x152>
+        putc(fd, *ap);
+ 82f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 832:	8b 00                	mov    (%eax),%eax
+ 834:	0f be c0             	movsbl %al,%eax
+ 837:	83 ec 08             	sub    $0x8,%esp
+ 83a:	50                   	push   %eax
+ 83b:	ff 75 08             	push   0x8(%ebp)
+ 83e:	e8 e3 fd ff ff       	call   626 <putc>
+ 843:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 846:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 84a:	eb 42                	jmp    88e <printf+0x194>
+      } else if(c == '%'){
+ 84c:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 850:	75 17                	jne    869 <printf+0x16f>
+        putc(fd, c);
+ 852:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 855:	0f be c0             	movsbl %al,%eax
+ 858:	83 ec 08             	sub    $0x8,%esp
+ 85b:	50                   	push   %eax
+ 85c:	ff 75 08             	push   0x8(%ebp)
+ 85f:	e8 c2 fd ff ff       	call   626 <putc>
+ 864:	83 c4 10             	add    $0x10,%esp
+ 867:	eb 25                	jmp    88e <printf+0x194>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 869:	83 ec 08             	sub    $0x8,%esp
+ 86c:	6a 25                	push   $0x25
+ 86e:	ff 75 08             	push   0x8(%ebp)
+ 871:	e8 b0 fd ff ff       	call   626 <putc>
+ 876:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 879:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 87c:	0f be c0             	movsbl %al,%eax
+ 87f:	83 ec 08             	sub    $0x8,%esp
+ 882:	50                   	push   %eax
+ 883:	ff 75 08             	push   0x8(%ebp)
+ 886:	e8 9b fd ff ff       	call   626 <putc>
+ 88b:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 88e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 895:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 899:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 89c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 89f:	01 d0                	add    %edx,%eax
+ 8a1:	0f b6 00             	movzbl (%eax),%eax
+ 8a4:	84 c0                	test   %al,%al
+ 8a6:	0f 85 70 fe ff ff    	jne    71c <printf+0x22>
+    }
+  }
+}
+ 8ac:	90                   	nop
+ 8ad:	90                   	nop
+ 8ae:	c9                   	leave
+ 8af:	c3                   	ret
+
+000008b0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 8b0:	55                   	push   %ebp
+ 8b1:	89 e5                	mov    %esp,%ebp
+ 8b3:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 8b6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8b9:	83 e8 08             	sub    $0x8,%eax
+ 8bc:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8bf:	a1 08 12 00 00       	mov    0x1208,%eax
+ 8c4:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 8c7:	eb 24                	jmp    8ed <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8c9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8cc:	8b 00                	mov    (%eax),%eax
+ 8ce:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 8d1:	72 12                	jb     8e5 <free+0x35>
+ 8d3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8d6:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 8d9:	72 24                	jb     8ff <free+0x4f>
+ 8db:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8de:	8b 00                	mov    (%eax),%eax
+ 8e0:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 8e3:	72 1a                	jb     8ff <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8e5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8e8:	8b 00                	mov    (%eax),%eax
+ 8ea:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 8ed:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8f0:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 8f3:	73 d4                	jae    8c9 <free+0x19>
+ 8f5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8f8:	8b 00                	mov    (%eax),%eax
+ 8fa:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 8fd:	73 ca                	jae    8c9 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 8ff:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 902:	8b 40 04             	mov    0x4(%eax),%eax
+ 905:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 90c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 90f:	01 c2                	add    %eax,%edx
+ 911:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 914:	8b 00                	mov    (%eax),%eax
+ 916:	39 c2                	cmp    %eax,%edx
+ 918:	75 24                	jne    93e <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 91a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 91d:	8b 50 04             	mov    0x4(%eax),%edx
+ 920:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 923:	8b 00                	mov    (%eax),%eax
+ 925:	8b 40 04             	mov    0x4(%eax),%eax
+ 928:	01 c2                	add    %eax,%edx
+ 92a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 92d:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 930:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 933:	8b 00                	mov    (%eax),%eax
+ 935:	8b 10                	mov    (%eax),%edx
+ 937:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 93a:	89 10                	mov    %edx,(%eax)
+ 93c:	eb 0a                	jmp    948 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 93e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 941:	8b 10                	mov    (%eax),%edx
+ 943:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 946:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 948:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 94b:	8b 40 04             	mov    0x4(%eax),%eax
+ 94e:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 955:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 958:	01 d0                	add    %edx,%eax
+ 95a:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 95d:	75 20                	jne    97f <free+0xcf>
+    p->s.size += bp->s.size;
+ 95f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 962:	8b 50 04             	mov    0x4(%eax),%edx
+ 965:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 968:	8b 40 04             	mov    0x4(%eax),%eax
+ 96b:	01 c2                	add    %eax,%edx
+ 96d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 970:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 973:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 976:	8b 10                	mov    (%eax),%edx
+ 978:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 97b:	89 10                	mov    %edx,(%eax)
+ 97d:	eb 08                	jmp    987 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 97f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 982:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 985:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 987:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 98a:	a3 08 12 00 00       	mov    %eax,0x1208
+}
+ 98f:	90                   	nop
+ 990:	c9                   	leave
+ 991:	c3                   	ret
+
+00000992 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 992:	55                   	push   %ebp
+ 993:	89 e5                	mov    %esp,%ebp
+ 995:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 998:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 99f:	77 07                	ja     9a8 <morecore+0x16>
+    nu = 4096;
+ 9a1:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 9a8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9ab:	c1 e0 03             	shl    $0x3,%eax
+ 9ae:	83 ec 0c             	sub    $0xc,%esp
+ 9b1:	50                   	push   %eax
+ 9b2:	e8 0f fc ff ff       	call   5c6 <sbrk>
+ 9b7:	83 c4 10             	add    $0x10,%esp
+ 9ba:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 9bd:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 9c1:	75 07                	jne    9ca <morecore+0x38>
+    return 0;
+ 9c3:	b8 00 00 00 00       	mov    $0x0,%eax
+ 9c8:	eb 26                	jmp    9f0 <morecore+0x5e>
+  hp = (Header*)p;
+ 9ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9cd:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 9d0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9d3:	8b 55 08             	mov    0x8(%ebp),%edx
+ 9d6:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 9d9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9dc:	83 c0 08             	add    $0x8,%eax
+ 9df:	83 ec 0c             	sub    $0xc,%esp
+ 9e2:	50                   	push   %eax
+ 9e3:	e8 c8 fe ff ff       	call   8b0 <free>
+ 9e8:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 9eb:	a1 08 12 00 00       	mov    0x1208,%eax
+}
+ 9f0:	c9                   	leave
+ 9f1:	c3                   	ret
+
+000009f2 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 9f2:	55                   	push   %ebp
+ 9f3:	89 e5                	mov    %esp,%ebp
+ 9f5:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9f8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9fb:	83 c0 07             	add    $0x7,%eax
+ 9fe:	c1 e8 03             	shr    $0x3,%eax
+ a01:	83 c0 01             	add    $0x1,%eax
+ a04:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ a07:	a1 08 12 00 00       	mov    0x1208,%eax
+ a0c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ a0f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ a13:	75 23                	jne    a38 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ a15:	c7 45 f0 00 12 00 00 	movl   $0x1200,-0x10(%ebp)
+ a1c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a1f:	a3 08 12 00 00       	mov    %eax,0x1208
+ a24:	a1 08 12 00 00       	mov    0x1208,%eax
+ a29:	a3 00 12 00 00       	mov    %eax,0x1200
+    base.s.size = 0;
+ a2e:	c7 05 04 12 00 00 00 	movl   $0x0,0x1204
+ a35:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a38:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a3b:	8b 00                	mov    (%eax),%eax
+ a3d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ a40:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a43:	8b 40 04             	mov    0x4(%eax),%eax
+ a46:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ a49:	72 4d                	jb     a98 <malloc+0xa6>
+      if(p->s.size == nunits)
+ a4b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a4e:	8b 40 04             	mov    0x4(%eax),%eax
+ a51:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ a54:	75 0c                	jne    a62 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ a56:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a59:	8b 10                	mov    (%eax),%edx
+ a5b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a5e:	89 10                	mov    %edx,(%eax)
+ a60:	eb 26                	jmp    a88 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ a62:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a65:	8b 40 04             	mov    0x4(%eax),%eax
+ a68:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ a6b:	89 c2                	mov    %eax,%edx
+ a6d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a70:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ a73:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a76:	8b 40 04             	mov    0x4(%eax),%eax
+ a79:	c1 e0 03             	shl    $0x3,%eax
+ a7c:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ a7f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a82:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ a85:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ a88:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a8b:	a3 08 12 00 00       	mov    %eax,0x1208
+      return (void*)(p + 1);
+ a90:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a93:	83 c0 08             	add    $0x8,%eax
+ a96:	eb 3b                	jmp    ad3 <malloc+0xe1>
+    }
+    if(p == freep)
+ a98:	a1 08 12 00 00       	mov    0x1208,%eax
+ a9d:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ aa0:	75 1e                	jne    ac0 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ aa2:	83 ec 0c             	sub    $0xc,%esp
+ aa5:	ff 75 ec             	push   -0x14(%ebp)
+ aa8:	e8 e5 fe ff ff       	call   992 <morecore>
+ aad:	83 c4 10             	add    $0x10,%esp
+ ab0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ ab3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ab7:	75 07                	jne    ac0 <malloc+0xce>
+        return 0;
+ ab9:	b8 00 00 00 00       	mov    $0x0,%eax
+ abe:	eb 13                	jmp    ad3 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ac0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ac3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ ac6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ac9:	8b 00                	mov    (%eax),%eax
+ acb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ ace:	e9 6d ff ff ff       	jmp    a40 <malloc+0x4e>
+  }
+}
+ ad3:	c9                   	leave
+ ad4:	c3                   	ret
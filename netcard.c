@@ -1,4 +1,5 @@
 #include "defs.h"
+#include "spinlock.h"
 #include "types.h"
 #include "netcard.h"
 #include "virtio.h"
@@ -24,17 +25,11 @@ found:
   return index;
 }
 
+/*
+ * Registers the network card drivers. The cards themselves are set up
+ * as pci_init finds them, so this has to run first.
+ */
 void net_init()
 {
-  int fd = alloc_netcard();
-  if (fd == -1) {
-      panic("Unable to allocate netcard\n");
-  }
-
-  struct net_card card = netcards[fd];
-  // Device class number for a network card is 0x02
-  int pci_fd = get_pci_dev(0x02);
-  int virt_fd = virtio_init(pci_fd);
-
-  card.device = &virtdevs[virt_fd];
+  virtionetinit();
 }
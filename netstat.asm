@@ -0,0 +1,1868 @@
+
+_netstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <printmac>:
+
+static char *qname[NIC_NQUEUE] = { "rx", "tx" };
+
+static void
+printmac(uchar *mac)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 18             	sub    $0x18,%esp
+  int i;
+
+  for(i = 0; i < 6; i++)
+   6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+   d:	eb 33                	jmp    42 <printmac+0x42>
+    printf(1, i ? ":%x" : "%x", mac[i]);
+   f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  12:	8b 45 08             	mov    0x8(%ebp),%eax
+  15:	01 d0                	add    %edx,%eax
+  17:	0f b6 00             	movzbl (%eax),%eax
+  1a:	0f b6 c0             	movzbl %al,%eax
+  1d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  21:	74 07                	je     2a <printmac+0x2a>
+  23:	ba 16 0f 00 00       	mov    $0xf16,%edx
+  28:	eb 05                	jmp    2f <printmac+0x2f>
+  2a:	ba 1a 0f 00 00       	mov    $0xf1a,%edx
+  2f:	83 ec 04             	sub    $0x4,%esp
+  32:	50                   	push   %eax
+  33:	52                   	push   %edx
+  34:	6a 01                	push   $0x1
+  36:	e8 f8 0a 00 00       	call   b33 <printf>
+  3b:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 6; i++)
+  3e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  42:	83 7d f4 05          	cmpl   $0x5,-0xc(%ebp)
+  46:	7e c7                	jle    f <printmac+0xf>
+}
+  48:	90                   	nop
+  49:	90                   	nop
+  4a:	c9                   	leave
+  4b:	c3                   	ret
+
+0000004c <totals>:
+
+static void
+totals(void)
+{
+  4c:	55                   	push   %ebp
+  4d:	89 e5                	mov    %esp,%ebp
+  4f:	57                   	push   %edi
+  50:	56                   	push   %esi
+  51:	53                   	push   %ebx
+  52:	83 ec 6c             	sub    $0x6c,%esp
+  struct ifstat st;
+  struct ifqstat *q;
+  int i, j;
+
+  for(i = 0; ifstat(i, &st) == 0; i++){
+  55:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  5c:	e9 b3 00 00 00       	jmp    114 <totals+0xc8>
+    printf(1, "%s ", st.name);
+  61:	83 ec 04             	sub    $0x4,%esp
+  64:	8d 45 9c             	lea    -0x64(%ebp),%eax
+  67:	50                   	push   %eax
+  68:	68 1d 0f 00 00       	push   $0xf1d
+  6d:	6a 01                	push   $0x1
+  6f:	e8 bf 0a 00 00       	call   b33 <printf>
+  74:	83 c4 10             	add    $0x10,%esp
+    printmac(st.mac);
+  77:	83 ec 0c             	sub    $0xc,%esp
+  7a:	8d 45 9c             	lea    -0x64(%ebp),%eax
+  7d:	83 c0 08             	add    $0x8,%eax
+  80:	50                   	push   %eax
+  81:	e8 7a ff ff ff       	call   0 <printmac>
+  86:	83 c4 10             	add    $0x10,%esp
+    printf(1, "\n");
+  89:	83 ec 08             	sub    $0x8,%esp
+  8c:	68 21 0f 00 00       	push   $0xf21
+  91:	6a 01                	push   $0x1
+  93:	e8 9b 0a 00 00       	call   b33 <printf>
+  98:	83 c4 10             	add    $0x10,%esp
+    for(j = 0; j < NIC_NQUEUE; j++){
+  9b:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  a2:	eb 66                	jmp    10a <totals+0xbe>
+      q = &st.q[j];
+  a4:	8d 4d 9c             	lea    -0x64(%ebp),%ecx
+  a7:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  aa:	89 d0                	mov    %edx,%eax
+  ac:	01 c0                	add    %eax,%eax
+  ae:	01 d0                	add    %edx,%eax
+  b0:	c1 e0 03             	shl    $0x3,%eax
+  b3:	83 c0 10             	add    $0x10,%eax
+  b6:	01 c8                	add    %ecx,%eax
+  b8:	89 45 dc             	mov    %eax,-0x24(%ebp)
+      printf(1, "  %s: packets %u bytes %u drops %u ringfull %u notifies %u intrs %u\n",
+  bb:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  be:	8b 40 14             	mov    0x14(%eax),%eax
+  c1:	89 45 94             	mov    %eax,-0x6c(%ebp)
+  c4:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  c7:	8b 78 10             	mov    0x10(%eax),%edi
+  ca:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  cd:	8b 70 0c             	mov    0xc(%eax),%esi
+  d0:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  d3:	8b 58 08             	mov    0x8(%eax),%ebx
+  d6:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  d9:	8b 48 04             	mov    0x4(%eax),%ecx
+  dc:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  df:	8b 10                	mov    (%eax),%edx
+  e1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  e4:	8b 04 85 4c 13 00 00 	mov    0x134c(,%eax,4),%eax
+  eb:	83 ec 0c             	sub    $0xc,%esp
+  ee:	ff 75 94             	push   -0x6c(%ebp)
+  f1:	57                   	push   %edi
+  f2:	56                   	push   %esi
+  f3:	53                   	push   %ebx
+  f4:	51                   	push   %ecx
+  f5:	52                   	push   %edx
+  f6:	50                   	push   %eax
+  f7:	68 24 0f 00 00       	push   $0xf24
+  fc:	6a 01                	push   $0x1
+  fe:	e8 30 0a 00 00       	call   b33 <printf>
+ 103:	83 c4 30             	add    $0x30,%esp
+    for(j = 0; j < NIC_NQUEUE; j++){
+ 106:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+ 10a:	83 7d e0 01          	cmpl   $0x1,-0x20(%ebp)
+ 10e:	7e 94                	jle    a4 <totals+0x58>
+  for(i = 0; ifstat(i, &st) == 0; i++){
+ 110:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+ 114:	83 ec 08             	sub    $0x8,%esp
+ 117:	8d 45 9c             	lea    -0x64(%ebp),%eax
+ 11a:	50                   	push   %eax
+ 11b:	ff 75 e4             	push   -0x1c(%ebp)
+ 11e:	e8 fc 08 00 00       	call   a1f <ifstat>
+ 123:	83 c4 10             	add    $0x10,%esp
+ 126:	85 c0                	test   %eax,%eax
+ 128:	0f 84 33 ff ff ff    	je     61 <totals+0x15>
+             qname[j], q->packets, q->bytes, q->drops, q->ringfull,
+             q->notifies, q->intrs);
+    }
+  }
+  if(i == 0)
+ 12e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 132:	75 12                	jne    146 <totals+0xfa>
+    printf(1, "netstat: no interfaces\n");
+ 134:	83 ec 08             	sub    $0x8,%esp
+ 137:	68 69 0f 00 00       	push   $0xf69
+ 13c:	6a 01                	push   $0x1
+ 13e:	e8 f0 09 00 00       	call   b33 <printf>
+ 143:	83 c4 10             	add    $0x10,%esp
+}
+ 146:	90                   	nop
+ 147:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 14a:	5b                   	pop    %ebx
+ 14b:	5e                   	pop    %esi
+ 14c:	5f                   	pop    %edi
+ 14d:	5d                   	pop    %ebp
+ 14e:	c3                   	ret
+
+0000014f <rate>:
+
+// Per-second rate of a counter that went from a to b in t ticks.
+// The counters wrap, so only their difference is meaningful.
+static uint
+rate(uint a, uint b, uint t)
+{
+ 14f:	55                   	push   %ebp
+ 150:	89 e5                	mov    %esp,%ebp
+ 152:	83 ec 10             	sub    $0x10,%esp
+  uint d = b - a;
+ 155:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 158:	2b 45 08             	sub    0x8(%ebp),%eax
+ 15b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+  return d / t * HZ + d % t * HZ / t;
+ 15e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 161:	ba 00 00 00 00       	mov    $0x0,%edx
+ 166:	f7 75 10             	divl   0x10(%ebp)
+ 169:	6b c8 64             	imul   $0x64,%eax,%ecx
+ 16c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 16f:	ba 00 00 00 00       	mov    $0x0,%edx
+ 174:	f7 75 10             	divl   0x10(%ebp)
+ 177:	89 d0                	mov    %edx,%eax
+ 179:	6b c0 64             	imul   $0x64,%eax,%eax
+ 17c:	ba 00 00 00 00       	mov    $0x0,%edx
+ 181:	f7 75 10             	divl   0x10(%ebp)
+ 184:	01 c8                	add    %ecx,%eax
+}
+ 186:	c9                   	leave
+ 187:	c3                   	ret
+
+00000188 <rates>:
+
+static void
+rates(int interval)
+{
+ 188:	55                   	push   %ebp
+ 189:	89 e5                	mov    %esp,%ebp
+ 18b:	57                   	push   %edi
+ 18c:	56                   	push   %esi
+ 18d:	53                   	push   %ebx
+ 18e:	81 ec 7c 01 00 00    	sub    $0x17c,%esp
+  struct ifstat old[NIF], cur;
+  struct ifqstat *o, *n;
+  int i, j, nif;
+  uint t0, t1;
+
+  nif = 0;
+ 194:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+  while(nif < NIF && ifstat(nif, &old[nif]) == 0)
+ 19b:	eb 04                	jmp    1a1 <rates+0x19>
+    nif++;
+ 19d:	83 45 dc 01          	addl   $0x1,-0x24(%ebp)
+  while(nif < NIF && ifstat(nif, &old[nif]) == 0)
+ 1a1:	83 7d dc 03          	cmpl   $0x3,-0x24(%ebp)
+ 1a5:	7f 21                	jg     1c8 <rates+0x40>
+ 1a7:	8d 85 cc fe ff ff    	lea    -0x134(%ebp),%eax
+ 1ad:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 1b0:	c1 e2 06             	shl    $0x6,%edx
+ 1b3:	01 d0                	add    %edx,%eax
+ 1b5:	83 ec 08             	sub    $0x8,%esp
+ 1b8:	50                   	push   %eax
+ 1b9:	ff 75 dc             	push   -0x24(%ebp)
+ 1bc:	e8 5e 08 00 00       	call   a1f <ifstat>
+ 1c1:	83 c4 10             	add    $0x10,%esp
+ 1c4:	85 c0                	test   %eax,%eax
+ 1c6:	74 d5                	je     19d <rates+0x15>
+  if(nif == 0){
+ 1c8:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+ 1cc:	75 17                	jne    1e5 <rates+0x5d>
+    printf(1, "netstat: no interfaces\n");
+ 1ce:	83 ec 08             	sub    $0x8,%esp
+ 1d1:	68 69 0f 00 00       	push   $0xf69
+ 1d6:	6a 01                	push   $0x1
+ 1d8:	e8 56 09 00 00       	call   b33 <printf>
+ 1dd:	83 c4 10             	add    $0x10,%esp
+    return;
+ 1e0:	e9 73 02 00 00       	jmp    458 <rates+0x2d0>
+  }
+  t0 = uptime();
+ 1e5:	e8 25 08 00 00       	call   a0f <uptime>
+ 1ea:	89 45 d8             	mov    %eax,-0x28(%ebp)
+
+  for(;;){
+    sleep(interval * HZ);
+ 1ed:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f0:	6b c0 64             	imul   $0x64,%eax,%eax
+ 1f3:	83 ec 0c             	sub    $0xc,%esp
+ 1f6:	50                   	push   %eax
+ 1f7:	e8 0b 08 00 00       	call   a07 <sleep>
+ 1fc:	83 c4 10             	add    $0x10,%esp
+    t1 = uptime();
+ 1ff:	e8 0b 08 00 00       	call   a0f <uptime>
+ 204:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    if(t1 == t0)
+ 207:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 20a:	3b 45 d8             	cmp    -0x28(%ebp),%eax
+ 20d:	0f 84 3f 02 00 00    	je     452 <rates+0x2ca>
+      continue;
+    for(i = 0; i < nif; i++){
+ 213:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+ 21a:	e9 1c 02 00 00       	jmp    43b <rates+0x2b3>
+      if(ifstat(i, &cur) < 0)
+ 21f:	83 ec 08             	sub    $0x8,%esp
+ 222:	8d 85 8c fe ff ff    	lea    -0x174(%ebp),%eax
+ 228:	50                   	push   %eax
+ 229:	ff 75 e4             	push   -0x1c(%ebp)
+ 22c:	e8 ee 07 00 00       	call   a1f <ifstat>
+ 231:	83 c4 10             	add    $0x10,%esp
+ 234:	85 c0                	test   %eax,%eax
+ 236:	0f 88 fa 01 00 00    	js     436 <rates+0x2ae>
+        continue;
+      printf(1, "%s", cur.name);
+ 23c:	83 ec 04             	sub    $0x4,%esp
+ 23f:	8d 85 8c fe ff ff    	lea    -0x174(%ebp),%eax
+ 245:	50                   	push   %eax
+ 246:	68 81 0f 00 00       	push   $0xf81
+ 24b:	6a 01                	push   $0x1
+ 24d:	e8 e1 08 00 00       	call   b33 <printf>
+ 252:	83 c4 10             	add    $0x10,%esp
+      for(j = 0; j < NIC_NQUEUE; j++){
+ 255:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+ 25c:	e9 18 01 00 00       	jmp    379 <rates+0x1f1>
+        o = &old[i].q[j];
+ 261:	8d 8d cc fe ff ff    	lea    -0x134(%ebp),%ecx
+ 267:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 26a:	89 d0                	mov    %edx,%eax
+ 26c:	01 c0                	add    %eax,%eax
+ 26e:	01 d0                	add    %edx,%eax
+ 270:	c1 e0 03             	shl    $0x3,%eax
+ 273:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 276:	c1 e2 06             	shl    $0x6,%edx
+ 279:	01 d0                	add    %edx,%eax
+ 27b:	83 c0 10             	add    $0x10,%eax
+ 27e:	01 c8                	add    %ecx,%eax
+ 280:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        n = &cur.q[j];
+ 283:	8d 8d 8c fe ff ff    	lea    -0x174(%ebp),%ecx
+ 289:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 28c:	89 d0                	mov    %edx,%eax
+ 28e:	01 c0                	add    %eax,%eax
+ 290:	01 d0                	add    %edx,%eax
+ 292:	c1 e0 03             	shl    $0x3,%eax
+ 295:	83 c0 10             	add    $0x10,%eax
+ 298:	01 c8                	add    %ecx,%eax
+ 29a:	89 45 cc             	mov    %eax,-0x34(%ebp)
+        printf(1, "  %s %u pkt/s %u B/s %u drop/s %u notify/s %u intr/s",
+ 29d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 2a0:	2b 45 d8             	sub    -0x28(%ebp),%eax
+ 2a3:	89 c1                	mov    %eax,%ecx
+ 2a5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+ 2a8:	8b 50 14             	mov    0x14(%eax),%edx
+ 2ab:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 2ae:	8b 40 14             	mov    0x14(%eax),%eax
+ 2b1:	83 ec 04             	sub    $0x4,%esp
+ 2b4:	51                   	push   %ecx
+ 2b5:	52                   	push   %edx
+ 2b6:	50                   	push   %eax
+ 2b7:	e8 93 fe ff ff       	call   14f <rate>
+ 2bc:	83 c4 10             	add    $0x10,%esp
+ 2bf:	89 85 84 fe ff ff    	mov    %eax,-0x17c(%ebp)
+ 2c5:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 2c8:	89 c1                	mov    %eax,%ecx
+ 2ca:	2b 4d d8             	sub    -0x28(%ebp),%ecx
+ 2cd:	8b 45 cc             	mov    -0x34(%ebp),%eax
+ 2d0:	8b 50 10             	mov    0x10(%eax),%edx
+ 2d3:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 2d6:	8b 40 10             	mov    0x10(%eax),%eax
+ 2d9:	83 ec 04             	sub    $0x4,%esp
+ 2dc:	51                   	push   %ecx
+ 2dd:	52                   	push   %edx
+ 2de:	50                   	push   %eax
+ 2df:	e8 6b fe ff ff       	call   14f <rate>
+ 2e4:	83 c4 10             	add    $0x10,%esp
+ 2e7:	89 c7                	mov    %eax,%edi
+ 2e9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 2ec:	89 c1                	mov    %eax,%ecx
+ 2ee:	2b 4d d8             	sub    -0x28(%ebp),%ecx
+ 2f1:	8b 45 cc             	mov    -0x34(%ebp),%eax
+ 2f4:	8b 50 08             	mov    0x8(%eax),%edx
+ 2f7:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 2fa:	8b 40 08             	mov    0x8(%eax),%eax
+ 2fd:	83 ec 04             	sub    $0x4,%esp
+ 300:	51                   	push   %ecx
+ 301:	52                   	push   %edx
+ 302:	50                   	push   %eax
+ 303:	e8 47 fe ff ff       	call   14f <rate>
+ 308:	83 c4 10             	add    $0x10,%esp
+ 30b:	89 c6                	mov    %eax,%esi
+ 30d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 310:	89 c1                	mov    %eax,%ecx
+ 312:	2b 4d d8             	sub    -0x28(%ebp),%ecx
+ 315:	8b 45 cc             	mov    -0x34(%ebp),%eax
+ 318:	8b 50 04             	mov    0x4(%eax),%edx
+ 31b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 31e:	8b 40 04             	mov    0x4(%eax),%eax
+ 321:	83 ec 04             	sub    $0x4,%esp
+ 324:	51                   	push   %ecx
+ 325:	52                   	push   %edx
+ 326:	50                   	push   %eax
+ 327:	e8 23 fe ff ff       	call   14f <rate>
+ 32c:	83 c4 10             	add    $0x10,%esp
+ 32f:	89 c3                	mov    %eax,%ebx
+ 331:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 334:	89 c1                	mov    %eax,%ecx
+ 336:	2b 4d d8             	sub    -0x28(%ebp),%ecx
+ 339:	8b 45 cc             	mov    -0x34(%ebp),%eax
+ 33c:	8b 10                	mov    (%eax),%edx
+ 33e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 341:	8b 00                	mov    (%eax),%eax
+ 343:	83 ec 04             	sub    $0x4,%esp
+ 346:	51                   	push   %ecx
+ 347:	52                   	push   %edx
+ 348:	50                   	push   %eax
+ 349:	e8 01 fe ff ff       	call   14f <rate>
+ 34e:	83 c4 10             	add    $0x10,%esp
+ 351:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 354:	8b 14 95 4c 13 00 00 	mov    0x134c(,%edx,4),%edx
+ 35b:	ff b5 84 fe ff ff    	push   -0x17c(%ebp)
+ 361:	57                   	push   %edi
+ 362:	56                   	push   %esi
+ 363:	53                   	push   %ebx
+ 364:	50                   	push   %eax
+ 365:	52                   	push   %edx
+ 366:	68 84 0f 00 00       	push   $0xf84
+ 36b:	6a 01                	push   $0x1
+ 36d:	e8 c1 07 00 00       	call   b33 <printf>
+ 372:	83 c4 20             	add    $0x20,%esp
+      for(j = 0; j < NIC_NQUEUE; j++){
+ 375:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+ 379:	83 7d e0 01          	cmpl   $0x1,-0x20(%ebp)
+ 37d:	0f 8e de fe ff ff    	jle    261 <rates+0xd9>
+               rate(o->bytes, n->bytes, t1 - t0),
+               rate(o->drops, n->drops, t1 - t0),
+               rate(o->notifies, n->notifies, t1 - t0),
+               rate(o->intrs, n->intrs, t1 - t0));
+      }
+      printf(1, "\n");
+ 383:	83 ec 08             	sub    $0x8,%esp
+ 386:	68 21 0f 00 00       	push   $0xf21
+ 38b:	6a 01                	push   $0x1
+ 38d:	e8 a1 07 00 00       	call   b33 <printf>
+ 392:	83 c4 10             	add    $0x10,%esp
+      old[i] = cur;
+ 395:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 398:	c1 e0 06             	shl    $0x6,%eax
+ 39b:	8d 40 e8             	lea    -0x18(%eax),%eax
+ 39e:	01 e8                	add    %ebp,%eax
+ 3a0:	2d 1c 01 00 00       	sub    $0x11c,%eax
+ 3a5:	8b 95 8c fe ff ff    	mov    -0x174(%ebp),%edx
+ 3ab:	89 10                	mov    %edx,(%eax)
+ 3ad:	8b 95 90 fe ff ff    	mov    -0x170(%ebp),%edx
+ 3b3:	89 50 04             	mov    %edx,0x4(%eax)
+ 3b6:	8b 95 94 fe ff ff    	mov    -0x16c(%ebp),%edx
+ 3bc:	89 50 08             	mov    %edx,0x8(%eax)
+ 3bf:	8b 95 98 fe ff ff    	mov    -0x168(%ebp),%edx
+ 3c5:	89 50 0c             	mov    %edx,0xc(%eax)
+ 3c8:	8b 95 9c fe ff ff    	mov    -0x164(%ebp),%edx
+ 3ce:	89 50 10             	mov    %edx,0x10(%eax)
+ 3d1:	8b 95 a0 fe ff ff    	mov    -0x160(%ebp),%edx
+ 3d7:	89 50 14             	mov    %edx,0x14(%eax)
+ 3da:	8b 95 a4 fe ff ff    	mov    -0x15c(%ebp),%edx
+ 3e0:	89 50 18             	mov    %edx,0x18(%eax)
+ 3e3:	8b 95 a8 fe ff ff    	mov    -0x158(%ebp),%edx
+ 3e9:	89 50 1c             	mov    %edx,0x1c(%eax)
+ 3ec:	8b 95 ac fe ff ff    	mov    -0x154(%ebp),%edx
+ 3f2:	89 50 20             	mov    %edx,0x20(%eax)
+ 3f5:	8b 95 b0 fe ff ff    	mov    -0x150(%ebp),%edx
+ 3fb:	89 50 24             	mov    %edx,0x24(%eax)
+ 3fe:	8b 95 b4 fe ff ff    	mov    -0x14c(%ebp),%edx
+ 404:	89 50 28             	mov    %edx,0x28(%eax)
+ 407:	8b 95 b8 fe ff ff    	mov    -0x148(%ebp),%edx
+ 40d:	89 50 2c             	mov    %edx,0x2c(%eax)
+ 410:	8b 95 bc fe ff ff    	mov    -0x144(%ebp),%edx
+ 416:	89 50 30             	mov    %edx,0x30(%eax)
+ 419:	8b 95 c0 fe ff ff    	mov    -0x140(%ebp),%edx
+ 41f:	89 50 34             	mov    %edx,0x34(%eax)
+ 422:	8b 95 c4 fe ff ff    	mov    -0x13c(%ebp),%edx
+ 428:	89 50 38             	mov    %edx,0x38(%eax)
+ 42b:	8b 95 c8 fe ff ff    	mov    -0x138(%ebp),%edx
+ 431:	89 50 3c             	mov    %edx,0x3c(%eax)
+ 434:	eb 01                	jmp    437 <rates+0x2af>
+        continue;
+ 436:	90                   	nop
+    for(i = 0; i < nif; i++){
+ 437:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+ 43b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 43e:	3b 45 dc             	cmp    -0x24(%ebp),%eax
+ 441:	0f 8c d8 fd ff ff    	jl     21f <rates+0x97>
+    }
+    t0 = t1;
+ 447:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 44a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 44d:	e9 9b fd ff ff       	jmp    1ed <rates+0x65>
+      continue;
+ 452:	90                   	nop
+    sleep(interval * HZ);
+ 453:	e9 95 fd ff ff       	jmp    1ed <rates+0x65>
+  }
+}
+ 458:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 45b:	5b                   	pop    %ebx
+ 45c:	5e                   	pop    %esi
+ 45d:	5f                   	pop    %edi
+ 45e:	5d                   	pop    %ebp
+ 45f:	c3                   	ret
+
+00000460 <main>:
+
+int
+main(int argc, char *argv[])
+{
+ 460:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 464:	83 e4 f0             	and    $0xfffffff0,%esp
+ 467:	ff 71 fc             	push   -0x4(%ecx)
+ 46a:	55                   	push   %ebp
+ 46b:	89 e5                	mov    %esp,%ebp
+ 46d:	51                   	push   %ecx
+ 46e:	83 ec 14             	sub    $0x14,%esp
+ 471:	89 c8                	mov    %ecx,%eax
+  int interval;
+
+  if(argc < 2){
+ 473:	83 38 01             	cmpl   $0x1,(%eax)
+ 476:	7f 0a                	jg     482 <main+0x22>
+    totals();
+ 478:	e8 cf fb ff ff       	call   4c <totals>
+    exit();
+ 47d:	e8 f5 04 00 00       	call   977 <exit>
+  }
+
+  interval = atoi(argv[1]);
+ 482:	8b 40 04             	mov    0x4(%eax),%eax
+ 485:	83 c0 04             	add    $0x4,%eax
+ 488:	8b 00                	mov    (%eax),%eax
+ 48a:	83 ec 0c             	sub    $0xc,%esp
+ 48d:	50                   	push   %eax
+ 48e:	e8 25 02 00 00       	call   6b8 <atoi>
+ 493:	83 c4 10             	add    $0x10,%esp
+ 496:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(interval <= 0){
+ 499:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 49d:	7f 17                	jg     4b6 <main+0x56>
+    printf(2, "usage: netstat [seconds]\n");
+ 49f:	83 ec 08             	sub    $0x8,%esp
+ 4a2:	68 b9 0f 00 00       	push   $0xfb9
+ 4a7:	6a 02                	push   $0x2
+ 4a9:	e8 85 06 00 00       	call   b33 <printf>
+ 4ae:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 4b1:	e8 c1 04 00 00       	call   977 <exit>
+  }
+  rates(interval);
+ 4b6:	83 ec 0c             	sub    $0xc,%esp
+ 4b9:	ff 75 f4             	push   -0xc(%ebp)
+ 4bc:	e8 c7 fc ff ff       	call   188 <rates>
+ 4c1:	83 c4 10             	add    $0x10,%esp
+  exit();
+ 4c4:	e8 ae 04 00 00       	call   977 <exit>
+
+000004c9 <stosb>:
+}
+
+int
+stat(char *n, struct stat *st)
+{
+  int fd;
+ 4c9:	55                   	push   %ebp
+ 4ca:	89 e5                	mov    %esp,%ebp
+ 4cc:	57                   	push   %edi
+ 4cd:	53                   	push   %ebx
+  int r;
+ 4ce:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 4d1:	8b 55 10             	mov    0x10(%ebp),%edx
+ 4d4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4d7:	89 cb                	mov    %ecx,%ebx
+ 4d9:	89 df                	mov    %ebx,%edi
+ 4db:	89 d1                	mov    %edx,%ecx
+ 4dd:	fc                   	cld
+ 4de:	f3 aa                	rep stos %al,%es:(%edi)
+ 4e0:	89 ca                	mov    %ecx,%edx
+ 4e2:	89 fb                	mov    %edi,%ebx
+ 4e4:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 4e7:	89 55 10             	mov    %edx,0x10(%ebp)
+
+  fd = open(n, O_RDONLY);
+  if(fd < 0)
+    return -1;
+ 4ea:	90                   	nop
+ 4eb:	5b                   	pop    %ebx
+ 4ec:	5f                   	pop    %edi
+ 4ed:	5d                   	pop    %ebp
+ 4ee:	c3                   	ret
+
+000004ef <strcpy>:
+{
+ 4ef:	55                   	push   %ebp
+ 4f0:	89 e5                	mov    %esp,%ebp
+ 4f2:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 4f5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4f8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 4fb:	90                   	nop
+ 4fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 4ff:	8d 42 01             	lea    0x1(%edx),%eax
+ 502:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 505:	8b 45 08             	mov    0x8(%ebp),%eax
+ 508:	8d 48 01             	lea    0x1(%eax),%ecx
+ 50b:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 50e:	0f b6 12             	movzbl (%edx),%edx
+ 511:	88 10                	mov    %dl,(%eax)
+ 513:	0f b6 00             	movzbl (%eax),%eax
+ 516:	84 c0                	test   %al,%al
+ 518:	75 e2                	jne    4fc <strcpy+0xd>
+  return os;
+ 51a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 51d:	c9                   	leave
+ 51e:	c3                   	ret
+
+0000051f <strlen>:
+{
+ 51f:	55                   	push   %ebp
+ 520:	89 e5                	mov    %esp,%ebp
+ 522:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 525:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 52c:	eb 04                	jmp    532 <strlen+0x13>
+ 52e:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 532:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 535:	8b 45 08             	mov    0x8(%ebp),%eax
+ 538:	01 d0                	add    %edx,%eax
+ 53a:	0f b6 00             	movzbl (%eax),%eax
+ 53d:	84 c0                	test   %al,%al
+ 53f:	75 ed                	jne    52e <strlen+0xf>
+  return n;
+ 541:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 544:	c9                   	leave
+ 545:	c3                   	ret
+
+00000546 <memset>:
+{
+ 546:	55                   	push   %ebp
+ 547:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 549:	8b 45 10             	mov    0x10(%ebp),%eax
+ 54c:	50                   	push   %eax
+ 54d:	ff 75 0c             	push   0xc(%ebp)
+ 550:	ff 75 08             	push   0x8(%ebp)
+ 553:	e8 71 ff ff ff       	call   4c9 <stosb>
+ 558:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 55b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 55e:	c9                   	leave
+ 55f:	c3                   	ret
+
+00000560 <strchr>:
+{
+ 560:	55                   	push   %ebp
+ 561:	89 e5                	mov    %esp,%ebp
+ 563:	83 ec 04             	sub    $0x4,%esp
+ 566:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 569:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 56c:	eb 14                	jmp    582 <strchr+0x22>
+    if(*s == c)
+ 56e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 571:	0f b6 00             	movzbl (%eax),%eax
+ 574:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 577:	75 05                	jne    57e <strchr+0x1e>
+      return (char*)s;
+ 579:	8b 45 08             	mov    0x8(%ebp),%eax
+ 57c:	eb 13                	jmp    591 <strchr+0x31>
+  for(; *s; s++)
+ 57e:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 582:	8b 45 08             	mov    0x8(%ebp),%eax
+ 585:	0f b6 00             	movzbl (%eax),%eax
+ 588:	84 c0                	test   %al,%al
+ 58a:	75 e2                	jne    56e <strchr+0xe>
+  return 0;
+ 58c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 591:	c9                   	leave
+ 592:	c3                   	ret
+
+00000593 <gets>:
+{
+ 593:	55                   	push   %ebp
+ 594:	89 e5                	mov    %esp,%ebp
+ 596:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 599:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 5a0:	eb 42                	jmp    5e4 <gets+0x51>
+    cc = read(0, &c, 1);
+ 5a2:	83 ec 04             	sub    $0x4,%esp
+ 5a5:	6a 01                	push   $0x1
+ 5a7:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 5aa:	50                   	push   %eax
+ 5ab:	6a 00                	push   $0x0
+ 5ad:	e8 dd 03 00 00       	call   98f <read>
+ 5b2:	83 c4 10             	add    $0x10,%esp
+ 5b5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 5b8:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 5bc:	7e 33                	jle    5f1 <gets+0x5e>
+    buf[i++] = c;
+ 5be:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5c1:	8d 50 01             	lea    0x1(%eax),%edx
+ 5c4:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 5c7:	89 c2                	mov    %eax,%edx
+ 5c9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5cc:	01 c2                	add    %eax,%edx
+ 5ce:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 5d2:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 5d4:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 5d8:	3c 0a                	cmp    $0xa,%al
+ 5da:	74 16                	je     5f2 <gets+0x5f>
+ 5dc:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 5e0:	3c 0d                	cmp    $0xd,%al
+ 5e2:	74 0e                	je     5f2 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 5e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5e7:	83 c0 01             	add    $0x1,%eax
+ 5ea:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 5ed:	7f b3                	jg     5a2 <gets+0xf>
+ 5ef:	eb 01                	jmp    5f2 <gets+0x5f>
+      break;
+ 5f1:	90                   	nop
+  buf[i] = '\0';
+ 5f2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 5f5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5f8:	01 d0                	add    %edx,%eax
+ 5fa:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 5fd:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 600:	c9                   	leave
+ 601:	c3                   	ret
+
+00000602 <stat>:
+{
+ 602:	55                   	push   %ebp
+ 603:	89 e5                	mov    %esp,%ebp
+ 605:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+ 608:	83 ec 08             	sub    $0x8,%esp
+ 60b:	6a 00                	push   $0x0
+ 60d:	ff 75 08             	push   0x8(%ebp)
+ 610:	e8 a2 03 00 00       	call   9b7 <open>
+ 615:	83 c4 10             	add    $0x10,%esp
+ 618:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 61b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 61f:	79 07                	jns    628 <stat+0x26>
+    return -1;
+ 621:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 626:	eb 25                	jmp    64d <stat+0x4b>
+  r = fstat(fd, st);
+ 628:	83 ec 08             	sub    $0x8,%esp
+ 62b:	ff 75 0c             	push   0xc(%ebp)
+ 62e:	ff 75 f4             	push   -0xc(%ebp)
+ 631:	e8 99 03 00 00       	call   9cf <fstat>
+ 636:	83 c4 10             	add    $0x10,%esp
+ 639:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 63c:	83 ec 0c             	sub    $0xc,%esp
+ 63f:	ff 75 f4             	push   -0xc(%ebp)
+ 642:	e8 58 03 00 00       	call   99f <close>
+ 647:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 64a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 64d:	c9                   	leave
+ 64e:	c3                   	ret
+
+0000064f <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 64f:	55                   	push   %ebp
+ 650:	89 e5                	mov    %esp,%ebp
+ 652:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+
+  dst = vdst;
+ 655:	8b 45 08             	mov    0x8(%ebp),%eax
+ 658:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 65b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 65e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 661:	eb 17                	jmp    67a <memmove+0x2b>
+    *dst++ = *src++;
+ 663:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 666:	8d 42 01             	lea    0x1(%edx),%eax
+ 669:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 66c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 66f:	8d 48 01             	lea    0x1(%eax),%ecx
+ 672:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 675:	0f b6 12             	movzbl (%edx),%edx
+ 678:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 67a:	8b 45 10             	mov    0x10(%ebp),%eax
+ 67d:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 680:	89 55 10             	mov    %edx,0x10(%ebp)
+ 683:	85 c0                	test   %eax,%eax
+ 685:	7f dc                	jg     663 <memmove+0x14>
+  return vdst;
+ 687:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 68a:	c9                   	leave
+ 68b:	c3                   	ret
+
+0000068c <cpuinfo>:
+ 68c:	55                   	push   %ebp
+ 68d:	89 e5                	mov    %esp,%ebp
+ 68f:	56                   	push   %esi
+ 690:	53                   	push   %ebx
+ 691:	8b 45 08             	mov    0x8(%ebp),%eax
+ 694:	ba 00 00 00 00       	mov    $0x0,%edx
+ 699:	89 d1                	mov    %edx,%ecx
+ 69b:	0f a2                	cpuid
+ 69d:	89 c6                	mov    %eax,%esi
+ 69f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6a2:	89 30                	mov    %esi,(%eax)
+ 6a4:	8b 45 10             	mov    0x10(%ebp),%eax
+ 6a7:	89 18                	mov    %ebx,(%eax)
+ 6a9:	8b 45 14             	mov    0x14(%ebp),%eax
+ 6ac:	89 08                	mov    %ecx,(%eax)
+ 6ae:	8b 45 18             	mov    0x18(%ebp),%eax
+ 6b1:	89 10                	mov    %edx,(%eax)
+ 6b3:	90                   	nop
+ 6b4:	5b                   	pop    %ebx
+ 6b5:	5e                   	pop    %esi
+ 6b6:	5d                   	pop    %ebp
+ 6b7:	c3                   	ret
+
+000006b8 <atoi>:
+{
+ 6b8:	55                   	push   %ebp
+ 6b9:	89 e5                	mov    %esp,%ebp
+ 6bb:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+ 6be:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 6c5:	eb 25                	jmp    6ec <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 6c7:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 6ca:	89 d0                	mov    %edx,%eax
+ 6cc:	c1 e0 02             	shl    $0x2,%eax
+ 6cf:	01 d0                	add    %edx,%eax
+ 6d1:	01 c0                	add    %eax,%eax
+ 6d3:	89 c1                	mov    %eax,%ecx
+ 6d5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6d8:	8d 50 01             	lea    0x1(%eax),%edx
+ 6db:	89 55 08             	mov    %edx,0x8(%ebp)
+ 6de:	0f b6 00             	movzbl (%eax),%eax
+ 6e1:	0f be c0             	movsbl %al,%eax
+ 6e4:	01 c8                	add    %ecx,%eax
+ 6e6:	83 e8 30             	sub    $0x30,%eax
+ 6e9:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 6ec:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6ef:	0f b6 00             	movzbl (%eax),%eax
+ 6f2:	3c 2f                	cmp    $0x2f,%al
+ 6f4:	7e 0a                	jle    700 <atoi+0x48>
+ 6f6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6f9:	0f b6 00             	movzbl (%eax),%eax
+ 6fc:	3c 39                	cmp    $0x39,%al
+ 6fe:	7e c7                	jle    6c7 <atoi+0xf>
+  return n;
+ 700:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 703:	c9                   	leave
+ 704:	c3                   	ret
+
+00000705 <strcmp>:
+{
+ 705:	55                   	push   %ebp
+ 706:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 708:	eb 08                	jmp    712 <strcmp+0xd>
+    p++, q++;
+ 70a:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 70e:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 712:	8b 45 08             	mov    0x8(%ebp),%eax
+ 715:	0f b6 00             	movzbl (%eax),%eax
+ 718:	84 c0                	test   %al,%al
+ 71a:	74 10                	je     72c <strcmp+0x27>
+ 71c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 71f:	0f b6 10             	movzbl (%eax),%edx
+ 722:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 725:	0f b6 00             	movzbl (%eax),%eax
+ 728:	38 c2                	cmp    %al,%dl
+ 72a:	74 de                	je     70a <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 72c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 72f:	0f b6 00             	movzbl (%eax),%eax
+ 732:	0f b6 d0             	movzbl %al,%edx
+ 735:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 738:	0f b6 00             	movzbl (%eax),%eax
+ 73b:	0f b6 c0             	movzbl %al,%eax
+ 73e:	29 c2                	sub    %eax,%edx
+ 740:	89 d0                	mov    %edx,%eax
+}
+ 742:	5d                   	pop    %ebp
+ 743:	c3                   	ret
+
+00000744 <udiv64>:
+{
+ 744:	55                   	push   %ebp
+ 745:	89 e5                	mov    %esp,%ebp
+ 747:	57                   	push   %edi
+ 748:	56                   	push   %esi
+ 749:	83 ec 38             	sub    $0x38,%esp
+ 74c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 74f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 752:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 755:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 758:	8b 45 10             	mov    0x10(%ebp),%eax
+ 75b:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 75e:	8b 45 14             	mov    0x14(%ebp),%eax
+ 761:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  q = r = 0;
+ 764:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 76b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 772:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 775:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 778:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 77b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 77e:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 785:	e9 85 00 00 00       	jmp    80f <udiv64+0xcb>
+    r = (r << 1) | ((n >> i) & 1);
+ 78a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 78d:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 790:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 794:	01 c0                	add    %eax,%eax
+ 796:	89 c6                	mov    %eax,%esi
+ 798:	89 d7                	mov    %edx,%edi
+ 79a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 79d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 7a0:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 7a3:	0f ad d0             	shrd   %cl,%edx,%eax
+ 7a6:	d3 ea                	shr    %cl,%edx
+ 7a8:	f6 c1 20             	test   $0x20,%cl
+ 7ab:	74 04                	je     7b1 <udiv64+0x6d>
+ 7ad:	89 d0                	mov    %edx,%eax
+ 7af:	31 d2                	xor    %edx,%edx
+ 7b1:	83 e0 01             	and    $0x1,%eax
+ 7b4:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 7b7:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+ 7be:	89 f0                	mov    %esi,%eax
+ 7c0:	89 fa                	mov    %edi,%edx
+ 7c2:	0b 45 c0             	or     -0x40(%ebp),%eax
+ 7c5:	0b 55 c4             	or     -0x3c(%ebp),%edx
+ 7c8:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 7cb:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 7ce:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7d1:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 7d4:	3b 45 c8             	cmp    -0x38(%ebp),%eax
+ 7d7:	89 d0                	mov    %edx,%eax
+ 7d9:	1b 45 cc             	sbb    -0x34(%ebp),%eax
+ 7dc:	72 2d                	jb     80b <udiv64+0xc7>
+      r -= d;
+ 7de:	8b 45 c8             	mov    -0x38(%ebp),%eax
+ 7e1:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 7e4:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 7e7:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64_t)1 << i;
+ 7ea:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 7ed:	b8 01 00 00 00       	mov    $0x1,%eax
+ 7f2:	ba 00 00 00 00       	mov    $0x0,%edx
+ 7f7:	0f a5 c2             	shld   %cl,%eax,%edx
+ 7fa:	d3 e0                	shl    %cl,%eax
+ 7fc:	f6 c1 20             	test   $0x20,%cl
+ 7ff:	74 04                	je     805 <udiv64+0xc1>
+ 801:	89 c2                	mov    %eax,%edx
+ 803:	31 c0                	xor    %eax,%eax
+ 805:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 808:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 80b:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 80f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 813:	0f 89 71 ff ff ff    	jns    78a <udiv64+0x46>
+  if(rem)
+ 819:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+ 81d:	74 0e                	je     82d <udiv64+0xe9>
+    *rem = r;
+ 81f:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 822:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 825:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 828:	89 01                	mov    %eax,(%ecx)
+ 82a:	89 51 04             	mov    %edx,0x4(%ecx)
+  return q;
+ 82d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 830:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 833:	83 c4 38             	add    $0x38,%esp
+ 836:	5e                   	pop    %esi
+ 837:	5f                   	pop    %edi
+ 838:	5d                   	pop    %ebp
+ 839:	c3                   	ret
+
+0000083a <crc32cinit>:
+{
+ 83a:	55                   	push   %ebp
+ 83b:	89 e5                	mov    %esp,%ebp
+ 83d:	83 ec 20             	sub    $0x20,%esp
+  for(i = 0; i < 256; i++){
+ 840:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 847:	eb 4c                	jmp    895 <crc32cinit+0x5b>
+    r = i;
+ 849:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 84c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+ 84f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+ 856:	eb 26                	jmp    87e <crc32cinit+0x44>
+      r = (r >> 1) ^ ((r & 1) ? CRC32C_POLY : 0);
+ 858:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 85b:	d1 e8                	shr    %eax
+ 85d:	89 c2                	mov    %eax,%edx
+ 85f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 862:	83 e0 01             	and    $0x1,%eax
+ 865:	85 c0                	test   %eax,%eax
+ 867:	74 07                	je     870 <crc32cinit+0x36>
+ 869:	b8 78 3b f6 82       	mov    $0x82f63b78,%eax
+ 86e:	eb 05                	jmp    875 <crc32cinit+0x3b>
+ 870:	b8 00 00 00 00       	mov    $0x0,%eax
+ 875:	31 d0                	xor    %edx,%eax
+ 877:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+ 87a:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+ 87e:	83 7d f8 07          	cmpl   $0x7,-0x8(%ebp)
+ 882:	76 d4                	jbe    858 <crc32cinit+0x1e>
+    crc32ctab[i] = r;
+ 884:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 887:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 88a:	89 14 85 80 13 00 00 	mov    %edx,0x1380(,%eax,4)
+  for(i = 0; i < 256; i++){
+ 891:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 895:	81 7d fc ff 00 00 00 	cmpl   $0xff,-0x4(%ebp)
+ 89c:	76 ab                	jbe    849 <crc32cinit+0xf>
+  cpuinfo(1, &a, &b, &c, &d);
+ 89e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 8a1:	50                   	push   %eax
+ 8a2:	8d 45 e8             	lea    -0x18(%ebp),%eax
+ 8a5:	50                   	push   %eax
+ 8a6:	8d 45 ec             	lea    -0x14(%ebp),%eax
+ 8a9:	50                   	push   %eax
+ 8aa:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 8ad:	50                   	push   %eax
+ 8ae:	6a 01                	push   $0x1
+ 8b0:	e8 d7 fd ff ff       	call   68c <cpuinfo>
+ 8b5:	83 c4 14             	add    $0x14,%esp
+  crc32chw = (c & CPUID_SSE42) != 0;
+ 8b8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8bb:	25 00 00 10 00       	and    $0x100000,%eax
+ 8c0:	85 c0                	test   %eax,%eax
+ 8c2:	0f 95 c0             	setne  %al
+ 8c5:	0f b6 c0             	movzbl %al,%eax
+ 8c8:	a3 54 13 00 00       	mov    %eax,0x1354
+}
+ 8cd:	90                   	nop
+ 8ce:	c9                   	leave
+ 8cf:	c3                   	ret
+
+000008d0 <crc32c>:
+{
+ 8d0:	55                   	push   %ebp
+ 8d1:	89 e5                	mov    %esp,%ebp
+ 8d3:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s = p;
+ 8d6:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 8d9:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(crc32chw < 0)
+ 8dc:	a1 54 13 00 00       	mov    0x1354,%eax
+ 8e1:	85 c0                	test   %eax,%eax
+ 8e3:	79 05                	jns    8ea <crc32c+0x1a>
+    crc32cinit();
+ 8e5:	e8 50 ff ff ff       	call   83a <crc32cinit>
+  crc = ~crc;
+ 8ea:	f7 55 08             	notl   0x8(%ebp)
+  if(crc32chw){
+ 8ed:	a1 54 13 00 00       	mov    0x1354,%eax
+ 8f2:	85 c0                	test   %eax,%eax
+ 8f4:	74 6c                	je     962 <crc32c+0x92>
+    for(; n >= 4; n -= 4, s += 4)
+ 8f6:	eb 18                	jmp    910 <crc32c+0x40>
+      asm("crc32l %1, %0" : "+r" (crc) : "rm" (*(const uint*)s));
+ 8f8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8fb:	8b 10                	mov    (%eax),%edx
+ 8fd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 900:	f2 0f 38 f1 c2       	crc32  %edx,%eax
+ 905:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n >= 4; n -= 4, s += 4)
+ 908:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+ 90c:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+ 910:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+ 914:	77 e2                	ja     8f8 <crc32c+0x28>
+    for(; n > 0; n--, s++)
+ 916:	eb 19                	jmp    931 <crc32c+0x61>
+      asm("crc32b %1, %0" : "+r" (crc) : "qm" (*s));
+ 918:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 91b:	0f b6 10             	movzbl (%eax),%edx
+ 91e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 921:	f2 0f 38 f0 c2       	crc32  %dl,%eax
+ 926:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+ 929:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+ 92d:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 931:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 935:	75 e1                	jne    918 <crc32c+0x48>
+ 937:	eb 2f                	jmp    968 <crc32c+0x98>
+      crc = crc32ctab[(crc ^ *s) & 0xff] ^ (crc >> 8);
+ 939:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 93c:	0f b6 00             	movzbl (%eax),%eax
+ 93f:	0f b6 c0             	movzbl %al,%eax
+ 942:	33 45 08             	xor    0x8(%ebp),%eax
+ 945:	0f b6 c0             	movzbl %al,%eax
+ 948:	8b 04 85 80 13 00 00 	mov    0x1380(,%eax,4),%eax
+ 94f:	8b 55 08             	mov    0x8(%ebp),%edx
+ 952:	c1 ea 08             	shr    $0x8,%edx
+ 955:	31 d0                	xor    %edx,%eax
+ 957:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+ 95a:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+ 95e:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 962:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 966:	75 d1                	jne    939 <crc32c+0x69>
+  return ~crc;
+ 968:	8b 45 08             	mov    0x8(%ebp),%eax
+ 96b:	f7 d0                	not    %eax
+}
+ 96d:	c9                   	leave
+ 96e:	c3                   	ret
+
+0000096f <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 96f:	b8 01 00 00 00       	mov    $0x1,%eax
+ 974:	cd 40                	int    $0x40
+ 976:	c3                   	ret
+
+00000977 <exit>:
+SYSCALL(exit)
+ 977:	b8 02 00 00 00       	mov    $0x2,%eax
+ 97c:	cd 40                	int    $0x40
+ 97e:	c3                   	ret
+
+0000097f <wait>:
+SYSCALL(wait)
+ 97f:	b8 03 00 00 00       	mov    $0x3,%eax
+ 984:	cd 40                	int    $0x40
+ 986:	c3                   	ret
+
+00000987 <pipe>:
+SYSCALL(pipe)
+ 987:	b8 04 00 00 00       	mov    $0x4,%eax
+ 98c:	cd 40                	int    $0x40
+ 98e:	c3                   	ret
+
+0000098f <read>:
+SYSCALL(read)
+ 98f:	b8 05 00 00 00       	mov    $0x5,%eax
+ 994:	cd 40                	int    $0x40
+ 996:	c3                   	ret
+
+00000997 <write>:
+SYSCALL(write)
+ 997:	b8 10 00 00 00       	mov    $0x10,%eax
+ 99c:	cd 40                	int    $0x40
+ 99e:	c3                   	ret
+
+0000099f <close>:
+SYSCALL(close)
+ 99f:	b8 15 00 00 00       	mov    $0x15,%eax
+ 9a4:	cd 40                	int    $0x40
+ 9a6:	c3                   	ret
+
+000009a7 <kill>:
+SYSCALL(kill)
+ 9a7:	b8 06 00 00 00       	mov    $0x6,%eax
+ 9ac:	cd 40                	int    $0x40
+ 9ae:	c3                   	ret
+
+000009af <exec>:
+SYSCALL(exec)
+ 9af:	b8 07 00 00 00       	mov    $0x7,%eax
+ 9b4:	cd 40                	int    $0x40
+ 9b6:	c3                   	ret
+
+000009b7 <open>:
+SYSCALL(open)
+ 9b7:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 9bc:	cd 40                	int    $0x40
+ 9be:	c3                   	ret
+
+000009bf <mknod>:
+SYSCALL(mknod)
+ 9bf:	b8 11 00 00 00       	mov    $0x11,%eax
+ 9c4:	cd 40                	int    $0x40
+ 9c6:	c3                   	ret
+
+000009c7 <unlink>:
+SYSCALL(unlink)
+ 9c7:	b8 12 00 00 00       	mov    $0x12,%eax
+ 9cc:	cd 40                	int    $0x40
+ 9ce:	c3                   	ret
+
+000009cf <fstat>:
+SYSCALL(fstat)
+ 9cf:	b8 08 00 00 00       	mov    $0x8,%eax
+ 9d4:	cd 40                	int    $0x40
+ 9d6:	c3                   	ret
+
+000009d7 <link>:
+SYSCALL(link)
+ 9d7:	b8 13 00 00 00       	mov    $0x13,%eax
+ 9dc:	cd 40                	int    $0x40
+ 9de:	c3                   	ret
+
+000009df <mkdir>:
+SYSCALL(mkdir)
+ 9df:	b8 14 00 00 00       	mov    $0x14,%eax
+ 9e4:	cd 40                	int    $0x40
+ 9e6:	c3                   	ret
+
+000009e7 <chdir>:
+SYSCALL(chdir)
+ 9e7:	b8 09 00 00 00       	mov    $0x9,%eax
+ 9ec:	cd 40                	int    $0x40
+ 9ee:	c3                   	ret
+
+000009ef <dup>:
+SYSCALL(dup)
+ 9ef:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 9f4:	cd 40                	int    $0x40
+ 9f6:	c3                   	ret
+
+000009f7 <getpid>:
+SYSCALL(getpid)
+ 9f7:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 9fc:	cd 40                	int    $0x40
+ 9fe:	c3                   	ret
+
+000009ff <sbrk>:
+SYSCALL(sbrk)
+ 9ff:	b8 0c 00 00 00       	mov    $0xc,%eax
+ a04:	cd 40                	int    $0x40
+ a06:	c3                   	ret
+
+00000a07 <sleep>:
+SYSCALL(sleep)
+ a07:	b8 0d 00 00 00       	mov    $0xd,%eax
+ a0c:	cd 40                	int    $0x40
+ a0e:	c3                   	ret
+
+00000a0f <uptime>:
+SYSCALL(uptime)
+ a0f:	b8 0e 00 00 00       	mov    $0xe,%eax
+ a14:	cd 40                	int    $0x40
+ a16:	c3                   	ret
+
+00000a17 <arp>:
+SYSCALL(arp)
+ a17:	b8 16 00 00 00       	mov    $0x16,%eax
+ a1c:	cd 40                	int    $0x40
+ a1e:	c3                   	ret
+
+00000a1f <ifstat>:
+SYSCALL(ifstat)
+ a1f:	b8 17 00 00 00       	mov    $0x17,%eax
+ a24:	cd 40                	int    $0x40
+ a26:	c3                   	ret
+
+00000a27 <pcapctl>:
+SYSCALL(pcapctl)
+ a27:	b8 18 00 00 00       	mov    $0x18,%eax
+ a2c:	cd 40                	int    $0x40
+ a2e:	c3                   	ret
+
+00000a2f <pcapread>:
+SYSCALL(pcapread)
+ a2f:	b8 19 00 00 00       	mov    $0x19,%eax
+ a34:	cd 40                	int    $0x40
+ a36:	c3                   	ret
+
+00000a37 <bpfattach>:
+SYSCALL(bpfattach)
+ a37:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ a3c:	cd 40                	int    $0x40
+ a3e:	c3                   	ret
+
+00000a3f <pktgen>:
+SYSCALL(pktgen)
+ a3f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ a44:	cd 40                	int    $0x40
+ a46:	c3                   	ret
+
+00000a47 <reflect>:
+SYSCALL(reflect)
+ a47:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ a4c:	cd 40                	int    $0x40
+ a4e:	c3                   	ret
+
+00000a4f <brctl>:
+SYSCALL(brctl)
+ a4f:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ a54:	cd 40                	int    $0x40
+ a56:	c3                   	ret
+
+00000a57 <hostopen>:
+SYSCALL(hostopen)
+ a57:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ a5c:	cd 40                	int    $0x40
+ a5e:	c3                   	ret
+
+00000a5f <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ a5f:	55                   	push   %ebp
+ a60:	89 e5                	mov    %esp,%ebp
+ a62:	83 ec 18             	sub    $0x18,%esp
+ a65:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a68:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ a6b:	83 ec 04             	sub    $0x4,%esp
+ a6e:	6a 01                	push   $0x1
+ a70:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ a73:	50                   	push   %eax
+ a74:	ff 75 08             	push   0x8(%ebp)
+ a77:	e8 1b ff ff ff       	call   997 <write>
+ a7c:	83 c4 10             	add    $0x10,%esp
+}
+ a7f:	90                   	nop
+ a80:	c9                   	leave
+ a81:	c3                   	ret
+
+00000a82 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ a82:	55                   	push   %ebp
+ a83:	89 e5                	mov    %esp,%ebp
+ a85:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ a88:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ a8f:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ a93:	74 17                	je     aac <printint+0x2a>
+ a95:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ a99:	79 11                	jns    aac <printint+0x2a>
+    neg = 1;
+ a9b:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ aa2:	8b 45 0c             	mov    0xc(%ebp),%eax
+ aa5:	f7 d8                	neg    %eax
+ aa7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ aaa:	eb 06                	jmp    ab2 <printint+0x30>
+  } else {
+    x = xx;
+ aac:	8b 45 0c             	mov    0xc(%ebp),%eax
+ aaf:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ ab2:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ ab9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ abc:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ abf:	ba 00 00 00 00       	mov    $0x0,%edx
+ ac4:	f7 f1                	div    %ecx
+ ac6:	89 d1                	mov    %edx,%ecx
+ ac8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ acb:	8d 50 01             	lea    0x1(%eax),%edx
+ ace:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ ad1:	0f b6 91 58 13 00 00 	movzbl 0x1358(%ecx),%edx
+ ad8:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ adc:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ adf:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ ae2:	ba 00 00 00 00       	mov    $0x0,%edx
+ ae7:	f7 f1                	div    %ecx
+ ae9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ aec:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ af0:	75 c7                	jne    ab9 <printint+0x37>
+  if(neg)
+ af2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ af6:	74 2d                	je     b25 <printint+0xa3>
+    buf[i++] = '-';
+ af8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ afb:	8d 50 01             	lea    0x1(%eax),%edx
+ afe:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ b01:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ b06:	eb 1d                	jmp    b25 <printint+0xa3>
+    putc(fd, buf[i]);
+ b08:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ b0b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b0e:	01 d0                	add    %edx,%eax
+ b10:	0f b6 00             	movzbl (%eax),%eax
+ b13:	0f be c0             	movsbl %al,%eax
+ b16:	83 ec 08             	sub    $0x8,%esp
+ b19:	50                   	push   %eax
+ b1a:	ff 75 08             	push   0x8(%ebp)
+ b1d:	e8 3d ff ff ff       	call   a5f <putc>
+ b22:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ b25:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ b29:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b2d:	79 d9                	jns    b08 <printint+0x86>
+}
+ b2f:	90                   	nop
+ b30:	90                   	nop
+ b31:	c9                   	leave
+ b32:	c3                   	ret
+
+00000b33 <printf>:
+
+// Print to the given fd. Only understands %d, %u, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ b33:	55                   	push   %ebp
+ b34:	89 e5                	mov    %esp,%ebp
+ b36:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ b39:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ b40:	8d 45 0c             	lea    0xc(%ebp),%eax
+ b43:	83 c0 04             	add    $0x4,%eax
+ b46:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ b49:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ b50:	e9 7d 01 00 00       	jmp    cd2 <printf+0x19f>
+    c = fmt[i] & 0xff;
+ b55:	8b 55 0c             	mov    0xc(%ebp),%edx
+ b58:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b5b:	01 d0                	add    %edx,%eax
+ b5d:	0f b6 00             	movzbl (%eax),%eax
+ b60:	0f be c0             	movsbl %al,%eax
+ b63:	25 ff 00 00 00       	and    $0xff,%eax
+ b68:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ b6b:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ b6f:	75 2c                	jne    b9d <printf+0x6a>
+      if(c == '%'){
+ b71:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ b75:	75 0c                	jne    b83 <printf+0x50>
+        state = '%';
+ b77:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ b7e:	e9 4b 01 00 00       	jmp    cce <printf+0x19b>
+      } else {
+        putc(fd, c);
+ b83:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ b86:	0f be c0             	movsbl %al,%eax
+ b89:	83 ec 08             	sub    $0x8,%esp
+ b8c:	50                   	push   %eax
+ b8d:	ff 75 08             	push   0x8(%ebp)
+ b90:	e8 ca fe ff ff       	call   a5f <putc>
+ b95:	83 c4 10             	add    $0x10,%esp
+ b98:	e9 31 01 00 00       	jmp    cce <printf+0x19b>
+      }
+    } else if(state == '%'){
+ b9d:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ ba1:	0f 85 27 01 00 00    	jne    cce <printf+0x19b>
+      if(c == 'd'){
+ ba7:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ bab:	75 1e                	jne    bcb <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ bad:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ bb0:	8b 00                	mov    (%eax),%eax
+ bb2:	6a 01                	push   $0x1
+ bb4:	6a 0a                	push   $0xa
+ bb6:	50                   	push   %eax
+ bb7:	ff 75 08             	push   0x8(%ebp)
+ bba:	e8 c3 fe ff ff       	call   a82 <printint>
+ bbf:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ bc2:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ bc6:	e9 fc 00 00 00       	jmp    cc7 <printf+0x194>
+      } else if(c == 'u'){
+ bcb:	83 7d e4 75          	cmpl   $0x75,-0x1c(%ebp)
+ bcf:	75 1e                	jne    bef <printf+0xbc>
+        printint(fd, *ap, 10, 0);
+ bd1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ bd4:	8b 00                	mov    (%eax),%eax
+ bd6:	6a 00                	push   $0x0
+ bd8:	6a 0a                	push   $0xa
+ bda:	50                   	push   %eax
+ bdb:	ff 75 08             	push   0x8(%ebp)
+ bde:	e8 9f fe ff ff       	call   a82 <printint>
+ be3:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ be6:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ bea:	e9 d8 00 00 00       	jmp    cc7 <printf+0x194>
+      } else if(c == 'x' || c == 'p'){
+ bef:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ bf3:	74 06                	je     bfb <printf+0xc8>
+ bf5:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ bf9:	75 1e                	jne    c19 <printf+0xe6>
+        printint(fd, *ap, 16, 0);
+ bfb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ bfe:	8b 00                	mov    (%eax),%eax
+ c00:	6a 00                	push   $0x0
+ c02:	6a 10                	push   $0x10
+ c04:	50                   	push   %eax
+ c05:	ff 75 08             	push   0x8(%ebp)
+ c08:	e8 75 fe ff ff       	call   a82 <printint>
+ c0d:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ c10:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ c14:	e9 ae 00 00 00       	jmp    cc7 <printf+0x194>
+      } else if(c == 's'){
+ c19:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ c1d:	75 43                	jne    c62 <printf+0x12f>
+        s = (char*)*ap;
+ c1f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ c22:	8b 00                	mov    (%eax),%eax
+ c24:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ c27:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ c2b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c2f:	75 25                	jne    c56 <printf+0x123>
+          s = "(null)";
+ c31:	c7 45 f4 d3 0f 00 00 	movl   $0xfd3,-0xc(%ebp)
+        while(*s != 0){
+ c38:	eb 1c                	jmp    c56 <printf+0x123>
+          putc(fd, *s);
+ c3a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c3d:	0f b6 00             	movzbl (%eax),%eax
+ c40:	0f be c0             	movsbl %al,%eax
+ c43:	83 ec 08             	sub    $0x8,%esp
+ c46:	50                   	push   %eax
+ c47:	ff 75 08             	push   0x8(%ebp)
+ c4a:	e8 10 fe ff ff       	call   a5f <putc>
+ c4f:	83 c4 10             	add    $0x10,%esp
+          s++;
+ c52:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ c56:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c59:	0f b6 00             	movzbl (%eax),%eax
+ c5c:	84 c0                	test   %al,%al
+ c5e:	75 da                	jne    c3a <printf+0x107>
+ c60:	eb 65                	jmp    cc7 <printf+0x194>
+        }
+      } else if(c == 'c'){
+ c62:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ c66:	75 1d                	jne    c85 <printf+0x152>
+        putc(fd, *ap);
+ c68:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ c6b:	8b 00                	mov    (%eax),%eax
+ c6d:	0f be c0             	movsbl %al,%eax
+ c70:	83 ec 08             	sub    $0x8,%esp
+ c73:	50                   	push   %eax
+ c74:	ff 75 08             	push   0x8(%ebp)
+ c77:	e8 e3 fd ff ff       	call   a5f <putc>
+ c7c:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ c7f:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ c83:	eb 42                	jmp    cc7 <printf+0x194>
+      } else if(c == '%'){
+ c85:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ c89:	75 17                	jne    ca2 <printf+0x16f>
+        putc(fd, c);
+ c8b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ c8e:	0f be c0             	movsbl %al,%eax
+ c91:	83 ec 08             	sub    $0x8,%esp
+ c94:	50                   	push   %eax
+ c95:	ff 75 08             	push   0x8(%ebp)
+ c98:	e8 c2 fd ff ff       	call   a5f <putc>
+ c9d:	83 c4 10             	add    $0x10,%esp
+ ca0:	eb 25                	jmp    cc7 <printf+0x194>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ ca2:	83 ec 08             	sub    $0x8,%esp
+ ca5:	6a 25                	push   $0x25
+ ca7:	ff 75 08             	push   0x8(%ebp)
+ caa:	e8 b0 fd ff ff       	call   a5f <putc>
+ caf:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ cb2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ cb5:	0f be c0             	movsbl %al,%eax
+ cb8:	83 ec 08             	sub    $0x8,%esp
+ cbb:	50                   	push   %eax
+ cbc:	ff 75 08             	push   0x8(%ebp)
+ cbf:	e8 9b fd ff ff       	call   a5f <putc>
+ cc4:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ cc7:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ cce:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ cd2:	8b 55 0c             	mov    0xc(%ebp),%edx
+ cd5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cd8:	01 d0                	add    %edx,%eax
+ cda:	0f b6 00             	movzbl (%eax),%eax
+ cdd:	84 c0                	test   %al,%al
+ cdf:	0f 85 70 fe ff ff    	jne    b55 <printf+0x22>
+    }
+  }
+}
+ ce5:	90                   	nop
+ ce6:	90                   	nop
+ ce7:	c9                   	leave
+ ce8:	c3                   	ret
+
+00000ce9 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ ce9:	55                   	push   %ebp
+ cea:	89 e5                	mov    %esp,%ebp
+ cec:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ cef:	8b 45 08             	mov    0x8(%ebp),%eax
+ cf2:	83 e8 08             	sub    $0x8,%eax
+ cf5:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ cf8:	a1 88 17 00 00       	mov    0x1788,%eax
+ cfd:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ d00:	eb 24                	jmp    d26 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d02:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d05:	8b 00                	mov    (%eax),%eax
+ d07:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ d0a:	72 12                	jb     d1e <free+0x35>
+ d0c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d0f:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ d12:	72 24                	jb     d38 <free+0x4f>
+ d14:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d17:	8b 00                	mov    (%eax),%eax
+ d19:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ d1c:	72 1a                	jb     d38 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d1e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d21:	8b 00                	mov    (%eax),%eax
+ d23:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ d26:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d29:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ d2c:	73 d4                	jae    d02 <free+0x19>
+ d2e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d31:	8b 00                	mov    (%eax),%eax
+ d33:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ d36:	73 ca                	jae    d02 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ d38:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d3b:	8b 40 04             	mov    0x4(%eax),%eax
+ d3e:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ d45:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d48:	01 c2                	add    %eax,%edx
+ d4a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d4d:	8b 00                	mov    (%eax),%eax
+ d4f:	39 c2                	cmp    %eax,%edx
+ d51:	75 24                	jne    d77 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ d53:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d56:	8b 50 04             	mov    0x4(%eax),%edx
+ d59:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d5c:	8b 00                	mov    (%eax),%eax
+ d5e:	8b 40 04             	mov    0x4(%eax),%eax
+ d61:	01 c2                	add    %eax,%edx
+ d63:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d66:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d69:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d6c:	8b 00                	mov    (%eax),%eax
+ d6e:	8b 10                	mov    (%eax),%edx
+ d70:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d73:	89 10                	mov    %edx,(%eax)
+ d75:	eb 0a                	jmp    d81 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ d77:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d7a:	8b 10                	mov    (%eax),%edx
+ d7c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d7f:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ d81:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d84:	8b 40 04             	mov    0x4(%eax),%eax
+ d87:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ d8e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d91:	01 d0                	add    %edx,%eax
+ d93:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ d96:	75 20                	jne    db8 <free+0xcf>
+    p->s.size += bp->s.size;
+ d98:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d9b:	8b 50 04             	mov    0x4(%eax),%edx
+ d9e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ da1:	8b 40 04             	mov    0x4(%eax),%eax
+ da4:	01 c2                	add    %eax,%edx
+ da6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ da9:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ dac:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ daf:	8b 10                	mov    (%eax),%edx
+ db1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ db4:	89 10                	mov    %edx,(%eax)
+ db6:	eb 08                	jmp    dc0 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ db8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ dbb:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ dbe:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ dc0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ dc3:	a3 88 17 00 00       	mov    %eax,0x1788
+}
+ dc8:	90                   	nop
+ dc9:	c9                   	leave
+ dca:	c3                   	ret
+
+00000dcb <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ dcb:	55                   	push   %ebp
+ dcc:	89 e5                	mov    %esp,%ebp
+ dce:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ dd1:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ dd8:	77 07                	ja     de1 <morecore+0x16>
+    nu = 4096;
+ dda:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ de1:	8b 45 08             	mov    0x8(%ebp),%eax
+ de4:	c1 e0 03             	shl    $0x3,%eax
+ de7:	83 ec 0c             	sub    $0xc,%esp
+ dea:	50                   	push   %eax
+ deb:	e8 0f fc ff ff       	call   9ff <sbrk>
+ df0:	83 c4 10             	add    $0x10,%esp
+ df3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ df6:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ dfa:	75 07                	jne    e03 <morecore+0x38>
+    return 0;
+ dfc:	b8 00 00 00 00       	mov    $0x0,%eax
+ e01:	eb 26                	jmp    e29 <morecore+0x5e>
+  hp = (Header*)p;
+ e03:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e06:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ e09:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e0c:	8b 55 08             	mov    0x8(%ebp),%edx
+ e0f:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ e12:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e15:	83 c0 08             	add    $0x8,%eax
+ e18:	83 ec 0c             	sub    $0xc,%esp
+ e1b:	50                   	push   %eax
+ e1c:	e8 c8 fe ff ff       	call   ce9 <free>
+ e21:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ e24:	a1 88 17 00 00       	mov    0x1788,%eax
+}
+ e29:	c9                   	leave
+ e2a:	c3                   	ret
+
+00000e2b <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ e2b:	55                   	push   %ebp
+ e2c:	89 e5                	mov    %esp,%ebp
+ e2e:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ e31:	8b 45 08             	mov    0x8(%ebp),%eax
+ e34:	83 c0 07             	add    $0x7,%eax
+ e37:	c1 e8 03             	shr    $0x3,%eax
+ e3a:	83 c0 01             	add    $0x1,%eax
+ e3d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ e40:	a1 88 17 00 00       	mov    0x1788,%eax
+ e45:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ e48:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ e4c:	75 23                	jne    e71 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ e4e:	c7 45 f0 80 17 00 00 	movl   $0x1780,-0x10(%ebp)
+ e55:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e58:	a3 88 17 00 00       	mov    %eax,0x1788
+ e5d:	a1 88 17 00 00       	mov    0x1788,%eax
+ e62:	a3 80 17 00 00       	mov    %eax,0x1780
+    base.s.size = 0;
+ e67:	c7 05 84 17 00 00 00 	movl   $0x0,0x1784
+ e6e:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e71:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e74:	8b 00                	mov    (%eax),%eax
+ e76:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ e79:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e7c:	8b 40 04             	mov    0x4(%eax),%eax
+ e7f:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ e82:	72 4d                	jb     ed1 <malloc+0xa6>
+      if(p->s.size == nunits)
+ e84:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e87:	8b 40 04             	mov    0x4(%eax),%eax
+ e8a:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ e8d:	75 0c                	jne    e9b <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ e8f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e92:	8b 10                	mov    (%eax),%edx
+ e94:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e97:	89 10                	mov    %edx,(%eax)
+ e99:	eb 26                	jmp    ec1 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ e9b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e9e:	8b 40 04             	mov    0x4(%eax),%eax
+ ea1:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ ea4:	89 c2                	mov    %eax,%edx
+ ea6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ea9:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ eac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ eaf:	8b 40 04             	mov    0x4(%eax),%eax
+ eb2:	c1 e0 03             	shl    $0x3,%eax
+ eb5:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ eb8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ebb:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ ebe:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ ec1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ec4:	a3 88 17 00 00       	mov    %eax,0x1788
+      return (void*)(p + 1);
+ ec9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ecc:	83 c0 08             	add    $0x8,%eax
+ ecf:	eb 3b                	jmp    f0c <malloc+0xe1>
+    }
+    if(p == freep)
+ ed1:	a1 88 17 00 00       	mov    0x1788,%eax
+ ed6:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ ed9:	75 1e                	jne    ef9 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ edb:	83 ec 0c             	sub    $0xc,%esp
+ ede:	ff 75 ec             	push   -0x14(%ebp)
+ ee1:	e8 e5 fe ff ff       	call   dcb <morecore>
+ ee6:	83 c4 10             	add    $0x10,%esp
+ ee9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ eec:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ef0:	75 07                	jne    ef9 <malloc+0xce>
+        return 0;
+ ef2:	b8 00 00 00 00       	mov    $0x0,%eax
+ ef7:	eb 13                	jmp    f0c <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ef9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ efc:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ eff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ f02:	8b 00                	mov    (%eax),%eax
+ f04:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ f07:	e9 6d ff ff ff       	jmp    e79 <malloc+0x4e>
+  }
+}
+ f0c:	c9                   	leave
+ f0d:	c3                   	ret
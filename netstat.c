@@ -0,0 +1,118 @@
+// netstat: print network interface counters.
+//
+//   netstat           counters of every interface
+//   netstat n         every n seconds, per-second rates over the interval
+
+#include "param.h"
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "ifstat.h"
+
+#define NIF 4   // interfaces followed in rate mode
+
+static char *qname[NIC_NQUEUE] = { "rx", "tx" };
+
+static void
+printmac(uchar *mac)
+{
+  int i;
+
+  for(i = 0; i < 6; i++)
+    printf(1, i ? ":%x" : "%x", mac[i]);
+}
+
+static void
+totals(void)
+{
+  struct ifstat st;
+  struct ifqstat *q;
+  int i, j;
+
+  for(i = 0; ifstat(i, &st) == 0; i++){
+    printf(1, "%s ", st.name);
+    printmac(st.mac);
+    printf(1, "\n");
+    for(j = 0; j < NIC_NQUEUE; j++){
+      q = &st.q[j];
+      printf(1, "  %s: packets %u bytes %u drops %u ringfull %u notifies %u intrs %u\n",
+             qname[j], q->packets, q->bytes, q->drops, q->ringfull,
+             q->notifies, q->intrs);
+    }
+  }
+  if(i == 0)
+    printf(1, "netstat: no interfaces\n");
+}
+
+// Per-second rate of a counter that went from a to b in t ticks.
+// The counters wrap, so only their difference is meaningful.
+static uint
+rate(uint a, uint b, uint t)
+{
+  uint d = b - a;
+
+  return d / t * HZ + d % t * HZ / t;
+}
+
+static void
+rates(int interval)
+{
+  struct ifstat old[NIF], cur;
+  struct ifqstat *o, *n;
+  int i, j, nif;
+  uint t0, t1;
+
+  nif = 0;
+  while(nif < NIF && ifstat(nif, &old[nif]) == 0)
+    nif++;
+  if(nif == 0){
+    printf(1, "netstat: no interfaces\n");
+    return;
+  }
+  t0 = uptime();
+
+  for(;;){
+    sleep(interval * HZ);
+    t1 = uptime();
+    if(t1 == t0)
+      continue;
+    for(i = 0; i < nif; i++){
+      if(ifstat(i, &cur) < 0)
+        continue;
+      printf(1, "%s", cur.name);
+      for(j = 0; j < NIC_NQUEUE; j++){
+        o = &old[i].q[j];
+        n = &cur.q[j];
+        printf(1, "  %s %u pkt/s %u B/s %u drop/s %u notify/s %u intr/s",
+               qname[j],
+               rate(o->packets, n->packets, t1 - t0),
+               rate(o->bytes, n->bytes, t1 - t0),
+               rate(o->drops, n->drops, t1 - t0),
+               rate(o->notifies, n->notifies, t1 - t0),
+               rate(o->intrs, n->intrs, t1 - t0));
+      }
+      printf(1, "\n");
+      old[i] = cur;
+    }
+    t0 = t1;
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  int interval;
+
+  if(argc < 2){
+    totals();
+    exit();
+  }
+
+  interval = atoi(argv[1]);
+  if(interval <= 0){
+    printf(2, "usage: netstat [seconds]\n");
+    exit();
+  }
+  rates(interval);
+  exit();
+}
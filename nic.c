@@ -1,23 +1,98 @@
-#include "nic.h"
+#include "types.h"
 #include "defs.h"
+#include "spinlock.h"
+#include "nic.h"
+
+struct nic_device nic_devices[NNIC];
+int nnic;
 
 int get_device(char* interface, struct nic_device** nd) {
   cprintf("get device for interface=%s\n", interface);
+
+  for(int i = 0; i < nnic; i++) {
+    if(strncmp(nic_devices[i].name, interface, IFNAMSIZ) == 0) {
+      *nd = &nic_devices[i];
+      return 0;
+    }
+  }
+
   /**
-   *TODO: Use interface name to fetch device details
-   *from a table of loaded devices.
-   *
-   * For now, since we have only one device loaded at a time,
-   * this will suffice
+   * Unknown names fall back to the first loaded device, which is
+   * what callers relied on while only one device could be loaded.
    */
-   if(nic_devices[0].send_packet == 0 || nic_devices[0].recv_packet == 0) {
-     return -1;
-   }
-   *nd = &nic_devices[0];
+  if(nnic == 0 || nic_devices[0].send_packet == 0 || nic_devices[0].recv_packet == 0) {
+    return -1;
+  }
+  *nd = &nic_devices[0];
 
-   return 0;
+  return 0;
 }
 
-void register_device(struct nic_device nd) {
-  nic_devices[0] = nd;
+struct nic_device* register_device(struct nic_device nd) {
+  struct nic_device *slot;
+
+  if(nnic == NNIC)
+    panic("register_device: too many NICs");
+
+  slot = &nic_devices[nnic];
+  *slot = nd;
+  memset(slot->stats, 0, sizeof(slot->stats));
+  bpf_hookinit(&slot->filter, "nicfilter");
+  safestrcpy(slot->name, "eth0", IFNAMSIZ);
+  slot->name[3] = '0' + nnic;
+  nnic++;
+
+  return slot;
+}
+
+/**
+ * Drivers hand every received frame that passed the interface
+ * filter to nic_rx from their interrupt handler. The frame is only
+ * valid until nic_rx returns.
+ */
+void nic_rx(struct nic_device* nd, uint8_t* pkt, uint16_t length) {
+  if(bridge_input(nd, pkt, length))
+    return;
+  pktgen_rx(nd, pkt, length);
+}
+
+/**
+ * Returns this cpu's counters for queue `queue` of nd. The caller
+ * must have interrupts disabled so it can't move to another cpu
+ * while it updates them.
+ */
+struct ifqstat* nic_qstats(struct nic_device* nd, int queue) {
+  return &nd->stats[cpuid()].q[queue];
+}
+
+/**
+ * Sums the per-cpu counters of interface `index` into st. The sum
+ * is not atomic with respect to the hot path; it can be off by the
+ * packets in flight, which is fine for rate computation.
+ */
+int nic_getstat(int index, struct ifstat* st) {
+  struct nic_device *nd;
+  struct ifqstat *from, *to;
+
+  if(index < 0 || index >= nnic)
+    return -1;
+  nd = &nic_devices[index];
+
+  memset(st, 0, sizeof(*st));
+  safestrcpy(st->name, nd->name, IFNAMSIZ);
+  memmove(st->mac, nd->mac_addr, 6);
+  for(int c = 0; c < NCPU; c++) {
+    for(int q = 0; q < NIC_NQUEUE; q++) {
+      from = &nd->stats[c].q[q];
+      to = &st->q[q];
+      to->packets += from->packets;
+      to->bytes += from->bytes;
+      to->drops += from->drops;
+      to->ringfull += from->ringfull;
+      to->notifies += from->notifies;
+      to->intrs += from->intrs;
+    }
+  }
+
+  return 0;
 }
@@ -7,21 +7,46 @@
  */
 
 #include "types.h"
+#include "param.h"
 #include "arp_frame.h"
+#include "ifstat.h"
+
+// Each cpu keeps its own copy of a NIC's queue counters. The copies are
+// cache line aligned so the hot path never writes a line another cpu
+// is also writing; readers sum them up in nic_getstat().
+struct nic_pcpu_stats {
+  struct ifqstat q[NIC_NQUEUE];
+} __attribute__((aligned(64)));
+
+// A packet filter attachment point, see bpf.c. The program is
+// swapped and run under lock.
+struct bpf_hook {
+  struct spinlock lock;
+  struct bpf_prog *prog;
+};
 
 //Generic NIC device driver container
 struct nic_device {
   void *driver;
+  char name[IFNAMSIZ];
   uint8_t mac_addr[6];
   void (*send_packet) (void *driver, uint8_t* pkt, uint16_t length);
   void (*recv_packet) (void *driver, uint8_t* pkt, uint16_t length);
+  struct bpf_hook filter;  // run on received frames, 0 drops them
+  int reflect;             // send received frames back, see pktgen.c
+  struct nic_pcpu_stats stats[NCPU];
 };
 
+#define NNIC 4  // maximum number of loaded NIC devices
+
 //Holds the instances of nic_devices for loaded devices
-//Lets say for now there can't be more than 1 loaded NIC device
-struct nic_device nic_devices[1];
+extern struct nic_device nic_devices[NNIC];
+extern int nnic;
 
-void register_device(struct nic_device nd);
+struct nic_device* register_device(struct nic_device nd);
 int get_device(char* interface, struct nic_device** nd);
+struct ifqstat* nic_qstats(struct nic_device* nd, int queue);
+int nic_getstat(int index, struct ifstat* st);
+void nic_rx(struct nic_device* nd, uint8_t* pkt, uint16_t length);
 
 #endif
@@ -7,8 +7,10 @@
 #define NDEV         10  // maximum major device number
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
+#define HZ          100  // timer interrupts per second, see lapicinit()
 #define MAXOPBLOCKS  10  // max # of blocks any FS op writes
 #define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
-#define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
-#define FSSIZE       1000  // size of file system in blocks
+#define NBUF         (MAXOPBLOCKS*3)  // least size of disk block cache
+#define NREADAHEAD   16  // max # of blocks a sequential file read fetches ahead
+#define FSSIZE       3000  // size of file system in blocks
 
@@ -0,0 +1,194 @@
+// Packet capture ring.
+//
+// Drivers call pcap_capture() for every frame they hand up or put
+// on the wire, but only when pcapon is set, so a disabled capture
+// costs one load and branch per frame. Frames are copied with a TSC
+// timestamp into a ring of fixed-size slots that is allocated when
+// the capture starts; pcapread() drains it to user space. When the
+// ring is full new frames are dropped and counted, old ones are
+// never overwritten. A BPF program attached with pcap_setfilter()
+// picks which frames are captured and how much of each is kept.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "x86.h"
+#include "spinlock.h"
+#include "proc.h"
+#include "nic.h"
+#include "pcap.h"
+
+#define PCAP_NPAGE   64  // pages in the ring
+#define PCAP_PERPAGE (PGSIZE / PCAP_SLOTSZ)
+#define PCAP_NSLOT   (PCAP_NPAGE * PCAP_PERPAGE)
+
+int pcapon;  // read without the lock on the hot path
+
+struct {
+  struct spinlock lock;
+  char *page[PCAP_NPAGE];
+  uint head;  // slots written
+  uint tail;  // slots read
+  uint64_t start;
+  uint captured;
+  uint dropped;
+  struct bpf_hook filter;
+} pcap;
+
+void
+pcapinit(void)
+{
+  initlock(&pcap.lock, "pcap");
+  bpf_hookinit(&pcap.filter, "pcapfilter");
+}
+
+int
+pcap_setfilter(struct bpf_insn *insns, int n)
+{
+  return bpf_attach(&pcap.filter, insns, n);
+}
+
+static struct pcaprec*
+slot(uint n)
+{
+  n %= PCAP_NSLOT;
+  return (struct pcaprec*)(pcap.page[n / PCAP_PERPAGE] + (n % PCAP_PERPAGE) * PCAP_SLOTSZ);
+}
+
+static void
+freering(void)
+{
+  int i;
+
+  for(i = 0; i < PCAP_NPAGE; i++){
+    if(pcap.page[i])
+      kfree(pcap.page[i]);
+    pcap.page[i] = 0;
+  }
+}
+
+// Copy a frame into the ring. dir is PCAP_RX or PCAP_TX.
+void
+pcap_capture(struct nic_device *nd, int dir, uchar *pkt, uint len)
+{
+  struct pcaprec *r;
+  uint64_t tsc = rdtsc();
+  uint snap = len;
+
+  if(pcap.filter.prog && (snap = bpf_run(&pcap.filter, pkt, len)) == 0)
+    return;
+
+  acquire(&pcap.lock);
+  if(!pcapon){
+    release(&pcap.lock);
+    return;
+  }
+  if(pcap.head - pcap.tail == PCAP_NSLOT){
+    pcap.dropped++;
+    release(&pcap.lock);
+    return;
+  }
+
+  r = slot(pcap.head);
+  r->tsc = tsc;
+  r->len = len;
+  if(snap > len)
+    snap = len;
+  r->caplen = snap < PCAP_SNAPLEN ? snap : PCAP_SNAPLEN;
+  r->ifindex = nd - nic_devices;
+  r->dir = dir;
+  memmove(r + 1, pkt, r->caplen);
+  pcap.head++;
+  pcap.captured++;
+
+  wakeup(&pcap);
+  release(&pcap.lock);
+}
+
+static void
+fillstat(struct pcapstat *st)
+{
+  st->on = pcapon;
+  st->tsckhz = tsckhz;
+  st->start = pcap.start;
+  st->captured = pcap.captured;
+  st->dropped = pcap.dropped;
+}
+
+int
+pcapctl(int cmd, struct pcapstat *st)
+{
+  int i;
+
+  acquire(&pcap.lock);
+  switch(cmd){
+  case PCAP_START:
+    if(pcapon)
+      break;
+    for(i = 0; i < PCAP_NPAGE; i++){
+      if((pcap.page[i] = kalloc()) == 0){
+        freering();
+        release(&pcap.lock);
+        return -1;
+      }
+    }
+    pcap.head = pcap.tail = 0;
+    pcap.captured = pcap.dropped = 0;
+    pcap.start = rdtsc();
+    pcapon = 1;
+    break;
+  case PCAP_STOP:
+    if(!pcapon)
+      break;
+    pcapon = 0;
+    freering();
+    wakeup(&pcap);
+    break;
+  case PCAP_STAT:
+    break;
+  default:
+    release(&pcap.lock);
+    return -1;
+  }
+  if(st)
+    fillstat(st);
+  release(&pcap.lock);
+  return 0;
+}
+
+// Copy as many whole records as fit in n bytes to dst, sleeping
+// until there is at least one. Returns the number of bytes copied,
+// 0 once the capture has been stopped, or -1 if n can't hold the
+// next record.
+int
+pcapread(char *dst, int n)
+{
+  struct pcaprec *r;
+  int tot, sz;
+
+  acquire(&pcap.lock);
+  while(pcap.head == pcap.tail && pcapon){
+    if(myproc()->killed){
+      release(&pcap.lock);
+      return -1;
+    }
+    sleep(&pcap, &pcap.lock);
+  }
+
+  tot = 0;
+  while(pcapon && pcap.tail != pcap.head){
+    r = slot(pcap.tail);
+    sz = sizeof(*r) + r->caplen;
+    if(tot + sz > n)
+      break;
+    memmove(dst + tot, r, sz);
+    tot += sz;
+    pcap.tail++;
+  }
+  release(&pcap.lock);
+
+  if(tot == 0 && pcapon)
+    return -1;
+  return tot;
+}
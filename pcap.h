@@ -0,0 +1,38 @@
+#ifndef __XV6_NETSTACK_PCAP_H__
+#define __XV6_NETSTACK_PCAP_H__
+// In-kernel packet capture.
+// Both the kernel and user programs use this header file.
+
+// pcapctl commands
+#define PCAP_START  1  // allocate the ring and start capturing
+#define PCAP_STOP   2  // stop capturing and free the ring
+#define PCAP_STAT   3  // only fill in the pcapstat
+
+// Direction of a captured frame
+#define PCAP_RX     0
+#define PCAP_TX     1
+
+#define PCAP_SLOTSZ 2048  // ring slot: record header plus frame bytes
+
+// A captured frame as returned by pcapread: this header
+// followed by caplen bytes of the frame.
+struct pcaprec {
+  uint64_t tsc;   // time-stamp counter when the frame was seen
+  ushort caplen;  // bytes of the frame that were kept
+  ushort len;     // length of the frame on the wire
+  uchar ifindex;  // interface the frame went through
+  uchar dir;      // PCAP_RX or PCAP_TX
+  ushort pad;
+};
+
+#define PCAP_SNAPLEN (PCAP_SLOTSZ - sizeof(struct pcaprec))
+
+struct pcapstat {
+  int on;          // capture is running
+  uint tsckhz;     // TSC ticks per millisecond
+  uint64_t start;  // TSC value when the capture was started
+  uint captured;   // frames written into the ring
+  uint dropped;    // frames lost because the ring was full
+};
+
+#endif
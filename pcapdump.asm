@@ -0,0 +1,1646 @@
+
+_pcapdump:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char buf[8*PCAP_SLOTSZ];
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  17:	89 cb                	mov    %ecx,%ebx
+  struct pcapstat st;
+  struct pcaprec r;
+  uint64_t us, rem;
+  int fd, n, off, count, got;
+
+  if(argc < 2){
+  19:	83 3b 01             	cmpl   $0x1,(%ebx)
+  1c:	7f 17                	jg     35 <main+0x35>
+    printf(2, "usage: pcapdump file [count]\n");
+  1e:	83 ec 08             	sub    $0x8,%esp
+  21:	68 48 0d 00 00       	push   $0xd48
+  26:	6a 02                	push   $0x2
+  28:	e8 3d 09 00 00       	call   96a <printf>
+  2d:	83 c4 10             	add    $0x10,%esp
+    exit();
+  30:	e8 79 07 00 00       	call   7ae <exit>
+  }
+  count = argc > 2 ? atoi(argv[2]) : 100;
+  35:	83 3b 02             	cmpl   $0x2,(%ebx)
+  38:	7e 16                	jle    50 <main+0x50>
+  3a:	8b 43 04             	mov    0x4(%ebx),%eax
+  3d:	83 c0 08             	add    $0x8,%eax
+  40:	8b 00                	mov    (%eax),%eax
+  42:	83 ec 0c             	sub    $0xc,%esp
+  45:	50                   	push   %eax
+  46:	e8 a4 04 00 00       	call   4ef <atoi>
+  4b:	83 c4 10             	add    $0x10,%esp
+  4e:	eb 05                	jmp    55 <main+0x55>
+  50:	b8 64 00 00 00       	mov    $0x64,%eax
+  55:	89 45 e0             	mov    %eax,-0x20(%ebp)
+
+  if((fd = open(argv[1], O_CREATE|O_WRONLY)) < 0){
+  58:	8b 43 04             	mov    0x4(%ebx),%eax
+  5b:	83 c0 04             	add    $0x4,%eax
+  5e:	8b 00                	mov    (%eax),%eax
+  60:	83 ec 08             	sub    $0x8,%esp
+  63:	68 01 02 00 00       	push   $0x201
+  68:	50                   	push   %eax
+  69:	e8 80 07 00 00       	call   7ee <open>
+  6e:	83 c4 10             	add    $0x10,%esp
+  71:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  74:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  78:	79 20                	jns    9a <main+0x9a>
+    printf(2, "pcapdump: cannot open %s\n", argv[1]);
+  7a:	8b 43 04             	mov    0x4(%ebx),%eax
+  7d:	83 c0 04             	add    $0x4,%eax
+  80:	8b 00                	mov    (%eax),%eax
+  82:	83 ec 04             	sub    $0x4,%esp
+  85:	50                   	push   %eax
+  86:	68 66 0d 00 00       	push   $0xd66
+  8b:	6a 02                	push   $0x2
+  8d:	e8 d8 08 00 00       	call   96a <printf>
+  92:	83 c4 10             	add    $0x10,%esp
+    exit();
+  95:	e8 14 07 00 00       	call   7ae <exit>
+  }
+
+  fh.magic = PCAP_MAGIC;
+  9a:	c7 45 b0 d4 c3 b2 a1 	movl   $0xa1b2c3d4,-0x50(%ebp)
+  fh.major = 2;
+  a1:	66 c7 45 b4 02 00    	movw   $0x2,-0x4c(%ebp)
+  fh.minor = 4;
+  a7:	66 c7 45 b6 04 00    	movw   $0x4,-0x4a(%ebp)
+  fh.thiszone = 0;
+  ad:	c7 45 b8 00 00 00 00 	movl   $0x0,-0x48(%ebp)
+  fh.sigfigs = 0;
+  b4:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%ebp)
+  fh.snaplen = PCAP_SNAPLEN;
+  bb:	c7 45 c0 f0 07 00 00 	movl   $0x7f0,-0x40(%ebp)
+  fh.linktype = LINKTYPE_ETHER;
+  c2:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%ebp)
+  if(write(fd, &fh, sizeof(fh)) != sizeof(fh)){
+  c9:	83 ec 04             	sub    $0x4,%esp
+  cc:	6a 18                	push   $0x18
+  ce:	8d 45 b0             	lea    -0x50(%ebp),%eax
+  d1:	50                   	push   %eax
+  d2:	ff 75 d8             	push   -0x28(%ebp)
+  d5:	e8 f4 06 00 00       	call   7ce <write>
+  da:	83 c4 10             	add    $0x10,%esp
+  dd:	83 f8 18             	cmp    $0x18,%eax
+  e0:	74 17                	je     f9 <main+0xf9>
+    printf(2, "pcapdump: write error\n");
+  e2:	83 ec 08             	sub    $0x8,%esp
+  e5:	68 80 0d 00 00       	push   $0xd80
+  ea:	6a 02                	push   $0x2
+  ec:	e8 79 08 00 00       	call   96a <printf>
+  f1:	83 c4 10             	add    $0x10,%esp
+    exit();
+  f4:	e8 b5 06 00 00       	call   7ae <exit>
+  }
+
+  if(pcapctl(PCAP_START, &st) < 0){
+  f9:	83 ec 08             	sub    $0x8,%esp
+  fc:	8d 45 88             	lea    -0x78(%ebp),%eax
+  ff:	50                   	push   %eax
+ 100:	6a 01                	push   $0x1
+ 102:	e8 57 07 00 00       	call   85e <pcapctl>
+ 107:	83 c4 10             	add    $0x10,%esp
+ 10a:	85 c0                	test   %eax,%eax
+ 10c:	79 17                	jns    125 <main+0x125>
+    printf(2, "pcapdump: cannot start capture\n");
+ 10e:	83 ec 08             	sub    $0x8,%esp
+ 111:	68 98 0d 00 00       	push   $0xd98
+ 116:	6a 02                	push   $0x2
+ 118:	e8 4d 08 00 00       	call   96a <printf>
+ 11d:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 120:	e8 89 06 00 00       	call   7ae <exit>
+  }
+
+  got = 0;
+ 125:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+  while(got < count && (n = pcapread(buf, sizeof(buf))) > 0){
+ 12c:	e9 64 01 00 00       	jmp    295 <main+0x295>
+    for(off = 0; off < n && got < count; off += sizeof(r) + r.caplen){
+ 131:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+ 138:	e9 44 01 00 00       	jmp    281 <main+0x281>
+      memmove(&r, buf + off, sizeof(r));
+ 13d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 140:	05 40 15 00 00       	add    $0x1540,%eax
+ 145:	83 ec 04             	sub    $0x4,%esp
+ 148:	6a 10                	push   $0x10
+ 14a:	50                   	push   %eax
+ 14b:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+ 151:	50                   	push   %eax
+ 152:	e8 2f 03 00 00       	call   486 <memmove>
+ 157:	83 c4 10             	add    $0x10,%esp
+      us = udiv64((r.tsc - st.start) * 1000, st.tsckhz, 0);
+ 15a:	8b 45 8c             	mov    -0x74(%ebp),%eax
+ 15d:	89 85 60 ff ff ff    	mov    %eax,-0xa0(%ebp)
+ 163:	c7 85 64 ff ff ff 00 	movl   $0x0,-0x9c(%ebp)
+ 16a:	00 00 00 
+ 16d:	8b 85 78 ff ff ff    	mov    -0x88(%ebp),%eax
+ 173:	8b 95 7c ff ff ff    	mov    -0x84(%ebp),%edx
+ 179:	8b 75 90             	mov    -0x70(%ebp),%esi
+ 17c:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+ 17f:	29 f0                	sub    %esi,%eax
+ 181:	19 fa                	sbb    %edi,%edx
+ 183:	69 f2 e8 03 00 00    	imul   $0x3e8,%edx,%esi
+ 189:	6b c8 00             	imul   $0x0,%eax,%ecx
+ 18c:	01 f1                	add    %esi,%ecx
+ 18e:	be e8 03 00 00       	mov    $0x3e8,%esi
+ 193:	f7 e6                	mul    %esi
+ 195:	01 d1                	add    %edx,%ecx
+ 197:	89 ca                	mov    %ecx,%edx
+ 199:	83 ec 0c             	sub    $0xc,%esp
+ 19c:	6a 00                	push   $0x0
+ 19e:	ff b5 64 ff ff ff    	push   -0x9c(%ebp)
+ 1a4:	ff b5 60 ff ff ff    	push   -0xa0(%ebp)
+ 1aa:	52                   	push   %edx
+ 1ab:	50                   	push   %eax
+ 1ac:	e8 ca 03 00 00       	call   57b <udiv64>
+ 1b1:	83 c4 20             	add    $0x20,%esp
+ 1b4:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 1b7:	89 55 cc             	mov    %edx,-0x34(%ebp)
+      ph.sec = udiv64(us, 1000000, &rem);
+ 1ba:	83 ec 0c             	sub    $0xc,%esp
+ 1bd:	8d 85 70 ff ff ff    	lea    -0x90(%ebp),%eax
+ 1c3:	50                   	push   %eax
+ 1c4:	6a 00                	push   $0x0
+ 1c6:	68 40 42 0f 00       	push   $0xf4240
+ 1cb:	ff 75 cc             	push   -0x34(%ebp)
+ 1ce:	ff 75 c8             	push   -0x38(%ebp)
+ 1d1:	e8 a5 03 00 00       	call   57b <udiv64>
+ 1d6:	83 c4 20             	add    $0x20,%esp
+ 1d9:	89 45 a0             	mov    %eax,-0x60(%ebp)
+      ph.usec = rem;
+ 1dc:	8b 85 70 ff ff ff    	mov    -0x90(%ebp),%eax
+ 1e2:	8b 95 74 ff ff ff    	mov    -0x8c(%ebp),%edx
+ 1e8:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+      ph.caplen = r.caplen;
+ 1eb:	0f b7 45 80          	movzwl -0x80(%ebp),%eax
+ 1ef:	0f b7 c0             	movzwl %ax,%eax
+ 1f2:	89 45 a8             	mov    %eax,-0x58(%ebp)
+      ph.len = r.len;
+ 1f5:	0f b7 45 82          	movzwl -0x7e(%ebp),%eax
+ 1f9:	0f b7 c0             	movzwl %ax,%eax
+ 1fc:	89 45 ac             	mov    %eax,-0x54(%ebp)
+      if(write(fd, &ph, sizeof(ph)) != sizeof(ph) ||
+ 1ff:	83 ec 04             	sub    $0x4,%esp
+ 202:	6a 10                	push   $0x10
+ 204:	8d 45 a0             	lea    -0x60(%ebp),%eax
+ 207:	50                   	push   %eax
+ 208:	ff 75 d8             	push   -0x28(%ebp)
+ 20b:	e8 be 05 00 00       	call   7ce <write>
+ 210:	83 c4 10             	add    $0x10,%esp
+ 213:	83 f8 10             	cmp    $0x10,%eax
+ 216:	75 30                	jne    248 <main+0x248>
+         write(fd, buf + off + sizeof(r), r.caplen) != r.caplen){
+ 218:	0f b7 45 80          	movzwl -0x80(%ebp),%eax
+ 21c:	0f b7 c0             	movzwl %ax,%eax
+ 21f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 222:	83 c2 10             	add    $0x10,%edx
+ 225:	81 c2 40 15 00 00    	add    $0x1540,%edx
+ 22b:	83 ec 04             	sub    $0x4,%esp
+ 22e:	50                   	push   %eax
+ 22f:	52                   	push   %edx
+ 230:	ff 75 d8             	push   -0x28(%ebp)
+ 233:	e8 96 05 00 00       	call   7ce <write>
+ 238:	83 c4 10             	add    $0x10,%esp
+ 23b:	89 c2                	mov    %eax,%edx
+ 23d:	0f b7 45 80          	movzwl -0x80(%ebp),%eax
+ 241:	0f b7 c0             	movzwl %ax,%eax
+      if(write(fd, &ph, sizeof(ph)) != sizeof(ph) ||
+ 244:	39 c2                	cmp    %eax,%edx
+ 246:	74 23                	je     26b <main+0x26b>
+        printf(2, "pcapdump: %s is full\n", argv[1]);
+ 248:	8b 43 04             	mov    0x4(%ebx),%eax
+ 24b:	83 c0 04             	add    $0x4,%eax
+ 24e:	8b 00                	mov    (%eax),%eax
+ 250:	83 ec 04             	sub    $0x4,%esp
+ 253:	50                   	push   %eax
+ 254:	68 b8 0d 00 00       	push   $0xdb8
+ 259:	6a 02                	push   $0x2
+ 25b:	e8 0a 07 00 00       	call   96a <printf>
+ 260:	83 c4 10             	add    $0x10,%esp
+        count = got;
+ 263:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 266:	89 45 e0             	mov    %eax,-0x20(%ebp)
+        break;
+ 269:	eb 2a                	jmp    295 <main+0x295>
+      }
+      got++;
+ 26b:	83 45 dc 01          	addl   $0x1,-0x24(%ebp)
+    for(off = 0; off < n && got < count; off += sizeof(r) + r.caplen){
+ 26f:	0f b7 45 80          	movzwl -0x80(%ebp),%eax
+ 273:	0f b7 d0             	movzwl %ax,%edx
+ 276:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 279:	01 d0                	add    %edx,%eax
+ 27b:	83 c0 10             	add    $0x10,%eax
+ 27e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 281:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 284:	3b 45 d4             	cmp    -0x2c(%ebp),%eax
+ 287:	7d 0c                	jge    295 <main+0x295>
+ 289:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 28c:	3b 45 e0             	cmp    -0x20(%ebp),%eax
+ 28f:	0f 8c a8 fe ff ff    	jl     13d <main+0x13d>
+  while(got < count && (n = pcapread(buf, sizeof(buf))) > 0){
+ 295:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 298:	3b 45 e0             	cmp    -0x20(%ebp),%eax
+ 29b:	7d 22                	jge    2bf <main+0x2bf>
+ 29d:	83 ec 08             	sub    $0x8,%esp
+ 2a0:	68 00 40 00 00       	push   $0x4000
+ 2a5:	68 40 15 00 00       	push   $0x1540
+ 2aa:	e8 b7 05 00 00       	call   866 <pcapread>
+ 2af:	83 c4 10             	add    $0x10,%esp
+ 2b2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 2b5:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 2b9:	0f 8f 72 fe ff ff    	jg     131 <main+0x131>
+    }
+  }
+
+  pcapctl(PCAP_STOP, &st);
+ 2bf:	83 ec 08             	sub    $0x8,%esp
+ 2c2:	8d 45 88             	lea    -0x78(%ebp),%eax
+ 2c5:	50                   	push   %eax
+ 2c6:	6a 02                	push   $0x2
+ 2c8:	e8 91 05 00 00       	call   85e <pcapctl>
+ 2cd:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+ 2d0:	83 ec 0c             	sub    $0xc,%esp
+ 2d3:	ff 75 d8             	push   -0x28(%ebp)
+ 2d6:	e8 fb 04 00 00       	call   7d6 <close>
+ 2db:	83 c4 10             	add    $0x10,%esp
+  printf(1, "%d frames written, %d captured, %d dropped by the kernel\n",
+ 2de:	8b 55 9c             	mov    -0x64(%ebp),%edx
+ 2e1:	8b 45 98             	mov    -0x68(%ebp),%eax
+ 2e4:	83 ec 0c             	sub    $0xc,%esp
+ 2e7:	52                   	push   %edx
+ 2e8:	50                   	push   %eax
+ 2e9:	ff 75 dc             	push   -0x24(%ebp)
+ 2ec:	68 d0 0d 00 00       	push   $0xdd0
+ 2f1:	6a 01                	push   $0x1
+ 2f3:	e8 72 06 00 00       	call   96a <printf>
+ 2f8:	83 c4 20             	add    $0x20,%esp
+         got, st.captured, st.dropped);
+  exit();
+ 2fb:	e8 ae 04 00 00       	call   7ae <exit>
+
+00000300 <stosb>:
+}
+
+int
+stat(char *n, struct stat *st)
+{
+  int fd;
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	57                   	push   %edi
+ 304:	53                   	push   %ebx
+  int r;
+ 305:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 308:	8b 55 10             	mov    0x10(%ebp),%edx
+ 30b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 30e:	89 cb                	mov    %ecx,%ebx
+ 310:	89 df                	mov    %ebx,%edi
+ 312:	89 d1                	mov    %edx,%ecx
+ 314:	fc                   	cld
+ 315:	f3 aa                	rep stos %al,%es:(%edi)
+ 317:	89 ca                	mov    %ecx,%edx
+ 319:	89 fb                	mov    %edi,%ebx
+ 31b:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 31e:	89 55 10             	mov    %edx,0x10(%ebp)
+
+  fd = open(n, O_RDONLY);
+  if(fd < 0)
+    return -1;
+ 321:	90                   	nop
+ 322:	5b                   	pop    %ebx
+ 323:	5f                   	pop    %edi
+ 324:	5d                   	pop    %ebp
+ 325:	c3                   	ret
+
+00000326 <strcpy>:
+{
+ 326:	55                   	push   %ebp
+ 327:	89 e5                	mov    %esp,%ebp
+ 329:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 32c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 32f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 332:	90                   	nop
+ 333:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 336:	8d 42 01             	lea    0x1(%edx),%eax
+ 339:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 33c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 33f:	8d 48 01             	lea    0x1(%eax),%ecx
+ 342:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 345:	0f b6 12             	movzbl (%edx),%edx
+ 348:	88 10                	mov    %dl,(%eax)
+ 34a:	0f b6 00             	movzbl (%eax),%eax
+ 34d:	84 c0                	test   %al,%al
+ 34f:	75 e2                	jne    333 <strcpy+0xd>
+  return os;
+ 351:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 354:	c9                   	leave
+ 355:	c3                   	ret
+
+00000356 <strlen>:
+{
+ 356:	55                   	push   %ebp
+ 357:	89 e5                	mov    %esp,%ebp
+ 359:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 35c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 363:	eb 04                	jmp    369 <strlen+0x13>
+ 365:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 369:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 36c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 36f:	01 d0                	add    %edx,%eax
+ 371:	0f b6 00             	movzbl (%eax),%eax
+ 374:	84 c0                	test   %al,%al
+ 376:	75 ed                	jne    365 <strlen+0xf>
+  return n;
+ 378:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 37b:	c9                   	leave
+ 37c:	c3                   	ret
+
+0000037d <memset>:
+{
+ 37d:	55                   	push   %ebp
+ 37e:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 380:	8b 45 10             	mov    0x10(%ebp),%eax
+ 383:	50                   	push   %eax
+ 384:	ff 75 0c             	push   0xc(%ebp)
+ 387:	ff 75 08             	push   0x8(%ebp)
+ 38a:	e8 71 ff ff ff       	call   300 <stosb>
+ 38f:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 392:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 395:	c9                   	leave
+ 396:	c3                   	ret
+
+00000397 <strchr>:
+{
+ 397:	55                   	push   %ebp
+ 398:	89 e5                	mov    %esp,%ebp
+ 39a:	83 ec 04             	sub    $0x4,%esp
+ 39d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3a0:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 3a3:	eb 14                	jmp    3b9 <strchr+0x22>
+    if(*s == c)
+ 3a5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a8:	0f b6 00             	movzbl (%eax),%eax
+ 3ab:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 3ae:	75 05                	jne    3b5 <strchr+0x1e>
+      return (char*)s;
+ 3b0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b3:	eb 13                	jmp    3c8 <strchr+0x31>
+  for(; *s; s++)
+ 3b5:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 3b9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3bc:	0f b6 00             	movzbl (%eax),%eax
+ 3bf:	84 c0                	test   %al,%al
+ 3c1:	75 e2                	jne    3a5 <strchr+0xe>
+  return 0;
+ 3c3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 3c8:	c9                   	leave
+ 3c9:	c3                   	ret
+
+000003ca <gets>:
+{
+ 3ca:	55                   	push   %ebp
+ 3cb:	89 e5                	mov    %esp,%ebp
+ 3cd:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 3d0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 3d7:	eb 42                	jmp    41b <gets+0x51>
+    cc = read(0, &c, 1);
+ 3d9:	83 ec 04             	sub    $0x4,%esp
+ 3dc:	6a 01                	push   $0x1
+ 3de:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 3e1:	50                   	push   %eax
+ 3e2:	6a 00                	push   $0x0
+ 3e4:	e8 dd 03 00 00       	call   7c6 <read>
+ 3e9:	83 c4 10             	add    $0x10,%esp
+ 3ec:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 3ef:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 3f3:	7e 33                	jle    428 <gets+0x5e>
+    buf[i++] = c;
+ 3f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3f8:	8d 50 01             	lea    0x1(%eax),%edx
+ 3fb:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 3fe:	89 c2                	mov    %eax,%edx
+ 400:	8b 45 08             	mov    0x8(%ebp),%eax
+ 403:	01 c2                	add    %eax,%edx
+ 405:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 409:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 40b:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 40f:	3c 0a                	cmp    $0xa,%al
+ 411:	74 16                	je     429 <gets+0x5f>
+ 413:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 417:	3c 0d                	cmp    $0xd,%al
+ 419:	74 0e                	je     429 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 41b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 41e:	83 c0 01             	add    $0x1,%eax
+ 421:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 424:	7f b3                	jg     3d9 <gets+0xf>
+ 426:	eb 01                	jmp    429 <gets+0x5f>
+      break;
+ 428:	90                   	nop
+  buf[i] = '\0';
+ 429:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 42c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 42f:	01 d0                	add    %edx,%eax
+ 431:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 434:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 437:	c9                   	leave
+ 438:	c3                   	ret
+
+00000439 <stat>:
+{
+ 439:	55                   	push   %ebp
+ 43a:	89 e5                	mov    %esp,%ebp
+ 43c:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+ 43f:	83 ec 08             	sub    $0x8,%esp
+ 442:	6a 00                	push   $0x0
+ 444:	ff 75 08             	push   0x8(%ebp)
+ 447:	e8 a2 03 00 00       	call   7ee <open>
+ 44c:	83 c4 10             	add    $0x10,%esp
+ 44f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 452:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 456:	79 07                	jns    45f <stat+0x26>
+    return -1;
+ 458:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 45d:	eb 25                	jmp    484 <stat+0x4b>
+  r = fstat(fd, st);
+ 45f:	83 ec 08             	sub    $0x8,%esp
+ 462:	ff 75 0c             	push   0xc(%ebp)
+ 465:	ff 75 f4             	push   -0xc(%ebp)
+ 468:	e8 99 03 00 00       	call   806 <fstat>
+ 46d:	83 c4 10             	add    $0x10,%esp
+ 470:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 473:	83 ec 0c             	sub    $0xc,%esp
+ 476:	ff 75 f4             	push   -0xc(%ebp)
+ 479:	e8 58 03 00 00       	call   7d6 <close>
+ 47e:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 481:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 484:	c9                   	leave
+ 485:	c3                   	ret
+
+00000486 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 486:	55                   	push   %ebp
+ 487:	89 e5                	mov    %esp,%ebp
+ 489:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+
+  dst = vdst;
+ 48c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 48f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 492:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 495:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 498:	eb 17                	jmp    4b1 <memmove+0x2b>
+    *dst++ = *src++;
+ 49a:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 49d:	8d 42 01             	lea    0x1(%edx),%eax
+ 4a0:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 4a3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 4a6:	8d 48 01             	lea    0x1(%eax),%ecx
+ 4a9:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 4ac:	0f b6 12             	movzbl (%edx),%edx
+ 4af:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 4b1:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4b4:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 4b7:	89 55 10             	mov    %edx,0x10(%ebp)
+ 4ba:	85 c0                	test   %eax,%eax
+ 4bc:	7f dc                	jg     49a <memmove+0x14>
+  return vdst;
+ 4be:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 4c1:	c9                   	leave
+ 4c2:	c3                   	ret
+
+000004c3 <cpuinfo>:
+ 4c3:	55                   	push   %ebp
+ 4c4:	89 e5                	mov    %esp,%ebp
+ 4c6:	56                   	push   %esi
+ 4c7:	53                   	push   %ebx
+ 4c8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4cb:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4d0:	89 d1                	mov    %edx,%ecx
+ 4d2:	0f a2                	cpuid
+ 4d4:	89 c6                	mov    %eax,%esi
+ 4d6:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4d9:	89 30                	mov    %esi,(%eax)
+ 4db:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4de:	89 18                	mov    %ebx,(%eax)
+ 4e0:	8b 45 14             	mov    0x14(%ebp),%eax
+ 4e3:	89 08                	mov    %ecx,(%eax)
+ 4e5:	8b 45 18             	mov    0x18(%ebp),%eax
+ 4e8:	89 10                	mov    %edx,(%eax)
+ 4ea:	90                   	nop
+ 4eb:	5b                   	pop    %ebx
+ 4ec:	5e                   	pop    %esi
+ 4ed:	5d                   	pop    %ebp
+ 4ee:	c3                   	ret
+
+000004ef <atoi>:
+{
+ 4ef:	55                   	push   %ebp
+ 4f0:	89 e5                	mov    %esp,%ebp
+ 4f2:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+ 4f5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 4fc:	eb 25                	jmp    523 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 4fe:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 501:	89 d0                	mov    %edx,%eax
+ 503:	c1 e0 02             	shl    $0x2,%eax
+ 506:	01 d0                	add    %edx,%eax
+ 508:	01 c0                	add    %eax,%eax
+ 50a:	89 c1                	mov    %eax,%ecx
+ 50c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 50f:	8d 50 01             	lea    0x1(%eax),%edx
+ 512:	89 55 08             	mov    %edx,0x8(%ebp)
+ 515:	0f b6 00             	movzbl (%eax),%eax
+ 518:	0f be c0             	movsbl %al,%eax
+ 51b:	01 c8                	add    %ecx,%eax
+ 51d:	83 e8 30             	sub    $0x30,%eax
+ 520:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 523:	8b 45 08             	mov    0x8(%ebp),%eax
+ 526:	0f b6 00             	movzbl (%eax),%eax
+ 529:	3c 2f                	cmp    $0x2f,%al
+ 52b:	7e 0a                	jle    537 <atoi+0x48>
+ 52d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 530:	0f b6 00             	movzbl (%eax),%eax
+ 533:	3c 39                	cmp    $0x39,%al
+ 535:	7e c7                	jle    4fe <atoi+0xf>
+  return n;
+ 537:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 53a:	c9                   	leave
+ 53b:	c3                   	ret
+
+0000053c <strcmp>:
+{
+ 53c:	55                   	push   %ebp
+ 53d:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 53f:	eb 08                	jmp    549 <strcmp+0xd>
+    p++, q++;
+ 541:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 545:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 549:	8b 45 08             	mov    0x8(%ebp),%eax
+ 54c:	0f b6 00             	movzbl (%eax),%eax
+ 54f:	84 c0                	test   %al,%al
+ 551:	74 10                	je     563 <strcmp+0x27>
+ 553:	8b 45 08             	mov    0x8(%ebp),%eax
+ 556:	0f b6 10             	movzbl (%eax),%edx
+ 559:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 55c:	0f b6 00             	movzbl (%eax),%eax
+ 55f:	38 c2                	cmp    %al,%dl
+ 561:	74 de                	je     541 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 563:	8b 45 08             	mov    0x8(%ebp),%eax
+ 566:	0f b6 00             	movzbl (%eax),%eax
+ 569:	0f b6 d0             	movzbl %al,%edx
+ 56c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 56f:	0f b6 00             	movzbl (%eax),%eax
+ 572:	0f b6 c0             	movzbl %al,%eax
+ 575:	29 c2                	sub    %eax,%edx
+ 577:	89 d0                	mov    %edx,%eax
+}
+ 579:	5d                   	pop    %ebp
+ 57a:	c3                   	ret
+
+0000057b <udiv64>:
+{
+ 57b:	55                   	push   %ebp
+ 57c:	89 e5                	mov    %esp,%ebp
+ 57e:	57                   	push   %edi
+ 57f:	56                   	push   %esi
+ 580:	83 ec 38             	sub    $0x38,%esp
+ 583:	8b 45 08             	mov    0x8(%ebp),%eax
+ 586:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 589:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 58c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 58f:	8b 45 10             	mov    0x10(%ebp),%eax
+ 592:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 595:	8b 45 14             	mov    0x14(%ebp),%eax
+ 598:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  q = r = 0;
+ 59b:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 5a2:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 5a9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5ac:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 5af:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 5b2:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 5b5:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 5bc:	e9 85 00 00 00       	jmp    646 <udiv64+0xcb>
+    r = (r << 1) | ((n >> i) & 1);
+ 5c1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5c4:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 5c7:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 5cb:	01 c0                	add    %eax,%eax
+ 5cd:	89 c6                	mov    %eax,%esi
+ 5cf:	89 d7                	mov    %edx,%edi
+ 5d1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 5d4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 5d7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 5da:	0f ad d0             	shrd   %cl,%edx,%eax
+ 5dd:	d3 ea                	shr    %cl,%edx
+ 5df:	f6 c1 20             	test   $0x20,%cl
+ 5e2:	74 04                	je     5e8 <udiv64+0x6d>
+ 5e4:	89 d0                	mov    %edx,%eax
+ 5e6:	31 d2                	xor    %edx,%edx
+ 5e8:	83 e0 01             	and    $0x1,%eax
+ 5eb:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 5ee:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+ 5f5:	89 f0                	mov    %esi,%eax
+ 5f7:	89 fa                	mov    %edi,%edx
+ 5f9:	0b 45 c0             	or     -0x40(%ebp),%eax
+ 5fc:	0b 55 c4             	or     -0x3c(%ebp),%edx
+ 5ff:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 602:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 605:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 608:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 60b:	3b 45 c8             	cmp    -0x38(%ebp),%eax
+ 60e:	89 d0                	mov    %edx,%eax
+ 610:	1b 45 cc             	sbb    -0x34(%ebp),%eax
+ 613:	72 2d                	jb     642 <udiv64+0xc7>
+      r -= d;
+ 615:	8b 45 c8             	mov    -0x38(%ebp),%eax
+ 618:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 61b:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 61e:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64_t)1 << i;
+ 621:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 624:	b8 01 00 00 00       	mov    $0x1,%eax
+ 629:	ba 00 00 00 00       	mov    $0x0,%edx
+ 62e:	0f a5 c2             	shld   %cl,%eax,%edx
+ 631:	d3 e0                	shl    %cl,%eax
+ 633:	f6 c1 20             	test   $0x20,%cl
+ 636:	74 04                	je     63c <udiv64+0xc1>
+ 638:	89 c2                	mov    %eax,%edx
+ 63a:	31 c0                	xor    %eax,%eax
+ 63c:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 63f:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 642:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 646:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 64a:	0f 89 71 ff ff ff    	jns    5c1 <udiv64+0x46>
+  if(rem)
+ 650:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+ 654:	74 0e                	je     664 <udiv64+0xe9>
+    *rem = r;
+ 656:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 659:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 65c:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 65f:	89 01                	mov    %eax,(%ecx)
+ 661:	89 51 04             	mov    %edx,0x4(%ecx)
+  return q;
+ 664:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 667:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 66a:	83 c4 38             	add    $0x38,%esp
+ 66d:	5e                   	pop    %esi
+ 66e:	5f                   	pop    %edi
+ 66f:	5d                   	pop    %ebp
+ 670:	c3                   	ret
+
+00000671 <crc32cinit>:
+{
+ 671:	55                   	push   %ebp
+ 672:	89 e5                	mov    %esp,%ebp
+ 674:	83 ec 20             	sub    $0x20,%esp
+  for(i = 0; i < 256; i++){
+ 677:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 67e:	eb 4c                	jmp    6cc <crc32cinit+0x5b>
+    r = i;
+ 680:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 683:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+ 686:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+ 68d:	eb 26                	jmp    6b5 <crc32cinit+0x44>
+      r = (r >> 1) ^ ((r & 1) ? CRC32C_POLY : 0);
+ 68f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 692:	d1 e8                	shr    %eax
+ 694:	89 c2                	mov    %eax,%edx
+ 696:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 699:	83 e0 01             	and    $0x1,%eax
+ 69c:	85 c0                	test   %eax,%eax
+ 69e:	74 07                	je     6a7 <crc32cinit+0x36>
+ 6a0:	b8 78 3b f6 82       	mov    $0x82f63b78,%eax
+ 6a5:	eb 05                	jmp    6ac <crc32cinit+0x3b>
+ 6a7:	b8 00 00 00 00       	mov    $0x0,%eax
+ 6ac:	31 d0                	xor    %edx,%eax
+ 6ae:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+ 6b1:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+ 6b5:	83 7d f8 07          	cmpl   $0x7,-0x8(%ebp)
+ 6b9:	76 d4                	jbe    68f <crc32cinit+0x1e>
+    crc32ctab[i] = r;
+ 6bb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6be:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 6c1:	89 14 85 20 11 00 00 	mov    %edx,0x1120(,%eax,4)
+  for(i = 0; i < 256; i++){
+ 6c8:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 6cc:	81 7d fc ff 00 00 00 	cmpl   $0xff,-0x4(%ebp)
+ 6d3:	76 ab                	jbe    680 <crc32cinit+0xf>
+  cpuinfo(1, &a, &b, &c, &d);
+ 6d5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 6d8:	50                   	push   %eax
+ 6d9:	8d 45 e8             	lea    -0x18(%ebp),%eax
+ 6dc:	50                   	push   %eax
+ 6dd:	8d 45 ec             	lea    -0x14(%ebp),%eax
+ 6e0:	50                   	push   %eax
+ 6e1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 6e4:	50                   	push   %eax
+ 6e5:	6a 01                	push   $0x1
+ 6e7:	e8 d7 fd ff ff       	call   4c3 <cpuinfo>
+ 6ec:	83 c4 14             	add    $0x14,%esp
+  crc32chw = (c & CPUID_SSE42) != 0;
+ 6ef:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6f2:	25 00 00 10 00       	and    $0x100000,%eax
+ 6f7:	85 c0                	test   %eax,%eax
+ 6f9:	0f 95 c0             	setne  %al
+ 6fc:	0f b6 c0             	movzbl %al,%eax
+ 6ff:	a3 f4 10 00 00       	mov    %eax,0x10f4
+}
+ 704:	90                   	nop
+ 705:	c9                   	leave
+ 706:	c3                   	ret
+
+00000707 <crc32c>:
+{
+ 707:	55                   	push   %ebp
+ 708:	89 e5                	mov    %esp,%ebp
+ 70a:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s = p;
+ 70d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 710:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(crc32chw < 0)
+ 713:	a1 f4 10 00 00       	mov    0x10f4,%eax
+ 718:	85 c0                	test   %eax,%eax
+ 71a:	79 05                	jns    721 <crc32c+0x1a>
+    crc32cinit();
+ 71c:	e8 50 ff ff ff       	call   671 <crc32cinit>
+  crc = ~crc;
+ 721:	f7 55 08             	notl   0x8(%ebp)
+  if(crc32chw){
+ 724:	a1 f4 10 00 00       	mov    0x10f4,%eax
+ 729:	85 c0                	test   %eax,%eax
+ 72b:	74 6c                	je     799 <crc32c+0x92>
+    for(; n >= 4; n -= 4, s += 4)
+ 72d:	eb 18                	jmp    747 <crc32c+0x40>
+      asm("crc32l %1, %0" : "+r" (crc) : "rm" (*(const uint*)s));
+ 72f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 732:	8b 10                	mov    (%eax),%edx
+ 734:	8b 45 08             	mov    0x8(%ebp),%eax
+ 737:	f2 0f 38 f1 c2       	crc32  %edx,%eax
+ 73c:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n >= 4; n -= 4, s += 4)
+ 73f:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+ 743:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+ 747:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+ 74b:	77 e2                	ja     72f <crc32c+0x28>
+    for(; n > 0; n--, s++)
+ 74d:	eb 19                	jmp    768 <crc32c+0x61>
+      asm("crc32b %1, %0" : "+r" (crc) : "qm" (*s));
+ 74f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 752:	0f b6 10             	movzbl (%eax),%edx
+ 755:	8b 45 08             	mov    0x8(%ebp),%eax
+ 758:	f2 0f 38 f0 c2       	crc32  %dl,%eax
+ 75d:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+ 760:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+ 764:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 768:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 76c:	75 e1                	jne    74f <crc32c+0x48>
+ 76e:	eb 2f                	jmp    79f <crc32c+0x98>
+      crc = crc32ctab[(crc ^ *s) & 0xff] ^ (crc >> 8);
+ 770:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 773:	0f b6 00             	movzbl (%eax),%eax
+ 776:	0f b6 c0             	movzbl %al,%eax
+ 779:	33 45 08             	xor    0x8(%ebp),%eax
+ 77c:	0f b6 c0             	movzbl %al,%eax
+ 77f:	8b 04 85 20 11 00 00 	mov    0x1120(,%eax,4),%eax
+ 786:	8b 55 08             	mov    0x8(%ebp),%edx
+ 789:	c1 ea 08             	shr    $0x8,%edx
+ 78c:	31 d0                	xor    %edx,%eax
+ 78e:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+ 791:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+ 795:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 799:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 79d:	75 d1                	jne    770 <crc32c+0x69>
+  return ~crc;
+ 79f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7a2:	f7 d0                	not    %eax
+}
+ 7a4:	c9                   	leave
+ 7a5:	c3                   	ret
+
+000007a6 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 7a6:	b8 01 00 00 00       	mov    $0x1,%eax
+ 7ab:	cd 40                	int    $0x40
+ 7ad:	c3                   	ret
+
+000007ae <exit>:
+SYSCALL(exit)
+ 7ae:	b8 02 00 00 00       	mov    $0x2,%eax
+ 7b3:	cd 40                	int    $0x40
+ 7b5:	c3                   	ret
+
+000007b6 <wait>:
+SYSCALL(wait)
+ 7b6:	b8 03 00 00 00       	mov    $0x3,%eax
+ 7bb:	cd 40                	int    $0x40
+ 7bd:	c3                   	ret
+
+000007be <pipe>:
+SYSCALL(pipe)
+ 7be:	b8 04 00 00 00       	mov    $0x4,%eax
+ 7c3:	cd 40                	int    $0x40
+ 7c5:	c3                   	ret
+
+000007c6 <read>:
+SYSCALL(read)
+ 7c6:	b8 05 00 00 00       	mov    $0x5,%eax
+ 7cb:	cd 40                	int    $0x40
+ 7cd:	c3                   	ret
+
+000007ce <write>:
+SYSCALL(write)
+ 7ce:	b8 10 00 00 00       	mov    $0x10,%eax
+ 7d3:	cd 40                	int    $0x40
+ 7d5:	c3                   	ret
+
+000007d6 <close>:
+SYSCALL(close)
+ 7d6:	b8 15 00 00 00       	mov    $0x15,%eax
+ 7db:	cd 40                	int    $0x40
+ 7dd:	c3                   	ret
+
+000007de <kill>:
+SYSCALL(kill)
+ 7de:	b8 06 00 00 00       	mov    $0x6,%eax
+ 7e3:	cd 40                	int    $0x40
+ 7e5:	c3                   	ret
+
+000007e6 <exec>:
+SYSCALL(exec)
+ 7e6:	b8 07 00 00 00       	mov    $0x7,%eax
+ 7eb:	cd 40                	int    $0x40
+ 7ed:	c3                   	ret
+
+000007ee <open>:
+SYSCALL(open)
+ 7ee:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 7f3:	cd 40                	int    $0x40
+ 7f5:	c3                   	ret
+
+000007f6 <mknod>:
+SYSCALL(mknod)
+ 7f6:	b8 11 00 00 00       	mov    $0x11,%eax
+ 7fb:	cd 40                	int    $0x40
+ 7fd:	c3                   	ret
+
+000007fe <unlink>:
+SYSCALL(unlink)
+ 7fe:	b8 12 00 00 00       	mov    $0x12,%eax
+ 803:	cd 40                	int    $0x40
+ 805:	c3                   	ret
+
+00000806 <fstat>:
+SYSCALL(fstat)
+ 806:	b8 08 00 00 00       	mov    $0x8,%eax
+ 80b:	cd 40                	int    $0x40
+ 80d:	c3                   	ret
+
+0000080e <link>:
+SYSCALL(link)
+ 80e:	b8 13 00 00 00       	mov    $0x13,%eax
+ 813:	cd 40                	int    $0x40
+ 815:	c3                   	ret
+
+00000816 <mkdir>:
+SYSCALL(mkdir)
+ 816:	b8 14 00 00 00       	mov    $0x14,%eax
+ 81b:	cd 40                	int    $0x40
+ 81d:	c3                   	ret
+
+0000081e <chdir>:
+SYSCALL(chdir)
+ 81e:	b8 09 00 00 00       	mov    $0x9,%eax
+ 823:	cd 40                	int    $0x40
+ 825:	c3                   	ret
+
+00000826 <dup>:
+SYSCALL(dup)
+ 826:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 82b:	cd 40                	int    $0x40
+ 82d:	c3                   	ret
+
+0000082e <getpid>:
+SYSCALL(getpid)
+ 82e:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 833:	cd 40                	int    $0x40
+ 835:	c3                   	ret
+
+00000836 <sbrk>:
+SYSCALL(sbrk)
+ 836:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 83b:	cd 40                	int    $0x40
+ 83d:	c3                   	ret
+
+0000083e <sleep>:
+SYSCALL(sleep)
+ 83e:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 843:	cd 40                	int    $0x40
+ 845:	c3                   	ret
+
+00000846 <uptime>:
+SYSCALL(uptime)
+ 846:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 84b:	cd 40                	int    $0x40
+ 84d:	c3                   	ret
+
+0000084e <arp>:
+SYSCALL(arp)
+ 84e:	b8 16 00 00 00       	mov    $0x16,%eax
+ 853:	cd 40                	int    $0x40
+ 855:	c3                   	ret
+
+00000856 <ifstat>:
+SYSCALL(ifstat)
+ 856:	b8 17 00 00 00       	mov    $0x17,%eax
+ 85b:	cd 40                	int    $0x40
+ 85d:	c3                   	ret
+
+0000085e <pcapctl>:
+SYSCALL(pcapctl)
+ 85e:	b8 18 00 00 00       	mov    $0x18,%eax
+ 863:	cd 40                	int    $0x40
+ 865:	c3                   	ret
+
+00000866 <pcapread>:
+SYSCALL(pcapread)
+ 866:	b8 19 00 00 00       	mov    $0x19,%eax
+ 86b:	cd 40                	int    $0x40
+ 86d:	c3                   	ret
+
+0000086e <bpfattach>:
+SYSCALL(bpfattach)
+ 86e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 873:	cd 40                	int    $0x40
+ 875:	c3                   	ret
+
+00000876 <pktgen>:
+SYSCALL(pktgen)
+ 876:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 87b:	cd 40                	int    $0x40
+ 87d:	c3                   	ret
+
+0000087e <reflect>:
+SYSCALL(reflect)
+ 87e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 883:	cd 40                	int    $0x40
+ 885:	c3                   	ret
+
+00000886 <brctl>:
+SYSCALL(brctl)
+ 886:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 88b:	cd 40                	int    $0x40
+ 88d:	c3                   	ret
+
+0000088e <hostopen>:
+SYSCALL(hostopen)
+ 88e:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 893:	cd 40                	int    $0x40
+ 895:	c3                   	ret
+
+00000896 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 896:	55                   	push   %ebp
+ 897:	89 e5                	mov    %esp,%ebp
+ 899:	83 ec 18             	sub    $0x18,%esp
+ 89c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 89f:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 8a2:	83 ec 04             	sub    $0x4,%esp
+ 8a5:	6a 01                	push   $0x1
+ 8a7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 8aa:	50                   	push   %eax
+ 8ab:	ff 75 08             	push   0x8(%ebp)
+ 8ae:	e8 1b ff ff ff       	call   7ce <write>
+ 8b3:	83 c4 10             	add    $0x10,%esp
+}
+ 8b6:	90                   	nop
+ 8b7:	c9                   	leave
+ 8b8:	c3                   	ret
+
+000008b9 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 8b9:	55                   	push   %ebp
+ 8ba:	89 e5                	mov    %esp,%ebp
+ 8bc:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 8bf:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 8c6:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 8ca:	74 17                	je     8e3 <printint+0x2a>
+ 8cc:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 8d0:	79 11                	jns    8e3 <printint+0x2a>
+    neg = 1;
+ 8d2:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 8d9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 8dc:	f7 d8                	neg    %eax
+ 8de:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 8e1:	eb 06                	jmp    8e9 <printint+0x30>
+  } else {
+    x = xx;
+ 8e3:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 8e6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 8e9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 8f0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 8f3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 8f6:	ba 00 00 00 00       	mov    $0x0,%edx
+ 8fb:	f7 f1                	div    %ecx
+ 8fd:	89 d1                	mov    %edx,%ecx
+ 8ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 902:	8d 50 01             	lea    0x1(%eax),%edx
+ 905:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 908:	0f b6 91 f8 10 00 00 	movzbl 0x10f8(%ecx),%edx
+ 90f:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 913:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 916:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 919:	ba 00 00 00 00       	mov    $0x0,%edx
+ 91e:	f7 f1                	div    %ecx
+ 920:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 923:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 927:	75 c7                	jne    8f0 <printint+0x37>
+  if(neg)
+ 929:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 92d:	74 2d                	je     95c <printint+0xa3>
+    buf[i++] = '-';
+ 92f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 932:	8d 50 01             	lea    0x1(%eax),%edx
+ 935:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 938:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 93d:	eb 1d                	jmp    95c <printint+0xa3>
+    putc(fd, buf[i]);
+ 93f:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 942:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 945:	01 d0                	add    %edx,%eax
+ 947:	0f b6 00             	movzbl (%eax),%eax
+ 94a:	0f be c0             	movsbl %al,%eax
+ 94d:	83 ec 08             	sub    $0x8,%esp
+ 950:	50                   	push   %eax
+ 951:	ff 75 08             	push   0x8(%ebp)
+ 954:	e8 3d ff ff ff       	call   896 <putc>
+ 959:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 95c:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 960:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 964:	79 d9                	jns    93f <printint+0x86>
+}
+ 966:	90                   	nop
+ 967:	90                   	nop
+ 968:	c9                   	leave
+ 969:	c3                   	ret
+
+0000096a <printf>:
+
+// Print to the given fd. Only understands %d, %u, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 96a:	55                   	push   %ebp
+ 96b:	89 e5                	mov    %esp,%ebp
+ 96d:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 970:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 977:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 97a:	83 c0 04             	add    $0x4,%eax
+ 97d:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 980:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 987:	e9 7d 01 00 00       	jmp    b09 <printf+0x19f>
+    c = fmt[i] & 0xff;
+ 98c:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 98f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 992:	01 d0                	add    %edx,%eax
+ 994:	0f b6 00             	movzbl (%eax),%eax
+ 997:	0f be c0             	movsbl %al,%eax
+ 99a:	25 ff 00 00 00       	and    $0xff,%eax
+ 99f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 9a2:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 9a6:	75 2c                	jne    9d4 <printf+0x6a>
+      if(c == '%'){
+ 9a8:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 9ac:	75 0c                	jne    9ba <printf+0x50>
+        state = '%';
+ 9ae:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 9b5:	e9 4b 01 00 00       	jmp    b05 <printf+0x19b>
+      } else {
+        putc(fd, c);
+ 9ba:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9bd:	0f be c0             	movsbl %al,%eax
+ 9c0:	83 ec 08             	sub    $0x8,%esp
+ 9c3:	50                   	push   %eax
+ 9c4:	ff 75 08             	push   0x8(%ebp)
+ 9c7:	e8 ca fe ff ff       	call   896 <putc>
+ 9cc:	83 c4 10             	add    $0x10,%esp
+ 9cf:	e9 31 01 00 00       	jmp    b05 <printf+0x19b>
+      }
+    } else if(state == '%'){
+ 9d4:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 9d8:	0f 85 27 01 00 00    	jne    b05 <printf+0x19b>
+      if(c == 'd'){
+ 9de:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 9e2:	75 1e                	jne    a02 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 9e4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 9e7:	8b 00                	mov    (%eax),%eax
+ 9e9:	6a 01                	push   $0x1
+ 9eb:	6a 0a                	push   $0xa
+ 9ed:	50                   	push   %eax
+ 9ee:	ff 75 08             	push   0x8(%ebp)
+ 9f1:	e8 c3 fe ff ff       	call   8b9 <printint>
+ 9f6:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 9f9:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 9fd:	e9 fc 00 00 00       	jmp    afe <printf+0x194>
+      } else if(c == 'u'){
+ a02:	83 7d e4 75          	cmpl   $0x75,-0x1c(%ebp)
+ a06:	75 1e                	jne    a26 <printf+0xbc>
+        printint(fd, *ap, 10, 0);
+ a08:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a0b:	8b 00                	mov    (%eax),%eax
+ a0d:	6a 00                	push   $0x0
+ a0f:	6a 0a                	push   $0xa
+ a11:	50                   	push   %eax
+ a12:	ff 75 08             	push   0x8(%ebp)
+ a15:	e8 9f fe ff ff       	call   8b9 <printint>
+ a1a:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a1d:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a21:	e9 d8 00 00 00       	jmp    afe <printf+0x194>
+      } else if(c == 'x' || c == 'p'){
+ a26:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ a2a:	74 06                	je     a32 <printf+0xc8>
+ a2c:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ a30:	75 1e                	jne    a50 <printf+0xe6>
+        printint(fd, *ap, 16, 0);
+ a32:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a35:	8b 00                	mov    (%eax),%eax
+ a37:	6a 00                	push   $0x0
+ a39:	6a 10                	push   $0x10
+ a3b:	50                   	push   %eax
+ a3c:	ff 75 08             	push   0x8(%ebp)
+ a3f:	e8 75 fe ff ff       	call   8b9 <printint>
+ a44:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a47:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a4b:	e9 ae 00 00 00       	jmp    afe <printf+0x194>
+      } else if(c == 's'){
+ a50:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ a54:	75 43                	jne    a99 <printf+0x12f>
+        s = (char*)*ap;
+ a56:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a59:	8b 00                	mov    (%eax),%eax
+ a5b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ a5e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ a62:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a66:	75 25                	jne    a8d <printf+0x123>
+          s = "(null)";
+ a68:	c7 45 f4 0a 0e 00 00 	movl   $0xe0a,-0xc(%ebp)
+        while(*s != 0){
+ a6f:	eb 1c                	jmp    a8d <printf+0x123>
+          putc(fd, *s);
+ a71:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a74:	0f b6 00             	movzbl (%eax),%eax
+ a77:	0f be c0             	movsbl %al,%eax
+ a7a:	83 ec 08             	sub    $0x8,%esp
+ a7d:	50                   	push   %eax
+ a7e:	ff 75 08             	push   0x8(%ebp)
+ a81:	e8 10 fe ff ff       	call   896 <putc>
+ a86:	83 c4 10             	add    $0x10,%esp
+          s++;
+ a89:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ a8d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a90:	0f b6 00             	movzbl (%eax),%eax
+ a93:	84 c0                	test   %al,%al
+ a95:	75 da                	jne    a71 <printf+0x107>
+ a97:	eb 65                	jmp    afe <printf+0x194>
+        }
+      } else if(c == 'c'){
+ a99:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ a9d:	75 1d                	jne    abc <printf+0x152>
+        putc(fd, *ap);
+ a9f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ aa2:	8b 00                	mov    (%eax),%eax
+ aa4:	0f be c0             	movsbl %al,%eax
+ aa7:	83 ec 08             	sub    $0x8,%esp
+ aaa:	50                   	push   %eax
+ aab:	ff 75 08             	push   0x8(%ebp)
+ aae:	e8 e3 fd ff ff       	call   896 <putc>
+ ab3:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ ab6:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ aba:	eb 42                	jmp    afe <printf+0x194>
+      } else if(c == '%'){
+ abc:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ ac0:	75 17                	jne    ad9 <printf+0x16f>
+        putc(fd, c);
+ ac2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ ac5:	0f be c0             	movsbl %al,%eax
+ ac8:	83 ec 08             	sub    $0x8,%esp
+ acb:	50                   	push   %eax
+ acc:	ff 75 08             	push   0x8(%ebp)
+ acf:	e8 c2 fd ff ff       	call   896 <putc>
+ ad4:	83 c4 10             	add    $0x10,%esp
+ ad7:	eb 25                	jmp    afe <printf+0x194>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ ad9:	83 ec 08             	sub    $0x8,%esp
+ adc:	6a 25                	push   $0x25
+ ade:	ff 75 08             	push   0x8(%ebp)
+ ae1:	e8 b0 fd ff ff       	call   896 <putc>
+ ae6:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ ae9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ aec:	0f be c0             	movsbl %al,%eax
+ aef:	83 ec 08             	sub    $0x8,%esp
+ af2:	50                   	push   %eax
+ af3:	ff 75 08             	push   0x8(%ebp)
+ af6:	e8 9b fd ff ff       	call   896 <putc>
+ afb:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ afe:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ b05:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ b09:	8b 55 0c             	mov    0xc(%ebp),%edx
+ b0c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b0f:	01 d0                	add    %edx,%eax
+ b11:	0f b6 00             	movzbl (%eax),%eax
+ b14:	84 c0                	test   %al,%al
+ b16:	0f 85 70 fe ff ff    	jne    98c <printf+0x22>
+    }
+  }
+}
+ b1c:	90                   	nop
+ b1d:	90                   	nop
+ b1e:	c9                   	leave
+ b1f:	c3                   	ret
+
+00000b20 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ b20:	55                   	push   %ebp
+ b21:	89 e5                	mov    %esp,%ebp
+ b23:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ b26:	8b 45 08             	mov    0x8(%ebp),%eax
+ b29:	83 e8 08             	sub    $0x8,%eax
+ b2c:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b2f:	a1 28 15 00 00       	mov    0x1528,%eax
+ b34:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ b37:	eb 24                	jmp    b5d <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b39:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b3c:	8b 00                	mov    (%eax),%eax
+ b3e:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b41:	72 12                	jb     b55 <free+0x35>
+ b43:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b46:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b49:	72 24                	jb     b6f <free+0x4f>
+ b4b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b4e:	8b 00                	mov    (%eax),%eax
+ b50:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ b53:	72 1a                	jb     b6f <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b55:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b58:	8b 00                	mov    (%eax),%eax
+ b5a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ b5d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b60:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b63:	73 d4                	jae    b39 <free+0x19>
+ b65:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b68:	8b 00                	mov    (%eax),%eax
+ b6a:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ b6d:	73 ca                	jae    b39 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ b6f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b72:	8b 40 04             	mov    0x4(%eax),%eax
+ b75:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ b7c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b7f:	01 c2                	add    %eax,%edx
+ b81:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b84:	8b 00                	mov    (%eax),%eax
+ b86:	39 c2                	cmp    %eax,%edx
+ b88:	75 24                	jne    bae <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ b8a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b8d:	8b 50 04             	mov    0x4(%eax),%edx
+ b90:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b93:	8b 00                	mov    (%eax),%eax
+ b95:	8b 40 04             	mov    0x4(%eax),%eax
+ b98:	01 c2                	add    %eax,%edx
+ b9a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b9d:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ba0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ba3:	8b 00                	mov    (%eax),%eax
+ ba5:	8b 10                	mov    (%eax),%edx
+ ba7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ baa:	89 10                	mov    %edx,(%eax)
+ bac:	eb 0a                	jmp    bb8 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ bae:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bb1:	8b 10                	mov    (%eax),%edx
+ bb3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bb6:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ bb8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bbb:	8b 40 04             	mov    0x4(%eax),%eax
+ bbe:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ bc5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bc8:	01 d0                	add    %edx,%eax
+ bca:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ bcd:	75 20                	jne    bef <free+0xcf>
+    p->s.size += bp->s.size;
+ bcf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bd2:	8b 50 04             	mov    0x4(%eax),%edx
+ bd5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bd8:	8b 40 04             	mov    0x4(%eax),%eax
+ bdb:	01 c2                	add    %eax,%edx
+ bdd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ be0:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ be3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ be6:	8b 10                	mov    (%eax),%edx
+ be8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ beb:	89 10                	mov    %edx,(%eax)
+ bed:	eb 08                	jmp    bf7 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ bef:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bf2:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ bf5:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ bf7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bfa:	a3 28 15 00 00       	mov    %eax,0x1528
+}
+ bff:	90                   	nop
+ c00:	c9                   	leave
+ c01:	c3                   	ret
+
+00000c02 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ c02:	55                   	push   %ebp
+ c03:	89 e5                	mov    %esp,%ebp
+ c05:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ c08:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ c0f:	77 07                	ja     c18 <morecore+0x16>
+    nu = 4096;
+ c11:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ c18:	8b 45 08             	mov    0x8(%ebp),%eax
+ c1b:	c1 e0 03             	shl    $0x3,%eax
+ c1e:	83 ec 0c             	sub    $0xc,%esp
+ c21:	50                   	push   %eax
+ c22:	e8 0f fc ff ff       	call   836 <sbrk>
+ c27:	83 c4 10             	add    $0x10,%esp
+ c2a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ c2d:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ c31:	75 07                	jne    c3a <morecore+0x38>
+    return 0;
+ c33:	b8 00 00 00 00       	mov    $0x0,%eax
+ c38:	eb 26                	jmp    c60 <morecore+0x5e>
+  hp = (Header*)p;
+ c3a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c3d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ c40:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c43:	8b 55 08             	mov    0x8(%ebp),%edx
+ c46:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ c49:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c4c:	83 c0 08             	add    $0x8,%eax
+ c4f:	83 ec 0c             	sub    $0xc,%esp
+ c52:	50                   	push   %eax
+ c53:	e8 c8 fe ff ff       	call   b20 <free>
+ c58:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ c5b:	a1 28 15 00 00       	mov    0x1528,%eax
+}
+ c60:	c9                   	leave
+ c61:	c3                   	ret
+
+00000c62 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ c62:	55                   	push   %ebp
+ c63:	89 e5                	mov    %esp,%ebp
+ c65:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c68:	8b 45 08             	mov    0x8(%ebp),%eax
+ c6b:	83 c0 07             	add    $0x7,%eax
+ c6e:	c1 e8 03             	shr    $0x3,%eax
+ c71:	83 c0 01             	add    $0x1,%eax
+ c74:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ c77:	a1 28 15 00 00       	mov    0x1528,%eax
+ c7c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ c7f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ c83:	75 23                	jne    ca8 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ c85:	c7 45 f0 20 15 00 00 	movl   $0x1520,-0x10(%ebp)
+ c8c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c8f:	a3 28 15 00 00       	mov    %eax,0x1528
+ c94:	a1 28 15 00 00       	mov    0x1528,%eax
+ c99:	a3 20 15 00 00       	mov    %eax,0x1520
+    base.s.size = 0;
+ c9e:	c7 05 24 15 00 00 00 	movl   $0x0,0x1524
+ ca5:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ca8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cab:	8b 00                	mov    (%eax),%eax
+ cad:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ cb0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cb3:	8b 40 04             	mov    0x4(%eax),%eax
+ cb6:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ cb9:	72 4d                	jb     d08 <malloc+0xa6>
+      if(p->s.size == nunits)
+ cbb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cbe:	8b 40 04             	mov    0x4(%eax),%eax
+ cc1:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ cc4:	75 0c                	jne    cd2 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ cc6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cc9:	8b 10                	mov    (%eax),%edx
+ ccb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cce:	89 10                	mov    %edx,(%eax)
+ cd0:	eb 26                	jmp    cf8 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ cd2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cd5:	8b 40 04             	mov    0x4(%eax),%eax
+ cd8:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ cdb:	89 c2                	mov    %eax,%edx
+ cdd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ce0:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ ce3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ce6:	8b 40 04             	mov    0x4(%eax),%eax
+ ce9:	c1 e0 03             	shl    $0x3,%eax
+ cec:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ cef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cf2:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ cf5:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ cf8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cfb:	a3 28 15 00 00       	mov    %eax,0x1528
+      return (void*)(p + 1);
+ d00:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d03:	83 c0 08             	add    $0x8,%eax
+ d06:	eb 3b                	jmp    d43 <malloc+0xe1>
+    }
+    if(p == freep)
+ d08:	a1 28 15 00 00       	mov    0x1528,%eax
+ d0d:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ d10:	75 1e                	jne    d30 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ d12:	83 ec 0c             	sub    $0xc,%esp
+ d15:	ff 75 ec             	push   -0x14(%ebp)
+ d18:	e8 e5 fe ff ff       	call   c02 <morecore>
+ d1d:	83 c4 10             	add    $0x10,%esp
+ d20:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d23:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d27:	75 07                	jne    d30 <malloc+0xce>
+        return 0;
+ d29:	b8 00 00 00 00       	mov    $0x0,%eax
+ d2e:	eb 13                	jmp    d43 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d30:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d33:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ d36:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d39:	8b 00                	mov    (%eax),%eax
+ d3b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ d3e:	e9 6d ff ff ff       	jmp    cb0 <malloc+0x4e>
+  }
+}
+ d43:	c9                   	leave
+ d44:	c3                   	ret
@@ -0,0 +1,98 @@
+// pcapdump: capture frames from the kernel capture ring into a
+// pcap file that Wireshark or tcpdump can read.
+//
+//   pcapdump file [count]
+//
+// Timestamps are relative to the start of the capture.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "pcap.h"
+
+#define PCAP_MAGIC     0xa1b2c3d4
+#define LINKTYPE_ETHER 1
+
+struct pcap_filehdr {
+  uint magic;
+  ushort major;
+  ushort minor;
+  int thiszone;
+  uint sigfigs;
+  uint snaplen;
+  uint linktype;
+};
+
+struct pcap_pkthdr {
+  uint sec;
+  uint usec;
+  uint caplen;
+  uint len;
+};
+
+char buf[8*PCAP_SLOTSZ];
+
+int
+main(int argc, char *argv[])
+{
+  struct pcap_filehdr fh;
+  struct pcap_pkthdr ph;
+  struct pcapstat st;
+  struct pcaprec r;
+  uint64_t us, rem;
+  int fd, n, off, count, got;
+
+  if(argc < 2){
+    printf(2, "usage: pcapdump file [count]\n");
+    exit();
+  }
+  count = argc > 2 ? atoi(argv[2]) : 100;
+
+  if((fd = open(argv[1], O_CREATE|O_WRONLY)) < 0){
+    printf(2, "pcapdump: cannot open %s\n", argv[1]);
+    exit();
+  }
+
+  fh.magic = PCAP_MAGIC;
+  fh.major = 2;
+  fh.minor = 4;
+  fh.thiszone = 0;
+  fh.sigfigs = 0;
+  fh.snaplen = PCAP_SNAPLEN;
+  fh.linktype = LINKTYPE_ETHER;
+  if(write(fd, &fh, sizeof(fh)) != sizeof(fh)){
+    printf(2, "pcapdump: write error\n");
+    exit();
+  }
+
+  if(pcapctl(PCAP_START, &st) < 0){
+    printf(2, "pcapdump: cannot start capture\n");
+    exit();
+  }
+
+  got = 0;
+  while(got < count && (n = pcapread(buf, sizeof(buf))) > 0){
+    for(off = 0; off < n && got < count; off += sizeof(r) + r.caplen){
+      memmove(&r, buf + off, sizeof(r));
+      us = udiv64((r.tsc - st.start) * 1000, st.tsckhz, 0);
+      ph.sec = udiv64(us, 1000000, &rem);
+      ph.usec = rem;
+      ph.caplen = r.caplen;
+      ph.len = r.len;
+      if(write(fd, &ph, sizeof(ph)) != sizeof(ph) ||
+         write(fd, buf + off + sizeof(r), r.caplen) != r.caplen){
+        printf(2, "pcapdump: %s is full\n", argv[1]);
+        count = got;
+        break;
+      }
+      got++;
+    }
+  }
+
+  pcapctl(PCAP_STOP, &st);
+  close(fd);
+  printf(1, "%d frames written, %d captured, %d dropped by the kernel\n",
+         got, st.captured, st.dropped);
+  exit();
+}
@@ -1,13 +1,24 @@
 #include <stddef.h>
 #include "pci.h"
 #include "defs.h"
+#include "spinlock.h"
 #include "virtio.h"
 #include "pciregisters.h"
 #include "memlayout.h"
+#include "acpi.h"
 
 extern struct pci_device pcidevs[NPCI] = {0};
 extern int pcikeys[NPCI] = {0};
 
+struct pci_ecam pci_ecam;
+
+// Buses found so far, the root bus is the first.
+static struct pci_bus pcibuses[NPCIBUS];
+static int npcibus;
+
+static struct pci_driver pci_drivers[NPCIDRIVER];
+static int npcidriver;
+
 int alloc_pci()
 {
     struct pci_device* dev;
@@ -28,9 +39,9 @@ found:
 
 void free_pci(int fd)
 {
-    struct pci_device dev = pcidevs[fd];
-    memset(&dev, 0, sizeof(struct pci_device));
-    dev.state = PCI_FREE;
+    struct pci_device* dev = &pcidevs[fd];
+    memset(dev, 0, sizeof(struct pci_device));
+    dev->state = PCI_FREE;
 }
 
 int get_pci_dev(int dev_class)
@@ -68,7 +79,8 @@ char* PCI_CLASSES[18] = {
  */
 static void log_pci_device(struct pci_device *dev)
 {
-    char *class = PCI_CLASSES[PCI_CLASS(dev->dev_class)];
+    char *class = PCI_CLASS(dev->dev_class) < NELEM(PCI_CLASSES) ?
+        PCI_CLASSES[PCI_CLASS(dev->dev_class)] : "Other";
     uint32 bus_num = dev->bus->bus_num;
     uint32 dev_id = dev->dev;
     uint32 func = dev->func;
@@ -100,7 +112,9 @@ int read_dev_bars(struct pci_device* f)
 {
 	uint32_t bar_width;
 	uint32_t bar;
-	for (bar = PCI_MAPREG_START; bar < PCI_MAPREG_END; bar += bar_width) {
+	uint32_t end = IS_PCI_HDRTYPE_PPB(confread32(f, PCI_BHLC_REG)) ?
+		PCI_MAPREG_PPB_END : PCI_MAPREG_END;
+	for (bar = PCI_MAPREG_START; bar < end; bar += bar_width) {
 		uint32_t oldv = confread32(f, bar);
 
 		bar_width = 4;
@@ -147,6 +161,17 @@ int read_dev_bars(struct pci_device* f)
 }
 
 
+/*
+ * Lets the function decode its I/O ports and do DMA, for drivers of
+ * devices without capabilities, which don't go through config_pci.
+ */
+void pci_set_master(struct pci_device* device)
+{
+    uint16 cmd = confread16(device, PCI_COMMAND_STATUS_REG);
+    conf_write16(device, PCI_COMMAND_STATUS_REG,
+            cmd | PCI_COMMAND_IO_ENABLE | PCI_COMMAND_MASTER_ENABLE);
+}
+
 void log_pci_cap(uint8 type, uint8 bar, uint32 offset)
 {
     switch (type) {
@@ -196,14 +221,31 @@ int config_pci(struct pci_device* device)
 
     while (cap_pointer) {
         next = confread8(device, cap_pointer + PCI_CAP_NEXT) & PCI_CAP_MASK;
+
+        // Only the vendor capabilities describe virtio structures, and
+        // only types up to VIRTIO_PCI_CAP_PCI_CFG are defined.
+        uint8 id = confread8(device, cap_pointer + PCI_CAP_TYPE);
         uint8 type = confread8(device, cap_pointer + PCI_CAP_CFG_TYPE);
+        if (id != PCI_CAP_ID_VNDR || type > VIRTIO_PCI_CAP_PCI_CFG) {
+            cap_pointer = next;
+            continue;
+        }
+
+        // A type may be repeated, the first one is the preferred one.
+        if (device->cap[type] != 0) {
+            cap_pointer = next;
+            continue;
+        }
+
         uint8 bar = confread8(device, cap_pointer + PCI_CAP_BAR);
         uint32 offset = confread32(device, cap_pointer + PCI_CAP_OFF);
+        uint32 length = confread32(device, cap_pointer + PCI_CAP_LEN);
 
         // Location of the given capability in the PCI config space.
         device->cap[type] = cap_pointer;
         device->cap_bar[type] = bar;
         device->cap_off[type] = offset;
+        device->cap_len[type] = length;
 
         // cprintf("cap type: %d pointer: %p\n", type, cap_pointer);
 
@@ -228,77 +270,185 @@ void setup_window(struct pci_device *dev, uint8 width, uint8 bar, uint32 field_o
 }
 
 
+/*
+ * Adds a driver to the match table. Returns -1 if the table is full.
+ */
+int pci_register_driver(struct pci_driver* driver)
+{
+    if (npcidriver == NPCIDRIVER) {
+        cprintf("PCI: no room for driver %s\n", driver->name);
+        return -1;
+    }
+    pci_drivers[npcidriver++] = *driver;
+    return 0;
+}
+
+static int pci_match(struct pci_driver* d, struct pci_device* f)
+{
+    return (d->vendor == PCI_ANY_ID || d->vendor == PCI_VENDOR(f->dev_id)) &&
+           (d->device == PCI_ANY_ID || d->device == PCI_PRODUCT(f->dev_id)) &&
+           (f->dev_class & d->class_mask) == (d->class & d->class_mask);
+}
+
+/*
+ * Offers the function to the drivers that match it.
+ */
+static void pci_attach(struct pci_device* f)
+{
+    struct pci_driver* d;
+
+    for (d = pci_drivers; d < pci_drivers + npcidriver; d++) {
+        if (pci_match(d, f) && d->probe(f) == 0) {
+            return;
+        }
+    }
+}
+
+static int pci_enumerate(struct pci_bus *bus);
+
+/*
+ * Enumerates the bus behind a PCI to PCI bridge, using the bus number
+ * the firmware gave it.
+ */
+static void pci_bridge(struct pci_device* bridge)
+{
+    uint32 secondary = PCI_BRIDGE_BUS_SECONDARY(confread32(bridge, PCI_BRIDGE_BUS_REG));
+
+    // Bus numbers grow away from the root, anything else would loop.
+    if (secondary <= bridge->bus->bus_num) {
+        cprintf("PCI: %x:%x.%d: bridge has no bus number\n",
+                bridge->bus->bus_num, bridge->dev, bridge->func);
+        return;
+    }
+    if (npcibus == NPCIBUS) {
+        cprintf("PCI: too many buses\n");
+        return;
+    }
+
+    struct pci_bus* bus = &pcibuses[npcibus++];
+    bus->parent_bridge = bridge;
+    bus->bus_num = secondary;
+    pci_enumerate(bus);
+}
+
+/*
+ * Finds the functions on `bus`, and on the buses behind its bridges, and
+ * hands them to their drivers. Returns the number of devices on the bus.
+ */
 static int pci_enumerate(struct pci_bus *bus)
 {
+    struct pci_device probe;
     int num_dev = 0;
-    int fd = alloc_pci();
-    struct pci_device dev_fn = pcidevs[fd];
-    memset(&dev_fn, 0, sizeof(dev_fn));
-    dev_fn.state = PCI_USED;
-    dev_fn.bus = bus;
 
-    for (dev_fn.dev = 0; dev_fn.dev < PCI_MAX_DEVICES; dev_fn.dev++) {
-        uint32 bhcl = confread32(&dev_fn, PCI_BHLC_REG);
+    memset(&probe, 0, sizeof(probe));
+    probe.bus = bus;
+
+    for (probe.dev = 0; probe.dev < PCI_MAX_DEVICES; probe.dev++) {
+        probe.func = 0;
 
-        if (PCI_HDRTYPE_TYPE(bhcl) > 1) {
+        // 0xffff is an invalid vendor ID
+        if (PCI_VENDOR_ID(confread32(&probe, PCI_ID_REG)) == 0xffff) {
             continue;
         }
 
         num_dev++;
 
-        struct pci_device fn = dev_fn;
+        uint32 bhlc = confread32(&probe, PCI_BHLC_REG);
+        uint32 nfunc = PCI_HDRTYPE_MULTIFN(bhlc) ? 8 : 1;
 
         // Configure the device functions
-        for (fn.func = 0; fn.func < (PCI_HDRTYPE_MULTIFN(bhcl) ? 8 : 1); fn.func++) {
-            int individual_fd = alloc_pci();
-            struct pci_device* individual_fn = &pcidevs[individual_fd];
-            memmove(individual_fn, &fn, sizeof(struct pci_device));
-
-            individual_fn->dev_id = confread32(&fn, PCI_ID_REG);
+        for (probe.func = 0; probe.func < nfunc; probe.func++) {
+            uint32 id = confread32(&probe, PCI_ID_REG);
+            if (PCI_VENDOR_ID(id) == 0xffff) {
+                continue;
+            }
 
-            // 0xffff is an invalid vendor ID
-            if (PCI_VENDOR_ID(individual_fn->dev_id) == 0xffff) {
-                free_pci(individual_fd);
+            // CardBus bridges are not supported.
+            uint32 type = PCI_HDRTYPE_TYPE(confread32(&probe, PCI_BHLC_REG));
+            if (type > PCI_HDRTYPE_PPB) {
                 continue;
             }
 
-            uint32 intr = confread32(individual_fn, PCI_INTERRUPT_REG);
-            individual_fn->irq_line = PCI_INTERRUPT_LINE(intr);
-            individual_fn->irq_pin = PCI_INTERRUPT_PIN(intr);
+            int fd = alloc_pci();
+            if (fd < 0) {
+                cprintf("PCI: too many functions\n");
+                return num_dev;
+            }
+            struct pci_device* f = &pcidevs[fd];
+            memmove(f, &probe, sizeof(struct pci_device));
+            f->state = PCI_USED;
+            f->dev_id = id;
+
+            uint32 intr = confread32(f, PCI_INTERRUPT_REG);
+            f->irq_line = PCI_INTERRUPT_LINE(intr);
+            f->irq_pin = PCI_INTERRUPT_PIN(intr);
 
-            individual_fn->dev_class = confread32(individual_fn, PCI_CLASS_REG);
+            f->dev_class = confread32(f, PCI_CLASS_REG);
 
             // populate BAR information.
-            read_dev_bars(individual_fn);
-
-            if (PCI_VENDOR_ID(individual_fn->dev_id) == VIRTIO_VENDOR_ID) {
-                switch(PCI_DEVICE_ID(individual_fn->dev_id)) {
-                    case (T_NETWORK_CARD):
-                        cprintf("We have a transitional network device.\n");
-                        config_pci(individual_fn);
-
-                        // store the index to where the pci_device struct is
-                        // stored in the pcidevs slab.
-                        pcikeys[PCI_CLASS(individual_fn->dev_class)] = individual_fd;
-                        break;
-                    default:
-                        cprintf("We have some other transitional device.\n");
-                }
-            } else {
-                pcikeys[PCI_CLASS(individual_fn->dev_class)] = individual_fd;
+            read_dev_bars(f);
+
+            log_pci_device(f);
+
+            // store the index to where the pci_device struct is
+            // stored in the pcidevs slab.
+            pcikeys[PCI_CLASS(f->dev_class)] = fd;
+
+            if (type == PCI_HDRTYPE_PPB) {
+                pci_bridge(f);
             }
 
-            log_pci_device(individual_fn);
+            pci_attach(f);
         }
     }
     return num_dev;
 
 }
 
+/*
+ * Maps the ECAM region of PCI segment 0 if the ACPI MCFG table has one.
+ * Machines without it (qemu's default pc machine, for one) keep using
+ * the config ports.
+ */
+static void pci_ecam_init(void)
+{
+    struct acpi_mcfg* mcfg = acpitable("MCFG");
+    struct acpi_mcfg_entry* e;
+    int n;
+
+    if (mcfg == 0) {
+        return;
+    }
+
+    n = (mcfg->h.length - sizeof(*mcfg)) / sizeof(mcfg->entry[0]);
+    for (e = mcfg->entry; e < mcfg->entry + n; e++) {
+        // Only memory the kernel can map, and only the segment the
+        // config ports reach.
+        if (e->segment != 0 || e->base_hi != 0 || e->start_bus > e->end_bus) {
+            continue;
+        }
+
+        uint32 base = e->base_lo + PCI_ECAM_OFF(e->start_bus, 0, 0, 0);
+        uint32 size = (e->end_bus - e->start_bus + 1) << 20;
+        volatile uint8* va = ioremap(base, size, IOREMAP_UC);
+        if (va == 0) {
+            cprintf("PCI: no room to map ECAM at %x\n", base);
+            return;
+        }
+
+        pci_ecam.start_bus = e->start_bus;
+        pci_ecam.end_bus = e->end_bus;
+        pci_ecam.base = va;
+        cprintf("PCI: ECAM at %x for buses %d-%d\n", base, e->start_bus, e->end_bus);
+        return;
+    }
+}
+
 int pci_init(void)
 {
-    static struct pci_bus root;
-    memset(&root, 0, sizeof(root));
+    struct pci_bus* root = &pcibuses[npcibus++];
+
+    pci_ecam_init();
 
-    return pci_enumerate(&root);
+    return pci_enumerate(root);
 }
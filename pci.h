@@ -1,3 +1,6 @@
+#ifndef __XV6_PCI_H__
+#define __XV6_PCI_H__
+
 #include "types.h"
 #include "x86.h"
 
@@ -9,6 +12,9 @@
 #define PCI_CONFIG_ADDR             0xCF8
 #define PCI_CONFIG_DATA             0xCFC
 
+// Subsystem vendor id in the low and subsystem id in the high 16 bits
+#define PCI_SUBSYS_REG              0x2c
+
 // Forward declaration
 struct pci_device;
 
@@ -51,6 +57,7 @@ struct pci_device {
     uint8 cap[6]; // Maps cap type to offset within the pci config space.
     uint8 cap_bar[6]; // Maps cap type to their BAR number
     uint32 cap_off[6]; // Map cap type to offset within bar
+    uint32 cap_len[6]; // Map cap type to length of the structure
 
     uint8 irq_line;
     uint8 irq_pin;
@@ -58,7 +65,26 @@ struct pci_device {
     uint32 iobase;
 };
 
-#define NPCI                        50
+#define NPCI                        64
+#define NPCIBUS                     16
+#define NPCIDRIVER                  16
+
+/*
+ * A driver for PCI functions, registered with pci_register_driver
+ * before pci_init. Every function pci_init finds is offered to the
+ * drivers that match it, in the order they registered, until a probe
+ * returns 0.
+ */
+#define PCI_ANY_ID                  0xffff
+
+struct pci_driver {
+    char* name;
+    uint16 vendor;          // vendor id, or PCI_ANY_ID
+    uint16 device;          // device id, or PCI_ANY_ID
+    uint32 class;           // class, subclass and interface as in PCI_CLASS_REG,
+    uint32 class_mask;      // compared under this mask; 0 matches any class
+    int (*probe)(struct pci_device* dev);
+};
 
 extern struct pci_device pcidevs[NPCI];
 extern int pcikeys[NPCI];
@@ -101,30 +127,100 @@ extern char* PCI_CLASSES[18];
 
 
 
+/*
+ * PCI express enhanced configuration access mechanism (ECAM)
+ *
+ * With ECAM the 4K config space of every function is memory mapped, at
+ * (bus << 20 | dev << 15 | func << 12) from the base of the region the
+ * ACPI MCFG table describes. An access is a single load or store
+ * instead of an address and a data port access. pci_ecam_init maps the
+ * region if the machine has one, the accessors below fall back to
+ * mechanism 1 for buses it doesn't cover.
+ */
+struct pci_ecam {
+    volatile uint8* base;   // config space of start_bus, 0 if there is no ECAM
+    uint32 start_bus;
+    uint32 end_bus;
+};
+
+extern struct pci_ecam pci_ecam;
+
+#define PCI_ECAM_OFF(bus, dev, fn, off) ((bus) << 20 | (dev) << 15 | (fn) << 12 | (off))
+
+// Mechanism 1 only reaches the first 256 bytes of the config space
+#define PCI_CONF_SIZE               256
+#define PCIE_CONF_SIZE              4096
+
+/*
+ * Returns the address of register `off` of `dev` in the ECAM region,
+ * or 0 if it has to be accessed through the ports.
+ */
+static inline volatile uint8* ecam_addr(struct pci_device *dev, uint32 off)
+{
+    uint32 bus = dev->bus->bus_num;
+
+    if (pci_ecam.base == 0 || bus < pci_ecam.start_bus || bus > pci_ecam.end_bus) {
+        return 0;
+    }
+    return pci_ecam.base + PCI_ECAM_OFF(bus - pci_ecam.start_bus, dev->dev, dev->func, off);
+}
+
 /*
  * Reads the register at offset `off` in the PCI config space of the device
- * `dev`
+ * `dev`. Registers of the extended config space read as all ones without
+ * ECAM.
  */
 static inline uint32 confread32(struct pci_device *dev, uint32 off)
 {
+    volatile uint8* a = ecam_addr(dev, off);
+
+    if (a) {
+        return *(volatile uint32*)a;
+    }
+    if (off >= PCI_CONF_SIZE) {
+        return 0xffffffff;
+    }
     return PCI_CONF_READ32(dev->bus->bus_num, dev->dev, dev->func, off);
 }
 
 static inline uint32 confread16(struct pci_device *dev, uint32 off)
 {
+    volatile uint8* a = ecam_addr(dev, off);
+
+    if (a) {
+        return *(volatile uint16*)a;
+    }
+    if (off >= PCI_CONF_SIZE) {
+        return 0xffff;
+    }
     return PCI_CONF_READ16(dev->bus->bus_num, dev->dev, dev->func, off);
 }
 
 static inline uint32 confread8(struct pci_device *dev, uint32 off) {
+    volatile uint8* a = ecam_addr(dev, off);
+
+    if (a) {
+        return *a;
+    }
+    if (off >= PCI_CONF_SIZE) {
+        return 0xff;
+    }
     return PCI_CONF_READ8(dev->bus->bus_num, dev->dev, dev->func, off);
 }
 
 /*
- * Writes the provided value `value` at the register `off` for the device `dev`
+ * Writes the provided value `value` at the register `off` for the device `dev`.
+ * Writes to the extended config space are dropped without ECAM.
  */
 static inline void conf_write32(struct pci_device *dev, uint32 off, uint32 value)
 {
-    return PCI_CONF_WRITE32(dev->bus->bus_num, dev->dev, dev->func, off, value);
+    volatile uint8* a = ecam_addr(dev, off);
+
+    if (a) {
+        *(volatile uint32*)a = value;
+    } else if (off < PCI_CONF_SIZE) {
+        PCI_CONF_WRITE32(dev->bus->bus_num, dev->dev, dev->func, off, value);
+    }
 }
 
 /*
@@ -132,7 +228,13 @@ static inline void conf_write32(struct pci_device *dev, uint32 off, uint32 value
  */
 static inline void conf_write16(struct pci_device *dev, uint32 off, uint16 value)
 {
-    return PCI_CONF_WRITE16(dev->bus->bus_num, dev->dev, dev->func, off, value);
+    volatile uint8* a = ecam_addr(dev, off);
+
+    if (a) {
+        *(volatile uint16*)a = value;
+    } else if (off < PCI_CONF_SIZE) {
+        PCI_CONF_WRITE16(dev->bus->bus_num, dev->dev, dev->func, off, value);
+    }
 }
 
 /*
@@ -140,6 +242,13 @@ static inline void conf_write16(struct pci_device *dev, uint32 off, uint16 value
  */
 static inline void conf_write8(struct pci_device *dev, uint32 off, uint8 value)
 {
-    return PCI_CONF_WRITE8(dev->bus->bus_num, dev->dev, dev->func, off, value);
+    volatile uint8* a = ecam_addr(dev, off);
+
+    if (a) {
+        *a = value;
+    } else if (off < PCI_CONF_SIZE) {
+        PCI_CONF_WRITE8(dev->bus->bus_num, dev->dev, dev->func, off, value);
+    }
 }
 
+#endif
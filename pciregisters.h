@@ -12,10 +12,12 @@ unsigned int create_mask(int start, int offset) {
 #define PCI_CAP_MASK                0xfc
 
 #define PCI_CAP_TYPE                0
+#define PCI_CAP_ID_VNDR             0x09 // vendor specific, virtio uses these
 #define PCI_CAP_NEXT                1
 #define PCI_CAP_CFG_TYPE            3
 #define PCI_CAP_BAR                 4
 #define PCI_CAP_OFF                 8 // 05 byte is padding
+#define PCI_CAP_LEN                 12
 #define PCI_CAP_POINTER(reg) \
     (reg & create_mask(0, 8))
 
@@ -76,6 +78,9 @@ unsigned int create_mask(int start, int offset) {
 #define	PCI_HDRTYPE_TYPE(bhlcr) \
 	    (PCI_HDRTYPE(bhlcr) & 0x7f)
 
+#define PCI_HDRTYPE_DEVICE  0
+#define PCI_HDRTYPE_PPB     1  // PCI to PCI bridge
+
 #define IS_PCI_HDRTYPE_PPB(bhlcr) \
       (PCI_HDRTYPE_TYPE(bhlcr) == PCI_HDRTYPE_PPB)
 
@@ -141,6 +146,18 @@ unsigned int create_mask(int start, int offset) {
  */
 #define	PCI_MAPREG_START		0x10
 #define	PCI_MAPREG_END			0x28
+#define	PCI_MAPREG_PPB_END		0x18  // bridges only have two
+
+/*
+ * Bus numbers of a PCI to PCI bridge: the bus it is on, the bus behind
+ * it and the highest bus number below it.
+ */
+#define	PCI_BRIDGE_BUS_REG		0x18
+
+#define	PCI_BRIDGE_BUS_SECONDARY(br) \
+	    (((br) >> 8) & 0xff)
+#define	PCI_BRIDGE_BUS_SUBORDINATE(br) \
+	    (((br) >> 16) & 0xff)
 
 #define PCI_MAPREG_NUM(offset)						\
 (((unsigned)(offset)-PCI_MAPREG_START)/4)
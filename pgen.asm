@@ -0,0 +1,1966 @@
+
+_pgen:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <usage>:
+#include "user.h"
+#include "pktgen.h"
+
+static void
+usage(void)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 08             	sub    $0x8,%esp
+  printf(2, "usage: pgen [-i ifindex] [-n count] [-s size] [-r pps] [-d dstmac]\n"
+   6:	83 ec 08             	sub    $0x8,%esp
+   9:	68 e0 0f 00 00       	push   $0xfe0
+   e:	6a 02                	push   $0x2
+  10:	e8 ef 0b 00 00       	call   c04 <printf>
+  15:	83 c4 10             	add    $0x10,%esp
+            "            [-m nsrcmac] [-a srcip] [-A nsrcip] [-b dstip] [-B ndstip] [-l]\n"
+            "       pgen -R ifindex on|off\n");
+  exit();
+  18:	e8 2b 0a 00 00       	call   a48 <exit>
+
+0000001d <hexdigit>:
+}
+
+static int
+hexdigit(char c)
+{
+  1d:	55                   	push   %ebp
+  1e:	89 e5                	mov    %esp,%ebp
+  20:	83 ec 04             	sub    $0x4,%esp
+  23:	8b 45 08             	mov    0x8(%ebp),%eax
+  26:	88 45 fc             	mov    %al,-0x4(%ebp)
+  if(c >= '0' && c <= '9')
+  29:	80 7d fc 2f          	cmpb   $0x2f,-0x4(%ebp)
+  2d:	7e 0f                	jle    3e <hexdigit+0x21>
+  2f:	80 7d fc 39          	cmpb   $0x39,-0x4(%ebp)
+  33:	7f 09                	jg     3e <hexdigit+0x21>
+    return c - '0';
+  35:	0f be 45 fc          	movsbl -0x4(%ebp),%eax
+  39:	83 e8 30             	sub    $0x30,%eax
+  3c:	eb 2f                	jmp    6d <hexdigit+0x50>
+  if(c >= 'a' && c <= 'f')
+  3e:	80 7d fc 60          	cmpb   $0x60,-0x4(%ebp)
+  42:	7e 0f                	jle    53 <hexdigit+0x36>
+  44:	80 7d fc 66          	cmpb   $0x66,-0x4(%ebp)
+  48:	7f 09                	jg     53 <hexdigit+0x36>
+    return c - 'a' + 10;
+  4a:	0f be 45 fc          	movsbl -0x4(%ebp),%eax
+  4e:	83 e8 57             	sub    $0x57,%eax
+  51:	eb 1a                	jmp    6d <hexdigit+0x50>
+  if(c >= 'A' && c <= 'F')
+  53:	80 7d fc 40          	cmpb   $0x40,-0x4(%ebp)
+  57:	7e 0f                	jle    68 <hexdigit+0x4b>
+  59:	80 7d fc 46          	cmpb   $0x46,-0x4(%ebp)
+  5d:	7f 09                	jg     68 <hexdigit+0x4b>
+    return c - 'A' + 10;
+  5f:	0f be 45 fc          	movsbl -0x4(%ebp),%eax
+  63:	83 e8 37             	sub    $0x37,%eax
+  66:	eb 05                	jmp    6d <hexdigit+0x50>
+  return -1;
+  68:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+  6d:	c9                   	leave
+  6e:	c3                   	ret
+
+0000006f <parsemac>:
+
+// Parse aa:bb:cc:dd:ee:ff into mac.
+static int
+parsemac(char *s, uchar *mac)
+{
+  6f:	55                   	push   %ebp
+  70:	89 e5                	mov    %esp,%ebp
+  72:	83 ec 10             	sub    $0x10,%esp
+  int i, hi, lo;
+
+  for(i = 0; i < 6; i++){
+  75:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  7c:	e9 8d 00 00 00       	jmp    10e <parsemac+0x9f>
+    if((hi = hexdigit(s[0])) < 0 || (lo = hexdigit(s[1])) < 0)
+  81:	8b 45 08             	mov    0x8(%ebp),%eax
+  84:	0f b6 00             	movzbl (%eax),%eax
+  87:	0f be c0             	movsbl %al,%eax
+  8a:	50                   	push   %eax
+  8b:	e8 8d ff ff ff       	call   1d <hexdigit>
+  90:	83 c4 04             	add    $0x4,%esp
+  93:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  96:	83 7d f8 00          	cmpl   $0x0,-0x8(%ebp)
+  9a:	78 1e                	js     ba <parsemac+0x4b>
+  9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  9f:	83 c0 01             	add    $0x1,%eax
+  a2:	0f b6 00             	movzbl (%eax),%eax
+  a5:	0f be c0             	movsbl %al,%eax
+  a8:	50                   	push   %eax
+  a9:	e8 6f ff ff ff       	call   1d <hexdigit>
+  ae:	83 c4 04             	add    $0x4,%esp
+  b1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  b4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  b8:	79 07                	jns    c1 <parsemac+0x52>
+      return -1;
+  ba:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  bf:	eb 5c                	jmp    11d <parsemac+0xae>
+    mac[i] = hi << 4 | lo;
+  c1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  c4:	c1 e0 04             	shl    $0x4,%eax
+  c7:	89 c2                	mov    %eax,%edx
+  c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  cc:	89 d1                	mov    %edx,%ecx
+  ce:	09 c1                	or     %eax,%ecx
+  d0:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  d3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  d6:	01 d0                	add    %edx,%eax
+  d8:	89 ca                	mov    %ecx,%edx
+  da:	88 10                	mov    %dl,(%eax)
+    s += 2;
+  dc:	83 45 08 02          	addl   $0x2,0x8(%ebp)
+    if(*s != (i == 5 ? 0 : ':'))
+  e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  e3:	0f b6 00             	movzbl (%eax),%eax
+  e6:	0f be c0             	movsbl %al,%eax
+  e9:	83 7d fc 05          	cmpl   $0x5,-0x4(%ebp)
+  ed:	75 07                	jne    f6 <parsemac+0x87>
+  ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  f4:	eb 05                	jmp    fb <parsemac+0x8c>
+  f6:	ba 3a 00 00 00       	mov    $0x3a,%edx
+  fb:	39 c2                	cmp    %eax,%edx
+  fd:	74 07                	je     106 <parsemac+0x97>
+      return -1;
+  ff:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 104:	eb 17                	jmp    11d <parsemac+0xae>
+    s++;
+ 106:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  for(i = 0; i < 6; i++){
+ 10a:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 10e:	83 7d fc 05          	cmpl   $0x5,-0x4(%ebp)
+ 112:	0f 8e 69 ff ff ff    	jle    81 <parsemac+0x12>
+  }
+  return 0;
+ 118:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 11d:	c9                   	leave
+ 11e:	c3                   	ret
+
+0000011f <parseip>:
+
+// Parse a dotted quad into a host byte order address.
+static int
+parseip(char *s, uint *ip)
+{
+ 11f:	55                   	push   %ebp
+ 120:	89 e5                	mov    %esp,%ebp
+ 122:	83 ec 10             	sub    $0x10,%esp
+  int i, n;
+
+  *ip = 0;
+ 125:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 128:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  for(i = 0; i < 4; i++){
+ 12e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 135:	e9 a9 00 00 00       	jmp    1e3 <parseip+0xc4>
+    if(*s < '0' || *s > '9')
+ 13a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 13d:	0f b6 00             	movzbl (%eax),%eax
+ 140:	3c 2f                	cmp    $0x2f,%al
+ 142:	7e 0a                	jle    14e <parseip+0x2f>
+ 144:	8b 45 08             	mov    0x8(%ebp),%eax
+ 147:	0f b6 00             	movzbl (%eax),%eax
+ 14a:	3c 39                	cmp    $0x39,%al
+ 14c:	7e 0a                	jle    158 <parseip+0x39>
+      return -1;
+ 14e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 153:	e9 9a 00 00 00       	jmp    1f2 <parseip+0xd3>
+    for(n = 0; *s >= '0' && *s <= '9'; s++)
+ 158:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+ 15f:	eb 23                	jmp    184 <parseip+0x65>
+      n = n * 10 + *s - '0';
+ 161:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 164:	89 d0                	mov    %edx,%eax
+ 166:	c1 e0 02             	shl    $0x2,%eax
+ 169:	01 d0                	add    %edx,%eax
+ 16b:	01 c0                	add    %eax,%eax
+ 16d:	89 c2                	mov    %eax,%edx
+ 16f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 172:	0f b6 00             	movzbl (%eax),%eax
+ 175:	0f be c0             	movsbl %al,%eax
+ 178:	01 d0                	add    %edx,%eax
+ 17a:	83 e8 30             	sub    $0x30,%eax
+ 17d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    for(n = 0; *s >= '0' && *s <= '9'; s++)
+ 180:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 184:	8b 45 08             	mov    0x8(%ebp),%eax
+ 187:	0f b6 00             	movzbl (%eax),%eax
+ 18a:	3c 2f                	cmp    $0x2f,%al
+ 18c:	7e 0a                	jle    198 <parseip+0x79>
+ 18e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 191:	0f b6 00             	movzbl (%eax),%eax
+ 194:	3c 39                	cmp    $0x39,%al
+ 196:	7e c9                	jle    161 <parseip+0x42>
+    if(n > 255 || *s != (i == 3 ? 0 : '.'))
+ 198:	81 7d f8 ff 00 00 00 	cmpl   $0xff,-0x8(%ebp)
+ 19f:	7f 1f                	jg     1c0 <parseip+0xa1>
+ 1a1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a4:	0f b6 00             	movzbl (%eax),%eax
+ 1a7:	0f be c0             	movsbl %al,%eax
+ 1aa:	83 7d fc 03          	cmpl   $0x3,-0x4(%ebp)
+ 1ae:	75 07                	jne    1b7 <parseip+0x98>
+ 1b0:	ba 00 00 00 00       	mov    $0x0,%edx
+ 1b5:	eb 05                	jmp    1bc <parseip+0x9d>
+ 1b7:	ba 2e 00 00 00       	mov    $0x2e,%edx
+ 1bc:	39 c2                	cmp    %eax,%edx
+ 1be:	74 07                	je     1c7 <parseip+0xa8>
+      return -1;
+ 1c0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 1c5:	eb 2b                	jmp    1f2 <parseip+0xd3>
+    *ip = *ip << 8 | n;
+ 1c7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ca:	8b 00                	mov    (%eax),%eax
+ 1cc:	c1 e0 08             	shl    $0x8,%eax
+ 1cf:	89 c2                	mov    %eax,%edx
+ 1d1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 1d4:	09 c2                	or     %eax,%edx
+ 1d6:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1d9:	89 10                	mov    %edx,(%eax)
+    s++;
+ 1db:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  for(i = 0; i < 4; i++){
+ 1df:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 1e3:	83 7d fc 03          	cmpl   $0x3,-0x4(%ebp)
+ 1e7:	0f 8e 4d ff ff ff    	jle    13a <parseip+0x1b>
+  }
+  return 0;
+ 1ed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 1f2:	c9                   	leave
+ 1f3:	c3                   	ret
+
+000001f4 <main>:
+
+int
+main(int argc, char *argv[])
+{
+ 1f4:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 1f8:	83 e4 f0             	and    $0xfffffff0,%esp
+ 1fb:	ff 71 fc             	push   -0x4(%ecx)
+ 1fe:	55                   	push   %ebp
+ 1ff:	89 e5                	mov    %esp,%ebp
+ 201:	57                   	push   %edi
+ 202:	56                   	push   %esi
+ 203:	53                   	push   %ebx
+ 204:	51                   	push   %ecx
+ 205:	83 ec 68             	sub    $0x68,%esp
+ 208:	89 cb                	mov    %ecx,%ebx
+  struct pktgen_conf c;
+  struct pktgen_result r;
+  char *arg;
+  int i;
+
+  if(argc == 4 && strcmp(argv[1], "-R") == 0){
+ 20a:	83 3b 04             	cmpl   $0x4,(%ebx)
+ 20d:	0f 85 88 00 00 00    	jne    29b <main+0xa7>
+ 213:	8b 43 04             	mov    0x4(%ebx),%eax
+ 216:	83 c0 04             	add    $0x4,%eax
+ 219:	8b 00                	mov    (%eax),%eax
+ 21b:	83 ec 08             	sub    $0x8,%esp
+ 21e:	68 8e 10 00 00       	push   $0x108e
+ 223:	50                   	push   %eax
+ 224:	e8 ad 05 00 00       	call   7d6 <strcmp>
+ 229:	83 c4 10             	add    $0x10,%esp
+ 22c:	85 c0                	test   %eax,%eax
+ 22e:	75 6b                	jne    29b <main+0xa7>
+    if(reflect(atoi(argv[2]), strcmp(argv[3], "on") == 0) < 0){
+ 230:	8b 43 04             	mov    0x4(%ebx),%eax
+ 233:	83 c0 0c             	add    $0xc,%eax
+ 236:	8b 00                	mov    (%eax),%eax
+ 238:	83 ec 08             	sub    $0x8,%esp
+ 23b:	68 91 10 00 00       	push   $0x1091
+ 240:	50                   	push   %eax
+ 241:	e8 90 05 00 00       	call   7d6 <strcmp>
+ 246:	83 c4 10             	add    $0x10,%esp
+ 249:	85 c0                	test   %eax,%eax
+ 24b:	0f 94 c0             	sete   %al
+ 24e:	0f b6 f0             	movzbl %al,%esi
+ 251:	8b 43 04             	mov    0x4(%ebx),%eax
+ 254:	83 c0 08             	add    $0x8,%eax
+ 257:	8b 00                	mov    (%eax),%eax
+ 259:	83 ec 0c             	sub    $0xc,%esp
+ 25c:	50                   	push   %eax
+ 25d:	e8 27 05 00 00       	call   789 <atoi>
+ 262:	83 c4 10             	add    $0x10,%esp
+ 265:	83 ec 08             	sub    $0x8,%esp
+ 268:	56                   	push   %esi
+ 269:	50                   	push   %eax
+ 26a:	e8 a9 08 00 00       	call   b18 <reflect>
+ 26f:	83 c4 10             	add    $0x10,%esp
+ 272:	85 c0                	test   %eax,%eax
+ 274:	79 20                	jns    296 <main+0xa2>
+      printf(2, "pgen: no interface %s\n", argv[2]);
+ 276:	8b 43 04             	mov    0x4(%ebx),%eax
+ 279:	83 c0 08             	add    $0x8,%eax
+ 27c:	8b 00                	mov    (%eax),%eax
+ 27e:	83 ec 04             	sub    $0x4,%esp
+ 281:	50                   	push   %eax
+ 282:	68 94 10 00 00       	push   $0x1094
+ 287:	6a 02                	push   $0x2
+ 289:	e8 76 09 00 00       	call   c04 <printf>
+ 28e:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 291:	e8 b2 07 00 00       	call   a48 <exit>
+    }
+    exit();
+ 296:	e8 ad 07 00 00       	call   a48 <exit>
+  }
+
+  memset(&c, 0, sizeof(c));
+ 29b:	83 ec 04             	sub    $0x4,%esp
+ 29e:	6a 24                	push   $0x24
+ 2a0:	6a 00                	push   $0x0
+ 2a2:	8d 45 bc             	lea    -0x44(%ebp),%eax
+ 2a5:	50                   	push   %eax
+ 2a6:	e8 6c 03 00 00       	call   617 <memset>
+ 2ab:	83 c4 10             	add    $0x10,%esp
+  c.count = 1000;
+ 2ae:	c7 45 c0 e8 03 00 00 	movl   $0x3e8,-0x40(%ebp)
+  c.size = PKTGEN_MINSIZE;
+ 2b5:	c7 45 c4 3c 00 00 00 	movl   $0x3c,-0x3c(%ebp)
+  memset(c.dst, 0xff, 6);
+ 2bc:	83 ec 04             	sub    $0x4,%esp
+ 2bf:	6a 06                	push   $0x6
+ 2c1:	68 ff 00 00 00       	push   $0xff
+ 2c6:	8d 45 bc             	lea    -0x44(%ebp),%eax
+ 2c9:	83 c0 10             	add    $0x10,%eax
+ 2cc:	50                   	push   %eax
+ 2cd:	e8 45 03 00 00       	call   617 <memset>
+ 2d2:	83 c4 10             	add    $0x10,%esp
+  parseip("10.0.0.2", &c.srcip);
+ 2d5:	83 ec 08             	sub    $0x8,%esp
+ 2d8:	8d 45 bc             	lea    -0x44(%ebp),%eax
+ 2db:	83 c0 18             	add    $0x18,%eax
+ 2de:	50                   	push   %eax
+ 2df:	68 ab 10 00 00       	push   $0x10ab
+ 2e4:	e8 36 fe ff ff       	call   11f <parseip>
+ 2e9:	83 c4 10             	add    $0x10,%esp
+  parseip("10.0.0.1", &c.dstip);
+ 2ec:	83 ec 08             	sub    $0x8,%esp
+ 2ef:	8d 45 bc             	lea    -0x44(%ebp),%eax
+ 2f2:	83 c0 1c             	add    $0x1c,%eax
+ 2f5:	50                   	push   %eax
+ 2f6:	68 b4 10 00 00       	push   $0x10b4
+ 2fb:	e8 1f fe ff ff       	call   11f <parseip>
+ 300:	83 c4 10             	add    $0x10,%esp
+
+  for(i = 1; i < argc; i++){
+ 303:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+ 30a:	e9 dd 01 00 00       	jmp    4ec <main+0x2f8>
+    if(argv[i][0] != '-' || argv[i][1] == 0 || argv[i][2] != 0)
+ 30f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 312:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 319:	8b 43 04             	mov    0x4(%ebx),%eax
+ 31c:	01 d0                	add    %edx,%eax
+ 31e:	8b 00                	mov    (%eax),%eax
+ 320:	0f b6 00             	movzbl (%eax),%eax
+ 323:	3c 2d                	cmp    $0x2d,%al
+ 325:	75 36                	jne    35d <main+0x169>
+ 327:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 32a:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 331:	8b 43 04             	mov    0x4(%ebx),%eax
+ 334:	01 d0                	add    %edx,%eax
+ 336:	8b 00                	mov    (%eax),%eax
+ 338:	83 c0 01             	add    $0x1,%eax
+ 33b:	0f b6 00             	movzbl (%eax),%eax
+ 33e:	84 c0                	test   %al,%al
+ 340:	74 1b                	je     35d <main+0x169>
+ 342:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 345:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 34c:	8b 43 04             	mov    0x4(%ebx),%eax
+ 34f:	01 d0                	add    %edx,%eax
+ 351:	8b 00                	mov    (%eax),%eax
+ 353:	83 c0 02             	add    $0x2,%eax
+ 356:	0f b6 00             	movzbl (%eax),%eax
+ 359:	84 c0                	test   %al,%al
+ 35b:	74 05                	je     362 <main+0x16e>
+      usage();
+ 35d:	e8 9e fc ff ff       	call   0 <usage>
+    if(argv[i][1] == 'l'){
+ 362:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 365:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 36c:	8b 43 04             	mov    0x4(%ebx),%eax
+ 36f:	01 d0                	add    %edx,%eax
+ 371:	8b 00                	mov    (%eax),%eax
+ 373:	83 c0 01             	add    $0x1,%eax
+ 376:	0f b6 00             	movzbl (%eax),%eax
+ 379:	3c 6c                	cmp    $0x6c,%al
+ 37b:	75 09                	jne    386 <main+0x192>
+      c.latency = 1;
+ 37d:	c6 45 d3 01          	movb   $0x1,-0x2d(%ebp)
+      continue;
+ 381:	e9 62 01 00 00       	jmp    4e8 <main+0x2f4>
+    }
+    if(i + 1 == argc)
+ 386:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 389:	83 c0 01             	add    $0x1,%eax
+ 38c:	39 03                	cmp    %eax,(%ebx)
+ 38e:	75 05                	jne    395 <main+0x1a1>
+      usage();
+ 390:	e8 6b fc ff ff       	call   0 <usage>
+    arg = argv[++i];
+ 395:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+ 399:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 39c:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 3a3:	8b 43 04             	mov    0x4(%ebx),%eax
+ 3a6:	01 d0                	add    %edx,%eax
+ 3a8:	8b 00                	mov    (%eax),%eax
+ 3aa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch(argv[i-1][1]){
+ 3ad:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 3b0:	05 ff ff ff 3f       	add    $0x3fffffff,%eax
+ 3b5:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 3bc:	8b 43 04             	mov    0x4(%ebx),%eax
+ 3bf:	01 d0                	add    %edx,%eax
+ 3c1:	8b 00                	mov    (%eax),%eax
+ 3c3:	83 c0 01             	add    $0x1,%eax
+ 3c6:	0f b6 00             	movzbl (%eax),%eax
+ 3c9:	0f be c0             	movsbl %al,%eax
+ 3cc:	83 e8 41             	sub    $0x41,%eax
+ 3cf:	83 f8 32             	cmp    $0x32,%eax
+ 3d2:	0f 87 02 01 00 00    	ja     4da <main+0x2e6>
+ 3d8:	8b 04 85 74 11 00 00 	mov    0x1174(,%eax,4),%eax
+ 3df:	ff e0                	jmp    *%eax
+    case 'i': c.ifindex = atoi(arg); break;
+ 3e1:	83 ec 0c             	sub    $0xc,%esp
+ 3e4:	ff 75 e0             	push   -0x20(%ebp)
+ 3e7:	e8 9d 03 00 00       	call   789 <atoi>
+ 3ec:	83 c4 10             	add    $0x10,%esp
+ 3ef:	89 45 bc             	mov    %eax,-0x44(%ebp)
+ 3f2:	e9 f1 00 00 00       	jmp    4e8 <main+0x2f4>
+    case 'n': c.count = atoi(arg); break;
+ 3f7:	83 ec 0c             	sub    $0xc,%esp
+ 3fa:	ff 75 e0             	push   -0x20(%ebp)
+ 3fd:	e8 87 03 00 00       	call   789 <atoi>
+ 402:	83 c4 10             	add    $0x10,%esp
+ 405:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 408:	e9 db 00 00 00       	jmp    4e8 <main+0x2f4>
+    case 's': c.size = atoi(arg); break;
+ 40d:	83 ec 0c             	sub    $0xc,%esp
+ 410:	ff 75 e0             	push   -0x20(%ebp)
+ 413:	e8 71 03 00 00       	call   789 <atoi>
+ 418:	83 c4 10             	add    $0x10,%esp
+ 41b:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 41e:	e9 c5 00 00 00       	jmp    4e8 <main+0x2f4>
+    case 'r': c.rate = atoi(arg); break;
+ 423:	83 ec 0c             	sub    $0xc,%esp
+ 426:	ff 75 e0             	push   -0x20(%ebp)
+ 429:	e8 5b 03 00 00       	call   789 <atoi>
+ 42e:	83 c4 10             	add    $0x10,%esp
+ 431:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 434:	e9 af 00 00 00       	jmp    4e8 <main+0x2f4>
+    case 'm': c.nsrcmac = atoi(arg); break;
+ 439:	83 ec 0c             	sub    $0xc,%esp
+ 43c:	ff 75 e0             	push   -0x20(%ebp)
+ 43f:	e8 45 03 00 00       	call   789 <atoi>
+ 444:	83 c4 10             	add    $0x10,%esp
+ 447:	88 45 d2             	mov    %al,-0x2e(%ebp)
+ 44a:	e9 99 00 00 00       	jmp    4e8 <main+0x2f4>
+    case 'A': c.nsrcip = atoi(arg); break;
+ 44f:	83 ec 0c             	sub    $0xc,%esp
+ 452:	ff 75 e0             	push   -0x20(%ebp)
+ 455:	e8 2f 03 00 00       	call   789 <atoi>
+ 45a:	83 c4 10             	add    $0x10,%esp
+ 45d:	66 89 45 dc          	mov    %ax,-0x24(%ebp)
+ 461:	e9 82 00 00 00       	jmp    4e8 <main+0x2f4>
+    case 'B': c.ndstip = atoi(arg); break;
+ 466:	83 ec 0c             	sub    $0xc,%esp
+ 469:	ff 75 e0             	push   -0x20(%ebp)
+ 46c:	e8 18 03 00 00       	call   789 <atoi>
+ 471:	83 c4 10             	add    $0x10,%esp
+ 474:	66 89 45 de          	mov    %ax,-0x22(%ebp)
+ 478:	eb 6e                	jmp    4e8 <main+0x2f4>
+    case 'd':
+      if(parsemac(arg, c.dst) < 0)
+ 47a:	83 ec 08             	sub    $0x8,%esp
+ 47d:	8d 45 bc             	lea    -0x44(%ebp),%eax
+ 480:	83 c0 10             	add    $0x10,%eax
+ 483:	50                   	push   %eax
+ 484:	ff 75 e0             	push   -0x20(%ebp)
+ 487:	e8 e3 fb ff ff       	call   6f <parsemac>
+ 48c:	83 c4 10             	add    $0x10,%esp
+ 48f:	85 c0                	test   %eax,%eax
+ 491:	79 4e                	jns    4e1 <main+0x2ed>
+        usage();
+ 493:	e8 68 fb ff ff       	call   0 <usage>
+      break;
+ 498:	eb 47                	jmp    4e1 <main+0x2ed>
+    case 'a':
+      if(parseip(arg, &c.srcip) < 0)
+ 49a:	83 ec 08             	sub    $0x8,%esp
+ 49d:	8d 45 bc             	lea    -0x44(%ebp),%eax
+ 4a0:	83 c0 18             	add    $0x18,%eax
+ 4a3:	50                   	push   %eax
+ 4a4:	ff 75 e0             	push   -0x20(%ebp)
+ 4a7:	e8 73 fc ff ff       	call   11f <parseip>
+ 4ac:	83 c4 10             	add    $0x10,%esp
+ 4af:	85 c0                	test   %eax,%eax
+ 4b1:	79 31                	jns    4e4 <main+0x2f0>
+        usage();
+ 4b3:	e8 48 fb ff ff       	call   0 <usage>
+      break;
+ 4b8:	eb 2a                	jmp    4e4 <main+0x2f0>
+    case 'b':
+      if(parseip(arg, &c.dstip) < 0)
+ 4ba:	83 ec 08             	sub    $0x8,%esp
+ 4bd:	8d 45 bc             	lea    -0x44(%ebp),%eax
+ 4c0:	83 c0 1c             	add    $0x1c,%eax
+ 4c3:	50                   	push   %eax
+ 4c4:	ff 75 e0             	push   -0x20(%ebp)
+ 4c7:	e8 53 fc ff ff       	call   11f <parseip>
+ 4cc:	83 c4 10             	add    $0x10,%esp
+ 4cf:	85 c0                	test   %eax,%eax
+ 4d1:	79 14                	jns    4e7 <main+0x2f3>
+        usage();
+ 4d3:	e8 28 fb ff ff       	call   0 <usage>
+      break;
+ 4d8:	eb 0d                	jmp    4e7 <main+0x2f3>
+    default:
+      usage();
+ 4da:	e8 21 fb ff ff       	call   0 <usage>
+ 4df:	eb 07                	jmp    4e8 <main+0x2f4>
+      break;
+ 4e1:	90                   	nop
+ 4e2:	eb 04                	jmp    4e8 <main+0x2f4>
+      break;
+ 4e4:	90                   	nop
+ 4e5:	eb 01                	jmp    4e8 <main+0x2f4>
+      break;
+ 4e7:	90                   	nop
+  for(i = 1; i < argc; i++){
+ 4e8:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+ 4ec:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 4ef:	3b 03                	cmp    (%ebx),%eax
+ 4f1:	0f 8c 18 fe ff ff    	jl     30f <main+0x11b>
+    }
+  }
+
+  if(pktgen(&c, &r) < 0){
+ 4f7:	83 ec 08             	sub    $0x8,%esp
+ 4fa:	8d 45 94             	lea    -0x6c(%ebp),%eax
+ 4fd:	50                   	push   %eax
+ 4fe:	8d 45 bc             	lea    -0x44(%ebp),%eax
+ 501:	50                   	push   %eax
+ 502:	e8 09 06 00 00       	call   b10 <pktgen>
+ 507:	83 c4 10             	add    $0x10,%esp
+ 50a:	85 c0                	test   %eax,%eax
+ 50c:	79 17                	jns    525 <main+0x331>
+    printf(2, "pgen: cannot start, is another run in progress?\n");
+ 50e:	83 ec 08             	sub    $0x8,%esp
+ 511:	68 c0 10 00 00       	push   $0x10c0
+ 516:	6a 02                	push   $0x2
+ 518:	e8 e7 06 00 00       	call   c04 <printf>
+ 51d:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 520:	e8 23 05 00 00       	call   a48 <exit>
+  }
+
+  printf(1, "sent %d frames of %d bytes in %d us: %d pps, %d dropped\n",
+ 525:	8b 75 98             	mov    -0x68(%ebp),%esi
+ 528:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+ 52b:	8b 4d 9c             	mov    -0x64(%ebp),%ecx
+ 52e:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+ 531:	8b 45 94             	mov    -0x6c(%ebp),%eax
+ 534:	83 ec 04             	sub    $0x4,%esp
+ 537:	56                   	push   %esi
+ 538:	53                   	push   %ebx
+ 539:	51                   	push   %ecx
+ 53a:	52                   	push   %edx
+ 53b:	50                   	push   %eax
+ 53c:	68 f4 10 00 00       	push   $0x10f4
+ 541:	6a 01                	push   $0x1
+ 543:	e8 bc 06 00 00       	call   c04 <printf>
+ 548:	83 c4 20             	add    $0x20,%esp
+         r.sent, c.size, r.usecs, r.pps, r.dropped);
+  if(c.latency){
+ 54b:	0f b6 45 d3          	movzbl -0x2d(%ebp),%eax
+ 54f:	84 c0                	test   %al,%al
+ 551:	74 42                	je     595 <main+0x3a1>
+    if(r.replies == 0)
+ 553:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+ 556:	85 c0                	test   %eax,%eax
+ 558:	75 14                	jne    56e <main+0x37a>
+      printf(1, "no replies\n");
+ 55a:	83 ec 08             	sub    $0x8,%esp
+ 55d:	68 2d 11 00 00       	push   $0x112d
+ 562:	6a 01                	push   $0x1
+ 564:	e8 9b 06 00 00       	call   c04 <printf>
+ 569:	83 c4 10             	add    $0x10,%esp
+ 56c:	eb 27                	jmp    595 <main+0x3a1>
+    else
+      printf(1, "%d replies, rtt us: min %d p50 %d p90 %d p99 %d max %d\n",
+ 56e:	8b 7d b8             	mov    -0x48(%ebp),%edi
+ 571:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+ 574:	8b 5d b0             	mov    -0x50(%ebp),%ebx
+ 577:	8b 4d ac             	mov    -0x54(%ebp),%ecx
+ 57a:	8b 55 a8             	mov    -0x58(%ebp),%edx
+ 57d:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+ 580:	57                   	push   %edi
+ 581:	56                   	push   %esi
+ 582:	53                   	push   %ebx
+ 583:	51                   	push   %ecx
+ 584:	52                   	push   %edx
+ 585:	50                   	push   %eax
+ 586:	68 3c 11 00 00       	push   $0x113c
+ 58b:	6a 01                	push   $0x1
+ 58d:	e8 72 06 00 00       	call   c04 <printf>
+ 592:	83 c4 20             	add    $0x20,%esp
+             r.replies, r.rtt_min, r.rtt_p50, r.rtt_p90, r.rtt_p99, r.rtt_max);
+  }
+  exit();
+ 595:	e8 ae 04 00 00       	call   a48 <exit>
+
+0000059a <stosb>:
+}
+
+int
+stat(char *n, struct stat *st)
+{
+  int fd;
+ 59a:	55                   	push   %ebp
+ 59b:	89 e5                	mov    %esp,%ebp
+ 59d:	57                   	push   %edi
+ 59e:	53                   	push   %ebx
+  int r;
+ 59f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 5a2:	8b 55 10             	mov    0x10(%ebp),%edx
+ 5a5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5a8:	89 cb                	mov    %ecx,%ebx
+ 5aa:	89 df                	mov    %ebx,%edi
+ 5ac:	89 d1                	mov    %edx,%ecx
+ 5ae:	fc                   	cld
+ 5af:	f3 aa                	rep stos %al,%es:(%edi)
+ 5b1:	89 ca                	mov    %ecx,%edx
+ 5b3:	89 fb                	mov    %edi,%ebx
+ 5b5:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 5b8:	89 55 10             	mov    %edx,0x10(%ebp)
+
+  fd = open(n, O_RDONLY);
+  if(fd < 0)
+    return -1;
+ 5bb:	90                   	nop
+ 5bc:	5b                   	pop    %ebx
+ 5bd:	5f                   	pop    %edi
+ 5be:	5d                   	pop    %ebp
+ 5bf:	c3                   	ret
+
+000005c0 <strcpy>:
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 5c6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5c9:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 5cc:	90                   	nop
+ 5cd:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 5d0:	8d 42 01             	lea    0x1(%edx),%eax
+ 5d3:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 5d6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5d9:	8d 48 01             	lea    0x1(%eax),%ecx
+ 5dc:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 5df:	0f b6 12             	movzbl (%edx),%edx
+ 5e2:	88 10                	mov    %dl,(%eax)
+ 5e4:	0f b6 00             	movzbl (%eax),%eax
+ 5e7:	84 c0                	test   %al,%al
+ 5e9:	75 e2                	jne    5cd <strcpy+0xd>
+  return os;
+ 5eb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 5ee:	c9                   	leave
+ 5ef:	c3                   	ret
+
+000005f0 <strlen>:
+{
+ 5f0:	55                   	push   %ebp
+ 5f1:	89 e5                	mov    %esp,%ebp
+ 5f3:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 5f6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 5fd:	eb 04                	jmp    603 <strlen+0x13>
+ 5ff:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 603:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 606:	8b 45 08             	mov    0x8(%ebp),%eax
+ 609:	01 d0                	add    %edx,%eax
+ 60b:	0f b6 00             	movzbl (%eax),%eax
+ 60e:	84 c0                	test   %al,%al
+ 610:	75 ed                	jne    5ff <strlen+0xf>
+  return n;
+ 612:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 615:	c9                   	leave
+ 616:	c3                   	ret
+
+00000617 <memset>:
+{
+ 617:	55                   	push   %ebp
+ 618:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 61a:	8b 45 10             	mov    0x10(%ebp),%eax
+ 61d:	50                   	push   %eax
+ 61e:	ff 75 0c             	push   0xc(%ebp)
+ 621:	ff 75 08             	push   0x8(%ebp)
+ 624:	e8 71 ff ff ff       	call   59a <stosb>
+ 629:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 62c:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 62f:	c9                   	leave
+ 630:	c3                   	ret
+
+00000631 <strchr>:
+{
+ 631:	55                   	push   %ebp
+ 632:	89 e5                	mov    %esp,%ebp
+ 634:	83 ec 04             	sub    $0x4,%esp
+ 637:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 63a:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 63d:	eb 14                	jmp    653 <strchr+0x22>
+    if(*s == c)
+ 63f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 642:	0f b6 00             	movzbl (%eax),%eax
+ 645:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 648:	75 05                	jne    64f <strchr+0x1e>
+      return (char*)s;
+ 64a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 64d:	eb 13                	jmp    662 <strchr+0x31>
+  for(; *s; s++)
+ 64f:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 653:	8b 45 08             	mov    0x8(%ebp),%eax
+ 656:	0f b6 00             	movzbl (%eax),%eax
+ 659:	84 c0                	test   %al,%al
+ 65b:	75 e2                	jne    63f <strchr+0xe>
+  return 0;
+ 65d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 662:	c9                   	leave
+ 663:	c3                   	ret
+
+00000664 <gets>:
+{
+ 664:	55                   	push   %ebp
+ 665:	89 e5                	mov    %esp,%ebp
+ 667:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 66a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 671:	eb 42                	jmp    6b5 <gets+0x51>
+    cc = read(0, &c, 1);
+ 673:	83 ec 04             	sub    $0x4,%esp
+ 676:	6a 01                	push   $0x1
+ 678:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 67b:	50                   	push   %eax
+ 67c:	6a 00                	push   $0x0
+ 67e:	e8 dd 03 00 00       	call   a60 <read>
+ 683:	83 c4 10             	add    $0x10,%esp
+ 686:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 689:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 68d:	7e 33                	jle    6c2 <gets+0x5e>
+    buf[i++] = c;
+ 68f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 692:	8d 50 01             	lea    0x1(%eax),%edx
+ 695:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 698:	89 c2                	mov    %eax,%edx
+ 69a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 69d:	01 c2                	add    %eax,%edx
+ 69f:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 6a3:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 6a5:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 6a9:	3c 0a                	cmp    $0xa,%al
+ 6ab:	74 16                	je     6c3 <gets+0x5f>
+ 6ad:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 6b1:	3c 0d                	cmp    $0xd,%al
+ 6b3:	74 0e                	je     6c3 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 6b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6b8:	83 c0 01             	add    $0x1,%eax
+ 6bb:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 6be:	7f b3                	jg     673 <gets+0xf>
+ 6c0:	eb 01                	jmp    6c3 <gets+0x5f>
+      break;
+ 6c2:	90                   	nop
+  buf[i] = '\0';
+ 6c3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 6c6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6c9:	01 d0                	add    %edx,%eax
+ 6cb:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 6ce:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 6d1:	c9                   	leave
+ 6d2:	c3                   	ret
+
+000006d3 <stat>:
+{
+ 6d3:	55                   	push   %ebp
+ 6d4:	89 e5                	mov    %esp,%ebp
+ 6d6:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+ 6d9:	83 ec 08             	sub    $0x8,%esp
+ 6dc:	6a 00                	push   $0x0
+ 6de:	ff 75 08             	push   0x8(%ebp)
+ 6e1:	e8 a2 03 00 00       	call   a88 <open>
+ 6e6:	83 c4 10             	add    $0x10,%esp
+ 6e9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 6ec:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 6f0:	79 07                	jns    6f9 <stat+0x26>
+    return -1;
+ 6f2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 6f7:	eb 25                	jmp    71e <stat+0x4b>
+  r = fstat(fd, st);
+ 6f9:	83 ec 08             	sub    $0x8,%esp
+ 6fc:	ff 75 0c             	push   0xc(%ebp)
+ 6ff:	ff 75 f4             	push   -0xc(%ebp)
+ 702:	e8 99 03 00 00       	call   aa0 <fstat>
+ 707:	83 c4 10             	add    $0x10,%esp
+ 70a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 70d:	83 ec 0c             	sub    $0xc,%esp
+ 710:	ff 75 f4             	push   -0xc(%ebp)
+ 713:	e8 58 03 00 00       	call   a70 <close>
+ 718:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 71b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 71e:	c9                   	leave
+ 71f:	c3                   	ret
+
+00000720 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 720:	55                   	push   %ebp
+ 721:	89 e5                	mov    %esp,%ebp
+ 723:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+
+  dst = vdst;
+ 726:	8b 45 08             	mov    0x8(%ebp),%eax
+ 729:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 72c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 72f:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 732:	eb 17                	jmp    74b <memmove+0x2b>
+    *dst++ = *src++;
+ 734:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 737:	8d 42 01             	lea    0x1(%edx),%eax
+ 73a:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 73d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 740:	8d 48 01             	lea    0x1(%eax),%ecx
+ 743:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 746:	0f b6 12             	movzbl (%edx),%edx
+ 749:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 74b:	8b 45 10             	mov    0x10(%ebp),%eax
+ 74e:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 751:	89 55 10             	mov    %edx,0x10(%ebp)
+ 754:	85 c0                	test   %eax,%eax
+ 756:	7f dc                	jg     734 <memmove+0x14>
+  return vdst;
+ 758:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 75b:	c9                   	leave
+ 75c:	c3                   	ret
+
+0000075d <cpuinfo>:
+ 75d:	55                   	push   %ebp
+ 75e:	89 e5                	mov    %esp,%ebp
+ 760:	56                   	push   %esi
+ 761:	53                   	push   %ebx
+ 762:	8b 45 08             	mov    0x8(%ebp),%eax
+ 765:	ba 00 00 00 00       	mov    $0x0,%edx
+ 76a:	89 d1                	mov    %edx,%ecx
+ 76c:	0f a2                	cpuid
+ 76e:	89 c6                	mov    %eax,%esi
+ 770:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 773:	89 30                	mov    %esi,(%eax)
+ 775:	8b 45 10             	mov    0x10(%ebp),%eax
+ 778:	89 18                	mov    %ebx,(%eax)
+ 77a:	8b 45 14             	mov    0x14(%ebp),%eax
+ 77d:	89 08                	mov    %ecx,(%eax)
+ 77f:	8b 45 18             	mov    0x18(%ebp),%eax
+ 782:	89 10                	mov    %edx,(%eax)
+ 784:	90                   	nop
+ 785:	5b                   	pop    %ebx
+ 786:	5e                   	pop    %esi
+ 787:	5d                   	pop    %ebp
+ 788:	c3                   	ret
+
+00000789 <atoi>:
+{
+ 789:	55                   	push   %ebp
+ 78a:	89 e5                	mov    %esp,%ebp
+ 78c:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+ 78f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 796:	eb 25                	jmp    7bd <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 798:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 79b:	89 d0                	mov    %edx,%eax
+ 79d:	c1 e0 02             	shl    $0x2,%eax
+ 7a0:	01 d0                	add    %edx,%eax
+ 7a2:	01 c0                	add    %eax,%eax
+ 7a4:	89 c1                	mov    %eax,%ecx
+ 7a6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7a9:	8d 50 01             	lea    0x1(%eax),%edx
+ 7ac:	89 55 08             	mov    %edx,0x8(%ebp)
+ 7af:	0f b6 00             	movzbl (%eax),%eax
+ 7b2:	0f be c0             	movsbl %al,%eax
+ 7b5:	01 c8                	add    %ecx,%eax
+ 7b7:	83 e8 30             	sub    $0x30,%eax
+ 7ba:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 7bd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7c0:	0f b6 00             	movzbl (%eax),%eax
+ 7c3:	3c 2f                	cmp    $0x2f,%al
+ 7c5:	7e 0a                	jle    7d1 <atoi+0x48>
+ 7c7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7ca:	0f b6 00             	movzbl (%eax),%eax
+ 7cd:	3c 39                	cmp    $0x39,%al
+ 7cf:	7e c7                	jle    798 <atoi+0xf>
+  return n;
+ 7d1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 7d4:	c9                   	leave
+ 7d5:	c3                   	ret
+
+000007d6 <strcmp>:
+{
+ 7d6:	55                   	push   %ebp
+ 7d7:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 7d9:	eb 08                	jmp    7e3 <strcmp+0xd>
+    p++, q++;
+ 7db:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 7df:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 7e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7e6:	0f b6 00             	movzbl (%eax),%eax
+ 7e9:	84 c0                	test   %al,%al
+ 7eb:	74 10                	je     7fd <strcmp+0x27>
+ 7ed:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7f0:	0f b6 10             	movzbl (%eax),%edx
+ 7f3:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7f6:	0f b6 00             	movzbl (%eax),%eax
+ 7f9:	38 c2                	cmp    %al,%dl
+ 7fb:	74 de                	je     7db <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 7fd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 800:	0f b6 00             	movzbl (%eax),%eax
+ 803:	0f b6 d0             	movzbl %al,%edx
+ 806:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 809:	0f b6 00             	movzbl (%eax),%eax
+ 80c:	0f b6 c0             	movzbl %al,%eax
+ 80f:	29 c2                	sub    %eax,%edx
+ 811:	89 d0                	mov    %edx,%eax
+}
+ 813:	5d                   	pop    %ebp
+ 814:	c3                   	ret
+
+00000815 <udiv64>:
+{
+ 815:	55                   	push   %ebp
+ 816:	89 e5                	mov    %esp,%ebp
+ 818:	57                   	push   %edi
+ 819:	56                   	push   %esi
+ 81a:	83 ec 38             	sub    $0x38,%esp
+ 81d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 820:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 823:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 826:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 829:	8b 45 10             	mov    0x10(%ebp),%eax
+ 82c:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 82f:	8b 45 14             	mov    0x14(%ebp),%eax
+ 832:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  q = r = 0;
+ 835:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 83c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 843:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 846:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 849:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 84c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 84f:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 856:	e9 85 00 00 00       	jmp    8e0 <udiv64+0xcb>
+    r = (r << 1) | ((n >> i) & 1);
+ 85b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 85e:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 861:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 865:	01 c0                	add    %eax,%eax
+ 867:	89 c6                	mov    %eax,%esi
+ 869:	89 d7                	mov    %edx,%edi
+ 86b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 86e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 871:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 874:	0f ad d0             	shrd   %cl,%edx,%eax
+ 877:	d3 ea                	shr    %cl,%edx
+ 879:	f6 c1 20             	test   $0x20,%cl
+ 87c:	74 04                	je     882 <udiv64+0x6d>
+ 87e:	89 d0                	mov    %edx,%eax
+ 880:	31 d2                	xor    %edx,%edx
+ 882:	83 e0 01             	and    $0x1,%eax
+ 885:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 888:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+ 88f:	89 f0                	mov    %esi,%eax
+ 891:	89 fa                	mov    %edi,%edx
+ 893:	0b 45 c0             	or     -0x40(%ebp),%eax
+ 896:	0b 55 c4             	or     -0x3c(%ebp),%edx
+ 899:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 89c:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 89f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8a2:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 8a5:	3b 45 c8             	cmp    -0x38(%ebp),%eax
+ 8a8:	89 d0                	mov    %edx,%eax
+ 8aa:	1b 45 cc             	sbb    -0x34(%ebp),%eax
+ 8ad:	72 2d                	jb     8dc <udiv64+0xc7>
+      r -= d;
+ 8af:	8b 45 c8             	mov    -0x38(%ebp),%eax
+ 8b2:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 8b5:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 8b8:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64_t)1 << i;
+ 8bb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 8be:	b8 01 00 00 00       	mov    $0x1,%eax
+ 8c3:	ba 00 00 00 00       	mov    $0x0,%edx
+ 8c8:	0f a5 c2             	shld   %cl,%eax,%edx
+ 8cb:	d3 e0                	shl    %cl,%eax
+ 8cd:	f6 c1 20             	test   $0x20,%cl
+ 8d0:	74 04                	je     8d6 <udiv64+0xc1>
+ 8d2:	89 c2                	mov    %eax,%edx
+ 8d4:	31 c0                	xor    %eax,%eax
+ 8d6:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 8d9:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 8dc:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 8e0:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 8e4:	0f 89 71 ff ff ff    	jns    85b <udiv64+0x46>
+  if(rem)
+ 8ea:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+ 8ee:	74 0e                	je     8fe <udiv64+0xe9>
+    *rem = r;
+ 8f0:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 8f3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8f6:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 8f9:	89 01                	mov    %eax,(%ecx)
+ 8fb:	89 51 04             	mov    %edx,0x4(%ecx)
+  return q;
+ 8fe:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 901:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 904:	83 c4 38             	add    $0x38,%esp
+ 907:	5e                   	pop    %esi
+ 908:	5f                   	pop    %edi
+ 909:	5d                   	pop    %ebp
+ 90a:	c3                   	ret
+
+0000090b <crc32cinit>:
+{
+ 90b:	55                   	push   %ebp
+ 90c:	89 e5                	mov    %esp,%ebp
+ 90e:	83 ec 20             	sub    $0x20,%esp
+  for(i = 0; i < 256; i++){
+ 911:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 918:	eb 4c                	jmp    966 <crc32cinit+0x5b>
+    r = i;
+ 91a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 91d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+ 920:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+ 927:	eb 26                	jmp    94f <crc32cinit+0x44>
+      r = (r >> 1) ^ ((r & 1) ? CRC32C_POLY : 0);
+ 929:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 92c:	d1 e8                	shr    %eax
+ 92e:	89 c2                	mov    %eax,%edx
+ 930:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 933:	83 e0 01             	and    $0x1,%eax
+ 936:	85 c0                	test   %eax,%eax
+ 938:	74 07                	je     941 <crc32cinit+0x36>
+ 93a:	b8 78 3b f6 82       	mov    $0x82f63b78,%eax
+ 93f:	eb 05                	jmp    946 <crc32cinit+0x3b>
+ 941:	b8 00 00 00 00       	mov    $0x0,%eax
+ 946:	31 d0                	xor    %edx,%eax
+ 948:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+ 94b:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+ 94f:	83 7d f8 07          	cmpl   $0x7,-0x8(%ebp)
+ 953:	76 d4                	jbe    929 <crc32cinit+0x1e>
+    crc32ctab[i] = r;
+ 955:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 958:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 95b:	89 14 85 c0 15 00 00 	mov    %edx,0x15c0(,%eax,4)
+  for(i = 0; i < 256; i++){
+ 962:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 966:	81 7d fc ff 00 00 00 	cmpl   $0xff,-0x4(%ebp)
+ 96d:	76 ab                	jbe    91a <crc32cinit+0xf>
+  cpuinfo(1, &a, &b, &c, &d);
+ 96f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 972:	50                   	push   %eax
+ 973:	8d 45 e8             	lea    -0x18(%ebp),%eax
+ 976:	50                   	push   %eax
+ 977:	8d 45 ec             	lea    -0x14(%ebp),%eax
+ 97a:	50                   	push   %eax
+ 97b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 97e:	50                   	push   %eax
+ 97f:	6a 01                	push   $0x1
+ 981:	e8 d7 fd ff ff       	call   75d <cpuinfo>
+ 986:	83 c4 14             	add    $0x14,%esp
+  crc32chw = (c & CPUID_SSE42) != 0;
+ 989:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 98c:	25 00 00 10 00       	and    $0x100000,%eax
+ 991:	85 c0                	test   %eax,%eax
+ 993:	0f 95 c0             	setne  %al
+ 996:	0f b6 c0             	movzbl %al,%eax
+ 999:	a3 a4 15 00 00       	mov    %eax,0x15a4
+}
+ 99e:	90                   	nop
+ 99f:	c9                   	leave
+ 9a0:	c3                   	ret
+
+000009a1 <crc32c>:
+{
+ 9a1:	55                   	push   %ebp
+ 9a2:	89 e5                	mov    %esp,%ebp
+ 9a4:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s = p;
+ 9a7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 9aa:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(crc32chw < 0)
+ 9ad:	a1 a4 15 00 00       	mov    0x15a4,%eax
+ 9b2:	85 c0                	test   %eax,%eax
+ 9b4:	79 05                	jns    9bb <crc32c+0x1a>
+    crc32cinit();
+ 9b6:	e8 50 ff ff ff       	call   90b <crc32cinit>
+  crc = ~crc;
+ 9bb:	f7 55 08             	notl   0x8(%ebp)
+  if(crc32chw){
+ 9be:	a1 a4 15 00 00       	mov    0x15a4,%eax
+ 9c3:	85 c0                	test   %eax,%eax
+ 9c5:	74 6c                	je     a33 <crc32c+0x92>
+    for(; n >= 4; n -= 4, s += 4)
+ 9c7:	eb 18                	jmp    9e1 <crc32c+0x40>
+      asm("crc32l %1, %0" : "+r" (crc) : "rm" (*(const uint*)s));
+ 9c9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9cc:	8b 10                	mov    (%eax),%edx
+ 9ce:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9d1:	f2 0f 38 f1 c2       	crc32  %edx,%eax
+ 9d6:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n >= 4; n -= 4, s += 4)
+ 9d9:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+ 9dd:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+ 9e1:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+ 9e5:	77 e2                	ja     9c9 <crc32c+0x28>
+    for(; n > 0; n--, s++)
+ 9e7:	eb 19                	jmp    a02 <crc32c+0x61>
+      asm("crc32b %1, %0" : "+r" (crc) : "qm" (*s));
+ 9e9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9ec:	0f b6 10             	movzbl (%eax),%edx
+ 9ef:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9f2:	f2 0f 38 f0 c2       	crc32  %dl,%eax
+ 9f7:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+ 9fa:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+ 9fe:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ a02:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ a06:	75 e1                	jne    9e9 <crc32c+0x48>
+ a08:	eb 2f                	jmp    a39 <crc32c+0x98>
+      crc = crc32ctab[(crc ^ *s) & 0xff] ^ (crc >> 8);
+ a0a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a0d:	0f b6 00             	movzbl (%eax),%eax
+ a10:	0f b6 c0             	movzbl %al,%eax
+ a13:	33 45 08             	xor    0x8(%ebp),%eax
+ a16:	0f b6 c0             	movzbl %al,%eax
+ a19:	8b 04 85 c0 15 00 00 	mov    0x15c0(,%eax,4),%eax
+ a20:	8b 55 08             	mov    0x8(%ebp),%edx
+ a23:	c1 ea 08             	shr    $0x8,%edx
+ a26:	31 d0                	xor    %edx,%eax
+ a28:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+ a2b:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+ a2f:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ a33:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ a37:	75 d1                	jne    a0a <crc32c+0x69>
+  return ~crc;
+ a39:	8b 45 08             	mov    0x8(%ebp),%eax
+ a3c:	f7 d0                	not    %eax
+}
+ a3e:	c9                   	leave
+ a3f:	c3                   	ret
+
+00000a40 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ a40:	b8 01 00 00 00       	mov    $0x1,%eax
+ a45:	cd 40                	int    $0x40
+ a47:	c3                   	ret
+
+00000a48 <exit>:
+SYSCALL(exit)
+ a48:	b8 02 00 00 00       	mov    $0x2,%eax
+ a4d:	cd 40                	int    $0x40
+ a4f:	c3                   	ret
+
+00000a50 <wait>:
+SYSCALL(wait)
+ a50:	b8 03 00 00 00       	mov    $0x3,%eax
+ a55:	cd 40                	int    $0x40
+ a57:	c3                   	ret
+
+00000a58 <pipe>:
+SYSCALL(pipe)
+ a58:	b8 04 00 00 00       	mov    $0x4,%eax
+ a5d:	cd 40                	int    $0x40
+ a5f:	c3                   	ret
+
+00000a60 <read>:
+SYSCALL(read)
+ a60:	b8 05 00 00 00       	mov    $0x5,%eax
+ a65:	cd 40                	int    $0x40
+ a67:	c3                   	ret
+
+00000a68 <write>:
+SYSCALL(write)
+ a68:	b8 10 00 00 00       	mov    $0x10,%eax
+ a6d:	cd 40                	int    $0x40
+ a6f:	c3                   	ret
+
+00000a70 <close>:
+SYSCALL(close)
+ a70:	b8 15 00 00 00       	mov    $0x15,%eax
+ a75:	cd 40                	int    $0x40
+ a77:	c3                   	ret
+
+00000a78 <kill>:
+SYSCALL(kill)
+ a78:	b8 06 00 00 00       	mov    $0x6,%eax
+ a7d:	cd 40                	int    $0x40
+ a7f:	c3                   	ret
+
+00000a80 <exec>:
+SYSCALL(exec)
+ a80:	b8 07 00 00 00       	mov    $0x7,%eax
+ a85:	cd 40                	int    $0x40
+ a87:	c3                   	ret
+
+00000a88 <open>:
+SYSCALL(open)
+ a88:	b8 0f 00 00 00       	mov    $0xf,%eax
+ a8d:	cd 40                	int    $0x40
+ a8f:	c3                   	ret
+
+00000a90 <mknod>:
+SYSCALL(mknod)
+ a90:	b8 11 00 00 00       	mov    $0x11,%eax
+ a95:	cd 40                	int    $0x40
+ a97:	c3                   	ret
+
+00000a98 <unlink>:
+SYSCALL(unlink)
+ a98:	b8 12 00 00 00       	mov    $0x12,%eax
+ a9d:	cd 40                	int    $0x40
+ a9f:	c3                   	ret
+
+00000aa0 <fstat>:
+SYSCALL(fstat)
+ aa0:	b8 08 00 00 00       	mov    $0x8,%eax
+ aa5:	cd 40                	int    $0x40
+ aa7:	c3                   	ret
+
+00000aa8 <link>:
+SYSCALL(link)
+ aa8:	b8 13 00 00 00       	mov    $0x13,%eax
+ aad:	cd 40                	int    $0x40
+ aaf:	c3                   	ret
+
+00000ab0 <mkdir>:
+SYSCALL(mkdir)
+ ab0:	b8 14 00 00 00       	mov    $0x14,%eax
+ ab5:	cd 40                	int    $0x40
+ ab7:	c3                   	ret
+
+00000ab8 <chdir>:
+SYSCALL(chdir)
+ ab8:	b8 09 00 00 00       	mov    $0x9,%eax
+ abd:	cd 40                	int    $0x40
+ abf:	c3                   	ret
+
+00000ac0 <dup>:
+SYSCALL(dup)
+ ac0:	b8 0a 00 00 00       	mov    $0xa,%eax
+ ac5:	cd 40                	int    $0x40
+ ac7:	c3                   	ret
+
+00000ac8 <getpid>:
+SYSCALL(getpid)
+ ac8:	b8 0b 00 00 00       	mov    $0xb,%eax
+ acd:	cd 40                	int    $0x40
+ acf:	c3                   	ret
+
+00000ad0 <sbrk>:
+SYSCALL(sbrk)
+ ad0:	b8 0c 00 00 00       	mov    $0xc,%eax
+ ad5:	cd 40                	int    $0x40
+ ad7:	c3                   	ret
+
+00000ad8 <sleep>:
+SYSCALL(sleep)
+ ad8:	b8 0d 00 00 00       	mov    $0xd,%eax
+ add:	cd 40                	int    $0x40
+ adf:	c3                   	ret
+
+00000ae0 <uptime>:
+SYSCALL(uptime)
+ ae0:	b8 0e 00 00 00       	mov    $0xe,%eax
+ ae5:	cd 40                	int    $0x40
+ ae7:	c3                   	ret
+
+00000ae8 <arp>:
+SYSCALL(arp)
+ ae8:	b8 16 00 00 00       	mov    $0x16,%eax
+ aed:	cd 40                	int    $0x40
+ aef:	c3                   	ret
+
+00000af0 <ifstat>:
+SYSCALL(ifstat)
+ af0:	b8 17 00 00 00       	mov    $0x17,%eax
+ af5:	cd 40                	int    $0x40
+ af7:	c3                   	ret
+
+00000af8 <pcapctl>:
+SYSCALL(pcapctl)
+ af8:	b8 18 00 00 00       	mov    $0x18,%eax
+ afd:	cd 40                	int    $0x40
+ aff:	c3                   	ret
+
+00000b00 <pcapread>:
+SYSCALL(pcapread)
+ b00:	b8 19 00 00 00       	mov    $0x19,%eax
+ b05:	cd 40                	int    $0x40
+ b07:	c3                   	ret
+
+00000b08 <bpfattach>:
+SYSCALL(bpfattach)
+ b08:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ b0d:	cd 40                	int    $0x40
+ b0f:	c3                   	ret
+
+00000b10 <pktgen>:
+SYSCALL(pktgen)
+ b10:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ b15:	cd 40                	int    $0x40
+ b17:	c3                   	ret
+
+00000b18 <reflect>:
+SYSCALL(reflect)
+ b18:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ b1d:	cd 40                	int    $0x40
+ b1f:	c3                   	ret
+
+00000b20 <brctl>:
+SYSCALL(brctl)
+ b20:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ b25:	cd 40                	int    $0x40
+ b27:	c3                   	ret
+
+00000b28 <hostopen>:
+SYSCALL(hostopen)
+ b28:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ b2d:	cd 40                	int    $0x40
+ b2f:	c3                   	ret
+
+00000b30 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ b30:	55                   	push   %ebp
+ b31:	89 e5                	mov    %esp,%ebp
+ b33:	83 ec 18             	sub    $0x18,%esp
+ b36:	8b 45 0c             	mov    0xc(%ebp),%eax
+ b39:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ b3c:	83 ec 04             	sub    $0x4,%esp
+ b3f:	6a 01                	push   $0x1
+ b41:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ b44:	50                   	push   %eax
+ b45:	ff 75 08             	push   0x8(%ebp)
+ b48:	e8 1b ff ff ff       	call   a68 <write>
+ b4d:	83 c4 10             	add    $0x10,%esp
+}
+ b50:	90                   	nop
+ b51:	c9                   	leave
+ b52:	c3                   	ret
+
+00000b53 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ b53:	55                   	push   %ebp
+ b54:	89 e5                	mov    %esp,%ebp
+ b56:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ b59:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ b60:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ b64:	74 17                	je     b7d <printint+0x2a>
+ b66:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ b6a:	79 11                	jns    b7d <printint+0x2a>
+    neg = 1;
+ b6c:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ b73:	8b 45 0c             	mov    0xc(%ebp),%eax
+ b76:	f7 d8                	neg    %eax
+ b78:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ b7b:	eb 06                	jmp    b83 <printint+0x30>
+  } else {
+    x = xx;
+ b7d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ b80:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ b83:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ b8a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ b8d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ b90:	ba 00 00 00 00       	mov    $0x0,%edx
+ b95:	f7 f1                	div    %ecx
+ b97:	89 d1                	mov    %edx,%ecx
+ b99:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b9c:	8d 50 01             	lea    0x1(%eax),%edx
+ b9f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ ba2:	0f b6 91 a8 15 00 00 	movzbl 0x15a8(%ecx),%edx
+ ba9:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ bad:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ bb0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ bb3:	ba 00 00 00 00       	mov    $0x0,%edx
+ bb8:	f7 f1                	div    %ecx
+ bba:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ bbd:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ bc1:	75 c7                	jne    b8a <printint+0x37>
+  if(neg)
+ bc3:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ bc7:	74 2d                	je     bf6 <printint+0xa3>
+    buf[i++] = '-';
+ bc9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bcc:	8d 50 01             	lea    0x1(%eax),%edx
+ bcf:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ bd2:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ bd7:	eb 1d                	jmp    bf6 <printint+0xa3>
+    putc(fd, buf[i]);
+ bd9:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ bdc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bdf:	01 d0                	add    %edx,%eax
+ be1:	0f b6 00             	movzbl (%eax),%eax
+ be4:	0f be c0             	movsbl %al,%eax
+ be7:	83 ec 08             	sub    $0x8,%esp
+ bea:	50                   	push   %eax
+ beb:	ff 75 08             	push   0x8(%ebp)
+ bee:	e8 3d ff ff ff       	call   b30 <putc>
+ bf3:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ bf6:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ bfa:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ bfe:	79 d9                	jns    bd9 <printint+0x86>
+}
+ c00:	90                   	nop
+ c01:	90                   	nop
+ c02:	c9                   	leave
+ c03:	c3                   	ret
+
+00000c04 <printf>:
+
+// Print to the given fd. Only understands %d, %u, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ c04:	55                   	push   %ebp
+ c05:	89 e5                	mov    %esp,%ebp
+ c07:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ c0a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ c11:	8d 45 0c             	lea    0xc(%ebp),%eax
+ c14:	83 c0 04             	add    $0x4,%eax
+ c17:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ c1a:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ c21:	e9 7d 01 00 00       	jmp    da3 <printf+0x19f>
+    c = fmt[i] & 0xff;
+ c26:	8b 55 0c             	mov    0xc(%ebp),%edx
+ c29:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c2c:	01 d0                	add    %edx,%eax
+ c2e:	0f b6 00             	movzbl (%eax),%eax
+ c31:	0f be c0             	movsbl %al,%eax
+ c34:	25 ff 00 00 00       	and    $0xff,%eax
+ c39:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ c3c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ c40:	75 2c                	jne    c6e <printf+0x6a>
+      if(c == '%'){
+ c42:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ c46:	75 0c                	jne    c54 <printf+0x50>
+        state = '%';
+ c48:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ c4f:	e9 4b 01 00 00       	jmp    d9f <printf+0x19b>
+      } else {
+        putc(fd, c);
+ c54:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ c57:	0f be c0             	movsbl %al,%eax
+ c5a:	83 ec 08             	sub    $0x8,%esp
+ c5d:	50                   	push   %eax
+ c5e:	ff 75 08             	push   0x8(%ebp)
+ c61:	e8 ca fe ff ff       	call   b30 <putc>
+ c66:	83 c4 10             	add    $0x10,%esp
+ c69:	e9 31 01 00 00       	jmp    d9f <printf+0x19b>
+      }
+    } else if(state == '%'){
+ c6e:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ c72:	0f 85 27 01 00 00    	jne    d9f <printf+0x19b>
+      if(c == 'd'){
+ c78:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ c7c:	75 1e                	jne    c9c <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ c7e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ c81:	8b 00                	mov    (%eax),%eax
+ c83:	6a 01                	push   $0x1
+ c85:	6a 0a                	push   $0xa
+ c87:	50                   	push   %eax
+ c88:	ff 75 08             	push   0x8(%ebp)
+ c8b:	e8 c3 fe ff ff       	call   b53 <printint>
+ c90:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ c93:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ c97:	e9 fc 00 00 00       	jmp    d98 <printf+0x194>
+      } else if(c == 'u'){
+ c9c:	83 7d e4 75          	cmpl   $0x75,-0x1c(%ebp)
+ ca0:	75 1e                	jne    cc0 <printf+0xbc>
+        printint(fd, *ap, 10, 0);
+ ca2:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ ca5:	8b 00                	mov    (%eax),%eax
+ ca7:	6a 00                	push   $0x0
+ ca9:	6a 0a                	push   $0xa
+ cab:	50                   	push   %eax
+ cac:	ff 75 08             	push   0x8(%ebp)
+ caf:	e8 9f fe ff ff       	call   b53 <printint>
+ cb4:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ cb7:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ cbb:	e9 d8 00 00 00       	jmp    d98 <printf+0x194>
+      } else if(c == 'x' || c == 'p'){
+ cc0:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ cc4:	74 06                	je     ccc <printf+0xc8>
+ cc6:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ cca:	75 1e                	jne    cea <printf+0xe6>
+        printint(fd, *ap, 16, 0);
+ ccc:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ ccf:	8b 00                	mov    (%eax),%eax
+ cd1:	6a 00                	push   $0x0
+ cd3:	6a 10                	push   $0x10
+ cd5:	50                   	push   %eax
+ cd6:	ff 75 08             	push   0x8(%ebp)
+ cd9:	e8 75 fe ff ff       	call   b53 <printint>
+ cde:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ ce1:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ ce5:	e9 ae 00 00 00       	jmp    d98 <printf+0x194>
+      } else if(c == 's'){
+ cea:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ cee:	75 43                	jne    d33 <printf+0x12f>
+        s = (char*)*ap;
+ cf0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ cf3:	8b 00                	mov    (%eax),%eax
+ cf5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ cf8:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ cfc:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d00:	75 25                	jne    d27 <printf+0x123>
+          s = "(null)";
+ d02:	c7 45 f4 40 12 00 00 	movl   $0x1240,-0xc(%ebp)
+        while(*s != 0){
+ d09:	eb 1c                	jmp    d27 <printf+0x123>
+          putc(fd, *s);
+ d0b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d0e:	0f b6 00             	movzbl (%eax),%eax
+ d11:	0f be c0             	movsbl %al,%eax
+ d14:	83 ec 08             	sub    $0x8,%esp
+ d17:	50                   	push   %eax
+ d18:	ff 75 08             	push   0x8(%ebp)
+ d1b:	e8 10 fe ff ff       	call   b30 <putc>
+ d20:	83 c4 10             	add    $0x10,%esp
+          s++;
+ d23:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ d27:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d2a:	0f b6 00             	movzbl (%eax),%eax
+ d2d:	84 c0                	test   %al,%al
+ d2f:	75 da                	jne    d0b <printf+0x107>
+ d31:	eb 65                	jmp    d98 <printf+0x194>
+        }
+      } else if(c == 'c'){
+ d33:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ d37:	75 1d                	jne    d56 <printf+0x152>
+        putc(fd, *ap);
+ d39:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ d3c:	8b 00                	mov    (%eax),%eax
+ d3e:	0f be c0             	movsbl %al,%eax
+ d41:	83 ec 08             	sub    $0x8,%esp
+ d44:	50                   	push   %eax
+ d45:	ff 75 08             	push   0x8(%ebp)
+ d48:	e8 e3 fd ff ff       	call   b30 <putc>
+ d4d:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ d50:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ d54:	eb 42                	jmp    d98 <printf+0x194>
+      } else if(c == '%'){
+ d56:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ d5a:	75 17                	jne    d73 <printf+0x16f>
+        putc(fd, c);
+ d5c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ d5f:	0f be c0             	movsbl %al,%eax
+ d62:	83 ec 08             	sub    $0x8,%esp
+ d65:	50                   	push   %eax
+ d66:	ff 75 08             	push   0x8(%ebp)
+ d69:	e8 c2 fd ff ff       	call   b30 <putc>
+ d6e:	83 c4 10             	add    $0x10,%esp
+ d71:	eb 25                	jmp    d98 <printf+0x194>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ d73:	83 ec 08             	sub    $0x8,%esp
+ d76:	6a 25                	push   $0x25
+ d78:	ff 75 08             	push   0x8(%ebp)
+ d7b:	e8 b0 fd ff ff       	call   b30 <putc>
+ d80:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ d83:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ d86:	0f be c0             	movsbl %al,%eax
+ d89:	83 ec 08             	sub    $0x8,%esp
+ d8c:	50                   	push   %eax
+ d8d:	ff 75 08             	push   0x8(%ebp)
+ d90:	e8 9b fd ff ff       	call   b30 <putc>
+ d95:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ d98:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ d9f:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ da3:	8b 55 0c             	mov    0xc(%ebp),%edx
+ da6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ da9:	01 d0                	add    %edx,%eax
+ dab:	0f b6 00             	movzbl (%eax),%eax
+ dae:	84 c0                	test   %al,%al
+ db0:	0f 85 70 fe ff ff    	jne    c26 <printf+0x22>
+    }
+  }
+}
+ db6:	90                   	nop
+ db7:	90                   	nop
+ db8:	c9                   	leave
+ db9:	c3                   	ret
+
+00000dba <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ dba:	55                   	push   %ebp
+ dbb:	89 e5                	mov    %esp,%ebp
+ dbd:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ dc0:	8b 45 08             	mov    0x8(%ebp),%eax
+ dc3:	83 e8 08             	sub    $0x8,%eax
+ dc6:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ dc9:	a1 c8 19 00 00       	mov    0x19c8,%eax
+ dce:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ dd1:	eb 24                	jmp    df7 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ dd3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ dd6:	8b 00                	mov    (%eax),%eax
+ dd8:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ ddb:	72 12                	jb     def <free+0x35>
+ ddd:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ de0:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ de3:	72 24                	jb     e09 <free+0x4f>
+ de5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ de8:	8b 00                	mov    (%eax),%eax
+ dea:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ ded:	72 1a                	jb     e09 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ def:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ df2:	8b 00                	mov    (%eax),%eax
+ df4:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ df7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ dfa:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ dfd:	73 d4                	jae    dd3 <free+0x19>
+ dff:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ e02:	8b 00                	mov    (%eax),%eax
+ e04:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ e07:	73 ca                	jae    dd3 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ e09:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ e0c:	8b 40 04             	mov    0x4(%eax),%eax
+ e0f:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ e16:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ e19:	01 c2                	add    %eax,%edx
+ e1b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ e1e:	8b 00                	mov    (%eax),%eax
+ e20:	39 c2                	cmp    %eax,%edx
+ e22:	75 24                	jne    e48 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ e24:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ e27:	8b 50 04             	mov    0x4(%eax),%edx
+ e2a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ e2d:	8b 00                	mov    (%eax),%eax
+ e2f:	8b 40 04             	mov    0x4(%eax),%eax
+ e32:	01 c2                	add    %eax,%edx
+ e34:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ e37:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ e3a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ e3d:	8b 00                	mov    (%eax),%eax
+ e3f:	8b 10                	mov    (%eax),%edx
+ e41:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ e44:	89 10                	mov    %edx,(%eax)
+ e46:	eb 0a                	jmp    e52 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ e48:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ e4b:	8b 10                	mov    (%eax),%edx
+ e4d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ e50:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ e52:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ e55:	8b 40 04             	mov    0x4(%eax),%eax
+ e58:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ e5f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ e62:	01 d0                	add    %edx,%eax
+ e64:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ e67:	75 20                	jne    e89 <free+0xcf>
+    p->s.size += bp->s.size;
+ e69:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ e6c:	8b 50 04             	mov    0x4(%eax),%edx
+ e6f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ e72:	8b 40 04             	mov    0x4(%eax),%eax
+ e75:	01 c2                	add    %eax,%edx
+ e77:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ e7a:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ e7d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ e80:	8b 10                	mov    (%eax),%edx
+ e82:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ e85:	89 10                	mov    %edx,(%eax)
+ e87:	eb 08                	jmp    e91 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ e89:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ e8c:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ e8f:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ e91:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ e94:	a3 c8 19 00 00       	mov    %eax,0x19c8
+}
+ e99:	90                   	nop
+ e9a:	c9                   	leave
+ e9b:	c3                   	ret
+
+00000e9c <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ e9c:	55                   	push   %ebp
+ e9d:	89 e5                	mov    %esp,%ebp
+ e9f:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ ea2:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ ea9:	77 07                	ja     eb2 <morecore+0x16>
+    nu = 4096;
+ eab:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ eb2:	8b 45 08             	mov    0x8(%ebp),%eax
+ eb5:	c1 e0 03             	shl    $0x3,%eax
+ eb8:	83 ec 0c             	sub    $0xc,%esp
+ ebb:	50                   	push   %eax
+ ebc:	e8 0f fc ff ff       	call   ad0 <sbrk>
+ ec1:	83 c4 10             	add    $0x10,%esp
+ ec4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ ec7:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ ecb:	75 07                	jne    ed4 <morecore+0x38>
+    return 0;
+ ecd:	b8 00 00 00 00       	mov    $0x0,%eax
+ ed2:	eb 26                	jmp    efa <morecore+0x5e>
+  hp = (Header*)p;
+ ed4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ed7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ eda:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ edd:	8b 55 08             	mov    0x8(%ebp),%edx
+ ee0:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ ee3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ee6:	83 c0 08             	add    $0x8,%eax
+ ee9:	83 ec 0c             	sub    $0xc,%esp
+ eec:	50                   	push   %eax
+ eed:	e8 c8 fe ff ff       	call   dba <free>
+ ef2:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ ef5:	a1 c8 19 00 00       	mov    0x19c8,%eax
+}
+ efa:	c9                   	leave
+ efb:	c3                   	ret
+
+00000efc <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ efc:	55                   	push   %ebp
+ efd:	89 e5                	mov    %esp,%ebp
+ eff:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ f02:	8b 45 08             	mov    0x8(%ebp),%eax
+ f05:	83 c0 07             	add    $0x7,%eax
+ f08:	c1 e8 03             	shr    $0x3,%eax
+ f0b:	83 c0 01             	add    $0x1,%eax
+ f0e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ f11:	a1 c8 19 00 00       	mov    0x19c8,%eax
+ f16:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ f19:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ f1d:	75 23                	jne    f42 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ f1f:	c7 45 f0 c0 19 00 00 	movl   $0x19c0,-0x10(%ebp)
+ f26:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ f29:	a3 c8 19 00 00       	mov    %eax,0x19c8
+ f2e:	a1 c8 19 00 00       	mov    0x19c8,%eax
+ f33:	a3 c0 19 00 00       	mov    %eax,0x19c0
+    base.s.size = 0;
+ f38:	c7 05 c4 19 00 00 00 	movl   $0x0,0x19c4
+ f3f:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ f42:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ f45:	8b 00                	mov    (%eax),%eax
+ f47:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ f4a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ f4d:	8b 40 04             	mov    0x4(%eax),%eax
+ f50:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ f53:	72 4d                	jb     fa2 <malloc+0xa6>
+      if(p->s.size == nunits)
+ f55:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ f58:	8b 40 04             	mov    0x4(%eax),%eax
+ f5b:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ f5e:	75 0c                	jne    f6c <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ f60:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ f63:	8b 10                	mov    (%eax),%edx
+ f65:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ f68:	89 10                	mov    %edx,(%eax)
+ f6a:	eb 26                	jmp    f92 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ f6c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ f6f:	8b 40 04             	mov    0x4(%eax),%eax
+ f72:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ f75:	89 c2                	mov    %eax,%edx
+ f77:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ f7a:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ f7d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ f80:	8b 40 04             	mov    0x4(%eax),%eax
+ f83:	c1 e0 03             	shl    $0x3,%eax
+ f86:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ f89:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ f8c:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ f8f:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ f92:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ f95:	a3 c8 19 00 00       	mov    %eax,0x19c8
+      return (void*)(p + 1);
+ f9a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ f9d:	83 c0 08             	add    $0x8,%eax
+ fa0:	eb 3b                	jmp    fdd <malloc+0xe1>
+    }
+    if(p == freep)
+ fa2:	a1 c8 19 00 00       	mov    0x19c8,%eax
+ fa7:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ faa:	75 1e                	jne    fca <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ fac:	83 ec 0c             	sub    $0xc,%esp
+ faf:	ff 75 ec             	push   -0x14(%ebp)
+ fb2:	e8 e5 fe ff ff       	call   e9c <morecore>
+ fb7:	83 c4 10             	add    $0x10,%esp
+ fba:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ fbd:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ fc1:	75 07                	jne    fca <malloc+0xce>
+        return 0;
+ fc3:	b8 00 00 00 00       	mov    $0x0,%eax
+ fc8:	eb 13                	jmp    fdd <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ fca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ fcd:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ fd0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ fd3:	8b 00                	mov    (%eax),%eax
+ fd5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ fd8:	e9 6d ff ff ff       	jmp    f4a <malloc+0x4e>
+  }
+}
+ fdd:	c9                   	leave
+ fde:	c3                   	ret
@@ -0,0 +1,148 @@
+// pgen: drive the in-kernel packet generator.
+//
+//   pgen [-i ifindex] [-n count] [-s size] [-r pps] [-d dstmac]
+//        [-m nsrcmac] [-a srcip] [-A nsrcip] [-b dstip] [-B ndstip] [-l]
+//   pgen -R ifindex on|off
+//
+// -l waits for the frames to come back from a reflector and prints
+// round trip percentiles. -R turns reflector mode on an interface on
+// or off.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "pktgen.h"
+
+static void
+usage(void)
+{
+  printf(2, "usage: pgen [-i ifindex] [-n count] [-s size] [-r pps] [-d dstmac]\n"
+            "            [-m nsrcmac] [-a srcip] [-A nsrcip] [-b dstip] [-B ndstip] [-l]\n"
+            "       pgen -R ifindex on|off\n");
+  exit();
+}
+
+static int
+hexdigit(char c)
+{
+  if(c >= '0' && c <= '9')
+    return c - '0';
+  if(c >= 'a' && c <= 'f')
+    return c - 'a' + 10;
+  if(c >= 'A' && c <= 'F')
+    return c - 'A' + 10;
+  return -1;
+}
+
+// Parse aa:bb:cc:dd:ee:ff into mac.
+static int
+parsemac(char *s, uchar *mac)
+{
+  int i, hi, lo;
+
+  for(i = 0; i < 6; i++){
+    if((hi = hexdigit(s[0])) < 0 || (lo = hexdigit(s[1])) < 0)
+      return -1;
+    mac[i] = hi << 4 | lo;
+    s += 2;
+    if(*s != (i == 5 ? 0 : ':'))
+      return -1;
+    s++;
+  }
+  return 0;
+}
+
+// Parse a dotted quad into a host byte order address.
+static int
+parseip(char *s, uint *ip)
+{
+  int i, n;
+
+  *ip = 0;
+  for(i = 0; i < 4; i++){
+    if(*s < '0' || *s > '9')
+      return -1;
+    for(n = 0; *s >= '0' && *s <= '9'; s++)
+      n = n * 10 + *s - '0';
+    if(n > 255 || *s != (i == 3 ? 0 : '.'))
+      return -1;
+    *ip = *ip << 8 | n;
+    s++;
+  }
+  return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct pktgen_conf c;
+  struct pktgen_result r;
+  char *arg;
+  int i;
+
+  if(argc == 4 && strcmp(argv[1], "-R") == 0){
+    if(reflect(atoi(argv[2]), strcmp(argv[3], "on") == 0) < 0){
+      printf(2, "pgen: no interface %s\n", argv[2]);
+      exit();
+    }
+    exit();
+  }
+
+  memset(&c, 0, sizeof(c));
+  c.count = 1000;
+  c.size = PKTGEN_MINSIZE;
+  memset(c.dst, 0xff, 6);
+  parseip("10.0.0.2", &c.srcip);
+  parseip("10.0.0.1", &c.dstip);
+
+  for(i = 1; i < argc; i++){
+    if(argv[i][0] != '-' || argv[i][1] == 0 || argv[i][2] != 0)
+      usage();
+    if(argv[i][1] == 'l'){
+      c.latency = 1;
+      continue;
+    }
+    if(i + 1 == argc)
+      usage();
+    arg = argv[++i];
+    switch(argv[i-1][1]){
+    case 'i': c.ifindex = atoi(arg); break;
+    case 'n': c.count = atoi(arg); break;
+    case 's': c.size = atoi(arg); break;
+    case 'r': c.rate = atoi(arg); break;
+    case 'm': c.nsrcmac = atoi(arg); break;
+    case 'A': c.nsrcip = atoi(arg); break;
+    case 'B': c.ndstip = atoi(arg); break;
+    case 'd':
+      if(parsemac(arg, c.dst) < 0)
+        usage();
+      break;
+    case 'a':
+      if(parseip(arg, &c.srcip) < 0)
+        usage();
+      break;
+    case 'b':
+      if(parseip(arg, &c.dstip) < 0)
+        usage();
+      break;
+    default:
+      usage();
+    }
+  }
+
+  if(pktgen(&c, &r) < 0){
+    printf(2, "pgen: cannot start, is another run in progress?\n");
+    exit();
+  }
+
+  printf(1, "sent %d frames of %d bytes in %d us: %d pps, %d dropped\n",
+         r.sent, c.size, r.usecs, r.pps, r.dropped);
+  if(c.latency){
+    if(r.replies == 0)
+      printf(1, "no replies\n");
+    else
+      printf(1, "%d replies, rtt us: min %d p50 %d p90 %d p99 %d max %d\n",
+             r.replies, r.rtt_min, r.rtt_p50, r.rtt_p90, r.rtt_p99, r.rtt_max);
+  }
+  exit();
+}
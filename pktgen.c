@@ -0,0 +1,299 @@
+// In-kernel packet generator.
+//
+// pktgen() builds one UDP/IPv4 frame and sends it count times through
+// the interface's send_packet, patching the addresses, a sequence
+// number and a time stamp into each copy on the way. It runs in the
+// calling process and paces itself against the time-stamp counter,
+// so the measured rate is that of the driver and not of the system
+// call path.
+//
+// An interface in reflector mode sends every frame it receives back
+// out with the MAC addresses swapped. When one of our stamped frames
+// comes back, pktgen_rx() records how long the round trip took.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "x86.h"
+#include "mmu.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "nic.h"
+#include "pktgen.h"
+#include "util.h"
+
+#define PKTGEN_MAGIC 0x70677431   // "pgt1"
+#define PKTGEN_PORT  9            // UDP discard
+
+#define ETH_HLEN   14
+#define IP_OFF     ETH_HLEN
+#define UDP_OFF    (IP_OFF + 20)
+#define STAMP_OFF  (UDP_OFF + 8)
+
+// Carried in the payload of every generated frame.
+struct stamp {
+  uint magic;
+  uint seq;
+  uint64_t tsc;
+};
+
+struct {
+  struct spinlock lock;
+  int busy;                // a run is in progress
+  int timing;              // pktgen_rx records round trips
+  struct nic_device *nd;   // interface the run sends on
+  uint *rtt;               // PKTGEN_NRTT round trips in TSC ticks
+  uint nrtt;               // samples taken, wraps over rtt[]
+} pktgen;
+
+void
+pktgeninit(void)
+{
+  initlock(&pktgen.lock, "pktgen");
+}
+
+static void
+put16(uchar *p, uint v)
+{
+  p[0] = v >> 8;
+  p[1] = v;
+}
+
+static void
+put32(uchar *p, uint v)
+{
+  p[0] = v >> 24;
+  p[1] = v >> 16;
+  p[2] = v >> 8;
+  p[3] = v;
+}
+
+static uint
+get16(uchar *p)
+{
+  return (p[0] << 8) | p[1];
+}
+
+// Internet checksum of the n byte (n even) header at p.
+static uint
+cksum(uchar *p, int n)
+{
+  uint sum = 0;
+
+  for(int i = 0; i < n; i += 2)
+    sum += get16(p + i);
+  while(sum >> 16)
+    sum = (sum & 0xffff) + (sum >> 16);
+  return ~sum & 0xffff;
+}
+
+// Fill in the parts of the frame that are the same for every copy.
+static void
+build(uchar *f, struct pktgen_conf *c, struct nic_device *nd)
+{
+  uchar *ip = f + IP_OFF;
+  uchar *udp = f + UDP_OFF;
+
+  memset(f, 0, c->size);
+  memmove(f, c->dst, 6);
+  memmove(f + 6, nd->mac_addr, 6);
+  put16(f + 12, 0x0800);
+
+  ip[0] = 0x45;                      // version 4, 20 byte header
+  put16(ip + 2, c->size - ETH_HLEN);
+  put16(ip + 6, 0x4000);             // don't fragment
+  ip[8] = 64;                        // ttl
+  ip[9] = 17;                        // UDP
+
+  put16(udp, PKTGEN_PORT);
+  put16(udp + 2, PKTGEN_PORT);
+  put16(udp + 4, c->size - UDP_OFF);
+  // UDP checksum 0: none, which IPv4 allows.
+}
+
+// Make f copy number seq.
+static void
+patch(uchar *f, struct pktgen_conf *c, struct nic_device *nd, uint seq)
+{
+  uchar *ip = f + IP_OFF;
+  struct stamp s;
+
+  f[11] = nd->mac_addr[5] + seq % c->nsrcmac;
+  put16(ip + 4, seq);
+  put32(ip + 12, c->srcip + seq % c->nsrcip);
+  put32(ip + 16, c->dstip + seq % c->ndstip);
+  put16(ip + 10, 0);
+  put16(ip + 10, cksum(ip, 20));
+
+  s.magic = PKTGEN_MAGIC;
+  s.seq = seq;
+  s.tsc = rdtsc();
+  memmove(f + STAMP_OFF, &s, sizeof(s));
+}
+
+/**
+ * Called for every frame an interface receives, from its interrupt
+ * handler. pkt may be modified; it is not looked at afterwards.
+ */
+void
+pktgen_rx(struct nic_device *nd, uchar *pkt, uint len)
+{
+  uchar mac[6];
+  struct stamp s;
+  uint64_t rtt;
+
+  if(nd->reflect){
+    memmove(mac, pkt, 6);
+    memmove(pkt, pkt + 6, 6);
+    memmove(pkt + 6, mac, 6);
+    nd->send_packet(nd->driver, pkt, len);
+    return;
+  }
+
+  if(!pktgen.timing || len < STAMP_OFF + sizeof(s) ||
+     get16(pkt + 12) != 0x0800 || pkt[IP_OFF + 9] != 17 ||
+     get16(pkt + UDP_OFF + 2) != PKTGEN_PORT)
+    return;
+  memmove(&s, pkt + STAMP_OFF, sizeof(s));
+  if(s.magic != PKTGEN_MAGIC)
+    return;
+
+  rtt = rdtsc() - s.tsc;
+  if(rtt > 0xffffffff)
+    rtt = 0xffffffff;
+
+  acquire(&pktgen.lock);
+  if(pktgen.timing && pktgen.nd == nd){
+    pktgen.rtt[pktgen.nrtt % PKTGEN_NRTT] = rtt;
+    pktgen.nrtt++;
+  }
+  release(&pktgen.lock);
+}
+
+static uint
+usecs(uint64_t tsc)
+{
+  return udiv64(tsc * 1000, tsckhz, 0);
+}
+
+// Sort the round trip samples and fill in the percentiles.
+static void
+percentiles(uint *v, uint n, struct pktgen_result *r)
+{
+  uint i, j, t;
+
+  for(i = 1; i < n; i++){
+    t = v[i];
+    for(j = i; j > 0 && v[j-1] > t; j--)
+      v[j] = v[j-1];
+    v[j] = t;
+  }
+  r->rtt_min = usecs(v[0]);
+  r->rtt_p50 = usecs(v[(n-1) * 50 / 100]);
+  r->rtt_p90 = usecs(v[(n-1) * 90 / 100]);
+  r->rtt_p99 = usecs(v[(n-1) * 99 / 100]);
+  r->rtt_max = usecs(v[n-1]);
+}
+
+/**
+ * Sends the frames described by c and reports on the run in r.
+ * Only one run can be in progress at a time. Returns -1 if c is
+ * invalid, another run is in progress or there is no memory.
+ */
+int
+pktgen_run(struct pktgen_conf *c, struct pktgen_result *r)
+{
+  struct nic_device *nd;
+  struct ifstat before, after;
+  char *frame;
+  uint *rtt;
+  uint seq, t0;
+  uint64_t start, end, next, interval;
+
+  if(c->ifindex < 0 || c->ifindex >= nnic || c->count == 0 ||
+     c->size < PKTGEN_MINSIZE || c->size > PKTGEN_MAXSIZE || tsckhz == 0)
+    return -1;
+  nd = &nic_devices[c->ifindex];
+  if(c->nsrcmac == 0)
+    c->nsrcmac = 1;
+  if(c->nsrcip == 0)
+    c->nsrcip = 1;
+  if(c->ndstip == 0)
+    c->ndstip = 1;
+
+  acquire(&pktgen.lock);
+  if(pktgen.busy){
+    release(&pktgen.lock);
+    return -1;
+  }
+  pktgen.busy = 1;
+  release(&pktgen.lock);
+
+  frame = kalloc();
+  rtt = c->latency ? (uint*)kalloc() : 0;
+  if(frame == 0 || (c->latency && rtt == 0)){
+    if(frame)
+      kfree(frame);
+    acquire(&pktgen.lock);
+    pktgen.busy = 0;
+    release(&pktgen.lock);
+    return -1;
+  }
+  build((uchar*)frame, c, nd);
+
+  if(c->latency){
+    acquire(&pktgen.lock);
+    pktgen.nd = nd;
+    pktgen.rtt = rtt;
+    pktgen.nrtt = 0;
+    pktgen.timing = 1;
+    release(&pktgen.lock);
+  }
+
+  memset(r, 0, sizeof(*r));
+  nic_getstat(c->ifindex, &before);
+  interval = c->rate ? udiv64((uint64_t)tsckhz * 1000, c->rate, 0) : 0;
+  start = next = rdtsc();
+  for(seq = 0; seq < c->count; seq++){
+    if(myproc()->killed)
+      break;
+    if(interval){
+      while(rdtsc() < next)
+        ;
+      next += interval;
+    }
+    patch((uchar*)frame, c, nd, seq);
+    nd->send_packet(nd->driver, (uchar*)frame, c->size);
+  }
+  end = rdtsc();
+  nic_getstat(c->ifindex, &after);
+
+  r->sent = seq;
+  r->dropped = after.q[NIC_TXQ].drops - before.q[NIC_TXQ].drops;
+  r->usecs = usecs(end - start);
+  if(end > start)
+    r->pps = udiv64((uint64_t)seq * tsckhz * 1000, end - start, 0);
+
+  if(c->latency){
+    // Give the last frames 100ms to come back.
+    acquire(&tickslock);
+    t0 = ticks;
+    while(ticks - t0 < 10 && !myproc()->killed)
+      sleep(&ticks, &tickslock);
+    release(&tickslock);
+
+    acquire(&pktgen.lock);
+    pktgen.timing = 0;
+    r->replies = pktgen.nrtt;
+    release(&pktgen.lock);
+    if(r->replies)
+      percentiles(rtt, r->replies < PKTGEN_NRTT ? r->replies : PKTGEN_NRTT, r);
+    kfree((char*)rtt);
+  }
+  kfree(frame);
+
+  acquire(&pktgen.lock);
+  pktgen.busy = 0;
+  release(&pktgen.lock);
+  return 0;
+}
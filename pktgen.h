@@ -0,0 +1,41 @@
+#ifndef __XV6_NETSTACK_PKTGEN_H__
+#define __XV6_NETSTACK_PKTGEN_H__
+// In-kernel packet generator.
+// Both the kernel and user programs use this header file.
+
+#define PKTGEN_MINSIZE 60    // shortest Ethernet frame without FCS
+#define PKTGEN_MAXSIZE 1514  // longest Ethernet frame without FCS
+#define PKTGEN_NRTT    1024  // round trip samples kept per run
+
+// What pktgen should send. The frames are UDP/IPv4 to the discard
+// port; the source MAC and the IP addresses step through the given
+// ranges, one frame at a time.
+struct pktgen_conf {
+  int ifindex;       // interface to send on
+  uint count;        // frames to send
+  uint size;         // frame length, PKTGEN_MINSIZE..PKTGEN_MAXSIZE
+  uint rate;         // frames per second, 0 sends as fast as possible
+  uchar dst[6];      // destination MAC
+  uchar nsrcmac;     // step the last byte of the source MAC over this many values
+  uchar latency;     // wait for reflected frames and time round trips
+  uint srcip;        // first source address, host byte order
+  uint dstip;        // first destination address, host byte order
+  ushort nsrcip;     // number of consecutive source addresses
+  ushort ndstip;     // number of consecutive destination addresses
+};
+
+// What a pktgen run achieved. Times are in microseconds.
+struct pktgen_result {
+  uint sent;         // frames handed to the driver
+  uint dropped;      // of those, frames the driver had no room for
+  uint usecs;        // time spent sending
+  uint pps;          // sent frames per second
+  uint replies;      // reflected frames that came back
+  uint rtt_min;
+  uint rtt_p50;
+  uint rtt_p90;
+  uint rtt_p99;
+  uint rtt_max;
+};
+
+#endif
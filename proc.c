@@ -153,6 +153,44 @@ userinit(void)
   release(&ptable.lock);
 }
 
+// A kernel thread starts here, still holding ptable.lock from
+// scheduler. It never returns to user space, so its trap frame's
+// eip holds the function it runs.
+static void
+kthreadstart(void)
+{
+  release(&ptable.lock);
+  ((void (*)(void))myproc()->tf->eip)();
+  panic("kthread returned");
+}
+
+// Start a kernel thread that runs fn, which must not return.
+// Its page table only maps the kernel.
+// Returns the pid, or -1 if there is no room.
+int
+kthread(char *name, void (*fn)(void))
+{
+  struct proc *p;
+
+  if((p = allocproc()) == 0)
+    return -1;
+  if((p->pgdir = setupkvm()) == 0){
+    kfree(p->kstack);
+    p->kstack = 0;
+    p->state = UNUSED;
+    return -1;
+  }
+  p->tf->eip = (uint)fn;
+  p->context->eip = (uint)kthreadstart;
+  safestrcpy(p->name, name, sizeof(p->name));
+
+  acquire(&ptable.lock);
+  p->state = RUNNABLE;
+  release(&ptable.lock);
+
+  return p->pid;
+}
+
 // Grow current process's memory by n bytes.
 // Return 0 on success, -1 on failure.
 int
@@ -0,0 +1,2888 @@
+
+_sh:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <runcmd>:
+struct cmd *parsecmd(char*);
+
+// Execute cmd.  Never returns.
+void
+runcmd(struct cmd *cmd)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 28             	sub    $0x28,%esp
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+       6:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+       a:	75 05                	jne    11 <runcmd+0x11>
+    exit();
+       c:	e8 21 11 00 00       	call   1132 <exit>
+
+  switch(cmd->type){
+      11:	8b 45 08             	mov    0x8(%ebp),%eax
+      14:	8b 00                	mov    (%eax),%eax
+      16:	83 f8 05             	cmp    $0x5,%eax
+      19:	77 09                	ja     24 <runcmd+0x24>
+      1b:	8b 04 85 f8 16 00 00 	mov    0x16f8(,%eax,4),%eax
+      22:	ff e0                	jmp    *%eax
+  default:
+    panic("runcmd");
+      24:	83 ec 0c             	sub    $0xc,%esp
+      27:	68 cc 16 00 00       	push   $0x16cc
+      2c:	e8 6e 03 00 00       	call   39f <panic>
+      31:	83 c4 10             	add    $0x10,%esp
+
+  case EXEC:
+    ecmd = (struct execcmd*)cmd;
+      34:	8b 45 08             	mov    0x8(%ebp),%eax
+      37:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(ecmd->argv[0] == 0)
+      3a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      3d:	8b 40 04             	mov    0x4(%eax),%eax
+      40:	85 c0                	test   %eax,%eax
+      42:	75 05                	jne    49 <runcmd+0x49>
+      exit();
+      44:	e8 e9 10 00 00       	call   1132 <exit>
+    exec(ecmd->argv[0], ecmd->argv);
+      49:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      4c:	8d 50 04             	lea    0x4(%eax),%edx
+      4f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      52:	8b 40 04             	mov    0x4(%eax),%eax
+      55:	83 ec 08             	sub    $0x8,%esp
+      58:	52                   	push   %edx
+      59:	50                   	push   %eax
+      5a:	e8 0b 11 00 00       	call   116a <exec>
+      5f:	83 c4 10             	add    $0x10,%esp
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+      62:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      65:	8b 40 04             	mov    0x4(%eax),%eax
+      68:	83 ec 04             	sub    $0x4,%esp
+      6b:	50                   	push   %eax
+      6c:	68 d3 16 00 00       	push   $0x16d3
+      71:	6a 02                	push   $0x2
+      73:	e8 76 12 00 00       	call   12ee <printf>
+      78:	83 c4 10             	add    $0x10,%esp
+    break;
+      7b:	e9 c6 01 00 00       	jmp    246 <runcmd+0x246>
+
+  case REDIR:
+    rcmd = (struct redircmd*)cmd;
+      80:	8b 45 08             	mov    0x8(%ebp),%eax
+      83:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    close(rcmd->fd);
+      86:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      89:	8b 40 14             	mov    0x14(%eax),%eax
+      8c:	83 ec 0c             	sub    $0xc,%esp
+      8f:	50                   	push   %eax
+      90:	e8 c5 10 00 00       	call   115a <close>
+      95:	83 c4 10             	add    $0x10,%esp
+    if(open(rcmd->file, rcmd->mode) < 0){
+      98:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      9b:	8b 50 10             	mov    0x10(%eax),%edx
+      9e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      a1:	8b 40 08             	mov    0x8(%eax),%eax
+      a4:	83 ec 08             	sub    $0x8,%esp
+      a7:	52                   	push   %edx
+      a8:	50                   	push   %eax
+      a9:	e8 c4 10 00 00       	call   1172 <open>
+      ae:	83 c4 10             	add    $0x10,%esp
+      b1:	85 c0                	test   %eax,%eax
+      b3:	79 1e                	jns    d3 <runcmd+0xd3>
+      printf(2, "open %s failed\n", rcmd->file);
+      b5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      b8:	8b 40 08             	mov    0x8(%eax),%eax
+      bb:	83 ec 04             	sub    $0x4,%esp
+      be:	50                   	push   %eax
+      bf:	68 e3 16 00 00       	push   $0x16e3
+      c4:	6a 02                	push   $0x2
+      c6:	e8 23 12 00 00       	call   12ee <printf>
+      cb:	83 c4 10             	add    $0x10,%esp
+      exit();
+      ce:	e8 5f 10 00 00       	call   1132 <exit>
+    }
+    runcmd(rcmd->cmd);
+      d3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      d6:	8b 40 04             	mov    0x4(%eax),%eax
+      d9:	83 ec 0c             	sub    $0xc,%esp
+      dc:	50                   	push   %eax
+      dd:	e8 1e ff ff ff       	call   0 <runcmd>
+      e2:	83 c4 10             	add    $0x10,%esp
+    break;
+      e5:	e9 5c 01 00 00       	jmp    246 <runcmd+0x246>
+
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+      ea:	8b 45 08             	mov    0x8(%ebp),%eax
+      ed:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(fork1() == 0)
+      f0:	e8 ca 02 00 00       	call   3bf <fork1>
+      f5:	85 c0                	test   %eax,%eax
+      f7:	75 12                	jne    10b <runcmd+0x10b>
+      runcmd(lcmd->left);
+      f9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+      fc:	8b 40 04             	mov    0x4(%eax),%eax
+      ff:	83 ec 0c             	sub    $0xc,%esp
+     102:	50                   	push   %eax
+     103:	e8 f8 fe ff ff       	call   0 <runcmd>
+     108:	83 c4 10             	add    $0x10,%esp
+    wait();
+     10b:	e8 2a 10 00 00       	call   113a <wait>
+    runcmd(lcmd->right);
+     110:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     113:	8b 40 08             	mov    0x8(%eax),%eax
+     116:	83 ec 0c             	sub    $0xc,%esp
+     119:	50                   	push   %eax
+     11a:	e8 e1 fe ff ff       	call   0 <runcmd>
+     11f:	83 c4 10             	add    $0x10,%esp
+    break;
+     122:	e9 1f 01 00 00       	jmp    246 <runcmd+0x246>
+
+  case PIPE:
+    pcmd = (struct pipecmd*)cmd;
+     127:	8b 45 08             	mov    0x8(%ebp),%eax
+     12a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if(pipe(p) < 0)
+     12d:	83 ec 0c             	sub    $0xc,%esp
+     130:	8d 45 dc             	lea    -0x24(%ebp),%eax
+     133:	50                   	push   %eax
+     134:	e8 09 10 00 00       	call   1142 <pipe>
+     139:	83 c4 10             	add    $0x10,%esp
+     13c:	85 c0                	test   %eax,%eax
+     13e:	79 10                	jns    150 <runcmd+0x150>
+      panic("pipe");
+     140:	83 ec 0c             	sub    $0xc,%esp
+     143:	68 f3 16 00 00       	push   $0x16f3
+     148:	e8 52 02 00 00       	call   39f <panic>
+     14d:	83 c4 10             	add    $0x10,%esp
+    if(fork1() == 0){
+     150:	e8 6a 02 00 00       	call   3bf <fork1>
+     155:	85 c0                	test   %eax,%eax
+     157:	75 4c                	jne    1a5 <runcmd+0x1a5>
+      close(1);
+     159:	83 ec 0c             	sub    $0xc,%esp
+     15c:	6a 01                	push   $0x1
+     15e:	e8 f7 0f 00 00       	call   115a <close>
+     163:	83 c4 10             	add    $0x10,%esp
+      dup(p[1]);
+     166:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     169:	83 ec 0c             	sub    $0xc,%esp
+     16c:	50                   	push   %eax
+     16d:	e8 38 10 00 00       	call   11aa <dup>
+     172:	83 c4 10             	add    $0x10,%esp
+      close(p[0]);
+     175:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     178:	83 ec 0c             	sub    $0xc,%esp
+     17b:	50                   	push   %eax
+     17c:	e8 d9 0f 00 00       	call   115a <close>
+     181:	83 c4 10             	add    $0x10,%esp
+      close(p[1]);
+     184:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     187:	83 ec 0c             	sub    $0xc,%esp
+     18a:	50                   	push   %eax
+     18b:	e8 ca 0f 00 00       	call   115a <close>
+     190:	83 c4 10             	add    $0x10,%esp
+      runcmd(pcmd->left);
+     193:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     196:	8b 40 04             	mov    0x4(%eax),%eax
+     199:	83 ec 0c             	sub    $0xc,%esp
+     19c:	50                   	push   %eax
+     19d:	e8 5e fe ff ff       	call   0 <runcmd>
+     1a2:	83 c4 10             	add    $0x10,%esp
+    }
+    if(fork1() == 0){
+     1a5:	e8 15 02 00 00       	call   3bf <fork1>
+     1aa:	85 c0                	test   %eax,%eax
+     1ac:	75 4c                	jne    1fa <runcmd+0x1fa>
+      close(0);
+     1ae:	83 ec 0c             	sub    $0xc,%esp
+     1b1:	6a 00                	push   $0x0
+     1b3:	e8 a2 0f 00 00       	call   115a <close>
+     1b8:	83 c4 10             	add    $0x10,%esp
+      dup(p[0]);
+     1bb:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     1be:	83 ec 0c             	sub    $0xc,%esp
+     1c1:	50                   	push   %eax
+     1c2:	e8 e3 0f 00 00       	call   11aa <dup>
+     1c7:	83 c4 10             	add    $0x10,%esp
+      close(p[0]);
+     1ca:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     1cd:	83 ec 0c             	sub    $0xc,%esp
+     1d0:	50                   	push   %eax
+     1d1:	e8 84 0f 00 00       	call   115a <close>
+     1d6:	83 c4 10             	add    $0x10,%esp
+      close(p[1]);
+     1d9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     1dc:	83 ec 0c             	sub    $0xc,%esp
+     1df:	50                   	push   %eax
+     1e0:	e8 75 0f 00 00       	call   115a <close>
+     1e5:	83 c4 10             	add    $0x10,%esp
+      runcmd(pcmd->right);
+     1e8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     1eb:	8b 40 08             	mov    0x8(%eax),%eax
+     1ee:	83 ec 0c             	sub    $0xc,%esp
+     1f1:	50                   	push   %eax
+     1f2:	e8 09 fe ff ff       	call   0 <runcmd>
+     1f7:	83 c4 10             	add    $0x10,%esp
+    }
+    close(p[0]);
+     1fa:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     1fd:	83 ec 0c             	sub    $0xc,%esp
+     200:	50                   	push   %eax
+     201:	e8 54 0f 00 00       	call   115a <close>
+     206:	83 c4 10             	add    $0x10,%esp
+    close(p[1]);
+     209:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     20c:	83 ec 0c             	sub    $0xc,%esp
+     20f:	50                   	push   %eax
+     210:	e8 45 0f 00 00       	call   115a <close>
+     215:	83 c4 10             	add    $0x10,%esp
+    wait();
+     218:	e8 1d 0f 00 00       	call   113a <wait>
+    wait();
+     21d:	e8 18 0f 00 00       	call   113a <wait>
+    break;
+     222:	eb 22                	jmp    246 <runcmd+0x246>
+
+  case BACK:
+    bcmd = (struct backcmd*)cmd;
+     224:	8b 45 08             	mov    0x8(%ebp),%eax
+     227:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fork1() == 0)
+     22a:	e8 90 01 00 00       	call   3bf <fork1>
+     22f:	85 c0                	test   %eax,%eax
+     231:	75 12                	jne    245 <runcmd+0x245>
+      runcmd(bcmd->cmd);
+     233:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     236:	8b 40 04             	mov    0x4(%eax),%eax
+     239:	83 ec 0c             	sub    $0xc,%esp
+     23c:	50                   	push   %eax
+     23d:	e8 be fd ff ff       	call   0 <runcmd>
+     242:	83 c4 10             	add    $0x10,%esp
+    break;
+     245:	90                   	nop
+  }
+  exit();
+     246:	e8 e7 0e 00 00       	call   1132 <exit>
+
+0000024b <getcmd>:
+}
+
+int
+getcmd(char *buf, int nbuf)
+{
+     24b:	55                   	push   %ebp
+     24c:	89 e5                	mov    %esp,%ebp
+     24e:	83 ec 08             	sub    $0x8,%esp
+  printf(2, "$ ");
+     251:	83 ec 08             	sub    $0x8,%esp
+     254:	68 10 17 00 00       	push   $0x1710
+     259:	6a 02                	push   $0x2
+     25b:	e8 8e 10 00 00       	call   12ee <printf>
+     260:	83 c4 10             	add    $0x10,%esp
+  memset(buf, 0, nbuf);
+     263:	8b 45 0c             	mov    0xc(%ebp),%eax
+     266:	83 ec 04             	sub    $0x4,%esp
+     269:	50                   	push   %eax
+     26a:	6a 00                	push   $0x0
+     26c:	ff 75 08             	push   0x8(%ebp)
+     26f:	e8 8d 0a 00 00       	call   d01 <memset>
+     274:	83 c4 10             	add    $0x10,%esp
+  gets(buf, nbuf);
+     277:	83 ec 08             	sub    $0x8,%esp
+     27a:	ff 75 0c             	push   0xc(%ebp)
+     27d:	ff 75 08             	push   0x8(%ebp)
+     280:	e8 c9 0a 00 00       	call   d4e <gets>
+     285:	83 c4 10             	add    $0x10,%esp
+  if(buf[0] == 0) // EOF
+     288:	8b 45 08             	mov    0x8(%ebp),%eax
+     28b:	0f b6 00             	movzbl (%eax),%eax
+     28e:	84 c0                	test   %al,%al
+     290:	75 07                	jne    299 <getcmd+0x4e>
+    return -1;
+     292:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     297:	eb 05                	jmp    29e <getcmd+0x53>
+  return 0;
+     299:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     29e:	c9                   	leave
+     29f:	c3                   	ret
+
+000002a0 <main>:
+
+int
+main(void)
+{
+     2a0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     2a4:	83 e4 f0             	and    $0xfffffff0,%esp
+     2a7:	ff 71 fc             	push   -0x4(%ecx)
+     2aa:	55                   	push   %ebp
+     2ab:	89 e5                	mov    %esp,%ebp
+     2ad:	51                   	push   %ecx
+     2ae:	83 ec 14             	sub    $0x14,%esp
+  static char buf[100];
+  int fd;
+
+  // Ensure that three file descriptors are open.
+  while((fd = open("console", O_RDWR)) >= 0){
+     2b1:	eb 16                	jmp    2c9 <main+0x29>
+    if(fd >= 3){
+     2b3:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+     2b7:	7e 10                	jle    2c9 <main+0x29>
+      close(fd);
+     2b9:	83 ec 0c             	sub    $0xc,%esp
+     2bc:	ff 75 f4             	push   -0xc(%ebp)
+     2bf:	e8 96 0e 00 00       	call   115a <close>
+     2c4:	83 c4 10             	add    $0x10,%esp
+      break;
+     2c7:	eb 1b                	jmp    2e4 <main+0x44>
+  while((fd = open("console", O_RDWR)) >= 0){
+     2c9:	83 ec 08             	sub    $0x8,%esp
+     2cc:	6a 02                	push   $0x2
+     2ce:	68 13 17 00 00       	push   $0x1713
+     2d3:	e8 9a 0e 00 00       	call   1172 <open>
+     2d8:	83 c4 10             	add    $0x10,%esp
+     2db:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     2de:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     2e2:	79 cf                	jns    2b3 <main+0x13>
+    }
+  }
+
+  // Read and run input commands.
+  while(getcmd(buf, sizeof(buf)) >= 0){
+     2e4:	e9 97 00 00 00       	jmp    380 <main+0xe0>
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+     2e9:	0f b6 05 00 1d 00 00 	movzbl 0x1d00,%eax
+     2f0:	3c 63                	cmp    $0x63,%al
+     2f2:	75 5f                	jne    353 <main+0xb3>
+     2f4:	0f b6 05 01 1d 00 00 	movzbl 0x1d01,%eax
+     2fb:	3c 64                	cmp    $0x64,%al
+     2fd:	75 54                	jne    353 <main+0xb3>
+     2ff:	0f b6 05 02 1d 00 00 	movzbl 0x1d02,%eax
+     306:	3c 20                	cmp    $0x20,%al
+     308:	75 49                	jne    353 <main+0xb3>
+      // Chdir must be called by the parent, not the child.
+      buf[strlen(buf)-1] = 0;  // chop \n
+     30a:	83 ec 0c             	sub    $0xc,%esp
+     30d:	68 00 1d 00 00       	push   $0x1d00
+     312:	e8 c3 09 00 00       	call   cda <strlen>
+     317:	83 c4 10             	add    $0x10,%esp
+     31a:	83 e8 01             	sub    $0x1,%eax
+     31d:	c6 80 00 1d 00 00 00 	movb   $0x0,0x1d00(%eax)
+      if(chdir(buf+3) < 0)
+     324:	b8 03 1d 00 00       	mov    $0x1d03,%eax
+     329:	83 ec 0c             	sub    $0xc,%esp
+     32c:	50                   	push   %eax
+     32d:	e8 70 0e 00 00       	call   11a2 <chdir>
+     332:	83 c4 10             	add    $0x10,%esp
+     335:	85 c0                	test   %eax,%eax
+     337:	79 46                	jns    37f <main+0xdf>
+        printf(2, "cannot cd %s\n", buf+3);
+     339:	b8 03 1d 00 00       	mov    $0x1d03,%eax
+     33e:	83 ec 04             	sub    $0x4,%esp
+     341:	50                   	push   %eax
+     342:	68 1b 17 00 00       	push   $0x171b
+     347:	6a 02                	push   $0x2
+     349:	e8 a0 0f 00 00       	call   12ee <printf>
+     34e:	83 c4 10             	add    $0x10,%esp
+      continue;
+     351:	eb 2c                	jmp    37f <main+0xdf>
+    }
+    if(fork1() == 0)
+     353:	e8 67 00 00 00       	call   3bf <fork1>
+     358:	85 c0                	test   %eax,%eax
+     35a:	75 1c                	jne    378 <main+0xd8>
+      runcmd(parsecmd(buf));
+     35c:	83 ec 0c             	sub    $0xc,%esp
+     35f:	68 00 1d 00 00       	push   $0x1d00
+     364:	e8 ad 03 00 00       	call   716 <parsecmd>
+     369:	83 c4 10             	add    $0x10,%esp
+     36c:	83 ec 0c             	sub    $0xc,%esp
+     36f:	50                   	push   %eax
+     370:	e8 8b fc ff ff       	call   0 <runcmd>
+     375:	83 c4 10             	add    $0x10,%esp
+    wait();
+     378:	e8 bd 0d 00 00       	call   113a <wait>
+     37d:	eb 01                	jmp    380 <main+0xe0>
+      continue;
+     37f:	90                   	nop
+  while(getcmd(buf, sizeof(buf)) >= 0){
+     380:	83 ec 08             	sub    $0x8,%esp
+     383:	6a 64                	push   $0x64
+     385:	68 00 1d 00 00       	push   $0x1d00
+     38a:	e8 bc fe ff ff       	call   24b <getcmd>
+     38f:	83 c4 10             	add    $0x10,%esp
+     392:	85 c0                	test   %eax,%eax
+     394:	0f 89 4f ff ff ff    	jns    2e9 <main+0x49>
+  }
+  exit();
+     39a:	e8 93 0d 00 00       	call   1132 <exit>
+
+0000039f <panic>:
+}
+
+void
+panic(char *s)
+{
+     39f:	55                   	push   %ebp
+     3a0:	89 e5                	mov    %esp,%ebp
+     3a2:	83 ec 08             	sub    $0x8,%esp
+  printf(2, "%s\n", s);
+     3a5:	83 ec 04             	sub    $0x4,%esp
+     3a8:	ff 75 08             	push   0x8(%ebp)
+     3ab:	68 29 17 00 00       	push   $0x1729
+     3b0:	6a 02                	push   $0x2
+     3b2:	e8 37 0f 00 00       	call   12ee <printf>
+     3b7:	83 c4 10             	add    $0x10,%esp
+  exit();
+     3ba:	e8 73 0d 00 00       	call   1132 <exit>
+
+000003bf <fork1>:
+}
+
+int
+fork1(void)
+{
+     3bf:	55                   	push   %ebp
+     3c0:	89 e5                	mov    %esp,%ebp
+     3c2:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  pid = fork();
+     3c5:	e8 60 0d 00 00       	call   112a <fork>
+     3ca:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(pid == -1)
+     3cd:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+     3d1:	75 10                	jne    3e3 <fork1+0x24>
+    panic("fork");
+     3d3:	83 ec 0c             	sub    $0xc,%esp
+     3d6:	68 2d 17 00 00       	push   $0x172d
+     3db:	e8 bf ff ff ff       	call   39f <panic>
+     3e0:	83 c4 10             	add    $0x10,%esp
+  return pid;
+     3e3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     3e6:	c9                   	leave
+     3e7:	c3                   	ret
+
+000003e8 <execcmd>:
+//PAGEBREAK!
+// Constructors
+
+struct cmd*
+execcmd(void)
+{
+     3e8:	55                   	push   %ebp
+     3e9:	89 e5                	mov    %esp,%ebp
+     3eb:	83 ec 18             	sub    $0x18,%esp
+  struct execcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     3ee:	83 ec 0c             	sub    $0xc,%esp
+     3f1:	6a 54                	push   $0x54
+     3f3:	e8 ee 11 00 00       	call   15e6 <malloc>
+     3f8:	83 c4 10             	add    $0x10,%esp
+     3fb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  memset(cmd, 0, sizeof(*cmd));
+     3fe:	83 ec 04             	sub    $0x4,%esp
+     401:	6a 54                	push   $0x54
+     403:	6a 00                	push   $0x0
+     405:	ff 75 f4             	push   -0xc(%ebp)
+     408:	e8 f4 08 00 00       	call   d01 <memset>
+     40d:	83 c4 10             	add    $0x10,%esp
+  cmd->type = EXEC;
+     410:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     413:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  return (struct cmd*)cmd;
+     419:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     41c:	c9                   	leave
+     41d:	c3                   	ret
+
+0000041e <redircmd>:
+
+struct cmd*
+redircmd(struct cmd *subcmd, char *file, char *efile, int mode, int fd)
+{
+     41e:	55                   	push   %ebp
+     41f:	89 e5                	mov    %esp,%ebp
+     421:	83 ec 18             	sub    $0x18,%esp
+  struct redircmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     424:	83 ec 0c             	sub    $0xc,%esp
+     427:	6a 18                	push   $0x18
+     429:	e8 b8 11 00 00       	call   15e6 <malloc>
+     42e:	83 c4 10             	add    $0x10,%esp
+     431:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  memset(cmd, 0, sizeof(*cmd));
+     434:	83 ec 04             	sub    $0x4,%esp
+     437:	6a 18                	push   $0x18
+     439:	6a 00                	push   $0x0
+     43b:	ff 75 f4             	push   -0xc(%ebp)
+     43e:	e8 be 08 00 00       	call   d01 <memset>
+     443:	83 c4 10             	add    $0x10,%esp
+  cmd->type = REDIR;
+     446:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     449:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+  cmd->cmd = subcmd;
+     44f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     452:	8b 55 08             	mov    0x8(%ebp),%edx
+     455:	89 50 04             	mov    %edx,0x4(%eax)
+  cmd->file = file;
+     458:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     45b:	8b 55 0c             	mov    0xc(%ebp),%edx
+     45e:	89 50 08             	mov    %edx,0x8(%eax)
+  cmd->efile = efile;
+     461:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     464:	8b 55 10             	mov    0x10(%ebp),%edx
+     467:	89 50 0c             	mov    %edx,0xc(%eax)
+  cmd->mode = mode;
+     46a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     46d:	8b 55 14             	mov    0x14(%ebp),%edx
+     470:	89 50 10             	mov    %edx,0x10(%eax)
+  cmd->fd = fd;
+     473:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     476:	8b 55 18             	mov    0x18(%ebp),%edx
+     479:	89 50 14             	mov    %edx,0x14(%eax)
+  return (struct cmd*)cmd;
+     47c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     47f:	c9                   	leave
+     480:	c3                   	ret
+
+00000481 <pipecmd>:
+
+struct cmd*
+pipecmd(struct cmd *left, struct cmd *right)
+{
+     481:	55                   	push   %ebp
+     482:	89 e5                	mov    %esp,%ebp
+     484:	83 ec 18             	sub    $0x18,%esp
+  struct pipecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     487:	83 ec 0c             	sub    $0xc,%esp
+     48a:	6a 0c                	push   $0xc
+     48c:	e8 55 11 00 00       	call   15e6 <malloc>
+     491:	83 c4 10             	add    $0x10,%esp
+     494:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  memset(cmd, 0, sizeof(*cmd));
+     497:	83 ec 04             	sub    $0x4,%esp
+     49a:	6a 0c                	push   $0xc
+     49c:	6a 00                	push   $0x0
+     49e:	ff 75 f4             	push   -0xc(%ebp)
+     4a1:	e8 5b 08 00 00       	call   d01 <memset>
+     4a6:	83 c4 10             	add    $0x10,%esp
+  cmd->type = PIPE;
+     4a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4ac:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+  cmd->left = left;
+     4b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4b5:	8b 55 08             	mov    0x8(%ebp),%edx
+     4b8:	89 50 04             	mov    %edx,0x4(%eax)
+  cmd->right = right;
+     4bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4be:	8b 55 0c             	mov    0xc(%ebp),%edx
+     4c1:	89 50 08             	mov    %edx,0x8(%eax)
+  return (struct cmd*)cmd;
+     4c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     4c7:	c9                   	leave
+     4c8:	c3                   	ret
+
+000004c9 <listcmd>:
+
+struct cmd*
+listcmd(struct cmd *left, struct cmd *right)
+{
+     4c9:	55                   	push   %ebp
+     4ca:	89 e5                	mov    %esp,%ebp
+     4cc:	83 ec 18             	sub    $0x18,%esp
+  struct listcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     4cf:	83 ec 0c             	sub    $0xc,%esp
+     4d2:	6a 0c                	push   $0xc
+     4d4:	e8 0d 11 00 00       	call   15e6 <malloc>
+     4d9:	83 c4 10             	add    $0x10,%esp
+     4dc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  memset(cmd, 0, sizeof(*cmd));
+     4df:	83 ec 04             	sub    $0x4,%esp
+     4e2:	6a 0c                	push   $0xc
+     4e4:	6a 00                	push   $0x0
+     4e6:	ff 75 f4             	push   -0xc(%ebp)
+     4e9:	e8 13 08 00 00       	call   d01 <memset>
+     4ee:	83 c4 10             	add    $0x10,%esp
+  cmd->type = LIST;
+     4f1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4f4:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+  cmd->left = left;
+     4fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4fd:	8b 55 08             	mov    0x8(%ebp),%edx
+     500:	89 50 04             	mov    %edx,0x4(%eax)
+  cmd->right = right;
+     503:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     506:	8b 55 0c             	mov    0xc(%ebp),%edx
+     509:	89 50 08             	mov    %edx,0x8(%eax)
+  return (struct cmd*)cmd;
+     50c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     50f:	c9                   	leave
+     510:	c3                   	ret
+
+00000511 <backcmd>:
+
+struct cmd*
+backcmd(struct cmd *subcmd)
+{
+     511:	55                   	push   %ebp
+     512:	89 e5                	mov    %esp,%ebp
+     514:	83 ec 18             	sub    $0x18,%esp
+  struct backcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     517:	83 ec 0c             	sub    $0xc,%esp
+     51a:	6a 08                	push   $0x8
+     51c:	e8 c5 10 00 00       	call   15e6 <malloc>
+     521:	83 c4 10             	add    $0x10,%esp
+     524:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  memset(cmd, 0, sizeof(*cmd));
+     527:	83 ec 04             	sub    $0x4,%esp
+     52a:	6a 08                	push   $0x8
+     52c:	6a 00                	push   $0x0
+     52e:	ff 75 f4             	push   -0xc(%ebp)
+     531:	e8 cb 07 00 00       	call   d01 <memset>
+     536:	83 c4 10             	add    $0x10,%esp
+  cmd->type = BACK;
+     539:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     53c:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+  cmd->cmd = subcmd;
+     542:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     545:	8b 55 08             	mov    0x8(%ebp),%edx
+     548:	89 50 04             	mov    %edx,0x4(%eax)
+  return (struct cmd*)cmd;
+     54b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     54e:	c9                   	leave
+     54f:	c3                   	ret
+
+00000550 <gettoken>:
+char whitespace[] = " \t\r\n\v";
+char symbols[] = "<|>&;()";
+
+int
+gettoken(char **ps, char *es, char **q, char **eq)
+{
+     550:	55                   	push   %ebp
+     551:	89 e5                	mov    %esp,%ebp
+     553:	83 ec 18             	sub    $0x18,%esp
+  char *s;
+  int ret;
+
+  s = *ps;
+     556:	8b 45 08             	mov    0x8(%ebp),%eax
+     559:	8b 00                	mov    (%eax),%eax
+     55b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(s < es && strchr(whitespace, *s))
+     55e:	eb 04                	jmp    564 <gettoken+0x14>
+    s++;
+     560:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  while(s < es && strchr(whitespace, *s))
+     564:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     567:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     56a:	73 1e                	jae    58a <gettoken+0x3a>
+     56c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     56f:	0f b6 00             	movzbl (%eax),%eax
+     572:	0f be c0             	movsbl %al,%eax
+     575:	83 ec 08             	sub    $0x8,%esp
+     578:	50                   	push   %eax
+     579:	68 d4 1c 00 00       	push   $0x1cd4
+     57e:	e8 98 07 00 00       	call   d1b <strchr>
+     583:	83 c4 10             	add    $0x10,%esp
+     586:	85 c0                	test   %eax,%eax
+     588:	75 d6                	jne    560 <gettoken+0x10>
+  if(q)
+     58a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     58e:	74 08                	je     598 <gettoken+0x48>
+    *q = s;
+     590:	8b 45 10             	mov    0x10(%ebp),%eax
+     593:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     596:	89 10                	mov    %edx,(%eax)
+  ret = *s;
+     598:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     59b:	0f b6 00             	movzbl (%eax),%eax
+     59e:	0f be c0             	movsbl %al,%eax
+     5a1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  switch(*s){
+     5a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     5a7:	0f b6 00             	movzbl (%eax),%eax
+     5aa:	0f be c0             	movsbl %al,%eax
+     5ad:	83 f8 7c             	cmp    $0x7c,%eax
+     5b0:	74 2c                	je     5de <gettoken+0x8e>
+     5b2:	83 f8 7c             	cmp    $0x7c,%eax
+     5b5:	7f 48                	jg     5ff <gettoken+0xaf>
+     5b7:	83 f8 3e             	cmp    $0x3e,%eax
+     5ba:	74 28                	je     5e4 <gettoken+0x94>
+     5bc:	83 f8 3e             	cmp    $0x3e,%eax
+     5bf:	7f 3e                	jg     5ff <gettoken+0xaf>
+     5c1:	83 f8 3c             	cmp    $0x3c,%eax
+     5c4:	7f 39                	jg     5ff <gettoken+0xaf>
+     5c6:	83 f8 3b             	cmp    $0x3b,%eax
+     5c9:	7d 13                	jge    5de <gettoken+0x8e>
+     5cb:	83 f8 29             	cmp    $0x29,%eax
+     5ce:	7f 2f                	jg     5ff <gettoken+0xaf>
+     5d0:	83 f8 28             	cmp    $0x28,%eax
+     5d3:	7d 09                	jge    5de <gettoken+0x8e>
+     5d5:	85 c0                	test   %eax,%eax
+     5d7:	74 79                	je     652 <gettoken+0x102>
+     5d9:	83 f8 26             	cmp    $0x26,%eax
+     5dc:	75 21                	jne    5ff <gettoken+0xaf>
+  case '(':
+  case ')':
+  case ';':
+  case '&':
+  case '<':
+    s++;
+     5de:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    break;
+     5e2:	eb 75                	jmp    659 <gettoken+0x109>
+  case '>':
+    s++;
+     5e4:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    if(*s == '>'){
+     5e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     5eb:	0f b6 00             	movzbl (%eax),%eax
+     5ee:	3c 3e                	cmp    $0x3e,%al
+     5f0:	75 63                	jne    655 <gettoken+0x105>
+      ret = '+';
+     5f2:	c7 45 f0 2b 00 00 00 	movl   $0x2b,-0x10(%ebp)
+      s++;
+     5f9:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    }
+    break;
+     5fd:	eb 56                	jmp    655 <gettoken+0x105>
+  default:
+    ret = 'a';
+     5ff:	c7 45 f0 61 00 00 00 	movl   $0x61,-0x10(%ebp)
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     606:	eb 04                	jmp    60c <gettoken+0xbc>
+      s++;
+     608:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     60c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     60f:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     612:	73 44                	jae    658 <gettoken+0x108>
+     614:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     617:	0f b6 00             	movzbl (%eax),%eax
+     61a:	0f be c0             	movsbl %al,%eax
+     61d:	83 ec 08             	sub    $0x8,%esp
+     620:	50                   	push   %eax
+     621:	68 d4 1c 00 00       	push   $0x1cd4
+     626:	e8 f0 06 00 00       	call   d1b <strchr>
+     62b:	83 c4 10             	add    $0x10,%esp
+     62e:	85 c0                	test   %eax,%eax
+     630:	75 26                	jne    658 <gettoken+0x108>
+     632:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     635:	0f b6 00             	movzbl (%eax),%eax
+     638:	0f be c0             	movsbl %al,%eax
+     63b:	83 ec 08             	sub    $0x8,%esp
+     63e:	50                   	push   %eax
+     63f:	68 dc 1c 00 00       	push   $0x1cdc
+     644:	e8 d2 06 00 00       	call   d1b <strchr>
+     649:	83 c4 10             	add    $0x10,%esp
+     64c:	85 c0                	test   %eax,%eax
+     64e:	74 b8                	je     608 <gettoken+0xb8>
+    break;
+     650:	eb 06                	jmp    658 <gettoken+0x108>
+    break;
+     652:	90                   	nop
+     653:	eb 04                	jmp    659 <gettoken+0x109>
+    break;
+     655:	90                   	nop
+     656:	eb 01                	jmp    659 <gettoken+0x109>
+    break;
+     658:	90                   	nop
+  }
+  if(eq)
+     659:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     65d:	74 0e                	je     66d <gettoken+0x11d>
+    *eq = s;
+     65f:	8b 45 14             	mov    0x14(%ebp),%eax
+     662:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     665:	89 10                	mov    %edx,(%eax)
+
+  while(s < es && strchr(whitespace, *s))
+     667:	eb 04                	jmp    66d <gettoken+0x11d>
+    s++;
+     669:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  while(s < es && strchr(whitespace, *s))
+     66d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     670:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     673:	73 1e                	jae    693 <gettoken+0x143>
+     675:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     678:	0f b6 00             	movzbl (%eax),%eax
+     67b:	0f be c0             	movsbl %al,%eax
+     67e:	83 ec 08             	sub    $0x8,%esp
+     681:	50                   	push   %eax
+     682:	68 d4 1c 00 00       	push   $0x1cd4
+     687:	e8 8f 06 00 00       	call   d1b <strchr>
+     68c:	83 c4 10             	add    $0x10,%esp
+     68f:	85 c0                	test   %eax,%eax
+     691:	75 d6                	jne    669 <gettoken+0x119>
+  *ps = s;
+     693:	8b 45 08             	mov    0x8(%ebp),%eax
+     696:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     699:	89 10                	mov    %edx,(%eax)
+  return ret;
+     69b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     69e:	c9                   	leave
+     69f:	c3                   	ret
+
+000006a0 <peek>:
+
+int
+peek(char **ps, char *es, char *toks)
+{
+     6a0:	55                   	push   %ebp
+     6a1:	89 e5                	mov    %esp,%ebp
+     6a3:	83 ec 18             	sub    $0x18,%esp
+  char *s;
+
+  s = *ps;
+     6a6:	8b 45 08             	mov    0x8(%ebp),%eax
+     6a9:	8b 00                	mov    (%eax),%eax
+     6ab:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(s < es && strchr(whitespace, *s))
+     6ae:	eb 04                	jmp    6b4 <peek+0x14>
+    s++;
+     6b0:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  while(s < es && strchr(whitespace, *s))
+     6b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     6b7:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     6ba:	73 1e                	jae    6da <peek+0x3a>
+     6bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     6bf:	0f b6 00             	movzbl (%eax),%eax
+     6c2:	0f be c0             	movsbl %al,%eax
+     6c5:	83 ec 08             	sub    $0x8,%esp
+     6c8:	50                   	push   %eax
+     6c9:	68 d4 1c 00 00       	push   $0x1cd4
+     6ce:	e8 48 06 00 00       	call   d1b <strchr>
+     6d3:	83 c4 10             	add    $0x10,%esp
+     6d6:	85 c0                	test   %eax,%eax
+     6d8:	75 d6                	jne    6b0 <peek+0x10>
+  *ps = s;
+     6da:	8b 45 08             	mov    0x8(%ebp),%eax
+     6dd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     6e0:	89 10                	mov    %edx,(%eax)
+  return *s && strchr(toks, *s);
+     6e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     6e5:	0f b6 00             	movzbl (%eax),%eax
+     6e8:	84 c0                	test   %al,%al
+     6ea:	74 23                	je     70f <peek+0x6f>
+     6ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     6ef:	0f b6 00             	movzbl (%eax),%eax
+     6f2:	0f be c0             	movsbl %al,%eax
+     6f5:	83 ec 08             	sub    $0x8,%esp
+     6f8:	50                   	push   %eax
+     6f9:	ff 75 10             	push   0x10(%ebp)
+     6fc:	e8 1a 06 00 00       	call   d1b <strchr>
+     701:	83 c4 10             	add    $0x10,%esp
+     704:	85 c0                	test   %eax,%eax
+     706:	74 07                	je     70f <peek+0x6f>
+     708:	b8 01 00 00 00       	mov    $0x1,%eax
+     70d:	eb 05                	jmp    714 <peek+0x74>
+     70f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     714:	c9                   	leave
+     715:	c3                   	ret
+
+00000716 <parsecmd>:
+struct cmd *parseexec(char**, char*);
+struct cmd *nulterminate(struct cmd*);
+
+struct cmd*
+parsecmd(char *s)
+{
+     716:	55                   	push   %ebp
+     717:	89 e5                	mov    %esp,%ebp
+     719:	53                   	push   %ebx
+     71a:	83 ec 14             	sub    $0x14,%esp
+  char *es;
+  struct cmd *cmd;
+
+  es = s + strlen(s);
+     71d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     720:	8b 45 08             	mov    0x8(%ebp),%eax
+     723:	83 ec 0c             	sub    $0xc,%esp
+     726:	50                   	push   %eax
+     727:	e8 ae 05 00 00       	call   cda <strlen>
+     72c:	83 c4 10             	add    $0x10,%esp
+     72f:	01 d8                	add    %ebx,%eax
+     731:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  cmd = parseline(&s, es);
+     734:	83 ec 08             	sub    $0x8,%esp
+     737:	ff 75 f4             	push   -0xc(%ebp)
+     73a:	8d 45 08             	lea    0x8(%ebp),%eax
+     73d:	50                   	push   %eax
+     73e:	e8 61 00 00 00       	call   7a4 <parseline>
+     743:	83 c4 10             	add    $0x10,%esp
+     746:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  peek(&s, es, "");
+     749:	83 ec 04             	sub    $0x4,%esp
+     74c:	68 32 17 00 00       	push   $0x1732
+     751:	ff 75 f4             	push   -0xc(%ebp)
+     754:	8d 45 08             	lea    0x8(%ebp),%eax
+     757:	50                   	push   %eax
+     758:	e8 43 ff ff ff       	call   6a0 <peek>
+     75d:	83 c4 10             	add    $0x10,%esp
+  if(s != es){
+     760:	8b 45 08             	mov    0x8(%ebp),%eax
+     763:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+     766:	74 26                	je     78e <parsecmd+0x78>
+    printf(2, "leftovers: %s\n", s);
+     768:	8b 45 08             	mov    0x8(%ebp),%eax
+     76b:	83 ec 04             	sub    $0x4,%esp
+     76e:	50                   	push   %eax
+     76f:	68 33 17 00 00       	push   $0x1733
+     774:	6a 02                	push   $0x2
+     776:	e8 73 0b 00 00       	call   12ee <printf>
+     77b:	83 c4 10             	add    $0x10,%esp
+    panic("syntax");
+     77e:	83 ec 0c             	sub    $0xc,%esp
+     781:	68 42 17 00 00       	push   $0x1742
+     786:	e8 14 fc ff ff       	call   39f <panic>
+     78b:	83 c4 10             	add    $0x10,%esp
+  }
+  nulterminate(cmd);
+     78e:	83 ec 0c             	sub    $0xc,%esp
+     791:	ff 75 f0             	push   -0x10(%ebp)
+     794:	e8 ef 03 00 00       	call   b88 <nulterminate>
+     799:	83 c4 10             	add    $0x10,%esp
+  return cmd;
+     79c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     79f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     7a2:	c9                   	leave
+     7a3:	c3                   	ret
+
+000007a4 <parseline>:
+
+struct cmd*
+parseline(char **ps, char *es)
+{
+     7a4:	55                   	push   %ebp
+     7a5:	89 e5                	mov    %esp,%ebp
+     7a7:	83 ec 18             	sub    $0x18,%esp
+  struct cmd *cmd;
+
+  cmd = parsepipe(ps, es);
+     7aa:	83 ec 08             	sub    $0x8,%esp
+     7ad:	ff 75 0c             	push   0xc(%ebp)
+     7b0:	ff 75 08             	push   0x8(%ebp)
+     7b3:	e8 99 00 00 00       	call   851 <parsepipe>
+     7b8:	83 c4 10             	add    $0x10,%esp
+     7bb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(peek(ps, es, "&")){
+     7be:	eb 23                	jmp    7e3 <parseline+0x3f>
+    gettoken(ps, es, 0, 0);
+     7c0:	6a 00                	push   $0x0
+     7c2:	6a 00                	push   $0x0
+     7c4:	ff 75 0c             	push   0xc(%ebp)
+     7c7:	ff 75 08             	push   0x8(%ebp)
+     7ca:	e8 81 fd ff ff       	call   550 <gettoken>
+     7cf:	83 c4 10             	add    $0x10,%esp
+    cmd = backcmd(cmd);
+     7d2:	83 ec 0c             	sub    $0xc,%esp
+     7d5:	ff 75 f4             	push   -0xc(%ebp)
+     7d8:	e8 34 fd ff ff       	call   511 <backcmd>
+     7dd:	83 c4 10             	add    $0x10,%esp
+     7e0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(peek(ps, es, "&")){
+     7e3:	83 ec 04             	sub    $0x4,%esp
+     7e6:	68 49 17 00 00       	push   $0x1749
+     7eb:	ff 75 0c             	push   0xc(%ebp)
+     7ee:	ff 75 08             	push   0x8(%ebp)
+     7f1:	e8 aa fe ff ff       	call   6a0 <peek>
+     7f6:	83 c4 10             	add    $0x10,%esp
+     7f9:	85 c0                	test   %eax,%eax
+     7fb:	75 c3                	jne    7c0 <parseline+0x1c>
+  }
+  if(peek(ps, es, ";")){
+     7fd:	83 ec 04             	sub    $0x4,%esp
+     800:	68 4b 17 00 00       	push   $0x174b
+     805:	ff 75 0c             	push   0xc(%ebp)
+     808:	ff 75 08             	push   0x8(%ebp)
+     80b:	e8 90 fe ff ff       	call   6a0 <peek>
+     810:	83 c4 10             	add    $0x10,%esp
+     813:	85 c0                	test   %eax,%eax
+     815:	74 35                	je     84c <parseline+0xa8>
+    gettoken(ps, es, 0, 0);
+     817:	6a 00                	push   $0x0
+     819:	6a 00                	push   $0x0
+     81b:	ff 75 0c             	push   0xc(%ebp)
+     81e:	ff 75 08             	push   0x8(%ebp)
+     821:	e8 2a fd ff ff       	call   550 <gettoken>
+     826:	83 c4 10             	add    $0x10,%esp
+    cmd = listcmd(cmd, parseline(ps, es));
+     829:	83 ec 08             	sub    $0x8,%esp
+     82c:	ff 75 0c             	push   0xc(%ebp)
+     82f:	ff 75 08             	push   0x8(%ebp)
+     832:	e8 6d ff ff ff       	call   7a4 <parseline>
+     837:	83 c4 10             	add    $0x10,%esp
+     83a:	83 ec 08             	sub    $0x8,%esp
+     83d:	50                   	push   %eax
+     83e:	ff 75 f4             	push   -0xc(%ebp)
+     841:	e8 83 fc ff ff       	call   4c9 <listcmd>
+     846:	83 c4 10             	add    $0x10,%esp
+     849:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  }
+  return cmd;
+     84c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     84f:	c9                   	leave
+     850:	c3                   	ret
+
+00000851 <parsepipe>:
+
+struct cmd*
+parsepipe(char **ps, char *es)
+{
+     851:	55                   	push   %ebp
+     852:	89 e5                	mov    %esp,%ebp
+     854:	83 ec 18             	sub    $0x18,%esp
+  struct cmd *cmd;
+
+  cmd = parseexec(ps, es);
+     857:	83 ec 08             	sub    $0x8,%esp
+     85a:	ff 75 0c             	push   0xc(%ebp)
+     85d:	ff 75 08             	push   0x8(%ebp)
+     860:	e8 f0 01 00 00       	call   a55 <parseexec>
+     865:	83 c4 10             	add    $0x10,%esp
+     868:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(peek(ps, es, "|")){
+     86b:	83 ec 04             	sub    $0x4,%esp
+     86e:	68 4d 17 00 00       	push   $0x174d
+     873:	ff 75 0c             	push   0xc(%ebp)
+     876:	ff 75 08             	push   0x8(%ebp)
+     879:	e8 22 fe ff ff       	call   6a0 <peek>
+     87e:	83 c4 10             	add    $0x10,%esp
+     881:	85 c0                	test   %eax,%eax
+     883:	74 35                	je     8ba <parsepipe+0x69>
+    gettoken(ps, es, 0, 0);
+     885:	6a 00                	push   $0x0
+     887:	6a 00                	push   $0x0
+     889:	ff 75 0c             	push   0xc(%ebp)
+     88c:	ff 75 08             	push   0x8(%ebp)
+     88f:	e8 bc fc ff ff       	call   550 <gettoken>
+     894:	83 c4 10             	add    $0x10,%esp
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     897:	83 ec 08             	sub    $0x8,%esp
+     89a:	ff 75 0c             	push   0xc(%ebp)
+     89d:	ff 75 08             	push   0x8(%ebp)
+     8a0:	e8 ac ff ff ff       	call   851 <parsepipe>
+     8a5:	83 c4 10             	add    $0x10,%esp
+     8a8:	83 ec 08             	sub    $0x8,%esp
+     8ab:	50                   	push   %eax
+     8ac:	ff 75 f4             	push   -0xc(%ebp)
+     8af:	e8 cd fb ff ff       	call   481 <pipecmd>
+     8b4:	83 c4 10             	add    $0x10,%esp
+     8b7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  }
+  return cmd;
+     8ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     8bd:	c9                   	leave
+     8be:	c3                   	ret
+
+000008bf <parseredirs>:
+
+struct cmd*
+parseredirs(struct cmd *cmd, char **ps, char *es)
+{
+     8bf:	55                   	push   %ebp
+     8c0:	89 e5                	mov    %esp,%ebp
+     8c2:	83 ec 18             	sub    $0x18,%esp
+  int tok;
+  char *q, *eq;
+
+  while(peek(ps, es, "<>")){
+     8c5:	e9 ba 00 00 00       	jmp    984 <parseredirs+0xc5>
+    tok = gettoken(ps, es, 0, 0);
+     8ca:	6a 00                	push   $0x0
+     8cc:	6a 00                	push   $0x0
+     8ce:	ff 75 10             	push   0x10(%ebp)
+     8d1:	ff 75 0c             	push   0xc(%ebp)
+     8d4:	e8 77 fc ff ff       	call   550 <gettoken>
+     8d9:	83 c4 10             	add    $0x10,%esp
+     8dc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(gettoken(ps, es, &q, &eq) != 'a')
+     8df:	8d 45 ec             	lea    -0x14(%ebp),%eax
+     8e2:	50                   	push   %eax
+     8e3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     8e6:	50                   	push   %eax
+     8e7:	ff 75 10             	push   0x10(%ebp)
+     8ea:	ff 75 0c             	push   0xc(%ebp)
+     8ed:	e8 5e fc ff ff       	call   550 <gettoken>
+     8f2:	83 c4 10             	add    $0x10,%esp
+     8f5:	83 f8 61             	cmp    $0x61,%eax
+     8f8:	74 10                	je     90a <parseredirs+0x4b>
+      panic("missing file for redirection");
+     8fa:	83 ec 0c             	sub    $0xc,%esp
+     8fd:	68 4f 17 00 00       	push   $0x174f
+     902:	e8 98 fa ff ff       	call   39f <panic>
+     907:	83 c4 10             	add    $0x10,%esp
+    switch(tok){
+     90a:	83 7d f4 3e          	cmpl   $0x3e,-0xc(%ebp)
+     90e:	74 31                	je     941 <parseredirs+0x82>
+     910:	83 7d f4 3e          	cmpl   $0x3e,-0xc(%ebp)
+     914:	7f 6e                	jg     984 <parseredirs+0xc5>
+     916:	83 7d f4 2b          	cmpl   $0x2b,-0xc(%ebp)
+     91a:	74 47                	je     963 <parseredirs+0xa4>
+     91c:	83 7d f4 3c          	cmpl   $0x3c,-0xc(%ebp)
+     920:	75 62                	jne    984 <parseredirs+0xc5>
+    case '<':
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     922:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     925:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     928:	83 ec 0c             	sub    $0xc,%esp
+     92b:	6a 00                	push   $0x0
+     92d:	6a 00                	push   $0x0
+     92f:	52                   	push   %edx
+     930:	50                   	push   %eax
+     931:	ff 75 08             	push   0x8(%ebp)
+     934:	e8 e5 fa ff ff       	call   41e <redircmd>
+     939:	83 c4 20             	add    $0x20,%esp
+     93c:	89 45 08             	mov    %eax,0x8(%ebp)
+      break;
+     93f:	eb 43                	jmp    984 <parseredirs+0xc5>
+    case '>':
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     941:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     944:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     947:	83 ec 0c             	sub    $0xc,%esp
+     94a:	6a 01                	push   $0x1
+     94c:	68 01 02 00 00       	push   $0x201
+     951:	52                   	push   %edx
+     952:	50                   	push   %eax
+     953:	ff 75 08             	push   0x8(%ebp)
+     956:	e8 c3 fa ff ff       	call   41e <redircmd>
+     95b:	83 c4 20             	add    $0x20,%esp
+     95e:	89 45 08             	mov    %eax,0x8(%ebp)
+      break;
+     961:	eb 21                	jmp    984 <parseredirs+0xc5>
+    case '+':  // >>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     963:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     966:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     969:	83 ec 0c             	sub    $0xc,%esp
+     96c:	6a 01                	push   $0x1
+     96e:	68 01 02 00 00       	push   $0x201
+     973:	52                   	push   %edx
+     974:	50                   	push   %eax
+     975:	ff 75 08             	push   0x8(%ebp)
+     978:	e8 a1 fa ff ff       	call   41e <redircmd>
+     97d:	83 c4 20             	add    $0x20,%esp
+     980:	89 45 08             	mov    %eax,0x8(%ebp)
+      break;
+     983:	90                   	nop
+  while(peek(ps, es, "<>")){
+     984:	83 ec 04             	sub    $0x4,%esp
+     987:	68 6c 17 00 00       	push   $0x176c
+     98c:	ff 75 10             	push   0x10(%ebp)
+     98f:	ff 75 0c             	push   0xc(%ebp)
+     992:	e8 09 fd ff ff       	call   6a0 <peek>
+     997:	83 c4 10             	add    $0x10,%esp
+     99a:	85 c0                	test   %eax,%eax
+     99c:	0f 85 28 ff ff ff    	jne    8ca <parseredirs+0xb>
+    }
+  }
+  return cmd;
+     9a2:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     9a5:	c9                   	leave
+     9a6:	c3                   	ret
+
+000009a7 <parseblock>:
+
+struct cmd*
+parseblock(char **ps, char *es)
+{
+     9a7:	55                   	push   %ebp
+     9a8:	89 e5                	mov    %esp,%ebp
+     9aa:	83 ec 18             	sub    $0x18,%esp
+  struct cmd *cmd;
+
+  if(!peek(ps, es, "("))
+     9ad:	83 ec 04             	sub    $0x4,%esp
+     9b0:	68 6f 17 00 00       	push   $0x176f
+     9b5:	ff 75 0c             	push   0xc(%ebp)
+     9b8:	ff 75 08             	push   0x8(%ebp)
+     9bb:	e8 e0 fc ff ff       	call   6a0 <peek>
+     9c0:	83 c4 10             	add    $0x10,%esp
+     9c3:	85 c0                	test   %eax,%eax
+     9c5:	75 10                	jne    9d7 <parseblock+0x30>
+    panic("parseblock");
+     9c7:	83 ec 0c             	sub    $0xc,%esp
+     9ca:	68 71 17 00 00       	push   $0x1771
+     9cf:	e8 cb f9 ff ff       	call   39f <panic>
+     9d4:	83 c4 10             	add    $0x10,%esp
+  gettoken(ps, es, 0, 0);
+     9d7:	6a 00                	push   $0x0
+     9d9:	6a 00                	push   $0x0
+     9db:	ff 75 0c             	push   0xc(%ebp)
+     9de:	ff 75 08             	push   0x8(%ebp)
+     9e1:	e8 6a fb ff ff       	call   550 <gettoken>
+     9e6:	83 c4 10             	add    $0x10,%esp
+  cmd = parseline(ps, es);
+     9e9:	83 ec 08             	sub    $0x8,%esp
+     9ec:	ff 75 0c             	push   0xc(%ebp)
+     9ef:	ff 75 08             	push   0x8(%ebp)
+     9f2:	e8 ad fd ff ff       	call   7a4 <parseline>
+     9f7:	83 c4 10             	add    $0x10,%esp
+     9fa:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(!peek(ps, es, ")"))
+     9fd:	83 ec 04             	sub    $0x4,%esp
+     a00:	68 7c 17 00 00       	push   $0x177c
+     a05:	ff 75 0c             	push   0xc(%ebp)
+     a08:	ff 75 08             	push   0x8(%ebp)
+     a0b:	e8 90 fc ff ff       	call   6a0 <peek>
+     a10:	83 c4 10             	add    $0x10,%esp
+     a13:	85 c0                	test   %eax,%eax
+     a15:	75 10                	jne    a27 <parseblock+0x80>
+    panic("syntax - missing )");
+     a17:	83 ec 0c             	sub    $0xc,%esp
+     a1a:	68 7e 17 00 00       	push   $0x177e
+     a1f:	e8 7b f9 ff ff       	call   39f <panic>
+     a24:	83 c4 10             	add    $0x10,%esp
+  gettoken(ps, es, 0, 0);
+     a27:	6a 00                	push   $0x0
+     a29:	6a 00                	push   $0x0
+     a2b:	ff 75 0c             	push   0xc(%ebp)
+     a2e:	ff 75 08             	push   0x8(%ebp)
+     a31:	e8 1a fb ff ff       	call   550 <gettoken>
+     a36:	83 c4 10             	add    $0x10,%esp
+  cmd = parseredirs(cmd, ps, es);
+     a39:	83 ec 04             	sub    $0x4,%esp
+     a3c:	ff 75 0c             	push   0xc(%ebp)
+     a3f:	ff 75 08             	push   0x8(%ebp)
+     a42:	ff 75 f4             	push   -0xc(%ebp)
+     a45:	e8 75 fe ff ff       	call   8bf <parseredirs>
+     a4a:	83 c4 10             	add    $0x10,%esp
+     a4d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  return cmd;
+     a50:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     a53:	c9                   	leave
+     a54:	c3                   	ret
+
+00000a55 <parseexec>:
+
+struct cmd*
+parseexec(char **ps, char *es)
+{
+     a55:	55                   	push   %ebp
+     a56:	89 e5                	mov    %esp,%ebp
+     a58:	83 ec 28             	sub    $0x28,%esp
+  char *q, *eq;
+  int tok, argc;
+  struct execcmd *cmd;
+  struct cmd *ret;
+
+  if(peek(ps, es, "("))
+     a5b:	83 ec 04             	sub    $0x4,%esp
+     a5e:	68 6f 17 00 00       	push   $0x176f
+     a63:	ff 75 0c             	push   0xc(%ebp)
+     a66:	ff 75 08             	push   0x8(%ebp)
+     a69:	e8 32 fc ff ff       	call   6a0 <peek>
+     a6e:	83 c4 10             	add    $0x10,%esp
+     a71:	85 c0                	test   %eax,%eax
+     a73:	74 16                	je     a8b <parseexec+0x36>
+    return parseblock(ps, es);
+     a75:	83 ec 08             	sub    $0x8,%esp
+     a78:	ff 75 0c             	push   0xc(%ebp)
+     a7b:	ff 75 08             	push   0x8(%ebp)
+     a7e:	e8 24 ff ff ff       	call   9a7 <parseblock>
+     a83:	83 c4 10             	add    $0x10,%esp
+     a86:	e9 fb 00 00 00       	jmp    b86 <parseexec+0x131>
+
+  ret = execcmd();
+     a8b:	e8 58 f9 ff ff       	call   3e8 <execcmd>
+     a90:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  cmd = (struct execcmd*)ret;
+     a93:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     a96:	89 45 ec             	mov    %eax,-0x14(%ebp)
+
+  argc = 0;
+     a99:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  ret = parseredirs(ret, ps, es);
+     aa0:	83 ec 04             	sub    $0x4,%esp
+     aa3:	ff 75 0c             	push   0xc(%ebp)
+     aa6:	ff 75 08             	push   0x8(%ebp)
+     aa9:	ff 75 f0             	push   -0x10(%ebp)
+     aac:	e8 0e fe ff ff       	call   8bf <parseredirs>
+     ab1:	83 c4 10             	add    $0x10,%esp
+     ab4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     ab7:	e9 87 00 00 00       	jmp    b43 <parseexec+0xee>
+    if((tok=gettoken(ps, es, &q, &eq)) == 0)
+     abc:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     abf:	50                   	push   %eax
+     ac0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     ac3:	50                   	push   %eax
+     ac4:	ff 75 0c             	push   0xc(%ebp)
+     ac7:	ff 75 08             	push   0x8(%ebp)
+     aca:	e8 81 fa ff ff       	call   550 <gettoken>
+     acf:	83 c4 10             	add    $0x10,%esp
+     ad2:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     ad5:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     ad9:	0f 84 84 00 00 00    	je     b63 <parseexec+0x10e>
+      break;
+    if(tok != 'a')
+     adf:	83 7d e8 61          	cmpl   $0x61,-0x18(%ebp)
+     ae3:	74 10                	je     af5 <parseexec+0xa0>
+      panic("syntax");
+     ae5:	83 ec 0c             	sub    $0xc,%esp
+     ae8:	68 42 17 00 00       	push   $0x1742
+     aed:	e8 ad f8 ff ff       	call   39f <panic>
+     af2:	83 c4 10             	add    $0x10,%esp
+    cmd->argv[argc] = q;
+     af5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+     af8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     afb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     afe:	89 4c 90 04          	mov    %ecx,0x4(%eax,%edx,4)
+    cmd->eargv[argc] = eq;
+     b02:	8b 55 e0             	mov    -0x20(%ebp),%edx
+     b05:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     b08:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+     b0b:	83 c1 08             	add    $0x8,%ecx
+     b0e:	89 54 88 0c          	mov    %edx,0xc(%eax,%ecx,4)
+    argc++;
+     b12:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    if(argc >= MAXARGS)
+     b16:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+     b1a:	7e 10                	jle    b2c <parseexec+0xd7>
+      panic("too many args");
+     b1c:	83 ec 0c             	sub    $0xc,%esp
+     b1f:	68 91 17 00 00       	push   $0x1791
+     b24:	e8 76 f8 ff ff       	call   39f <panic>
+     b29:	83 c4 10             	add    $0x10,%esp
+    ret = parseredirs(ret, ps, es);
+     b2c:	83 ec 04             	sub    $0x4,%esp
+     b2f:	ff 75 0c             	push   0xc(%ebp)
+     b32:	ff 75 08             	push   0x8(%ebp)
+     b35:	ff 75 f0             	push   -0x10(%ebp)
+     b38:	e8 82 fd ff ff       	call   8bf <parseredirs>
+     b3d:	83 c4 10             	add    $0x10,%esp
+     b40:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     b43:	83 ec 04             	sub    $0x4,%esp
+     b46:	68 9f 17 00 00       	push   $0x179f
+     b4b:	ff 75 0c             	push   0xc(%ebp)
+     b4e:	ff 75 08             	push   0x8(%ebp)
+     b51:	e8 4a fb ff ff       	call   6a0 <peek>
+     b56:	83 c4 10             	add    $0x10,%esp
+     b59:	85 c0                	test   %eax,%eax
+     b5b:	0f 84 5b ff ff ff    	je     abc <parseexec+0x67>
+     b61:	eb 01                	jmp    b64 <parseexec+0x10f>
+      break;
+     b63:	90                   	nop
+  }
+  cmd->argv[argc] = 0;
+     b64:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     b67:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     b6a:	c7 44 90 04 00 00 00 	movl   $0x0,0x4(%eax,%edx,4)
+     b71:	00 
+  cmd->eargv[argc] = 0;
+     b72:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     b75:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     b78:	83 c2 08             	add    $0x8,%edx
+     b7b:	c7 44 90 0c 00 00 00 	movl   $0x0,0xc(%eax,%edx,4)
+     b82:	00 
+  return ret;
+     b83:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     b86:	c9                   	leave
+     b87:	c3                   	ret
+
+00000b88 <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd*
+nulterminate(struct cmd *cmd)
+{
+     b88:	55                   	push   %ebp
+     b89:	89 e5                	mov    %esp,%ebp
+     b8b:	83 ec 28             	sub    $0x28,%esp
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+     b8e:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     b92:	75 0a                	jne    b9e <nulterminate+0x16>
+    return 0;
+     b94:	b8 00 00 00 00       	mov    $0x0,%eax
+     b99:	e9 e4 00 00 00       	jmp    c82 <nulterminate+0xfa>
+
+  switch(cmd->type){
+     b9e:	8b 45 08             	mov    0x8(%ebp),%eax
+     ba1:	8b 00                	mov    (%eax),%eax
+     ba3:	83 f8 05             	cmp    $0x5,%eax
+     ba6:	0f 87 d3 00 00 00    	ja     c7f <nulterminate+0xf7>
+     bac:	8b 04 85 a4 17 00 00 	mov    0x17a4(,%eax,4),%eax
+     bb3:	ff e0                	jmp    *%eax
+  case EXEC:
+    ecmd = (struct execcmd*)cmd;
+     bb5:	8b 45 08             	mov    0x8(%ebp),%eax
+     bb8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    for(i=0; ecmd->argv[i]; i++)
+     bbb:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     bc2:	eb 14                	jmp    bd8 <nulterminate+0x50>
+      *ecmd->eargv[i] = 0;
+     bc4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     bc7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     bca:	83 c2 08             	add    $0x8,%edx
+     bcd:	8b 44 90 0c          	mov    0xc(%eax,%edx,4),%eax
+     bd1:	c6 00 00             	movb   $0x0,(%eax)
+    for(i=0; ecmd->argv[i]; i++)
+     bd4:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     bd8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     bdb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     bde:	8b 44 90 04          	mov    0x4(%eax,%edx,4),%eax
+     be2:	85 c0                	test   %eax,%eax
+     be4:	75 de                	jne    bc4 <nulterminate+0x3c>
+    break;
+     be6:	e9 94 00 00 00       	jmp    c7f <nulterminate+0xf7>
+
+  case REDIR:
+    rcmd = (struct redircmd*)cmd;
+     beb:	8b 45 08             	mov    0x8(%ebp),%eax
+     bee:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    nulterminate(rcmd->cmd);
+     bf1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     bf4:	8b 40 04             	mov    0x4(%eax),%eax
+     bf7:	83 ec 0c             	sub    $0xc,%esp
+     bfa:	50                   	push   %eax
+     bfb:	e8 88 ff ff ff       	call   b88 <nulterminate>
+     c00:	83 c4 10             	add    $0x10,%esp
+    *rcmd->efile = 0;
+     c03:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     c06:	8b 40 0c             	mov    0xc(%eax),%eax
+     c09:	c6 00 00             	movb   $0x0,(%eax)
+    break;
+     c0c:	eb 71                	jmp    c7f <nulterminate+0xf7>
+
+  case PIPE:
+    pcmd = (struct pipecmd*)cmd;
+     c0e:	8b 45 08             	mov    0x8(%ebp),%eax
+     c11:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    nulterminate(pcmd->left);
+     c14:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     c17:	8b 40 04             	mov    0x4(%eax),%eax
+     c1a:	83 ec 0c             	sub    $0xc,%esp
+     c1d:	50                   	push   %eax
+     c1e:	e8 65 ff ff ff       	call   b88 <nulterminate>
+     c23:	83 c4 10             	add    $0x10,%esp
+    nulterminate(pcmd->right);
+     c26:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     c29:	8b 40 08             	mov    0x8(%eax),%eax
+     c2c:	83 ec 0c             	sub    $0xc,%esp
+     c2f:	50                   	push   %eax
+     c30:	e8 53 ff ff ff       	call   b88 <nulterminate>
+     c35:	83 c4 10             	add    $0x10,%esp
+    break;
+     c38:	eb 45                	jmp    c7f <nulterminate+0xf7>
+
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+     c3a:	8b 45 08             	mov    0x8(%ebp),%eax
+     c3d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    nulterminate(lcmd->left);
+     c40:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     c43:	8b 40 04             	mov    0x4(%eax),%eax
+     c46:	83 ec 0c             	sub    $0xc,%esp
+     c49:	50                   	push   %eax
+     c4a:	e8 39 ff ff ff       	call   b88 <nulterminate>
+     c4f:	83 c4 10             	add    $0x10,%esp
+    nulterminate(lcmd->right);
+     c52:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     c55:	8b 40 08             	mov    0x8(%eax),%eax
+     c58:	83 ec 0c             	sub    $0xc,%esp
+     c5b:	50                   	push   %eax
+     c5c:	e8 27 ff ff ff       	call   b88 <nulterminate>
+     c61:	83 c4 10             	add    $0x10,%esp
+    break;
+     c64:	eb 19                	jmp    c7f <nulterminate+0xf7>
+
+  case BACK:
+    bcmd = (struct backcmd*)cmd;
+     c66:	8b 45 08             	mov    0x8(%ebp),%eax
+     c69:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    nulterminate(bcmd->cmd);
+     c6c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     c6f:	8b 40 04             	mov    0x4(%eax),%eax
+     c72:	83 ec 0c             	sub    $0xc,%esp
+     c75:	50                   	push   %eax
+     c76:	e8 0d ff ff ff       	call   b88 <nulterminate>
+     c7b:	83 c4 10             	add    $0x10,%esp
+    break;
+     c7e:	90                   	nop
+  }
+  return cmd;
+     c7f:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     c82:	c9                   	leave
+     c83:	c3                   	ret
+
+00000c84 <stosb>:
+}
+
+int
+stat(char *n, struct stat *st)
+{
+  int fd;
+     c84:	55                   	push   %ebp
+     c85:	89 e5                	mov    %esp,%ebp
+     c87:	57                   	push   %edi
+     c88:	53                   	push   %ebx
+  int r;
+     c89:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     c8c:	8b 55 10             	mov    0x10(%ebp),%edx
+     c8f:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c92:	89 cb                	mov    %ecx,%ebx
+     c94:	89 df                	mov    %ebx,%edi
+     c96:	89 d1                	mov    %edx,%ecx
+     c98:	fc                   	cld
+     c99:	f3 aa                	rep stos %al,%es:(%edi)
+     c9b:	89 ca                	mov    %ecx,%edx
+     c9d:	89 fb                	mov    %edi,%ebx
+     c9f:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     ca2:	89 55 10             	mov    %edx,0x10(%ebp)
+
+  fd = open(n, O_RDONLY);
+  if(fd < 0)
+    return -1;
+     ca5:	90                   	nop
+     ca6:	5b                   	pop    %ebx
+     ca7:	5f                   	pop    %edi
+     ca8:	5d                   	pop    %ebp
+     ca9:	c3                   	ret
+
+00000caa <strcpy>:
+{
+     caa:	55                   	push   %ebp
+     cab:	89 e5                	mov    %esp,%ebp
+     cad:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+     cb0:	8b 45 08             	mov    0x8(%ebp),%eax
+     cb3:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     cb6:	90                   	nop
+     cb7:	8b 55 0c             	mov    0xc(%ebp),%edx
+     cba:	8d 42 01             	lea    0x1(%edx),%eax
+     cbd:	89 45 0c             	mov    %eax,0xc(%ebp)
+     cc0:	8b 45 08             	mov    0x8(%ebp),%eax
+     cc3:	8d 48 01             	lea    0x1(%eax),%ecx
+     cc6:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     cc9:	0f b6 12             	movzbl (%edx),%edx
+     ccc:	88 10                	mov    %dl,(%eax)
+     cce:	0f b6 00             	movzbl (%eax),%eax
+     cd1:	84 c0                	test   %al,%al
+     cd3:	75 e2                	jne    cb7 <strcpy+0xd>
+  return os;
+     cd5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     cd8:	c9                   	leave
+     cd9:	c3                   	ret
+
+00000cda <strlen>:
+{
+     cda:	55                   	push   %ebp
+     cdb:	89 e5                	mov    %esp,%ebp
+     cdd:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+     ce0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     ce7:	eb 04                	jmp    ced <strlen+0x13>
+     ce9:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     ced:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     cf0:	8b 45 08             	mov    0x8(%ebp),%eax
+     cf3:	01 d0                	add    %edx,%eax
+     cf5:	0f b6 00             	movzbl (%eax),%eax
+     cf8:	84 c0                	test   %al,%al
+     cfa:	75 ed                	jne    ce9 <strlen+0xf>
+  return n;
+     cfc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     cff:	c9                   	leave
+     d00:	c3                   	ret
+
+00000d01 <memset>:
+{
+     d01:	55                   	push   %ebp
+     d02:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+     d04:	8b 45 10             	mov    0x10(%ebp),%eax
+     d07:	50                   	push   %eax
+     d08:	ff 75 0c             	push   0xc(%ebp)
+     d0b:	ff 75 08             	push   0x8(%ebp)
+     d0e:	e8 71 ff ff ff       	call   c84 <stosb>
+     d13:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     d16:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     d19:	c9                   	leave
+     d1a:	c3                   	ret
+
+00000d1b <strchr>:
+{
+     d1b:	55                   	push   %ebp
+     d1c:	89 e5                	mov    %esp,%ebp
+     d1e:	83 ec 04             	sub    $0x4,%esp
+     d21:	8b 45 0c             	mov    0xc(%ebp),%eax
+     d24:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+     d27:	eb 14                	jmp    d3d <strchr+0x22>
+    if(*s == c)
+     d29:	8b 45 08             	mov    0x8(%ebp),%eax
+     d2c:	0f b6 00             	movzbl (%eax),%eax
+     d2f:	38 45 fc             	cmp    %al,-0x4(%ebp)
+     d32:	75 05                	jne    d39 <strchr+0x1e>
+      return (char*)s;
+     d34:	8b 45 08             	mov    0x8(%ebp),%eax
+     d37:	eb 13                	jmp    d4c <strchr+0x31>
+  for(; *s; s++)
+     d39:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     d3d:	8b 45 08             	mov    0x8(%ebp),%eax
+     d40:	0f b6 00             	movzbl (%eax),%eax
+     d43:	84 c0                	test   %al,%al
+     d45:	75 e2                	jne    d29 <strchr+0xe>
+  return 0;
+     d47:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     d4c:	c9                   	leave
+     d4d:	c3                   	ret
+
+00000d4e <gets>:
+{
+     d4e:	55                   	push   %ebp
+     d4f:	89 e5                	mov    %esp,%ebp
+     d51:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+     d54:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     d5b:	eb 42                	jmp    d9f <gets+0x51>
+    cc = read(0, &c, 1);
+     d5d:	83 ec 04             	sub    $0x4,%esp
+     d60:	6a 01                	push   $0x1
+     d62:	8d 45 ef             	lea    -0x11(%ebp),%eax
+     d65:	50                   	push   %eax
+     d66:	6a 00                	push   $0x0
+     d68:	e8 dd 03 00 00       	call   114a <read>
+     d6d:	83 c4 10             	add    $0x10,%esp
+     d70:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+     d73:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     d77:	7e 33                	jle    dac <gets+0x5e>
+    buf[i++] = c;
+     d79:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d7c:	8d 50 01             	lea    0x1(%eax),%edx
+     d7f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     d82:	89 c2                	mov    %eax,%edx
+     d84:	8b 45 08             	mov    0x8(%ebp),%eax
+     d87:	01 c2                	add    %eax,%edx
+     d89:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     d8d:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+     d8f:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     d93:	3c 0a                	cmp    $0xa,%al
+     d95:	74 16                	je     dad <gets+0x5f>
+     d97:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     d9b:	3c 0d                	cmp    $0xd,%al
+     d9d:	74 0e                	je     dad <gets+0x5f>
+  for(i=0; i+1 < max; ){
+     d9f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     da2:	83 c0 01             	add    $0x1,%eax
+     da5:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     da8:	7f b3                	jg     d5d <gets+0xf>
+     daa:	eb 01                	jmp    dad <gets+0x5f>
+      break;
+     dac:	90                   	nop
+  buf[i] = '\0';
+     dad:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     db0:	8b 45 08             	mov    0x8(%ebp),%eax
+     db3:	01 d0                	add    %edx,%eax
+     db5:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     db8:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     dbb:	c9                   	leave
+     dbc:	c3                   	ret
+
+00000dbd <stat>:
+{
+     dbd:	55                   	push   %ebp
+     dbe:	89 e5                	mov    %esp,%ebp
+     dc0:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+     dc3:	83 ec 08             	sub    $0x8,%esp
+     dc6:	6a 00                	push   $0x0
+     dc8:	ff 75 08             	push   0x8(%ebp)
+     dcb:	e8 a2 03 00 00       	call   1172 <open>
+     dd0:	83 c4 10             	add    $0x10,%esp
+     dd3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     dd6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     dda:	79 07                	jns    de3 <stat+0x26>
+    return -1;
+     ddc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     de1:	eb 25                	jmp    e08 <stat+0x4b>
+  r = fstat(fd, st);
+     de3:	83 ec 08             	sub    $0x8,%esp
+     de6:	ff 75 0c             	push   0xc(%ebp)
+     de9:	ff 75 f4             	push   -0xc(%ebp)
+     dec:	e8 99 03 00 00       	call   118a <fstat>
+     df1:	83 c4 10             	add    $0x10,%esp
+     df4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     df7:	83 ec 0c             	sub    $0xc,%esp
+     dfa:	ff 75 f4             	push   -0xc(%ebp)
+     dfd:	e8 58 03 00 00       	call   115a <close>
+     e02:	83 c4 10             	add    $0x10,%esp
+  return r;
+     e05:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     e08:	c9                   	leave
+     e09:	c3                   	ret
+
+00000e0a <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     e0a:	55                   	push   %ebp
+     e0b:	89 e5                	mov    %esp,%ebp
+     e0d:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+
+  dst = vdst;
+     e10:	8b 45 08             	mov    0x8(%ebp),%eax
+     e13:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+     e16:	8b 45 0c             	mov    0xc(%ebp),%eax
+     e19:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+     e1c:	eb 17                	jmp    e35 <memmove+0x2b>
+    *dst++ = *src++;
+     e1e:	8b 55 f8             	mov    -0x8(%ebp),%edx
+     e21:	8d 42 01             	lea    0x1(%edx),%eax
+     e24:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     e27:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e2a:	8d 48 01             	lea    0x1(%eax),%ecx
+     e2d:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+     e30:	0f b6 12             	movzbl (%edx),%edx
+     e33:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+     e35:	8b 45 10             	mov    0x10(%ebp),%eax
+     e38:	8d 50 ff             	lea    -0x1(%eax),%edx
+     e3b:	89 55 10             	mov    %edx,0x10(%ebp)
+     e3e:	85 c0                	test   %eax,%eax
+     e40:	7f dc                	jg     e1e <memmove+0x14>
+  return vdst;
+     e42:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     e45:	c9                   	leave
+     e46:	c3                   	ret
+
+00000e47 <cpuinfo>:
+     e47:	55                   	push   %ebp
+     e48:	89 e5                	mov    %esp,%ebp
+     e4a:	56                   	push   %esi
+     e4b:	53                   	push   %ebx
+     e4c:	8b 45 08             	mov    0x8(%ebp),%eax
+     e4f:	ba 00 00 00 00       	mov    $0x0,%edx
+     e54:	89 d1                	mov    %edx,%ecx
+     e56:	0f a2                	cpuid
+     e58:	89 c6                	mov    %eax,%esi
+     e5a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     e5d:	89 30                	mov    %esi,(%eax)
+     e5f:	8b 45 10             	mov    0x10(%ebp),%eax
+     e62:	89 18                	mov    %ebx,(%eax)
+     e64:	8b 45 14             	mov    0x14(%ebp),%eax
+     e67:	89 08                	mov    %ecx,(%eax)
+     e69:	8b 45 18             	mov    0x18(%ebp),%eax
+     e6c:	89 10                	mov    %edx,(%eax)
+     e6e:	90                   	nop
+     e6f:	5b                   	pop    %ebx
+     e70:	5e                   	pop    %esi
+     e71:	5d                   	pop    %ebp
+     e72:	c3                   	ret
+
+00000e73 <atoi>:
+{
+     e73:	55                   	push   %ebp
+     e74:	89 e5                	mov    %esp,%ebp
+     e76:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+     e79:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     e80:	eb 25                	jmp    ea7 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     e82:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     e85:	89 d0                	mov    %edx,%eax
+     e87:	c1 e0 02             	shl    $0x2,%eax
+     e8a:	01 d0                	add    %edx,%eax
+     e8c:	01 c0                	add    %eax,%eax
+     e8e:	89 c1                	mov    %eax,%ecx
+     e90:	8b 45 08             	mov    0x8(%ebp),%eax
+     e93:	8d 50 01             	lea    0x1(%eax),%edx
+     e96:	89 55 08             	mov    %edx,0x8(%ebp)
+     e99:	0f b6 00             	movzbl (%eax),%eax
+     e9c:	0f be c0             	movsbl %al,%eax
+     e9f:	01 c8                	add    %ecx,%eax
+     ea1:	83 e8 30             	sub    $0x30,%eax
+     ea4:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     ea7:	8b 45 08             	mov    0x8(%ebp),%eax
+     eaa:	0f b6 00             	movzbl (%eax),%eax
+     ead:	3c 2f                	cmp    $0x2f,%al
+     eaf:	7e 0a                	jle    ebb <atoi+0x48>
+     eb1:	8b 45 08             	mov    0x8(%ebp),%eax
+     eb4:	0f b6 00             	movzbl (%eax),%eax
+     eb7:	3c 39                	cmp    $0x39,%al
+     eb9:	7e c7                	jle    e82 <atoi+0xf>
+  return n;
+     ebb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     ebe:	c9                   	leave
+     ebf:	c3                   	ret
+
+00000ec0 <strcmp>:
+{
+     ec0:	55                   	push   %ebp
+     ec1:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+     ec3:	eb 08                	jmp    ecd <strcmp+0xd>
+    p++, q++;
+     ec5:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     ec9:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     ecd:	8b 45 08             	mov    0x8(%ebp),%eax
+     ed0:	0f b6 00             	movzbl (%eax),%eax
+     ed3:	84 c0                	test   %al,%al
+     ed5:	74 10                	je     ee7 <strcmp+0x27>
+     ed7:	8b 45 08             	mov    0x8(%ebp),%eax
+     eda:	0f b6 10             	movzbl (%eax),%edx
+     edd:	8b 45 0c             	mov    0xc(%ebp),%eax
+     ee0:	0f b6 00             	movzbl (%eax),%eax
+     ee3:	38 c2                	cmp    %al,%dl
+     ee5:	74 de                	je     ec5 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+     ee7:	8b 45 08             	mov    0x8(%ebp),%eax
+     eea:	0f b6 00             	movzbl (%eax),%eax
+     eed:	0f b6 d0             	movzbl %al,%edx
+     ef0:	8b 45 0c             	mov    0xc(%ebp),%eax
+     ef3:	0f b6 00             	movzbl (%eax),%eax
+     ef6:	0f b6 c0             	movzbl %al,%eax
+     ef9:	29 c2                	sub    %eax,%edx
+     efb:	89 d0                	mov    %edx,%eax
+}
+     efd:	5d                   	pop    %ebp
+     efe:	c3                   	ret
+
+00000eff <udiv64>:
+{
+     eff:	55                   	push   %ebp
+     f00:	89 e5                	mov    %esp,%ebp
+     f02:	57                   	push   %edi
+     f03:	56                   	push   %esi
+     f04:	83 ec 38             	sub    $0x38,%esp
+     f07:	8b 45 08             	mov    0x8(%ebp),%eax
+     f0a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     f0d:	8b 45 0c             	mov    0xc(%ebp),%eax
+     f10:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     f13:	8b 45 10             	mov    0x10(%ebp),%eax
+     f16:	89 45 c8             	mov    %eax,-0x38(%ebp)
+     f19:	8b 45 14             	mov    0x14(%ebp),%eax
+     f1c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  q = r = 0;
+     f1f:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+     f26:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+     f2d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     f30:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     f33:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     f36:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+     f39:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+     f40:	e9 85 00 00 00       	jmp    fca <udiv64+0xcb>
+    r = (r << 1) | ((n >> i) & 1);
+     f45:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     f48:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     f4b:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+     f4f:	01 c0                	add    %eax,%eax
+     f51:	89 c6                	mov    %eax,%esi
+     f53:	89 d7                	mov    %edx,%edi
+     f55:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+     f58:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     f5b:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     f5e:	0f ad d0             	shrd   %cl,%edx,%eax
+     f61:	d3 ea                	shr    %cl,%edx
+     f63:	f6 c1 20             	test   $0x20,%cl
+     f66:	74 04                	je     f6c <udiv64+0x6d>
+     f68:	89 d0                	mov    %edx,%eax
+     f6a:	31 d2                	xor    %edx,%edx
+     f6c:	83 e0 01             	and    $0x1,%eax
+     f6f:	89 45 c0             	mov    %eax,-0x40(%ebp)
+     f72:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+     f79:	89 f0                	mov    %esi,%eax
+     f7b:	89 fa                	mov    %edi,%edx
+     f7d:	0b 45 c0             	or     -0x40(%ebp),%eax
+     f80:	0b 55 c4             	or     -0x3c(%ebp),%edx
+     f83:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     f86:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+     f89:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     f8c:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     f8f:	3b 45 c8             	cmp    -0x38(%ebp),%eax
+     f92:	89 d0                	mov    %edx,%eax
+     f94:	1b 45 cc             	sbb    -0x34(%ebp),%eax
+     f97:	72 2d                	jb     fc6 <udiv64+0xc7>
+      r -= d;
+     f99:	8b 45 c8             	mov    -0x38(%ebp),%eax
+     f9c:	8b 55 cc             	mov    -0x34(%ebp),%edx
+     f9f:	29 45 e8             	sub    %eax,-0x18(%ebp)
+     fa2:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64_t)1 << i;
+     fa5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+     fa8:	b8 01 00 00 00       	mov    $0x1,%eax
+     fad:	ba 00 00 00 00       	mov    $0x0,%edx
+     fb2:	0f a5 c2             	shld   %cl,%eax,%edx
+     fb5:	d3 e0                	shl    %cl,%eax
+     fb7:	f6 c1 20             	test   $0x20,%cl
+     fba:	74 04                	je     fc0 <udiv64+0xc1>
+     fbc:	89 c2                	mov    %eax,%edx
+     fbe:	31 c0                	xor    %eax,%eax
+     fc0:	09 45 f0             	or     %eax,-0x10(%ebp)
+     fc3:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+     fc6:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+     fca:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+     fce:	0f 89 71 ff ff ff    	jns    f45 <udiv64+0x46>
+  if(rem)
+     fd4:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+     fd8:	74 0e                	je     fe8 <udiv64+0xe9>
+    *rem = r;
+     fda:	8b 4d 18             	mov    0x18(%ebp),%ecx
+     fdd:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     fe0:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     fe3:	89 01                	mov    %eax,(%ecx)
+     fe5:	89 51 04             	mov    %edx,0x4(%ecx)
+  return q;
+     fe8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     feb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+     fee:	83 c4 38             	add    $0x38,%esp
+     ff1:	5e                   	pop    %esi
+     ff2:	5f                   	pop    %edi
+     ff3:	5d                   	pop    %ebp
+     ff4:	c3                   	ret
+
+00000ff5 <crc32cinit>:
+{
+     ff5:	55                   	push   %ebp
+     ff6:	89 e5                	mov    %esp,%ebp
+     ff8:	83 ec 20             	sub    $0x20,%esp
+  for(i = 0; i < 256; i++){
+     ffb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    1002:	eb 4c                	jmp    1050 <crc32cinit+0x5b>
+    r = i;
+    1004:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1007:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+    100a:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+    1011:	eb 26                	jmp    1039 <crc32cinit+0x44>
+      r = (r >> 1) ^ ((r & 1) ? CRC32C_POLY : 0);
+    1013:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1016:	d1 e8                	shr    %eax
+    1018:	89 c2                	mov    %eax,%edx
+    101a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    101d:	83 e0 01             	and    $0x1,%eax
+    1020:	85 c0                	test   %eax,%eax
+    1022:	74 07                	je     102b <crc32cinit+0x36>
+    1024:	b8 78 3b f6 82       	mov    $0x82f63b78,%eax
+    1029:	eb 05                	jmp    1030 <crc32cinit+0x3b>
+    102b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1030:	31 d0                	xor    %edx,%eax
+    1032:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+    1035:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+    1039:	83 7d f8 07          	cmpl   $0x7,-0x8(%ebp)
+    103d:	76 d4                	jbe    1013 <crc32cinit+0x1e>
+    crc32ctab[i] = r;
+    103f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1042:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1045:	89 14 85 80 1d 00 00 	mov    %edx,0x1d80(,%eax,4)
+  for(i = 0; i < 256; i++){
+    104c:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+    1050:	81 7d fc ff 00 00 00 	cmpl   $0xff,-0x4(%ebp)
+    1057:	76 ab                	jbe    1004 <crc32cinit+0xf>
+  cpuinfo(1, &a, &b, &c, &d);
+    1059:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    105c:	50                   	push   %eax
+    105d:	8d 45 e8             	lea    -0x18(%ebp),%eax
+    1060:	50                   	push   %eax
+    1061:	8d 45 ec             	lea    -0x14(%ebp),%eax
+    1064:	50                   	push   %eax
+    1065:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    1068:	50                   	push   %eax
+    1069:	6a 01                	push   $0x1
+    106b:	e8 d7 fd ff ff       	call   e47 <cpuinfo>
+    1070:	83 c4 14             	add    $0x14,%esp
+  crc32chw = (c & CPUID_SSE42) != 0;
+    1073:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1076:	25 00 00 10 00       	and    $0x100000,%eax
+    107b:	85 c0                	test   %eax,%eax
+    107d:	0f 95 c0             	setne  %al
+    1080:	0f b6 c0             	movzbl %al,%eax
+    1083:	a3 e4 1c 00 00       	mov    %eax,0x1ce4
+}
+    1088:	90                   	nop
+    1089:	c9                   	leave
+    108a:	c3                   	ret
+
+0000108b <crc32c>:
+{
+    108b:	55                   	push   %ebp
+    108c:	89 e5                	mov    %esp,%ebp
+    108e:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s = p;
+    1091:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1094:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(crc32chw < 0)
+    1097:	a1 e4 1c 00 00       	mov    0x1ce4,%eax
+    109c:	85 c0                	test   %eax,%eax
+    109e:	79 05                	jns    10a5 <crc32c+0x1a>
+    crc32cinit();
+    10a0:	e8 50 ff ff ff       	call   ff5 <crc32cinit>
+  crc = ~crc;
+    10a5:	f7 55 08             	notl   0x8(%ebp)
+  if(crc32chw){
+    10a8:	a1 e4 1c 00 00       	mov    0x1ce4,%eax
+    10ad:	85 c0                	test   %eax,%eax
+    10af:	74 6c                	je     111d <crc32c+0x92>
+    for(; n >= 4; n -= 4, s += 4)
+    10b1:	eb 18                	jmp    10cb <crc32c+0x40>
+      asm("crc32l %1, %0" : "+r" (crc) : "rm" (*(const uint*)s));
+    10b3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    10b6:	8b 10                	mov    (%eax),%edx
+    10b8:	8b 45 08             	mov    0x8(%ebp),%eax
+    10bb:	f2 0f 38 f1 c2       	crc32  %edx,%eax
+    10c0:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n >= 4; n -= 4, s += 4)
+    10c3:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+    10c7:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+    10cb:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+    10cf:	77 e2                	ja     10b3 <crc32c+0x28>
+    for(; n > 0; n--, s++)
+    10d1:	eb 19                	jmp    10ec <crc32c+0x61>
+      asm("crc32b %1, %0" : "+r" (crc) : "qm" (*s));
+    10d3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    10d6:	0f b6 10             	movzbl (%eax),%edx
+    10d9:	8b 45 08             	mov    0x8(%ebp),%eax
+    10dc:	f2 0f 38 f0 c2       	crc32  %dl,%eax
+    10e1:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+    10e4:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+    10e8:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+    10ec:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+    10f0:	75 e1                	jne    10d3 <crc32c+0x48>
+    10f2:	eb 2f                	jmp    1123 <crc32c+0x98>
+      crc = crc32ctab[(crc ^ *s) & 0xff] ^ (crc >> 8);
+    10f4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    10f7:	0f b6 00             	movzbl (%eax),%eax
+    10fa:	0f b6 c0             	movzbl %al,%eax
+    10fd:	33 45 08             	xor    0x8(%ebp),%eax
+    1100:	0f b6 c0             	movzbl %al,%eax
+    1103:	8b 04 85 80 1d 00 00 	mov    0x1d80(,%eax,4),%eax
+    110a:	8b 55 08             	mov    0x8(%ebp),%edx
+    110d:	c1 ea 08             	shr    $0x8,%edx
+    1110:	31 d0                	xor    %edx,%eax
+    1112:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+    1115:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+    1119:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+    111d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+    1121:	75 d1                	jne    10f4 <crc32c+0x69>
+  return ~crc;
+    1123:	8b 45 08             	mov    0x8(%ebp),%eax
+    1126:	f7 d0                	not    %eax
+}
+    1128:	c9                   	leave
+    1129:	c3                   	ret
+
+0000112a <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    112a:	b8 01 00 00 00       	mov    $0x1,%eax
+    112f:	cd 40                	int    $0x40
+    1131:	c3                   	ret
+
+00001132 <exit>:
+SYSCALL(exit)
+    1132:	b8 02 00 00 00       	mov    $0x2,%eax
+    1137:	cd 40                	int    $0x40
+    1139:	c3                   	ret
+
+0000113a <wait>:
+SYSCALL(wait)
+    113a:	b8 03 00 00 00       	mov    $0x3,%eax
+    113f:	cd 40                	int    $0x40
+    1141:	c3                   	ret
+
+00001142 <pipe>:
+SYSCALL(pipe)
+    1142:	b8 04 00 00 00       	mov    $0x4,%eax
+    1147:	cd 40                	int    $0x40
+    1149:	c3                   	ret
+
+0000114a <read>:
+SYSCALL(read)
+    114a:	b8 05 00 00 00       	mov    $0x5,%eax
+    114f:	cd 40                	int    $0x40
+    1151:	c3                   	ret
+
+00001152 <write>:
+SYSCALL(write)
+    1152:	b8 10 00 00 00       	mov    $0x10,%eax
+    1157:	cd 40                	int    $0x40
+    1159:	c3                   	ret
+
+0000115a <close>:
+SYSCALL(close)
+    115a:	b8 15 00 00 00       	mov    $0x15,%eax
+    115f:	cd 40                	int    $0x40
+    1161:	c3                   	ret
+
+00001162 <kill>:
+SYSCALL(kill)
+    1162:	b8 06 00 00 00       	mov    $0x6,%eax
+    1167:	cd 40                	int    $0x40
+    1169:	c3                   	ret
+
+0000116a <exec>:
+SYSCALL(exec)
+    116a:	b8 07 00 00 00       	mov    $0x7,%eax
+    116f:	cd 40                	int    $0x40
+    1171:	c3                   	ret
+
+00001172 <open>:
+SYSCALL(open)
+    1172:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1177:	cd 40                	int    $0x40
+    1179:	c3                   	ret
+
+0000117a <mknod>:
+SYSCALL(mknod)
+    117a:	b8 11 00 00 00       	mov    $0x11,%eax
+    117f:	cd 40                	int    $0x40
+    1181:	c3                   	ret
+
+00001182 <unlink>:
+SYSCALL(unlink)
+    1182:	b8 12 00 00 00       	mov    $0x12,%eax
+    1187:	cd 40                	int    $0x40
+    1189:	c3                   	ret
+
+0000118a <fstat>:
+SYSCALL(fstat)
+    118a:	b8 08 00 00 00       	mov    $0x8,%eax
+    118f:	cd 40                	int    $0x40
+    1191:	c3                   	ret
+
+00001192 <link>:
+SYSCALL(link)
+    1192:	b8 13 00 00 00       	mov    $0x13,%eax
+    1197:	cd 40                	int    $0x40
+    1199:	c3                   	ret
+
+0000119a <mkdir>:
+SYSCALL(mkdir)
+    119a:	b8 14 00 00 00       	mov    $0x14,%eax
+    119f:	cd 40                	int    $0x40
+    11a1:	c3                   	ret
+
+000011a2 <chdir>:
+SYSCALL(chdir)
+    11a2:	b8 09 00 00 00       	mov    $0x9,%eax
+    11a7:	cd 40                	int    $0x40
+    11a9:	c3                   	ret
+
+000011aa <dup>:
+SYSCALL(dup)
+    11aa:	b8 0a 00 00 00       	mov    $0xa,%eax
+    11af:	cd 40                	int    $0x40
+    11b1:	c3                   	ret
+
+000011b2 <getpid>:
+SYSCALL(getpid)
+    11b2:	b8 0b 00 00 00       	mov    $0xb,%eax
+    11b7:	cd 40                	int    $0x40
+    11b9:	c3                   	ret
+
+000011ba <sbrk>:
+SYSCALL(sbrk)
+    11ba:	b8 0c 00 00 00       	mov    $0xc,%eax
+    11bf:	cd 40                	int    $0x40
+    11c1:	c3                   	ret
+
+000011c2 <sleep>:
+SYSCALL(sleep)
+    11c2:	b8 0d 00 00 00       	mov    $0xd,%eax
+    11c7:	cd 40                	int    $0x40
+    11c9:	c3                   	ret
+
+000011ca <uptime>:
+SYSCALL(uptime)
+    11ca:	b8 0e 00 00 00       	mov    $0xe,%eax
+    11cf:	cd 40                	int    $0x40
+    11d1:	c3                   	ret
+
+000011d2 <arp>:
+SYSCALL(arp)
+    11d2:	b8 16 00 00 00       	mov    $0x16,%eax
+    11d7:	cd 40                	int    $0x40
+    11d9:	c3                   	ret
+
+000011da <ifstat>:
+SYSCALL(ifstat)
+    11da:	b8 17 00 00 00       	mov    $0x17,%eax
+    11df:	cd 40                	int    $0x40
+    11e1:	c3                   	ret
+
+000011e2 <pcapctl>:
+SYSCALL(pcapctl)
+    11e2:	b8 18 00 00 00       	mov    $0x18,%eax
+    11e7:	cd 40                	int    $0x40
+    11e9:	c3                   	ret
+
+000011ea <pcapread>:
+SYSCALL(pcapread)
+    11ea:	b8 19 00 00 00       	mov    $0x19,%eax
+    11ef:	cd 40                	int    $0x40
+    11f1:	c3                   	ret
+
+000011f2 <bpfattach>:
+SYSCALL(bpfattach)
+    11f2:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    11f7:	cd 40                	int    $0x40
+    11f9:	c3                   	ret
+
+000011fa <pktgen>:
+SYSCALL(pktgen)
+    11fa:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    11ff:	cd 40                	int    $0x40
+    1201:	c3                   	ret
+
+00001202 <reflect>:
+SYSCALL(reflect)
+    1202:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1207:	cd 40                	int    $0x40
+    1209:	c3                   	ret
+
+0000120a <brctl>:
+SYSCALL(brctl)
+    120a:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    120f:	cd 40                	int    $0x40
+    1211:	c3                   	ret
+
+00001212 <hostopen>:
+SYSCALL(hostopen)
+    1212:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1217:	cd 40                	int    $0x40
+    1219:	c3                   	ret
+
+0000121a <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+    121a:	55                   	push   %ebp
+    121b:	89 e5                	mov    %esp,%ebp
+    121d:	83 ec 18             	sub    $0x18,%esp
+    1220:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1223:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+    1226:	83 ec 04             	sub    $0x4,%esp
+    1229:	6a 01                	push   $0x1
+    122b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    122e:	50                   	push   %eax
+    122f:	ff 75 08             	push   0x8(%ebp)
+    1232:	e8 1b ff ff ff       	call   1152 <write>
+    1237:	83 c4 10             	add    $0x10,%esp
+}
+    123a:	90                   	nop
+    123b:	c9                   	leave
+    123c:	c3                   	ret
+
+0000123d <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    123d:	55                   	push   %ebp
+    123e:	89 e5                	mov    %esp,%ebp
+    1240:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    1243:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+    124a:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+    124e:	74 17                	je     1267 <printint+0x2a>
+    1250:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+    1254:	79 11                	jns    1267 <printint+0x2a>
+    neg = 1;
+    1256:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+    125d:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1260:	f7 d8                	neg    %eax
+    1262:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1265:	eb 06                	jmp    126d <printint+0x30>
+  } else {
+    x = xx;
+    1267:	8b 45 0c             	mov    0xc(%ebp),%eax
+    126a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+    126d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+    1274:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    1277:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    127a:	ba 00 00 00 00       	mov    $0x0,%edx
+    127f:	f7 f1                	div    %ecx
+    1281:	89 d1                	mov    %edx,%ecx
+    1283:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1286:	8d 50 01             	lea    0x1(%eax),%edx
+    1289:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    128c:	0f b6 91 e8 1c 00 00 	movzbl 0x1ce8(%ecx),%edx
+    1293:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+    1297:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    129a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    129d:	ba 00 00 00 00       	mov    $0x0,%edx
+    12a2:	f7 f1                	div    %ecx
+    12a4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    12a7:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    12ab:	75 c7                	jne    1274 <printint+0x37>
+  if(neg)
+    12ad:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    12b1:	74 2d                	je     12e0 <printint+0xa3>
+    buf[i++] = '-';
+    12b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12b6:	8d 50 01             	lea    0x1(%eax),%edx
+    12b9:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    12bc:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+    12c1:	eb 1d                	jmp    12e0 <printint+0xa3>
+    putc(fd, buf[i]);
+    12c3:	8d 55 dc             	lea    -0x24(%ebp),%edx
+    12c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12c9:	01 d0                	add    %edx,%eax
+    12cb:	0f b6 00             	movzbl (%eax),%eax
+    12ce:	0f be c0             	movsbl %al,%eax
+    12d1:	83 ec 08             	sub    $0x8,%esp
+    12d4:	50                   	push   %eax
+    12d5:	ff 75 08             	push   0x8(%ebp)
+    12d8:	e8 3d ff ff ff       	call   121a <putc>
+    12dd:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+    12e0:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+    12e4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    12e8:	79 d9                	jns    12c3 <printint+0x86>
+}
+    12ea:	90                   	nop
+    12eb:	90                   	nop
+    12ec:	c9                   	leave
+    12ed:	c3                   	ret
+
+000012ee <printf>:
+
+// Print to the given fd. Only understands %d, %u, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    12ee:	55                   	push   %ebp
+    12ef:	89 e5                	mov    %esp,%ebp
+    12f1:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+    12f4:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+    12fb:	8d 45 0c             	lea    0xc(%ebp),%eax
+    12fe:	83 c0 04             	add    $0x4,%eax
+    1301:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+    1304:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    130b:	e9 7d 01 00 00       	jmp    148d <printf+0x19f>
+    c = fmt[i] & 0xff;
+    1310:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1313:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1316:	01 d0                	add    %edx,%eax
+    1318:	0f b6 00             	movzbl (%eax),%eax
+    131b:	0f be c0             	movsbl %al,%eax
+    131e:	25 ff 00 00 00       	and    $0xff,%eax
+    1323:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+    1326:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    132a:	75 2c                	jne    1358 <printf+0x6a>
+      if(c == '%'){
+    132c:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    1330:	75 0c                	jne    133e <printf+0x50>
+        state = '%';
+    1332:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+    1339:	e9 4b 01 00 00       	jmp    1489 <printf+0x19b>
+      } else {
+        putc(fd, c);
+    133e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1341:	0f be c0             	movsbl %al,%eax
+    1344:	83 ec 08             	sub    $0x8,%esp
+    1347:	50                   	push   %eax
+    1348:	ff 75 08             	push   0x8(%ebp)
+    134b:	e8 ca fe ff ff       	call   121a <putc>
+    1350:	83 c4 10             	add    $0x10,%esp
+    1353:	e9 31 01 00 00       	jmp    1489 <printf+0x19b>
+      }
+    } else if(state == '%'){
+    1358:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+    135c:	0f 85 27 01 00 00    	jne    1489 <printf+0x19b>
+      if(c == 'd'){
+    1362:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+    1366:	75 1e                	jne    1386 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+    1368:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    136b:	8b 00                	mov    (%eax),%eax
+    136d:	6a 01                	push   $0x1
+    136f:	6a 0a                	push   $0xa
+    1371:	50                   	push   %eax
+    1372:	ff 75 08             	push   0x8(%ebp)
+    1375:	e8 c3 fe ff ff       	call   123d <printint>
+    137a:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    137d:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    1381:	e9 fc 00 00 00       	jmp    1482 <printf+0x194>
+      } else if(c == 'u'){
+    1386:	83 7d e4 75          	cmpl   $0x75,-0x1c(%ebp)
+    138a:	75 1e                	jne    13aa <printf+0xbc>
+        printint(fd, *ap, 10, 0);
+    138c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    138f:	8b 00                	mov    (%eax),%eax
+    1391:	6a 00                	push   $0x0
+    1393:	6a 0a                	push   $0xa
+    1395:	50                   	push   %eax
+    1396:	ff 75 08             	push   0x8(%ebp)
+    1399:	e8 9f fe ff ff       	call   123d <printint>
+    139e:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    13a1:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    13a5:	e9 d8 00 00 00       	jmp    1482 <printf+0x194>
+      } else if(c == 'x' || c == 'p'){
+    13aa:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+    13ae:	74 06                	je     13b6 <printf+0xc8>
+    13b0:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+    13b4:	75 1e                	jne    13d4 <printf+0xe6>
+        printint(fd, *ap, 16, 0);
+    13b6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    13b9:	8b 00                	mov    (%eax),%eax
+    13bb:	6a 00                	push   $0x0
+    13bd:	6a 10                	push   $0x10
+    13bf:	50                   	push   %eax
+    13c0:	ff 75 08             	push   0x8(%ebp)
+    13c3:	e8 75 fe ff ff       	call   123d <printint>
+    13c8:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    13cb:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    13cf:	e9 ae 00 00 00       	jmp    1482 <printf+0x194>
+      } else if(c == 's'){
+    13d4:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+    13d8:	75 43                	jne    141d <printf+0x12f>
+        s = (char*)*ap;
+    13da:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    13dd:	8b 00                	mov    (%eax),%eax
+    13df:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+    13e2:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+    13e6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    13ea:	75 25                	jne    1411 <printf+0x123>
+          s = "(null)";
+    13ec:	c7 45 f4 bc 17 00 00 	movl   $0x17bc,-0xc(%ebp)
+        while(*s != 0){
+    13f3:	eb 1c                	jmp    1411 <printf+0x123>
+          putc(fd, *s);
+    13f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13f8:	0f b6 00             	movzbl (%eax),%eax
+    13fb:	0f be c0             	movsbl %al,%eax
+    13fe:	83 ec 08             	sub    $0x8,%esp
+    1401:	50                   	push   %eax
+    1402:	ff 75 08             	push   0x8(%ebp)
+    1405:	e8 10 fe ff ff       	call   121a <putc>
+    140a:	83 c4 10             	add    $0x10,%esp
+          s++;
+    140d:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+    1411:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1414:	0f b6 00             	movzbl (%eax),%eax
+    1417:	84 c0                	test   %al,%al
+    1419:	75 da                	jne    13f5 <printf+0x107>
+    141b:	eb 65                	jmp    1482 <printf+0x194>
+        }
+      } else if(c == 'c'){
+    141d:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+    1421:	75 1d                	jne    1440 <printf+0x152>
+        putc(fd, *ap);
+    1423:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1426:	8b 00                	mov    (%eax),%eax
+    1428:	0f be c0             	movsbl %al,%eax
+    142b:	83 ec 08             	sub    $0x8,%esp
+    142e:	50                   	push   %eax
+    142f:	ff 75 08             	push   0x8(%ebp)
+    1432:	e8 e3 fd ff ff       	call   121a <putc>
+    1437:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    143a:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    143e:	eb 42                	jmp    1482 <printf+0x194>
+      } else if(c == '%'){
+    1440:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    1444:	75 17                	jne    145d <printf+0x16f>
+        putc(fd, c);
+    1446:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1449:	0f be c0             	movsbl %al,%eax
+    144c:	83 ec 08             	sub    $0x8,%esp
+    144f:	50                   	push   %eax
+    1450:	ff 75 08             	push   0x8(%ebp)
+    1453:	e8 c2 fd ff ff       	call   121a <putc>
+    1458:	83 c4 10             	add    $0x10,%esp
+    145b:	eb 25                	jmp    1482 <printf+0x194>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    145d:	83 ec 08             	sub    $0x8,%esp
+    1460:	6a 25                	push   $0x25
+    1462:	ff 75 08             	push   0x8(%ebp)
+    1465:	e8 b0 fd ff ff       	call   121a <putc>
+    146a:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+    146d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1470:	0f be c0             	movsbl %al,%eax
+    1473:	83 ec 08             	sub    $0x8,%esp
+    1476:	50                   	push   %eax
+    1477:	ff 75 08             	push   0x8(%ebp)
+    147a:	e8 9b fd ff ff       	call   121a <putc>
+    147f:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+    1482:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+    1489:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    148d:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1490:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1493:	01 d0                	add    %edx,%eax
+    1495:	0f b6 00             	movzbl (%eax),%eax
+    1498:	84 c0                	test   %al,%al
+    149a:	0f 85 70 fe ff ff    	jne    1310 <printf+0x22>
+    }
+  }
+}
+    14a0:	90                   	nop
+    14a1:	90                   	nop
+    14a2:	c9                   	leave
+    14a3:	c3                   	ret
+
+000014a4 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    14a4:	55                   	push   %ebp
+    14a5:	89 e5                	mov    %esp,%ebp
+    14a7:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    14aa:	8b 45 08             	mov    0x8(%ebp),%eax
+    14ad:	83 e8 08             	sub    $0x8,%eax
+    14b0:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    14b3:	a1 88 21 00 00       	mov    0x2188,%eax
+    14b8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    14bb:	eb 24                	jmp    14e1 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    14bd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    14c0:	8b 00                	mov    (%eax),%eax
+    14c2:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    14c5:	72 12                	jb     14d9 <free+0x35>
+    14c7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    14ca:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    14cd:	72 24                	jb     14f3 <free+0x4f>
+    14cf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    14d2:	8b 00                	mov    (%eax),%eax
+    14d4:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    14d7:	72 1a                	jb     14f3 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    14d9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    14dc:	8b 00                	mov    (%eax),%eax
+    14de:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    14e1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    14e4:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    14e7:	73 d4                	jae    14bd <free+0x19>
+    14e9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    14ec:	8b 00                	mov    (%eax),%eax
+    14ee:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    14f1:	73 ca                	jae    14bd <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    14f3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    14f6:	8b 40 04             	mov    0x4(%eax),%eax
+    14f9:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    1500:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    1503:	01 c2                	add    %eax,%edx
+    1505:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1508:	8b 00                	mov    (%eax),%eax
+    150a:	39 c2                	cmp    %eax,%edx
+    150c:	75 24                	jne    1532 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+    150e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    1511:	8b 50 04             	mov    0x4(%eax),%edx
+    1514:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1517:	8b 00                	mov    (%eax),%eax
+    1519:	8b 40 04             	mov    0x4(%eax),%eax
+    151c:	01 c2                	add    %eax,%edx
+    151e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    1521:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1524:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1527:	8b 00                	mov    (%eax),%eax
+    1529:	8b 10                	mov    (%eax),%edx
+    152b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    152e:	89 10                	mov    %edx,(%eax)
+    1530:	eb 0a                	jmp    153c <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+    1532:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1535:	8b 10                	mov    (%eax),%edx
+    1537:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    153a:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+    153c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    153f:	8b 40 04             	mov    0x4(%eax),%eax
+    1542:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    1549:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    154c:	01 d0                	add    %edx,%eax
+    154e:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    1551:	75 20                	jne    1573 <free+0xcf>
+    p->s.size += bp->s.size;
+    1553:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1556:	8b 50 04             	mov    0x4(%eax),%edx
+    1559:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    155c:	8b 40 04             	mov    0x4(%eax),%eax
+    155f:	01 c2                	add    %eax,%edx
+    1561:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1564:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+    1567:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    156a:	8b 10                	mov    (%eax),%edx
+    156c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    156f:	89 10                	mov    %edx,(%eax)
+    1571:	eb 08                	jmp    157b <free+0xd7>
+  } else
+    p->s.ptr = bp;
+    1573:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1576:	8b 55 f8             	mov    -0x8(%ebp),%edx
+    1579:	89 10                	mov    %edx,(%eax)
+  freep = p;
+    157b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    157e:	a3 88 21 00 00       	mov    %eax,0x2188
+}
+    1583:	90                   	nop
+    1584:	c9                   	leave
+    1585:	c3                   	ret
+
+00001586 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    1586:	55                   	push   %ebp
+    1587:	89 e5                	mov    %esp,%ebp
+    1589:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    158c:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+    1593:	77 07                	ja     159c <morecore+0x16>
+    nu = 4096;
+    1595:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+    159c:	8b 45 08             	mov    0x8(%ebp),%eax
+    159f:	c1 e0 03             	shl    $0x3,%eax
+    15a2:	83 ec 0c             	sub    $0xc,%esp
+    15a5:	50                   	push   %eax
+    15a6:	e8 0f fc ff ff       	call   11ba <sbrk>
+    15ab:	83 c4 10             	add    $0x10,%esp
+    15ae:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+    15b1:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+    15b5:	75 07                	jne    15be <morecore+0x38>
+    return 0;
+    15b7:	b8 00 00 00 00       	mov    $0x0,%eax
+    15bc:	eb 26                	jmp    15e4 <morecore+0x5e>
+  hp = (Header*)p;
+    15be:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15c1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+    15c4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    15c7:	8b 55 08             	mov    0x8(%ebp),%edx
+    15ca:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+    15cd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    15d0:	83 c0 08             	add    $0x8,%eax
+    15d3:	83 ec 0c             	sub    $0xc,%esp
+    15d6:	50                   	push   %eax
+    15d7:	e8 c8 fe ff ff       	call   14a4 <free>
+    15dc:	83 c4 10             	add    $0x10,%esp
+  return freep;
+    15df:	a1 88 21 00 00       	mov    0x2188,%eax
+}
+    15e4:	c9                   	leave
+    15e5:	c3                   	ret
+
+000015e6 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    15e6:	55                   	push   %ebp
+    15e7:	89 e5                	mov    %esp,%ebp
+    15e9:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    15ec:	8b 45 08             	mov    0x8(%ebp),%eax
+    15ef:	83 c0 07             	add    $0x7,%eax
+    15f2:	c1 e8 03             	shr    $0x3,%eax
+    15f5:	83 c0 01             	add    $0x1,%eax
+    15f8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+    15fb:	a1 88 21 00 00       	mov    0x2188,%eax
+    1600:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    1603:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1607:	75 23                	jne    162c <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+    1609:	c7 45 f0 80 21 00 00 	movl   $0x2180,-0x10(%ebp)
+    1610:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1613:	a3 88 21 00 00       	mov    %eax,0x2188
+    1618:	a1 88 21 00 00       	mov    0x2188,%eax
+    161d:	a3 80 21 00 00       	mov    %eax,0x2180
+    base.s.size = 0;
+    1622:	c7 05 84 21 00 00 00 	movl   $0x0,0x2184
+    1629:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    162c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    162f:	8b 00                	mov    (%eax),%eax
+    1631:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    1634:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1637:	8b 40 04             	mov    0x4(%eax),%eax
+    163a:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+    163d:	72 4d                	jb     168c <malloc+0xa6>
+      if(p->s.size == nunits)
+    163f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1642:	8b 40 04             	mov    0x4(%eax),%eax
+    1645:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    1648:	75 0c                	jne    1656 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+    164a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    164d:	8b 10                	mov    (%eax),%edx
+    164f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1652:	89 10                	mov    %edx,(%eax)
+    1654:	eb 26                	jmp    167c <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+    1656:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1659:	8b 40 04             	mov    0x4(%eax),%eax
+    165c:	2b 45 ec             	sub    -0x14(%ebp),%eax
+    165f:	89 c2                	mov    %eax,%edx
+    1661:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1664:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+    1667:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    166a:	8b 40 04             	mov    0x4(%eax),%eax
+    166d:	c1 e0 03             	shl    $0x3,%eax
+    1670:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+    1673:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1676:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    1679:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+    167c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    167f:	a3 88 21 00 00       	mov    %eax,0x2188
+      return (void*)(p + 1);
+    1684:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1687:	83 c0 08             	add    $0x8,%eax
+    168a:	eb 3b                	jmp    16c7 <malloc+0xe1>
+    }
+    if(p == freep)
+    168c:	a1 88 21 00 00       	mov    0x2188,%eax
+    1691:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    1694:	75 1e                	jne    16b4 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+    1696:	83 ec 0c             	sub    $0xc,%esp
+    1699:	ff 75 ec             	push   -0x14(%ebp)
+    169c:	e8 e5 fe ff ff       	call   1586 <morecore>
+    16a1:	83 c4 10             	add    $0x10,%esp
+    16a4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    16a7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    16ab:	75 07                	jne    16b4 <malloc+0xce>
+        return 0;
+    16ad:	b8 00 00 00 00       	mov    $0x0,%eax
+    16b2:	eb 13                	jmp    16c7 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    16b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    16b7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    16ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    16bd:	8b 00                	mov    (%eax),%eax
+    16bf:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    16c2:	e9 6d ff ff ff       	jmp    1634 <malloc+0x4e>
+  }
+}
+    16c7:	c9                   	leave
+    16c8:	c3                   	ret
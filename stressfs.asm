@@ -0,0 +1,1486 @@
+
+_stressfs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "fs.h"
+#include "fcntl.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	81 ec 24 02 00 00    	sub    $0x224,%esp
+  int fd, i;
+  char path[] = "stressfs0";
+  14:	c7 45 e6 73 74 72 65 	movl   $0x65727473,-0x1a(%ebp)
+  1b:	c7 45 ea 73 73 66 73 	movl   $0x73667373,-0x16(%ebp)
+  22:	66 c7 45 ee 30 00    	movw   $0x30,-0x12(%ebp)
+  char data[512];
+
+  printf(1, "stressfs starting\n");
+  28:	83 ec 08             	sub    $0x8,%esp
+  2b:	68 97 0b 00 00       	push   $0xb97
+  30:	6a 01                	push   $0x1
+  32:	e8 85 07 00 00       	call   7bc <printf>
+  37:	83 c4 10             	add    $0x10,%esp
+  memset(data, 'a', sizeof(data));
+  3a:	83 ec 04             	sub    $0x4,%esp
+  3d:	68 00 02 00 00       	push   $0x200
+  42:	6a 61                	push   $0x61
+  44:	8d 85 e6 fd ff ff    	lea    -0x21a(%ebp),%eax
+  4a:	50                   	push   %eax
+  4b:	e8 7f 01 00 00       	call   1cf <memset>
+  50:	83 c4 10             	add    $0x10,%esp
+
+  for(i = 0; i < 4; i++)
+  53:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  5a:	eb 0d                	jmp    69 <main+0x69>
+    if(fork() > 0)
+  5c:	e8 97 05 00 00       	call   5f8 <fork>
+  61:	85 c0                	test   %eax,%eax
+  63:	7f 0c                	jg     71 <main+0x71>
+  for(i = 0; i < 4; i++)
+  65:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  69:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+  6d:	7e ed                	jle    5c <main+0x5c>
+  6f:	eb 01                	jmp    72 <main+0x72>
+      break;
+  71:	90                   	nop
+
+  printf(1, "write %d\n", i);
+  72:	83 ec 04             	sub    $0x4,%esp
+  75:	ff 75 f4             	push   -0xc(%ebp)
+  78:	68 aa 0b 00 00       	push   $0xbaa
+  7d:	6a 01                	push   $0x1
+  7f:	e8 38 07 00 00       	call   7bc <printf>
+  84:	83 c4 10             	add    $0x10,%esp
+
+  path[8] += i;
+  87:	0f b6 45 ee          	movzbl -0x12(%ebp),%eax
+  8b:	89 c2                	mov    %eax,%edx
+  8d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  90:	01 d0                	add    %edx,%eax
+  92:	88 45 ee             	mov    %al,-0x12(%ebp)
+  fd = open(path, O_CREATE | O_RDWR);
+  95:	83 ec 08             	sub    $0x8,%esp
+  98:	68 02 02 00 00       	push   $0x202
+  9d:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+  a0:	50                   	push   %eax
+  a1:	e8 9a 05 00 00       	call   640 <open>
+  a6:	83 c4 10             	add    $0x10,%esp
+  a9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < 20; i++)
+  ac:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  b3:	eb 1e                	jmp    d3 <main+0xd3>
+//    printf(fd, "%d\n", i);
+    write(fd, data, sizeof(data));
+  b5:	83 ec 04             	sub    $0x4,%esp
+  b8:	68 00 02 00 00       	push   $0x200
+  bd:	8d 85 e6 fd ff ff    	lea    -0x21a(%ebp),%eax
+  c3:	50                   	push   %eax
+  c4:	ff 75 f0             	push   -0x10(%ebp)
+  c7:	e8 54 05 00 00       	call   620 <write>
+  cc:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 20; i++)
+  cf:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  d3:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+  d7:	7e dc                	jle    b5 <main+0xb5>
+  close(fd);
+  d9:	83 ec 0c             	sub    $0xc,%esp
+  dc:	ff 75 f0             	push   -0x10(%ebp)
+  df:	e8 44 05 00 00       	call   628 <close>
+  e4:	83 c4 10             	add    $0x10,%esp
+
+  printf(1, "read\n");
+  e7:	83 ec 08             	sub    $0x8,%esp
+  ea:	68 b4 0b 00 00       	push   $0xbb4
+  ef:	6a 01                	push   $0x1
+  f1:	e8 c6 06 00 00       	call   7bc <printf>
+  f6:	83 c4 10             	add    $0x10,%esp
+
+  fd = open(path, O_RDONLY);
+  f9:	83 ec 08             	sub    $0x8,%esp
+  fc:	6a 00                	push   $0x0
+  fe:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+ 101:	50                   	push   %eax
+ 102:	e8 39 05 00 00       	call   640 <open>
+ 107:	83 c4 10             	add    $0x10,%esp
+ 10a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for (i = 0; i < 20; i++)
+ 10d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 114:	eb 1e                	jmp    134 <main+0x134>
+    read(fd, data, sizeof(data));
+ 116:	83 ec 04             	sub    $0x4,%esp
+ 119:	68 00 02 00 00       	push   $0x200
+ 11e:	8d 85 e6 fd ff ff    	lea    -0x21a(%ebp),%eax
+ 124:	50                   	push   %eax
+ 125:	ff 75 f0             	push   -0x10(%ebp)
+ 128:	e8 eb 04 00 00       	call   618 <read>
+ 12d:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < 20; i++)
+ 130:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 134:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+ 138:	7e dc                	jle    116 <main+0x116>
+  close(fd);
+ 13a:	83 ec 0c             	sub    $0xc,%esp
+ 13d:	ff 75 f0             	push   -0x10(%ebp)
+ 140:	e8 e3 04 00 00       	call   628 <close>
+ 145:	83 c4 10             	add    $0x10,%esp
+
+  wait();
+ 148:	e8 bb 04 00 00       	call   608 <wait>
+
+  exit();
+ 14d:	e8 ae 04 00 00       	call   600 <exit>
+
+00000152 <stosb>:
+}
+
+int
+stat(char *n, struct stat *st)
+{
+  int fd;
+ 152:	55                   	push   %ebp
+ 153:	89 e5                	mov    %esp,%ebp
+ 155:	57                   	push   %edi
+ 156:	53                   	push   %ebx
+  int r;
+ 157:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 15a:	8b 55 10             	mov    0x10(%ebp),%edx
+ 15d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 160:	89 cb                	mov    %ecx,%ebx
+ 162:	89 df                	mov    %ebx,%edi
+ 164:	89 d1                	mov    %edx,%ecx
+ 166:	fc                   	cld
+ 167:	f3 aa                	rep stos %al,%es:(%edi)
+ 169:	89 ca                	mov    %ecx,%edx
+ 16b:	89 fb                	mov    %edi,%ebx
+ 16d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 170:	89 55 10             	mov    %edx,0x10(%ebp)
+
+  fd = open(n, O_RDONLY);
+  if(fd < 0)
+    return -1;
+ 173:	90                   	nop
+ 174:	5b                   	pop    %ebx
+ 175:	5f                   	pop    %edi
+ 176:	5d                   	pop    %ebp
+ 177:	c3                   	ret
+
+00000178 <strcpy>:
+{
+ 178:	55                   	push   %ebp
+ 179:	89 e5                	mov    %esp,%ebp
+ 17b:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 17e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 181:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 184:	90                   	nop
+ 185:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 188:	8d 42 01             	lea    0x1(%edx),%eax
+ 18b:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 18e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 191:	8d 48 01             	lea    0x1(%eax),%ecx
+ 194:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 197:	0f b6 12             	movzbl (%edx),%edx
+ 19a:	88 10                	mov    %dl,(%eax)
+ 19c:	0f b6 00             	movzbl (%eax),%eax
+ 19f:	84 c0                	test   %al,%al
+ 1a1:	75 e2                	jne    185 <strcpy+0xd>
+  return os;
+ 1a3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1a6:	c9                   	leave
+ 1a7:	c3                   	ret
+
+000001a8 <strlen>:
+{
+ 1a8:	55                   	push   %ebp
+ 1a9:	89 e5                	mov    %esp,%ebp
+ 1ab:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 1ae:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 1b5:	eb 04                	jmp    1bb <strlen+0x13>
+ 1b7:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 1bb:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1be:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c1:	01 d0                	add    %edx,%eax
+ 1c3:	0f b6 00             	movzbl (%eax),%eax
+ 1c6:	84 c0                	test   %al,%al
+ 1c8:	75 ed                	jne    1b7 <strlen+0xf>
+  return n;
+ 1ca:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1cd:	c9                   	leave
+ 1ce:	c3                   	ret
+
+000001cf <memset>:
+{
+ 1cf:	55                   	push   %ebp
+ 1d0:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 1d2:	8b 45 10             	mov    0x10(%ebp),%eax
+ 1d5:	50                   	push   %eax
+ 1d6:	ff 75 0c             	push   0xc(%ebp)
+ 1d9:	ff 75 08             	push   0x8(%ebp)
+ 1dc:	e8 71 ff ff ff       	call   152 <stosb>
+ 1e1:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 1e4:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1e7:	c9                   	leave
+ 1e8:	c3                   	ret
+
+000001e9 <strchr>:
+{
+ 1e9:	55                   	push   %ebp
+ 1ea:	89 e5                	mov    %esp,%ebp
+ 1ec:	83 ec 04             	sub    $0x4,%esp
+ 1ef:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1f2:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 1f5:	eb 14                	jmp    20b <strchr+0x22>
+    if(*s == c)
+ 1f7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1fa:	0f b6 00             	movzbl (%eax),%eax
+ 1fd:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 200:	75 05                	jne    207 <strchr+0x1e>
+      return (char*)s;
+ 202:	8b 45 08             	mov    0x8(%ebp),%eax
+ 205:	eb 13                	jmp    21a <strchr+0x31>
+  for(; *s; s++)
+ 207:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 20b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 20e:	0f b6 00             	movzbl (%eax),%eax
+ 211:	84 c0                	test   %al,%al
+ 213:	75 e2                	jne    1f7 <strchr+0xe>
+  return 0;
+ 215:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 21a:	c9                   	leave
+ 21b:	c3                   	ret
+
+0000021c <gets>:
+{
+ 21c:	55                   	push   %ebp
+ 21d:	89 e5                	mov    %esp,%ebp
+ 21f:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 222:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 229:	eb 42                	jmp    26d <gets+0x51>
+    cc = read(0, &c, 1);
+ 22b:	83 ec 04             	sub    $0x4,%esp
+ 22e:	6a 01                	push   $0x1
+ 230:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 233:	50                   	push   %eax
+ 234:	6a 00                	push   $0x0
+ 236:	e8 dd 03 00 00       	call   618 <read>
+ 23b:	83 c4 10             	add    $0x10,%esp
+ 23e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 241:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 245:	7e 33                	jle    27a <gets+0x5e>
+    buf[i++] = c;
+ 247:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 24a:	8d 50 01             	lea    0x1(%eax),%edx
+ 24d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 250:	89 c2                	mov    %eax,%edx
+ 252:	8b 45 08             	mov    0x8(%ebp),%eax
+ 255:	01 c2                	add    %eax,%edx
+ 257:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 25b:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 25d:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 261:	3c 0a                	cmp    $0xa,%al
+ 263:	74 16                	je     27b <gets+0x5f>
+ 265:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 269:	3c 0d                	cmp    $0xd,%al
+ 26b:	74 0e                	je     27b <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 26d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 270:	83 c0 01             	add    $0x1,%eax
+ 273:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 276:	7f b3                	jg     22b <gets+0xf>
+ 278:	eb 01                	jmp    27b <gets+0x5f>
+      break;
+ 27a:	90                   	nop
+  buf[i] = '\0';
+ 27b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 27e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 281:	01 d0                	add    %edx,%eax
+ 283:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 286:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 289:	c9                   	leave
+ 28a:	c3                   	ret
+
+0000028b <stat>:
+{
+ 28b:	55                   	push   %ebp
+ 28c:	89 e5                	mov    %esp,%ebp
+ 28e:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+ 291:	83 ec 08             	sub    $0x8,%esp
+ 294:	6a 00                	push   $0x0
+ 296:	ff 75 08             	push   0x8(%ebp)
+ 299:	e8 a2 03 00 00       	call   640 <open>
+ 29e:	83 c4 10             	add    $0x10,%esp
+ 2a1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 2a4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 2a8:	79 07                	jns    2b1 <stat+0x26>
+    return -1;
+ 2aa:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2af:	eb 25                	jmp    2d6 <stat+0x4b>
+  r = fstat(fd, st);
+ 2b1:	83 ec 08             	sub    $0x8,%esp
+ 2b4:	ff 75 0c             	push   0xc(%ebp)
+ 2b7:	ff 75 f4             	push   -0xc(%ebp)
+ 2ba:	e8 99 03 00 00       	call   658 <fstat>
+ 2bf:	83 c4 10             	add    $0x10,%esp
+ 2c2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 2c5:	83 ec 0c             	sub    $0xc,%esp
+ 2c8:	ff 75 f4             	push   -0xc(%ebp)
+ 2cb:	e8 58 03 00 00       	call   628 <close>
+ 2d0:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 2d3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 2d6:	c9                   	leave
+ 2d7:	c3                   	ret
+
+000002d8 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 2d8:	55                   	push   %ebp
+ 2d9:	89 e5                	mov    %esp,%ebp
+ 2db:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+
+  dst = vdst;
+ 2de:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 2e4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2e7:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 2ea:	eb 17                	jmp    303 <memmove+0x2b>
+    *dst++ = *src++;
+ 2ec:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 2ef:	8d 42 01             	lea    0x1(%edx),%eax
+ 2f2:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 2f5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2f8:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2fb:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 2fe:	0f b6 12             	movzbl (%edx),%edx
+ 301:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 303:	8b 45 10             	mov    0x10(%ebp),%eax
+ 306:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 309:	89 55 10             	mov    %edx,0x10(%ebp)
+ 30c:	85 c0                	test   %eax,%eax
+ 30e:	7f dc                	jg     2ec <memmove+0x14>
+  return vdst;
+ 310:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 313:	c9                   	leave
+ 314:	c3                   	ret
+
+00000315 <cpuinfo>:
+ 315:	55                   	push   %ebp
+ 316:	89 e5                	mov    %esp,%ebp
+ 318:	56                   	push   %esi
+ 319:	53                   	push   %ebx
+ 31a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 31d:	ba 00 00 00 00       	mov    $0x0,%edx
+ 322:	89 d1                	mov    %edx,%ecx
+ 324:	0f a2                	cpuid
+ 326:	89 c6                	mov    %eax,%esi
+ 328:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 32b:	89 30                	mov    %esi,(%eax)
+ 32d:	8b 45 10             	mov    0x10(%ebp),%eax
+ 330:	89 18                	mov    %ebx,(%eax)
+ 332:	8b 45 14             	mov    0x14(%ebp),%eax
+ 335:	89 08                	mov    %ecx,(%eax)
+ 337:	8b 45 18             	mov    0x18(%ebp),%eax
+ 33a:	89 10                	mov    %edx,(%eax)
+ 33c:	90                   	nop
+ 33d:	5b                   	pop    %ebx
+ 33e:	5e                   	pop    %esi
+ 33f:	5d                   	pop    %ebp
+ 340:	c3                   	ret
+
+00000341 <atoi>:
+{
+ 341:	55                   	push   %ebp
+ 342:	89 e5                	mov    %esp,%ebp
+ 344:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+ 347:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 34e:	eb 25                	jmp    375 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 350:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 353:	89 d0                	mov    %edx,%eax
+ 355:	c1 e0 02             	shl    $0x2,%eax
+ 358:	01 d0                	add    %edx,%eax
+ 35a:	01 c0                	add    %eax,%eax
+ 35c:	89 c1                	mov    %eax,%ecx
+ 35e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 361:	8d 50 01             	lea    0x1(%eax),%edx
+ 364:	89 55 08             	mov    %edx,0x8(%ebp)
+ 367:	0f b6 00             	movzbl (%eax),%eax
+ 36a:	0f be c0             	movsbl %al,%eax
+ 36d:	01 c8                	add    %ecx,%eax
+ 36f:	83 e8 30             	sub    $0x30,%eax
+ 372:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 375:	8b 45 08             	mov    0x8(%ebp),%eax
+ 378:	0f b6 00             	movzbl (%eax),%eax
+ 37b:	3c 2f                	cmp    $0x2f,%al
+ 37d:	7e 0a                	jle    389 <atoi+0x48>
+ 37f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 382:	0f b6 00             	movzbl (%eax),%eax
+ 385:	3c 39                	cmp    $0x39,%al
+ 387:	7e c7                	jle    350 <atoi+0xf>
+  return n;
+ 389:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 38c:	c9                   	leave
+ 38d:	c3                   	ret
+
+0000038e <strcmp>:
+{
+ 38e:	55                   	push   %ebp
+ 38f:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 391:	eb 08                	jmp    39b <strcmp+0xd>
+    p++, q++;
+ 393:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 397:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 39b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 39e:	0f b6 00             	movzbl (%eax),%eax
+ 3a1:	84 c0                	test   %al,%al
+ 3a3:	74 10                	je     3b5 <strcmp+0x27>
+ 3a5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a8:	0f b6 10             	movzbl (%eax),%edx
+ 3ab:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3ae:	0f b6 00             	movzbl (%eax),%eax
+ 3b1:	38 c2                	cmp    %al,%dl
+ 3b3:	74 de                	je     393 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 3b5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b8:	0f b6 00             	movzbl (%eax),%eax
+ 3bb:	0f b6 d0             	movzbl %al,%edx
+ 3be:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3c1:	0f b6 00             	movzbl (%eax),%eax
+ 3c4:	0f b6 c0             	movzbl %al,%eax
+ 3c7:	29 c2                	sub    %eax,%edx
+ 3c9:	89 d0                	mov    %edx,%eax
+}
+ 3cb:	5d                   	pop    %ebp
+ 3cc:	c3                   	ret
+
+000003cd <udiv64>:
+{
+ 3cd:	55                   	push   %ebp
+ 3ce:	89 e5                	mov    %esp,%ebp
+ 3d0:	57                   	push   %edi
+ 3d1:	56                   	push   %esi
+ 3d2:	83 ec 38             	sub    $0x38,%esp
+ 3d5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 3db:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3de:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 3e1:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3e4:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 3e7:	8b 45 14             	mov    0x14(%ebp),%eax
+ 3ea:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  q = r = 0;
+ 3ed:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 3f4:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 3fb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 3fe:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 401:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 404:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 407:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 40e:	e9 85 00 00 00       	jmp    498 <udiv64+0xcb>
+    r = (r << 1) | ((n >> i) & 1);
+ 413:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 416:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 419:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 41d:	01 c0                	add    %eax,%eax
+ 41f:	89 c6                	mov    %eax,%esi
+ 421:	89 d7                	mov    %edx,%edi
+ 423:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 426:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 429:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 42c:	0f ad d0             	shrd   %cl,%edx,%eax
+ 42f:	d3 ea                	shr    %cl,%edx
+ 431:	f6 c1 20             	test   $0x20,%cl
+ 434:	74 04                	je     43a <udiv64+0x6d>
+ 436:	89 d0                	mov    %edx,%eax
+ 438:	31 d2                	xor    %edx,%edx
+ 43a:	83 e0 01             	and    $0x1,%eax
+ 43d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 440:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+ 447:	89 f0                	mov    %esi,%eax
+ 449:	89 fa                	mov    %edi,%edx
+ 44b:	0b 45 c0             	or     -0x40(%ebp),%eax
+ 44e:	0b 55 c4             	or     -0x3c(%ebp),%edx
+ 451:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 454:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 457:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 45a:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 45d:	3b 45 c8             	cmp    -0x38(%ebp),%eax
+ 460:	89 d0                	mov    %edx,%eax
+ 462:	1b 45 cc             	sbb    -0x34(%ebp),%eax
+ 465:	72 2d                	jb     494 <udiv64+0xc7>
+      r -= d;
+ 467:	8b 45 c8             	mov    -0x38(%ebp),%eax
+ 46a:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 46d:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 470:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64_t)1 << i;
+ 473:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 476:	b8 01 00 00 00       	mov    $0x1,%eax
+ 47b:	ba 00 00 00 00       	mov    $0x0,%edx
+ 480:	0f a5 c2             	shld   %cl,%eax,%edx
+ 483:	d3 e0                	shl    %cl,%eax
+ 485:	f6 c1 20             	test   $0x20,%cl
+ 488:	74 04                	je     48e <udiv64+0xc1>
+ 48a:	89 c2                	mov    %eax,%edx
+ 48c:	31 c0                	xor    %eax,%eax
+ 48e:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 491:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 494:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 498:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 49c:	0f 89 71 ff ff ff    	jns    413 <udiv64+0x46>
+  if(rem)
+ 4a2:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+ 4a6:	74 0e                	je     4b6 <udiv64+0xe9>
+    *rem = r;
+ 4a8:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 4ab:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 4ae:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 4b1:	89 01                	mov    %eax,(%ecx)
+ 4b3:	89 51 04             	mov    %edx,0x4(%ecx)
+  return q;
+ 4b6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 4b9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 4bc:	83 c4 38             	add    $0x38,%esp
+ 4bf:	5e                   	pop    %esi
+ 4c0:	5f                   	pop    %edi
+ 4c1:	5d                   	pop    %ebp
+ 4c2:	c3                   	ret
+
+000004c3 <crc32cinit>:
+{
+ 4c3:	55                   	push   %ebp
+ 4c4:	89 e5                	mov    %esp,%ebp
+ 4c6:	83 ec 20             	sub    $0x20,%esp
+  for(i = 0; i < 256; i++){
+ 4c9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 4d0:	eb 4c                	jmp    51e <crc32cinit+0x5b>
+    r = i;
+ 4d2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 4d5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+ 4d8:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+ 4df:	eb 26                	jmp    507 <crc32cinit+0x44>
+      r = (r >> 1) ^ ((r & 1) ? CRC32C_POLY : 0);
+ 4e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4e4:	d1 e8                	shr    %eax
+ 4e6:	89 c2                	mov    %eax,%edx
+ 4e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4eb:	83 e0 01             	and    $0x1,%eax
+ 4ee:	85 c0                	test   %eax,%eax
+ 4f0:	74 07                	je     4f9 <crc32cinit+0x36>
+ 4f2:	b8 78 3b f6 82       	mov    $0x82f63b78,%eax
+ 4f7:	eb 05                	jmp    4fe <crc32cinit+0x3b>
+ 4f9:	b8 00 00 00 00       	mov    $0x0,%eax
+ 4fe:	31 d0                	xor    %edx,%eax
+ 500:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+ 503:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+ 507:	83 7d f8 07          	cmpl   $0x7,-0x8(%ebp)
+ 50b:	76 d4                	jbe    4e1 <crc32cinit+0x1e>
+    crc32ctab[i] = r;
+ 50d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 510:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 513:	89 14 85 c0 0e 00 00 	mov    %edx,0xec0(,%eax,4)
+  for(i = 0; i < 256; i++){
+ 51a:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 51e:	81 7d fc ff 00 00 00 	cmpl   $0xff,-0x4(%ebp)
+ 525:	76 ab                	jbe    4d2 <crc32cinit+0xf>
+  cpuinfo(1, &a, &b, &c, &d);
+ 527:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 52a:	50                   	push   %eax
+ 52b:	8d 45 e8             	lea    -0x18(%ebp),%eax
+ 52e:	50                   	push   %eax
+ 52f:	8d 45 ec             	lea    -0x14(%ebp),%eax
+ 532:	50                   	push   %eax
+ 533:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 536:	50                   	push   %eax
+ 537:	6a 01                	push   $0x1
+ 539:	e8 d7 fd ff ff       	call   315 <cpuinfo>
+ 53e:	83 c4 14             	add    $0x14,%esp
+  crc32chw = (c & CPUID_SSE42) != 0;
+ 541:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 544:	25 00 00 10 00       	and    $0x100000,%eax
+ 549:	85 c0                	test   %eax,%eax
+ 54b:	0f 95 c0             	setne  %al
+ 54e:	0f b6 c0             	movzbl %al,%eax
+ 551:	a3 98 0e 00 00       	mov    %eax,0xe98
+}
+ 556:	90                   	nop
+ 557:	c9                   	leave
+ 558:	c3                   	ret
+
+00000559 <crc32c>:
+{
+ 559:	55                   	push   %ebp
+ 55a:	89 e5                	mov    %esp,%ebp
+ 55c:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s = p;
+ 55f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 562:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(crc32chw < 0)
+ 565:	a1 98 0e 00 00       	mov    0xe98,%eax
+ 56a:	85 c0                	test   %eax,%eax
+ 56c:	79 05                	jns    573 <crc32c+0x1a>
+    crc32cinit();
+ 56e:	e8 50 ff ff ff       	call   4c3 <crc32cinit>
+  crc = ~crc;
+ 573:	f7 55 08             	notl   0x8(%ebp)
+  if(crc32chw){
+ 576:	a1 98 0e 00 00       	mov    0xe98,%eax
+ 57b:	85 c0                	test   %eax,%eax
+ 57d:	74 6c                	je     5eb <crc32c+0x92>
+    for(; n >= 4; n -= 4, s += 4)
+ 57f:	eb 18                	jmp    599 <crc32c+0x40>
+      asm("crc32l %1, %0" : "+r" (crc) : "rm" (*(const uint*)s));
+ 581:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 584:	8b 10                	mov    (%eax),%edx
+ 586:	8b 45 08             	mov    0x8(%ebp),%eax
+ 589:	f2 0f 38 f1 c2       	crc32  %edx,%eax
+ 58e:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n >= 4; n -= 4, s += 4)
+ 591:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+ 595:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+ 599:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+ 59d:	77 e2                	ja     581 <crc32c+0x28>
+    for(; n > 0; n--, s++)
+ 59f:	eb 19                	jmp    5ba <crc32c+0x61>
+      asm("crc32b %1, %0" : "+r" (crc) : "qm" (*s));
+ 5a1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 5a4:	0f b6 10             	movzbl (%eax),%edx
+ 5a7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5aa:	f2 0f 38 f0 c2       	crc32  %dl,%eax
+ 5af:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+ 5b2:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+ 5b6:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 5ba:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 5be:	75 e1                	jne    5a1 <crc32c+0x48>
+ 5c0:	eb 2f                	jmp    5f1 <crc32c+0x98>
+      crc = crc32ctab[(crc ^ *s) & 0xff] ^ (crc >> 8);
+ 5c2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 5c5:	0f b6 00             	movzbl (%eax),%eax
+ 5c8:	0f b6 c0             	movzbl %al,%eax
+ 5cb:	33 45 08             	xor    0x8(%ebp),%eax
+ 5ce:	0f b6 c0             	movzbl %al,%eax
+ 5d1:	8b 04 85 c0 0e 00 00 	mov    0xec0(,%eax,4),%eax
+ 5d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5db:	c1 ea 08             	shr    $0x8,%edx
+ 5de:	31 d0                	xor    %edx,%eax
+ 5e0:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+ 5e3:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+ 5e7:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 5eb:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 5ef:	75 d1                	jne    5c2 <crc32c+0x69>
+  return ~crc;
+ 5f1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5f4:	f7 d0                	not    %eax
+}
+ 5f6:	c9                   	leave
+ 5f7:	c3                   	ret
+
+000005f8 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 5f8:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5fd:	cd 40                	int    $0x40
+ 5ff:	c3                   	ret
+
+00000600 <exit>:
+SYSCALL(exit)
+ 600:	b8 02 00 00 00       	mov    $0x2,%eax
+ 605:	cd 40                	int    $0x40
+ 607:	c3                   	ret
+
+00000608 <wait>:
+SYSCALL(wait)
+ 608:	b8 03 00 00 00       	mov    $0x3,%eax
+ 60d:	cd 40                	int    $0x40
+ 60f:	c3                   	ret
+
+00000610 <pipe>:
+SYSCALL(pipe)
+ 610:	b8 04 00 00 00       	mov    $0x4,%eax
+ 615:	cd 40                	int    $0x40
+ 617:	c3                   	ret
+
+00000618 <read>:
+SYSCALL(read)
+ 618:	b8 05 00 00 00       	mov    $0x5,%eax
+ 61d:	cd 40                	int    $0x40
+ 61f:	c3                   	ret
+
+00000620 <write>:
+SYSCALL(write)
+ 620:	b8 10 00 00 00       	mov    $0x10,%eax
+ 625:	cd 40                	int    $0x40
+ 627:	c3                   	ret
+
+00000628 <close>:
+SYSCALL(close)
+ 628:	b8 15 00 00 00       	mov    $0x15,%eax
+ 62d:	cd 40                	int    $0x40
+ 62f:	c3                   	ret
+
+00000630 <kill>:
+SYSCALL(kill)
+ 630:	b8 06 00 00 00       	mov    $0x6,%eax
+ 635:	cd 40                	int    $0x40
+ 637:	c3                   	ret
+
+00000638 <exec>:
+SYSCALL(exec)
+ 638:	b8 07 00 00 00       	mov    $0x7,%eax
+ 63d:	cd 40                	int    $0x40
+ 63f:	c3                   	ret
+
+00000640 <open>:
+SYSCALL(open)
+ 640:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 645:	cd 40                	int    $0x40
+ 647:	c3                   	ret
+
+00000648 <mknod>:
+SYSCALL(mknod)
+ 648:	b8 11 00 00 00       	mov    $0x11,%eax
+ 64d:	cd 40                	int    $0x40
+ 64f:	c3                   	ret
+
+00000650 <unlink>:
+SYSCALL(unlink)
+ 650:	b8 12 00 00 00       	mov    $0x12,%eax
+ 655:	cd 40                	int    $0x40
+ 657:	c3                   	ret
+
+00000658 <fstat>:
+SYSCALL(fstat)
+ 658:	b8 08 00 00 00       	mov    $0x8,%eax
+ 65d:	cd 40                	int    $0x40
+ 65f:	c3                   	ret
+
+00000660 <link>:
+SYSCALL(link)
+ 660:	b8 13 00 00 00       	mov    $0x13,%eax
+ 665:	cd 40                	int    $0x40
+ 667:	c3                   	ret
+
+00000668 <mkdir>:
+SYSCALL(mkdir)
+ 668:	b8 14 00 00 00       	mov    $0x14,%eax
+ 66d:	cd 40                	int    $0x40
+ 66f:	c3                   	ret
+
+00000670 <chdir>:
+SYSCALL(chdir)
+ 670:	b8 09 00 00 00       	mov    $0x9,%eax
+ 675:	cd 40                	int    $0x40
+ 677:	c3                   	ret
+
+00000678 <dup>:
+SYSCALL(dup)
+ 678:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 67d:	cd 40                	int    $0x40
+ 67f:	c3                   	ret
+
+00000680 <getpid>:
+SYSCALL(getpid)
+ 680:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 685:	cd 40                	int    $0x40
+ 687:	c3                   	ret
+
+00000688 <sbrk>:
+SYSCALL(sbrk)
+ 688:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 68d:	cd 40                	int    $0x40
+ 68f:	c3                   	ret
+
+00000690 <sleep>:
+SYSCALL(sleep)
+ 690:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 695:	cd 40                	int    $0x40
+ 697:	c3                   	ret
+
+00000698 <uptime>:
+SYSCALL(uptime)
+ 698:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 69d:	cd 40                	int    $0x40
+ 69f:	c3                   	ret
+
+000006a0 <arp>:
+SYSCALL(arp)
+ 6a0:	b8 16 00 00 00       	mov    $0x16,%eax
+ 6a5:	cd 40                	int    $0x40
+ 6a7:	c3                   	ret
+
+000006a8 <ifstat>:
+SYSCALL(ifstat)
+ 6a8:	b8 17 00 00 00       	mov    $0x17,%eax
+ 6ad:	cd 40                	int    $0x40
+ 6af:	c3                   	ret
+
+000006b0 <pcapctl>:
+SYSCALL(pcapctl)
+ 6b0:	b8 18 00 00 00       	mov    $0x18,%eax
+ 6b5:	cd 40                	int    $0x40
+ 6b7:	c3                   	ret
+
+000006b8 <pcapread>:
+SYSCALL(pcapread)
+ 6b8:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6bd:	cd 40                	int    $0x40
+ 6bf:	c3                   	ret
+
+000006c0 <bpfattach>:
+SYSCALL(bpfattach)
+ 6c0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6c5:	cd 40                	int    $0x40
+ 6c7:	c3                   	ret
+
+000006c8 <pktgen>:
+SYSCALL(pktgen)
+ 6c8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6cd:	cd 40                	int    $0x40
+ 6cf:	c3                   	ret
+
+000006d0 <reflect>:
+SYSCALL(reflect)
+ 6d0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6d5:	cd 40                	int    $0x40
+ 6d7:	c3                   	ret
+
+000006d8 <brctl>:
+SYSCALL(brctl)
+ 6d8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6dd:	cd 40                	int    $0x40
+ 6df:	c3                   	ret
+
+000006e0 <hostopen>:
+SYSCALL(hostopen)
+ 6e0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6e5:	cd 40                	int    $0x40
+ 6e7:	c3                   	ret
+
+000006e8 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 6e8:	55                   	push   %ebp
+ 6e9:	89 e5                	mov    %esp,%ebp
+ 6eb:	83 ec 18             	sub    $0x18,%esp
+ 6ee:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6f1:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 6f4:	83 ec 04             	sub    $0x4,%esp
+ 6f7:	6a 01                	push   $0x1
+ 6f9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 6fc:	50                   	push   %eax
+ 6fd:	ff 75 08             	push   0x8(%ebp)
+ 700:	e8 1b ff ff ff       	call   620 <write>
+ 705:	83 c4 10             	add    $0x10,%esp
+}
+ 708:	90                   	nop
+ 709:	c9                   	leave
+ 70a:	c3                   	ret
+
+0000070b <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 70b:	55                   	push   %ebp
+ 70c:	89 e5                	mov    %esp,%ebp
+ 70e:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 711:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 718:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 71c:	74 17                	je     735 <printint+0x2a>
+ 71e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 722:	79 11                	jns    735 <printint+0x2a>
+    neg = 1;
+ 724:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 72b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 72e:	f7 d8                	neg    %eax
+ 730:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 733:	eb 06                	jmp    73b <printint+0x30>
+  } else {
+    x = xx;
+ 735:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 738:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 73b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 742:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 745:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 748:	ba 00 00 00 00       	mov    $0x0,%edx
+ 74d:	f7 f1                	div    %ecx
+ 74f:	89 d1                	mov    %edx,%ecx
+ 751:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 754:	8d 50 01             	lea    0x1(%eax),%edx
+ 757:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 75a:	0f b6 91 9c 0e 00 00 	movzbl 0xe9c(%ecx),%edx
+ 761:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 765:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 768:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 76b:	ba 00 00 00 00       	mov    $0x0,%edx
+ 770:	f7 f1                	div    %ecx
+ 772:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 775:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 779:	75 c7                	jne    742 <printint+0x37>
+  if(neg)
+ 77b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 77f:	74 2d                	je     7ae <printint+0xa3>
+    buf[i++] = '-';
+ 781:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 784:	8d 50 01             	lea    0x1(%eax),%edx
+ 787:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 78a:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 78f:	eb 1d                	jmp    7ae <printint+0xa3>
+    putc(fd, buf[i]);
+ 791:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 794:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 797:	01 d0                	add    %edx,%eax
+ 799:	0f b6 00             	movzbl (%eax),%eax
+ 79c:	0f be c0             	movsbl %al,%eax
+ 79f:	83 ec 08             	sub    $0x8,%esp
+ 7a2:	50                   	push   %eax
+ 7a3:	ff 75 08             	push   0x8(%ebp)
+ 7a6:	e8 3d ff ff ff       	call   6e8 <putc>
+ 7ab:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 7ae:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 7b2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 7b6:	79 d9                	jns    791 <printint+0x86>
+}
+ 7b8:	90                   	nop
+ 7b9:	90                   	nop
+ 7ba:	c9                   	leave
+ 7bb:	c3                   	ret
+
+000007bc <printf>:
+
+// Print to the given fd. Only understands %d, %u, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 7bc:	55                   	push   %ebp
+ 7bd:	89 e5                	mov    %esp,%ebp
+ 7bf:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 7c2:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 7c9:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 7cc:	83 c0 04             	add    $0x4,%eax
+ 7cf:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 7d2:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 7d9:	e9 7d 01 00 00       	jmp    95b <printf+0x19f>
+    c = fmt[i] & 0xff;
+ 7de:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 7e1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7e4:	01 d0                	add    %edx,%eax
+ 7e6:	0f b6 00             	movzbl (%eax),%eax
+ 7e9:	0f be c0             	movsbl %al,%eax
+ 7ec:	25 ff 00 00 00       	and    $0xff,%eax
+ 7f1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 7f4:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 7f8:	75 2c                	jne    826 <printf+0x6a>
+      if(c == '%'){
+ 7fa:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 7fe:	75 0c                	jne    80c <printf+0x50>
+        state = '%';
+ 800:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 807:	e9 4b 01 00 00       	jmp    957 <printf+0x19b>
+      } else {
+        putc(fd, c);
+ 80c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 80f:	0f be c0             	movsbl %al,%eax
+ 812:	83 ec 08             	sub    $0x8,%esp
+ 815:	50                   	push   %eax
+ 816:	ff 75 08             	push   0x8(%ebp)
+ 819:	e8 ca fe ff ff       	call   6e8 <putc>
+ 81e:	83 c4 10             	add    $0x10,%esp
+ 821:	e9 31 01 00 00       	jmp    957 <printf+0x19b>
+      }
+    } else if(state == '%'){
+ 826:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 82a:	0f 85 27 01 00 00    	jne    957 <printf+0x19b>
+      if(c == 'd'){
+ 830:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 834:	75 1e                	jne    854 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 836:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 839:	8b 00                	mov    (%eax),%eax
+ 83b:	6a 01                	push   $0x1
+ 83d:	6a 0a                	push   $0xa
+ 83f:	50                   	push   %eax
+ 840:	ff 75 08             	push   0x8(%ebp)
+ 843:	e8 c3 fe ff ff       	call   70b <printint>
+ 848:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 84b:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 84f:	e9 fc 00 00 00       	jmp    950 <printf+0x194>
+      } else if(c == 'u'){
+ 854:	83 7d e4 75          	cmpl   $0x75,-0x1c(%ebp)
+ 858:	75 1e                	jne    878 <printf+0xbc>
+        printint(fd, *ap, 10, 0);
+ 85a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 85d:	8b 00                	mov    (%eax),%eax
+ 85f:	6a 00                	push   $0x0
+ 861:	6a 0a                	push   $0xa
+ 863:	50                   	push   %eax
+ 864:	ff 75 08             	push   0x8(%ebp)
+ 867:	e8 9f fe ff ff       	call   70b <printint>
+ 86c:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 86f:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 873:	e9 d8 00 00 00       	jmp    950 <printf+0x194>
+      } else if(c == 'x' || c == 'p'){
+ 878:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 87c:	74 06                	je     884 <printf+0xc8>
+ 87e:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 882:	75 1e                	jne    8a2 <printf+0xe6>
+        printint(fd, *ap, 16, 0);
+ 884:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 887:	8b 00                	mov    (%eax),%eax
+ 889:	6a 00                	push   $0x0
+ 88b:	6a 10                	push   $0x10
+ 88d:	50                   	push   %eax
+ 88e:	ff 75 08             	push   0x8(%ebp)
+ 891:	e8 75 fe ff ff       	call   70b <printint>
+ 896:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 899:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 89d:	e9 ae 00 00 00       	jmp    950 <printf+0x194>
+      } else if(c == 's'){
+ 8a2:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 8a6:	75 43                	jne    8eb <printf+0x12f>
+        s = (char*)*ap;
+ 8a8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8ab:	8b 00                	mov    (%eax),%eax
+ 8ad:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 8b0:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 8b4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 8b8:	75 25                	jne    8df <printf+0x123>
+          s = "(null)";
+ 8ba:	c7 45 f4 ba 0b 00 00 	movl   $0xbba,-0xc(%ebp)
+        while(*s != 0){
+ 8c1:	eb 1c                	jmp    8df <printf+0x123>
+          putc(fd, *s);
+ 8c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8c6:	0f b6 00             	movzbl (%eax),%eax
+ 8c9:	0f be c0             	movsbl %al,%eax
+ 8cc:	83 ec 08             	sub    $0x8,%esp
+ 8cf:	50                   	push   %eax
+ 8d0:	ff 75 08             	push   0x8(%ebp)
+ 8d3:	e8 10 fe ff ff       	call   6e8 <putc>
+ 8d8:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 8db:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 8df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8e2:	0f b6 00             	movzbl (%eax),%eax
+ 8e5:	84 c0                	test   %al,%al
+ 8e7:	75 da                	jne    8c3 <printf+0x107>
+ 8e9:	eb 65                	jmp    950 <printf+0x194>
+        }
+      } else if(c == 'c'){
+ 8eb:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 8ef:	75 1d                	jne    90e <printf+0x152>
+        putc(fd, *ap);
+ 8f1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8f4:	8b 00                	mov    (%eax),%eax
+ 8f6:	0f be c0             	movsbl %al,%eax
+ 8f9:	83 ec 08             	sub    $0x8,%esp
+ 8fc:	50                   	push   %eax
+ 8fd:	ff 75 08             	push   0x8(%ebp)
+ 900:	e8 e3 fd ff ff       	call   6e8 <putc>
+ 905:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 908:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 90c:	eb 42                	jmp    950 <printf+0x194>
+      } else if(c == '%'){
+ 90e:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 912:	75 17                	jne    92b <printf+0x16f>
+        putc(fd, c);
+ 914:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 917:	0f be c0             	movsbl %al,%eax
+ 91a:	83 ec 08             	sub    $0x8,%esp
+ 91d:	50                   	push   %eax
+ 91e:	ff 75 08             	push   0x8(%ebp)
+ 921:	e8 c2 fd ff ff       	call   6e8 <putc>
+ 926:	83 c4 10             	add    $0x10,%esp
+ 929:	eb 25                	jmp    950 <printf+0x194>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 92b:	83 ec 08             	sub    $0x8,%esp
+ 92e:	6a 25                	push   $0x25
+ 930:	ff 75 08             	push   0x8(%ebp)
+ 933:	e8 b0 fd ff ff       	call   6e8 <putc>
+ 938:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 93b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 93e:	0f be c0             	movsbl %al,%eax
+ 941:	83 ec 08             	sub    $0x8,%esp
+ 944:	50                   	push   %eax
+ 945:	ff 75 08             	push   0x8(%ebp)
+ 948:	e8 9b fd ff ff       	call   6e8 <putc>
+ 94d:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 950:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 957:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 95b:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 95e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 961:	01 d0                	add    %edx,%eax
+ 963:	0f b6 00             	movzbl (%eax),%eax
+ 966:	84 c0                	test   %al,%al
+ 968:	0f 85 70 fe ff ff    	jne    7de <printf+0x22>
+    }
+  }
+}
+ 96e:	90                   	nop
+ 96f:	90                   	nop
+ 970:	c9                   	leave
+ 971:	c3                   	ret
+
+00000972 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 972:	55                   	push   %ebp
+ 973:	89 e5                	mov    %esp,%ebp
+ 975:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 978:	8b 45 08             	mov    0x8(%ebp),%eax
+ 97b:	83 e8 08             	sub    $0x8,%eax
+ 97e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 981:	a1 c8 12 00 00       	mov    0x12c8,%eax
+ 986:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 989:	eb 24                	jmp    9af <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 98b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 98e:	8b 00                	mov    (%eax),%eax
+ 990:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 993:	72 12                	jb     9a7 <free+0x35>
+ 995:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 998:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 99b:	72 24                	jb     9c1 <free+0x4f>
+ 99d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9a0:	8b 00                	mov    (%eax),%eax
+ 9a2:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 9a5:	72 1a                	jb     9c1 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9a7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9aa:	8b 00                	mov    (%eax),%eax
+ 9ac:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 9af:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9b2:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 9b5:	73 d4                	jae    98b <free+0x19>
+ 9b7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9ba:	8b 00                	mov    (%eax),%eax
+ 9bc:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 9bf:	73 ca                	jae    98b <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 9c1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9c4:	8b 40 04             	mov    0x4(%eax),%eax
+ 9c7:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 9ce:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9d1:	01 c2                	add    %eax,%edx
+ 9d3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9d6:	8b 00                	mov    (%eax),%eax
+ 9d8:	39 c2                	cmp    %eax,%edx
+ 9da:	75 24                	jne    a00 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 9dc:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9df:	8b 50 04             	mov    0x4(%eax),%edx
+ 9e2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9e5:	8b 00                	mov    (%eax),%eax
+ 9e7:	8b 40 04             	mov    0x4(%eax),%eax
+ 9ea:	01 c2                	add    %eax,%edx
+ 9ec:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9ef:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9f2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9f5:	8b 00                	mov    (%eax),%eax
+ 9f7:	8b 10                	mov    (%eax),%edx
+ 9f9:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9fc:	89 10                	mov    %edx,(%eax)
+ 9fe:	eb 0a                	jmp    a0a <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ a00:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a03:	8b 10                	mov    (%eax),%edx
+ a05:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a08:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ a0a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a0d:	8b 40 04             	mov    0x4(%eax),%eax
+ a10:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ a17:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a1a:	01 d0                	add    %edx,%eax
+ a1c:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a1f:	75 20                	jne    a41 <free+0xcf>
+    p->s.size += bp->s.size;
+ a21:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a24:	8b 50 04             	mov    0x4(%eax),%edx
+ a27:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a2a:	8b 40 04             	mov    0x4(%eax),%eax
+ a2d:	01 c2                	add    %eax,%edx
+ a2f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a32:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ a35:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a38:	8b 10                	mov    (%eax),%edx
+ a3a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a3d:	89 10                	mov    %edx,(%eax)
+ a3f:	eb 08                	jmp    a49 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ a41:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a44:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ a47:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ a49:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a4c:	a3 c8 12 00 00       	mov    %eax,0x12c8
+}
+ a51:	90                   	nop
+ a52:	c9                   	leave
+ a53:	c3                   	ret
+
+00000a54 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ a54:	55                   	push   %ebp
+ a55:	89 e5                	mov    %esp,%ebp
+ a57:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ a5a:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ a61:	77 07                	ja     a6a <morecore+0x16>
+    nu = 4096;
+ a63:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ a6a:	8b 45 08             	mov    0x8(%ebp),%eax
+ a6d:	c1 e0 03             	shl    $0x3,%eax
+ a70:	83 ec 0c             	sub    $0xc,%esp
+ a73:	50                   	push   %eax
+ a74:	e8 0f fc ff ff       	call   688 <sbrk>
+ a79:	83 c4 10             	add    $0x10,%esp
+ a7c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ a7f:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ a83:	75 07                	jne    a8c <morecore+0x38>
+    return 0;
+ a85:	b8 00 00 00 00       	mov    $0x0,%eax
+ a8a:	eb 26                	jmp    ab2 <morecore+0x5e>
+  hp = (Header*)p;
+ a8c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a8f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ a92:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a95:	8b 55 08             	mov    0x8(%ebp),%edx
+ a98:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ a9b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a9e:	83 c0 08             	add    $0x8,%eax
+ aa1:	83 ec 0c             	sub    $0xc,%esp
+ aa4:	50                   	push   %eax
+ aa5:	e8 c8 fe ff ff       	call   972 <free>
+ aaa:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ aad:	a1 c8 12 00 00       	mov    0x12c8,%eax
+}
+ ab2:	c9                   	leave
+ ab3:	c3                   	ret
+
+00000ab4 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ ab4:	55                   	push   %ebp
+ ab5:	89 e5                	mov    %esp,%ebp
+ ab7:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ aba:	8b 45 08             	mov    0x8(%ebp),%eax
+ abd:	83 c0 07             	add    $0x7,%eax
+ ac0:	c1 e8 03             	shr    $0x3,%eax
+ ac3:	83 c0 01             	add    $0x1,%eax
+ ac6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ ac9:	a1 c8 12 00 00       	mov    0x12c8,%eax
+ ace:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ ad1:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ ad5:	75 23                	jne    afa <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ ad7:	c7 45 f0 c0 12 00 00 	movl   $0x12c0,-0x10(%ebp)
+ ade:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ae1:	a3 c8 12 00 00       	mov    %eax,0x12c8
+ ae6:	a1 c8 12 00 00       	mov    0x12c8,%eax
+ aeb:	a3 c0 12 00 00       	mov    %eax,0x12c0
+    base.s.size = 0;
+ af0:	c7 05 c4 12 00 00 00 	movl   $0x0,0x12c4
+ af7:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ afa:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ afd:	8b 00                	mov    (%eax),%eax
+ aff:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ b02:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b05:	8b 40 04             	mov    0x4(%eax),%eax
+ b08:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ b0b:	72 4d                	jb     b5a <malloc+0xa6>
+      if(p->s.size == nunits)
+ b0d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b10:	8b 40 04             	mov    0x4(%eax),%eax
+ b13:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ b16:	75 0c                	jne    b24 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ b18:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b1b:	8b 10                	mov    (%eax),%edx
+ b1d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b20:	89 10                	mov    %edx,(%eax)
+ b22:	eb 26                	jmp    b4a <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ b24:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b27:	8b 40 04             	mov    0x4(%eax),%eax
+ b2a:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ b2d:	89 c2                	mov    %eax,%edx
+ b2f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b32:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ b35:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b38:	8b 40 04             	mov    0x4(%eax),%eax
+ b3b:	c1 e0 03             	shl    $0x3,%eax
+ b3e:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ b41:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b44:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ b47:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ b4a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b4d:	a3 c8 12 00 00       	mov    %eax,0x12c8
+      return (void*)(p + 1);
+ b52:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b55:	83 c0 08             	add    $0x8,%eax
+ b58:	eb 3b                	jmp    b95 <malloc+0xe1>
+    }
+    if(p == freep)
+ b5a:	a1 c8 12 00 00       	mov    0x12c8,%eax
+ b5f:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ b62:	75 1e                	jne    b82 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ b64:	83 ec 0c             	sub    $0xc,%esp
+ b67:	ff 75 ec             	push   -0x14(%ebp)
+ b6a:	e8 e5 fe ff ff       	call   a54 <morecore>
+ b6f:	83 c4 10             	add    $0x10,%esp
+ b72:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ b75:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b79:	75 07                	jne    b82 <malloc+0xce>
+        return 0;
+ b7b:	b8 00 00 00 00       	mov    $0x0,%eax
+ b80:	eb 13                	jmp    b95 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b82:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b85:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ b88:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b8b:	8b 00                	mov    (%eax),%eax
+ b8d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ b90:	e9 6d ff ff ff       	jmp    b02 <malloc+0x4e>
+  }
+}
+ b95:	c9                   	leave
+ b96:	c3                   	ret
@@ -104,6 +104,14 @@ extern int sys_wait(void);
 extern int sys_write(void);
 extern int sys_uptime(void);
 extern int sys_arp(void);
+extern int sys_ifstat(void);
+extern int sys_pcapctl(void);
+extern int sys_pcapread(void);
+extern int sys_bpfattach(void);
+extern int sys_pktgen(void);
+extern int sys_reflect(void);
+extern int sys_brctl(void);
+extern int sys_hostopen(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]    sys_fork,
@@ -127,7 +135,15 @@ static int (*syscalls[])(void) = {
 [SYS_link]    sys_link,
 [SYS_mkdir]   sys_mkdir,
 [SYS_close]   sys_close,
-[SYS_arp] sys_arp
+[SYS_arp] sys_arp,
+[SYS_ifstat] sys_ifstat,
+[SYS_pcapctl] sys_pcapctl,
+[SYS_pcapread] sys_pcapread,
+[SYS_bpfattach] sys_bpfattach,
+[SYS_pktgen] sys_pktgen,
+[SYS_reflect] sys_reflect,
+[SYS_brctl] sys_brctl,
+[SYS_hostopen] sys_hostopen,
 };
 
 void
@@ -21,3 +21,11 @@
 #define SYS_mkdir  20
 #define SYS_close  21
 #define SYS_arp 22
+#define SYS_ifstat 23
+#define SYS_pcapctl 24
+#define SYS_pcapread 25
+#define SYS_bpfattach 26
+#define SYS_pktgen 27
+#define SYS_reflect 28
+#define SYS_brctl 29
+#define SYS_hostopen 30
@@ -275,8 +275,18 @@ create(char *path, short type, short major, short minor)
       panic("create dots");
   }
 
-  if(dirlink(dp, name, ip->inum) < 0)
-    panic("create: dirlink");
+  if(dirlink(dp, name, ip->inum) < 0){
+    // No room in dp's hash bucket for name; free ip again.
+    if(type == T_DIR){
+      dp->nlink--;
+      iupdate(dp);
+    }
+    ip->nlink = 0;
+    iupdate(ip);
+    iunlockput(ip);
+    iunlockput(dp);
+    return 0;
+  }
 
   iunlockput(dp);
 
@@ -333,6 +343,34 @@ sys_open(void)
   return fd;
 }
 
+// Open a file in the host directory exported over virtio 9p, for
+// reading.
+int
+sys_hostopen(void)
+{
+  char *path;
+  int fd, fid;
+  struct file *f;
+
+  if(argstr(0, &path) < 0)
+    return -1;
+  if((fid = virt9p_open(path)) < 0)
+    return -1;
+  if((f = filealloc()) == 0 || (fd = fdalloc(f)) < 0){
+    if(f)
+      fileclose(f);
+    virt9p_close(fid);
+    return -1;
+  }
+
+  f->type = FD_HOST;
+  f->fid = fid;
+  f->off = 0;
+  f->readable = 1;
+  f->writable = 0;
+  return fd;
+}
+
 int
 sys_mkdir(void)
 {
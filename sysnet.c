@@ -0,0 +1,113 @@
+/**
+ *system calls to inspect and control the loaded NICs
+ */
+
+#include "types.h"
+#include "defs.h"
+#include "spinlock.h"
+#include "nic.h"
+#include "pcap.h"
+#include "bpf.h"
+#include "pktgen.h"
+#include "bridge.h"
+
+//int ifstat(int index, struct ifstat *st)
+int sys_ifstat(void) {
+  int index;
+  struct ifstat *st;
+
+  if(argint(0, &index) < 0 || argptr(1, (char**)&st, sizeof(*st)) < 0)
+    return -1;
+
+  return nic_getstat(index, st);
+}
+
+//int pcapctl(int cmd, struct pcapstat *st)
+int sys_pcapctl(void) {
+  int cmd;
+  struct pcapstat *st;
+
+  if(argint(0, &cmd) < 0 || argptr(1, (char**)&st, sizeof(*st)) < 0)
+    return -1;
+
+  return pcapctl(cmd, st);
+}
+
+//int pcapread(char *buf, int n)
+int sys_pcapread(void) {
+  char *buf;
+  int n;
+
+  if(argint(1, &n) < 0 || argptr(0, &buf, n) < 0)
+    return -1;
+
+  return pcapread(buf, n);
+}
+
+//int bpfattach(int target, struct bpf_insn *prog, int n)
+//target is an interface index or BPF_CAPTURE; n == 0 detaches.
+int sys_bpfattach(void) {
+  int target, n;
+  struct bpf_insn *prog;
+
+  if(argint(0, &target) < 0 || argint(2, &n) < 0 || n < 0 || n > BPF_MAXINSNS ||
+     argptr(1, (char**)&prog, n * sizeof(*prog)) < 0)
+    return -1;
+
+  if(target == BPF_CAPTURE)
+    return pcap_setfilter(prog, n);
+  if(target < 0 || target >= nnic)
+    return -1;
+  return bpf_attach(&nic_devices[target].filter, prog, n);
+}
+
+//int pktgen(struct pktgen_conf *conf, struct pktgen_result *result)
+int sys_pktgen(void) {
+  struct pktgen_conf *conf, c;
+  struct pktgen_result *result;
+
+  if(argptr(0, (char**)&conf, sizeof(*conf)) < 0 ||
+     argptr(1, (char**)&result, sizeof(*result)) < 0)
+    return -1;
+
+  c = *conf;
+  return pktgen_run(&c, result);
+}
+
+//int reflect(int index, int on)
+//send every frame interface index receives back to its sender.
+int sys_reflect(void) {
+  int index, on;
+
+  if(argint(0, &index) < 0 || argint(1, &on) < 0)
+    return -1;
+  if(index < 0 || index >= nnic)
+    return -1;
+
+  nic_devices[index].reflect = on != 0;
+  return 0;
+}
+
+//int brctl(int cmd, int arg, void *buf)
+//buf is only used by the commands that return something, see bridge.h.
+int sys_brctl(void) {
+  int cmd, arg, size;
+  char *buf;
+
+  if(argint(0, &cmd) < 0 || argint(1, &arg) < 0)
+    return -1;
+
+  buf = 0;
+  size = 0;
+  if(cmd == BR_STAT)
+    size = sizeof(struct brstat);
+  else if(cmd == BR_FDB){
+    if(arg < 0 || arg > BR_NFDB)
+      return -1;
+    size = arg * sizeof(struct brfdb);
+  }
+  if(size && argptr(2, &buf, size) < 0)
+    return -1;
+
+  return bridgectl(cmd, arg, buf);
+}
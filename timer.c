@@ -0,0 +1,41 @@
+// Time-stamp counter calibration against the 8253/8254 PIT.
+//
+// The TSC gives cheap, high resolution timestamps for the network
+// tracing code; tsckhz converts them to wall time.
+
+#include "types.h"
+#include "defs.h"
+#include "x86.h"
+
+#define PIT_CH2     0x42  // channel 2 data port
+#define PIT_MODE    0x43  // mode/command register
+#define PIT_GATE    0x61  // channel 2 gate and output
+#define PIT_HZ      1193182
+
+#define CALIBRATE_MS 10
+
+uint tsckhz;  // TSC ticks per millisecond
+
+// Count TSC ticks while PIT channel 2 counts down CALIBRATE_MS
+// milliseconds in one-shot mode.
+void
+tscinit(void)
+{
+  uint latch = PIT_HZ / (1000 / CALIBRATE_MS);
+  uint64_t t0, t1;
+
+  // Gate channel 2 on, keep the speaker off.
+  outb(PIT_GATE, (inb(PIT_GATE) & ~0x02) | 0x01);
+  outb(PIT_MODE, 0xb0);  // channel 2, lobyte/hibyte, mode 0
+  outb(PIT_CH2, latch & 0xff);
+  outb(PIT_CH2, latch >> 8);
+
+  t0 = rdtsc();
+  while((inb(PIT_GATE) & 0x20) == 0)  // OUT2 goes high at terminal count
+    ;
+  t1 = rdtsc();
+
+  tsckhz = (uint)(t1 - t0) / CALIBRATE_MS;
+  if(tsckhz == 0)
+    tsckhz = 1;
+}
@@ -71,10 +71,6 @@ trap(struct trapframe *tf)
     uartintr();
     lapiceoi();
     break;
-  case T_IRQ0 + 11:
-    cprintf("Got an interrupt from virtio device!\n");
-    lapiceoi();
-    break;
   case T_IRQ0 + 7:
   case T_IRQ0 + IRQ_SPURIOUS:
     cprintf("cpu%d: spurious interrupt at %x:%x\n",
@@ -84,6 +80,11 @@ trap(struct trapframe *tf)
 
   //PAGEBREAK: 13
   default:
+    // The PCI interrupt lines the virtio devices were given.
+    if(tf->trapno >= T_IRQ0 && virtiointr(tf->trapno - T_IRQ0)){
+      lapiceoi();
+      break;
+    }
     if(myproc() == 0 || (tf->cs&3) == 0){
       // In kernel, it must be our mistake.
       cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
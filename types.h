@@ -10,4 +10,4 @@ typedef unsigned long long uint64_t;
 typedef unsigned char uint8;
 typedef ushort uint16;
 typedef unsigned int  uint32;
-typedef unsigned long uint64;
+typedef unsigned long long uint64;
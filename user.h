@@ -2,6 +2,11 @@
 
 struct stat;
 struct rtcdate;
+struct ifstat;
+struct pcapstat;
+struct bpf_insn;
+struct pktgen_conf;
+struct pktgen_result;
 
 // system calls
 int fork(void);
@@ -26,6 +31,14 @@ char* sbrk(int);
 int sleep(int);
 int uptime(void);
 int arp(char*, char*, char*, int);
+int ifstat(int, struct ifstat*);
+int pcapctl(int, struct pcapstat*);
+int pcapread(char*, int);
+int bpfattach(int, struct bpf_insn*, int);
+int pktgen(struct pktgen_conf*, struct pktgen_result*);
+int reflect(int, int);
+int brctl(int, int, void*);
+int hostopen(char*);
 
 // ulib.c
 int stat(char*, struct stat*);
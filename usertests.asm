@@ -0,0 +1,8635 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <iputtest>:
+int stdout = 1;
+
+// does chdir() call iput(p->cwd) in a transaction?
+void
+iputtest(void)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 08             	sub    $0x8,%esp
+  printf(stdout, "iput test\n");
+       6:	a1 78 71 00 00       	mov    0x7178,%eax
+       b:	83 ec 08             	sub    $0x8,%esp
+       e:	68 82 4f 00 00       	push   $0x4f82
+      13:	50                   	push   %eax
+      14:	e8 78 4b 00 00       	call   4b91 <printf>
+      19:	83 c4 10             	add    $0x10,%esp
+
+  if(mkdir("iputdir") < 0){
+      1c:	83 ec 0c             	sub    $0xc,%esp
+      1f:	68 8d 4f 00 00       	push   $0x4f8d
+      24:	e8 14 4a 00 00       	call   4a3d <mkdir>
+      29:	83 c4 10             	add    $0x10,%esp
+      2c:	85 c0                	test   %eax,%eax
+      2e:	79 1b                	jns    4b <iputtest+0x4b>
+    printf(stdout, "mkdir failed\n");
+      30:	a1 78 71 00 00       	mov    0x7178,%eax
+      35:	83 ec 08             	sub    $0x8,%esp
+      38:	68 95 4f 00 00       	push   $0x4f95
+      3d:	50                   	push   %eax
+      3e:	e8 4e 4b 00 00       	call   4b91 <printf>
+      43:	83 c4 10             	add    $0x10,%esp
+    exit();
+      46:	e8 8a 49 00 00       	call   49d5 <exit>
+  }
+  if(chdir("iputdir") < 0){
+      4b:	83 ec 0c             	sub    $0xc,%esp
+      4e:	68 8d 4f 00 00       	push   $0x4f8d
+      53:	e8 ed 49 00 00       	call   4a45 <chdir>
+      58:	83 c4 10             	add    $0x10,%esp
+      5b:	85 c0                	test   %eax,%eax
+      5d:	79 1b                	jns    7a <iputtest+0x7a>
+    printf(stdout, "chdir iputdir failed\n");
+      5f:	a1 78 71 00 00       	mov    0x7178,%eax
+      64:	83 ec 08             	sub    $0x8,%esp
+      67:	68 a3 4f 00 00       	push   $0x4fa3
+      6c:	50                   	push   %eax
+      6d:	e8 1f 4b 00 00       	call   4b91 <printf>
+      72:	83 c4 10             	add    $0x10,%esp
+    exit();
+      75:	e8 5b 49 00 00       	call   49d5 <exit>
+  }
+  if(unlink("../iputdir") < 0){
+      7a:	83 ec 0c             	sub    $0xc,%esp
+      7d:	68 b9 4f 00 00       	push   $0x4fb9
+      82:	e8 9e 49 00 00       	call   4a25 <unlink>
+      87:	83 c4 10             	add    $0x10,%esp
+      8a:	85 c0                	test   %eax,%eax
+      8c:	79 1b                	jns    a9 <iputtest+0xa9>
+    printf(stdout, "unlink ../iputdir failed\n");
+      8e:	a1 78 71 00 00       	mov    0x7178,%eax
+      93:	83 ec 08             	sub    $0x8,%esp
+      96:	68 c4 4f 00 00       	push   $0x4fc4
+      9b:	50                   	push   %eax
+      9c:	e8 f0 4a 00 00       	call   4b91 <printf>
+      a1:	83 c4 10             	add    $0x10,%esp
+    exit();
+      a4:	e8 2c 49 00 00       	call   49d5 <exit>
+  }
+  if(chdir("/") < 0){
+      a9:	83 ec 0c             	sub    $0xc,%esp
+      ac:	68 de 4f 00 00       	push   $0x4fde
+      b1:	e8 8f 49 00 00       	call   4a45 <chdir>
+      b6:	83 c4 10             	add    $0x10,%esp
+      b9:	85 c0                	test   %eax,%eax
+      bb:	79 1b                	jns    d8 <iputtest+0xd8>
+    printf(stdout, "chdir / failed\n");
+      bd:	a1 78 71 00 00       	mov    0x7178,%eax
+      c2:	83 ec 08             	sub    $0x8,%esp
+      c5:	68 e0 4f 00 00       	push   $0x4fe0
+      ca:	50                   	push   %eax
+      cb:	e8 c1 4a 00 00       	call   4b91 <printf>
+      d0:	83 c4 10             	add    $0x10,%esp
+    exit();
+      d3:	e8 fd 48 00 00       	call   49d5 <exit>
+  }
+  printf(stdout, "iput test ok\n");
+      d8:	a1 78 71 00 00       	mov    0x7178,%eax
+      dd:	83 ec 08             	sub    $0x8,%esp
+      e0:	68 f0 4f 00 00       	push   $0x4ff0
+      e5:	50                   	push   %eax
+      e6:	e8 a6 4a 00 00       	call   4b91 <printf>
+      eb:	83 c4 10             	add    $0x10,%esp
+}
+      ee:	90                   	nop
+      ef:	c9                   	leave
+      f0:	c3                   	ret
+
+000000f1 <exitiputtest>:
+
+// does exit() call iput(p->cwd) in a transaction?
+void
+exitiputtest(void)
+{
+      f1:	55                   	push   %ebp
+      f2:	89 e5                	mov    %esp,%ebp
+      f4:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  printf(stdout, "exitiput test\n");
+      f7:	a1 78 71 00 00       	mov    0x7178,%eax
+      fc:	83 ec 08             	sub    $0x8,%esp
+      ff:	68 fe 4f 00 00       	push   $0x4ffe
+     104:	50                   	push   %eax
+     105:	e8 87 4a 00 00       	call   4b91 <printf>
+     10a:	83 c4 10             	add    $0x10,%esp
+
+  pid = fork();
+     10d:	e8 bb 48 00 00       	call   49cd <fork>
+     112:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(pid < 0){
+     115:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     119:	79 1b                	jns    136 <exitiputtest+0x45>
+    printf(stdout, "fork failed\n");
+     11b:	a1 78 71 00 00       	mov    0x7178,%eax
+     120:	83 ec 08             	sub    $0x8,%esp
+     123:	68 0d 50 00 00       	push   $0x500d
+     128:	50                   	push   %eax
+     129:	e8 63 4a 00 00       	call   4b91 <printf>
+     12e:	83 c4 10             	add    $0x10,%esp
+    exit();
+     131:	e8 9f 48 00 00       	call   49d5 <exit>
+  }
+  if(pid == 0){
+     136:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     13a:	0f 85 92 00 00 00    	jne    1d2 <exitiputtest+0xe1>
+    if(mkdir("iputdir") < 0){
+     140:	83 ec 0c             	sub    $0xc,%esp
+     143:	68 8d 4f 00 00       	push   $0x4f8d
+     148:	e8 f0 48 00 00       	call   4a3d <mkdir>
+     14d:	83 c4 10             	add    $0x10,%esp
+     150:	85 c0                	test   %eax,%eax
+     152:	79 1b                	jns    16f <exitiputtest+0x7e>
+      printf(stdout, "mkdir failed\n");
+     154:	a1 78 71 00 00       	mov    0x7178,%eax
+     159:	83 ec 08             	sub    $0x8,%esp
+     15c:	68 95 4f 00 00       	push   $0x4f95
+     161:	50                   	push   %eax
+     162:	e8 2a 4a 00 00       	call   4b91 <printf>
+     167:	83 c4 10             	add    $0x10,%esp
+      exit();
+     16a:	e8 66 48 00 00       	call   49d5 <exit>
+    }
+    if(chdir("iputdir") < 0){
+     16f:	83 ec 0c             	sub    $0xc,%esp
+     172:	68 8d 4f 00 00       	push   $0x4f8d
+     177:	e8 c9 48 00 00       	call   4a45 <chdir>
+     17c:	83 c4 10             	add    $0x10,%esp
+     17f:	85 c0                	test   %eax,%eax
+     181:	79 1b                	jns    19e <exitiputtest+0xad>
+      printf(stdout, "child chdir failed\n");
+     183:	a1 78 71 00 00       	mov    0x7178,%eax
+     188:	83 ec 08             	sub    $0x8,%esp
+     18b:	68 1a 50 00 00       	push   $0x501a
+     190:	50                   	push   %eax
+     191:	e8 fb 49 00 00       	call   4b91 <printf>
+     196:	83 c4 10             	add    $0x10,%esp
+      exit();
+     199:	e8 37 48 00 00       	call   49d5 <exit>
+    }
+    if(unlink("../iputdir") < 0){
+     19e:	83 ec 0c             	sub    $0xc,%esp
+     1a1:	68 b9 4f 00 00       	push   $0x4fb9
+     1a6:	e8 7a 48 00 00       	call   4a25 <unlink>
+     1ab:	83 c4 10             	add    $0x10,%esp
+     1ae:	85 c0                	test   %eax,%eax
+     1b0:	79 1b                	jns    1cd <exitiputtest+0xdc>
+      printf(stdout, "unlink ../iputdir failed\n");
+     1b2:	a1 78 71 00 00       	mov    0x7178,%eax
+     1b7:	83 ec 08             	sub    $0x8,%esp
+     1ba:	68 c4 4f 00 00       	push   $0x4fc4
+     1bf:	50                   	push   %eax
+     1c0:	e8 cc 49 00 00       	call   4b91 <printf>
+     1c5:	83 c4 10             	add    $0x10,%esp
+      exit();
+     1c8:	e8 08 48 00 00       	call   49d5 <exit>
+    }
+    exit();
+     1cd:	e8 03 48 00 00       	call   49d5 <exit>
+  }
+  wait();
+     1d2:	e8 06 48 00 00       	call   49dd <wait>
+  printf(stdout, "exitiput test ok\n");
+     1d7:	a1 78 71 00 00       	mov    0x7178,%eax
+     1dc:	83 ec 08             	sub    $0x8,%esp
+     1df:	68 2e 50 00 00       	push   $0x502e
+     1e4:	50                   	push   %eax
+     1e5:	e8 a7 49 00 00       	call   4b91 <printf>
+     1ea:	83 c4 10             	add    $0x10,%esp
+}
+     1ed:	90                   	nop
+     1ee:	c9                   	leave
+     1ef:	c3                   	ret
+
+000001f0 <openiputtest>:
+//      for(i = 0; i < 10000; i++)
+//        yield();
+//    }
+void
+openiputtest(void)
+{
+     1f0:	55                   	push   %ebp
+     1f1:	89 e5                	mov    %esp,%ebp
+     1f3:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  printf(stdout, "openiput test\n");
+     1f6:	a1 78 71 00 00       	mov    0x7178,%eax
+     1fb:	83 ec 08             	sub    $0x8,%esp
+     1fe:	68 40 50 00 00       	push   $0x5040
+     203:	50                   	push   %eax
+     204:	e8 88 49 00 00       	call   4b91 <printf>
+     209:	83 c4 10             	add    $0x10,%esp
+  if(mkdir("oidir") < 0){
+     20c:	83 ec 0c             	sub    $0xc,%esp
+     20f:	68 4f 50 00 00       	push   $0x504f
+     214:	e8 24 48 00 00       	call   4a3d <mkdir>
+     219:	83 c4 10             	add    $0x10,%esp
+     21c:	85 c0                	test   %eax,%eax
+     21e:	79 1b                	jns    23b <openiputtest+0x4b>
+    printf(stdout, "mkdir oidir failed\n");
+     220:	a1 78 71 00 00       	mov    0x7178,%eax
+     225:	83 ec 08             	sub    $0x8,%esp
+     228:	68 55 50 00 00       	push   $0x5055
+     22d:	50                   	push   %eax
+     22e:	e8 5e 49 00 00       	call   4b91 <printf>
+     233:	83 c4 10             	add    $0x10,%esp
+    exit();
+     236:	e8 9a 47 00 00       	call   49d5 <exit>
+  }
+  pid = fork();
+     23b:	e8 8d 47 00 00       	call   49cd <fork>
+     240:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(pid < 0){
+     243:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     247:	79 1b                	jns    264 <openiputtest+0x74>
+    printf(stdout, "fork failed\n");
+     249:	a1 78 71 00 00       	mov    0x7178,%eax
+     24e:	83 ec 08             	sub    $0x8,%esp
+     251:	68 0d 50 00 00       	push   $0x500d
+     256:	50                   	push   %eax
+     257:	e8 35 49 00 00       	call   4b91 <printf>
+     25c:	83 c4 10             	add    $0x10,%esp
+    exit();
+     25f:	e8 71 47 00 00       	call   49d5 <exit>
+  }
+  if(pid == 0){
+     264:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     268:	75 3b                	jne    2a5 <openiputtest+0xb5>
+    int fd = open("oidir", O_RDWR);
+     26a:	83 ec 08             	sub    $0x8,%esp
+     26d:	6a 02                	push   $0x2
+     26f:	68 4f 50 00 00       	push   $0x504f
+     274:	e8 9c 47 00 00       	call   4a15 <open>
+     279:	83 c4 10             	add    $0x10,%esp
+     27c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(fd >= 0){
+     27f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     283:	78 1b                	js     2a0 <openiputtest+0xb0>
+      printf(stdout, "open directory for write succeeded\n");
+     285:	a1 78 71 00 00       	mov    0x7178,%eax
+     28a:	83 ec 08             	sub    $0x8,%esp
+     28d:	68 6c 50 00 00       	push   $0x506c
+     292:	50                   	push   %eax
+     293:	e8 f9 48 00 00       	call   4b91 <printf>
+     298:	83 c4 10             	add    $0x10,%esp
+      exit();
+     29b:	e8 35 47 00 00       	call   49d5 <exit>
+    }
+    exit();
+     2a0:	e8 30 47 00 00       	call   49d5 <exit>
+  }
+  sleep(1);
+     2a5:	83 ec 0c             	sub    $0xc,%esp
+     2a8:	6a 01                	push   $0x1
+     2aa:	e8 b6 47 00 00       	call   4a65 <sleep>
+     2af:	83 c4 10             	add    $0x10,%esp
+  if(unlink("oidir") != 0){
+     2b2:	83 ec 0c             	sub    $0xc,%esp
+     2b5:	68 4f 50 00 00       	push   $0x504f
+     2ba:	e8 66 47 00 00       	call   4a25 <unlink>
+     2bf:	83 c4 10             	add    $0x10,%esp
+     2c2:	85 c0                	test   %eax,%eax
+     2c4:	74 1b                	je     2e1 <openiputtest+0xf1>
+    printf(stdout, "unlink failed\n");
+     2c6:	a1 78 71 00 00       	mov    0x7178,%eax
+     2cb:	83 ec 08             	sub    $0x8,%esp
+     2ce:	68 90 50 00 00       	push   $0x5090
+     2d3:	50                   	push   %eax
+     2d4:	e8 b8 48 00 00       	call   4b91 <printf>
+     2d9:	83 c4 10             	add    $0x10,%esp
+    exit();
+     2dc:	e8 f4 46 00 00       	call   49d5 <exit>
+  }
+  wait();
+     2e1:	e8 f7 46 00 00       	call   49dd <wait>
+  printf(stdout, "openiput test ok\n");
+     2e6:	a1 78 71 00 00       	mov    0x7178,%eax
+     2eb:	83 ec 08             	sub    $0x8,%esp
+     2ee:	68 9f 50 00 00       	push   $0x509f
+     2f3:	50                   	push   %eax
+     2f4:	e8 98 48 00 00       	call   4b91 <printf>
+     2f9:	83 c4 10             	add    $0x10,%esp
+}
+     2fc:	90                   	nop
+     2fd:	c9                   	leave
+     2fe:	c3                   	ret
+
+000002ff <opentest>:
+
+// simple file system tests
+
+void
+opentest(void)
+{
+     2ff:	55                   	push   %ebp
+     300:	89 e5                	mov    %esp,%ebp
+     302:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  printf(stdout, "open test\n");
+     305:	a1 78 71 00 00       	mov    0x7178,%eax
+     30a:	83 ec 08             	sub    $0x8,%esp
+     30d:	68 b1 50 00 00       	push   $0x50b1
+     312:	50                   	push   %eax
+     313:	e8 79 48 00 00       	call   4b91 <printf>
+     318:	83 c4 10             	add    $0x10,%esp
+  fd = open("echo", 0);
+     31b:	83 ec 08             	sub    $0x8,%esp
+     31e:	6a 00                	push   $0x0
+     320:	68 6c 4f 00 00       	push   $0x4f6c
+     325:	e8 eb 46 00 00       	call   4a15 <open>
+     32a:	83 c4 10             	add    $0x10,%esp
+     32d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+     330:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     334:	79 1b                	jns    351 <opentest+0x52>
+    printf(stdout, "open echo failed!\n");
+     336:	a1 78 71 00 00       	mov    0x7178,%eax
+     33b:	83 ec 08             	sub    $0x8,%esp
+     33e:	68 bc 50 00 00       	push   $0x50bc
+     343:	50                   	push   %eax
+     344:	e8 48 48 00 00       	call   4b91 <printf>
+     349:	83 c4 10             	add    $0x10,%esp
+    exit();
+     34c:	e8 84 46 00 00       	call   49d5 <exit>
+  }
+  close(fd);
+     351:	83 ec 0c             	sub    $0xc,%esp
+     354:	ff 75 f4             	push   -0xc(%ebp)
+     357:	e8 a1 46 00 00       	call   49fd <close>
+     35c:	83 c4 10             	add    $0x10,%esp
+  fd = open("doesnotexist", 0);
+     35f:	83 ec 08             	sub    $0x8,%esp
+     362:	6a 00                	push   $0x0
+     364:	68 cf 50 00 00       	push   $0x50cf
+     369:	e8 a7 46 00 00       	call   4a15 <open>
+     36e:	83 c4 10             	add    $0x10,%esp
+     371:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd >= 0){
+     374:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     378:	78 1b                	js     395 <opentest+0x96>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     37a:	a1 78 71 00 00       	mov    0x7178,%eax
+     37f:	83 ec 08             	sub    $0x8,%esp
+     382:	68 dc 50 00 00       	push   $0x50dc
+     387:	50                   	push   %eax
+     388:	e8 04 48 00 00       	call   4b91 <printf>
+     38d:	83 c4 10             	add    $0x10,%esp
+    exit();
+     390:	e8 40 46 00 00       	call   49d5 <exit>
+  }
+  printf(stdout, "open test ok\n");
+     395:	a1 78 71 00 00       	mov    0x7178,%eax
+     39a:	83 ec 08             	sub    $0x8,%esp
+     39d:	68 fa 50 00 00       	push   $0x50fa
+     3a2:	50                   	push   %eax
+     3a3:	e8 e9 47 00 00       	call   4b91 <printf>
+     3a8:	83 c4 10             	add    $0x10,%esp
+}
+     3ab:	90                   	nop
+     3ac:	c9                   	leave
+     3ad:	c3                   	ret
+
+000003ae <writetest>:
+
+void
+writetest(void)
+{
+     3ae:	55                   	push   %ebp
+     3af:	89 e5                	mov    %esp,%ebp
+     3b1:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int i;
+
+  printf(stdout, "small file test\n");
+     3b4:	a1 78 71 00 00       	mov    0x7178,%eax
+     3b9:	83 ec 08             	sub    $0x8,%esp
+     3bc:	68 08 51 00 00       	push   $0x5108
+     3c1:	50                   	push   %eax
+     3c2:	e8 ca 47 00 00       	call   4b91 <printf>
+     3c7:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_CREATE|O_RDWR);
+     3ca:	83 ec 08             	sub    $0x8,%esp
+     3cd:	68 02 02 00 00       	push   $0x202
+     3d2:	68 19 51 00 00       	push   $0x5119
+     3d7:	e8 39 46 00 00       	call   4a15 <open>
+     3dc:	83 c4 10             	add    $0x10,%esp
+     3df:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(fd >= 0){
+     3e2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     3e6:	78 22                	js     40a <writetest+0x5c>
+    printf(stdout, "creat small succeeded; ok\n");
+     3e8:	a1 78 71 00 00       	mov    0x7178,%eax
+     3ed:	83 ec 08             	sub    $0x8,%esp
+     3f0:	68 1f 51 00 00       	push   $0x511f
+     3f5:	50                   	push   %eax
+     3f6:	e8 96 47 00 00       	call   4b91 <printf>
+     3fb:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(stdout, "error: creat small failed!\n");
+    exit();
+  }
+  for(i = 0; i < 100; i++){
+     3fe:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     405:	e9 8f 00 00 00       	jmp    499 <writetest+0xeb>
+    printf(stdout, "error: creat small failed!\n");
+     40a:	a1 78 71 00 00       	mov    0x7178,%eax
+     40f:	83 ec 08             	sub    $0x8,%esp
+     412:	68 3a 51 00 00       	push   $0x513a
+     417:	50                   	push   %eax
+     418:	e8 74 47 00 00       	call   4b91 <printf>
+     41d:	83 c4 10             	add    $0x10,%esp
+    exit();
+     420:	e8 b0 45 00 00       	call   49d5 <exit>
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     425:	83 ec 04             	sub    $0x4,%esp
+     428:	6a 0a                	push   $0xa
+     42a:	68 56 51 00 00       	push   $0x5156
+     42f:	ff 75 f0             	push   -0x10(%ebp)
+     432:	e8 be 45 00 00       	call   49f5 <write>
+     437:	83 c4 10             	add    $0x10,%esp
+     43a:	83 f8 0a             	cmp    $0xa,%eax
+     43d:	74 1e                	je     45d <writetest+0xaf>
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     43f:	a1 78 71 00 00       	mov    0x7178,%eax
+     444:	83 ec 04             	sub    $0x4,%esp
+     447:	ff 75 f4             	push   -0xc(%ebp)
+     44a:	68 64 51 00 00       	push   $0x5164
+     44f:	50                   	push   %eax
+     450:	e8 3c 47 00 00       	call   4b91 <printf>
+     455:	83 c4 10             	add    $0x10,%esp
+      exit();
+     458:	e8 78 45 00 00       	call   49d5 <exit>
+    }
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     45d:	83 ec 04             	sub    $0x4,%esp
+     460:	6a 0a                	push   $0xa
+     462:	68 88 51 00 00       	push   $0x5188
+     467:	ff 75 f0             	push   -0x10(%ebp)
+     46a:	e8 86 45 00 00       	call   49f5 <write>
+     46f:	83 c4 10             	add    $0x10,%esp
+     472:	83 f8 0a             	cmp    $0xa,%eax
+     475:	74 1e                	je     495 <writetest+0xe7>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     477:	a1 78 71 00 00       	mov    0x7178,%eax
+     47c:	83 ec 04             	sub    $0x4,%esp
+     47f:	ff 75 f4             	push   -0xc(%ebp)
+     482:	68 94 51 00 00       	push   $0x5194
+     487:	50                   	push   %eax
+     488:	e8 04 47 00 00       	call   4b91 <printf>
+     48d:	83 c4 10             	add    $0x10,%esp
+      exit();
+     490:	e8 40 45 00 00       	call   49d5 <exit>
+  for(i = 0; i < 100; i++){
+     495:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     499:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+     49d:	7e 86                	jle    425 <writetest+0x77>
+    }
+  }
+  printf(stdout, "writes ok\n");
+     49f:	a1 78 71 00 00       	mov    0x7178,%eax
+     4a4:	83 ec 08             	sub    $0x8,%esp
+     4a7:	68 b8 51 00 00       	push   $0x51b8
+     4ac:	50                   	push   %eax
+     4ad:	e8 df 46 00 00       	call   4b91 <printf>
+     4b2:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+     4b5:	83 ec 0c             	sub    $0xc,%esp
+     4b8:	ff 75 f0             	push   -0x10(%ebp)
+     4bb:	e8 3d 45 00 00       	call   49fd <close>
+     4c0:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+     4c3:	83 ec 08             	sub    $0x8,%esp
+     4c6:	6a 00                	push   $0x0
+     4c8:	68 19 51 00 00       	push   $0x5119
+     4cd:	e8 43 45 00 00       	call   4a15 <open>
+     4d2:	83 c4 10             	add    $0x10,%esp
+     4d5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(fd >= 0){
+     4d8:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     4dc:	78 3c                	js     51a <writetest+0x16c>
+    printf(stdout, "open small succeeded ok\n");
+     4de:	a1 78 71 00 00       	mov    0x7178,%eax
+     4e3:	83 ec 08             	sub    $0x8,%esp
+     4e6:	68 c3 51 00 00       	push   $0x51c3
+     4eb:	50                   	push   %eax
+     4ec:	e8 a0 46 00 00       	call   4b91 <printf>
+     4f1:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(stdout, "error: open small failed!\n");
+    exit();
+  }
+  i = read(fd, buf, 2000);
+     4f4:	83 ec 04             	sub    $0x4,%esp
+     4f7:	68 d0 07 00 00       	push   $0x7d0
+     4fc:	68 60 9d 01 00       	push   $0x19d60
+     501:	ff 75 f0             	push   -0x10(%ebp)
+     504:	e8 e4 44 00 00       	call   49ed <read>
+     509:	83 c4 10             	add    $0x10,%esp
+     50c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(i == 2000){
+     50f:	81 7d f4 d0 07 00 00 	cmpl   $0x7d0,-0xc(%ebp)
+     516:	75 57                	jne    56f <writetest+0x1c1>
+     518:	eb 1b                	jmp    535 <writetest+0x187>
+    printf(stdout, "error: open small failed!\n");
+     51a:	a1 78 71 00 00       	mov    0x7178,%eax
+     51f:	83 ec 08             	sub    $0x8,%esp
+     522:	68 dc 51 00 00       	push   $0x51dc
+     527:	50                   	push   %eax
+     528:	e8 64 46 00 00       	call   4b91 <printf>
+     52d:	83 c4 10             	add    $0x10,%esp
+    exit();
+     530:	e8 a0 44 00 00       	call   49d5 <exit>
+    printf(stdout, "read succeeded ok\n");
+     535:	a1 78 71 00 00       	mov    0x7178,%eax
+     53a:	83 ec 08             	sub    $0x8,%esp
+     53d:	68 f7 51 00 00       	push   $0x51f7
+     542:	50                   	push   %eax
+     543:	e8 49 46 00 00       	call   4b91 <printf>
+     548:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(stdout, "read failed\n");
+    exit();
+  }
+  close(fd);
+     54b:	83 ec 0c             	sub    $0xc,%esp
+     54e:	ff 75 f0             	push   -0x10(%ebp)
+     551:	e8 a7 44 00 00       	call   49fd <close>
+     556:	83 c4 10             	add    $0x10,%esp
+
+  if(unlink("small") < 0){
+     559:	83 ec 0c             	sub    $0xc,%esp
+     55c:	68 19 51 00 00       	push   $0x5119
+     561:	e8 bf 44 00 00       	call   4a25 <unlink>
+     566:	83 c4 10             	add    $0x10,%esp
+     569:	85 c0                	test   %eax,%eax
+     56b:	79 38                	jns    5a5 <writetest+0x1f7>
+     56d:	eb 1b                	jmp    58a <writetest+0x1dc>
+    printf(stdout, "read failed\n");
+     56f:	a1 78 71 00 00       	mov    0x7178,%eax
+     574:	83 ec 08             	sub    $0x8,%esp
+     577:	68 0a 52 00 00       	push   $0x520a
+     57c:	50                   	push   %eax
+     57d:	e8 0f 46 00 00       	call   4b91 <printf>
+     582:	83 c4 10             	add    $0x10,%esp
+    exit();
+     585:	e8 4b 44 00 00       	call   49d5 <exit>
+    printf(stdout, "unlink small failed\n");
+     58a:	a1 78 71 00 00       	mov    0x7178,%eax
+     58f:	83 ec 08             	sub    $0x8,%esp
+     592:	68 17 52 00 00       	push   $0x5217
+     597:	50                   	push   %eax
+     598:	e8 f4 45 00 00       	call   4b91 <printf>
+     59d:	83 c4 10             	add    $0x10,%esp
+    exit();
+     5a0:	e8 30 44 00 00       	call   49d5 <exit>
+  }
+  printf(stdout, "small file test ok\n");
+     5a5:	a1 78 71 00 00       	mov    0x7178,%eax
+     5aa:	83 ec 08             	sub    $0x8,%esp
+     5ad:	68 2c 52 00 00       	push   $0x522c
+     5b2:	50                   	push   %eax
+     5b3:	e8 d9 45 00 00       	call   4b91 <printf>
+     5b8:	83 c4 10             	add    $0x10,%esp
+}
+     5bb:	90                   	nop
+     5bc:	c9                   	leave
+     5bd:	c3                   	ret
+
+000005be <writetest1>:
+
+char bigbuf[BIGBUF];
+
+void
+writetest1(void)
+{
+     5be:	55                   	push   %ebp
+     5bf:	89 e5                	mov    %esp,%ebp
+     5c1:	83 ec 28             	sub    $0x28,%esp
+  char *names[] = { "big0", "big1" };
+     5c4:	c7 45 dc 40 52 00 00 	movl   $0x5240,-0x24(%ebp)
+     5cb:	c7 45 e0 45 52 00 00 	movl   $0x5245,-0x20(%ebp)
+  int i, j, fd, n, pi;
+
+  printf(stdout, "big files test\n");
+     5d2:	a1 78 71 00 00       	mov    0x7178,%eax
+     5d7:	83 ec 08             	sub    $0x8,%esp
+     5da:	68 4a 52 00 00       	push   $0x524a
+     5df:	50                   	push   %eax
+     5e0:	e8 ac 45 00 00       	call   4b91 <printf>
+     5e5:	83 c4 10             	add    $0x10,%esp
+
+  for(pi = 0; pi < 2; pi++){
+     5e8:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+     5ef:	e9 e5 00 00 00       	jmp    6d9 <writetest1+0x11b>
+    if(fork() != 0)
+     5f4:	e8 d4 43 00 00       	call   49cd <fork>
+     5f9:	85 c0                	test   %eax,%eax
+     5fb:	0f 85 d3 00 00 00    	jne    6d4 <writetest1+0x116>
+      continue;
+    fd = open(names[pi], O_CREATE|O_RDWR);
+     601:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     604:	8b 44 85 dc          	mov    -0x24(%ebp,%eax,4),%eax
+     608:	83 ec 08             	sub    $0x8,%esp
+     60b:	68 02 02 00 00       	push   $0x202
+     610:	50                   	push   %eax
+     611:	e8 ff 43 00 00       	call   4a15 <open>
+     616:	83 c4 10             	add    $0x10,%esp
+     619:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(fd < 0){
+     61c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+     620:	79 23                	jns    645 <writetest1+0x87>
+      printf(stdout, "error: creat %s failed!\n", names[pi]);
+     622:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     625:	8b 54 85 dc          	mov    -0x24(%ebp,%eax,4),%edx
+     629:	a1 78 71 00 00       	mov    0x7178,%eax
+     62e:	83 ec 04             	sub    $0x4,%esp
+     631:	52                   	push   %edx
+     632:	68 5a 52 00 00       	push   $0x525a
+     637:	50                   	push   %eax
+     638:	e8 54 45 00 00       	call   4b91 <printf>
+     63d:	83 c4 10             	add    $0x10,%esp
+      exit();
+     640:	e8 90 43 00 00       	call   49d5 <exit>
+    }
+    for(i = 0; i < BIGWRITES; i += BIGBUF / 512){
+     645:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     64c:	eb 69                	jmp    6b7 <writetest1+0xf9>
+      for(j = 0; j < BIGBUF / 512; j++)
+     64e:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     655:	eb 19                	jmp    670 <writetest1+0xb2>
+        ((int*)(bigbuf + j*512))[0] = i + j;
+     657:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     65a:	c1 e0 09             	shl    $0x9,%eax
+     65d:	05 60 9d 00 00       	add    $0x9d60,%eax
+     662:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+     665:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     668:	01 ca                	add    %ecx,%edx
+     66a:	89 10                	mov    %edx,(%eax)
+      for(j = 0; j < BIGBUF / 512; j++)
+     66c:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     670:	83 7d f0 7f          	cmpl   $0x7f,-0x10(%ebp)
+     674:	7e e1                	jle    657 <writetest1+0x99>
+      if(write(fd, bigbuf, BIGBUF) != BIGBUF){
+     676:	83 ec 04             	sub    $0x4,%esp
+     679:	68 00 00 01 00       	push   $0x10000
+     67e:	68 60 9d 00 00       	push   $0x9d60
+     683:	ff 75 e4             	push   -0x1c(%ebp)
+     686:	e8 6a 43 00 00       	call   49f5 <write>
+     68b:	83 c4 10             	add    $0x10,%esp
+     68e:	3d 00 00 01 00       	cmp    $0x10000,%eax
+     693:	74 1e                	je     6b3 <writetest1+0xf5>
+        printf(stdout, "error: write big file failed\n", i);
+     695:	a1 78 71 00 00       	mov    0x7178,%eax
+     69a:	83 ec 04             	sub    $0x4,%esp
+     69d:	ff 75 f4             	push   -0xc(%ebp)
+     6a0:	68 73 52 00 00       	push   $0x5273
+     6a5:	50                   	push   %eax
+     6a6:	e8 e6 44 00 00       	call   4b91 <printf>
+     6ab:	83 c4 10             	add    $0x10,%esp
+        exit();
+     6ae:	e8 22 43 00 00       	call   49d5 <exit>
+    for(i = 0; i < BIGWRITES; i += BIGBUF / 512){
+     6b3:	83 6d f4 80          	subl   $0xffffff80,-0xc(%ebp)
+     6b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     6ba:	3d ff 20 00 00       	cmp    $0x20ff,%eax
+     6bf:	76 8d                	jbe    64e <writetest1+0x90>
+      }
+    }
+    close(fd);
+     6c1:	83 ec 0c             	sub    $0xc,%esp
+     6c4:	ff 75 e4             	push   -0x1c(%ebp)
+     6c7:	e8 31 43 00 00       	call   49fd <close>
+     6cc:	83 c4 10             	add    $0x10,%esp
+    exit();
+     6cf:	e8 01 43 00 00       	call   49d5 <exit>
+      continue;
+     6d4:	90                   	nop
+  for(pi = 0; pi < 2; pi++){
+     6d5:	83 45 e8 01          	addl   $0x1,-0x18(%ebp)
+     6d9:	83 7d e8 01          	cmpl   $0x1,-0x18(%ebp)
+     6dd:	0f 8e 11 ff ff ff    	jle    5f4 <writetest1+0x36>
+  }
+  wait();
+     6e3:	e8 f5 42 00 00       	call   49dd <wait>
+  wait();
+     6e8:	e8 f0 42 00 00       	call   49dd <wait>
+
+  for(pi = 0; pi < 2; pi++){
+     6ed:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+     6f4:	e9 34 01 00 00       	jmp    82d <writetest1+0x26f>
+    fd = open(names[pi], O_RDONLY);
+     6f9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     6fc:	8b 44 85 dc          	mov    -0x24(%ebp,%eax,4),%eax
+     700:	83 ec 08             	sub    $0x8,%esp
+     703:	6a 00                	push   $0x0
+     705:	50                   	push   %eax
+     706:	e8 0a 43 00 00       	call   4a15 <open>
+     70b:	83 c4 10             	add    $0x10,%esp
+     70e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(fd < 0){
+     711:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+     715:	79 23                	jns    73a <writetest1+0x17c>
+      printf(stdout, "error: open %s failed!\n", names[pi]);
+     717:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     71a:	8b 54 85 dc          	mov    -0x24(%ebp,%eax,4),%edx
+     71e:	a1 78 71 00 00       	mov    0x7178,%eax
+     723:	83 ec 04             	sub    $0x4,%esp
+     726:	52                   	push   %edx
+     727:	68 91 52 00 00       	push   $0x5291
+     72c:	50                   	push   %eax
+     72d:	e8 5f 44 00 00       	call   4b91 <printf>
+     732:	83 c4 10             	add    $0x10,%esp
+      exit();
+     735:	e8 9b 42 00 00       	call   49d5 <exit>
+    }
+
+    n = 0;
+     73a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    for(;;){
+      i = read(fd, buf, 512);
+     741:	83 ec 04             	sub    $0x4,%esp
+     744:	68 00 02 00 00       	push   $0x200
+     749:	68 60 9d 01 00       	push   $0x19d60
+     74e:	ff 75 e4             	push   -0x1c(%ebp)
+     751:	e8 97 42 00 00       	call   49ed <read>
+     756:	83 c4 10             	add    $0x10,%esp
+     759:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      if(i == 0){
+     75c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     760:	75 27                	jne    789 <writetest1+0x1cb>
+        if(n != BIGWRITES){
+     762:	81 7d ec 00 21 00 00 	cmpl   $0x2100,-0x14(%ebp)
+     769:	74 7d                	je     7e8 <writetest1+0x22a>
+          printf(stdout, "read only %d blocks from big", n);
+     76b:	a1 78 71 00 00       	mov    0x7178,%eax
+     770:	83 ec 04             	sub    $0x4,%esp
+     773:	ff 75 ec             	push   -0x14(%ebp)
+     776:	68 a9 52 00 00       	push   $0x52a9
+     77b:	50                   	push   %eax
+     77c:	e8 10 44 00 00       	call   4b91 <printf>
+     781:	83 c4 10             	add    $0x10,%esp
+          exit();
+     784:	e8 4c 42 00 00       	call   49d5 <exit>
+        }
+        break;
+      } else if(i != 512){
+     789:	81 7d f4 00 02 00 00 	cmpl   $0x200,-0xc(%ebp)
+     790:	74 1e                	je     7b0 <writetest1+0x1f2>
+        printf(stdout, "read failed %d\n", i);
+     792:	a1 78 71 00 00       	mov    0x7178,%eax
+     797:	83 ec 04             	sub    $0x4,%esp
+     79a:	ff 75 f4             	push   -0xc(%ebp)
+     79d:	68 c6 52 00 00       	push   $0x52c6
+     7a2:	50                   	push   %eax
+     7a3:	e8 e9 43 00 00       	call   4b91 <printf>
+     7a8:	83 c4 10             	add    $0x10,%esp
+        exit();
+     7ab:	e8 25 42 00 00       	call   49d5 <exit>
+      }
+      if(((int*)buf)[0] != n){
+     7b0:	b8 60 9d 01 00       	mov    $0x19d60,%eax
+     7b5:	8b 00                	mov    (%eax),%eax
+     7b7:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+     7ba:	74 23                	je     7df <writetest1+0x221>
+        printf(stdout, "read content of block %d is %d\n",
+               n, ((int*)buf)[0]);
+     7bc:	b8 60 9d 01 00       	mov    $0x19d60,%eax
+        printf(stdout, "read content of block %d is %d\n",
+     7c1:	8b 10                	mov    (%eax),%edx
+     7c3:	a1 78 71 00 00       	mov    0x7178,%eax
+     7c8:	52                   	push   %edx
+     7c9:	ff 75 ec             	push   -0x14(%ebp)
+     7cc:	68 d8 52 00 00       	push   $0x52d8
+     7d1:	50                   	push   %eax
+     7d2:	e8 ba 43 00 00       	call   4b91 <printf>
+     7d7:	83 c4 10             	add    $0x10,%esp
+        exit();
+     7da:	e8 f6 41 00 00       	call   49d5 <exit>
+      }
+      n++;
+     7df:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+      i = read(fd, buf, 512);
+     7e3:	e9 59 ff ff ff       	jmp    741 <writetest1+0x183>
+        break;
+     7e8:	90                   	nop
+    }
+    close(fd);
+     7e9:	83 ec 0c             	sub    $0xc,%esp
+     7ec:	ff 75 e4             	push   -0x1c(%ebp)
+     7ef:	e8 09 42 00 00       	call   49fd <close>
+     7f4:	83 c4 10             	add    $0x10,%esp
+    if(unlink(names[pi]) < 0){
+     7f7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     7fa:	8b 44 85 dc          	mov    -0x24(%ebp,%eax,4),%eax
+     7fe:	83 ec 0c             	sub    $0xc,%esp
+     801:	50                   	push   %eax
+     802:	e8 1e 42 00 00       	call   4a25 <unlink>
+     807:	83 c4 10             	add    $0x10,%esp
+     80a:	85 c0                	test   %eax,%eax
+     80c:	79 1b                	jns    829 <writetest1+0x26b>
+      printf(stdout, "unlink big failed\n");
+     80e:	a1 78 71 00 00       	mov    0x7178,%eax
+     813:	83 ec 08             	sub    $0x8,%esp
+     816:	68 f8 52 00 00       	push   $0x52f8
+     81b:	50                   	push   %eax
+     81c:	e8 70 43 00 00       	call   4b91 <printf>
+     821:	83 c4 10             	add    $0x10,%esp
+      exit();
+     824:	e8 ac 41 00 00       	call   49d5 <exit>
+  for(pi = 0; pi < 2; pi++){
+     829:	83 45 e8 01          	addl   $0x1,-0x18(%ebp)
+     82d:	83 7d e8 01          	cmpl   $0x1,-0x18(%ebp)
+     831:	0f 8e c2 fe ff ff    	jle    6f9 <writetest1+0x13b>
+    }
+  }
+  printf(stdout, "big files ok\n");
+     837:	a1 78 71 00 00       	mov    0x7178,%eax
+     83c:	83 ec 08             	sub    $0x8,%esp
+     83f:	68 0b 53 00 00       	push   $0x530b
+     844:	50                   	push   %eax
+     845:	e8 47 43 00 00       	call   4b91 <printf>
+     84a:	83 c4 10             	add    $0x10,%esp
+}
+     84d:	90                   	nop
+     84e:	c9                   	leave
+     84f:	c3                   	ret
+
+00000850 <createtest>:
+
+void
+createtest(void)
+{
+     850:	55                   	push   %ebp
+     851:	89 e5                	mov    %esp,%ebp
+     853:	83 ec 18             	sub    $0x18,%esp
+  int i, fd;
+
+  printf(stdout, "many creates, followed by unlink test\n");
+     856:	a1 78 71 00 00       	mov    0x7178,%eax
+     85b:	83 ec 08             	sub    $0x8,%esp
+     85e:	68 1c 53 00 00       	push   $0x531c
+     863:	50                   	push   %eax
+     864:	e8 28 43 00 00       	call   4b91 <printf>
+     869:	83 c4 10             	add    $0x10,%esp
+
+  name[0] = 'a';
+     86c:	c6 05 60 bd 01 00 61 	movb   $0x61,0x1bd60
+  name[2] = '\0';
+     873:	c6 05 62 bd 01 00 00 	movb   $0x0,0x1bd62
+  for(i = 0; i < 52; i++){
+     87a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     881:	eb 35                	jmp    8b8 <createtest+0x68>
+    name[1] = '0' + i;
+     883:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     886:	83 c0 30             	add    $0x30,%eax
+     889:	a2 61 bd 01 00       	mov    %al,0x1bd61
+    fd = open(name, O_CREATE|O_RDWR);
+     88e:	83 ec 08             	sub    $0x8,%esp
+     891:	68 02 02 00 00       	push   $0x202
+     896:	68 60 bd 01 00       	push   $0x1bd60
+     89b:	e8 75 41 00 00       	call   4a15 <open>
+     8a0:	83 c4 10             	add    $0x10,%esp
+     8a3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+     8a6:	83 ec 0c             	sub    $0xc,%esp
+     8a9:	ff 75 f0             	push   -0x10(%ebp)
+     8ac:	e8 4c 41 00 00       	call   49fd <close>
+     8b1:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 52; i++){
+     8b4:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     8b8:	83 7d f4 33          	cmpl   $0x33,-0xc(%ebp)
+     8bc:	7e c5                	jle    883 <createtest+0x33>
+  }
+  name[0] = 'a';
+     8be:	c6 05 60 bd 01 00 61 	movb   $0x61,0x1bd60
+  name[2] = '\0';
+     8c5:	c6 05 62 bd 01 00 00 	movb   $0x0,0x1bd62
+  for(i = 0; i < 52; i++){
+     8cc:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     8d3:	eb 1f                	jmp    8f4 <createtest+0xa4>
+    name[1] = '0' + i;
+     8d5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     8d8:	83 c0 30             	add    $0x30,%eax
+     8db:	a2 61 bd 01 00       	mov    %al,0x1bd61
+    unlink(name);
+     8e0:	83 ec 0c             	sub    $0xc,%esp
+     8e3:	68 60 bd 01 00       	push   $0x1bd60
+     8e8:	e8 38 41 00 00       	call   4a25 <unlink>
+     8ed:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 52; i++){
+     8f0:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     8f4:	83 7d f4 33          	cmpl   $0x33,-0xc(%ebp)
+     8f8:	7e db                	jle    8d5 <createtest+0x85>
+  }
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     8fa:	a1 78 71 00 00       	mov    0x7178,%eax
+     8ff:	83 ec 08             	sub    $0x8,%esp
+     902:	68 44 53 00 00       	push   $0x5344
+     907:	50                   	push   %eax
+     908:	e8 84 42 00 00       	call   4b91 <printf>
+     90d:	83 c4 10             	add    $0x10,%esp
+}
+     910:	90                   	nop
+     911:	c9                   	leave
+     912:	c3                   	ret
+
+00000913 <dirtest>:
+
+void dirtest(void)
+{
+     913:	55                   	push   %ebp
+     914:	89 e5                	mov    %esp,%ebp
+     916:	83 ec 08             	sub    $0x8,%esp
+  printf(stdout, "mkdir test\n");
+     919:	a1 78 71 00 00       	mov    0x7178,%eax
+     91e:	83 ec 08             	sub    $0x8,%esp
+     921:	68 6a 53 00 00       	push   $0x536a
+     926:	50                   	push   %eax
+     927:	e8 65 42 00 00       	call   4b91 <printf>
+     92c:	83 c4 10             	add    $0x10,%esp
+
+  if(mkdir("dir0") < 0){
+     92f:	83 ec 0c             	sub    $0xc,%esp
+     932:	68 76 53 00 00       	push   $0x5376
+     937:	e8 01 41 00 00       	call   4a3d <mkdir>
+     93c:	83 c4 10             	add    $0x10,%esp
+     93f:	85 c0                	test   %eax,%eax
+     941:	79 1b                	jns    95e <dirtest+0x4b>
+    printf(stdout, "mkdir failed\n");
+     943:	a1 78 71 00 00       	mov    0x7178,%eax
+     948:	83 ec 08             	sub    $0x8,%esp
+     94b:	68 95 4f 00 00       	push   $0x4f95
+     950:	50                   	push   %eax
+     951:	e8 3b 42 00 00       	call   4b91 <printf>
+     956:	83 c4 10             	add    $0x10,%esp
+    exit();
+     959:	e8 77 40 00 00       	call   49d5 <exit>
+  }
+
+  if(chdir("dir0") < 0){
+     95e:	83 ec 0c             	sub    $0xc,%esp
+     961:	68 76 53 00 00       	push   $0x5376
+     966:	e8 da 40 00 00       	call   4a45 <chdir>
+     96b:	83 c4 10             	add    $0x10,%esp
+     96e:	85 c0                	test   %eax,%eax
+     970:	79 1b                	jns    98d <dirtest+0x7a>
+    printf(stdout, "chdir dir0 failed\n");
+     972:	a1 78 71 00 00       	mov    0x7178,%eax
+     977:	83 ec 08             	sub    $0x8,%esp
+     97a:	68 7b 53 00 00       	push   $0x537b
+     97f:	50                   	push   %eax
+     980:	e8 0c 42 00 00       	call   4b91 <printf>
+     985:	83 c4 10             	add    $0x10,%esp
+    exit();
+     988:	e8 48 40 00 00       	call   49d5 <exit>
+  }
+
+  if(chdir("..") < 0){
+     98d:	83 ec 0c             	sub    $0xc,%esp
+     990:	68 8e 53 00 00       	push   $0x538e
+     995:	e8 ab 40 00 00       	call   4a45 <chdir>
+     99a:	83 c4 10             	add    $0x10,%esp
+     99d:	85 c0                	test   %eax,%eax
+     99f:	79 1b                	jns    9bc <dirtest+0xa9>
+    printf(stdout, "chdir .. failed\n");
+     9a1:	a1 78 71 00 00       	mov    0x7178,%eax
+     9a6:	83 ec 08             	sub    $0x8,%esp
+     9a9:	68 91 53 00 00       	push   $0x5391
+     9ae:	50                   	push   %eax
+     9af:	e8 dd 41 00 00       	call   4b91 <printf>
+     9b4:	83 c4 10             	add    $0x10,%esp
+    exit();
+     9b7:	e8 19 40 00 00       	call   49d5 <exit>
+  }
+
+  if(unlink("dir0") < 0){
+     9bc:	83 ec 0c             	sub    $0xc,%esp
+     9bf:	68 76 53 00 00       	push   $0x5376
+     9c4:	e8 5c 40 00 00       	call   4a25 <unlink>
+     9c9:	83 c4 10             	add    $0x10,%esp
+     9cc:	85 c0                	test   %eax,%eax
+     9ce:	79 1b                	jns    9eb <dirtest+0xd8>
+    printf(stdout, "unlink dir0 failed\n");
+     9d0:	a1 78 71 00 00       	mov    0x7178,%eax
+     9d5:	83 ec 08             	sub    $0x8,%esp
+     9d8:	68 a2 53 00 00       	push   $0x53a2
+     9dd:	50                   	push   %eax
+     9de:	e8 ae 41 00 00       	call   4b91 <printf>
+     9e3:	83 c4 10             	add    $0x10,%esp
+    exit();
+     9e6:	e8 ea 3f 00 00       	call   49d5 <exit>
+  }
+  printf(stdout, "mkdir test ok\n");
+     9eb:	a1 78 71 00 00       	mov    0x7178,%eax
+     9f0:	83 ec 08             	sub    $0x8,%esp
+     9f3:	68 b6 53 00 00       	push   $0x53b6
+     9f8:	50                   	push   %eax
+     9f9:	e8 93 41 00 00       	call   4b91 <printf>
+     9fe:	83 c4 10             	add    $0x10,%esp
+}
+     a01:	90                   	nop
+     a02:	c9                   	leave
+     a03:	c3                   	ret
+
+00000a04 <exectest>:
+
+void
+exectest(void)
+{
+     a04:	55                   	push   %ebp
+     a05:	89 e5                	mov    %esp,%ebp
+     a07:	83 ec 08             	sub    $0x8,%esp
+  printf(stdout, "exec test\n");
+     a0a:	a1 78 71 00 00       	mov    0x7178,%eax
+     a0f:	83 ec 08             	sub    $0x8,%esp
+     a12:	68 c5 53 00 00       	push   $0x53c5
+     a17:	50                   	push   %eax
+     a18:	e8 74 41 00 00       	call   4b91 <printf>
+     a1d:	83 c4 10             	add    $0x10,%esp
+  if(exec("echo", echoargv) < 0){
+     a20:	83 ec 08             	sub    $0x8,%esp
+     a23:	68 64 71 00 00       	push   $0x7164
+     a28:	68 6c 4f 00 00       	push   $0x4f6c
+     a2d:	e8 db 3f 00 00       	call   4a0d <exec>
+     a32:	83 c4 10             	add    $0x10,%esp
+     a35:	85 c0                	test   %eax,%eax
+     a37:	79 1b                	jns    a54 <exectest+0x50>
+    printf(stdout, "exec echo failed\n");
+     a39:	a1 78 71 00 00       	mov    0x7178,%eax
+     a3e:	83 ec 08             	sub    $0x8,%esp
+     a41:	68 d0 53 00 00       	push   $0x53d0
+     a46:	50                   	push   %eax
+     a47:	e8 45 41 00 00       	call   4b91 <printf>
+     a4c:	83 c4 10             	add    $0x10,%esp
+    exit();
+     a4f:	e8 81 3f 00 00       	call   49d5 <exit>
+  }
+}
+     a54:	90                   	nop
+     a55:	c9                   	leave
+     a56:	c3                   	ret
+
+00000a57 <pipe1>:
+
+// simple fork and pipe read/write
+
+void
+pipe1(void)
+{
+     a57:	55                   	push   %ebp
+     a58:	89 e5                	mov    %esp,%ebp
+     a5a:	83 ec 28             	sub    $0x28,%esp
+  int fds[2], pid;
+  int seq, i, n, cc, total;
+
+  if(pipe(fds) != 0){
+     a5d:	83 ec 0c             	sub    $0xc,%esp
+     a60:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     a63:	50                   	push   %eax
+     a64:	e8 7c 3f 00 00       	call   49e5 <pipe>
+     a69:	83 c4 10             	add    $0x10,%esp
+     a6c:	85 c0                	test   %eax,%eax
+     a6e:	74 17                	je     a87 <pipe1+0x30>
+    printf(1, "pipe() failed\n");
+     a70:	83 ec 08             	sub    $0x8,%esp
+     a73:	68 e2 53 00 00       	push   $0x53e2
+     a78:	6a 01                	push   $0x1
+     a7a:	e8 12 41 00 00       	call   4b91 <printf>
+     a7f:	83 c4 10             	add    $0x10,%esp
+    exit();
+     a82:	e8 4e 3f 00 00       	call   49d5 <exit>
+  }
+  pid = fork();
+     a87:	e8 41 3f 00 00       	call   49cd <fork>
+     a8c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  seq = 0;
+     a8f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  if(pid == 0){
+     a96:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+     a9a:	0f 85 89 00 00 00    	jne    b29 <pipe1+0xd2>
+    close(fds[0]);
+     aa0:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     aa3:	83 ec 0c             	sub    $0xc,%esp
+     aa6:	50                   	push   %eax
+     aa7:	e8 51 3f 00 00       	call   49fd <close>
+     aac:	83 c4 10             	add    $0x10,%esp
+    for(n = 0; n < 5; n++){
+     aaf:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+     ab6:	eb 66                	jmp    b1e <pipe1+0xc7>
+      for(i = 0; i < 1033; i++)
+     ab8:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     abf:	eb 19                	jmp    ada <pipe1+0x83>
+        buf[i] = seq++;
+     ac1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ac4:	8d 50 01             	lea    0x1(%eax),%edx
+     ac7:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     aca:	89 c2                	mov    %eax,%edx
+     acc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     acf:	05 60 9d 01 00       	add    $0x19d60,%eax
+     ad4:	88 10                	mov    %dl,(%eax)
+      for(i = 0; i < 1033; i++)
+     ad6:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     ada:	81 7d f0 08 04 00 00 	cmpl   $0x408,-0x10(%ebp)
+     ae1:	7e de                	jle    ac1 <pipe1+0x6a>
+      if(write(fds[1], buf, 1033) != 1033){
+     ae3:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     ae6:	83 ec 04             	sub    $0x4,%esp
+     ae9:	68 09 04 00 00       	push   $0x409
+     aee:	68 60 9d 01 00       	push   $0x19d60
+     af3:	50                   	push   %eax
+     af4:	e8 fc 3e 00 00       	call   49f5 <write>
+     af9:	83 c4 10             	add    $0x10,%esp
+     afc:	3d 09 04 00 00       	cmp    $0x409,%eax
+     b01:	74 17                	je     b1a <pipe1+0xc3>
+        printf(1, "pipe1 oops 1\n");
+     b03:	83 ec 08             	sub    $0x8,%esp
+     b06:	68 f1 53 00 00       	push   $0x53f1
+     b0b:	6a 01                	push   $0x1
+     b0d:	e8 7f 40 00 00       	call   4b91 <printf>
+     b12:	83 c4 10             	add    $0x10,%esp
+        exit();
+     b15:	e8 bb 3e 00 00       	call   49d5 <exit>
+    for(n = 0; n < 5; n++){
+     b1a:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+     b1e:	83 7d ec 04          	cmpl   $0x4,-0x14(%ebp)
+     b22:	7e 94                	jle    ab8 <pipe1+0x61>
+      }
+    }
+    exit();
+     b24:	e8 ac 3e 00 00       	call   49d5 <exit>
+  } else if(pid > 0){
+     b29:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+     b2d:	0f 8e f4 00 00 00    	jle    c27 <pipe1+0x1d0>
+    close(fds[1]);
+     b33:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     b36:	83 ec 0c             	sub    $0xc,%esp
+     b39:	50                   	push   %eax
+     b3a:	e8 be 3e 00 00       	call   49fd <close>
+     b3f:	83 c4 10             	add    $0x10,%esp
+    total = 0;
+     b42:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    cc = 1;
+     b49:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+    while((n = read(fds[0], buf, cc)) > 0){
+     b50:	eb 66                	jmp    bb8 <pipe1+0x161>
+      for(i = 0; i < n; i++){
+     b52:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     b59:	eb 3b                	jmp    b96 <pipe1+0x13f>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     b5b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     b5e:	05 60 9d 01 00       	add    $0x19d60,%eax
+     b63:	0f b6 00             	movzbl (%eax),%eax
+     b66:	0f be c8             	movsbl %al,%ecx
+     b69:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b6c:	8d 50 01             	lea    0x1(%eax),%edx
+     b6f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     b72:	31 c8                	xor    %ecx,%eax
+     b74:	0f b6 c0             	movzbl %al,%eax
+     b77:	85 c0                	test   %eax,%eax
+     b79:	74 17                	je     b92 <pipe1+0x13b>
+          printf(1, "pipe1 oops 2\n");
+     b7b:	83 ec 08             	sub    $0x8,%esp
+     b7e:	68 ff 53 00 00       	push   $0x53ff
+     b83:	6a 01                	push   $0x1
+     b85:	e8 07 40 00 00       	call   4b91 <printf>
+     b8a:	83 c4 10             	add    $0x10,%esp
+     b8d:	e9 ac 00 00 00       	jmp    c3e <pipe1+0x1e7>
+      for(i = 0; i < n; i++){
+     b92:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     b96:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     b99:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+     b9c:	7c bd                	jl     b5b <pipe1+0x104>
+          return;
+        }
+      }
+      total += n;
+     b9e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     ba1:	01 45 e4             	add    %eax,-0x1c(%ebp)
+      cc = cc * 2;
+     ba4:	d1 65 e8             	shll   -0x18(%ebp)
+      if(cc > sizeof(buf))
+     ba7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     baa:	3d 00 20 00 00       	cmp    $0x2000,%eax
+     baf:	76 07                	jbe    bb8 <pipe1+0x161>
+        cc = sizeof(buf);
+     bb1:	c7 45 e8 00 20 00 00 	movl   $0x2000,-0x18(%ebp)
+    while((n = read(fds[0], buf, cc)) > 0){
+     bb8:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     bbb:	83 ec 04             	sub    $0x4,%esp
+     bbe:	ff 75 e8             	push   -0x18(%ebp)
+     bc1:	68 60 9d 01 00       	push   $0x19d60
+     bc6:	50                   	push   %eax
+     bc7:	e8 21 3e 00 00       	call   49ed <read>
+     bcc:	83 c4 10             	add    $0x10,%esp
+     bcf:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     bd2:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     bd6:	0f 8f 76 ff ff ff    	jg     b52 <pipe1+0xfb>
+    }
+    if(total != 5 * 1033){
+     bdc:	81 7d e4 2d 14 00 00 	cmpl   $0x142d,-0x1c(%ebp)
+     be3:	74 1a                	je     bff <pipe1+0x1a8>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     be5:	83 ec 04             	sub    $0x4,%esp
+     be8:	ff 75 e4             	push   -0x1c(%ebp)
+     beb:	68 0d 54 00 00       	push   $0x540d
+     bf0:	6a 01                	push   $0x1
+     bf2:	e8 9a 3f 00 00       	call   4b91 <printf>
+     bf7:	83 c4 10             	add    $0x10,%esp
+      exit();
+     bfa:	e8 d6 3d 00 00       	call   49d5 <exit>
+    }
+    close(fds[0]);
+     bff:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     c02:	83 ec 0c             	sub    $0xc,%esp
+     c05:	50                   	push   %eax
+     c06:	e8 f2 3d 00 00       	call   49fd <close>
+     c0b:	83 c4 10             	add    $0x10,%esp
+    wait();
+     c0e:	e8 ca 3d 00 00       	call   49dd <wait>
+  } else {
+    printf(1, "fork() failed\n");
+    exit();
+  }
+  printf(1, "pipe1 ok\n");
+     c13:	83 ec 08             	sub    $0x8,%esp
+     c16:	68 33 54 00 00       	push   $0x5433
+     c1b:	6a 01                	push   $0x1
+     c1d:	e8 6f 3f 00 00       	call   4b91 <printf>
+     c22:	83 c4 10             	add    $0x10,%esp
+     c25:	eb 17                	jmp    c3e <pipe1+0x1e7>
+    printf(1, "fork() failed\n");
+     c27:	83 ec 08             	sub    $0x8,%esp
+     c2a:	68 24 54 00 00       	push   $0x5424
+     c2f:	6a 01                	push   $0x1
+     c31:	e8 5b 3f 00 00       	call   4b91 <printf>
+     c36:	83 c4 10             	add    $0x10,%esp
+    exit();
+     c39:	e8 97 3d 00 00       	call   49d5 <exit>
+}
+     c3e:	c9                   	leave
+     c3f:	c3                   	ret
+
+00000c40 <preempt>:
+
+// meant to be run w/ at most two CPUs
+void
+preempt(void)
+{
+     c40:	55                   	push   %ebp
+     c41:	89 e5                	mov    %esp,%ebp
+     c43:	83 ec 28             	sub    $0x28,%esp
+  int pid1, pid2, pid3;
+  int pfds[2];
+
+  printf(1, "preempt: ");
+     c46:	83 ec 08             	sub    $0x8,%esp
+     c49:	68 3d 54 00 00       	push   $0x543d
+     c4e:	6a 01                	push   $0x1
+     c50:	e8 3c 3f 00 00       	call   4b91 <printf>
+     c55:	83 c4 10             	add    $0x10,%esp
+  pid1 = fork();
+     c58:	e8 70 3d 00 00       	call   49cd <fork>
+     c5d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(pid1 == 0)
+     c60:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     c64:	75 03                	jne    c69 <preempt+0x29>
+    for(;;)
+     c66:	90                   	nop
+     c67:	eb fd                	jmp    c66 <preempt+0x26>
+      ;
+
+  pid2 = fork();
+     c69:	e8 5f 3d 00 00       	call   49cd <fork>
+     c6e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(pid2 == 0)
+     c71:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     c75:	75 03                	jne    c7a <preempt+0x3a>
+    for(;;)
+     c77:	90                   	nop
+     c78:	eb fd                	jmp    c77 <preempt+0x37>
+      ;
+
+  pipe(pfds);
+     c7a:	83 ec 0c             	sub    $0xc,%esp
+     c7d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     c80:	50                   	push   %eax
+     c81:	e8 5f 3d 00 00       	call   49e5 <pipe>
+     c86:	83 c4 10             	add    $0x10,%esp
+  pid3 = fork();
+     c89:	e8 3f 3d 00 00       	call   49cd <fork>
+     c8e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(pid3 == 0){
+     c91:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     c95:	75 4e                	jne    ce5 <preempt+0xa5>
+    close(pfds[0]);
+     c97:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     c9a:	83 ec 0c             	sub    $0xc,%esp
+     c9d:	50                   	push   %eax
+     c9e:	e8 5a 3d 00 00       	call   49fd <close>
+     ca3:	83 c4 10             	add    $0x10,%esp
+    if(write(pfds[1], "x", 1) != 1)
+     ca6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     ca9:	83 ec 04             	sub    $0x4,%esp
+     cac:	6a 01                	push   $0x1
+     cae:	68 47 54 00 00       	push   $0x5447
+     cb3:	50                   	push   %eax
+     cb4:	e8 3c 3d 00 00       	call   49f5 <write>
+     cb9:	83 c4 10             	add    $0x10,%esp
+     cbc:	83 f8 01             	cmp    $0x1,%eax
+     cbf:	74 12                	je     cd3 <preempt+0x93>
+      printf(1, "preempt write error");
+     cc1:	83 ec 08             	sub    $0x8,%esp
+     cc4:	68 49 54 00 00       	push   $0x5449
+     cc9:	6a 01                	push   $0x1
+     ccb:	e8 c1 3e 00 00       	call   4b91 <printf>
+     cd0:	83 c4 10             	add    $0x10,%esp
+    close(pfds[1]);
+     cd3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     cd6:	83 ec 0c             	sub    $0xc,%esp
+     cd9:	50                   	push   %eax
+     cda:	e8 1e 3d 00 00       	call   49fd <close>
+     cdf:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+     ce2:	90                   	nop
+     ce3:	eb fd                	jmp    ce2 <preempt+0xa2>
+      ;
+  }
+
+  close(pfds[1]);
+     ce5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     ce8:	83 ec 0c             	sub    $0xc,%esp
+     ceb:	50                   	push   %eax
+     cec:	e8 0c 3d 00 00       	call   49fd <close>
+     cf1:	83 c4 10             	add    $0x10,%esp
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+     cf4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     cf7:	83 ec 04             	sub    $0x4,%esp
+     cfa:	68 00 20 00 00       	push   $0x2000
+     cff:	68 60 9d 01 00       	push   $0x19d60
+     d04:	50                   	push   %eax
+     d05:	e8 e3 3c 00 00       	call   49ed <read>
+     d0a:	83 c4 10             	add    $0x10,%esp
+     d0d:	83 f8 01             	cmp    $0x1,%eax
+     d10:	74 14                	je     d26 <preempt+0xe6>
+    printf(1, "preempt read error");
+     d12:	83 ec 08             	sub    $0x8,%esp
+     d15:	68 5d 54 00 00       	push   $0x545d
+     d1a:	6a 01                	push   $0x1
+     d1c:	e8 70 3e 00 00       	call   4b91 <printf>
+     d21:	83 c4 10             	add    $0x10,%esp
+     d24:	eb 7e                	jmp    da4 <preempt+0x164>
+    return;
+  }
+  close(pfds[0]);
+     d26:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     d29:	83 ec 0c             	sub    $0xc,%esp
+     d2c:	50                   	push   %eax
+     d2d:	e8 cb 3c 00 00       	call   49fd <close>
+     d32:	83 c4 10             	add    $0x10,%esp
+  printf(1, "kill... ");
+     d35:	83 ec 08             	sub    $0x8,%esp
+     d38:	68 70 54 00 00       	push   $0x5470
+     d3d:	6a 01                	push   $0x1
+     d3f:	e8 4d 3e 00 00       	call   4b91 <printf>
+     d44:	83 c4 10             	add    $0x10,%esp
+  kill(pid1);
+     d47:	83 ec 0c             	sub    $0xc,%esp
+     d4a:	ff 75 f4             	push   -0xc(%ebp)
+     d4d:	e8 b3 3c 00 00       	call   4a05 <kill>
+     d52:	83 c4 10             	add    $0x10,%esp
+  kill(pid2);
+     d55:	83 ec 0c             	sub    $0xc,%esp
+     d58:	ff 75 f0             	push   -0x10(%ebp)
+     d5b:	e8 a5 3c 00 00       	call   4a05 <kill>
+     d60:	83 c4 10             	add    $0x10,%esp
+  kill(pid3);
+     d63:	83 ec 0c             	sub    $0xc,%esp
+     d66:	ff 75 ec             	push   -0x14(%ebp)
+     d69:	e8 97 3c 00 00       	call   4a05 <kill>
+     d6e:	83 c4 10             	add    $0x10,%esp
+  printf(1, "wait... ");
+     d71:	83 ec 08             	sub    $0x8,%esp
+     d74:	68 79 54 00 00       	push   $0x5479
+     d79:	6a 01                	push   $0x1
+     d7b:	e8 11 3e 00 00       	call   4b91 <printf>
+     d80:	83 c4 10             	add    $0x10,%esp
+  wait();
+     d83:	e8 55 3c 00 00       	call   49dd <wait>
+  wait();
+     d88:	e8 50 3c 00 00       	call   49dd <wait>
+  wait();
+     d8d:	e8 4b 3c 00 00       	call   49dd <wait>
+  printf(1, "preempt ok\n");
+     d92:	83 ec 08             	sub    $0x8,%esp
+     d95:	68 82 54 00 00       	push   $0x5482
+     d9a:	6a 01                	push   $0x1
+     d9c:	e8 f0 3d 00 00       	call   4b91 <printf>
+     da1:	83 c4 10             	add    $0x10,%esp
+}
+     da4:	c9                   	leave
+     da5:	c3                   	ret
+
+00000da6 <exitwait>:
+
+// try to find any races between exit and wait
+void
+exitwait(void)
+{
+     da6:	55                   	push   %ebp
+     da7:	89 e5                	mov    %esp,%ebp
+     da9:	83 ec 18             	sub    $0x18,%esp
+  int i, pid;
+
+  for(i = 0; i < 100; i++){
+     dac:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     db3:	eb 4f                	jmp    e04 <exitwait+0x5e>
+    pid = fork();
+     db5:	e8 13 3c 00 00       	call   49cd <fork>
+     dba:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(pid < 0){
+     dbd:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     dc1:	79 14                	jns    dd7 <exitwait+0x31>
+      printf(1, "fork failed\n");
+     dc3:	83 ec 08             	sub    $0x8,%esp
+     dc6:	68 0d 50 00 00       	push   $0x500d
+     dcb:	6a 01                	push   $0x1
+     dcd:	e8 bf 3d 00 00       	call   4b91 <printf>
+     dd2:	83 c4 10             	add    $0x10,%esp
+      return;
+     dd5:	eb 45                	jmp    e1c <exitwait+0x76>
+    }
+    if(pid){
+     dd7:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     ddb:	74 1e                	je     dfb <exitwait+0x55>
+      if(wait() != pid){
+     ddd:	e8 fb 3b 00 00       	call   49dd <wait>
+     de2:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     de5:	74 19                	je     e00 <exitwait+0x5a>
+        printf(1, "wait wrong pid\n");
+     de7:	83 ec 08             	sub    $0x8,%esp
+     dea:	68 8e 54 00 00       	push   $0x548e
+     def:	6a 01                	push   $0x1
+     df1:	e8 9b 3d 00 00       	call   4b91 <printf>
+     df6:	83 c4 10             	add    $0x10,%esp
+        return;
+     df9:	eb 21                	jmp    e1c <exitwait+0x76>
+      }
+    } else {
+      exit();
+     dfb:	e8 d5 3b 00 00       	call   49d5 <exit>
+  for(i = 0; i < 100; i++){
+     e00:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     e04:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+     e08:	7e ab                	jle    db5 <exitwait+0xf>
+    }
+  }
+  printf(1, "exitwait ok\n");
+     e0a:	83 ec 08             	sub    $0x8,%esp
+     e0d:	68 9e 54 00 00       	push   $0x549e
+     e12:	6a 01                	push   $0x1
+     e14:	e8 78 3d 00 00       	call   4b91 <printf>
+     e19:	83 c4 10             	add    $0x10,%esp
+}
+     e1c:	c9                   	leave
+     e1d:	c3                   	ret
+
+00000e1e <mem>:
+
+void
+mem(void)
+{
+     e1e:	55                   	push   %ebp
+     e1f:	89 e5                	mov    %esp,%ebp
+     e21:	83 ec 18             	sub    $0x18,%esp
+  void *m1, *m2;
+  int pid, ppid;
+
+  printf(1, "mem test\n");
+     e24:	83 ec 08             	sub    $0x8,%esp
+     e27:	68 ab 54 00 00       	push   $0x54ab
+     e2c:	6a 01                	push   $0x1
+     e2e:	e8 5e 3d 00 00       	call   4b91 <printf>
+     e33:	83 c4 10             	add    $0x10,%esp
+  ppid = getpid();
+     e36:	e8 1a 3c 00 00       	call   4a55 <getpid>
+     e3b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((pid = fork()) == 0){
+     e3e:	e8 8a 3b 00 00       	call   49cd <fork>
+     e43:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     e46:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     e4a:	0f 85 b7 00 00 00    	jne    f07 <mem+0xe9>
+    m1 = 0;
+     e50:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    while((m2 = malloc(10001)) != 0){
+     e57:	eb 0e                	jmp    e67 <mem+0x49>
+      *(char**)m2 = m1;
+     e59:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e5c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     e5f:	89 10                	mov    %edx,(%eax)
+      m1 = m2;
+     e61:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e64:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    while((m2 = malloc(10001)) != 0){
+     e67:	83 ec 0c             	sub    $0xc,%esp
+     e6a:	68 11 27 00 00       	push   $0x2711
+     e6f:	e8 15 40 00 00       	call   4e89 <malloc>
+     e74:	83 c4 10             	add    $0x10,%esp
+     e77:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     e7a:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     e7e:	75 d9                	jne    e59 <mem+0x3b>
+    }
+    while(m1){
+     e80:	eb 1c                	jmp    e9e <mem+0x80>
+      m2 = *(char**)m1;
+     e82:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e85:	8b 00                	mov    (%eax),%eax
+     e87:	89 45 e8             	mov    %eax,-0x18(%ebp)
+      free(m1);
+     e8a:	83 ec 0c             	sub    $0xc,%esp
+     e8d:	ff 75 f4             	push   -0xc(%ebp)
+     e90:	e8 b2 3e 00 00       	call   4d47 <free>
+     e95:	83 c4 10             	add    $0x10,%esp
+      m1 = m2;
+     e98:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e9b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    while(m1){
+     e9e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     ea2:	75 de                	jne    e82 <mem+0x64>
+    }
+    m1 = malloc(1024*20);
+     ea4:	83 ec 0c             	sub    $0xc,%esp
+     ea7:	68 00 50 00 00       	push   $0x5000
+     eac:	e8 d8 3f 00 00       	call   4e89 <malloc>
+     eb1:	83 c4 10             	add    $0x10,%esp
+     eb4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(m1 == 0){
+     eb7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     ebb:	75 25                	jne    ee2 <mem+0xc4>
+      printf(1, "couldn't allocate mem?!!\n");
+     ebd:	83 ec 08             	sub    $0x8,%esp
+     ec0:	68 b5 54 00 00       	push   $0x54b5
+     ec5:	6a 01                	push   $0x1
+     ec7:	e8 c5 3c 00 00       	call   4b91 <printf>
+     ecc:	83 c4 10             	add    $0x10,%esp
+      kill(ppid);
+     ecf:	83 ec 0c             	sub    $0xc,%esp
+     ed2:	ff 75 f0             	push   -0x10(%ebp)
+     ed5:	e8 2b 3b 00 00       	call   4a05 <kill>
+     eda:	83 c4 10             	add    $0x10,%esp
+      exit();
+     edd:	e8 f3 3a 00 00       	call   49d5 <exit>
+    }
+    free(m1);
+     ee2:	83 ec 0c             	sub    $0xc,%esp
+     ee5:	ff 75 f4             	push   -0xc(%ebp)
+     ee8:	e8 5a 3e 00 00       	call   4d47 <free>
+     eed:	83 c4 10             	add    $0x10,%esp
+    printf(1, "mem ok\n");
+     ef0:	83 ec 08             	sub    $0x8,%esp
+     ef3:	68 cf 54 00 00       	push   $0x54cf
+     ef8:	6a 01                	push   $0x1
+     efa:	e8 92 3c 00 00       	call   4b91 <printf>
+     eff:	83 c4 10             	add    $0x10,%esp
+    exit();
+     f02:	e8 ce 3a 00 00       	call   49d5 <exit>
+  } else {
+    wait();
+     f07:	e8 d1 3a 00 00       	call   49dd <wait>
+  }
+}
+     f0c:	90                   	nop
+     f0d:	c9                   	leave
+     f0e:	c3                   	ret
+
+00000f0f <sharedfd>:
+
+// two processes write to the same file descriptor
+// is the offset shared? does inode locking work?
+void
+sharedfd(void)
+{
+     f0f:	55                   	push   %ebp
+     f10:	89 e5                	mov    %esp,%ebp
+     f12:	83 ec 38             	sub    $0x38,%esp
+  int fd, pid, i, n, nc, np;
+  char buf[10];
+
+  printf(1, "sharedfd test\n");
+     f15:	83 ec 08             	sub    $0x8,%esp
+     f18:	68 d7 54 00 00       	push   $0x54d7
+     f1d:	6a 01                	push   $0x1
+     f1f:	e8 6d 3c 00 00       	call   4b91 <printf>
+     f24:	83 c4 10             	add    $0x10,%esp
+
+  unlink("sharedfd");
+     f27:	83 ec 0c             	sub    $0xc,%esp
+     f2a:	68 e6 54 00 00       	push   $0x54e6
+     f2f:	e8 f1 3a 00 00       	call   4a25 <unlink>
+     f34:	83 c4 10             	add    $0x10,%esp
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+     f37:	83 ec 08             	sub    $0x8,%esp
+     f3a:	68 02 02 00 00       	push   $0x202
+     f3f:	68 e6 54 00 00       	push   $0x54e6
+     f44:	e8 cc 3a 00 00       	call   4a15 <open>
+     f49:	83 c4 10             	add    $0x10,%esp
+     f4c:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(fd < 0){
+     f4f:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     f53:	79 17                	jns    f6c <sharedfd+0x5d>
+    printf(1, "fstests: cannot open sharedfd for writing");
+     f55:	83 ec 08             	sub    $0x8,%esp
+     f58:	68 f0 54 00 00       	push   $0x54f0
+     f5d:	6a 01                	push   $0x1
+     f5f:	e8 2d 3c 00 00       	call   4b91 <printf>
+     f64:	83 c4 10             	add    $0x10,%esp
+    return;
+     f67:	e9 84 01 00 00       	jmp    10f0 <sharedfd+0x1e1>
+  }
+  pid = fork();
+     f6c:	e8 5c 3a 00 00       	call   49cd <fork>
+     f71:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     f74:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+     f78:	75 07                	jne    f81 <sharedfd+0x72>
+     f7a:	b8 63 00 00 00       	mov    $0x63,%eax
+     f7f:	eb 05                	jmp    f86 <sharedfd+0x77>
+     f81:	b8 70 00 00 00       	mov    $0x70,%eax
+     f86:	83 ec 04             	sub    $0x4,%esp
+     f89:	6a 0a                	push   $0xa
+     f8b:	50                   	push   %eax
+     f8c:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+     f8f:	50                   	push   %eax
+     f90:	e8 0f 36 00 00       	call   45a4 <memset>
+     f95:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 1000; i++){
+     f98:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     f9f:	eb 31                	jmp    fd2 <sharedfd+0xc3>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+     fa1:	83 ec 04             	sub    $0x4,%esp
+     fa4:	6a 0a                	push   $0xa
+     fa6:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+     fa9:	50                   	push   %eax
+     faa:	ff 75 e8             	push   -0x18(%ebp)
+     fad:	e8 43 3a 00 00       	call   49f5 <write>
+     fb2:	83 c4 10             	add    $0x10,%esp
+     fb5:	83 f8 0a             	cmp    $0xa,%eax
+     fb8:	74 14                	je     fce <sharedfd+0xbf>
+      printf(1, "fstests: write sharedfd failed\n");
+     fba:	83 ec 08             	sub    $0x8,%esp
+     fbd:	68 1c 55 00 00       	push   $0x551c
+     fc2:	6a 01                	push   $0x1
+     fc4:	e8 c8 3b 00 00       	call   4b91 <printf>
+     fc9:	83 c4 10             	add    $0x10,%esp
+      break;
+     fcc:	eb 0d                	jmp    fdb <sharedfd+0xcc>
+  for(i = 0; i < 1000; i++){
+     fce:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     fd2:	81 7d f4 e7 03 00 00 	cmpl   $0x3e7,-0xc(%ebp)
+     fd9:	7e c6                	jle    fa1 <sharedfd+0x92>
+    }
+  }
+  if(pid == 0)
+     fdb:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+     fdf:	75 05                	jne    fe6 <sharedfd+0xd7>
+    exit();
+     fe1:	e8 ef 39 00 00       	call   49d5 <exit>
+  else
+    wait();
+     fe6:	e8 f2 39 00 00       	call   49dd <wait>
+  close(fd);
+     feb:	83 ec 0c             	sub    $0xc,%esp
+     fee:	ff 75 e8             	push   -0x18(%ebp)
+     ff1:	e8 07 3a 00 00       	call   49fd <close>
+     ff6:	83 c4 10             	add    $0x10,%esp
+  fd = open("sharedfd", 0);
+     ff9:	83 ec 08             	sub    $0x8,%esp
+     ffc:	6a 00                	push   $0x0
+     ffe:	68 e6 54 00 00       	push   $0x54e6
+    1003:	e8 0d 3a 00 00       	call   4a15 <open>
+    1008:	83 c4 10             	add    $0x10,%esp
+    100b:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(fd < 0){
+    100e:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1012:	79 17                	jns    102b <sharedfd+0x11c>
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    1014:	83 ec 08             	sub    $0x8,%esp
+    1017:	68 3c 55 00 00       	push   $0x553c
+    101c:	6a 01                	push   $0x1
+    101e:	e8 6e 3b 00 00       	call   4b91 <printf>
+    1023:	83 c4 10             	add    $0x10,%esp
+    return;
+    1026:	e9 c5 00 00 00       	jmp    10f0 <sharedfd+0x1e1>
+  }
+  nc = np = 0;
+    102b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    1032:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1035:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    1038:	eb 3b                	jmp    1075 <sharedfd+0x166>
+    for(i = 0; i < sizeof(buf); i++){
+    103a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1041:	eb 2a                	jmp    106d <sharedfd+0x15e>
+      if(buf[i] == 'c')
+    1043:	8d 55 d6             	lea    -0x2a(%ebp),%edx
+    1046:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1049:	01 d0                	add    %edx,%eax
+    104b:	0f b6 00             	movzbl (%eax),%eax
+    104e:	3c 63                	cmp    $0x63,%al
+    1050:	75 04                	jne    1056 <sharedfd+0x147>
+        nc++;
+    1052:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+      if(buf[i] == 'p')
+    1056:	8d 55 d6             	lea    -0x2a(%ebp),%edx
+    1059:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    105c:	01 d0                	add    %edx,%eax
+    105e:	0f b6 00             	movzbl (%eax),%eax
+    1061:	3c 70                	cmp    $0x70,%al
+    1063:	75 04                	jne    1069 <sharedfd+0x15a>
+        np++;
+    1065:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+    for(i = 0; i < sizeof(buf); i++){
+    1069:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    106d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1070:	83 f8 09             	cmp    $0x9,%eax
+    1073:	76 ce                	jbe    1043 <sharedfd+0x134>
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    1075:	83 ec 04             	sub    $0x4,%esp
+    1078:	6a 0a                	push   $0xa
+    107a:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+    107d:	50                   	push   %eax
+    107e:	ff 75 e8             	push   -0x18(%ebp)
+    1081:	e8 67 39 00 00       	call   49ed <read>
+    1086:	83 c4 10             	add    $0x10,%esp
+    1089:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    108c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+    1090:	7f a8                	jg     103a <sharedfd+0x12b>
+    }
+  }
+  close(fd);
+    1092:	83 ec 0c             	sub    $0xc,%esp
+    1095:	ff 75 e8             	push   -0x18(%ebp)
+    1098:	e8 60 39 00 00       	call   49fd <close>
+    109d:	83 c4 10             	add    $0x10,%esp
+  unlink("sharedfd");
+    10a0:	83 ec 0c             	sub    $0xc,%esp
+    10a3:	68 e6 54 00 00       	push   $0x54e6
+    10a8:	e8 78 39 00 00       	call   4a25 <unlink>
+    10ad:	83 c4 10             	add    $0x10,%esp
+  if(nc == 10000 && np == 10000){
+    10b0:	81 7d f0 10 27 00 00 	cmpl   $0x2710,-0x10(%ebp)
+    10b7:	75 1d                	jne    10d6 <sharedfd+0x1c7>
+    10b9:	81 7d ec 10 27 00 00 	cmpl   $0x2710,-0x14(%ebp)
+    10c0:	75 14                	jne    10d6 <sharedfd+0x1c7>
+    printf(1, "sharedfd ok\n");
+    10c2:	83 ec 08             	sub    $0x8,%esp
+    10c5:	68 67 55 00 00       	push   $0x5567
+    10ca:	6a 01                	push   $0x1
+    10cc:	e8 c0 3a 00 00       	call   4b91 <printf>
+    10d1:	83 c4 10             	add    $0x10,%esp
+    10d4:	eb 1a                	jmp    10f0 <sharedfd+0x1e1>
+  } else {
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    10d6:	ff 75 ec             	push   -0x14(%ebp)
+    10d9:	ff 75 f0             	push   -0x10(%ebp)
+    10dc:	68 74 55 00 00       	push   $0x5574
+    10e1:	6a 01                	push   $0x1
+    10e3:	e8 a9 3a 00 00       	call   4b91 <printf>
+    10e8:	83 c4 10             	add    $0x10,%esp
+    exit();
+    10eb:	e8 e5 38 00 00       	call   49d5 <exit>
+  }
+}
+    10f0:	c9                   	leave
+    10f1:	c3                   	ret
+
+000010f2 <fourfiles>:
+
+// four processes write different files at the same
+// time, to test block allocation.
+void
+fourfiles(void)
+{
+    10f2:	55                   	push   %ebp
+    10f3:	89 e5                	mov    %esp,%ebp
+    10f5:	83 ec 38             	sub    $0x38,%esp
+  int fd, pid, i, j, n, total, pi;
+  char *names[] = { "f0", "f1", "f2", "f3" };
+    10f8:	c7 45 c8 89 55 00 00 	movl   $0x5589,-0x38(%ebp)
+    10ff:	c7 45 cc 8c 55 00 00 	movl   $0x558c,-0x34(%ebp)
+    1106:	c7 45 d0 8f 55 00 00 	movl   $0x558f,-0x30(%ebp)
+    110d:	c7 45 d4 92 55 00 00 	movl   $0x5592,-0x2c(%ebp)
+  char *fname;
+
+  printf(1, "fourfiles test\n");
+    1114:	83 ec 08             	sub    $0x8,%esp
+    1117:	68 95 55 00 00       	push   $0x5595
+    111c:	6a 01                	push   $0x1
+    111e:	e8 6e 3a 00 00       	call   4b91 <printf>
+    1123:	83 c4 10             	add    $0x10,%esp
+
+  for(pi = 0; pi < 4; pi++){
+    1126:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+    112d:	e9 f0 00 00 00       	jmp    1222 <fourfiles+0x130>
+    fname = names[pi];
+    1132:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1135:	8b 44 85 c8          	mov    -0x38(%ebp,%eax,4),%eax
+    1139:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    unlink(fname);
+    113c:	83 ec 0c             	sub    $0xc,%esp
+    113f:	ff 75 e4             	push   -0x1c(%ebp)
+    1142:	e8 de 38 00 00       	call   4a25 <unlink>
+    1147:	83 c4 10             	add    $0x10,%esp
+
+    pid = fork();
+    114a:	e8 7e 38 00 00       	call   49cd <fork>
+    114f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    if(pid < 0){
+    1152:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+    1156:	79 17                	jns    116f <fourfiles+0x7d>
+      printf(1, "fork failed\n");
+    1158:	83 ec 08             	sub    $0x8,%esp
+    115b:	68 0d 50 00 00       	push   $0x500d
+    1160:	6a 01                	push   $0x1
+    1162:	e8 2a 3a 00 00       	call   4b91 <printf>
+    1167:	83 c4 10             	add    $0x10,%esp
+      exit();
+    116a:	e8 66 38 00 00       	call   49d5 <exit>
+    }
+
+    if(pid == 0){
+    116f:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+    1173:	0f 85 a5 00 00 00    	jne    121e <fourfiles+0x12c>
+      fd = open(fname, O_CREATE | O_RDWR);
+    1179:	83 ec 08             	sub    $0x8,%esp
+    117c:	68 02 02 00 00       	push   $0x202
+    1181:	ff 75 e4             	push   -0x1c(%ebp)
+    1184:	e8 8c 38 00 00       	call   4a15 <open>
+    1189:	83 c4 10             	add    $0x10,%esp
+    118c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      if(fd < 0){
+    118f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+    1193:	79 17                	jns    11ac <fourfiles+0xba>
+        printf(1, "create failed\n");
+    1195:	83 ec 08             	sub    $0x8,%esp
+    1198:	68 a5 55 00 00       	push   $0x55a5
+    119d:	6a 01                	push   $0x1
+    119f:	e8 ed 39 00 00       	call   4b91 <printf>
+    11a4:	83 c4 10             	add    $0x10,%esp
+        exit();
+    11a7:	e8 29 38 00 00       	call   49d5 <exit>
+      }
+
+      memset(buf, '0'+pi, 512);
+    11ac:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    11af:	83 c0 30             	add    $0x30,%eax
+    11b2:	83 ec 04             	sub    $0x4,%esp
+    11b5:	68 00 02 00 00       	push   $0x200
+    11ba:	50                   	push   %eax
+    11bb:	68 60 9d 01 00       	push   $0x19d60
+    11c0:	e8 df 33 00 00       	call   45a4 <memset>
+    11c5:	83 c4 10             	add    $0x10,%esp
+      for(i = 0; i < 12; i++){
+    11c8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    11cf:	eb 42                	jmp    1213 <fourfiles+0x121>
+        if((n = write(fd, buf, 500)) != 500){
+    11d1:	83 ec 04             	sub    $0x4,%esp
+    11d4:	68 f4 01 00 00       	push   $0x1f4
+    11d9:	68 60 9d 01 00       	push   $0x19d60
+    11de:	ff 75 e0             	push   -0x20(%ebp)
+    11e1:	e8 0f 38 00 00       	call   49f5 <write>
+    11e6:	83 c4 10             	add    $0x10,%esp
+    11e9:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    11ec:	81 7d dc f4 01 00 00 	cmpl   $0x1f4,-0x24(%ebp)
+    11f3:	74 1a                	je     120f <fourfiles+0x11d>
+          printf(1, "write failed %d\n", n);
+    11f5:	83 ec 04             	sub    $0x4,%esp
+    11f8:	ff 75 dc             	push   -0x24(%ebp)
+    11fb:	68 b4 55 00 00       	push   $0x55b4
+    1200:	6a 01                	push   $0x1
+    1202:	e8 8a 39 00 00       	call   4b91 <printf>
+    1207:	83 c4 10             	add    $0x10,%esp
+          exit();
+    120a:	e8 c6 37 00 00       	call   49d5 <exit>
+      for(i = 0; i < 12; i++){
+    120f:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1213:	83 7d f4 0b          	cmpl   $0xb,-0xc(%ebp)
+    1217:	7e b8                	jle    11d1 <fourfiles+0xdf>
+        }
+      }
+      exit();
+    1219:	e8 b7 37 00 00       	call   49d5 <exit>
+  for(pi = 0; pi < 4; pi++){
+    121e:	83 45 e8 01          	addl   $0x1,-0x18(%ebp)
+    1222:	83 7d e8 03          	cmpl   $0x3,-0x18(%ebp)
+    1226:	0f 8e 06 ff ff ff    	jle    1132 <fourfiles+0x40>
+    }
+  }
+
+  for(pi = 0; pi < 4; pi++){
+    122c:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+    1233:	eb 09                	jmp    123e <fourfiles+0x14c>
+    wait();
+    1235:	e8 a3 37 00 00       	call   49dd <wait>
+  for(pi = 0; pi < 4; pi++){
+    123a:	83 45 e8 01          	addl   $0x1,-0x18(%ebp)
+    123e:	83 7d e8 03          	cmpl   $0x3,-0x18(%ebp)
+    1242:	7e f1                	jle    1235 <fourfiles+0x143>
+  }
+
+  for(i = 0; i < 2; i++){
+    1244:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    124b:	e9 d4 00 00 00       	jmp    1324 <fourfiles+0x232>
+    fname = names[i];
+    1250:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1253:	8b 44 85 c8          	mov    -0x38(%ebp,%eax,4),%eax
+    1257:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    fd = open(fname, 0);
+    125a:	83 ec 08             	sub    $0x8,%esp
+    125d:	6a 00                	push   $0x0
+    125f:	ff 75 e4             	push   -0x1c(%ebp)
+    1262:	e8 ae 37 00 00       	call   4a15 <open>
+    1267:	83 c4 10             	add    $0x10,%esp
+    126a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    total = 0;
+    126d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    1274:	eb 4a                	jmp    12c0 <fourfiles+0x1ce>
+      for(j = 0; j < n; j++){
+    1276:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    127d:	eb 33                	jmp    12b2 <fourfiles+0x1c0>
+        if(buf[j] != '0'+i){
+    127f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1282:	05 60 9d 01 00       	add    $0x19d60,%eax
+    1287:	0f b6 00             	movzbl (%eax),%eax
+    128a:	0f be d0             	movsbl %al,%edx
+    128d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1290:	83 c0 30             	add    $0x30,%eax
+    1293:	39 c2                	cmp    %eax,%edx
+    1295:	74 17                	je     12ae <fourfiles+0x1bc>
+          printf(1, "wrong char\n");
+    1297:	83 ec 08             	sub    $0x8,%esp
+    129a:	68 c5 55 00 00       	push   $0x55c5
+    129f:	6a 01                	push   $0x1
+    12a1:	e8 eb 38 00 00       	call   4b91 <printf>
+    12a6:	83 c4 10             	add    $0x10,%esp
+          exit();
+    12a9:	e8 27 37 00 00       	call   49d5 <exit>
+      for(j = 0; j < n; j++){
+    12ae:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    12b2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    12b5:	3b 45 dc             	cmp    -0x24(%ebp),%eax
+    12b8:	7c c5                	jl     127f <fourfiles+0x18d>
+        }
+      }
+      total += n;
+    12ba:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    12bd:	01 45 ec             	add    %eax,-0x14(%ebp)
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    12c0:	83 ec 04             	sub    $0x4,%esp
+    12c3:	68 00 20 00 00       	push   $0x2000
+    12c8:	68 60 9d 01 00       	push   $0x19d60
+    12cd:	ff 75 e0             	push   -0x20(%ebp)
+    12d0:	e8 18 37 00 00       	call   49ed <read>
+    12d5:	83 c4 10             	add    $0x10,%esp
+    12d8:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    12db:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+    12df:	7f 95                	jg     1276 <fourfiles+0x184>
+    }
+    close(fd);
+    12e1:	83 ec 0c             	sub    $0xc,%esp
+    12e4:	ff 75 e0             	push   -0x20(%ebp)
+    12e7:	e8 11 37 00 00       	call   49fd <close>
+    12ec:	83 c4 10             	add    $0x10,%esp
+    if(total != 12*500){
+    12ef:	81 7d ec 70 17 00 00 	cmpl   $0x1770,-0x14(%ebp)
+    12f6:	74 1a                	je     1312 <fourfiles+0x220>
+      printf(1, "wrong length %d\n", total);
+    12f8:	83 ec 04             	sub    $0x4,%esp
+    12fb:	ff 75 ec             	push   -0x14(%ebp)
+    12fe:	68 d1 55 00 00       	push   $0x55d1
+    1303:	6a 01                	push   $0x1
+    1305:	e8 87 38 00 00       	call   4b91 <printf>
+    130a:	83 c4 10             	add    $0x10,%esp
+      exit();
+    130d:	e8 c3 36 00 00       	call   49d5 <exit>
+    }
+    unlink(fname);
+    1312:	83 ec 0c             	sub    $0xc,%esp
+    1315:	ff 75 e4             	push   -0x1c(%ebp)
+    1318:	e8 08 37 00 00       	call   4a25 <unlink>
+    131d:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 2; i++){
+    1320:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1324:	83 7d f4 01          	cmpl   $0x1,-0xc(%ebp)
+    1328:	0f 8e 22 ff ff ff    	jle    1250 <fourfiles+0x15e>
+  }
+
+  printf(1, "fourfiles ok\n");
+    132e:	83 ec 08             	sub    $0x8,%esp
+    1331:	68 e2 55 00 00       	push   $0x55e2
+    1336:	6a 01                	push   $0x1
+    1338:	e8 54 38 00 00       	call   4b91 <printf>
+    133d:	83 c4 10             	add    $0x10,%esp
+}
+    1340:	90                   	nop
+    1341:	c9                   	leave
+    1342:	c3                   	ret
+
+00001343 <groupcommit>:
+// they change its blocks, the inode blocks and the bitmap while
+// the previous transaction, which changed them too, commits;
+// a fifth keeps the log busy with large writes
+void
+groupcommit(void)
+{
+    1343:	55                   	push   %ebp
+    1344:	89 e5                	mov    %esp,%ebp
+    1346:	83 ec 28             	sub    $0x28,%esp
+  enum { N = 40 };
+  char name[8];
+  int pid, i, fd, pi, n;
+
+  printf(1, "groupcommit test\n");
+    1349:	83 ec 08             	sub    $0x8,%esp
+    134c:	68 f0 55 00 00       	push   $0x55f0
+    1351:	6a 01                	push   $0x1
+    1353:	e8 39 38 00 00       	call   4b91 <printf>
+    1358:	83 c4 10             	add    $0x10,%esp
+  if(mkdir("gc") < 0){
+    135b:	83 ec 0c             	sub    $0xc,%esp
+    135e:	68 02 56 00 00       	push   $0x5602
+    1363:	e8 d5 36 00 00       	call   4a3d <mkdir>
+    1368:	83 c4 10             	add    $0x10,%esp
+    136b:	85 c0                	test   %eax,%eax
+    136d:	79 17                	jns    1386 <groupcommit+0x43>
+    printf(1, "groupcommit: mkdir failed\n");
+    136f:	83 ec 08             	sub    $0x8,%esp
+    1372:	68 05 56 00 00       	push   $0x5605
+    1377:	6a 01                	push   $0x1
+    1379:	e8 13 38 00 00       	call   4b91 <printf>
+    137e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1381:	e8 4f 36 00 00       	call   49d5 <exit>
+  }
+
+  for(pi = 0; pi < 5; pi++){
+    1386:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    138d:	e9 8e 01 00 00       	jmp    1520 <groupcommit+0x1dd>
+    pid = fork();
+    1392:	e8 36 36 00 00       	call   49cd <fork>
+    1397:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(pid < 0){
+    139a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+    139e:	79 17                	jns    13b7 <groupcommit+0x74>
+      printf(1, "fork failed\n");
+    13a0:	83 ec 08             	sub    $0x8,%esp
+    13a3:	68 0d 50 00 00       	push   $0x500d
+    13a8:	6a 01                	push   $0x1
+    13aa:	e8 e2 37 00 00       	call   4b91 <printf>
+    13af:	83 c4 10             	add    $0x10,%esp
+      exit();
+    13b2:	e8 1e 36 00 00       	call   49d5 <exit>
+    }
+    if(pid > 0)
+    13b7:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+    13bb:	0f 8f 5a 01 00 00    	jg     151b <groupcommit+0x1d8>
+      continue;
+
+    if(pi == 4){
+    13c1:	83 7d f0 04          	cmpl   $0x4,-0x10(%ebp)
+    13c5:	75 74                	jne    143b <groupcommit+0xf8>
+      fd = open("gc/big", O_CREATE|O_RDWR);
+    13c7:	83 ec 08             	sub    $0x8,%esp
+    13ca:	68 02 02 00 00       	push   $0x202
+    13cf:	68 20 56 00 00       	push   $0x5620
+    13d4:	e8 3c 36 00 00       	call   4a15 <open>
+    13d9:	83 c4 10             	add    $0x10,%esp
+    13dc:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      for(i = 0; i < 40; i++){
+    13df:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    13e6:	eb 3a                	jmp    1422 <groupcommit+0xdf>
+        if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    13e8:	83 ec 04             	sub    $0x4,%esp
+    13eb:	68 00 20 00 00       	push   $0x2000
+    13f0:	68 60 9d 01 00       	push   $0x19d60
+    13f5:	ff 75 ec             	push   -0x14(%ebp)
+    13f8:	e8 f8 35 00 00       	call   49f5 <write>
+    13fd:	83 c4 10             	add    $0x10,%esp
+    1400:	3d 00 20 00 00       	cmp    $0x2000,%eax
+    1405:	74 17                	je     141e <groupcommit+0xdb>
+          printf(1, "groupcommit: write big failed\n");
+    1407:	83 ec 08             	sub    $0x8,%esp
+    140a:	68 28 56 00 00       	push   $0x5628
+    140f:	6a 01                	push   $0x1
+    1411:	e8 7b 37 00 00       	call   4b91 <printf>
+    1416:	83 c4 10             	add    $0x10,%esp
+          exit();
+    1419:	e8 b7 35 00 00       	call   49d5 <exit>
+      for(i = 0; i < 40; i++){
+    141e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1422:	83 7d f4 27          	cmpl   $0x27,-0xc(%ebp)
+    1426:	7e c0                	jle    13e8 <groupcommit+0xa5>
+        }
+      }
+      close(fd);
+    1428:	83 ec 0c             	sub    $0xc,%esp
+    142b:	ff 75 ec             	push   -0x14(%ebp)
+    142e:	e8 ca 35 00 00       	call   49fd <close>
+    1433:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1436:	e8 9a 35 00 00       	call   49d5 <exit>
+    }
+
+    name[0] = 'g';
+    143b:	c6 45 dc 67          	movb   $0x67,-0x24(%ebp)
+    name[1] = 'c';
+    143f:	c6 45 dd 63          	movb   $0x63,-0x23(%ebp)
+    name[2] = '/';
+    1443:	c6 45 de 2f          	movb   $0x2f,-0x22(%ebp)
+    name[3] = 'p' + pi;
+    1447:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    144a:	83 c0 70             	add    $0x70,%eax
+    144d:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[6] = '\0';
+    1450:	c6 45 e2 00          	movb   $0x0,-0x1e(%ebp)
+    for(i = 0; i < N; i++){
+    1454:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    145b:	e9 ac 00 00 00       	jmp    150c <groupcommit+0x1c9>
+      name[4] = '0' + i / 10;
+    1460:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    1463:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    1468:	89 c8                	mov    %ecx,%eax
+    146a:	f7 ea                	imul   %edx
+    146c:	c1 fa 02             	sar    $0x2,%edx
+    146f:	89 c8                	mov    %ecx,%eax
+    1471:	c1 f8 1f             	sar    $0x1f,%eax
+    1474:	29 c2                	sub    %eax,%edx
+    1476:	89 d0                	mov    %edx,%eax
+    1478:	83 c0 30             	add    $0x30,%eax
+    147b:	88 45 e0             	mov    %al,-0x20(%ebp)
+      name[5] = '0' + i % 10;
+    147e:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    1481:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    1486:	89 c8                	mov    %ecx,%eax
+    1488:	f7 ea                	imul   %edx
+    148a:	c1 fa 02             	sar    $0x2,%edx
+    148d:	89 c8                	mov    %ecx,%eax
+    148f:	c1 f8 1f             	sar    $0x1f,%eax
+    1492:	29 c2                	sub    %eax,%edx
+    1494:	89 d0                	mov    %edx,%eax
+    1496:	c1 e0 02             	shl    $0x2,%eax
+    1499:	01 d0                	add    %edx,%eax
+    149b:	01 c0                	add    %eax,%eax
+    149d:	29 c1                	sub    %eax,%ecx
+    149f:	89 ca                	mov    %ecx,%edx
+    14a1:	89 d0                	mov    %edx,%eax
+    14a3:	83 c0 30             	add    $0x30,%eax
+    14a6:	88 45 e1             	mov    %al,-0x1f(%ebp)
+      fd = open(name, O_CREATE|O_RDWR);
+    14a9:	83 ec 08             	sub    $0x8,%esp
+    14ac:	68 02 02 00 00       	push   $0x202
+    14b1:	8d 45 dc             	lea    -0x24(%ebp),%eax
+    14b4:	50                   	push   %eax
+    14b5:	e8 5b 35 00 00       	call   4a15 <open>
+    14ba:	83 c4 10             	add    $0x10,%esp
+    14bd:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      if(fd < 0 || write(fd, name, sizeof(name)) != sizeof(name)){
+    14c0:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    14c4:	78 19                	js     14df <groupcommit+0x19c>
+    14c6:	83 ec 04             	sub    $0x4,%esp
+    14c9:	6a 08                	push   $0x8
+    14cb:	8d 45 dc             	lea    -0x24(%ebp),%eax
+    14ce:	50                   	push   %eax
+    14cf:	ff 75 ec             	push   -0x14(%ebp)
+    14d2:	e8 1e 35 00 00       	call   49f5 <write>
+    14d7:	83 c4 10             	add    $0x10,%esp
+    14da:	83 f8 08             	cmp    $0x8,%eax
+    14dd:	74 1b                	je     14fa <groupcommit+0x1b7>
+        printf(1, "groupcommit: create %s failed\n", name);
+    14df:	83 ec 04             	sub    $0x4,%esp
+    14e2:	8d 45 dc             	lea    -0x24(%ebp),%eax
+    14e5:	50                   	push   %eax
+    14e6:	68 48 56 00 00       	push   $0x5648
+    14eb:	6a 01                	push   $0x1
+    14ed:	e8 9f 36 00 00       	call   4b91 <printf>
+    14f2:	83 c4 10             	add    $0x10,%esp
+        exit();
+    14f5:	e8 db 34 00 00       	call   49d5 <exit>
+      }
+      close(fd);
+    14fa:	83 ec 0c             	sub    $0xc,%esp
+    14fd:	ff 75 ec             	push   -0x14(%ebp)
+    1500:	e8 f8 34 00 00       	call   49fd <close>
+    1505:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < N; i++){
+    1508:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    150c:	83 7d f4 27          	cmpl   $0x27,-0xc(%ebp)
+    1510:	0f 8e 4a ff ff ff    	jle    1460 <groupcommit+0x11d>
+    }
+    exit();
+    1516:	e8 ba 34 00 00       	call   49d5 <exit>
+      continue;
+    151b:	90                   	nop
+  for(pi = 0; pi < 5; pi++){
+    151c:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    1520:	83 7d f0 04          	cmpl   $0x4,-0x10(%ebp)
+    1524:	0f 8e 68 fe ff ff    	jle    1392 <groupcommit+0x4f>
+  }
+
+  for(pi = 0; pi < 5; pi++)
+    152a:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    1531:	eb 09                	jmp    153c <groupcommit+0x1f9>
+    wait();
+    1533:	e8 a5 34 00 00       	call   49dd <wait>
+  for(pi = 0; pi < 5; pi++)
+    1538:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    153c:	83 7d f0 04          	cmpl   $0x4,-0x10(%ebp)
+    1540:	7e f1                	jle    1533 <groupcommit+0x1f0>
+
+  for(pi = 0; pi < 4; pi++){
+    1542:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    1549:	e9 0b 01 00 00       	jmp    1659 <groupcommit+0x316>
+    name[0] = 'g';
+    154e:	c6 45 dc 67          	movb   $0x67,-0x24(%ebp)
+    name[1] = 'c';
+    1552:	c6 45 dd 63          	movb   $0x63,-0x23(%ebp)
+    name[2] = '/';
+    1556:	c6 45 de 2f          	movb   $0x2f,-0x22(%ebp)
+    name[3] = 'p' + pi;
+    155a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    155d:	83 c0 70             	add    $0x70,%eax
+    1560:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[6] = '\0';
+    1563:	c6 45 e2 00          	movb   $0x0,-0x1e(%ebp)
+    for(i = 0; i < N; i++){
+    1567:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    156e:	e9 d8 00 00 00       	jmp    164b <groupcommit+0x308>
+      name[4] = '0' + i / 10;
+    1573:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    1576:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    157b:	89 c8                	mov    %ecx,%eax
+    157d:	f7 ea                	imul   %edx
+    157f:	c1 fa 02             	sar    $0x2,%edx
+    1582:	89 c8                	mov    %ecx,%eax
+    1584:	c1 f8 1f             	sar    $0x1f,%eax
+    1587:	29 c2                	sub    %eax,%edx
+    1589:	89 d0                	mov    %edx,%eax
+    158b:	83 c0 30             	add    $0x30,%eax
+    158e:	88 45 e0             	mov    %al,-0x20(%ebp)
+      name[5] = '0' + i % 10;
+    1591:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    1594:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    1599:	89 c8                	mov    %ecx,%eax
+    159b:	f7 ea                	imul   %edx
+    159d:	c1 fa 02             	sar    $0x2,%edx
+    15a0:	89 c8                	mov    %ecx,%eax
+    15a2:	c1 f8 1f             	sar    $0x1f,%eax
+    15a5:	29 c2                	sub    %eax,%edx
+    15a7:	89 d0                	mov    %edx,%eax
+    15a9:	c1 e0 02             	shl    $0x2,%eax
+    15ac:	01 d0                	add    %edx,%eax
+    15ae:	01 c0                	add    %eax,%eax
+    15b0:	29 c1                	sub    %eax,%ecx
+    15b2:	89 ca                	mov    %ecx,%edx
+    15b4:	89 d0                	mov    %edx,%eax
+    15b6:	83 c0 30             	add    $0x30,%eax
+    15b9:	88 45 e1             	mov    %al,-0x1f(%ebp)
+      fd = open(name, O_RDONLY);
+    15bc:	83 ec 08             	sub    $0x8,%esp
+    15bf:	6a 00                	push   $0x0
+    15c1:	8d 45 dc             	lea    -0x24(%ebp),%eax
+    15c4:	50                   	push   %eax
+    15c5:	e8 4b 34 00 00       	call   4a15 <open>
+    15ca:	83 c4 10             	add    $0x10,%esp
+    15cd:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      if(fd < 0 || (n = read(fd, buf, sizeof(buf))) != sizeof(name) ||
+    15d0:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    15d4:	78 39                	js     160f <groupcommit+0x2cc>
+    15d6:	83 ec 04             	sub    $0x4,%esp
+    15d9:	68 00 20 00 00       	push   $0x2000
+    15de:	68 60 9d 01 00       	push   $0x19d60
+    15e3:	ff 75 ec             	push   -0x14(%ebp)
+    15e6:	e8 02 34 00 00       	call   49ed <read>
+    15eb:	83 c4 10             	add    $0x10,%esp
+    15ee:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    15f1:	83 7d e8 08          	cmpl   $0x8,-0x18(%ebp)
+    15f5:	75 18                	jne    160f <groupcommit+0x2cc>
+         strcmp(buf, name) != 0){
+    15f7:	83 ec 08             	sub    $0x8,%esp
+    15fa:	8d 45 dc             	lea    -0x24(%ebp),%eax
+    15fd:	50                   	push   %eax
+    15fe:	68 60 9d 01 00       	push   $0x19d60
+    1603:	e8 5b 31 00 00       	call   4763 <strcmp>
+    1608:	83 c4 10             	add    $0x10,%esp
+      if(fd < 0 || (n = read(fd, buf, sizeof(buf))) != sizeof(name) ||
+    160b:	85 c0                	test   %eax,%eax
+    160d:	74 1b                	je     162a <groupcommit+0x2e7>
+        printf(1, "groupcommit: %s is missing or wrong\n", name);
+    160f:	83 ec 04             	sub    $0x4,%esp
+    1612:	8d 45 dc             	lea    -0x24(%ebp),%eax
+    1615:	50                   	push   %eax
+    1616:	68 68 56 00 00       	push   $0x5668
+    161b:	6a 01                	push   $0x1
+    161d:	e8 6f 35 00 00       	call   4b91 <printf>
+    1622:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1625:	e8 ab 33 00 00       	call   49d5 <exit>
+      }
+      close(fd);
+    162a:	83 ec 0c             	sub    $0xc,%esp
+    162d:	ff 75 ec             	push   -0x14(%ebp)
+    1630:	e8 c8 33 00 00       	call   49fd <close>
+    1635:	83 c4 10             	add    $0x10,%esp
+      unlink(name);
+    1638:	83 ec 0c             	sub    $0xc,%esp
+    163b:	8d 45 dc             	lea    -0x24(%ebp),%eax
+    163e:	50                   	push   %eax
+    163f:	e8 e1 33 00 00       	call   4a25 <unlink>
+    1644:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < N; i++){
+    1647:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    164b:	83 7d f4 27          	cmpl   $0x27,-0xc(%ebp)
+    164f:	0f 8e 1e ff ff ff    	jle    1573 <groupcommit+0x230>
+  for(pi = 0; pi < 4; pi++){
+    1655:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    1659:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    165d:	0f 8e eb fe ff ff    	jle    154e <groupcommit+0x20b>
+    }
+  }
+  unlink("gc/big");
+    1663:	83 ec 0c             	sub    $0xc,%esp
+    1666:	68 20 56 00 00       	push   $0x5620
+    166b:	e8 b5 33 00 00       	call   4a25 <unlink>
+    1670:	83 c4 10             	add    $0x10,%esp
+  if(unlink("gc") < 0){
+    1673:	83 ec 0c             	sub    $0xc,%esp
+    1676:	68 02 56 00 00       	push   $0x5602
+    167b:	e8 a5 33 00 00       	call   4a25 <unlink>
+    1680:	83 c4 10             	add    $0x10,%esp
+    1683:	85 c0                	test   %eax,%eax
+    1685:	79 17                	jns    169e <groupcommit+0x35b>
+    printf(1, "groupcommit: unlink gc failed\n");
+    1687:	83 ec 08             	sub    $0x8,%esp
+    168a:	68 90 56 00 00       	push   $0x5690
+    168f:	6a 01                	push   $0x1
+    1691:	e8 fb 34 00 00       	call   4b91 <printf>
+    1696:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1699:	e8 37 33 00 00       	call   49d5 <exit>
+  }
+  printf(1, "groupcommit ok\n");
+    169e:	83 ec 08             	sub    $0x8,%esp
+    16a1:	68 af 56 00 00       	push   $0x56af
+    16a6:	6a 01                	push   $0x1
+    16a8:	e8 e4 34 00 00       	call   4b91 <printf>
+    16ad:	83 c4 10             	add    $0x10,%esp
+}
+    16b0:	90                   	nop
+    16b1:	c9                   	leave
+    16b2:	c3                   	ret
+
+000016b3 <createdelete>:
+
+// four processes create and delete different files in same directory
+void
+createdelete(void)
+{
+    16b3:	55                   	push   %ebp
+    16b4:	89 e5                	mov    %esp,%ebp
+    16b6:	83 ec 38             	sub    $0x38,%esp
+  enum { N = 20 };
+  int pid, i, fd, pi;
+  char name[32];
+
+  printf(1, "createdelete test\n");
+    16b9:	83 ec 08             	sub    $0x8,%esp
+    16bc:	68 bf 56 00 00       	push   $0x56bf
+    16c1:	6a 01                	push   $0x1
+    16c3:	e8 c9 34 00 00       	call   4b91 <printf>
+    16c8:	83 c4 10             	add    $0x10,%esp
+
+  for(pi = 0; pi < 4; pi++){
+    16cb:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    16d2:	e9 f6 00 00 00       	jmp    17cd <createdelete+0x11a>
+    pid = fork();
+    16d7:	e8 f1 32 00 00       	call   49cd <fork>
+    16dc:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(pid < 0){
+    16df:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    16e3:	79 17                	jns    16fc <createdelete+0x49>
+      printf(1, "fork failed\n");
+    16e5:	83 ec 08             	sub    $0x8,%esp
+    16e8:	68 0d 50 00 00       	push   $0x500d
+    16ed:	6a 01                	push   $0x1
+    16ef:	e8 9d 34 00 00       	call   4b91 <printf>
+    16f4:	83 c4 10             	add    $0x10,%esp
+      exit();
+    16f7:	e8 d9 32 00 00       	call   49d5 <exit>
+    }
+
+    if(pid == 0){
+    16fc:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1700:	0f 85 c3 00 00 00    	jne    17c9 <createdelete+0x116>
+      name[0] = 'p' + pi;
+    1706:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1709:	83 c0 70             	add    $0x70,%eax
+    170c:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[2] = '\0';
+    170f:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+      for(i = 0; i < N; i++){
+    1713:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    171a:	e9 9b 00 00 00       	jmp    17ba <createdelete+0x107>
+        name[1] = '0' + i;
+    171f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1722:	83 c0 30             	add    $0x30,%eax
+    1725:	88 45 c9             	mov    %al,-0x37(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    1728:	83 ec 08             	sub    $0x8,%esp
+    172b:	68 02 02 00 00       	push   $0x202
+    1730:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    1733:	50                   	push   %eax
+    1734:	e8 dc 32 00 00       	call   4a15 <open>
+    1739:	83 c4 10             	add    $0x10,%esp
+    173c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+        if(fd < 0){
+    173f:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1743:	79 17                	jns    175c <createdelete+0xa9>
+          printf(1, "create failed\n");
+    1745:	83 ec 08             	sub    $0x8,%esp
+    1748:	68 a5 55 00 00       	push   $0x55a5
+    174d:	6a 01                	push   $0x1
+    174f:	e8 3d 34 00 00       	call   4b91 <printf>
+    1754:	83 c4 10             	add    $0x10,%esp
+          exit();
+    1757:	e8 79 32 00 00       	call   49d5 <exit>
+        }
+        close(fd);
+    175c:	83 ec 0c             	sub    $0xc,%esp
+    175f:	ff 75 ec             	push   -0x14(%ebp)
+    1762:	e8 96 32 00 00       	call   49fd <close>
+    1767:	83 c4 10             	add    $0x10,%esp
+        if(i > 0 && (i % 2 ) == 0){
+    176a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    176e:	7e 46                	jle    17b6 <createdelete+0x103>
+    1770:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1773:	83 e0 01             	and    $0x1,%eax
+    1776:	85 c0                	test   %eax,%eax
+    1778:	75 3c                	jne    17b6 <createdelete+0x103>
+          name[1] = '0' + (i / 2);
+    177a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    177d:	89 c2                	mov    %eax,%edx
+    177f:	c1 ea 1f             	shr    $0x1f,%edx
+    1782:	01 d0                	add    %edx,%eax
+    1784:	d1 f8                	sar    %eax
+    1786:	83 c0 30             	add    $0x30,%eax
+    1789:	88 45 c9             	mov    %al,-0x37(%ebp)
+          if(unlink(name) < 0){
+    178c:	83 ec 0c             	sub    $0xc,%esp
+    178f:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    1792:	50                   	push   %eax
+    1793:	e8 8d 32 00 00       	call   4a25 <unlink>
+    1798:	83 c4 10             	add    $0x10,%esp
+    179b:	85 c0                	test   %eax,%eax
+    179d:	79 17                	jns    17b6 <createdelete+0x103>
+            printf(1, "unlink failed\n");
+    179f:	83 ec 08             	sub    $0x8,%esp
+    17a2:	68 90 50 00 00       	push   $0x5090
+    17a7:	6a 01                	push   $0x1
+    17a9:	e8 e3 33 00 00       	call   4b91 <printf>
+    17ae:	83 c4 10             	add    $0x10,%esp
+            exit();
+    17b1:	e8 1f 32 00 00       	call   49d5 <exit>
+      for(i = 0; i < N; i++){
+    17b6:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    17ba:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    17be:	0f 8e 5b ff ff ff    	jle    171f <createdelete+0x6c>
+          }
+        }
+      }
+      exit();
+    17c4:	e8 0c 32 00 00       	call   49d5 <exit>
+  for(pi = 0; pi < 4; pi++){
+    17c9:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    17cd:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    17d1:	0f 8e 00 ff ff ff    	jle    16d7 <createdelete+0x24>
+    }
+  }
+
+  for(pi = 0; pi < 4; pi++){
+    17d7:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    17de:	eb 09                	jmp    17e9 <createdelete+0x136>
+    wait();
+    17e0:	e8 f8 31 00 00       	call   49dd <wait>
+  for(pi = 0; pi < 4; pi++){
+    17e5:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    17e9:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    17ed:	7e f1                	jle    17e0 <createdelete+0x12d>
+  }
+
+  name[0] = name[1] = name[2] = 0;
+    17ef:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    17f3:	0f b6 45 ca          	movzbl -0x36(%ebp),%eax
+    17f7:	88 45 c9             	mov    %al,-0x37(%ebp)
+    17fa:	0f b6 45 c9          	movzbl -0x37(%ebp),%eax
+    17fe:	88 45 c8             	mov    %al,-0x38(%ebp)
+  for(i = 0; i < N; i++){
+    1801:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1808:	e9 b2 00 00 00       	jmp    18bf <createdelete+0x20c>
+    for(pi = 0; pi < 4; pi++){
+    180d:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    1814:	e9 98 00 00 00       	jmp    18b1 <createdelete+0x1fe>
+      name[0] = 'p' + pi;
+    1819:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    181c:	83 c0 70             	add    $0x70,%eax
+    181f:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    1822:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1825:	83 c0 30             	add    $0x30,%eax
+    1828:	88 45 c9             	mov    %al,-0x37(%ebp)
+      fd = open(name, 0);
+    182b:	83 ec 08             	sub    $0x8,%esp
+    182e:	6a 00                	push   $0x0
+    1830:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    1833:	50                   	push   %eax
+    1834:	e8 dc 31 00 00       	call   4a15 <open>
+    1839:	83 c4 10             	add    $0x10,%esp
+    183c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      if((i == 0 || i >= N/2) && fd < 0){
+    183f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1843:	74 06                	je     184b <createdelete+0x198>
+    1845:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+    1849:	7e 21                	jle    186c <createdelete+0x1b9>
+    184b:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    184f:	79 1b                	jns    186c <createdelete+0x1b9>
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    1851:	83 ec 04             	sub    $0x4,%esp
+    1854:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    1857:	50                   	push   %eax
+    1858:	68 d4 56 00 00       	push   $0x56d4
+    185d:	6a 01                	push   $0x1
+    185f:	e8 2d 33 00 00       	call   4b91 <printf>
+    1864:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1867:	e8 69 31 00 00       	call   49d5 <exit>
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    186c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1870:	7e 27                	jle    1899 <createdelete+0x1e6>
+    1872:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+    1876:	7f 21                	jg     1899 <createdelete+0x1e6>
+    1878:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    187c:	78 1b                	js     1899 <createdelete+0x1e6>
+        printf(1, "oops createdelete %s did exist\n", name);
+    187e:	83 ec 04             	sub    $0x4,%esp
+    1881:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    1884:	50                   	push   %eax
+    1885:	68 f8 56 00 00       	push   $0x56f8
+    188a:	6a 01                	push   $0x1
+    188c:	e8 00 33 00 00       	call   4b91 <printf>
+    1891:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1894:	e8 3c 31 00 00       	call   49d5 <exit>
+      }
+      if(fd >= 0)
+    1899:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    189d:	78 0e                	js     18ad <createdelete+0x1fa>
+        close(fd);
+    189f:	83 ec 0c             	sub    $0xc,%esp
+    18a2:	ff 75 ec             	push   -0x14(%ebp)
+    18a5:	e8 53 31 00 00       	call   49fd <close>
+    18aa:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    18ad:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    18b1:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    18b5:	0f 8e 5e ff ff ff    	jle    1819 <createdelete+0x166>
+  for(i = 0; i < N; i++){
+    18bb:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    18bf:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    18c3:	0f 8e 44 ff ff ff    	jle    180d <createdelete+0x15a>
+    }
+  }
+
+  for(i = 0; i < N; i++){
+    18c9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    18d0:	eb 38                	jmp    190a <createdelete+0x257>
+    for(pi = 0; pi < 4; pi++){
+    18d2:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    18d9:	eb 25                	jmp    1900 <createdelete+0x24d>
+      name[0] = 'p' + i;
+    18db:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    18de:	83 c0 70             	add    $0x70,%eax
+    18e1:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    18e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    18e7:	83 c0 30             	add    $0x30,%eax
+    18ea:	88 45 c9             	mov    %al,-0x37(%ebp)
+      unlink(name);
+    18ed:	83 ec 0c             	sub    $0xc,%esp
+    18f0:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    18f3:	50                   	push   %eax
+    18f4:	e8 2c 31 00 00       	call   4a25 <unlink>
+    18f9:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    18fc:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    1900:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    1904:	7e d5                	jle    18db <createdelete+0x228>
+  for(i = 0; i < N; i++){
+    1906:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    190a:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    190e:	7e c2                	jle    18d2 <createdelete+0x21f>
+    }
+  }
+
+  printf(1, "createdelete ok\n");
+    1910:	83 ec 08             	sub    $0x8,%esp
+    1913:	68 18 57 00 00       	push   $0x5718
+    1918:	6a 01                	push   $0x1
+    191a:	e8 72 32 00 00       	call   4b91 <printf>
+    191f:	83 c4 10             	add    $0x10,%esp
+}
+    1922:	90                   	nop
+    1923:	c9                   	leave
+    1924:	c3                   	ret
+
+00001925 <unlinkread>:
+
+// can I unlink a file and still read it?
+void
+unlinkread(void)
+{
+    1925:	55                   	push   %ebp
+    1926:	89 e5                	mov    %esp,%ebp
+    1928:	83 ec 18             	sub    $0x18,%esp
+  int fd, fd1;
+
+  printf(1, "unlinkread test\n");
+    192b:	83 ec 08             	sub    $0x8,%esp
+    192e:	68 29 57 00 00       	push   $0x5729
+    1933:	6a 01                	push   $0x1
+    1935:	e8 57 32 00 00       	call   4b91 <printf>
+    193a:	83 c4 10             	add    $0x10,%esp
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    193d:	83 ec 08             	sub    $0x8,%esp
+    1940:	68 02 02 00 00       	push   $0x202
+    1945:	68 3a 57 00 00       	push   $0x573a
+    194a:	e8 c6 30 00 00       	call   4a15 <open>
+    194f:	83 c4 10             	add    $0x10,%esp
+    1952:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    1955:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1959:	79 17                	jns    1972 <unlinkread+0x4d>
+    printf(1, "create unlinkread failed\n");
+    195b:	83 ec 08             	sub    $0x8,%esp
+    195e:	68 45 57 00 00       	push   $0x5745
+    1963:	6a 01                	push   $0x1
+    1965:	e8 27 32 00 00       	call   4b91 <printf>
+    196a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    196d:	e8 63 30 00 00       	call   49d5 <exit>
+  }
+  write(fd, "hello", 5);
+    1972:	83 ec 04             	sub    $0x4,%esp
+    1975:	6a 05                	push   $0x5
+    1977:	68 5f 57 00 00       	push   $0x575f
+    197c:	ff 75 f4             	push   -0xc(%ebp)
+    197f:	e8 71 30 00 00       	call   49f5 <write>
+    1984:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+    1987:	83 ec 0c             	sub    $0xc,%esp
+    198a:	ff 75 f4             	push   -0xc(%ebp)
+    198d:	e8 6b 30 00 00       	call   49fd <close>
+    1992:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("unlinkread", O_RDWR);
+    1995:	83 ec 08             	sub    $0x8,%esp
+    1998:	6a 02                	push   $0x2
+    199a:	68 3a 57 00 00       	push   $0x573a
+    199f:	e8 71 30 00 00       	call   4a15 <open>
+    19a4:	83 c4 10             	add    $0x10,%esp
+    19a7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    19aa:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    19ae:	79 17                	jns    19c7 <unlinkread+0xa2>
+    printf(1, "open unlinkread failed\n");
+    19b0:	83 ec 08             	sub    $0x8,%esp
+    19b3:	68 65 57 00 00       	push   $0x5765
+    19b8:	6a 01                	push   $0x1
+    19ba:	e8 d2 31 00 00       	call   4b91 <printf>
+    19bf:	83 c4 10             	add    $0x10,%esp
+    exit();
+    19c2:	e8 0e 30 00 00       	call   49d5 <exit>
+  }
+  if(unlink("unlinkread") != 0){
+    19c7:	83 ec 0c             	sub    $0xc,%esp
+    19ca:	68 3a 57 00 00       	push   $0x573a
+    19cf:	e8 51 30 00 00       	call   4a25 <unlink>
+    19d4:	83 c4 10             	add    $0x10,%esp
+    19d7:	85 c0                	test   %eax,%eax
+    19d9:	74 17                	je     19f2 <unlinkread+0xcd>
+    printf(1, "unlink unlinkread failed\n");
+    19db:	83 ec 08             	sub    $0x8,%esp
+    19de:	68 7d 57 00 00       	push   $0x577d
+    19e3:	6a 01                	push   $0x1
+    19e5:	e8 a7 31 00 00       	call   4b91 <printf>
+    19ea:	83 c4 10             	add    $0x10,%esp
+    exit();
+    19ed:	e8 e3 2f 00 00       	call   49d5 <exit>
+  }
+
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    19f2:	83 ec 08             	sub    $0x8,%esp
+    19f5:	68 02 02 00 00       	push   $0x202
+    19fa:	68 3a 57 00 00       	push   $0x573a
+    19ff:	e8 11 30 00 00       	call   4a15 <open>
+    1a04:	83 c4 10             	add    $0x10,%esp
+    1a07:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  write(fd1, "yyy", 3);
+    1a0a:	83 ec 04             	sub    $0x4,%esp
+    1a0d:	6a 03                	push   $0x3
+    1a0f:	68 97 57 00 00       	push   $0x5797
+    1a14:	ff 75 f0             	push   -0x10(%ebp)
+    1a17:	e8 d9 2f 00 00       	call   49f5 <write>
+    1a1c:	83 c4 10             	add    $0x10,%esp
+  close(fd1);
+    1a1f:	83 ec 0c             	sub    $0xc,%esp
+    1a22:	ff 75 f0             	push   -0x10(%ebp)
+    1a25:	e8 d3 2f 00 00       	call   49fd <close>
+    1a2a:	83 c4 10             	add    $0x10,%esp
+
+  if(read(fd, buf, sizeof(buf)) != 5){
+    1a2d:	83 ec 04             	sub    $0x4,%esp
+    1a30:	68 00 20 00 00       	push   $0x2000
+    1a35:	68 60 9d 01 00       	push   $0x19d60
+    1a3a:	ff 75 f4             	push   -0xc(%ebp)
+    1a3d:	e8 ab 2f 00 00       	call   49ed <read>
+    1a42:	83 c4 10             	add    $0x10,%esp
+    1a45:	83 f8 05             	cmp    $0x5,%eax
+    1a48:	74 17                	je     1a61 <unlinkread+0x13c>
+    printf(1, "unlinkread read failed");
+    1a4a:	83 ec 08             	sub    $0x8,%esp
+    1a4d:	68 9b 57 00 00       	push   $0x579b
+    1a52:	6a 01                	push   $0x1
+    1a54:	e8 38 31 00 00       	call   4b91 <printf>
+    1a59:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1a5c:	e8 74 2f 00 00       	call   49d5 <exit>
+  }
+  if(buf[0] != 'h'){
+    1a61:	0f b6 05 60 9d 01 00 	movzbl 0x19d60,%eax
+    1a68:	3c 68                	cmp    $0x68,%al
+    1a6a:	74 17                	je     1a83 <unlinkread+0x15e>
+    printf(1, "unlinkread wrong data\n");
+    1a6c:	83 ec 08             	sub    $0x8,%esp
+    1a6f:	68 b2 57 00 00       	push   $0x57b2
+    1a74:	6a 01                	push   $0x1
+    1a76:	e8 16 31 00 00       	call   4b91 <printf>
+    1a7b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1a7e:	e8 52 2f 00 00       	call   49d5 <exit>
+  }
+  if(write(fd, buf, 10) != 10){
+    1a83:	83 ec 04             	sub    $0x4,%esp
+    1a86:	6a 0a                	push   $0xa
+    1a88:	68 60 9d 01 00       	push   $0x19d60
+    1a8d:	ff 75 f4             	push   -0xc(%ebp)
+    1a90:	e8 60 2f 00 00       	call   49f5 <write>
+    1a95:	83 c4 10             	add    $0x10,%esp
+    1a98:	83 f8 0a             	cmp    $0xa,%eax
+    1a9b:	74 17                	je     1ab4 <unlinkread+0x18f>
+    printf(1, "unlinkread write failed\n");
+    1a9d:	83 ec 08             	sub    $0x8,%esp
+    1aa0:	68 c9 57 00 00       	push   $0x57c9
+    1aa5:	6a 01                	push   $0x1
+    1aa7:	e8 e5 30 00 00       	call   4b91 <printf>
+    1aac:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1aaf:	e8 21 2f 00 00       	call   49d5 <exit>
+  }
+  close(fd);
+    1ab4:	83 ec 0c             	sub    $0xc,%esp
+    1ab7:	ff 75 f4             	push   -0xc(%ebp)
+    1aba:	e8 3e 2f 00 00       	call   49fd <close>
+    1abf:	83 c4 10             	add    $0x10,%esp
+  unlink("unlinkread");
+    1ac2:	83 ec 0c             	sub    $0xc,%esp
+    1ac5:	68 3a 57 00 00       	push   $0x573a
+    1aca:	e8 56 2f 00 00       	call   4a25 <unlink>
+    1acf:	83 c4 10             	add    $0x10,%esp
+  printf(1, "unlinkread ok\n");
+    1ad2:	83 ec 08             	sub    $0x8,%esp
+    1ad5:	68 e2 57 00 00       	push   $0x57e2
+    1ada:	6a 01                	push   $0x1
+    1adc:	e8 b0 30 00 00       	call   4b91 <printf>
+    1ae1:	83 c4 10             	add    $0x10,%esp
+}
+    1ae4:	90                   	nop
+    1ae5:	c9                   	leave
+    1ae6:	c3                   	ret
+
+00001ae7 <linktest>:
+
+void
+linktest(void)
+{
+    1ae7:	55                   	push   %ebp
+    1ae8:	89 e5                	mov    %esp,%ebp
+    1aea:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  printf(1, "linktest\n");
+    1aed:	83 ec 08             	sub    $0x8,%esp
+    1af0:	68 f1 57 00 00       	push   $0x57f1
+    1af5:	6a 01                	push   $0x1
+    1af7:	e8 95 30 00 00       	call   4b91 <printf>
+    1afc:	83 c4 10             	add    $0x10,%esp
+
+  unlink("lf1");
+    1aff:	83 ec 0c             	sub    $0xc,%esp
+    1b02:	68 fb 57 00 00       	push   $0x57fb
+    1b07:	e8 19 2f 00 00       	call   4a25 <unlink>
+    1b0c:	83 c4 10             	add    $0x10,%esp
+  unlink("lf2");
+    1b0f:	83 ec 0c             	sub    $0xc,%esp
+    1b12:	68 ff 57 00 00       	push   $0x57ff
+    1b17:	e8 09 2f 00 00       	call   4a25 <unlink>
+    1b1c:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("lf1", O_CREATE|O_RDWR);
+    1b1f:	83 ec 08             	sub    $0x8,%esp
+    1b22:	68 02 02 00 00       	push   $0x202
+    1b27:	68 fb 57 00 00       	push   $0x57fb
+    1b2c:	e8 e4 2e 00 00       	call   4a15 <open>
+    1b31:	83 c4 10             	add    $0x10,%esp
+    1b34:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    1b37:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1b3b:	79 17                	jns    1b54 <linktest+0x6d>
+    printf(1, "create lf1 failed\n");
+    1b3d:	83 ec 08             	sub    $0x8,%esp
+    1b40:	68 03 58 00 00       	push   $0x5803
+    1b45:	6a 01                	push   $0x1
+    1b47:	e8 45 30 00 00       	call   4b91 <printf>
+    1b4c:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1b4f:	e8 81 2e 00 00       	call   49d5 <exit>
+  }
+  if(write(fd, "hello", 5) != 5){
+    1b54:	83 ec 04             	sub    $0x4,%esp
+    1b57:	6a 05                	push   $0x5
+    1b59:	68 5f 57 00 00       	push   $0x575f
+    1b5e:	ff 75 f4             	push   -0xc(%ebp)
+    1b61:	e8 8f 2e 00 00       	call   49f5 <write>
+    1b66:	83 c4 10             	add    $0x10,%esp
+    1b69:	83 f8 05             	cmp    $0x5,%eax
+    1b6c:	74 17                	je     1b85 <linktest+0x9e>
+    printf(1, "write lf1 failed\n");
+    1b6e:	83 ec 08             	sub    $0x8,%esp
+    1b71:	68 16 58 00 00       	push   $0x5816
+    1b76:	6a 01                	push   $0x1
+    1b78:	e8 14 30 00 00       	call   4b91 <printf>
+    1b7d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1b80:	e8 50 2e 00 00       	call   49d5 <exit>
+  }
+  close(fd);
+    1b85:	83 ec 0c             	sub    $0xc,%esp
+    1b88:	ff 75 f4             	push   -0xc(%ebp)
+    1b8b:	e8 6d 2e 00 00       	call   49fd <close>
+    1b90:	83 c4 10             	add    $0x10,%esp
+
+  if(link("lf1", "lf2") < 0){
+    1b93:	83 ec 08             	sub    $0x8,%esp
+    1b96:	68 ff 57 00 00       	push   $0x57ff
+    1b9b:	68 fb 57 00 00       	push   $0x57fb
+    1ba0:	e8 90 2e 00 00       	call   4a35 <link>
+    1ba5:	83 c4 10             	add    $0x10,%esp
+    1ba8:	85 c0                	test   %eax,%eax
+    1baa:	79 17                	jns    1bc3 <linktest+0xdc>
+    printf(1, "link lf1 lf2 failed\n");
+    1bac:	83 ec 08             	sub    $0x8,%esp
+    1baf:	68 28 58 00 00       	push   $0x5828
+    1bb4:	6a 01                	push   $0x1
+    1bb6:	e8 d6 2f 00 00       	call   4b91 <printf>
+    1bbb:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1bbe:	e8 12 2e 00 00       	call   49d5 <exit>
+  }
+  unlink("lf1");
+    1bc3:	83 ec 0c             	sub    $0xc,%esp
+    1bc6:	68 fb 57 00 00       	push   $0x57fb
+    1bcb:	e8 55 2e 00 00       	call   4a25 <unlink>
+    1bd0:	83 c4 10             	add    $0x10,%esp
+
+  if(open("lf1", 0) >= 0){
+    1bd3:	83 ec 08             	sub    $0x8,%esp
+    1bd6:	6a 00                	push   $0x0
+    1bd8:	68 fb 57 00 00       	push   $0x57fb
+    1bdd:	e8 33 2e 00 00       	call   4a15 <open>
+    1be2:	83 c4 10             	add    $0x10,%esp
+    1be5:	85 c0                	test   %eax,%eax
+    1be7:	78 17                	js     1c00 <linktest+0x119>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    1be9:	83 ec 08             	sub    $0x8,%esp
+    1bec:	68 40 58 00 00       	push   $0x5840
+    1bf1:	6a 01                	push   $0x1
+    1bf3:	e8 99 2f 00 00       	call   4b91 <printf>
+    1bf8:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1bfb:	e8 d5 2d 00 00       	call   49d5 <exit>
+  }
+
+  fd = open("lf2", 0);
+    1c00:	83 ec 08             	sub    $0x8,%esp
+    1c03:	6a 00                	push   $0x0
+    1c05:	68 ff 57 00 00       	push   $0x57ff
+    1c0a:	e8 06 2e 00 00       	call   4a15 <open>
+    1c0f:	83 c4 10             	add    $0x10,%esp
+    1c12:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    1c15:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1c19:	79 17                	jns    1c32 <linktest+0x14b>
+    printf(1, "open lf2 failed\n");
+    1c1b:	83 ec 08             	sub    $0x8,%esp
+    1c1e:	68 65 58 00 00       	push   $0x5865
+    1c23:	6a 01                	push   $0x1
+    1c25:	e8 67 2f 00 00       	call   4b91 <printf>
+    1c2a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1c2d:	e8 a3 2d 00 00       	call   49d5 <exit>
+  }
+  if(read(fd, buf, sizeof(buf)) != 5){
+    1c32:	83 ec 04             	sub    $0x4,%esp
+    1c35:	68 00 20 00 00       	push   $0x2000
+    1c3a:	68 60 9d 01 00       	push   $0x19d60
+    1c3f:	ff 75 f4             	push   -0xc(%ebp)
+    1c42:	e8 a6 2d 00 00       	call   49ed <read>
+    1c47:	83 c4 10             	add    $0x10,%esp
+    1c4a:	83 f8 05             	cmp    $0x5,%eax
+    1c4d:	74 17                	je     1c66 <linktest+0x17f>
+    printf(1, "read lf2 failed\n");
+    1c4f:	83 ec 08             	sub    $0x8,%esp
+    1c52:	68 76 58 00 00       	push   $0x5876
+    1c57:	6a 01                	push   $0x1
+    1c59:	e8 33 2f 00 00       	call   4b91 <printf>
+    1c5e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1c61:	e8 6f 2d 00 00       	call   49d5 <exit>
+  }
+  close(fd);
+    1c66:	83 ec 0c             	sub    $0xc,%esp
+    1c69:	ff 75 f4             	push   -0xc(%ebp)
+    1c6c:	e8 8c 2d 00 00       	call   49fd <close>
+    1c71:	83 c4 10             	add    $0x10,%esp
+
+  if(link("lf2", "lf2") >= 0){
+    1c74:	83 ec 08             	sub    $0x8,%esp
+    1c77:	68 ff 57 00 00       	push   $0x57ff
+    1c7c:	68 ff 57 00 00       	push   $0x57ff
+    1c81:	e8 af 2d 00 00       	call   4a35 <link>
+    1c86:	83 c4 10             	add    $0x10,%esp
+    1c89:	85 c0                	test   %eax,%eax
+    1c8b:	78 17                	js     1ca4 <linktest+0x1bd>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    1c8d:	83 ec 08             	sub    $0x8,%esp
+    1c90:	68 87 58 00 00       	push   $0x5887
+    1c95:	6a 01                	push   $0x1
+    1c97:	e8 f5 2e 00 00       	call   4b91 <printf>
+    1c9c:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1c9f:	e8 31 2d 00 00       	call   49d5 <exit>
+  }
+
+  unlink("lf2");
+    1ca4:	83 ec 0c             	sub    $0xc,%esp
+    1ca7:	68 ff 57 00 00       	push   $0x57ff
+    1cac:	e8 74 2d 00 00       	call   4a25 <unlink>
+    1cb1:	83 c4 10             	add    $0x10,%esp
+  if(link("lf2", "lf1") >= 0){
+    1cb4:	83 ec 08             	sub    $0x8,%esp
+    1cb7:	68 fb 57 00 00       	push   $0x57fb
+    1cbc:	68 ff 57 00 00       	push   $0x57ff
+    1cc1:	e8 6f 2d 00 00       	call   4a35 <link>
+    1cc6:	83 c4 10             	add    $0x10,%esp
+    1cc9:	85 c0                	test   %eax,%eax
+    1ccb:	78 17                	js     1ce4 <linktest+0x1fd>
+    printf(1, "link non-existant succeeded! oops\n");
+    1ccd:	83 ec 08             	sub    $0x8,%esp
+    1cd0:	68 a8 58 00 00       	push   $0x58a8
+    1cd5:	6a 01                	push   $0x1
+    1cd7:	e8 b5 2e 00 00       	call   4b91 <printf>
+    1cdc:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1cdf:	e8 f1 2c 00 00       	call   49d5 <exit>
+  }
+
+  if(link(".", "lf1") >= 0){
+    1ce4:	83 ec 08             	sub    $0x8,%esp
+    1ce7:	68 fb 57 00 00       	push   $0x57fb
+    1cec:	68 cb 58 00 00       	push   $0x58cb
+    1cf1:	e8 3f 2d 00 00       	call   4a35 <link>
+    1cf6:	83 c4 10             	add    $0x10,%esp
+    1cf9:	85 c0                	test   %eax,%eax
+    1cfb:	78 17                	js     1d14 <linktest+0x22d>
+    printf(1, "link . lf1 succeeded! oops\n");
+    1cfd:	83 ec 08             	sub    $0x8,%esp
+    1d00:	68 cd 58 00 00       	push   $0x58cd
+    1d05:	6a 01                	push   $0x1
+    1d07:	e8 85 2e 00 00       	call   4b91 <printf>
+    1d0c:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1d0f:	e8 c1 2c 00 00       	call   49d5 <exit>
+  }
+
+  printf(1, "linktest ok\n");
+    1d14:	83 ec 08             	sub    $0x8,%esp
+    1d17:	68 e9 58 00 00       	push   $0x58e9
+    1d1c:	6a 01                	push   $0x1
+    1d1e:	e8 6e 2e 00 00       	call   4b91 <printf>
+    1d23:	83 c4 10             	add    $0x10,%esp
+}
+    1d26:	90                   	nop
+    1d27:	c9                   	leave
+    1d28:	c3                   	ret
+
+00001d29 <concreate>:
+
+// test concurrent create/link/unlink of the same file
+void
+concreate(void)
+{
+    1d29:	55                   	push   %ebp
+    1d2a:	89 e5                	mov    %esp,%ebp
+    1d2c:	83 ec 58             	sub    $0x58,%esp
+  struct {
+    ushort inum;
+    char name[14];
+  } de;
+
+  printf(1, "concreate test\n");
+    1d2f:	83 ec 08             	sub    $0x8,%esp
+    1d32:	68 f6 58 00 00       	push   $0x58f6
+    1d37:	6a 01                	push   $0x1
+    1d39:	e8 53 2e 00 00       	call   4b91 <printf>
+    1d3e:	83 c4 10             	add    $0x10,%esp
+  file[0] = 'C';
+    1d41:	c6 45 e5 43          	movb   $0x43,-0x1b(%ebp)
+  file[2] = '\0';
+    1d45:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+  for(i = 0; i < 40; i++){
+    1d49:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1d50:	e9 fc 00 00 00       	jmp    1e51 <concreate+0x128>
+    file[1] = '0' + i;
+    1d55:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1d58:	83 c0 30             	add    $0x30,%eax
+    1d5b:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    unlink(file);
+    1d5e:	83 ec 0c             	sub    $0xc,%esp
+    1d61:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1d64:	50                   	push   %eax
+    1d65:	e8 bb 2c 00 00       	call   4a25 <unlink>
+    1d6a:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    1d6d:	e8 5b 2c 00 00       	call   49cd <fork>
+    1d72:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(pid && (i % 3) == 1){
+    1d75:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1d79:	74 3b                	je     1db6 <concreate+0x8d>
+    1d7b:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    1d7e:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    1d83:	89 c8                	mov    %ecx,%eax
+    1d85:	f7 ea                	imul   %edx
+    1d87:	89 c8                	mov    %ecx,%eax
+    1d89:	c1 f8 1f             	sar    $0x1f,%eax
+    1d8c:	29 c2                	sub    %eax,%edx
+    1d8e:	89 d0                	mov    %edx,%eax
+    1d90:	01 c0                	add    %eax,%eax
+    1d92:	01 d0                	add    %edx,%eax
+    1d94:	29 c1                	sub    %eax,%ecx
+    1d96:	89 ca                	mov    %ecx,%edx
+    1d98:	83 fa 01             	cmp    $0x1,%edx
+    1d9b:	75 19                	jne    1db6 <concreate+0x8d>
+      link("C0", file);
+    1d9d:	83 ec 08             	sub    $0x8,%esp
+    1da0:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1da3:	50                   	push   %eax
+    1da4:	68 06 59 00 00       	push   $0x5906
+    1da9:	e8 87 2c 00 00       	call   4a35 <link>
+    1dae:	83 c4 10             	add    $0x10,%esp
+    1db1:	e9 87 00 00 00       	jmp    1e3d <concreate+0x114>
+    } else if(pid == 0 && (i % 5) == 1){
+    1db6:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1dba:	75 3b                	jne    1df7 <concreate+0xce>
+    1dbc:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    1dbf:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    1dc4:	89 c8                	mov    %ecx,%eax
+    1dc6:	f7 ea                	imul   %edx
+    1dc8:	d1 fa                	sar    %edx
+    1dca:	89 c8                	mov    %ecx,%eax
+    1dcc:	c1 f8 1f             	sar    $0x1f,%eax
+    1dcf:	29 c2                	sub    %eax,%edx
+    1dd1:	89 d0                	mov    %edx,%eax
+    1dd3:	c1 e0 02             	shl    $0x2,%eax
+    1dd6:	01 d0                	add    %edx,%eax
+    1dd8:	29 c1                	sub    %eax,%ecx
+    1dda:	89 ca                	mov    %ecx,%edx
+    1ddc:	83 fa 01             	cmp    $0x1,%edx
+    1ddf:	75 16                	jne    1df7 <concreate+0xce>
+      link("C0", file);
+    1de1:	83 ec 08             	sub    $0x8,%esp
+    1de4:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1de7:	50                   	push   %eax
+    1de8:	68 06 59 00 00       	push   $0x5906
+    1ded:	e8 43 2c 00 00       	call   4a35 <link>
+    1df2:	83 c4 10             	add    $0x10,%esp
+    1df5:	eb 46                	jmp    1e3d <concreate+0x114>
+    } else {
+      fd = open(file, O_CREATE | O_RDWR);
+    1df7:	83 ec 08             	sub    $0x8,%esp
+    1dfa:	68 02 02 00 00       	push   $0x202
+    1dff:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1e02:	50                   	push   %eax
+    1e03:	e8 0d 2c 00 00       	call   4a15 <open>
+    1e08:	83 c4 10             	add    $0x10,%esp
+    1e0b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      if(fd < 0){
+    1e0e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1e12:	79 1b                	jns    1e2f <concreate+0x106>
+        printf(1, "concreate create %s failed\n", file);
+    1e14:	83 ec 04             	sub    $0x4,%esp
+    1e17:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1e1a:	50                   	push   %eax
+    1e1b:	68 09 59 00 00       	push   $0x5909
+    1e20:	6a 01                	push   $0x1
+    1e22:	e8 6a 2d 00 00       	call   4b91 <printf>
+    1e27:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1e2a:	e8 a6 2b 00 00       	call   49d5 <exit>
+      }
+      close(fd);
+    1e2f:	83 ec 0c             	sub    $0xc,%esp
+    1e32:	ff 75 ec             	push   -0x14(%ebp)
+    1e35:	e8 c3 2b 00 00       	call   49fd <close>
+    1e3a:	83 c4 10             	add    $0x10,%esp
+    }
+    if(pid == 0)
+    1e3d:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1e41:	75 05                	jne    1e48 <concreate+0x11f>
+      exit();
+    1e43:	e8 8d 2b 00 00       	call   49d5 <exit>
+    else
+      wait();
+    1e48:	e8 90 2b 00 00       	call   49dd <wait>
+  for(i = 0; i < 40; i++){
+    1e4d:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1e51:	83 7d f4 27          	cmpl   $0x27,-0xc(%ebp)
+    1e55:	0f 8e fa fe ff ff    	jle    1d55 <concreate+0x2c>
+  }
+
+  memset(fa, 0, sizeof(fa));
+    1e5b:	83 ec 04             	sub    $0x4,%esp
+    1e5e:	6a 28                	push   $0x28
+    1e60:	6a 00                	push   $0x0
+    1e62:	8d 45 bd             	lea    -0x43(%ebp),%eax
+    1e65:	50                   	push   %eax
+    1e66:	e8 39 27 00 00       	call   45a4 <memset>
+    1e6b:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", 0);
+    1e6e:	83 ec 08             	sub    $0x8,%esp
+    1e71:	6a 00                	push   $0x0
+    1e73:	68 cb 58 00 00       	push   $0x58cb
+    1e78:	e8 98 2b 00 00       	call   4a15 <open>
+    1e7d:	83 c4 10             	add    $0x10,%esp
+    1e80:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  n = 0;
+    1e83:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  while(read(fd, &de, sizeof(de)) > 0){
+    1e8a:	e9 99 00 00 00       	jmp    1f28 <concreate+0x1ff>
+    if(de.inum == 0)
+    1e8f:	0f b7 45 ac          	movzwl -0x54(%ebp),%eax
+    1e93:	66 85 c0             	test   %ax,%ax
+    1e96:	0f 84 8b 00 00 00    	je     1f27 <concreate+0x1fe>
+      continue;
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    1e9c:	0f b6 45 ae          	movzbl -0x52(%ebp),%eax
+    1ea0:	3c 43                	cmp    $0x43,%al
+    1ea2:	0f 85 80 00 00 00    	jne    1f28 <concreate+0x1ff>
+    1ea8:	0f b6 45 b0          	movzbl -0x50(%ebp),%eax
+    1eac:	84 c0                	test   %al,%al
+    1eae:	75 78                	jne    1f28 <concreate+0x1ff>
+      i = de.name[1] - '0';
+    1eb0:	0f b6 45 af          	movzbl -0x51(%ebp),%eax
+    1eb4:	0f be c0             	movsbl %al,%eax
+    1eb7:	83 e8 30             	sub    $0x30,%eax
+    1eba:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      if(i < 0 || i >= sizeof(fa)){
+    1ebd:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1ec1:	78 08                	js     1ecb <concreate+0x1a2>
+    1ec3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1ec6:	83 f8 27             	cmp    $0x27,%eax
+    1ec9:	76 1e                	jbe    1ee9 <concreate+0x1c0>
+        printf(1, "concreate weird file %s\n", de.name);
+    1ecb:	83 ec 04             	sub    $0x4,%esp
+    1ece:	8d 45 ac             	lea    -0x54(%ebp),%eax
+    1ed1:	83 c0 02             	add    $0x2,%eax
+    1ed4:	50                   	push   %eax
+    1ed5:	68 25 59 00 00       	push   $0x5925
+    1eda:	6a 01                	push   $0x1
+    1edc:	e8 b0 2c 00 00       	call   4b91 <printf>
+    1ee1:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1ee4:	e8 ec 2a 00 00       	call   49d5 <exit>
+      }
+      if(fa[i]){
+    1ee9:	8d 55 bd             	lea    -0x43(%ebp),%edx
+    1eec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1eef:	01 d0                	add    %edx,%eax
+    1ef1:	0f b6 00             	movzbl (%eax),%eax
+    1ef4:	84 c0                	test   %al,%al
+    1ef6:	74 1e                	je     1f16 <concreate+0x1ed>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    1ef8:	83 ec 04             	sub    $0x4,%esp
+    1efb:	8d 45 ac             	lea    -0x54(%ebp),%eax
+    1efe:	83 c0 02             	add    $0x2,%eax
+    1f01:	50                   	push   %eax
+    1f02:	68 3e 59 00 00       	push   $0x593e
+    1f07:	6a 01                	push   $0x1
+    1f09:	e8 83 2c 00 00       	call   4b91 <printf>
+    1f0e:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1f11:	e8 bf 2a 00 00       	call   49d5 <exit>
+      }
+      fa[i] = 1;
+    1f16:	8d 55 bd             	lea    -0x43(%ebp),%edx
+    1f19:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1f1c:	01 d0                	add    %edx,%eax
+    1f1e:	c6 00 01             	movb   $0x1,(%eax)
+      n++;
+    1f21:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    1f25:	eb 01                	jmp    1f28 <concreate+0x1ff>
+      continue;
+    1f27:	90                   	nop
+  while(read(fd, &de, sizeof(de)) > 0){
+    1f28:	83 ec 04             	sub    $0x4,%esp
+    1f2b:	6a 10                	push   $0x10
+    1f2d:	8d 45 ac             	lea    -0x54(%ebp),%eax
+    1f30:	50                   	push   %eax
+    1f31:	ff 75 ec             	push   -0x14(%ebp)
+    1f34:	e8 b4 2a 00 00       	call   49ed <read>
+    1f39:	83 c4 10             	add    $0x10,%esp
+    1f3c:	85 c0                	test   %eax,%eax
+    1f3e:	0f 8f 4b ff ff ff    	jg     1e8f <concreate+0x166>
+    }
+  }
+  close(fd);
+    1f44:	83 ec 0c             	sub    $0xc,%esp
+    1f47:	ff 75 ec             	push   -0x14(%ebp)
+    1f4a:	e8 ae 2a 00 00       	call   49fd <close>
+    1f4f:	83 c4 10             	add    $0x10,%esp
+
+  if(n != 40){
+    1f52:	83 7d f0 28          	cmpl   $0x28,-0x10(%ebp)
+    1f56:	74 17                	je     1f6f <concreate+0x246>
+    printf(1, "concreate not enough files in directory listing\n");
+    1f58:	83 ec 08             	sub    $0x8,%esp
+    1f5b:	68 5c 59 00 00       	push   $0x595c
+    1f60:	6a 01                	push   $0x1
+    1f62:	e8 2a 2c 00 00       	call   4b91 <printf>
+    1f67:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1f6a:	e8 66 2a 00 00       	call   49d5 <exit>
+  }
+
+  for(i = 0; i < 40; i++){
+    1f6f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1f76:	e9 43 01 00 00       	jmp    20be <concreate+0x395>
+    file[1] = '0' + i;
+    1f7b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1f7e:	83 c0 30             	add    $0x30,%eax
+    1f81:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    pid = fork();
+    1f84:	e8 44 2a 00 00       	call   49cd <fork>
+    1f89:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(pid < 0){
+    1f8c:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1f90:	79 17                	jns    1fa9 <concreate+0x280>
+      printf(1, "fork failed\n");
+    1f92:	83 ec 08             	sub    $0x8,%esp
+    1f95:	68 0d 50 00 00       	push   $0x500d
+    1f9a:	6a 01                	push   $0x1
+    1f9c:	e8 f0 2b 00 00       	call   4b91 <printf>
+    1fa1:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1fa4:	e8 2c 2a 00 00       	call   49d5 <exit>
+    }
+    if(((i % 3) == 0 && pid == 0) ||
+    1fa9:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    1fac:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    1fb1:	89 c8                	mov    %ecx,%eax
+    1fb3:	f7 ea                	imul   %edx
+    1fb5:	89 c8                	mov    %ecx,%eax
+    1fb7:	c1 f8 1f             	sar    $0x1f,%eax
+    1fba:	29 c2                	sub    %eax,%edx
+    1fbc:	89 d0                	mov    %edx,%eax
+    1fbe:	01 c0                	add    %eax,%eax
+    1fc0:	01 d0                	add    %edx,%eax
+    1fc2:	29 c1                	sub    %eax,%ecx
+    1fc4:	89 ca                	mov    %ecx,%edx
+    1fc6:	85 d2                	test   %edx,%edx
+    1fc8:	75 06                	jne    1fd0 <concreate+0x2a7>
+    1fca:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1fce:	74 28                	je     1ff8 <concreate+0x2cf>
+       ((i % 3) == 1 && pid != 0)){
+    1fd0:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    1fd3:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    1fd8:	89 c8                	mov    %ecx,%eax
+    1fda:	f7 ea                	imul   %edx
+    1fdc:	89 c8                	mov    %ecx,%eax
+    1fde:	c1 f8 1f             	sar    $0x1f,%eax
+    1fe1:	29 c2                	sub    %eax,%edx
+    1fe3:	89 d0                	mov    %edx,%eax
+    1fe5:	01 c0                	add    %eax,%eax
+    1fe7:	01 d0                	add    %edx,%eax
+    1fe9:	29 c1                	sub    %eax,%ecx
+    1feb:	89 ca                	mov    %ecx,%edx
+    if(((i % 3) == 0 && pid == 0) ||
+    1fed:	83 fa 01             	cmp    $0x1,%edx
+    1ff0:	75 7c                	jne    206e <concreate+0x345>
+       ((i % 3) == 1 && pid != 0)){
+    1ff2:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1ff6:	74 76                	je     206e <concreate+0x345>
+      close(open(file, 0));
+    1ff8:	83 ec 08             	sub    $0x8,%esp
+    1ffb:	6a 00                	push   $0x0
+    1ffd:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    2000:	50                   	push   %eax
+    2001:	e8 0f 2a 00 00       	call   4a15 <open>
+    2006:	83 c4 10             	add    $0x10,%esp
+    2009:	83 ec 0c             	sub    $0xc,%esp
+    200c:	50                   	push   %eax
+    200d:	e8 eb 29 00 00       	call   49fd <close>
+    2012:	83 c4 10             	add    $0x10,%esp
+      close(open(file, 0));
+    2015:	83 ec 08             	sub    $0x8,%esp
+    2018:	6a 00                	push   $0x0
+    201a:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    201d:	50                   	push   %eax
+    201e:	e8 f2 29 00 00       	call   4a15 <open>
+    2023:	83 c4 10             	add    $0x10,%esp
+    2026:	83 ec 0c             	sub    $0xc,%esp
+    2029:	50                   	push   %eax
+    202a:	e8 ce 29 00 00       	call   49fd <close>
+    202f:	83 c4 10             	add    $0x10,%esp
+      close(open(file, 0));
+    2032:	83 ec 08             	sub    $0x8,%esp
+    2035:	6a 00                	push   $0x0
+    2037:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    203a:	50                   	push   %eax
+    203b:	e8 d5 29 00 00       	call   4a15 <open>
+    2040:	83 c4 10             	add    $0x10,%esp
+    2043:	83 ec 0c             	sub    $0xc,%esp
+    2046:	50                   	push   %eax
+    2047:	e8 b1 29 00 00       	call   49fd <close>
+    204c:	83 c4 10             	add    $0x10,%esp
+      close(open(file, 0));
+    204f:	83 ec 08             	sub    $0x8,%esp
+    2052:	6a 00                	push   $0x0
+    2054:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    2057:	50                   	push   %eax
+    2058:	e8 b8 29 00 00       	call   4a15 <open>
+    205d:	83 c4 10             	add    $0x10,%esp
+    2060:	83 ec 0c             	sub    $0xc,%esp
+    2063:	50                   	push   %eax
+    2064:	e8 94 29 00 00       	call   49fd <close>
+    2069:	83 c4 10             	add    $0x10,%esp
+    206c:	eb 3c                	jmp    20aa <concreate+0x381>
+    } else {
+      unlink(file);
+    206e:	83 ec 0c             	sub    $0xc,%esp
+    2071:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    2074:	50                   	push   %eax
+    2075:	e8 ab 29 00 00       	call   4a25 <unlink>
+    207a:	83 c4 10             	add    $0x10,%esp
+      unlink(file);
+    207d:	83 ec 0c             	sub    $0xc,%esp
+    2080:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    2083:	50                   	push   %eax
+    2084:	e8 9c 29 00 00       	call   4a25 <unlink>
+    2089:	83 c4 10             	add    $0x10,%esp
+      unlink(file);
+    208c:	83 ec 0c             	sub    $0xc,%esp
+    208f:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    2092:	50                   	push   %eax
+    2093:	e8 8d 29 00 00       	call   4a25 <unlink>
+    2098:	83 c4 10             	add    $0x10,%esp
+      unlink(file);
+    209b:	83 ec 0c             	sub    $0xc,%esp
+    209e:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    20a1:	50                   	push   %eax
+    20a2:	e8 7e 29 00 00       	call   4a25 <unlink>
+    20a7:	83 c4 10             	add    $0x10,%esp
+    }
+    if(pid == 0)
+    20aa:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    20ae:	75 05                	jne    20b5 <concreate+0x38c>
+      exit();
+    20b0:	e8 20 29 00 00       	call   49d5 <exit>
+    else
+      wait();
+    20b5:	e8 23 29 00 00       	call   49dd <wait>
+  for(i = 0; i < 40; i++){
+    20ba:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    20be:	83 7d f4 27          	cmpl   $0x27,-0xc(%ebp)
+    20c2:	0f 8e b3 fe ff ff    	jle    1f7b <concreate+0x252>
+  }
+
+  printf(1, "concreate ok\n");
+    20c8:	83 ec 08             	sub    $0x8,%esp
+    20cb:	68 8d 59 00 00       	push   $0x598d
+    20d0:	6a 01                	push   $0x1
+    20d2:	e8 ba 2a 00 00       	call   4b91 <printf>
+    20d7:	83 c4 10             	add    $0x10,%esp
+}
+    20da:	90                   	nop
+    20db:	c9                   	leave
+    20dc:	c3                   	ret
+
+000020dd <linkunlink>:
+
+// another concurrent link/unlink/create test,
+// to look for deadlocks.
+void
+linkunlink()
+{
+    20dd:	55                   	push   %ebp
+    20de:	89 e5                	mov    %esp,%ebp
+    20e0:	83 ec 18             	sub    $0x18,%esp
+  int pid, i;
+
+  printf(1, "linkunlink test\n");
+    20e3:	83 ec 08             	sub    $0x8,%esp
+    20e6:	68 9b 59 00 00       	push   $0x599b
+    20eb:	6a 01                	push   $0x1
+    20ed:	e8 9f 2a 00 00       	call   4b91 <printf>
+    20f2:	83 c4 10             	add    $0x10,%esp
+
+  unlink("x");
+    20f5:	83 ec 0c             	sub    $0xc,%esp
+    20f8:	68 47 54 00 00       	push   $0x5447
+    20fd:	e8 23 29 00 00       	call   4a25 <unlink>
+    2102:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    2105:	e8 c3 28 00 00       	call   49cd <fork>
+    210a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(pid < 0){
+    210d:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    2111:	79 17                	jns    212a <linkunlink+0x4d>
+    printf(1, "fork failed\n");
+    2113:	83 ec 08             	sub    $0x8,%esp
+    2116:	68 0d 50 00 00       	push   $0x500d
+    211b:	6a 01                	push   $0x1
+    211d:	e8 6f 2a 00 00       	call   4b91 <printf>
+    2122:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2125:	e8 ab 28 00 00       	call   49d5 <exit>
+  }
+
+  unsigned int x = (pid ? 1 : 97);
+    212a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    212e:	74 07                	je     2137 <linkunlink+0x5a>
+    2130:	b8 01 00 00 00       	mov    $0x1,%eax
+    2135:	eb 05                	jmp    213c <linkunlink+0x5f>
+    2137:	b8 61 00 00 00       	mov    $0x61,%eax
+    213c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < 100; i++){
+    213f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2146:	e9 98 00 00 00       	jmp    21e3 <linkunlink+0x106>
+    x = x * 1103515245 + 12345;
+    214b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    214e:	69 c0 6d 4e c6 41    	imul   $0x41c64e6d,%eax,%eax
+    2154:	05 39 30 00 00       	add    $0x3039,%eax
+    2159:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if((x % 3) == 0){
+    215c:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+    215f:	ba ab aa aa aa       	mov    $0xaaaaaaab,%edx
+    2164:	89 c8                	mov    %ecx,%eax
+    2166:	f7 e2                	mul    %edx
+    2168:	d1 ea                	shr    %edx
+    216a:	89 d0                	mov    %edx,%eax
+    216c:	01 c0                	add    %eax,%eax
+    216e:	01 d0                	add    %edx,%eax
+    2170:	29 c1                	sub    %eax,%ecx
+    2172:	89 ca                	mov    %ecx,%edx
+    2174:	85 d2                	test   %edx,%edx
+    2176:	75 23                	jne    219b <linkunlink+0xbe>
+      close(open("x", O_RDWR | O_CREATE));
+    2178:	83 ec 08             	sub    $0x8,%esp
+    217b:	68 02 02 00 00       	push   $0x202
+    2180:	68 47 54 00 00       	push   $0x5447
+    2185:	e8 8b 28 00 00       	call   4a15 <open>
+    218a:	83 c4 10             	add    $0x10,%esp
+    218d:	83 ec 0c             	sub    $0xc,%esp
+    2190:	50                   	push   %eax
+    2191:	e8 67 28 00 00       	call   49fd <close>
+    2196:	83 c4 10             	add    $0x10,%esp
+    2199:	eb 44                	jmp    21df <linkunlink+0x102>
+    } else if((x % 3) == 1){
+    219b:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+    219e:	ba ab aa aa aa       	mov    $0xaaaaaaab,%edx
+    21a3:	89 c8                	mov    %ecx,%eax
+    21a5:	f7 e2                	mul    %edx
+    21a7:	d1 ea                	shr    %edx
+    21a9:	89 d0                	mov    %edx,%eax
+    21ab:	01 c0                	add    %eax,%eax
+    21ad:	01 d0                	add    %edx,%eax
+    21af:	29 c1                	sub    %eax,%ecx
+    21b1:	89 ca                	mov    %ecx,%edx
+    21b3:	83 fa 01             	cmp    $0x1,%edx
+    21b6:	75 17                	jne    21cf <linkunlink+0xf2>
+      link("cat", "x");
+    21b8:	83 ec 08             	sub    $0x8,%esp
+    21bb:	68 47 54 00 00       	push   $0x5447
+    21c0:	68 ac 59 00 00       	push   $0x59ac
+    21c5:	e8 6b 28 00 00       	call   4a35 <link>
+    21ca:	83 c4 10             	add    $0x10,%esp
+    21cd:	eb 10                	jmp    21df <linkunlink+0x102>
+    } else {
+      unlink("x");
+    21cf:	83 ec 0c             	sub    $0xc,%esp
+    21d2:	68 47 54 00 00       	push   $0x5447
+    21d7:	e8 49 28 00 00       	call   4a25 <unlink>
+    21dc:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    21df:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    21e3:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+    21e7:	0f 8e 5e ff ff ff    	jle    214b <linkunlink+0x6e>
+    }
+  }
+
+  if(pid)
+    21ed:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    21f1:	74 07                	je     21fa <linkunlink+0x11d>
+    wait();
+    21f3:	e8 e5 27 00 00       	call   49dd <wait>
+    21f8:	eb 05                	jmp    21ff <linkunlink+0x122>
+  else
+    exit();
+    21fa:	e8 d6 27 00 00       	call   49d5 <exit>
+
+  printf(1, "linkunlink ok\n");
+    21ff:	83 ec 08             	sub    $0x8,%esp
+    2202:	68 b0 59 00 00       	push   $0x59b0
+    2207:	6a 01                	push   $0x1
+    2209:	e8 83 29 00 00       	call   4b91 <printf>
+    220e:	83 c4 10             	add    $0x10,%esp
+}
+    2211:	90                   	nop
+    2212:	c9                   	leave
+    2213:	c3                   	ret
+
+00002214 <bigdir>:
+
+// directory that uses indirect blocks
+void
+bigdir(void)
+{
+    2214:	55                   	push   %ebp
+    2215:	89 e5                	mov    %esp,%ebp
+    2217:	83 ec 28             	sub    $0x28,%esp
+  int i, fd;
+  char name[10];
+
+  printf(1, "bigdir test\n");
+    221a:	83 ec 08             	sub    $0x8,%esp
+    221d:	68 bf 59 00 00       	push   $0x59bf
+    2222:	6a 01                	push   $0x1
+    2224:	e8 68 29 00 00       	call   4b91 <printf>
+    2229:	83 c4 10             	add    $0x10,%esp
+  unlink("bd");
+    222c:	83 ec 0c             	sub    $0xc,%esp
+    222f:	68 cc 59 00 00       	push   $0x59cc
+    2234:	e8 ec 27 00 00       	call   4a25 <unlink>
+    2239:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("bd", O_CREATE);
+    223c:	83 ec 08             	sub    $0x8,%esp
+    223f:	68 00 02 00 00       	push   $0x200
+    2244:	68 cc 59 00 00       	push   $0x59cc
+    2249:	e8 c7 27 00 00       	call   4a15 <open>
+    224e:	83 c4 10             	add    $0x10,%esp
+    2251:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(fd < 0){
+    2254:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    2258:	79 17                	jns    2271 <bigdir+0x5d>
+    printf(1, "bigdir create failed\n");
+    225a:	83 ec 08             	sub    $0x8,%esp
+    225d:	68 cf 59 00 00       	push   $0x59cf
+    2262:	6a 01                	push   $0x1
+    2264:	e8 28 29 00 00       	call   4b91 <printf>
+    2269:	83 c4 10             	add    $0x10,%esp
+    exit();
+    226c:	e8 64 27 00 00       	call   49d5 <exit>
+  }
+  close(fd);
+    2271:	83 ec 0c             	sub    $0xc,%esp
+    2274:	ff 75 f0             	push   -0x10(%ebp)
+    2277:	e8 81 27 00 00       	call   49fd <close>
+    227c:	83 c4 10             	add    $0x10,%esp
+
+  for(i = 0; i < 500; i++){
+    227f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2286:	eb 69                	jmp    22f1 <bigdir+0xdd>
+    name[0] = 'x';
+    2288:	c6 45 e6 78          	movb   $0x78,-0x1a(%ebp)
+    name[1] = '0' + (i / 64);
+    228c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    228f:	8d 50 3f             	lea    0x3f(%eax),%edx
+    2292:	85 c0                	test   %eax,%eax
+    2294:	0f 48 c2             	cmovs  %edx,%eax
+    2297:	c1 f8 06             	sar    $0x6,%eax
+    229a:	83 c0 30             	add    $0x30,%eax
+    229d:	88 45 e7             	mov    %al,-0x19(%ebp)
+    name[2] = '0' + (i % 64);
+    22a0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    22a3:	89 d0                	mov    %edx,%eax
+    22a5:	c1 f8 1f             	sar    $0x1f,%eax
+    22a8:	c1 e8 1a             	shr    $0x1a,%eax
+    22ab:	01 c2                	add    %eax,%edx
+    22ad:	83 e2 3f             	and    $0x3f,%edx
+    22b0:	29 c2                	sub    %eax,%edx
+    22b2:	89 d0                	mov    %edx,%eax
+    22b4:	83 c0 30             	add    $0x30,%eax
+    22b7:	88 45 e8             	mov    %al,-0x18(%ebp)
+    name[3] = '\0';
+    22ba:	c6 45 e9 00          	movb   $0x0,-0x17(%ebp)
+    if(link("bd", name) != 0){
+    22be:	83 ec 08             	sub    $0x8,%esp
+    22c1:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+    22c4:	50                   	push   %eax
+    22c5:	68 cc 59 00 00       	push   $0x59cc
+    22ca:	e8 66 27 00 00       	call   4a35 <link>
+    22cf:	83 c4 10             	add    $0x10,%esp
+    22d2:	85 c0                	test   %eax,%eax
+    22d4:	74 17                	je     22ed <bigdir+0xd9>
+      printf(1, "bigdir link failed\n");
+    22d6:	83 ec 08             	sub    $0x8,%esp
+    22d9:	68 e5 59 00 00       	push   $0x59e5
+    22de:	6a 01                	push   $0x1
+    22e0:	e8 ac 28 00 00       	call   4b91 <printf>
+    22e5:	83 c4 10             	add    $0x10,%esp
+      exit();
+    22e8:	e8 e8 26 00 00       	call   49d5 <exit>
+  for(i = 0; i < 500; i++){
+    22ed:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    22f1:	81 7d f4 f3 01 00 00 	cmpl   $0x1f3,-0xc(%ebp)
+    22f8:	7e 8e                	jle    2288 <bigdir+0x74>
+    }
+  }
+
+  unlink("bd");
+    22fa:	83 ec 0c             	sub    $0xc,%esp
+    22fd:	68 cc 59 00 00       	push   $0x59cc
+    2302:	e8 1e 27 00 00       	call   4a25 <unlink>
+    2307:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 500; i++){
+    230a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2311:	eb 64                	jmp    2377 <bigdir+0x163>
+    name[0] = 'x';
+    2313:	c6 45 e6 78          	movb   $0x78,-0x1a(%ebp)
+    name[1] = '0' + (i / 64);
+    2317:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    231a:	8d 50 3f             	lea    0x3f(%eax),%edx
+    231d:	85 c0                	test   %eax,%eax
+    231f:	0f 48 c2             	cmovs  %edx,%eax
+    2322:	c1 f8 06             	sar    $0x6,%eax
+    2325:	83 c0 30             	add    $0x30,%eax
+    2328:	88 45 e7             	mov    %al,-0x19(%ebp)
+    name[2] = '0' + (i % 64);
+    232b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    232e:	89 d0                	mov    %edx,%eax
+    2330:	c1 f8 1f             	sar    $0x1f,%eax
+    2333:	c1 e8 1a             	shr    $0x1a,%eax
+    2336:	01 c2                	add    %eax,%edx
+    2338:	83 e2 3f             	and    $0x3f,%edx
+    233b:	29 c2                	sub    %eax,%edx
+    233d:	89 d0                	mov    %edx,%eax
+    233f:	83 c0 30             	add    $0x30,%eax
+    2342:	88 45 e8             	mov    %al,-0x18(%ebp)
+    name[3] = '\0';
+    2345:	c6 45 e9 00          	movb   $0x0,-0x17(%ebp)
+    if(unlink(name) != 0){
+    2349:	83 ec 0c             	sub    $0xc,%esp
+    234c:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+    234f:	50                   	push   %eax
+    2350:	e8 d0 26 00 00       	call   4a25 <unlink>
+    2355:	83 c4 10             	add    $0x10,%esp
+    2358:	85 c0                	test   %eax,%eax
+    235a:	74 17                	je     2373 <bigdir+0x15f>
+      printf(1, "bigdir unlink failed");
+    235c:	83 ec 08             	sub    $0x8,%esp
+    235f:	68 f9 59 00 00       	push   $0x59f9
+    2364:	6a 01                	push   $0x1
+    2366:	e8 26 28 00 00       	call   4b91 <printf>
+    236b:	83 c4 10             	add    $0x10,%esp
+      exit();
+    236e:	e8 62 26 00 00       	call   49d5 <exit>
+  for(i = 0; i < 500; i++){
+    2373:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    2377:	81 7d f4 f3 01 00 00 	cmpl   $0x1f3,-0xc(%ebp)
+    237e:	7e 93                	jle    2313 <bigdir+0xff>
+    }
+  }
+
+  printf(1, "bigdir ok\n");
+    2380:	83 ec 08             	sub    $0x8,%esp
+    2383:	68 0e 5a 00 00       	push   $0x5a0e
+    2388:	6a 01                	push   $0x1
+    238a:	e8 02 28 00 00       	call   4b91 <printf>
+    238f:	83 c4 10             	add    $0x10,%esp
+}
+    2392:	90                   	nop
+    2393:	c9                   	leave
+    2394:	c3                   	ret
+
+00002395 <dxname>:
+
+#define NDX 2000
+
+static void
+dxname(char *name, int i)
+{
+    2395:	55                   	push   %ebp
+    2396:	89 e5                	mov    %esp,%ebp
+  name[0] = 'd';
+    2398:	8b 45 08             	mov    0x8(%ebp),%eax
+    239b:	c6 00 64             	movb   $0x64,(%eax)
+  name[1] = 'x';
+    239e:	8b 45 08             	mov    0x8(%ebp),%eax
+    23a1:	83 c0 01             	add    $0x1,%eax
+    23a4:	c6 00 78             	movb   $0x78,(%eax)
+  name[2] = '/';
+    23a7:	8b 45 08             	mov    0x8(%ebp),%eax
+    23aa:	83 c0 02             	add    $0x2,%eax
+    23ad:	c6 00 2f             	movb   $0x2f,(%eax)
+  name[3] = 'a' + i / 676;
+    23b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    23b3:	ba eb 5d f2 60       	mov    $0x60f25deb,%edx
+    23b8:	89 c8                	mov    %ecx,%eax
+    23ba:	f7 ea                	imul   %edx
+    23bc:	c1 fa 08             	sar    $0x8,%edx
+    23bf:	89 c8                	mov    %ecx,%eax
+    23c1:	c1 f8 1f             	sar    $0x1f,%eax
+    23c4:	29 c2                	sub    %eax,%edx
+    23c6:	89 d0                	mov    %edx,%eax
+    23c8:	8d 50 61             	lea    0x61(%eax),%edx
+    23cb:	8b 45 08             	mov    0x8(%ebp),%eax
+    23ce:	83 c0 03             	add    $0x3,%eax
+    23d1:	88 10                	mov    %dl,(%eax)
+  name[4] = 'a' + i / 26 % 26;
+    23d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    23d6:	ba 4f ec c4 4e       	mov    $0x4ec4ec4f,%edx
+    23db:	89 c8                	mov    %ecx,%eax
+    23dd:	f7 ea                	imul   %edx
+    23df:	c1 fa 03             	sar    $0x3,%edx
+    23e2:	89 c8                	mov    %ecx,%eax
+    23e4:	c1 f8 1f             	sar    $0x1f,%eax
+    23e7:	89 d1                	mov    %edx,%ecx
+    23e9:	29 c1                	sub    %eax,%ecx
+    23eb:	ba 4f ec c4 4e       	mov    $0x4ec4ec4f,%edx
+    23f0:	89 c8                	mov    %ecx,%eax
+    23f2:	f7 ea                	imul   %edx
+    23f4:	89 d0                	mov    %edx,%eax
+    23f6:	c1 f8 03             	sar    $0x3,%eax
+    23f9:	89 ca                	mov    %ecx,%edx
+    23fb:	c1 fa 1f             	sar    $0x1f,%edx
+    23fe:	29 d0                	sub    %edx,%eax
+    2400:	6b d0 1a             	imul   $0x1a,%eax,%edx
+    2403:	89 c8                	mov    %ecx,%eax
+    2405:	29 d0                	sub    %edx,%eax
+    2407:	8d 50 61             	lea    0x61(%eax),%edx
+    240a:	8b 45 08             	mov    0x8(%ebp),%eax
+    240d:	83 c0 04             	add    $0x4,%eax
+    2410:	88 10                	mov    %dl,(%eax)
+  name[5] = 'a' + i % 26;
+    2412:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    2415:	ba 4f ec c4 4e       	mov    $0x4ec4ec4f,%edx
+    241a:	89 c8                	mov    %ecx,%eax
+    241c:	f7 ea                	imul   %edx
+    241e:	89 d0                	mov    %edx,%eax
+    2420:	c1 f8 03             	sar    $0x3,%eax
+    2423:	89 ca                	mov    %ecx,%edx
+    2425:	c1 fa 1f             	sar    $0x1f,%edx
+    2428:	29 d0                	sub    %edx,%eax
+    242a:	6b d0 1a             	imul   $0x1a,%eax,%edx
+    242d:	89 c8                	mov    %ecx,%eax
+    242f:	29 d0                	sub    %edx,%eax
+    2431:	8d 50 61             	lea    0x61(%eax),%edx
+    2434:	8b 45 08             	mov    0x8(%ebp),%eax
+    2437:	83 c0 05             	add    $0x5,%eax
+    243a:	88 10                	mov    %dl,(%eax)
+  name[6] = '\0';
+    243c:	8b 45 08             	mov    0x8(%ebp),%eax
+    243f:	83 c0 06             	add    $0x6,%eax
+    2442:	c6 00 00             	movb   $0x0,(%eax)
+}
+    2445:	90                   	nop
+    2446:	5d                   	pop    %ebp
+    2447:	c3                   	ret
+
+00002448 <dxcheck>:
+
+// Open the first n names in dx: all of them, or the odd ones
+// only, and check that the others are gone.
+static void
+dxcheck(int n, int all)
+{
+    2448:	55                   	push   %ebp
+    2449:	89 e5                	mov    %esp,%ebp
+    244b:	83 ec 18             	sub    $0x18,%esp
+  char name[8];
+  int i, fd;
+
+  for(i = 0; i < n; i++){
+    244e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2455:	e9 a4 00 00 00       	jmp    24fe <dxcheck+0xb6>
+    dxname(name, i);
+    245a:	ff 75 f4             	push   -0xc(%ebp)
+    245d:	8d 45 e8             	lea    -0x18(%ebp),%eax
+    2460:	50                   	push   %eax
+    2461:	e8 2f ff ff ff       	call   2395 <dxname>
+    2466:	83 c4 08             	add    $0x8,%esp
+    fd = open(name, O_RDONLY);
+    2469:	83 ec 08             	sub    $0x8,%esp
+    246c:	6a 00                	push   $0x0
+    246e:	8d 45 e8             	lea    -0x18(%ebp),%eax
+    2471:	50                   	push   %eax
+    2472:	e8 9e 25 00 00       	call   4a15 <open>
+    2477:	83 c4 10             	add    $0x10,%esp
+    247a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if((fd >= 0) != (all || i % 2 == 1)){
+    247d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    2480:	f7 d0                	not    %eax
+    2482:	c1 e8 1f             	shr    $0x1f,%eax
+    2485:	89 c1                	mov    %eax,%ecx
+    2487:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+    248b:	75 19                	jne    24a6 <dxcheck+0x5e>
+    248d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    2490:	89 d0                	mov    %edx,%eax
+    2492:	c1 f8 1f             	sar    $0x1f,%eax
+    2495:	c1 e8 1f             	shr    $0x1f,%eax
+    2498:	01 c2                	add    %eax,%edx
+    249a:	83 e2 01             	and    $0x1,%edx
+    249d:	29 c2                	sub    %eax,%edx
+    249f:	89 d0                	mov    %edx,%eax
+    24a1:	83 f8 01             	cmp    $0x1,%eax
+    24a4:	75 07                	jne    24ad <dxcheck+0x65>
+    24a6:	b8 01 00 00 00       	mov    $0x1,%eax
+    24ab:	eb 05                	jmp    24b2 <dxcheck+0x6a>
+    24ad:	b8 00 00 00 00       	mov    $0x0,%eax
+    24b2:	83 e0 01             	and    $0x1,%eax
+    24b5:	31 c8                	xor    %ecx,%eax
+    24b7:	84 c0                	test   %al,%al
+    24b9:	74 2b                	je     24e6 <dxcheck+0x9e>
+      printf(1, "dirindex: lookup of %s %s\n", name, fd < 0 ? "failed" : "succeeded");
+    24bb:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    24bf:	79 07                	jns    24c8 <dxcheck+0x80>
+    24c1:	b8 19 5a 00 00       	mov    $0x5a19,%eax
+    24c6:	eb 05                	jmp    24cd <dxcheck+0x85>
+    24c8:	b8 20 5a 00 00       	mov    $0x5a20,%eax
+    24cd:	50                   	push   %eax
+    24ce:	8d 45 e8             	lea    -0x18(%ebp),%eax
+    24d1:	50                   	push   %eax
+    24d2:	68 2a 5a 00 00       	push   $0x5a2a
+    24d7:	6a 01                	push   $0x1
+    24d9:	e8 b3 26 00 00       	call   4b91 <printf>
+    24de:	83 c4 10             	add    $0x10,%esp
+      exit();
+    24e1:	e8 ef 24 00 00       	call   49d5 <exit>
+    }
+    if(fd >= 0)
+    24e6:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    24ea:	78 0e                	js     24fa <dxcheck+0xb2>
+      close(fd);
+    24ec:	83 ec 0c             	sub    $0xc,%esp
+    24ef:	ff 75 f0             	push   -0x10(%ebp)
+    24f2:	e8 06 25 00 00       	call   49fd <close>
+    24f7:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i++){
+    24fa:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    24fe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2501:	3b 45 08             	cmp    0x8(%ebp),%eax
+    2504:	0f 8c 50 ff ff ff    	jl     245a <dxcheck+0x12>
+  }
+}
+    250a:	90                   	nop
+    250b:	90                   	nop
+    250c:	c9                   	leave
+    250d:	c3                   	ret
+
+0000250e <dirindex>:
+
+// lookups in a directory that is searched linearly, and in
+// one large enough to be hashed and split
+void
+dirindex(void)
+{
+    250e:	55                   	push   %ebp
+    250f:	89 e5                	mov    %esp,%ebp
+    2511:	83 ec 18             	sub    $0x18,%esp
+  char name[8];
+  int i, fd;
+
+  printf(1, "dirindex test\n");
+    2514:	83 ec 08             	sub    $0x8,%esp
+    2517:	68 45 5a 00 00       	push   $0x5a45
+    251c:	6a 01                	push   $0x1
+    251e:	e8 6e 26 00 00       	call   4b91 <printf>
+    2523:	83 c4 10             	add    $0x10,%esp
+  if(mkdir("dx") < 0){
+    2526:	83 ec 0c             	sub    $0xc,%esp
+    2529:	68 54 5a 00 00       	push   $0x5a54
+    252e:	e8 0a 25 00 00       	call   4a3d <mkdir>
+    2533:	83 c4 10             	add    $0x10,%esp
+    2536:	85 c0                	test   %eax,%eax
+    2538:	79 17                	jns    2551 <dirindex+0x43>
+    printf(1, "dirindex: mkdir failed\n");
+    253a:	83 ec 08             	sub    $0x8,%esp
+    253d:	68 57 5a 00 00       	push   $0x5a57
+    2542:	6a 01                	push   $0x1
+    2544:	e8 48 26 00 00       	call   4b91 <printf>
+    2549:	83 c4 10             	add    $0x10,%esp
+    exit();
+    254c:	e8 84 24 00 00       	call   49d5 <exit>
+  }
+  fd = open("dx/f", O_CREATE|O_RDWR);
+    2551:	83 ec 08             	sub    $0x8,%esp
+    2554:	68 02 02 00 00       	push   $0x202
+    2559:	68 6f 5a 00 00       	push   $0x5a6f
+    255e:	e8 b2 24 00 00       	call   4a15 <open>
+    2563:	83 c4 10             	add    $0x10,%esp
+    2566:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(fd < 0){
+    2569:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    256d:	79 17                	jns    2586 <dirindex+0x78>
+    printf(1, "dirindex: create failed\n");
+    256f:	83 ec 08             	sub    $0x8,%esp
+    2572:	68 74 5a 00 00       	push   $0x5a74
+    2577:	6a 01                	push   $0x1
+    2579:	e8 13 26 00 00       	call   4b91 <printf>
+    257e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2581:	e8 4f 24 00 00       	call   49d5 <exit>
+  }
+  close(fd);
+    2586:	83 ec 0c             	sub    $0xc,%esp
+    2589:	ff 75 f0             	push   -0x10(%ebp)
+    258c:	e8 6c 24 00 00       	call   49fd <close>
+    2591:	83 c4 10             	add    $0x10,%esp
+
+  for(i = 0; i < NDX; i++){
+    2594:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    259b:	eb 63                	jmp    2600 <dirindex+0xf2>
+    dxname(name, i);
+    259d:	83 ec 08             	sub    $0x8,%esp
+    25a0:	ff 75 f4             	push   -0xc(%ebp)
+    25a3:	8d 45 e8             	lea    -0x18(%ebp),%eax
+    25a6:	50                   	push   %eax
+    25a7:	e8 e9 fd ff ff       	call   2395 <dxname>
+    25ac:	83 c4 10             	add    $0x10,%esp
+    if(link("dx/f", name) != 0){
+    25af:	83 ec 08             	sub    $0x8,%esp
+    25b2:	8d 45 e8             	lea    -0x18(%ebp),%eax
+    25b5:	50                   	push   %eax
+    25b6:	68 6f 5a 00 00       	push   $0x5a6f
+    25bb:	e8 75 24 00 00       	call   4a35 <link>
+    25c0:	83 c4 10             	add    $0x10,%esp
+    25c3:	85 c0                	test   %eax,%eax
+    25c5:	74 1b                	je     25e2 <dirindex+0xd4>
+      printf(1, "dirindex: link %s failed\n", name);
+    25c7:	83 ec 04             	sub    $0x4,%esp
+    25ca:	8d 45 e8             	lea    -0x18(%ebp),%eax
+    25cd:	50                   	push   %eax
+    25ce:	68 8d 5a 00 00       	push   $0x5a8d
+    25d3:	6a 01                	push   $0x1
+    25d5:	e8 b7 25 00 00       	call   4b91 <printf>
+    25da:	83 c4 10             	add    $0x10,%esp
+      exit();
+    25dd:	e8 f3 23 00 00       	call   49d5 <exit>
+    }
+    if(i == 50)
+    25e2:	83 7d f4 32          	cmpl   $0x32,-0xc(%ebp)
+    25e6:	75 14                	jne    25fc <dirindex+0xee>
+      dxcheck(i + 1, 1);  // still one block
+    25e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    25eb:	83 c0 01             	add    $0x1,%eax
+    25ee:	83 ec 08             	sub    $0x8,%esp
+    25f1:	6a 01                	push   $0x1
+    25f3:	50                   	push   %eax
+    25f4:	e8 4f fe ff ff       	call   2448 <dxcheck>
+    25f9:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NDX; i++){
+    25fc:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    2600:	81 7d f4 cf 07 00 00 	cmpl   $0x7cf,-0xc(%ebp)
+    2607:	7e 94                	jle    259d <dirindex+0x8f>
+  }
+  dxcheck(NDX, 1);
+    2609:	83 ec 08             	sub    $0x8,%esp
+    260c:	6a 01                	push   $0x1
+    260e:	68 d0 07 00 00       	push   $0x7d0
+    2613:	e8 30 fe ff ff       	call   2448 <dxcheck>
+    2618:	83 c4 10             	add    $0x10,%esp
+
+  for(i = 0; i < NDX; i += 2){
+    261b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2622:	eb 44                	jmp    2668 <dirindex+0x15a>
+    dxname(name, i);
+    2624:	83 ec 08             	sub    $0x8,%esp
+    2627:	ff 75 f4             	push   -0xc(%ebp)
+    262a:	8d 45 e8             	lea    -0x18(%ebp),%eax
+    262d:	50                   	push   %eax
+    262e:	e8 62 fd ff ff       	call   2395 <dxname>
+    2633:	83 c4 10             	add    $0x10,%esp
+    if(unlink(name) != 0){
+    2636:	83 ec 0c             	sub    $0xc,%esp
+    2639:	8d 45 e8             	lea    -0x18(%ebp),%eax
+    263c:	50                   	push   %eax
+    263d:	e8 e3 23 00 00       	call   4a25 <unlink>
+    2642:	83 c4 10             	add    $0x10,%esp
+    2645:	85 c0                	test   %eax,%eax
+    2647:	74 1b                	je     2664 <dirindex+0x156>
+      printf(1, "dirindex: unlink %s failed\n", name);
+    2649:	83 ec 04             	sub    $0x4,%esp
+    264c:	8d 45 e8             	lea    -0x18(%ebp),%eax
+    264f:	50                   	push   %eax
+    2650:	68 a7 5a 00 00       	push   $0x5aa7
+    2655:	6a 01                	push   $0x1
+    2657:	e8 35 25 00 00       	call   4b91 <printf>
+    265c:	83 c4 10             	add    $0x10,%esp
+      exit();
+    265f:	e8 71 23 00 00       	call   49d5 <exit>
+  for(i = 0; i < NDX; i += 2){
+    2664:	83 45 f4 02          	addl   $0x2,-0xc(%ebp)
+    2668:	81 7d f4 cf 07 00 00 	cmpl   $0x7cf,-0xc(%ebp)
+    266f:	7e b3                	jle    2624 <dirindex+0x116>
+    }
+  }
+  dxcheck(NDX, 0);
+    2671:	83 ec 08             	sub    $0x8,%esp
+    2674:	6a 00                	push   $0x0
+    2676:	68 d0 07 00 00       	push   $0x7d0
+    267b:	e8 c8 fd ff ff       	call   2448 <dxcheck>
+    2680:	83 c4 10             	add    $0x10,%esp
+
+  for(i = 1; i < NDX; i += 2){
+    2683:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+    268a:	eb 25                	jmp    26b1 <dirindex+0x1a3>
+    dxname(name, i);
+    268c:	83 ec 08             	sub    $0x8,%esp
+    268f:	ff 75 f4             	push   -0xc(%ebp)
+    2692:	8d 45 e8             	lea    -0x18(%ebp),%eax
+    2695:	50                   	push   %eax
+    2696:	e8 fa fc ff ff       	call   2395 <dxname>
+    269b:	83 c4 10             	add    $0x10,%esp
+    unlink(name);
+    269e:	83 ec 0c             	sub    $0xc,%esp
+    26a1:	8d 45 e8             	lea    -0x18(%ebp),%eax
+    26a4:	50                   	push   %eax
+    26a5:	e8 7b 23 00 00       	call   4a25 <unlink>
+    26aa:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < NDX; i += 2){
+    26ad:	83 45 f4 02          	addl   $0x2,-0xc(%ebp)
+    26b1:	81 7d f4 cf 07 00 00 	cmpl   $0x7cf,-0xc(%ebp)
+    26b8:	7e d2                	jle    268c <dirindex+0x17e>
+  }
+  unlink("dx/f");
+    26ba:	83 ec 0c             	sub    $0xc,%esp
+    26bd:	68 6f 5a 00 00       	push   $0x5a6f
+    26c2:	e8 5e 23 00 00       	call   4a25 <unlink>
+    26c7:	83 c4 10             	add    $0x10,%esp
+  if(unlink("dx") != 0){
+    26ca:	83 ec 0c             	sub    $0xc,%esp
+    26cd:	68 54 5a 00 00       	push   $0x5a54
+    26d2:	e8 4e 23 00 00       	call   4a25 <unlink>
+    26d7:	83 c4 10             	add    $0x10,%esp
+    26da:	85 c0                	test   %eax,%eax
+    26dc:	74 17                	je     26f5 <dirindex+0x1e7>
+    printf(1, "dirindex: unlink dx failed\n");
+    26de:	83 ec 08             	sub    $0x8,%esp
+    26e1:	68 c3 5a 00 00       	push   $0x5ac3
+    26e6:	6a 01                	push   $0x1
+    26e8:	e8 a4 24 00 00       	call   4b91 <printf>
+    26ed:	83 c4 10             	add    $0x10,%esp
+    exit();
+    26f0:	e8 e0 22 00 00       	call   49d5 <exit>
+  }
+  printf(1, "dirindex ok\n");
+    26f5:	83 ec 08             	sub    $0x8,%esp
+    26f8:	68 df 5a 00 00       	push   $0x5adf
+    26fd:	6a 01                	push   $0x1
+    26ff:	e8 8d 24 00 00       	call   4b91 <printf>
+    2704:	83 c4 10             	add    $0x10,%esp
+}
+    2707:	90                   	nop
+    2708:	c9                   	leave
+    2709:	c3                   	ret
+
+0000270a <subdir>:
+
+void
+subdir(void)
+{
+    270a:	55                   	push   %ebp
+    270b:	89 e5                	mov    %esp,%ebp
+    270d:	83 ec 18             	sub    $0x18,%esp
+  int fd, cc;
+
+  printf(1, "subdir test\n");
+    2710:	83 ec 08             	sub    $0x8,%esp
+    2713:	68 ec 5a 00 00       	push   $0x5aec
+    2718:	6a 01                	push   $0x1
+    271a:	e8 72 24 00 00       	call   4b91 <printf>
+    271f:	83 c4 10             	add    $0x10,%esp
+
+  unlink("ff");
+    2722:	83 ec 0c             	sub    $0xc,%esp
+    2725:	68 f9 5a 00 00       	push   $0x5af9
+    272a:	e8 f6 22 00 00       	call   4a25 <unlink>
+    272f:	83 c4 10             	add    $0x10,%esp
+  if(mkdir("dd") != 0){
+    2732:	83 ec 0c             	sub    $0xc,%esp
+    2735:	68 fc 5a 00 00       	push   $0x5afc
+    273a:	e8 fe 22 00 00       	call   4a3d <mkdir>
+    273f:	83 c4 10             	add    $0x10,%esp
+    2742:	85 c0                	test   %eax,%eax
+    2744:	74 17                	je     275d <subdir+0x53>
+    printf(1, "subdir mkdir dd failed\n");
+    2746:	83 ec 08             	sub    $0x8,%esp
+    2749:	68 ff 5a 00 00       	push   $0x5aff
+    274e:	6a 01                	push   $0x1
+    2750:	e8 3c 24 00 00       	call   4b91 <printf>
+    2755:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2758:	e8 78 22 00 00       	call   49d5 <exit>
+  }
+
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    275d:	83 ec 08             	sub    $0x8,%esp
+    2760:	68 02 02 00 00       	push   $0x202
+    2765:	68 17 5b 00 00       	push   $0x5b17
+    276a:	e8 a6 22 00 00       	call   4a15 <open>
+    276f:	83 c4 10             	add    $0x10,%esp
+    2772:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    2775:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2779:	79 17                	jns    2792 <subdir+0x88>
+    printf(1, "create dd/ff failed\n");
+    277b:	83 ec 08             	sub    $0x8,%esp
+    277e:	68 1d 5b 00 00       	push   $0x5b1d
+    2783:	6a 01                	push   $0x1
+    2785:	e8 07 24 00 00       	call   4b91 <printf>
+    278a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    278d:	e8 43 22 00 00       	call   49d5 <exit>
+  }
+  write(fd, "ff", 2);
+    2792:	83 ec 04             	sub    $0x4,%esp
+    2795:	6a 02                	push   $0x2
+    2797:	68 f9 5a 00 00       	push   $0x5af9
+    279c:	ff 75 f4             	push   -0xc(%ebp)
+    279f:	e8 51 22 00 00       	call   49f5 <write>
+    27a4:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+    27a7:	83 ec 0c             	sub    $0xc,%esp
+    27aa:	ff 75 f4             	push   -0xc(%ebp)
+    27ad:	e8 4b 22 00 00       	call   49fd <close>
+    27b2:	83 c4 10             	add    $0x10,%esp
+
+  if(unlink("dd") >= 0){
+    27b5:	83 ec 0c             	sub    $0xc,%esp
+    27b8:	68 fc 5a 00 00       	push   $0x5afc
+    27bd:	e8 63 22 00 00       	call   4a25 <unlink>
+    27c2:	83 c4 10             	add    $0x10,%esp
+    27c5:	85 c0                	test   %eax,%eax
+    27c7:	78 17                	js     27e0 <subdir+0xd6>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    27c9:	83 ec 08             	sub    $0x8,%esp
+    27cc:	68 34 5b 00 00       	push   $0x5b34
+    27d1:	6a 01                	push   $0x1
+    27d3:	e8 b9 23 00 00       	call   4b91 <printf>
+    27d8:	83 c4 10             	add    $0x10,%esp
+    exit();
+    27db:	e8 f5 21 00 00       	call   49d5 <exit>
+  }
+
+  if(mkdir("/dd/dd") != 0){
+    27e0:	83 ec 0c             	sub    $0xc,%esp
+    27e3:	68 5a 5b 00 00       	push   $0x5b5a
+    27e8:	e8 50 22 00 00       	call   4a3d <mkdir>
+    27ed:	83 c4 10             	add    $0x10,%esp
+    27f0:	85 c0                	test   %eax,%eax
+    27f2:	74 17                	je     280b <subdir+0x101>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    27f4:	83 ec 08             	sub    $0x8,%esp
+    27f7:	68 61 5b 00 00       	push   $0x5b61
+    27fc:	6a 01                	push   $0x1
+    27fe:	e8 8e 23 00 00       	call   4b91 <printf>
+    2803:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2806:	e8 ca 21 00 00       	call   49d5 <exit>
+  }
+
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    280b:	83 ec 08             	sub    $0x8,%esp
+    280e:	68 02 02 00 00       	push   $0x202
+    2813:	68 7c 5b 00 00       	push   $0x5b7c
+    2818:	e8 f8 21 00 00       	call   4a15 <open>
+    281d:	83 c4 10             	add    $0x10,%esp
+    2820:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    2823:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2827:	79 17                	jns    2840 <subdir+0x136>
+    printf(1, "create dd/dd/ff failed\n");
+    2829:	83 ec 08             	sub    $0x8,%esp
+    282c:	68 85 5b 00 00       	push   $0x5b85
+    2831:	6a 01                	push   $0x1
+    2833:	e8 59 23 00 00       	call   4b91 <printf>
+    2838:	83 c4 10             	add    $0x10,%esp
+    exit();
+    283b:	e8 95 21 00 00       	call   49d5 <exit>
+  }
+  write(fd, "FF", 2);
+    2840:	83 ec 04             	sub    $0x4,%esp
+    2843:	6a 02                	push   $0x2
+    2845:	68 9d 5b 00 00       	push   $0x5b9d
+    284a:	ff 75 f4             	push   -0xc(%ebp)
+    284d:	e8 a3 21 00 00       	call   49f5 <write>
+    2852:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+    2855:	83 ec 0c             	sub    $0xc,%esp
+    2858:	ff 75 f4             	push   -0xc(%ebp)
+    285b:	e8 9d 21 00 00       	call   49fd <close>
+    2860:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("dd/dd/../ff", 0);
+    2863:	83 ec 08             	sub    $0x8,%esp
+    2866:	6a 00                	push   $0x0
+    2868:	68 a0 5b 00 00       	push   $0x5ba0
+    286d:	e8 a3 21 00 00       	call   4a15 <open>
+    2872:	83 c4 10             	add    $0x10,%esp
+    2875:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    2878:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    287c:	79 17                	jns    2895 <subdir+0x18b>
+    printf(1, "open dd/dd/../ff failed\n");
+    287e:	83 ec 08             	sub    $0x8,%esp
+    2881:	68 ac 5b 00 00       	push   $0x5bac
+    2886:	6a 01                	push   $0x1
+    2888:	e8 04 23 00 00       	call   4b91 <printf>
+    288d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2890:	e8 40 21 00 00       	call   49d5 <exit>
+  }
+  cc = read(fd, buf, sizeof(buf));
+    2895:	83 ec 04             	sub    $0x4,%esp
+    2898:	68 00 20 00 00       	push   $0x2000
+    289d:	68 60 9d 01 00       	push   $0x19d60
+    28a2:	ff 75 f4             	push   -0xc(%ebp)
+    28a5:	e8 43 21 00 00       	call   49ed <read>
+    28aa:	83 c4 10             	add    $0x10,%esp
+    28ad:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(cc != 2 || buf[0] != 'f'){
+    28b0:	83 7d f0 02          	cmpl   $0x2,-0x10(%ebp)
+    28b4:	75 0b                	jne    28c1 <subdir+0x1b7>
+    28b6:	0f b6 05 60 9d 01 00 	movzbl 0x19d60,%eax
+    28bd:	3c 66                	cmp    $0x66,%al
+    28bf:	74 17                	je     28d8 <subdir+0x1ce>
+    printf(1, "dd/dd/../ff wrong content\n");
+    28c1:	83 ec 08             	sub    $0x8,%esp
+    28c4:	68 c5 5b 00 00       	push   $0x5bc5
+    28c9:	6a 01                	push   $0x1
+    28cb:	e8 c1 22 00 00       	call   4b91 <printf>
+    28d0:	83 c4 10             	add    $0x10,%esp
+    exit();
+    28d3:	e8 fd 20 00 00       	call   49d5 <exit>
+  }
+  close(fd);
+    28d8:	83 ec 0c             	sub    $0xc,%esp
+    28db:	ff 75 f4             	push   -0xc(%ebp)
+    28de:	e8 1a 21 00 00       	call   49fd <close>
+    28e3:	83 c4 10             	add    $0x10,%esp
+
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    28e6:	83 ec 08             	sub    $0x8,%esp
+    28e9:	68 e0 5b 00 00       	push   $0x5be0
+    28ee:	68 7c 5b 00 00       	push   $0x5b7c
+    28f3:	e8 3d 21 00 00       	call   4a35 <link>
+    28f8:	83 c4 10             	add    $0x10,%esp
+    28fb:	85 c0                	test   %eax,%eax
+    28fd:	74 17                	je     2916 <subdir+0x20c>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    28ff:	83 ec 08             	sub    $0x8,%esp
+    2902:	68 ec 5b 00 00       	push   $0x5bec
+    2907:	6a 01                	push   $0x1
+    2909:	e8 83 22 00 00       	call   4b91 <printf>
+    290e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2911:	e8 bf 20 00 00       	call   49d5 <exit>
+  }
+
+  if(unlink("dd/dd/ff") != 0){
+    2916:	83 ec 0c             	sub    $0xc,%esp
+    2919:	68 7c 5b 00 00       	push   $0x5b7c
+    291e:	e8 02 21 00 00       	call   4a25 <unlink>
+    2923:	83 c4 10             	add    $0x10,%esp
+    2926:	85 c0                	test   %eax,%eax
+    2928:	74 17                	je     2941 <subdir+0x237>
+    printf(1, "unlink dd/dd/ff failed\n");
+    292a:	83 ec 08             	sub    $0x8,%esp
+    292d:	68 0d 5c 00 00       	push   $0x5c0d
+    2932:	6a 01                	push   $0x1
+    2934:	e8 58 22 00 00       	call   4b91 <printf>
+    2939:	83 c4 10             	add    $0x10,%esp
+    exit();
+    293c:	e8 94 20 00 00       	call   49d5 <exit>
+  }
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    2941:	83 ec 08             	sub    $0x8,%esp
+    2944:	6a 00                	push   $0x0
+    2946:	68 7c 5b 00 00       	push   $0x5b7c
+    294b:	e8 c5 20 00 00       	call   4a15 <open>
+    2950:	83 c4 10             	add    $0x10,%esp
+    2953:	85 c0                	test   %eax,%eax
+    2955:	78 17                	js     296e <subdir+0x264>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    2957:	83 ec 08             	sub    $0x8,%esp
+    295a:	68 28 5c 00 00       	push   $0x5c28
+    295f:	6a 01                	push   $0x1
+    2961:	e8 2b 22 00 00       	call   4b91 <printf>
+    2966:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2969:	e8 67 20 00 00       	call   49d5 <exit>
+  }
+
+  if(chdir("dd") != 0){
+    296e:	83 ec 0c             	sub    $0xc,%esp
+    2971:	68 fc 5a 00 00       	push   $0x5afc
+    2976:	e8 ca 20 00 00       	call   4a45 <chdir>
+    297b:	83 c4 10             	add    $0x10,%esp
+    297e:	85 c0                	test   %eax,%eax
+    2980:	74 17                	je     2999 <subdir+0x28f>
+    printf(1, "chdir dd failed\n");
+    2982:	83 ec 08             	sub    $0x8,%esp
+    2985:	68 4c 5c 00 00       	push   $0x5c4c
+    298a:	6a 01                	push   $0x1
+    298c:	e8 00 22 00 00       	call   4b91 <printf>
+    2991:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2994:	e8 3c 20 00 00       	call   49d5 <exit>
+  }
+  if(chdir("dd/../../dd") != 0){
+    2999:	83 ec 0c             	sub    $0xc,%esp
+    299c:	68 5d 5c 00 00       	push   $0x5c5d
+    29a1:	e8 9f 20 00 00       	call   4a45 <chdir>
+    29a6:	83 c4 10             	add    $0x10,%esp
+    29a9:	85 c0                	test   %eax,%eax
+    29ab:	74 17                	je     29c4 <subdir+0x2ba>
+    printf(1, "chdir dd/../../dd failed\n");
+    29ad:	83 ec 08             	sub    $0x8,%esp
+    29b0:	68 69 5c 00 00       	push   $0x5c69
+    29b5:	6a 01                	push   $0x1
+    29b7:	e8 d5 21 00 00       	call   4b91 <printf>
+    29bc:	83 c4 10             	add    $0x10,%esp
+    exit();
+    29bf:	e8 11 20 00 00       	call   49d5 <exit>
+  }
+  if(chdir("dd/../../../dd") != 0){
+    29c4:	83 ec 0c             	sub    $0xc,%esp
+    29c7:	68 83 5c 00 00       	push   $0x5c83
+    29cc:	e8 74 20 00 00       	call   4a45 <chdir>
+    29d1:	83 c4 10             	add    $0x10,%esp
+    29d4:	85 c0                	test   %eax,%eax
+    29d6:	74 17                	je     29ef <subdir+0x2e5>
+    printf(1, "chdir dd/../../dd failed\n");
+    29d8:	83 ec 08             	sub    $0x8,%esp
+    29db:	68 69 5c 00 00       	push   $0x5c69
+    29e0:	6a 01                	push   $0x1
+    29e2:	e8 aa 21 00 00       	call   4b91 <printf>
+    29e7:	83 c4 10             	add    $0x10,%esp
+    exit();
+    29ea:	e8 e6 1f 00 00       	call   49d5 <exit>
+  }
+  if(chdir("./..") != 0){
+    29ef:	83 ec 0c             	sub    $0xc,%esp
+    29f2:	68 92 5c 00 00       	push   $0x5c92
+    29f7:	e8 49 20 00 00       	call   4a45 <chdir>
+    29fc:	83 c4 10             	add    $0x10,%esp
+    29ff:	85 c0                	test   %eax,%eax
+    2a01:	74 17                	je     2a1a <subdir+0x310>
+    printf(1, "chdir ./.. failed\n");
+    2a03:	83 ec 08             	sub    $0x8,%esp
+    2a06:	68 97 5c 00 00       	push   $0x5c97
+    2a0b:	6a 01                	push   $0x1
+    2a0d:	e8 7f 21 00 00       	call   4b91 <printf>
+    2a12:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2a15:	e8 bb 1f 00 00       	call   49d5 <exit>
+  }
+
+  fd = open("dd/dd/ffff", 0);
+    2a1a:	83 ec 08             	sub    $0x8,%esp
+    2a1d:	6a 00                	push   $0x0
+    2a1f:	68 e0 5b 00 00       	push   $0x5be0
+    2a24:	e8 ec 1f 00 00       	call   4a15 <open>
+    2a29:	83 c4 10             	add    $0x10,%esp
+    2a2c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    2a2f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2a33:	79 17                	jns    2a4c <subdir+0x342>
+    printf(1, "open dd/dd/ffff failed\n");
+    2a35:	83 ec 08             	sub    $0x8,%esp
+    2a38:	68 aa 5c 00 00       	push   $0x5caa
+    2a3d:	6a 01                	push   $0x1
+    2a3f:	e8 4d 21 00 00       	call   4b91 <printf>
+    2a44:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2a47:	e8 89 1f 00 00       	call   49d5 <exit>
+  }
+  if(read(fd, buf, sizeof(buf)) != 2){
+    2a4c:	83 ec 04             	sub    $0x4,%esp
+    2a4f:	68 00 20 00 00       	push   $0x2000
+    2a54:	68 60 9d 01 00       	push   $0x19d60
+    2a59:	ff 75 f4             	push   -0xc(%ebp)
+    2a5c:	e8 8c 1f 00 00       	call   49ed <read>
+    2a61:	83 c4 10             	add    $0x10,%esp
+    2a64:	83 f8 02             	cmp    $0x2,%eax
+    2a67:	74 17                	je     2a80 <subdir+0x376>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    2a69:	83 ec 08             	sub    $0x8,%esp
+    2a6c:	68 c2 5c 00 00       	push   $0x5cc2
+    2a71:	6a 01                	push   $0x1
+    2a73:	e8 19 21 00 00       	call   4b91 <printf>
+    2a78:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2a7b:	e8 55 1f 00 00       	call   49d5 <exit>
+  }
+  close(fd);
+    2a80:	83 ec 0c             	sub    $0xc,%esp
+    2a83:	ff 75 f4             	push   -0xc(%ebp)
+    2a86:	e8 72 1f 00 00       	call   49fd <close>
+    2a8b:	83 c4 10             	add    $0x10,%esp
+
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    2a8e:	83 ec 08             	sub    $0x8,%esp
+    2a91:	6a 00                	push   $0x0
+    2a93:	68 7c 5b 00 00       	push   $0x5b7c
+    2a98:	e8 78 1f 00 00       	call   4a15 <open>
+    2a9d:	83 c4 10             	add    $0x10,%esp
+    2aa0:	85 c0                	test   %eax,%eax
+    2aa2:	78 17                	js     2abb <subdir+0x3b1>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    2aa4:	83 ec 08             	sub    $0x8,%esp
+    2aa7:	68 e0 5c 00 00       	push   $0x5ce0
+    2aac:	6a 01                	push   $0x1
+    2aae:	e8 de 20 00 00       	call   4b91 <printf>
+    2ab3:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2ab6:	e8 1a 1f 00 00       	call   49d5 <exit>
+  }
+
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    2abb:	83 ec 08             	sub    $0x8,%esp
+    2abe:	68 02 02 00 00       	push   $0x202
+    2ac3:	68 05 5d 00 00       	push   $0x5d05
+    2ac8:	e8 48 1f 00 00       	call   4a15 <open>
+    2acd:	83 c4 10             	add    $0x10,%esp
+    2ad0:	85 c0                	test   %eax,%eax
+    2ad2:	78 17                	js     2aeb <subdir+0x3e1>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    2ad4:	83 ec 08             	sub    $0x8,%esp
+    2ad7:	68 0e 5d 00 00       	push   $0x5d0e
+    2adc:	6a 01                	push   $0x1
+    2ade:	e8 ae 20 00 00       	call   4b91 <printf>
+    2ae3:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2ae6:	e8 ea 1e 00 00       	call   49d5 <exit>
+  }
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    2aeb:	83 ec 08             	sub    $0x8,%esp
+    2aee:	68 02 02 00 00       	push   $0x202
+    2af3:	68 2a 5d 00 00       	push   $0x5d2a
+    2af8:	e8 18 1f 00 00       	call   4a15 <open>
+    2afd:	83 c4 10             	add    $0x10,%esp
+    2b00:	85 c0                	test   %eax,%eax
+    2b02:	78 17                	js     2b1b <subdir+0x411>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    2b04:	83 ec 08             	sub    $0x8,%esp
+    2b07:	68 33 5d 00 00       	push   $0x5d33
+    2b0c:	6a 01                	push   $0x1
+    2b0e:	e8 7e 20 00 00       	call   4b91 <printf>
+    2b13:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2b16:	e8 ba 1e 00 00       	call   49d5 <exit>
+  }
+  if(open("dd", O_CREATE) >= 0){
+    2b1b:	83 ec 08             	sub    $0x8,%esp
+    2b1e:	68 00 02 00 00       	push   $0x200
+    2b23:	68 fc 5a 00 00       	push   $0x5afc
+    2b28:	e8 e8 1e 00 00       	call   4a15 <open>
+    2b2d:	83 c4 10             	add    $0x10,%esp
+    2b30:	85 c0                	test   %eax,%eax
+    2b32:	78 17                	js     2b4b <subdir+0x441>
+    printf(1, "create dd succeeded!\n");
+    2b34:	83 ec 08             	sub    $0x8,%esp
+    2b37:	68 4f 5d 00 00       	push   $0x5d4f
+    2b3c:	6a 01                	push   $0x1
+    2b3e:	e8 4e 20 00 00       	call   4b91 <printf>
+    2b43:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2b46:	e8 8a 1e 00 00       	call   49d5 <exit>
+  }
+  if(open("dd", O_RDWR) >= 0){
+    2b4b:	83 ec 08             	sub    $0x8,%esp
+    2b4e:	6a 02                	push   $0x2
+    2b50:	68 fc 5a 00 00       	push   $0x5afc
+    2b55:	e8 bb 1e 00 00       	call   4a15 <open>
+    2b5a:	83 c4 10             	add    $0x10,%esp
+    2b5d:	85 c0                	test   %eax,%eax
+    2b5f:	78 17                	js     2b78 <subdir+0x46e>
+    printf(1, "open dd rdwr succeeded!\n");
+    2b61:	83 ec 08             	sub    $0x8,%esp
+    2b64:	68 65 5d 00 00       	push   $0x5d65
+    2b69:	6a 01                	push   $0x1
+    2b6b:	e8 21 20 00 00       	call   4b91 <printf>
+    2b70:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2b73:	e8 5d 1e 00 00       	call   49d5 <exit>
+  }
+  if(open("dd", O_WRONLY) >= 0){
+    2b78:	83 ec 08             	sub    $0x8,%esp
+    2b7b:	6a 01                	push   $0x1
+    2b7d:	68 fc 5a 00 00       	push   $0x5afc
+    2b82:	e8 8e 1e 00 00       	call   4a15 <open>
+    2b87:	83 c4 10             	add    $0x10,%esp
+    2b8a:	85 c0                	test   %eax,%eax
+    2b8c:	78 17                	js     2ba5 <subdir+0x49b>
+    printf(1, "open dd wronly succeeded!\n");
+    2b8e:	83 ec 08             	sub    $0x8,%esp
+    2b91:	68 7e 5d 00 00       	push   $0x5d7e
+    2b96:	6a 01                	push   $0x1
+    2b98:	e8 f4 1f 00 00       	call   4b91 <printf>
+    2b9d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2ba0:	e8 30 1e 00 00       	call   49d5 <exit>
+  }
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    2ba5:	83 ec 08             	sub    $0x8,%esp
+    2ba8:	68 99 5d 00 00       	push   $0x5d99
+    2bad:	68 05 5d 00 00       	push   $0x5d05
+    2bb2:	e8 7e 1e 00 00       	call   4a35 <link>
+    2bb7:	83 c4 10             	add    $0x10,%esp
+    2bba:	85 c0                	test   %eax,%eax
+    2bbc:	75 17                	jne    2bd5 <subdir+0x4cb>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    2bbe:	83 ec 08             	sub    $0x8,%esp
+    2bc1:	68 a4 5d 00 00       	push   $0x5da4
+    2bc6:	6a 01                	push   $0x1
+    2bc8:	e8 c4 1f 00 00       	call   4b91 <printf>
+    2bcd:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2bd0:	e8 00 1e 00 00       	call   49d5 <exit>
+  }
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    2bd5:	83 ec 08             	sub    $0x8,%esp
+    2bd8:	68 99 5d 00 00       	push   $0x5d99
+    2bdd:	68 2a 5d 00 00       	push   $0x5d2a
+    2be2:	e8 4e 1e 00 00       	call   4a35 <link>
+    2be7:	83 c4 10             	add    $0x10,%esp
+    2bea:	85 c0                	test   %eax,%eax
+    2bec:	75 17                	jne    2c05 <subdir+0x4fb>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    2bee:	83 ec 08             	sub    $0x8,%esp
+    2bf1:	68 c8 5d 00 00       	push   $0x5dc8
+    2bf6:	6a 01                	push   $0x1
+    2bf8:	e8 94 1f 00 00       	call   4b91 <printf>
+    2bfd:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2c00:	e8 d0 1d 00 00       	call   49d5 <exit>
+  }
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    2c05:	83 ec 08             	sub    $0x8,%esp
+    2c08:	68 e0 5b 00 00       	push   $0x5be0
+    2c0d:	68 17 5b 00 00       	push   $0x5b17
+    2c12:	e8 1e 1e 00 00       	call   4a35 <link>
+    2c17:	83 c4 10             	add    $0x10,%esp
+    2c1a:	85 c0                	test   %eax,%eax
+    2c1c:	75 17                	jne    2c35 <subdir+0x52b>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    2c1e:	83 ec 08             	sub    $0x8,%esp
+    2c21:	68 ec 5d 00 00       	push   $0x5dec
+    2c26:	6a 01                	push   $0x1
+    2c28:	e8 64 1f 00 00       	call   4b91 <printf>
+    2c2d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2c30:	e8 a0 1d 00 00       	call   49d5 <exit>
+  }
+  if(mkdir("dd/ff/ff") == 0){
+    2c35:	83 ec 0c             	sub    $0xc,%esp
+    2c38:	68 05 5d 00 00       	push   $0x5d05
+    2c3d:	e8 fb 1d 00 00       	call   4a3d <mkdir>
+    2c42:	83 c4 10             	add    $0x10,%esp
+    2c45:	85 c0                	test   %eax,%eax
+    2c47:	75 17                	jne    2c60 <subdir+0x556>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    2c49:	83 ec 08             	sub    $0x8,%esp
+    2c4c:	68 0e 5e 00 00       	push   $0x5e0e
+    2c51:	6a 01                	push   $0x1
+    2c53:	e8 39 1f 00 00       	call   4b91 <printf>
+    2c58:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2c5b:	e8 75 1d 00 00       	call   49d5 <exit>
+  }
+  if(mkdir("dd/xx/ff") == 0){
+    2c60:	83 ec 0c             	sub    $0xc,%esp
+    2c63:	68 2a 5d 00 00       	push   $0x5d2a
+    2c68:	e8 d0 1d 00 00       	call   4a3d <mkdir>
+    2c6d:	83 c4 10             	add    $0x10,%esp
+    2c70:	85 c0                	test   %eax,%eax
+    2c72:	75 17                	jne    2c8b <subdir+0x581>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    2c74:	83 ec 08             	sub    $0x8,%esp
+    2c77:	68 29 5e 00 00       	push   $0x5e29
+    2c7c:	6a 01                	push   $0x1
+    2c7e:	e8 0e 1f 00 00       	call   4b91 <printf>
+    2c83:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2c86:	e8 4a 1d 00 00       	call   49d5 <exit>
+  }
+  if(mkdir("dd/dd/ffff") == 0){
+    2c8b:	83 ec 0c             	sub    $0xc,%esp
+    2c8e:	68 e0 5b 00 00       	push   $0x5be0
+    2c93:	e8 a5 1d 00 00       	call   4a3d <mkdir>
+    2c98:	83 c4 10             	add    $0x10,%esp
+    2c9b:	85 c0                	test   %eax,%eax
+    2c9d:	75 17                	jne    2cb6 <subdir+0x5ac>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    2c9f:	83 ec 08             	sub    $0x8,%esp
+    2ca2:	68 44 5e 00 00       	push   $0x5e44
+    2ca7:	6a 01                	push   $0x1
+    2ca9:	e8 e3 1e 00 00       	call   4b91 <printf>
+    2cae:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2cb1:	e8 1f 1d 00 00       	call   49d5 <exit>
+  }
+  if(unlink("dd/xx/ff") == 0){
+    2cb6:	83 ec 0c             	sub    $0xc,%esp
+    2cb9:	68 2a 5d 00 00       	push   $0x5d2a
+    2cbe:	e8 62 1d 00 00       	call   4a25 <unlink>
+    2cc3:	83 c4 10             	add    $0x10,%esp
+    2cc6:	85 c0                	test   %eax,%eax
+    2cc8:	75 17                	jne    2ce1 <subdir+0x5d7>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    2cca:	83 ec 08             	sub    $0x8,%esp
+    2ccd:	68 61 5e 00 00       	push   $0x5e61
+    2cd2:	6a 01                	push   $0x1
+    2cd4:	e8 b8 1e 00 00       	call   4b91 <printf>
+    2cd9:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2cdc:	e8 f4 1c 00 00       	call   49d5 <exit>
+  }
+  if(unlink("dd/ff/ff") == 0){
+    2ce1:	83 ec 0c             	sub    $0xc,%esp
+    2ce4:	68 05 5d 00 00       	push   $0x5d05
+    2ce9:	e8 37 1d 00 00       	call   4a25 <unlink>
+    2cee:	83 c4 10             	add    $0x10,%esp
+    2cf1:	85 c0                	test   %eax,%eax
+    2cf3:	75 17                	jne    2d0c <subdir+0x602>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    2cf5:	83 ec 08             	sub    $0x8,%esp
+    2cf8:	68 7d 5e 00 00       	push   $0x5e7d
+    2cfd:	6a 01                	push   $0x1
+    2cff:	e8 8d 1e 00 00       	call   4b91 <printf>
+    2d04:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2d07:	e8 c9 1c 00 00       	call   49d5 <exit>
+  }
+  if(chdir("dd/ff") == 0){
+    2d0c:	83 ec 0c             	sub    $0xc,%esp
+    2d0f:	68 17 5b 00 00       	push   $0x5b17
+    2d14:	e8 2c 1d 00 00       	call   4a45 <chdir>
+    2d19:	83 c4 10             	add    $0x10,%esp
+    2d1c:	85 c0                	test   %eax,%eax
+    2d1e:	75 17                	jne    2d37 <subdir+0x62d>
+    printf(1, "chdir dd/ff succeeded!\n");
+    2d20:	83 ec 08             	sub    $0x8,%esp
+    2d23:	68 99 5e 00 00       	push   $0x5e99
+    2d28:	6a 01                	push   $0x1
+    2d2a:	e8 62 1e 00 00       	call   4b91 <printf>
+    2d2f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2d32:	e8 9e 1c 00 00       	call   49d5 <exit>
+  }
+  if(chdir("dd/xx") == 0){
+    2d37:	83 ec 0c             	sub    $0xc,%esp
+    2d3a:	68 b1 5e 00 00       	push   $0x5eb1
+    2d3f:	e8 01 1d 00 00       	call   4a45 <chdir>
+    2d44:	83 c4 10             	add    $0x10,%esp
+    2d47:	85 c0                	test   %eax,%eax
+    2d49:	75 17                	jne    2d62 <subdir+0x658>
+    printf(1, "chdir dd/xx succeeded!\n");
+    2d4b:	83 ec 08             	sub    $0x8,%esp
+    2d4e:	68 b7 5e 00 00       	push   $0x5eb7
+    2d53:	6a 01                	push   $0x1
+    2d55:	e8 37 1e 00 00       	call   4b91 <printf>
+    2d5a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2d5d:	e8 73 1c 00 00       	call   49d5 <exit>
+  }
+
+  if(unlink("dd/dd/ffff") != 0){
+    2d62:	83 ec 0c             	sub    $0xc,%esp
+    2d65:	68 e0 5b 00 00       	push   $0x5be0
+    2d6a:	e8 b6 1c 00 00       	call   4a25 <unlink>
+    2d6f:	83 c4 10             	add    $0x10,%esp
+    2d72:	85 c0                	test   %eax,%eax
+    2d74:	74 17                	je     2d8d <subdir+0x683>
+    printf(1, "unlink dd/dd/ff failed\n");
+    2d76:	83 ec 08             	sub    $0x8,%esp
+    2d79:	68 0d 5c 00 00       	push   $0x5c0d
+    2d7e:	6a 01                	push   $0x1
+    2d80:	e8 0c 1e 00 00       	call   4b91 <printf>
+    2d85:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2d88:	e8 48 1c 00 00       	call   49d5 <exit>
+  }
+  if(unlink("dd/ff") != 0){
+    2d8d:	83 ec 0c             	sub    $0xc,%esp
+    2d90:	68 17 5b 00 00       	push   $0x5b17
+    2d95:	e8 8b 1c 00 00       	call   4a25 <unlink>
+    2d9a:	83 c4 10             	add    $0x10,%esp
+    2d9d:	85 c0                	test   %eax,%eax
+    2d9f:	74 17                	je     2db8 <subdir+0x6ae>
+    printf(1, "unlink dd/ff failed\n");
+    2da1:	83 ec 08             	sub    $0x8,%esp
+    2da4:	68 cf 5e 00 00       	push   $0x5ecf
+    2da9:	6a 01                	push   $0x1
+    2dab:	e8 e1 1d 00 00       	call   4b91 <printf>
+    2db0:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2db3:	e8 1d 1c 00 00       	call   49d5 <exit>
+  }
+  if(unlink("dd") == 0){
+    2db8:	83 ec 0c             	sub    $0xc,%esp
+    2dbb:	68 fc 5a 00 00       	push   $0x5afc
+    2dc0:	e8 60 1c 00 00       	call   4a25 <unlink>
+    2dc5:	83 c4 10             	add    $0x10,%esp
+    2dc8:	85 c0                	test   %eax,%eax
+    2dca:	75 17                	jne    2de3 <subdir+0x6d9>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    2dcc:	83 ec 08             	sub    $0x8,%esp
+    2dcf:	68 e4 5e 00 00       	push   $0x5ee4
+    2dd4:	6a 01                	push   $0x1
+    2dd6:	e8 b6 1d 00 00       	call   4b91 <printf>
+    2ddb:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2dde:	e8 f2 1b 00 00       	call   49d5 <exit>
+  }
+  if(unlink("dd/dd") < 0){
+    2de3:	83 ec 0c             	sub    $0xc,%esp
+    2de6:	68 04 5f 00 00       	push   $0x5f04
+    2deb:	e8 35 1c 00 00       	call   4a25 <unlink>
+    2df0:	83 c4 10             	add    $0x10,%esp
+    2df3:	85 c0                	test   %eax,%eax
+    2df5:	79 17                	jns    2e0e <subdir+0x704>
+    printf(1, "unlink dd/dd failed\n");
+    2df7:	83 ec 08             	sub    $0x8,%esp
+    2dfa:	68 0a 5f 00 00       	push   $0x5f0a
+    2dff:	6a 01                	push   $0x1
+    2e01:	e8 8b 1d 00 00       	call   4b91 <printf>
+    2e06:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2e09:	e8 c7 1b 00 00       	call   49d5 <exit>
+  }
+  if(unlink("dd") < 0){
+    2e0e:	83 ec 0c             	sub    $0xc,%esp
+    2e11:	68 fc 5a 00 00       	push   $0x5afc
+    2e16:	e8 0a 1c 00 00       	call   4a25 <unlink>
+    2e1b:	83 c4 10             	add    $0x10,%esp
+    2e1e:	85 c0                	test   %eax,%eax
+    2e20:	79 17                	jns    2e39 <subdir+0x72f>
+    printf(1, "unlink dd failed\n");
+    2e22:	83 ec 08             	sub    $0x8,%esp
+    2e25:	68 1f 5f 00 00       	push   $0x5f1f
+    2e2a:	6a 01                	push   $0x1
+    2e2c:	e8 60 1d 00 00       	call   4b91 <printf>
+    2e31:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2e34:	e8 9c 1b 00 00       	call   49d5 <exit>
+  }
+
+  printf(1, "subdir ok\n");
+    2e39:	83 ec 08             	sub    $0x8,%esp
+    2e3c:	68 31 5f 00 00       	push   $0x5f31
+    2e41:	6a 01                	push   $0x1
+    2e43:	e8 49 1d 00 00       	call   4b91 <printf>
+    2e48:	83 c4 10             	add    $0x10,%esp
+}
+    2e4b:	90                   	nop
+    2e4c:	c9                   	leave
+    2e4d:	c3                   	ret
+
+00002e4e <bigwrite>:
+
+// test writes that are larger than the log.
+void
+bigwrite(void)
+{
+    2e4e:	55                   	push   %ebp
+    2e4f:	89 e5                	mov    %esp,%ebp
+    2e51:	83 ec 18             	sub    $0x18,%esp
+  int fd, sz;
+
+  printf(1, "bigwrite test\n");
+    2e54:	83 ec 08             	sub    $0x8,%esp
+    2e57:	68 3c 5f 00 00       	push   $0x5f3c
+    2e5c:	6a 01                	push   $0x1
+    2e5e:	e8 2e 1d 00 00       	call   4b91 <printf>
+    2e63:	83 c4 10             	add    $0x10,%esp
+
+  unlink("bigwrite");
+    2e66:	83 ec 0c             	sub    $0xc,%esp
+    2e69:	68 4b 5f 00 00       	push   $0x5f4b
+    2e6e:	e8 b2 1b 00 00       	call   4a25 <unlink>
+    2e73:	83 c4 10             	add    $0x10,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    2e76:	c7 45 f4 f3 01 00 00 	movl   $0x1f3,-0xc(%ebp)
+    2e7d:	e9 a8 00 00 00       	jmp    2f2a <bigwrite+0xdc>
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    2e82:	83 ec 08             	sub    $0x8,%esp
+    2e85:	68 02 02 00 00       	push   $0x202
+    2e8a:	68 4b 5f 00 00       	push   $0x5f4b
+    2e8f:	e8 81 1b 00 00       	call   4a15 <open>
+    2e94:	83 c4 10             	add    $0x10,%esp
+    2e97:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if(fd < 0){
+    2e9a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    2e9e:	79 17                	jns    2eb7 <bigwrite+0x69>
+      printf(1, "cannot create bigwrite\n");
+    2ea0:	83 ec 08             	sub    $0x8,%esp
+    2ea3:	68 54 5f 00 00       	push   $0x5f54
+    2ea8:	6a 01                	push   $0x1
+    2eaa:	e8 e2 1c 00 00       	call   4b91 <printf>
+    2eaf:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2eb2:	e8 1e 1b 00 00       	call   49d5 <exit>
+    }
+    int i;
+    for(i = 0; i < 2; i++){
+    2eb7:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    2ebe:	eb 3f                	jmp    2eff <bigwrite+0xb1>
+      int cc = write(fd, buf, sz);
+    2ec0:	83 ec 04             	sub    $0x4,%esp
+    2ec3:	ff 75 f4             	push   -0xc(%ebp)
+    2ec6:	68 60 9d 01 00       	push   $0x19d60
+    2ecb:	ff 75 ec             	push   -0x14(%ebp)
+    2ece:	e8 22 1b 00 00       	call   49f5 <write>
+    2ed3:	83 c4 10             	add    $0x10,%esp
+    2ed6:	89 45 e8             	mov    %eax,-0x18(%ebp)
+      if(cc != sz){
+    2ed9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    2edc:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    2edf:	74 1a                	je     2efb <bigwrite+0xad>
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    2ee1:	ff 75 e8             	push   -0x18(%ebp)
+    2ee4:	ff 75 f4             	push   -0xc(%ebp)
+    2ee7:	68 6c 5f 00 00       	push   $0x5f6c
+    2eec:	6a 01                	push   $0x1
+    2eee:	e8 9e 1c 00 00       	call   4b91 <printf>
+    2ef3:	83 c4 10             	add    $0x10,%esp
+        exit();
+    2ef6:	e8 da 1a 00 00       	call   49d5 <exit>
+    for(i = 0; i < 2; i++){
+    2efb:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    2eff:	83 7d f0 01          	cmpl   $0x1,-0x10(%ebp)
+    2f03:	7e bb                	jle    2ec0 <bigwrite+0x72>
+      }
+    }
+    close(fd);
+    2f05:	83 ec 0c             	sub    $0xc,%esp
+    2f08:	ff 75 ec             	push   -0x14(%ebp)
+    2f0b:	e8 ed 1a 00 00       	call   49fd <close>
+    2f10:	83 c4 10             	add    $0x10,%esp
+    unlink("bigwrite");
+    2f13:	83 ec 0c             	sub    $0xc,%esp
+    2f16:	68 4b 5f 00 00       	push   $0x5f4b
+    2f1b:	e8 05 1b 00 00       	call   4a25 <unlink>
+    2f20:	83 c4 10             	add    $0x10,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    2f23:	81 45 f4 d7 01 00 00 	addl   $0x1d7,-0xc(%ebp)
+    2f2a:	81 7d f4 ff 17 00 00 	cmpl   $0x17ff,-0xc(%ebp)
+    2f31:	0f 8e 4b ff ff ff    	jle    2e82 <bigwrite+0x34>
+  }
+
+  printf(1, "bigwrite ok\n");
+    2f37:	83 ec 08             	sub    $0x8,%esp
+    2f3a:	68 7e 5f 00 00       	push   $0x5f7e
+    2f3f:	6a 01                	push   $0x1
+    2f41:	e8 4b 1c 00 00       	call   4b91 <printf>
+    2f46:	83 c4 10             	add    $0x10,%esp
+}
+    2f49:	90                   	nop
+    2f4a:	c9                   	leave
+    2f4b:	c3                   	ret
+
+00002f4c <bigfile>:
+
+void
+bigfile(void)
+{
+    2f4c:	55                   	push   %ebp
+    2f4d:	89 e5                	mov    %esp,%ebp
+    2f4f:	83 ec 18             	sub    $0x18,%esp
+  int fd, i, total, cc;
+
+  printf(1, "bigfile test\n");
+    2f52:	83 ec 08             	sub    $0x8,%esp
+    2f55:	68 8b 5f 00 00       	push   $0x5f8b
+    2f5a:	6a 01                	push   $0x1
+    2f5c:	e8 30 1c 00 00       	call   4b91 <printf>
+    2f61:	83 c4 10             	add    $0x10,%esp
+
+  unlink("bigfile");
+    2f64:	83 ec 0c             	sub    $0xc,%esp
+    2f67:	68 99 5f 00 00       	push   $0x5f99
+    2f6c:	e8 b4 1a 00 00       	call   4a25 <unlink>
+    2f71:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    2f74:	83 ec 08             	sub    $0x8,%esp
+    2f77:	68 02 02 00 00       	push   $0x202
+    2f7c:	68 99 5f 00 00       	push   $0x5f99
+    2f81:	e8 8f 1a 00 00       	call   4a15 <open>
+    2f86:	83 c4 10             	add    $0x10,%esp
+    2f89:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+    2f8c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    2f90:	79 17                	jns    2fa9 <bigfile+0x5d>
+    printf(1, "cannot create bigfile");
+    2f92:	83 ec 08             	sub    $0x8,%esp
+    2f95:	68 a1 5f 00 00       	push   $0x5fa1
+    2f9a:	6a 01                	push   $0x1
+    2f9c:	e8 f0 1b 00 00       	call   4b91 <printf>
+    2fa1:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2fa4:	e8 2c 1a 00 00       	call   49d5 <exit>
+  }
+  for(i = 0; i < 20; i++){
+    2fa9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2fb0:	eb 52                	jmp    3004 <bigfile+0xb8>
+    memset(buf, i, 600);
+    2fb2:	83 ec 04             	sub    $0x4,%esp
+    2fb5:	68 58 02 00 00       	push   $0x258
+    2fba:	ff 75 f4             	push   -0xc(%ebp)
+    2fbd:	68 60 9d 01 00       	push   $0x19d60
+    2fc2:	e8 dd 15 00 00       	call   45a4 <memset>
+    2fc7:	83 c4 10             	add    $0x10,%esp
+    if(write(fd, buf, 600) != 600){
+    2fca:	83 ec 04             	sub    $0x4,%esp
+    2fcd:	68 58 02 00 00       	push   $0x258
+    2fd2:	68 60 9d 01 00       	push   $0x19d60
+    2fd7:	ff 75 ec             	push   -0x14(%ebp)
+    2fda:	e8 16 1a 00 00       	call   49f5 <write>
+    2fdf:	83 c4 10             	add    $0x10,%esp
+    2fe2:	3d 58 02 00 00       	cmp    $0x258,%eax
+    2fe7:	74 17                	je     3000 <bigfile+0xb4>
+      printf(1, "write bigfile failed\n");
+    2fe9:	83 ec 08             	sub    $0x8,%esp
+    2fec:	68 b7 5f 00 00       	push   $0x5fb7
+    2ff1:	6a 01                	push   $0x1
+    2ff3:	e8 99 1b 00 00       	call   4b91 <printf>
+    2ff8:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2ffb:	e8 d5 19 00 00       	call   49d5 <exit>
+  for(i = 0; i < 20; i++){
+    3000:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    3004:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    3008:	7e a8                	jle    2fb2 <bigfile+0x66>
+    }
+  }
+  close(fd);
+    300a:	83 ec 0c             	sub    $0xc,%esp
+    300d:	ff 75 ec             	push   -0x14(%ebp)
+    3010:	e8 e8 19 00 00       	call   49fd <close>
+    3015:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("bigfile", 0);
+    3018:	83 ec 08             	sub    $0x8,%esp
+    301b:	6a 00                	push   $0x0
+    301d:	68 99 5f 00 00       	push   $0x5f99
+    3022:	e8 ee 19 00 00       	call   4a15 <open>
+    3027:	83 c4 10             	add    $0x10,%esp
+    302a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+    302d:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    3031:	79 17                	jns    304a <bigfile+0xfe>
+    printf(1, "cannot open bigfile\n");
+    3033:	83 ec 08             	sub    $0x8,%esp
+    3036:	68 cd 5f 00 00       	push   $0x5fcd
+    303b:	6a 01                	push   $0x1
+    303d:	e8 4f 1b 00 00       	call   4b91 <printf>
+    3042:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3045:	e8 8b 19 00 00       	call   49d5 <exit>
+  }
+  total = 0;
+    304a:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  for(i = 0; ; i++){
+    3051:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    cc = read(fd, buf, 300);
+    3058:	83 ec 04             	sub    $0x4,%esp
+    305b:	68 2c 01 00 00       	push   $0x12c
+    3060:	68 60 9d 01 00       	push   $0x19d60
+    3065:	ff 75 ec             	push   -0x14(%ebp)
+    3068:	e8 80 19 00 00       	call   49ed <read>
+    306d:	83 c4 10             	add    $0x10,%esp
+    3070:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(cc < 0){
+    3073:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    3077:	79 17                	jns    3090 <bigfile+0x144>
+      printf(1, "read bigfile failed\n");
+    3079:	83 ec 08             	sub    $0x8,%esp
+    307c:	68 e2 5f 00 00       	push   $0x5fe2
+    3081:	6a 01                	push   $0x1
+    3083:	e8 09 1b 00 00       	call   4b91 <printf>
+    3088:	83 c4 10             	add    $0x10,%esp
+      exit();
+    308b:	e8 45 19 00 00       	call   49d5 <exit>
+    }
+    if(cc == 0)
+    3090:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    3094:	74 7a                	je     3110 <bigfile+0x1c4>
+      break;
+    if(cc != 300){
+    3096:	81 7d e8 2c 01 00 00 	cmpl   $0x12c,-0x18(%ebp)
+    309d:	74 17                	je     30b6 <bigfile+0x16a>
+      printf(1, "short read bigfile\n");
+    309f:	83 ec 08             	sub    $0x8,%esp
+    30a2:	68 f7 5f 00 00       	push   $0x5ff7
+    30a7:	6a 01                	push   $0x1
+    30a9:	e8 e3 1a 00 00       	call   4b91 <printf>
+    30ae:	83 c4 10             	add    $0x10,%esp
+      exit();
+    30b1:	e8 1f 19 00 00       	call   49d5 <exit>
+    }
+    if(buf[0] != i/2 || buf[299] != i/2){
+    30b6:	0f b6 05 60 9d 01 00 	movzbl 0x19d60,%eax
+    30bd:	0f be d0             	movsbl %al,%edx
+    30c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    30c3:	89 c1                	mov    %eax,%ecx
+    30c5:	c1 e9 1f             	shr    $0x1f,%ecx
+    30c8:	01 c8                	add    %ecx,%eax
+    30ca:	d1 f8                	sar    %eax
+    30cc:	39 c2                	cmp    %eax,%edx
+    30ce:	75 1a                	jne    30ea <bigfile+0x19e>
+    30d0:	0f b6 05 8b 9e 01 00 	movzbl 0x19e8b,%eax
+    30d7:	0f be d0             	movsbl %al,%edx
+    30da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    30dd:	89 c1                	mov    %eax,%ecx
+    30df:	c1 e9 1f             	shr    $0x1f,%ecx
+    30e2:	01 c8                	add    %ecx,%eax
+    30e4:	d1 f8                	sar    %eax
+    30e6:	39 c2                	cmp    %eax,%edx
+    30e8:	74 17                	je     3101 <bigfile+0x1b5>
+      printf(1, "read bigfile wrong data\n");
+    30ea:	83 ec 08             	sub    $0x8,%esp
+    30ed:	68 0b 60 00 00       	push   $0x600b
+    30f2:	6a 01                	push   $0x1
+    30f4:	e8 98 1a 00 00       	call   4b91 <printf>
+    30f9:	83 c4 10             	add    $0x10,%esp
+      exit();
+    30fc:	e8 d4 18 00 00       	call   49d5 <exit>
+    }
+    total += cc;
+    3101:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    3104:	01 45 f0             	add    %eax,-0x10(%ebp)
+  for(i = 0; ; i++){
+    3107:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    cc = read(fd, buf, 300);
+    310b:	e9 48 ff ff ff       	jmp    3058 <bigfile+0x10c>
+      break;
+    3110:	90                   	nop
+  }
+  close(fd);
+    3111:	83 ec 0c             	sub    $0xc,%esp
+    3114:	ff 75 ec             	push   -0x14(%ebp)
+    3117:	e8 e1 18 00 00       	call   49fd <close>
+    311c:	83 c4 10             	add    $0x10,%esp
+  if(total != 20*600){
+    311f:	81 7d f0 e0 2e 00 00 	cmpl   $0x2ee0,-0x10(%ebp)
+    3126:	74 17                	je     313f <bigfile+0x1f3>
+    printf(1, "read bigfile wrong total\n");
+    3128:	83 ec 08             	sub    $0x8,%esp
+    312b:	68 24 60 00 00       	push   $0x6024
+    3130:	6a 01                	push   $0x1
+    3132:	e8 5a 1a 00 00       	call   4b91 <printf>
+    3137:	83 c4 10             	add    $0x10,%esp
+    exit();
+    313a:	e8 96 18 00 00       	call   49d5 <exit>
+  }
+  unlink("bigfile");
+    313f:	83 ec 0c             	sub    $0xc,%esp
+    3142:	68 99 5f 00 00       	push   $0x5f99
+    3147:	e8 d9 18 00 00       	call   4a25 <unlink>
+    314c:	83 c4 10             	add    $0x10,%esp
+
+  printf(1, "bigfile test ok\n");
+    314f:	83 ec 08             	sub    $0x8,%esp
+    3152:	68 3e 60 00 00       	push   $0x603e
+    3157:	6a 01                	push   $0x1
+    3159:	e8 33 1a 00 00       	call   4b91 <printf>
+    315e:	83 c4 10             	add    $0x10,%esp
+}
+    3161:	90                   	nop
+    3162:	c9                   	leave
+    3163:	c3                   	ret
+
+00003164 <fourteen>:
+
+void
+fourteen(void)
+{
+    3164:	55                   	push   %ebp
+    3165:	89 e5                	mov    %esp,%ebp
+    3167:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  // DIRSIZ is 14.
+  printf(1, "fourteen test\n");
+    316a:	83 ec 08             	sub    $0x8,%esp
+    316d:	68 4f 60 00 00       	push   $0x604f
+    3172:	6a 01                	push   $0x1
+    3174:	e8 18 1a 00 00       	call   4b91 <printf>
+    3179:	83 c4 10             	add    $0x10,%esp
+
+  if(mkdir("12345678901234") != 0){
+    317c:	83 ec 0c             	sub    $0xc,%esp
+    317f:	68 5e 60 00 00       	push   $0x605e
+    3184:	e8 b4 18 00 00       	call   4a3d <mkdir>
+    3189:	83 c4 10             	add    $0x10,%esp
+    318c:	85 c0                	test   %eax,%eax
+    318e:	74 17                	je     31a7 <fourteen+0x43>
+    printf(1, "mkdir 12345678901234 failed\n");
+    3190:	83 ec 08             	sub    $0x8,%esp
+    3193:	68 6d 60 00 00       	push   $0x606d
+    3198:	6a 01                	push   $0x1
+    319a:	e8 f2 19 00 00       	call   4b91 <printf>
+    319f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    31a2:	e8 2e 18 00 00       	call   49d5 <exit>
+  }
+  if(mkdir("12345678901234/123456789012345") != 0){
+    31a7:	83 ec 0c             	sub    $0xc,%esp
+    31aa:	68 8c 60 00 00       	push   $0x608c
+    31af:	e8 89 18 00 00       	call   4a3d <mkdir>
+    31b4:	83 c4 10             	add    $0x10,%esp
+    31b7:	85 c0                	test   %eax,%eax
+    31b9:	74 17                	je     31d2 <fourteen+0x6e>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    31bb:	83 ec 08             	sub    $0x8,%esp
+    31be:	68 ac 60 00 00       	push   $0x60ac
+    31c3:	6a 01                	push   $0x1
+    31c5:	e8 c7 19 00 00       	call   4b91 <printf>
+    31ca:	83 c4 10             	add    $0x10,%esp
+    exit();
+    31cd:	e8 03 18 00 00       	call   49d5 <exit>
+  }
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    31d2:	83 ec 08             	sub    $0x8,%esp
+    31d5:	68 00 02 00 00       	push   $0x200
+    31da:	68 dc 60 00 00       	push   $0x60dc
+    31df:	e8 31 18 00 00       	call   4a15 <open>
+    31e4:	83 c4 10             	add    $0x10,%esp
+    31e7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    31ea:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    31ee:	79 17                	jns    3207 <fourteen+0xa3>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    31f0:	83 ec 08             	sub    $0x8,%esp
+    31f3:	68 0c 61 00 00       	push   $0x610c
+    31f8:	6a 01                	push   $0x1
+    31fa:	e8 92 19 00 00       	call   4b91 <printf>
+    31ff:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3202:	e8 ce 17 00 00       	call   49d5 <exit>
+  }
+  close(fd);
+    3207:	83 ec 0c             	sub    $0xc,%esp
+    320a:	ff 75 f4             	push   -0xc(%ebp)
+    320d:	e8 eb 17 00 00       	call   49fd <close>
+    3212:	83 c4 10             	add    $0x10,%esp
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    3215:	83 ec 08             	sub    $0x8,%esp
+    3218:	6a 00                	push   $0x0
+    321a:	68 4c 61 00 00       	push   $0x614c
+    321f:	e8 f1 17 00 00       	call   4a15 <open>
+    3224:	83 c4 10             	add    $0x10,%esp
+    3227:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    322a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    322e:	79 17                	jns    3247 <fourteen+0xe3>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    3230:	83 ec 08             	sub    $0x8,%esp
+    3233:	68 7c 61 00 00       	push   $0x617c
+    3238:	6a 01                	push   $0x1
+    323a:	e8 52 19 00 00       	call   4b91 <printf>
+    323f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3242:	e8 8e 17 00 00       	call   49d5 <exit>
+  }
+  close(fd);
+    3247:	83 ec 0c             	sub    $0xc,%esp
+    324a:	ff 75 f4             	push   -0xc(%ebp)
+    324d:	e8 ab 17 00 00       	call   49fd <close>
+    3252:	83 c4 10             	add    $0x10,%esp
+
+  if(mkdir("12345678901234/12345678901234") == 0){
+    3255:	83 ec 0c             	sub    $0xc,%esp
+    3258:	68 b6 61 00 00       	push   $0x61b6
+    325d:	e8 db 17 00 00       	call   4a3d <mkdir>
+    3262:	83 c4 10             	add    $0x10,%esp
+    3265:	85 c0                	test   %eax,%eax
+    3267:	75 17                	jne    3280 <fourteen+0x11c>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    3269:	83 ec 08             	sub    $0x8,%esp
+    326c:	68 d4 61 00 00       	push   $0x61d4
+    3271:	6a 01                	push   $0x1
+    3273:	e8 19 19 00 00       	call   4b91 <printf>
+    3278:	83 c4 10             	add    $0x10,%esp
+    exit();
+    327b:	e8 55 17 00 00       	call   49d5 <exit>
+  }
+  if(mkdir("123456789012345/12345678901234") == 0){
+    3280:	83 ec 0c             	sub    $0xc,%esp
+    3283:	68 04 62 00 00       	push   $0x6204
+    3288:	e8 b0 17 00 00       	call   4a3d <mkdir>
+    328d:	83 c4 10             	add    $0x10,%esp
+    3290:	85 c0                	test   %eax,%eax
+    3292:	75 17                	jne    32ab <fourteen+0x147>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    3294:	83 ec 08             	sub    $0x8,%esp
+    3297:	68 24 62 00 00       	push   $0x6224
+    329c:	6a 01                	push   $0x1
+    329e:	e8 ee 18 00 00       	call   4b91 <printf>
+    32a3:	83 c4 10             	add    $0x10,%esp
+    exit();
+    32a6:	e8 2a 17 00 00       	call   49d5 <exit>
+  }
+
+  printf(1, "fourteen ok\n");
+    32ab:	83 ec 08             	sub    $0x8,%esp
+    32ae:	68 55 62 00 00       	push   $0x6255
+    32b3:	6a 01                	push   $0x1
+    32b5:	e8 d7 18 00 00       	call   4b91 <printf>
+    32ba:	83 c4 10             	add    $0x10,%esp
+}
+    32bd:	90                   	nop
+    32be:	c9                   	leave
+    32bf:	c3                   	ret
+
+000032c0 <rmdot>:
+
+void
+rmdot(void)
+{
+    32c0:	55                   	push   %ebp
+    32c1:	89 e5                	mov    %esp,%ebp
+    32c3:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "rmdot test\n");
+    32c6:	83 ec 08             	sub    $0x8,%esp
+    32c9:	68 62 62 00 00       	push   $0x6262
+    32ce:	6a 01                	push   $0x1
+    32d0:	e8 bc 18 00 00       	call   4b91 <printf>
+    32d5:	83 c4 10             	add    $0x10,%esp
+  if(mkdir("dots") != 0){
+    32d8:	83 ec 0c             	sub    $0xc,%esp
+    32db:	68 6e 62 00 00       	push   $0x626e
+    32e0:	e8 58 17 00 00       	call   4a3d <mkdir>
+    32e5:	83 c4 10             	add    $0x10,%esp
+    32e8:	85 c0                	test   %eax,%eax
+    32ea:	74 17                	je     3303 <rmdot+0x43>
+    printf(1, "mkdir dots failed\n");
+    32ec:	83 ec 08             	sub    $0x8,%esp
+    32ef:	68 73 62 00 00       	push   $0x6273
+    32f4:	6a 01                	push   $0x1
+    32f6:	e8 96 18 00 00       	call   4b91 <printf>
+    32fb:	83 c4 10             	add    $0x10,%esp
+    exit();
+    32fe:	e8 d2 16 00 00       	call   49d5 <exit>
+  }
+  if(chdir("dots") != 0){
+    3303:	83 ec 0c             	sub    $0xc,%esp
+    3306:	68 6e 62 00 00       	push   $0x626e
+    330b:	e8 35 17 00 00       	call   4a45 <chdir>
+    3310:	83 c4 10             	add    $0x10,%esp
+    3313:	85 c0                	test   %eax,%eax
+    3315:	74 17                	je     332e <rmdot+0x6e>
+    printf(1, "chdir dots failed\n");
+    3317:	83 ec 08             	sub    $0x8,%esp
+    331a:	68 86 62 00 00       	push   $0x6286
+    331f:	6a 01                	push   $0x1
+    3321:	e8 6b 18 00 00       	call   4b91 <printf>
+    3326:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3329:	e8 a7 16 00 00       	call   49d5 <exit>
+  }
+  if(unlink(".") == 0){
+    332e:	83 ec 0c             	sub    $0xc,%esp
+    3331:	68 cb 58 00 00       	push   $0x58cb
+    3336:	e8 ea 16 00 00       	call   4a25 <unlink>
+    333b:	83 c4 10             	add    $0x10,%esp
+    333e:	85 c0                	test   %eax,%eax
+    3340:	75 17                	jne    3359 <rmdot+0x99>
+    printf(1, "rm . worked!\n");
+    3342:	83 ec 08             	sub    $0x8,%esp
+    3345:	68 99 62 00 00       	push   $0x6299
+    334a:	6a 01                	push   $0x1
+    334c:	e8 40 18 00 00       	call   4b91 <printf>
+    3351:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3354:	e8 7c 16 00 00       	call   49d5 <exit>
+  }
+  if(unlink("..") == 0){
+    3359:	83 ec 0c             	sub    $0xc,%esp
+    335c:	68 8e 53 00 00       	push   $0x538e
+    3361:	e8 bf 16 00 00       	call   4a25 <unlink>
+    3366:	83 c4 10             	add    $0x10,%esp
+    3369:	85 c0                	test   %eax,%eax
+    336b:	75 17                	jne    3384 <rmdot+0xc4>
+    printf(1, "rm .. worked!\n");
+    336d:	83 ec 08             	sub    $0x8,%esp
+    3370:	68 a7 62 00 00       	push   $0x62a7
+    3375:	6a 01                	push   $0x1
+    3377:	e8 15 18 00 00       	call   4b91 <printf>
+    337c:	83 c4 10             	add    $0x10,%esp
+    exit();
+    337f:	e8 51 16 00 00       	call   49d5 <exit>
+  }
+  if(chdir("/") != 0){
+    3384:	83 ec 0c             	sub    $0xc,%esp
+    3387:	68 de 4f 00 00       	push   $0x4fde
+    338c:	e8 b4 16 00 00       	call   4a45 <chdir>
+    3391:	83 c4 10             	add    $0x10,%esp
+    3394:	85 c0                	test   %eax,%eax
+    3396:	74 17                	je     33af <rmdot+0xef>
+    printf(1, "chdir / failed\n");
+    3398:	83 ec 08             	sub    $0x8,%esp
+    339b:	68 e0 4f 00 00       	push   $0x4fe0
+    33a0:	6a 01                	push   $0x1
+    33a2:	e8 ea 17 00 00       	call   4b91 <printf>
+    33a7:	83 c4 10             	add    $0x10,%esp
+    exit();
+    33aa:	e8 26 16 00 00       	call   49d5 <exit>
+  }
+  if(unlink("dots/.") == 0){
+    33af:	83 ec 0c             	sub    $0xc,%esp
+    33b2:	68 b6 62 00 00       	push   $0x62b6
+    33b7:	e8 69 16 00 00       	call   4a25 <unlink>
+    33bc:	83 c4 10             	add    $0x10,%esp
+    33bf:	85 c0                	test   %eax,%eax
+    33c1:	75 17                	jne    33da <rmdot+0x11a>
+    printf(1, "unlink dots/. worked!\n");
+    33c3:	83 ec 08             	sub    $0x8,%esp
+    33c6:	68 bd 62 00 00       	push   $0x62bd
+    33cb:	6a 01                	push   $0x1
+    33cd:	e8 bf 17 00 00       	call   4b91 <printf>
+    33d2:	83 c4 10             	add    $0x10,%esp
+    exit();
+    33d5:	e8 fb 15 00 00       	call   49d5 <exit>
+  }
+  if(unlink("dots/..") == 0){
+    33da:	83 ec 0c             	sub    $0xc,%esp
+    33dd:	68 d4 62 00 00       	push   $0x62d4
+    33e2:	e8 3e 16 00 00       	call   4a25 <unlink>
+    33e7:	83 c4 10             	add    $0x10,%esp
+    33ea:	85 c0                	test   %eax,%eax
+    33ec:	75 17                	jne    3405 <rmdot+0x145>
+    printf(1, "unlink dots/.. worked!\n");
+    33ee:	83 ec 08             	sub    $0x8,%esp
+    33f1:	68 dc 62 00 00       	push   $0x62dc
+    33f6:	6a 01                	push   $0x1
+    33f8:	e8 94 17 00 00       	call   4b91 <printf>
+    33fd:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3400:	e8 d0 15 00 00       	call   49d5 <exit>
+  }
+  if(unlink("dots") != 0){
+    3405:	83 ec 0c             	sub    $0xc,%esp
+    3408:	68 6e 62 00 00       	push   $0x626e
+    340d:	e8 13 16 00 00       	call   4a25 <unlink>
+    3412:	83 c4 10             	add    $0x10,%esp
+    3415:	85 c0                	test   %eax,%eax
+    3417:	74 17                	je     3430 <rmdot+0x170>
+    printf(1, "unlink dots failed!\n");
+    3419:	83 ec 08             	sub    $0x8,%esp
+    341c:	68 f4 62 00 00       	push   $0x62f4
+    3421:	6a 01                	push   $0x1
+    3423:	e8 69 17 00 00       	call   4b91 <printf>
+    3428:	83 c4 10             	add    $0x10,%esp
+    exit();
+    342b:	e8 a5 15 00 00       	call   49d5 <exit>
+  }
+  printf(1, "rmdot ok\n");
+    3430:	83 ec 08             	sub    $0x8,%esp
+    3433:	68 09 63 00 00       	push   $0x6309
+    3438:	6a 01                	push   $0x1
+    343a:	e8 52 17 00 00       	call   4b91 <printf>
+    343f:	83 c4 10             	add    $0x10,%esp
+}
+    3442:	90                   	nop
+    3443:	c9                   	leave
+    3444:	c3                   	ret
+
+00003445 <dirfile>:
+
+void
+dirfile(void)
+{
+    3445:	55                   	push   %ebp
+    3446:	89 e5                	mov    %esp,%ebp
+    3448:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  printf(1, "dir vs file\n");
+    344b:	83 ec 08             	sub    $0x8,%esp
+    344e:	68 13 63 00 00       	push   $0x6313
+    3453:	6a 01                	push   $0x1
+    3455:	e8 37 17 00 00       	call   4b91 <printf>
+    345a:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("dirfile", O_CREATE);
+    345d:	83 ec 08             	sub    $0x8,%esp
+    3460:	68 00 02 00 00       	push   $0x200
+    3465:	68 20 63 00 00       	push   $0x6320
+    346a:	e8 a6 15 00 00       	call   4a15 <open>
+    346f:	83 c4 10             	add    $0x10,%esp
+    3472:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    3475:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    3479:	79 17                	jns    3492 <dirfile+0x4d>
+    printf(1, "create dirfile failed\n");
+    347b:	83 ec 08             	sub    $0x8,%esp
+    347e:	68 28 63 00 00       	push   $0x6328
+    3483:	6a 01                	push   $0x1
+    3485:	e8 07 17 00 00       	call   4b91 <printf>
+    348a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    348d:	e8 43 15 00 00       	call   49d5 <exit>
+  }
+  close(fd);
+    3492:	83 ec 0c             	sub    $0xc,%esp
+    3495:	ff 75 f4             	push   -0xc(%ebp)
+    3498:	e8 60 15 00 00       	call   49fd <close>
+    349d:	83 c4 10             	add    $0x10,%esp
+  if(chdir("dirfile") == 0){
+    34a0:	83 ec 0c             	sub    $0xc,%esp
+    34a3:	68 20 63 00 00       	push   $0x6320
+    34a8:	e8 98 15 00 00       	call   4a45 <chdir>
+    34ad:	83 c4 10             	add    $0x10,%esp
+    34b0:	85 c0                	test   %eax,%eax
+    34b2:	75 17                	jne    34cb <dirfile+0x86>
+    printf(1, "chdir dirfile succeeded!\n");
+    34b4:	83 ec 08             	sub    $0x8,%esp
+    34b7:	68 3f 63 00 00       	push   $0x633f
+    34bc:	6a 01                	push   $0x1
+    34be:	e8 ce 16 00 00       	call   4b91 <printf>
+    34c3:	83 c4 10             	add    $0x10,%esp
+    exit();
+    34c6:	e8 0a 15 00 00       	call   49d5 <exit>
+  }
+  fd = open("dirfile/xx", 0);
+    34cb:	83 ec 08             	sub    $0x8,%esp
+    34ce:	6a 00                	push   $0x0
+    34d0:	68 59 63 00 00       	push   $0x6359
+    34d5:	e8 3b 15 00 00       	call   4a15 <open>
+    34da:	83 c4 10             	add    $0x10,%esp
+    34dd:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd >= 0){
+    34e0:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    34e4:	78 17                	js     34fd <dirfile+0xb8>
+    printf(1, "create dirfile/xx succeeded!\n");
+    34e6:	83 ec 08             	sub    $0x8,%esp
+    34e9:	68 64 63 00 00       	push   $0x6364
+    34ee:	6a 01                	push   $0x1
+    34f0:	e8 9c 16 00 00       	call   4b91 <printf>
+    34f5:	83 c4 10             	add    $0x10,%esp
+    exit();
+    34f8:	e8 d8 14 00 00       	call   49d5 <exit>
+  }
+  fd = open("dirfile/xx", O_CREATE);
+    34fd:	83 ec 08             	sub    $0x8,%esp
+    3500:	68 00 02 00 00       	push   $0x200
+    3505:	68 59 63 00 00       	push   $0x6359
+    350a:	e8 06 15 00 00       	call   4a15 <open>
+    350f:	83 c4 10             	add    $0x10,%esp
+    3512:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd >= 0){
+    3515:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    3519:	78 17                	js     3532 <dirfile+0xed>
+    printf(1, "create dirfile/xx succeeded!\n");
+    351b:	83 ec 08             	sub    $0x8,%esp
+    351e:	68 64 63 00 00       	push   $0x6364
+    3523:	6a 01                	push   $0x1
+    3525:	e8 67 16 00 00       	call   4b91 <printf>
+    352a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    352d:	e8 a3 14 00 00       	call   49d5 <exit>
+  }
+  if(mkdir("dirfile/xx") == 0){
+    3532:	83 ec 0c             	sub    $0xc,%esp
+    3535:	68 59 63 00 00       	push   $0x6359
+    353a:	e8 fe 14 00 00       	call   4a3d <mkdir>
+    353f:	83 c4 10             	add    $0x10,%esp
+    3542:	85 c0                	test   %eax,%eax
+    3544:	75 17                	jne    355d <dirfile+0x118>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    3546:	83 ec 08             	sub    $0x8,%esp
+    3549:	68 82 63 00 00       	push   $0x6382
+    354e:	6a 01                	push   $0x1
+    3550:	e8 3c 16 00 00       	call   4b91 <printf>
+    3555:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3558:	e8 78 14 00 00       	call   49d5 <exit>
+  }
+  if(unlink("dirfile/xx") == 0){
+    355d:	83 ec 0c             	sub    $0xc,%esp
+    3560:	68 59 63 00 00       	push   $0x6359
+    3565:	e8 bb 14 00 00       	call   4a25 <unlink>
+    356a:	83 c4 10             	add    $0x10,%esp
+    356d:	85 c0                	test   %eax,%eax
+    356f:	75 17                	jne    3588 <dirfile+0x143>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    3571:	83 ec 08             	sub    $0x8,%esp
+    3574:	68 9f 63 00 00       	push   $0x639f
+    3579:	6a 01                	push   $0x1
+    357b:	e8 11 16 00 00       	call   4b91 <printf>
+    3580:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3583:	e8 4d 14 00 00       	call   49d5 <exit>
+  }
+  if(link("README", "dirfile/xx") == 0){
+    3588:	83 ec 08             	sub    $0x8,%esp
+    358b:	68 59 63 00 00       	push   $0x6359
+    3590:	68 bd 63 00 00       	push   $0x63bd
+    3595:	e8 9b 14 00 00       	call   4a35 <link>
+    359a:	83 c4 10             	add    $0x10,%esp
+    359d:	85 c0                	test   %eax,%eax
+    359f:	75 17                	jne    35b8 <dirfile+0x173>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    35a1:	83 ec 08             	sub    $0x8,%esp
+    35a4:	68 c4 63 00 00       	push   $0x63c4
+    35a9:	6a 01                	push   $0x1
+    35ab:	e8 e1 15 00 00       	call   4b91 <printf>
+    35b0:	83 c4 10             	add    $0x10,%esp
+    exit();
+    35b3:	e8 1d 14 00 00       	call   49d5 <exit>
+  }
+  if(unlink("dirfile") != 0){
+    35b8:	83 ec 0c             	sub    $0xc,%esp
+    35bb:	68 20 63 00 00       	push   $0x6320
+    35c0:	e8 60 14 00 00       	call   4a25 <unlink>
+    35c5:	83 c4 10             	add    $0x10,%esp
+    35c8:	85 c0                	test   %eax,%eax
+    35ca:	74 17                	je     35e3 <dirfile+0x19e>
+    printf(1, "unlink dirfile failed!\n");
+    35cc:	83 ec 08             	sub    $0x8,%esp
+    35cf:	68 e3 63 00 00       	push   $0x63e3
+    35d4:	6a 01                	push   $0x1
+    35d6:	e8 b6 15 00 00       	call   4b91 <printf>
+    35db:	83 c4 10             	add    $0x10,%esp
+    exit();
+    35de:	e8 f2 13 00 00       	call   49d5 <exit>
+  }
+
+  fd = open(".", O_RDWR);
+    35e3:	83 ec 08             	sub    $0x8,%esp
+    35e6:	6a 02                	push   $0x2
+    35e8:	68 cb 58 00 00       	push   $0x58cb
+    35ed:	e8 23 14 00 00       	call   4a15 <open>
+    35f2:	83 c4 10             	add    $0x10,%esp
+    35f5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd >= 0){
+    35f8:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    35fc:	78 17                	js     3615 <dirfile+0x1d0>
+    printf(1, "open . for writing succeeded!\n");
+    35fe:	83 ec 08             	sub    $0x8,%esp
+    3601:	68 fc 63 00 00       	push   $0x63fc
+    3606:	6a 01                	push   $0x1
+    3608:	e8 84 15 00 00       	call   4b91 <printf>
+    360d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3610:	e8 c0 13 00 00       	call   49d5 <exit>
+  }
+  fd = open(".", 0);
+    3615:	83 ec 08             	sub    $0x8,%esp
+    3618:	6a 00                	push   $0x0
+    361a:	68 cb 58 00 00       	push   $0x58cb
+    361f:	e8 f1 13 00 00       	call   4a15 <open>
+    3624:	83 c4 10             	add    $0x10,%esp
+    3627:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(write(fd, "x", 1) > 0){
+    362a:	83 ec 04             	sub    $0x4,%esp
+    362d:	6a 01                	push   $0x1
+    362f:	68 47 54 00 00       	push   $0x5447
+    3634:	ff 75 f4             	push   -0xc(%ebp)
+    3637:	e8 b9 13 00 00       	call   49f5 <write>
+    363c:	83 c4 10             	add    $0x10,%esp
+    363f:	85 c0                	test   %eax,%eax
+    3641:	7e 17                	jle    365a <dirfile+0x215>
+    printf(1, "write . succeeded!\n");
+    3643:	83 ec 08             	sub    $0x8,%esp
+    3646:	68 1b 64 00 00       	push   $0x641b
+    364b:	6a 01                	push   $0x1
+    364d:	e8 3f 15 00 00       	call   4b91 <printf>
+    3652:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3655:	e8 7b 13 00 00       	call   49d5 <exit>
+  }
+  close(fd);
+    365a:	83 ec 0c             	sub    $0xc,%esp
+    365d:	ff 75 f4             	push   -0xc(%ebp)
+    3660:	e8 98 13 00 00       	call   49fd <close>
+    3665:	83 c4 10             	add    $0x10,%esp
+
+  printf(1, "dir vs file OK\n");
+    3668:	83 ec 08             	sub    $0x8,%esp
+    366b:	68 2f 64 00 00       	push   $0x642f
+    3670:	6a 01                	push   $0x1
+    3672:	e8 1a 15 00 00       	call   4b91 <printf>
+    3677:	83 c4 10             	add    $0x10,%esp
+}
+    367a:	90                   	nop
+    367b:	c9                   	leave
+    367c:	c3                   	ret
+
+0000367d <iref>:
+
+// test that iput() is called at the end of _namei()
+void
+iref(void)
+{
+    367d:	55                   	push   %ebp
+    367e:	89 e5                	mov    %esp,%ebp
+    3680:	83 ec 18             	sub    $0x18,%esp
+  int i, fd;
+
+  printf(1, "empty file name\n");
+    3683:	83 ec 08             	sub    $0x8,%esp
+    3686:	68 3f 64 00 00       	push   $0x643f
+    368b:	6a 01                	push   $0x1
+    368d:	e8 ff 14 00 00       	call   4b91 <printf>
+    3692:	83 c4 10             	add    $0x10,%esp
+
+  // the 50 is NINODE
+  for(i = 0; i < 50 + 1; i++){
+    3695:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    369c:	e9 e7 00 00 00       	jmp    3788 <iref+0x10b>
+    if(mkdir("irefd") != 0){
+    36a1:	83 ec 0c             	sub    $0xc,%esp
+    36a4:	68 50 64 00 00       	push   $0x6450
+    36a9:	e8 8f 13 00 00       	call   4a3d <mkdir>
+    36ae:	83 c4 10             	add    $0x10,%esp
+    36b1:	85 c0                	test   %eax,%eax
+    36b3:	74 17                	je     36cc <iref+0x4f>
+      printf(1, "mkdir irefd failed\n");
+    36b5:	83 ec 08             	sub    $0x8,%esp
+    36b8:	68 56 64 00 00       	push   $0x6456
+    36bd:	6a 01                	push   $0x1
+    36bf:	e8 cd 14 00 00       	call   4b91 <printf>
+    36c4:	83 c4 10             	add    $0x10,%esp
+      exit();
+    36c7:	e8 09 13 00 00       	call   49d5 <exit>
+    }
+    if(chdir("irefd") != 0){
+    36cc:	83 ec 0c             	sub    $0xc,%esp
+    36cf:	68 50 64 00 00       	push   $0x6450
+    36d4:	e8 6c 13 00 00       	call   4a45 <chdir>
+    36d9:	83 c4 10             	add    $0x10,%esp
+    36dc:	85 c0                	test   %eax,%eax
+    36de:	74 17                	je     36f7 <iref+0x7a>
+      printf(1, "chdir irefd failed\n");
+    36e0:	83 ec 08             	sub    $0x8,%esp
+    36e3:	68 6a 64 00 00       	push   $0x646a
+    36e8:	6a 01                	push   $0x1
+    36ea:	e8 a2 14 00 00       	call   4b91 <printf>
+    36ef:	83 c4 10             	add    $0x10,%esp
+      exit();
+    36f2:	e8 de 12 00 00       	call   49d5 <exit>
+    }
+
+    mkdir("");
+    36f7:	83 ec 0c             	sub    $0xc,%esp
+    36fa:	68 7e 64 00 00       	push   $0x647e
+    36ff:	e8 39 13 00 00       	call   4a3d <mkdir>
+    3704:	83 c4 10             	add    $0x10,%esp
+    link("README", "");
+    3707:	83 ec 08             	sub    $0x8,%esp
+    370a:	68 7e 64 00 00       	push   $0x647e
+    370f:	68 bd 63 00 00       	push   $0x63bd
+    3714:	e8 1c 13 00 00       	call   4a35 <link>
+    3719:	83 c4 10             	add    $0x10,%esp
+    fd = open("", O_CREATE);
+    371c:	83 ec 08             	sub    $0x8,%esp
+    371f:	68 00 02 00 00       	push   $0x200
+    3724:	68 7e 64 00 00       	push   $0x647e
+    3729:	e8 e7 12 00 00       	call   4a15 <open>
+    372e:	83 c4 10             	add    $0x10,%esp
+    3731:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(fd >= 0)
+    3734:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    3738:	78 0e                	js     3748 <iref+0xcb>
+      close(fd);
+    373a:	83 ec 0c             	sub    $0xc,%esp
+    373d:	ff 75 f0             	push   -0x10(%ebp)
+    3740:	e8 b8 12 00 00       	call   49fd <close>
+    3745:	83 c4 10             	add    $0x10,%esp
+    fd = open("xx", O_CREATE);
+    3748:	83 ec 08             	sub    $0x8,%esp
+    374b:	68 00 02 00 00       	push   $0x200
+    3750:	68 7f 64 00 00       	push   $0x647f
+    3755:	e8 bb 12 00 00       	call   4a15 <open>
+    375a:	83 c4 10             	add    $0x10,%esp
+    375d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(fd >= 0)
+    3760:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    3764:	78 0e                	js     3774 <iref+0xf7>
+      close(fd);
+    3766:	83 ec 0c             	sub    $0xc,%esp
+    3769:	ff 75 f0             	push   -0x10(%ebp)
+    376c:	e8 8c 12 00 00       	call   49fd <close>
+    3771:	83 c4 10             	add    $0x10,%esp
+    unlink("xx");
+    3774:	83 ec 0c             	sub    $0xc,%esp
+    3777:	68 7f 64 00 00       	push   $0x647f
+    377c:	e8 a4 12 00 00       	call   4a25 <unlink>
+    3781:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 50 + 1; i++){
+    3784:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    3788:	83 7d f4 32          	cmpl   $0x32,-0xc(%ebp)
+    378c:	0f 8e 0f ff ff ff    	jle    36a1 <iref+0x24>
+  }
+
+  chdir("/");
+    3792:	83 ec 0c             	sub    $0xc,%esp
+    3795:	68 de 4f 00 00       	push   $0x4fde
+    379a:	e8 a6 12 00 00       	call   4a45 <chdir>
+    379f:	83 c4 10             	add    $0x10,%esp
+  printf(1, "empty file name OK\n");
+    37a2:	83 ec 08             	sub    $0x8,%esp
+    37a5:	68 82 64 00 00       	push   $0x6482
+    37aa:	6a 01                	push   $0x1
+    37ac:	e8 e0 13 00 00       	call   4b91 <printf>
+    37b1:	83 c4 10             	add    $0x10,%esp
+}
+    37b4:	90                   	nop
+    37b5:	c9                   	leave
+    37b6:	c3                   	ret
+
+000037b7 <forktest>:
+// test that fork fails gracefully
+// the forktest binary also does this, but it runs out of proc entries first.
+// inside the bigger usertests binary, we run out of memory first.
+void
+forktest(void)
+{
+    37b7:	55                   	push   %ebp
+    37b8:	89 e5                	mov    %esp,%ebp
+    37ba:	83 ec 18             	sub    $0x18,%esp
+  int n, pid;
+
+  printf(1, "fork test\n");
+    37bd:	83 ec 08             	sub    $0x8,%esp
+    37c0:	68 96 64 00 00       	push   $0x6496
+    37c5:	6a 01                	push   $0x1
+    37c7:	e8 c5 13 00 00       	call   4b91 <printf>
+    37cc:	83 c4 10             	add    $0x10,%esp
+
+  for(n=0; n<1000; n++){
+    37cf:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    37d6:	eb 1d                	jmp    37f5 <forktest+0x3e>
+    pid = fork();
+    37d8:	e8 f0 11 00 00       	call   49cd <fork>
+    37dd:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(pid < 0)
+    37e0:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    37e4:	78 1a                	js     3800 <forktest+0x49>
+      break;
+    if(pid == 0)
+    37e6:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    37ea:	75 05                	jne    37f1 <forktest+0x3a>
+      exit();
+    37ec:	e8 e4 11 00 00       	call   49d5 <exit>
+  for(n=0; n<1000; n++){
+    37f1:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    37f5:	81 7d f4 e7 03 00 00 	cmpl   $0x3e7,-0xc(%ebp)
+    37fc:	7e da                	jle    37d8 <forktest+0x21>
+    37fe:	eb 01                	jmp    3801 <forktest+0x4a>
+      break;
+    3800:	90                   	nop
+  }
+
+  if(n == 1000){
+    3801:	81 7d f4 e8 03 00 00 	cmpl   $0x3e8,-0xc(%ebp)
+    3808:	75 3b                	jne    3845 <forktest+0x8e>
+    printf(1, "fork claimed to work 1000 times!\n");
+    380a:	83 ec 08             	sub    $0x8,%esp
+    380d:	68 a4 64 00 00       	push   $0x64a4
+    3812:	6a 01                	push   $0x1
+    3814:	e8 78 13 00 00       	call   4b91 <printf>
+    3819:	83 c4 10             	add    $0x10,%esp
+    exit();
+    381c:	e8 b4 11 00 00       	call   49d5 <exit>
+  }
+
+  for(; n > 0; n--){
+    if(wait() < 0){
+    3821:	e8 b7 11 00 00       	call   49dd <wait>
+    3826:	85 c0                	test   %eax,%eax
+    3828:	79 17                	jns    3841 <forktest+0x8a>
+      printf(1, "wait stopped early\n");
+    382a:	83 ec 08             	sub    $0x8,%esp
+    382d:	68 c6 64 00 00       	push   $0x64c6
+    3832:	6a 01                	push   $0x1
+    3834:	e8 58 13 00 00       	call   4b91 <printf>
+    3839:	83 c4 10             	add    $0x10,%esp
+      exit();
+    383c:	e8 94 11 00 00       	call   49d5 <exit>
+  for(; n > 0; n--){
+    3841:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+    3845:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    3849:	7f d6                	jg     3821 <forktest+0x6a>
+    }
+  }
+
+  if(wait() != -1){
+    384b:	e8 8d 11 00 00       	call   49dd <wait>
+    3850:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3853:	74 17                	je     386c <forktest+0xb5>
+    printf(1, "wait got too many\n");
+    3855:	83 ec 08             	sub    $0x8,%esp
+    3858:	68 da 64 00 00       	push   $0x64da
+    385d:	6a 01                	push   $0x1
+    385f:	e8 2d 13 00 00       	call   4b91 <printf>
+    3864:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3867:	e8 69 11 00 00       	call   49d5 <exit>
+  }
+
+  printf(1, "fork test OK\n");
+    386c:	83 ec 08             	sub    $0x8,%esp
+    386f:	68 ed 64 00 00       	push   $0x64ed
+    3874:	6a 01                	push   $0x1
+    3876:	e8 16 13 00 00       	call   4b91 <printf>
+    387b:	83 c4 10             	add    $0x10,%esp
+}
+    387e:	90                   	nop
+    387f:	c9                   	leave
+    3880:	c3                   	ret
+
+00003881 <sbrktest>:
+
+void
+sbrktest(void)
+{
+    3881:	55                   	push   %ebp
+    3882:	89 e5                	mov    %esp,%ebp
+    3884:	83 ec 68             	sub    $0x68,%esp
+  int fds[2], pid, pids[10], ppid;
+  char *a, *b, *c, *lastaddr, *oldbrk, *p, scratch;
+  uint amt;
+
+  printf(stdout, "sbrk test\n");
+    3887:	a1 78 71 00 00       	mov    0x7178,%eax
+    388c:	83 ec 08             	sub    $0x8,%esp
+    388f:	68 fb 64 00 00       	push   $0x64fb
+    3894:	50                   	push   %eax
+    3895:	e8 f7 12 00 00       	call   4b91 <printf>
+    389a:	83 c4 10             	add    $0x10,%esp
+  oldbrk = sbrk(0);
+    389d:	83 ec 0c             	sub    $0xc,%esp
+    38a0:	6a 00                	push   $0x0
+    38a2:	e8 b6 11 00 00       	call   4a5d <sbrk>
+    38a7:	83 c4 10             	add    $0x10,%esp
+    38aa:	89 45 ec             	mov    %eax,-0x14(%ebp)
+
+  // can one sbrk() less than a page?
+  a = sbrk(0);
+    38ad:	83 ec 0c             	sub    $0xc,%esp
+    38b0:	6a 00                	push   $0x0
+    38b2:	e8 a6 11 00 00       	call   4a5d <sbrk>
+    38b7:	83 c4 10             	add    $0x10,%esp
+    38ba:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  int i;
+  for(i = 0; i < 5000; i++){
+    38bd:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    38c4:	eb 4f                	jmp    3915 <sbrktest+0x94>
+    b = sbrk(1);
+    38c6:	83 ec 0c             	sub    $0xc,%esp
+    38c9:	6a 01                	push   $0x1
+    38cb:	e8 8d 11 00 00       	call   4a5d <sbrk>
+    38d0:	83 c4 10             	add    $0x10,%esp
+    38d3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    if(b != a){
+    38d6:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    38d9:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    38dc:	74 24                	je     3902 <sbrktest+0x81>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    38de:	a1 78 71 00 00       	mov    0x7178,%eax
+    38e3:	83 ec 0c             	sub    $0xc,%esp
+    38e6:	ff 75 d0             	push   -0x30(%ebp)
+    38e9:	ff 75 f4             	push   -0xc(%ebp)
+    38ec:	ff 75 f0             	push   -0x10(%ebp)
+    38ef:	68 06 65 00 00       	push   $0x6506
+    38f4:	50                   	push   %eax
+    38f5:	e8 97 12 00 00       	call   4b91 <printf>
+    38fa:	83 c4 20             	add    $0x20,%esp
+      exit();
+    38fd:	e8 d3 10 00 00       	call   49d5 <exit>
+    }
+    *b = 1;
+    3902:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    3905:	c6 00 01             	movb   $0x1,(%eax)
+    a = b + 1;
+    3908:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    390b:	83 c0 01             	add    $0x1,%eax
+    390e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  for(i = 0; i < 5000; i++){
+    3911:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    3915:	81 7d f0 87 13 00 00 	cmpl   $0x1387,-0x10(%ebp)
+    391c:	7e a8                	jle    38c6 <sbrktest+0x45>
+  }
+  pid = fork();
+    391e:	e8 aa 10 00 00       	call   49cd <fork>
+    3923:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(pid < 0){
+    3926:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    392a:	79 1b                	jns    3947 <sbrktest+0xc6>
+    printf(stdout, "sbrk test fork failed\n");
+    392c:	a1 78 71 00 00       	mov    0x7178,%eax
+    3931:	83 ec 08             	sub    $0x8,%esp
+    3934:	68 21 65 00 00       	push   $0x6521
+    3939:	50                   	push   %eax
+    393a:	e8 52 12 00 00       	call   4b91 <printf>
+    393f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3942:	e8 8e 10 00 00       	call   49d5 <exit>
+  }
+  c = sbrk(1);
+    3947:	83 ec 0c             	sub    $0xc,%esp
+    394a:	6a 01                	push   $0x1
+    394c:	e8 0c 11 00 00       	call   4a5d <sbrk>
+    3951:	83 c4 10             	add    $0x10,%esp
+    3954:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  c = sbrk(1);
+    3957:	83 ec 0c             	sub    $0xc,%esp
+    395a:	6a 01                	push   $0x1
+    395c:	e8 fc 10 00 00       	call   4a5d <sbrk>
+    3961:	83 c4 10             	add    $0x10,%esp
+    3964:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c != a + 1){
+    3967:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    396a:	83 c0 01             	add    $0x1,%eax
+    396d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    3970:	74 1b                	je     398d <sbrktest+0x10c>
+    printf(stdout, "sbrk test failed post-fork\n");
+    3972:	a1 78 71 00 00       	mov    0x7178,%eax
+    3977:	83 ec 08             	sub    $0x8,%esp
+    397a:	68 38 65 00 00       	push   $0x6538
+    397f:	50                   	push   %eax
+    3980:	e8 0c 12 00 00       	call   4b91 <printf>
+    3985:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3988:	e8 48 10 00 00       	call   49d5 <exit>
+  }
+  if(pid == 0)
+    398d:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    3991:	75 05                	jne    3998 <sbrktest+0x117>
+    exit();
+    3993:	e8 3d 10 00 00       	call   49d5 <exit>
+  wait();
+    3998:	e8 40 10 00 00       	call   49dd <wait>
+
+  // can one grow address space to something big?
+#define BIG (100*1024*1024)
+  a = sbrk(0);
+    399d:	83 ec 0c             	sub    $0xc,%esp
+    39a0:	6a 00                	push   $0x0
+    39a2:	e8 b6 10 00 00       	call   4a5d <sbrk>
+    39a7:	83 c4 10             	add    $0x10,%esp
+    39aa:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  amt = (BIG) - (uint)a;
+    39ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    39b0:	ba 00 00 40 06       	mov    $0x6400000,%edx
+    39b5:	29 c2                	sub    %eax,%edx
+    39b7:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  p = sbrk(amt);
+    39ba:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    39bd:	83 ec 0c             	sub    $0xc,%esp
+    39c0:	50                   	push   %eax
+    39c1:	e8 97 10 00 00       	call   4a5d <sbrk>
+    39c6:	83 c4 10             	add    $0x10,%esp
+    39c9:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  if (p != a) {
+    39cc:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    39cf:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    39d2:	74 1b                	je     39ef <sbrktest+0x16e>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    39d4:	a1 78 71 00 00       	mov    0x7178,%eax
+    39d9:	83 ec 08             	sub    $0x8,%esp
+    39dc:	68 54 65 00 00       	push   $0x6554
+    39e1:	50                   	push   %eax
+    39e2:	e8 aa 11 00 00       	call   4b91 <printf>
+    39e7:	83 c4 10             	add    $0x10,%esp
+    exit();
+    39ea:	e8 e6 0f 00 00       	call   49d5 <exit>
+  }
+  lastaddr = (char*) (BIG-1);
+    39ef:	c7 45 d8 ff ff 3f 06 	movl   $0x63fffff,-0x28(%ebp)
+  *lastaddr = 99;
+    39f6:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    39f9:	c6 00 63             	movb   $0x63,(%eax)
+
+  // can one de-allocate?
+  a = sbrk(0);
+    39fc:	83 ec 0c             	sub    $0xc,%esp
+    39ff:	6a 00                	push   $0x0
+    3a01:	e8 57 10 00 00       	call   4a5d <sbrk>
+    3a06:	83 c4 10             	add    $0x10,%esp
+    3a09:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  c = sbrk(-4096);
+    3a0c:	83 ec 0c             	sub    $0xc,%esp
+    3a0f:	68 00 f0 ff ff       	push   $0xfffff000
+    3a14:	e8 44 10 00 00       	call   4a5d <sbrk>
+    3a19:	83 c4 10             	add    $0x10,%esp
+    3a1c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c == (char*)0xffffffff){
+    3a1f:	83 7d e4 ff          	cmpl   $0xffffffff,-0x1c(%ebp)
+    3a23:	75 1b                	jne    3a40 <sbrktest+0x1bf>
+    printf(stdout, "sbrk could not deallocate\n");
+    3a25:	a1 78 71 00 00       	mov    0x7178,%eax
+    3a2a:	83 ec 08             	sub    $0x8,%esp
+    3a2d:	68 92 65 00 00       	push   $0x6592
+    3a32:	50                   	push   %eax
+    3a33:	e8 59 11 00 00       	call   4b91 <printf>
+    3a38:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3a3b:	e8 95 0f 00 00       	call   49d5 <exit>
+  }
+  c = sbrk(0);
+    3a40:	83 ec 0c             	sub    $0xc,%esp
+    3a43:	6a 00                	push   $0x0
+    3a45:	e8 13 10 00 00       	call   4a5d <sbrk>
+    3a4a:	83 c4 10             	add    $0x10,%esp
+    3a4d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c != a - 4096){
+    3a50:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3a53:	2d 00 10 00 00       	sub    $0x1000,%eax
+    3a58:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    3a5b:	74 1e                	je     3a7b <sbrktest+0x1fa>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    3a5d:	a1 78 71 00 00       	mov    0x7178,%eax
+    3a62:	ff 75 e4             	push   -0x1c(%ebp)
+    3a65:	ff 75 f4             	push   -0xc(%ebp)
+    3a68:	68 b0 65 00 00       	push   $0x65b0
+    3a6d:	50                   	push   %eax
+    3a6e:	e8 1e 11 00 00       	call   4b91 <printf>
+    3a73:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3a76:	e8 5a 0f 00 00       	call   49d5 <exit>
+  }
+
+  // can one re-allocate that page?
+  a = sbrk(0);
+    3a7b:	83 ec 0c             	sub    $0xc,%esp
+    3a7e:	6a 00                	push   $0x0
+    3a80:	e8 d8 0f 00 00       	call   4a5d <sbrk>
+    3a85:	83 c4 10             	add    $0x10,%esp
+    3a88:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  c = sbrk(4096);
+    3a8b:	83 ec 0c             	sub    $0xc,%esp
+    3a8e:	68 00 10 00 00       	push   $0x1000
+    3a93:	e8 c5 0f 00 00       	call   4a5d <sbrk>
+    3a98:	83 c4 10             	add    $0x10,%esp
+    3a9b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c != a || sbrk(0) != a + 4096){
+    3a9e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    3aa1:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    3aa4:	75 1a                	jne    3ac0 <sbrktest+0x23f>
+    3aa6:	83 ec 0c             	sub    $0xc,%esp
+    3aa9:	6a 00                	push   $0x0
+    3aab:	e8 ad 0f 00 00       	call   4a5d <sbrk>
+    3ab0:	83 c4 10             	add    $0x10,%esp
+    3ab3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    3ab6:	81 c2 00 10 00 00    	add    $0x1000,%edx
+    3abc:	39 d0                	cmp    %edx,%eax
+    3abe:	74 1e                	je     3ade <sbrktest+0x25d>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    3ac0:	a1 78 71 00 00       	mov    0x7178,%eax
+    3ac5:	ff 75 e4             	push   -0x1c(%ebp)
+    3ac8:	ff 75 f4             	push   -0xc(%ebp)
+    3acb:	68 e8 65 00 00       	push   $0x65e8
+    3ad0:	50                   	push   %eax
+    3ad1:	e8 bb 10 00 00       	call   4b91 <printf>
+    3ad6:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3ad9:	e8 f7 0e 00 00       	call   49d5 <exit>
+  }
+  if(*lastaddr == 99){
+    3ade:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    3ae1:	0f b6 00             	movzbl (%eax),%eax
+    3ae4:	3c 63                	cmp    $0x63,%al
+    3ae6:	75 1b                	jne    3b03 <sbrktest+0x282>
+    // should be zero
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    3ae8:	a1 78 71 00 00       	mov    0x7178,%eax
+    3aed:	83 ec 08             	sub    $0x8,%esp
+    3af0:	68 10 66 00 00       	push   $0x6610
+    3af5:	50                   	push   %eax
+    3af6:	e8 96 10 00 00       	call   4b91 <printf>
+    3afb:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3afe:	e8 d2 0e 00 00       	call   49d5 <exit>
+  }
+
+  a = sbrk(0);
+    3b03:	83 ec 0c             	sub    $0xc,%esp
+    3b06:	6a 00                	push   $0x0
+    3b08:	e8 50 0f 00 00       	call   4a5d <sbrk>
+    3b0d:	83 c4 10             	add    $0x10,%esp
+    3b10:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  c = sbrk(-(sbrk(0) - oldbrk));
+    3b13:	83 ec 0c             	sub    $0xc,%esp
+    3b16:	6a 00                	push   $0x0
+    3b18:	e8 40 0f 00 00       	call   4a5d <sbrk>
+    3b1d:	83 c4 10             	add    $0x10,%esp
+    3b20:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    3b23:	29 c2                	sub    %eax,%edx
+    3b25:	83 ec 0c             	sub    $0xc,%esp
+    3b28:	52                   	push   %edx
+    3b29:	e8 2f 0f 00 00       	call   4a5d <sbrk>
+    3b2e:	83 c4 10             	add    $0x10,%esp
+    3b31:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c != a){
+    3b34:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    3b37:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    3b3a:	74 1e                	je     3b5a <sbrktest+0x2d9>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    3b3c:	a1 78 71 00 00       	mov    0x7178,%eax
+    3b41:	ff 75 e4             	push   -0x1c(%ebp)
+    3b44:	ff 75 f4             	push   -0xc(%ebp)
+    3b47:	68 40 66 00 00       	push   $0x6640
+    3b4c:	50                   	push   %eax
+    3b4d:	e8 3f 10 00 00       	call   4b91 <printf>
+    3b52:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3b55:	e8 7b 0e 00 00       	call   49d5 <exit>
+  }
+
+  // can we read the kernel's memory?
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    3b5a:	c7 45 f4 00 00 00 80 	movl   $0x80000000,-0xc(%ebp)
+    3b61:	eb 76                	jmp    3bd9 <sbrktest+0x358>
+    ppid = getpid();
+    3b63:	e8 ed 0e 00 00       	call   4a55 <getpid>
+    3b68:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    pid = fork();
+    3b6b:	e8 5d 0e 00 00       	call   49cd <fork>
+    3b70:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(pid < 0){
+    3b73:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    3b77:	79 1b                	jns    3b94 <sbrktest+0x313>
+      printf(stdout, "fork failed\n");
+    3b79:	a1 78 71 00 00       	mov    0x7178,%eax
+    3b7e:	83 ec 08             	sub    $0x8,%esp
+    3b81:	68 0d 50 00 00       	push   $0x500d
+    3b86:	50                   	push   %eax
+    3b87:	e8 05 10 00 00       	call   4b91 <printf>
+    3b8c:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3b8f:	e8 41 0e 00 00       	call   49d5 <exit>
+    }
+    if(pid == 0){
+    3b94:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    3b98:	75 33                	jne    3bcd <sbrktest+0x34c>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    3b9a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3b9d:	0f b6 00             	movzbl (%eax),%eax
+    3ba0:	0f be d0             	movsbl %al,%edx
+    3ba3:	a1 78 71 00 00       	mov    0x7178,%eax
+    3ba8:	52                   	push   %edx
+    3ba9:	ff 75 f4             	push   -0xc(%ebp)
+    3bac:	68 61 66 00 00       	push   $0x6661
+    3bb1:	50                   	push   %eax
+    3bb2:	e8 da 0f 00 00       	call   4b91 <printf>
+    3bb7:	83 c4 10             	add    $0x10,%esp
+      kill(ppid);
+    3bba:	83 ec 0c             	sub    $0xc,%esp
+    3bbd:	ff 75 d4             	push   -0x2c(%ebp)
+    3bc0:	e8 40 0e 00 00       	call   4a05 <kill>
+    3bc5:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3bc8:	e8 08 0e 00 00       	call   49d5 <exit>
+    }
+    wait();
+    3bcd:	e8 0b 0e 00 00       	call   49dd <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    3bd2:	81 45 f4 50 c3 00 00 	addl   $0xc350,-0xc(%ebp)
+    3bd9:	81 7d f4 7f 84 1e 80 	cmpl   $0x801e847f,-0xc(%ebp)
+    3be0:	76 81                	jbe    3b63 <sbrktest+0x2e2>
+  }
+
+  // if we run the system out of memory, does it clean up the last
+  // failed allocation?
+  if(pipe(fds) != 0){
+    3be2:	83 ec 0c             	sub    $0xc,%esp
+    3be5:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    3be8:	50                   	push   %eax
+    3be9:	e8 f7 0d 00 00       	call   49e5 <pipe>
+    3bee:	83 c4 10             	add    $0x10,%esp
+    3bf1:	85 c0                	test   %eax,%eax
+    3bf3:	74 17                	je     3c0c <sbrktest+0x38b>
+    printf(1, "pipe() failed\n");
+    3bf5:	83 ec 08             	sub    $0x8,%esp
+    3bf8:	68 e2 53 00 00       	push   $0x53e2
+    3bfd:	6a 01                	push   $0x1
+    3bff:	e8 8d 0f 00 00       	call   4b91 <printf>
+    3c04:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3c07:	e8 c9 0d 00 00       	call   49d5 <exit>
+  }
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3c0c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    3c13:	e9 86 00 00 00       	jmp    3c9e <sbrktest+0x41d>
+    if((pids[i] = fork()) == 0){
+    3c18:	e8 b0 0d 00 00       	call   49cd <fork>
+    3c1d:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    3c20:	89 44 95 a0          	mov    %eax,-0x60(%ebp,%edx,4)
+    3c24:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    3c27:	8b 44 85 a0          	mov    -0x60(%ebp,%eax,4),%eax
+    3c2b:	85 c0                	test   %eax,%eax
+    3c2d:	75 4a                	jne    3c79 <sbrktest+0x3f8>
+      // allocate a lot of memory
+      sbrk(BIG - (uint)sbrk(0));
+    3c2f:	83 ec 0c             	sub    $0xc,%esp
+    3c32:	6a 00                	push   $0x0
+    3c34:	e8 24 0e 00 00       	call   4a5d <sbrk>
+    3c39:	83 c4 10             	add    $0x10,%esp
+    3c3c:	89 c2                	mov    %eax,%edx
+    3c3e:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    3c43:	29 d0                	sub    %edx,%eax
+    3c45:	83 ec 0c             	sub    $0xc,%esp
+    3c48:	50                   	push   %eax
+    3c49:	e8 0f 0e 00 00       	call   4a5d <sbrk>
+    3c4e:	83 c4 10             	add    $0x10,%esp
+      write(fds[1], "x", 1);
+    3c51:	8b 45 cc             	mov    -0x34(%ebp),%eax
+    3c54:	83 ec 04             	sub    $0x4,%esp
+    3c57:	6a 01                	push   $0x1
+    3c59:	68 47 54 00 00       	push   $0x5447
+    3c5e:	50                   	push   %eax
+    3c5f:	e8 91 0d 00 00       	call   49f5 <write>
+    3c64:	83 c4 10             	add    $0x10,%esp
+      // sit around until killed
+      for(;;) sleep(1000);
+    3c67:	83 ec 0c             	sub    $0xc,%esp
+    3c6a:	68 e8 03 00 00       	push   $0x3e8
+    3c6f:	e8 f1 0d 00 00       	call   4a65 <sleep>
+    3c74:	83 c4 10             	add    $0x10,%esp
+    3c77:	eb ee                	jmp    3c67 <sbrktest+0x3e6>
+    }
+    if(pids[i] != -1)
+    3c79:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    3c7c:	8b 44 85 a0          	mov    -0x60(%ebp,%eax,4),%eax
+    3c80:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3c83:	74 15                	je     3c9a <sbrktest+0x419>
+      read(fds[0], &scratch, 1);
+    3c85:	8b 45 c8             	mov    -0x38(%ebp),%eax
+    3c88:	83 ec 04             	sub    $0x4,%esp
+    3c8b:	6a 01                	push   $0x1
+    3c8d:	8d 55 9f             	lea    -0x61(%ebp),%edx
+    3c90:	52                   	push   %edx
+    3c91:	50                   	push   %eax
+    3c92:	e8 56 0d 00 00       	call   49ed <read>
+    3c97:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3c9a:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    3c9e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    3ca1:	83 f8 09             	cmp    $0x9,%eax
+    3ca4:	0f 86 6e ff ff ff    	jbe    3c18 <sbrktest+0x397>
+  }
+  // if those failed allocations freed up the pages they did allocate,
+  // we'll be able to allocate here
+  c = sbrk(4096);
+    3caa:	83 ec 0c             	sub    $0xc,%esp
+    3cad:	68 00 10 00 00       	push   $0x1000
+    3cb2:	e8 a6 0d 00 00       	call   4a5d <sbrk>
+    3cb7:	83 c4 10             	add    $0x10,%esp
+    3cba:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3cbd:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    3cc4:	eb 2b                	jmp    3cf1 <sbrktest+0x470>
+    if(pids[i] == -1)
+    3cc6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    3cc9:	8b 44 85 a0          	mov    -0x60(%ebp,%eax,4),%eax
+    3ccd:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3cd0:	74 1a                	je     3cec <sbrktest+0x46b>
+      continue;
+    kill(pids[i]);
+    3cd2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    3cd5:	8b 44 85 a0          	mov    -0x60(%ebp,%eax,4),%eax
+    3cd9:	83 ec 0c             	sub    $0xc,%esp
+    3cdc:	50                   	push   %eax
+    3cdd:	e8 23 0d 00 00       	call   4a05 <kill>
+    3ce2:	83 c4 10             	add    $0x10,%esp
+    wait();
+    3ce5:	e8 f3 0c 00 00       	call   49dd <wait>
+    3cea:	eb 01                	jmp    3ced <sbrktest+0x46c>
+      continue;
+    3cec:	90                   	nop
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3ced:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    3cf1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    3cf4:	83 f8 09             	cmp    $0x9,%eax
+    3cf7:	76 cd                	jbe    3cc6 <sbrktest+0x445>
+  }
+  if(c == (char*)0xffffffff){
+    3cf9:	83 7d e4 ff          	cmpl   $0xffffffff,-0x1c(%ebp)
+    3cfd:	75 1b                	jne    3d1a <sbrktest+0x499>
+    printf(stdout, "failed sbrk leaked memory\n");
+    3cff:	a1 78 71 00 00       	mov    0x7178,%eax
+    3d04:	83 ec 08             	sub    $0x8,%esp
+    3d07:	68 7a 66 00 00       	push   $0x667a
+    3d0c:	50                   	push   %eax
+    3d0d:	e8 7f 0e 00 00       	call   4b91 <printf>
+    3d12:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3d15:	e8 bb 0c 00 00       	call   49d5 <exit>
+  }
+
+  if(sbrk(0) > oldbrk)
+    3d1a:	83 ec 0c             	sub    $0xc,%esp
+    3d1d:	6a 00                	push   $0x0
+    3d1f:	e8 39 0d 00 00       	call   4a5d <sbrk>
+    3d24:	83 c4 10             	add    $0x10,%esp
+    3d27:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    3d2a:	73 1e                	jae    3d4a <sbrktest+0x4c9>
+    sbrk(-(sbrk(0) - oldbrk));
+    3d2c:	83 ec 0c             	sub    $0xc,%esp
+    3d2f:	6a 00                	push   $0x0
+    3d31:	e8 27 0d 00 00       	call   4a5d <sbrk>
+    3d36:	83 c4 10             	add    $0x10,%esp
+    3d39:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    3d3c:	29 c2                	sub    %eax,%edx
+    3d3e:	83 ec 0c             	sub    $0xc,%esp
+    3d41:	52                   	push   %edx
+    3d42:	e8 16 0d 00 00       	call   4a5d <sbrk>
+    3d47:	83 c4 10             	add    $0x10,%esp
+
+  printf(stdout, "sbrk test OK\n");
+    3d4a:	a1 78 71 00 00       	mov    0x7178,%eax
+    3d4f:	83 ec 08             	sub    $0x8,%esp
+    3d52:	68 95 66 00 00       	push   $0x6695
+    3d57:	50                   	push   %eax
+    3d58:	e8 34 0e 00 00       	call   4b91 <printf>
+    3d5d:	83 c4 10             	add    $0x10,%esp
+}
+    3d60:	90                   	nop
+    3d61:	c9                   	leave
+    3d62:	c3                   	ret
+
+00003d63 <validateint>:
+
+void
+validateint(int *p)
+{
+    3d63:	55                   	push   %ebp
+    3d64:	89 e5                	mov    %esp,%ebp
+    3d66:	53                   	push   %ebx
+    3d67:	83 ec 10             	sub    $0x10,%esp
+  int res;
+  asm("mov %%esp, %%ebx\n\t"
+    3d6a:	b8 0d 00 00 00       	mov    $0xd,%eax
+    3d6f:	8b 55 08             	mov    0x8(%ebp),%edx
+    3d72:	89 d1                	mov    %edx,%ecx
+    3d74:	89 e3                	mov    %esp,%ebx
+    3d76:	89 cc                	mov    %ecx,%esp
+    3d78:	cd 40                	int    $0x40
+    3d7a:	89 dc                	mov    %ebx,%esp
+    3d7c:	89 45 f8             	mov    %eax,-0x8(%ebp)
+      "int %2\n\t"
+      "mov %%ebx, %%esp" :
+      "=a" (res) :
+      "a" (SYS_sleep), "n" (T_SYSCALL), "c" (p) :
+      "ebx");
+}
+    3d7f:	90                   	nop
+    3d80:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3d83:	c9                   	leave
+    3d84:	c3                   	ret
+
+00003d85 <validatetest>:
+
+void
+validatetest(void)
+{
+    3d85:	55                   	push   %ebp
+    3d86:	89 e5                	mov    %esp,%ebp
+    3d88:	83 ec 18             	sub    $0x18,%esp
+  int hi, pid;
+  uint p;
+
+  printf(stdout, "validate test\n");
+    3d8b:	a1 78 71 00 00       	mov    0x7178,%eax
+    3d90:	83 ec 08             	sub    $0x8,%esp
+    3d93:	68 a3 66 00 00       	push   $0x66a3
+    3d98:	50                   	push   %eax
+    3d99:	e8 f3 0d 00 00       	call   4b91 <printf>
+    3d9e:	83 c4 10             	add    $0x10,%esp
+  hi = 1100*1024;
+    3da1:	c7 45 f0 00 30 11 00 	movl   $0x113000,-0x10(%ebp)
+
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3da8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    3daf:	e9 8a 00 00 00       	jmp    3e3e <validatetest+0xb9>
+    if((pid = fork()) == 0){
+    3db4:	e8 14 0c 00 00       	call   49cd <fork>
+    3db9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    3dbc:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    3dc0:	75 14                	jne    3dd6 <validatetest+0x51>
+      // try to crash the kernel by passing in a badly placed integer
+      validateint((int*)p);
+    3dc2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3dc5:	83 ec 0c             	sub    $0xc,%esp
+    3dc8:	50                   	push   %eax
+    3dc9:	e8 95 ff ff ff       	call   3d63 <validateint>
+    3dce:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3dd1:	e8 ff 0b 00 00       	call   49d5 <exit>
+    }
+    sleep(0);
+    3dd6:	83 ec 0c             	sub    $0xc,%esp
+    3dd9:	6a 00                	push   $0x0
+    3ddb:	e8 85 0c 00 00       	call   4a65 <sleep>
+    3de0:	83 c4 10             	add    $0x10,%esp
+    sleep(0);
+    3de3:	83 ec 0c             	sub    $0xc,%esp
+    3de6:	6a 00                	push   $0x0
+    3de8:	e8 78 0c 00 00       	call   4a65 <sleep>
+    3ded:	83 c4 10             	add    $0x10,%esp
+    kill(pid);
+    3df0:	83 ec 0c             	sub    $0xc,%esp
+    3df3:	ff 75 ec             	push   -0x14(%ebp)
+    3df6:	e8 0a 0c 00 00       	call   4a05 <kill>
+    3dfb:	83 c4 10             	add    $0x10,%esp
+    wait();
+    3dfe:	e8 da 0b 00 00       	call   49dd <wait>
+
+    // try to crash the kernel by passing in a bad string pointer
+    if(link("nosuchfile", (char*)p) != -1){
+    3e03:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3e06:	83 ec 08             	sub    $0x8,%esp
+    3e09:	50                   	push   %eax
+    3e0a:	68 b2 66 00 00       	push   $0x66b2
+    3e0f:	e8 21 0c 00 00       	call   4a35 <link>
+    3e14:	83 c4 10             	add    $0x10,%esp
+    3e17:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3e1a:	74 1b                	je     3e37 <validatetest+0xb2>
+      printf(stdout, "link should not succeed\n");
+    3e1c:	a1 78 71 00 00       	mov    0x7178,%eax
+    3e21:	83 ec 08             	sub    $0x8,%esp
+    3e24:	68 bd 66 00 00       	push   $0x66bd
+    3e29:	50                   	push   %eax
+    3e2a:	e8 62 0d 00 00       	call   4b91 <printf>
+    3e2f:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3e32:	e8 9e 0b 00 00       	call   49d5 <exit>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3e37:	81 45 f4 00 10 00 00 	addl   $0x1000,-0xc(%ebp)
+    3e3e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    3e41:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    3e44:	0f 83 6a ff ff ff    	jae    3db4 <validatetest+0x2f>
+    }
+  }
+
+  printf(stdout, "validate ok\n");
+    3e4a:	a1 78 71 00 00       	mov    0x7178,%eax
+    3e4f:	83 ec 08             	sub    $0x8,%esp
+    3e52:	68 d6 66 00 00       	push   $0x66d6
+    3e57:	50                   	push   %eax
+    3e58:	e8 34 0d 00 00       	call   4b91 <printf>
+    3e5d:	83 c4 10             	add    $0x10,%esp
+}
+    3e60:	90                   	nop
+    3e61:	c9                   	leave
+    3e62:	c3                   	ret
+
+00003e63 <bsstest>:
+
+// does unintialized data start out zero?
+char uninit[10000];
+void
+bsstest(void)
+{
+    3e63:	55                   	push   %ebp
+    3e64:	89 e5                	mov    %esp,%ebp
+    3e66:	83 ec 18             	sub    $0x18,%esp
+  int i;
+
+  printf(stdout, "bss test\n");
+    3e69:	a1 78 71 00 00       	mov    0x7178,%eax
+    3e6e:	83 ec 08             	sub    $0x8,%esp
+    3e71:	68 e3 66 00 00       	push   $0x66e3
+    3e76:	50                   	push   %eax
+    3e77:	e8 15 0d 00 00       	call   4b91 <printf>
+    3e7c:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    3e7f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    3e86:	eb 2e                	jmp    3eb6 <bsstest+0x53>
+    if(uninit[i] != '\0'){
+    3e88:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3e8b:	05 40 76 00 00       	add    $0x7640,%eax
+    3e90:	0f b6 00             	movzbl (%eax),%eax
+    3e93:	84 c0                	test   %al,%al
+    3e95:	74 1b                	je     3eb2 <bsstest+0x4f>
+      printf(stdout, "bss test failed\n");
+    3e97:	a1 78 71 00 00       	mov    0x7178,%eax
+    3e9c:	83 ec 08             	sub    $0x8,%esp
+    3e9f:	68 ed 66 00 00       	push   $0x66ed
+    3ea4:	50                   	push   %eax
+    3ea5:	e8 e7 0c 00 00       	call   4b91 <printf>
+    3eaa:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3ead:	e8 23 0b 00 00       	call   49d5 <exit>
+  for(i = 0; i < sizeof(uninit); i++){
+    3eb2:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    3eb6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3eb9:	3d 0f 27 00 00       	cmp    $0x270f,%eax
+    3ebe:	76 c8                	jbe    3e88 <bsstest+0x25>
+    }
+  }
+  printf(stdout, "bss test ok\n");
+    3ec0:	a1 78 71 00 00       	mov    0x7178,%eax
+    3ec5:	83 ec 08             	sub    $0x8,%esp
+    3ec8:	68 fe 66 00 00       	push   $0x66fe
+    3ecd:	50                   	push   %eax
+    3ece:	e8 be 0c 00 00       	call   4b91 <printf>
+    3ed3:	83 c4 10             	add    $0x10,%esp
+}
+    3ed6:	90                   	nop
+    3ed7:	c9                   	leave
+    3ed8:	c3                   	ret
+
+00003ed9 <bigargtest>:
+// does exec return an error if the arguments
+// are larger than a page? or does it write
+// below the stack and wreck the instructions/data?
+void
+bigargtest(void)
+{
+    3ed9:	55                   	push   %ebp
+    3eda:	89 e5                	mov    %esp,%ebp
+    3edc:	83 ec 18             	sub    $0x18,%esp
+  int pid, fd;
+
+  unlink("bigarg-ok");
+    3edf:	83 ec 0c             	sub    $0xc,%esp
+    3ee2:	68 0b 67 00 00       	push   $0x670b
+    3ee7:	e8 39 0b 00 00       	call   4a25 <unlink>
+    3eec:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    3eef:	e8 d9 0a 00 00       	call   49cd <fork>
+    3ef4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(pid == 0){
+    3ef7:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    3efb:	0f 85 97 00 00 00    	jne    3f98 <bigargtest+0xbf>
+    static char *args[MAXARG];
+    int i;
+    for(i = 0; i < MAXARG-1; i++)
+    3f01:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    3f08:	eb 12                	jmp    3f1c <bigargtest+0x43>
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    3f0a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3f0d:	c7 04 85 a0 71 00 00 	movl   $0x6718,0x71a0(,%eax,4)
+    3f14:	18 67 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    3f18:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    3f1c:	83 7d f4 1e          	cmpl   $0x1e,-0xc(%ebp)
+    3f20:	7e e8                	jle    3f0a <bigargtest+0x31>
+    args[MAXARG-1] = 0;
+    3f22:	c7 05 1c 72 00 00 00 	movl   $0x0,0x721c
+    3f29:	00 00 00 
+    printf(stdout, "bigarg test\n");
+    3f2c:	a1 78 71 00 00       	mov    0x7178,%eax
+    3f31:	83 ec 08             	sub    $0x8,%esp
+    3f34:	68 f5 67 00 00       	push   $0x67f5
+    3f39:	50                   	push   %eax
+    3f3a:	e8 52 0c 00 00       	call   4b91 <printf>
+    3f3f:	83 c4 10             	add    $0x10,%esp
+    exec("echo", args);
+    3f42:	83 ec 08             	sub    $0x8,%esp
+    3f45:	68 a0 71 00 00       	push   $0x71a0
+    3f4a:	68 6c 4f 00 00       	push   $0x4f6c
+    3f4f:	e8 b9 0a 00 00       	call   4a0d <exec>
+    3f54:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "bigarg test ok\n");
+    3f57:	a1 78 71 00 00       	mov    0x7178,%eax
+    3f5c:	83 ec 08             	sub    $0x8,%esp
+    3f5f:	68 02 68 00 00       	push   $0x6802
+    3f64:	50                   	push   %eax
+    3f65:	e8 27 0c 00 00       	call   4b91 <printf>
+    3f6a:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigarg-ok", O_CREATE);
+    3f6d:	83 ec 08             	sub    $0x8,%esp
+    3f70:	68 00 02 00 00       	push   $0x200
+    3f75:	68 0b 67 00 00       	push   $0x670b
+    3f7a:	e8 96 0a 00 00       	call   4a15 <open>
+    3f7f:	83 c4 10             	add    $0x10,%esp
+    3f82:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    close(fd);
+    3f85:	83 ec 0c             	sub    $0xc,%esp
+    3f88:	ff 75 ec             	push   -0x14(%ebp)
+    3f8b:	e8 6d 0a 00 00       	call   49fd <close>
+    3f90:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3f93:	e8 3d 0a 00 00       	call   49d5 <exit>
+  } else if(pid < 0){
+    3f98:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    3f9c:	79 1b                	jns    3fb9 <bigargtest+0xe0>
+    printf(stdout, "bigargtest: fork failed\n");
+    3f9e:	a1 78 71 00 00       	mov    0x7178,%eax
+    3fa3:	83 ec 08             	sub    $0x8,%esp
+    3fa6:	68 12 68 00 00       	push   $0x6812
+    3fab:	50                   	push   %eax
+    3fac:	e8 e0 0b 00 00       	call   4b91 <printf>
+    3fb1:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3fb4:	e8 1c 0a 00 00       	call   49d5 <exit>
+  }
+  wait();
+    3fb9:	e8 1f 0a 00 00       	call   49dd <wait>
+  fd = open("bigarg-ok", 0);
+    3fbe:	83 ec 08             	sub    $0x8,%esp
+    3fc1:	6a 00                	push   $0x0
+    3fc3:	68 0b 67 00 00       	push   $0x670b
+    3fc8:	e8 48 0a 00 00       	call   4a15 <open>
+    3fcd:	83 c4 10             	add    $0x10,%esp
+    3fd0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+    3fd3:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    3fd7:	79 1b                	jns    3ff4 <bigargtest+0x11b>
+    printf(stdout, "bigarg test failed!\n");
+    3fd9:	a1 78 71 00 00       	mov    0x7178,%eax
+    3fde:	83 ec 08             	sub    $0x8,%esp
+    3fe1:	68 2b 68 00 00       	push   $0x682b
+    3fe6:	50                   	push   %eax
+    3fe7:	e8 a5 0b 00 00       	call   4b91 <printf>
+    3fec:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3fef:	e8 e1 09 00 00       	call   49d5 <exit>
+  }
+  close(fd);
+    3ff4:	83 ec 0c             	sub    $0xc,%esp
+    3ff7:	ff 75 ec             	push   -0x14(%ebp)
+    3ffa:	e8 fe 09 00 00       	call   49fd <close>
+    3fff:	83 c4 10             	add    $0x10,%esp
+  unlink("bigarg-ok");
+    4002:	83 ec 0c             	sub    $0xc,%esp
+    4005:	68 0b 67 00 00       	push   $0x670b
+    400a:	e8 16 0a 00 00       	call   4a25 <unlink>
+    400f:	83 c4 10             	add    $0x10,%esp
+}
+    4012:	90                   	nop
+    4013:	c9                   	leave
+    4014:	c3                   	ret
+
+00004015 <fsfull>:
+
+// what happens when the file system runs out of blocks?
+// answer: balloc panics, so this test is not useful.
+void
+fsfull()
+{
+    4015:	55                   	push   %ebp
+    4016:	89 e5                	mov    %esp,%ebp
+    4018:	53                   	push   %ebx
+    4019:	83 ec 64             	sub    $0x64,%esp
+  int nfiles;
+  int fsblocks = 0;
+    401c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+
+  printf(1, "fsfull test\n");
+    4023:	83 ec 08             	sub    $0x8,%esp
+    4026:	68 40 68 00 00       	push   $0x6840
+    402b:	6a 01                	push   $0x1
+    402d:	e8 5f 0b 00 00       	call   4b91 <printf>
+    4032:	83 c4 10             	add    $0x10,%esp
+
+  for(nfiles = 0; ; nfiles++){
+    4035:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    char name[64];
+    name[0] = 'f';
+    403c:	c6 45 a4 66          	movb   $0x66,-0x5c(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4040:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    4043:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    4048:	89 c8                	mov    %ecx,%eax
+    404a:	f7 ea                	imul   %edx
+    404c:	c1 fa 06             	sar    $0x6,%edx
+    404f:	89 c8                	mov    %ecx,%eax
+    4051:	c1 f8 1f             	sar    $0x1f,%eax
+    4054:	29 c2                	sub    %eax,%edx
+    4056:	89 d0                	mov    %edx,%eax
+    4058:	83 c0 30             	add    $0x30,%eax
+    405b:	88 45 a5             	mov    %al,-0x5b(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    405e:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    4061:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    4066:	89 d8                	mov    %ebx,%eax
+    4068:	f7 ea                	imul   %edx
+    406a:	c1 fa 06             	sar    $0x6,%edx
+    406d:	89 d8                	mov    %ebx,%eax
+    406f:	c1 f8 1f             	sar    $0x1f,%eax
+    4072:	89 d1                	mov    %edx,%ecx
+    4074:	29 c1                	sub    %eax,%ecx
+    4076:	69 c1 e8 03 00 00    	imul   $0x3e8,%ecx,%eax
+    407c:	29 c3                	sub    %eax,%ebx
+    407e:	89 d9                	mov    %ebx,%ecx
+    4080:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    4085:	89 c8                	mov    %ecx,%eax
+    4087:	f7 ea                	imul   %edx
+    4089:	c1 fa 05             	sar    $0x5,%edx
+    408c:	89 c8                	mov    %ecx,%eax
+    408e:	c1 f8 1f             	sar    $0x1f,%eax
+    4091:	29 c2                	sub    %eax,%edx
+    4093:	89 d0                	mov    %edx,%eax
+    4095:	83 c0 30             	add    $0x30,%eax
+    4098:	88 45 a6             	mov    %al,-0x5a(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    409b:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    409e:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    40a3:	89 d8                	mov    %ebx,%eax
+    40a5:	f7 ea                	imul   %edx
+    40a7:	c1 fa 05             	sar    $0x5,%edx
+    40aa:	89 d8                	mov    %ebx,%eax
+    40ac:	c1 f8 1f             	sar    $0x1f,%eax
+    40af:	89 d1                	mov    %edx,%ecx
+    40b1:	29 c1                	sub    %eax,%ecx
+    40b3:	6b c1 64             	imul   $0x64,%ecx,%eax
+    40b6:	29 c3                	sub    %eax,%ebx
+    40b8:	89 d9                	mov    %ebx,%ecx
+    40ba:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    40bf:	89 c8                	mov    %ecx,%eax
+    40c1:	f7 ea                	imul   %edx
+    40c3:	c1 fa 02             	sar    $0x2,%edx
+    40c6:	89 c8                	mov    %ecx,%eax
+    40c8:	c1 f8 1f             	sar    $0x1f,%eax
+    40cb:	29 c2                	sub    %eax,%edx
+    40cd:	89 d0                	mov    %edx,%eax
+    40cf:	83 c0 30             	add    $0x30,%eax
+    40d2:	88 45 a7             	mov    %al,-0x59(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    40d5:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    40d8:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    40dd:	89 c8                	mov    %ecx,%eax
+    40df:	f7 ea                	imul   %edx
+    40e1:	c1 fa 02             	sar    $0x2,%edx
+    40e4:	89 c8                	mov    %ecx,%eax
+    40e6:	c1 f8 1f             	sar    $0x1f,%eax
+    40e9:	29 c2                	sub    %eax,%edx
+    40eb:	89 d0                	mov    %edx,%eax
+    40ed:	c1 e0 02             	shl    $0x2,%eax
+    40f0:	01 d0                	add    %edx,%eax
+    40f2:	01 c0                	add    %eax,%eax
+    40f4:	29 c1                	sub    %eax,%ecx
+    40f6:	89 ca                	mov    %ecx,%edx
+    40f8:	89 d0                	mov    %edx,%eax
+    40fa:	83 c0 30             	add    $0x30,%eax
+    40fd:	88 45 a8             	mov    %al,-0x58(%ebp)
+    name[5] = '\0';
+    4100:	c6 45 a9 00          	movb   $0x0,-0x57(%ebp)
+    printf(1, "writing %s\n", name);
+    4104:	83 ec 04             	sub    $0x4,%esp
+    4107:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    410a:	50                   	push   %eax
+    410b:	68 4d 68 00 00       	push   $0x684d
+    4110:	6a 01                	push   $0x1
+    4112:	e8 7a 0a 00 00       	call   4b91 <printf>
+    4117:	83 c4 10             	add    $0x10,%esp
+    int fd = open(name, O_CREATE|O_RDWR);
+    411a:	83 ec 08             	sub    $0x8,%esp
+    411d:	68 02 02 00 00       	push   $0x202
+    4122:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    4125:	50                   	push   %eax
+    4126:	e8 ea 08 00 00       	call   4a15 <open>
+    412b:	83 c4 10             	add    $0x10,%esp
+    412e:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(fd < 0){
+    4131:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    4135:	79 18                	jns    414f <fsfull+0x13a>
+      printf(1, "open %s failed\n", name);
+    4137:	83 ec 04             	sub    $0x4,%esp
+    413a:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    413d:	50                   	push   %eax
+    413e:	68 59 68 00 00       	push   $0x6859
+    4143:	6a 01                	push   $0x1
+    4145:	e8 47 0a 00 00       	call   4b91 <printf>
+    414a:	83 c4 10             	add    $0x10,%esp
+      break;
+    414d:	eb 6b                	jmp    41ba <fsfull+0x1a5>
+    }
+    int total = 0;
+    414f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    while(1){
+      int cc = write(fd, buf, 512);
+    4156:	83 ec 04             	sub    $0x4,%esp
+    4159:	68 00 02 00 00       	push   $0x200
+    415e:	68 60 9d 01 00       	push   $0x19d60
+    4163:	ff 75 e8             	push   -0x18(%ebp)
+    4166:	e8 8a 08 00 00       	call   49f5 <write>
+    416b:	83 c4 10             	add    $0x10,%esp
+    416e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      if(cc < 512)
+    4171:	81 7d e4 ff 01 00 00 	cmpl   $0x1ff,-0x1c(%ebp)
+    4178:	7e 0c                	jle    4186 <fsfull+0x171>
+        break;
+      total += cc;
+    417a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    417d:	01 45 ec             	add    %eax,-0x14(%ebp)
+      fsblocks++;
+    4180:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    while(1){
+    4184:	eb d0                	jmp    4156 <fsfull+0x141>
+        break;
+    4186:	90                   	nop
+    }
+    printf(1, "wrote %d bytes\n", total);
+    4187:	83 ec 04             	sub    $0x4,%esp
+    418a:	ff 75 ec             	push   -0x14(%ebp)
+    418d:	68 69 68 00 00       	push   $0x6869
+    4192:	6a 01                	push   $0x1
+    4194:	e8 f8 09 00 00       	call   4b91 <printf>
+    4199:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+    419c:	83 ec 0c             	sub    $0xc,%esp
+    419f:	ff 75 e8             	push   -0x18(%ebp)
+    41a2:	e8 56 08 00 00       	call   49fd <close>
+    41a7:	83 c4 10             	add    $0x10,%esp
+    if(total == 0)
+    41aa:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    41ae:	74 09                	je     41b9 <fsfull+0x1a4>
+  for(nfiles = 0; ; nfiles++){
+    41b0:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    41b4:	e9 83 fe ff ff       	jmp    403c <fsfull+0x27>
+      break;
+    41b9:	90                   	nop
+  }
+
+  while(nfiles >= 0){
+    41ba:	e9 db 00 00 00       	jmp    429a <fsfull+0x285>
+    char name[64];
+    name[0] = 'f';
+    41bf:	c6 45 a4 66          	movb   $0x66,-0x5c(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    41c3:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    41c6:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    41cb:	89 c8                	mov    %ecx,%eax
+    41cd:	f7 ea                	imul   %edx
+    41cf:	c1 fa 06             	sar    $0x6,%edx
+    41d2:	89 c8                	mov    %ecx,%eax
+    41d4:	c1 f8 1f             	sar    $0x1f,%eax
+    41d7:	29 c2                	sub    %eax,%edx
+    41d9:	89 d0                	mov    %edx,%eax
+    41db:	83 c0 30             	add    $0x30,%eax
+    41de:	88 45 a5             	mov    %al,-0x5b(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    41e1:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    41e4:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    41e9:	89 d8                	mov    %ebx,%eax
+    41eb:	f7 ea                	imul   %edx
+    41ed:	c1 fa 06             	sar    $0x6,%edx
+    41f0:	89 d8                	mov    %ebx,%eax
+    41f2:	c1 f8 1f             	sar    $0x1f,%eax
+    41f5:	89 d1                	mov    %edx,%ecx
+    41f7:	29 c1                	sub    %eax,%ecx
+    41f9:	69 c1 e8 03 00 00    	imul   $0x3e8,%ecx,%eax
+    41ff:	29 c3                	sub    %eax,%ebx
+    4201:	89 d9                	mov    %ebx,%ecx
+    4203:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    4208:	89 c8                	mov    %ecx,%eax
+    420a:	f7 ea                	imul   %edx
+    420c:	c1 fa 05             	sar    $0x5,%edx
+    420f:	89 c8                	mov    %ecx,%eax
+    4211:	c1 f8 1f             	sar    $0x1f,%eax
+    4214:	29 c2                	sub    %eax,%edx
+    4216:	89 d0                	mov    %edx,%eax
+    4218:	83 c0 30             	add    $0x30,%eax
+    421b:	88 45 a6             	mov    %al,-0x5a(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    421e:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    4221:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    4226:	89 d8                	mov    %ebx,%eax
+    4228:	f7 ea                	imul   %edx
+    422a:	c1 fa 05             	sar    $0x5,%edx
+    422d:	89 d8                	mov    %ebx,%eax
+    422f:	c1 f8 1f             	sar    $0x1f,%eax
+    4232:	89 d1                	mov    %edx,%ecx
+    4234:	29 c1                	sub    %eax,%ecx
+    4236:	6b c1 64             	imul   $0x64,%ecx,%eax
+    4239:	29 c3                	sub    %eax,%ebx
+    423b:	89 d9                	mov    %ebx,%ecx
+    423d:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    4242:	89 c8                	mov    %ecx,%eax
+    4244:	f7 ea                	imul   %edx
+    4246:	c1 fa 02             	sar    $0x2,%edx
+    4249:	89 c8                	mov    %ecx,%eax
+    424b:	c1 f8 1f             	sar    $0x1f,%eax
+    424e:	29 c2                	sub    %eax,%edx
+    4250:	89 d0                	mov    %edx,%eax
+    4252:	83 c0 30             	add    $0x30,%eax
+    4255:	88 45 a7             	mov    %al,-0x59(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    4258:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    425b:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    4260:	89 c8                	mov    %ecx,%eax
+    4262:	f7 ea                	imul   %edx
+    4264:	c1 fa 02             	sar    $0x2,%edx
+    4267:	89 c8                	mov    %ecx,%eax
+    4269:	c1 f8 1f             	sar    $0x1f,%eax
+    426c:	29 c2                	sub    %eax,%edx
+    426e:	89 d0                	mov    %edx,%eax
+    4270:	c1 e0 02             	shl    $0x2,%eax
+    4273:	01 d0                	add    %edx,%eax
+    4275:	01 c0                	add    %eax,%eax
+    4277:	29 c1                	sub    %eax,%ecx
+    4279:	89 ca                	mov    %ecx,%edx
+    427b:	89 d0                	mov    %edx,%eax
+    427d:	83 c0 30             	add    $0x30,%eax
+    4280:	88 45 a8             	mov    %al,-0x58(%ebp)
+    name[5] = '\0';
+    4283:	c6 45 a9 00          	movb   $0x0,-0x57(%ebp)
+    unlink(name);
+    4287:	83 ec 0c             	sub    $0xc,%esp
+    428a:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    428d:	50                   	push   %eax
+    428e:	e8 92 07 00 00       	call   4a25 <unlink>
+    4293:	83 c4 10             	add    $0x10,%esp
+    nfiles--;
+    4296:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+  while(nfiles >= 0){
+    429a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    429e:	0f 89 1b ff ff ff    	jns    41bf <fsfull+0x1aa>
+  }
+
+  printf(1, "fsfull test finished\n");
+    42a4:	83 ec 08             	sub    $0x8,%esp
+    42a7:	68 79 68 00 00       	push   $0x6879
+    42ac:	6a 01                	push   $0x1
+    42ae:	e8 de 08 00 00       	call   4b91 <printf>
+    42b3:	83 c4 10             	add    $0x10,%esp
+}
+    42b6:	90                   	nop
+    42b7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    42ba:	c9                   	leave
+    42bb:	c3                   	ret
+
+000042bc <uio>:
+
+void
+uio()
+{
+    42bc:	55                   	push   %ebp
+    42bd:	89 e5                	mov    %esp,%ebp
+    42bf:	83 ec 18             	sub    $0x18,%esp
+  #define RTC_ADDR 0x70
+  #define RTC_DATA 0x71
+
+  ushort port = 0;
+    42c2:	66 c7 45 f6 00 00    	movw   $0x0,-0xa(%ebp)
+  uchar val = 0;
+    42c8:	c6 45 f5 00          	movb   $0x0,-0xb(%ebp)
+  int pid;
+
+  printf(1, "uio test\n");
+    42cc:	83 ec 08             	sub    $0x8,%esp
+    42cf:	68 8f 68 00 00       	push   $0x688f
+    42d4:	6a 01                	push   $0x1
+    42d6:	e8 b6 08 00 00       	call   4b91 <printf>
+    42db:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    42de:	e8 ea 06 00 00       	call   49cd <fork>
+    42e3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(pid == 0){
+    42e6:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    42ea:	75 3a                	jne    4326 <uio+0x6a>
+    port = RTC_ADDR;
+    42ec:	66 c7 45 f6 70 00    	movw   $0x70,-0xa(%ebp)
+    val = 0x09;  /* year */
+    42f2:	c6 45 f5 09          	movb   $0x9,-0xb(%ebp)
+    /* http://wiki.osdev.org/Inline_Assembly/Examples */
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    42f6:	0f b6 45 f5          	movzbl -0xb(%ebp),%eax
+    42fa:	0f b7 55 f6          	movzwl -0xa(%ebp),%edx
+    42fe:	ee                   	out    %al,(%dx)
+    port = RTC_DATA;
+    42ff:	66 c7 45 f6 71 00    	movw   $0x71,-0xa(%ebp)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    4305:	0f b7 45 f6          	movzwl -0xa(%ebp),%eax
+    4309:	89 c2                	mov    %eax,%edx
+    430b:	ec                   	in     (%dx),%al
+    430c:	88 45 f5             	mov    %al,-0xb(%ebp)
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    430f:	83 ec 08             	sub    $0x8,%esp
+    4312:	68 9c 68 00 00       	push   $0x689c
+    4317:	6a 01                	push   $0x1
+    4319:	e8 73 08 00 00       	call   4b91 <printf>
+    431e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4321:	e8 af 06 00 00       	call   49d5 <exit>
+  } else if(pid < 0){
+    4326:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    432a:	79 17                	jns    4343 <uio+0x87>
+    printf (1, "fork failed\n");
+    432c:	83 ec 08             	sub    $0x8,%esp
+    432f:	68 0d 50 00 00       	push   $0x500d
+    4334:	6a 01                	push   $0x1
+    4336:	e8 56 08 00 00       	call   4b91 <printf>
+    433b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    433e:	e8 92 06 00 00       	call   49d5 <exit>
+  }
+  wait();
+    4343:	e8 95 06 00 00       	call   49dd <wait>
+  printf(1, "uio test done\n");
+    4348:	83 ec 08             	sub    $0x8,%esp
+    434b:	68 bd 68 00 00       	push   $0x68bd
+    4350:	6a 01                	push   $0x1
+    4352:	e8 3a 08 00 00       	call   4b91 <printf>
+    4357:	83 c4 10             	add    $0x10,%esp
+}
+    435a:	90                   	nop
+    435b:	c9                   	leave
+    435c:	c3                   	ret
+
+0000435d <argptest>:
+
+void argptest()
+{
+    435d:	55                   	push   %ebp
+    435e:	89 e5                	mov    %esp,%ebp
+    4360:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  fd = open("init", O_RDONLY);
+    4363:	83 ec 08             	sub    $0x8,%esp
+    4366:	6a 00                	push   $0x0
+    4368:	68 cc 68 00 00       	push   $0x68cc
+    436d:	e8 a3 06 00 00       	call   4a15 <open>
+    4372:	83 c4 10             	add    $0x10,%esp
+    4375:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if (fd < 0) {
+    4378:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    437c:	79 17                	jns    4395 <argptest+0x38>
+    printf(2, "open failed\n");
+    437e:	83 ec 08             	sub    $0x8,%esp
+    4381:	68 d1 68 00 00       	push   $0x68d1
+    4386:	6a 02                	push   $0x2
+    4388:	e8 04 08 00 00       	call   4b91 <printf>
+    438d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4390:	e8 40 06 00 00       	call   49d5 <exit>
+  }
+  read(fd, sbrk(0) - 1, -1);
+    4395:	83 ec 0c             	sub    $0xc,%esp
+    4398:	6a 00                	push   $0x0
+    439a:	e8 be 06 00 00       	call   4a5d <sbrk>
+    439f:	83 c4 10             	add    $0x10,%esp
+    43a2:	83 e8 01             	sub    $0x1,%eax
+    43a5:	83 ec 04             	sub    $0x4,%esp
+    43a8:	6a ff                	push   $0xffffffff
+    43aa:	50                   	push   %eax
+    43ab:	ff 75 f4             	push   -0xc(%ebp)
+    43ae:	e8 3a 06 00 00       	call   49ed <read>
+    43b3:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+    43b6:	83 ec 0c             	sub    $0xc,%esp
+    43b9:	ff 75 f4             	push   -0xc(%ebp)
+    43bc:	e8 3c 06 00 00       	call   49fd <close>
+    43c1:	83 c4 10             	add    $0x10,%esp
+  printf(1, "arg test passed\n");
+    43c4:	83 ec 08             	sub    $0x8,%esp
+    43c7:	68 de 68 00 00       	push   $0x68de
+    43cc:	6a 01                	push   $0x1
+    43ce:	e8 be 07 00 00       	call   4b91 <printf>
+    43d3:	83 c4 10             	add    $0x10,%esp
+}
+    43d6:	90                   	nop
+    43d7:	c9                   	leave
+    43d8:	c3                   	ret
+
+000043d9 <rand>:
+
+unsigned long randstate = 1;
+unsigned int
+rand()
+{
+    43d9:	55                   	push   %ebp
+    43da:	89 e5                	mov    %esp,%ebp
+  randstate = randstate * 1664525 + 1013904223;
+    43dc:	a1 7c 71 00 00       	mov    0x717c,%eax
+    43e1:	69 c0 0d 66 19 00    	imul   $0x19660d,%eax,%eax
+    43e7:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    43ec:	a3 7c 71 00 00       	mov    %eax,0x717c
+  return randstate;
+    43f1:	a1 7c 71 00 00       	mov    0x717c,%eax
+}
+    43f6:	5d                   	pop    %ebp
+    43f7:	c3                   	ret
+
+000043f8 <main>:
+
+int
+main(int argc, char *argv[])
+{
+    43f8:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    43fc:	83 e4 f0             	and    $0xfffffff0,%esp
+    43ff:	ff 71 fc             	push   -0x4(%ecx)
+    4402:	55                   	push   %ebp
+    4403:	89 e5                	mov    %esp,%ebp
+    4405:	51                   	push   %ecx
+    4406:	83 ec 04             	sub    $0x4,%esp
+  printf(1, "usertests starting\n");
+    4409:	83 ec 08             	sub    $0x8,%esp
+    440c:	68 ef 68 00 00       	push   $0x68ef
+    4411:	6a 01                	push   $0x1
+    4413:	e8 79 07 00 00       	call   4b91 <printf>
+    4418:	83 c4 10             	add    $0x10,%esp
+
+  if(open("usertests.ran", 0) >= 0){
+    441b:	83 ec 08             	sub    $0x8,%esp
+    441e:	6a 00                	push   $0x0
+    4420:	68 03 69 00 00       	push   $0x6903
+    4425:	e8 eb 05 00 00       	call   4a15 <open>
+    442a:	83 c4 10             	add    $0x10,%esp
+    442d:	85 c0                	test   %eax,%eax
+    442f:	78 17                	js     4448 <main+0x50>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+    4431:	83 ec 08             	sub    $0x8,%esp
+    4434:	68 14 69 00 00       	push   $0x6914
+    4439:	6a 01                	push   $0x1
+    443b:	e8 51 07 00 00       	call   4b91 <printf>
+    4440:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4443:	e8 8d 05 00 00       	call   49d5 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+    4448:	83 ec 08             	sub    $0x8,%esp
+    444b:	68 00 02 00 00       	push   $0x200
+    4450:	68 03 69 00 00       	push   $0x6903
+    4455:	e8 bb 05 00 00       	call   4a15 <open>
+    445a:	83 c4 10             	add    $0x10,%esp
+    445d:	83 ec 0c             	sub    $0xc,%esp
+    4460:	50                   	push   %eax
+    4461:	e8 97 05 00 00       	call   49fd <close>
+    4466:	83 c4 10             	add    $0x10,%esp
+
+  argptest();
+    4469:	e8 ef fe ff ff       	call   435d <argptest>
+  createdelete();
+    446e:	e8 40 d2 ff ff       	call   16b3 <createdelete>
+  linkunlink();
+    4473:	e8 65 dc ff ff       	call   20dd <linkunlink>
+  concreate();
+    4478:	e8 ac d8 ff ff       	call   1d29 <concreate>
+  fourfiles();
+    447d:	e8 70 cc ff ff       	call   10f2 <fourfiles>
+  groupcommit();
+    4482:	e8 bc ce ff ff       	call   1343 <groupcommit>
+  sharedfd();
+    4487:	e8 83 ca ff ff       	call   f0f <sharedfd>
+
+  bigargtest();
+    448c:	e8 48 fa ff ff       	call   3ed9 <bigargtest>
+  bigwrite();
+    4491:	e8 b8 e9 ff ff       	call   2e4e <bigwrite>
+  bigargtest();
+    4496:	e8 3e fa ff ff       	call   3ed9 <bigargtest>
+  bsstest();
+    449b:	e8 c3 f9 ff ff       	call   3e63 <bsstest>
+  sbrktest();
+    44a0:	e8 dc f3 ff ff       	call   3881 <sbrktest>
+  validatetest();
+    44a5:	e8 db f8 ff ff       	call   3d85 <validatetest>
+
+  opentest();
+    44aa:	e8 50 be ff ff       	call   2ff <opentest>
+  writetest();
+    44af:	e8 fa be ff ff       	call   3ae <writetest>
+  writetest1();
+    44b4:	e8 05 c1 ff ff       	call   5be <writetest1>
+  createtest();
+    44b9:	e8 92 c3 ff ff       	call   850 <createtest>
+
+  openiputtest();
+    44be:	e8 2d bd ff ff       	call   1f0 <openiputtest>
+  exitiputtest();
+    44c3:	e8 29 bc ff ff       	call   f1 <exitiputtest>
+  iputtest();
+    44c8:	e8 33 bb ff ff       	call   0 <iputtest>
+
+  mem();
+    44cd:	e8 4c c9 ff ff       	call   e1e <mem>
+  pipe1();
+    44d2:	e8 80 c5 ff ff       	call   a57 <pipe1>
+  preempt();
+    44d7:	e8 64 c7 ff ff       	call   c40 <preempt>
+  exitwait();
+    44dc:	e8 c5 c8 ff ff       	call   da6 <exitwait>
+
+  rmdot();
+    44e1:	e8 da ed ff ff       	call   32c0 <rmdot>
+  fourteen();
+    44e6:	e8 79 ec ff ff       	call   3164 <fourteen>
+  bigfile();
+    44eb:	e8 5c ea ff ff       	call   2f4c <bigfile>
+  subdir();
+    44f0:	e8 15 e2 ff ff       	call   270a <subdir>
+  linktest();
+    44f5:	e8 ed d5 ff ff       	call   1ae7 <linktest>
+  unlinkread();
+    44fa:	e8 26 d4 ff ff       	call   1925 <unlinkread>
+  dirfile();
+    44ff:	e8 41 ef ff ff       	call   3445 <dirfile>
+  iref();
+    4504:	e8 74 f1 ff ff       	call   367d <iref>
+  forktest();
+    4509:	e8 a9 f2 ff ff       	call   37b7 <forktest>
+  bigdir(); // slow
+    450e:	e8 01 dd ff ff       	call   2214 <bigdir>
+  dirindex(); // slow
+    4513:	e8 f6 df ff ff       	call   250e <dirindex>
+
+  uio();
+    4518:	e8 9f fd ff ff       	call   42bc <uio>
+
+  exectest();
+    451d:	e8 e2 c4 ff ff       	call   a04 <exectest>
+
+  exit();
+    4522:	e8 ae 04 00 00       	call   49d5 <exit>
+
+00004527 <stosb>:
+}
+
+int
+stat(char *n, struct stat *st)
+{
+  int fd;
+    4527:	55                   	push   %ebp
+    4528:	89 e5                	mov    %esp,%ebp
+    452a:	57                   	push   %edi
+    452b:	53                   	push   %ebx
+  int r;
+    452c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    452f:	8b 55 10             	mov    0x10(%ebp),%edx
+    4532:	8b 45 0c             	mov    0xc(%ebp),%eax
+    4535:	89 cb                	mov    %ecx,%ebx
+    4537:	89 df                	mov    %ebx,%edi
+    4539:	89 d1                	mov    %edx,%ecx
+    453b:	fc                   	cld
+    453c:	f3 aa                	rep stos %al,%es:(%edi)
+    453e:	89 ca                	mov    %ecx,%edx
+    4540:	89 fb                	mov    %edi,%ebx
+    4542:	89 5d 08             	mov    %ebx,0x8(%ebp)
+    4545:	89 55 10             	mov    %edx,0x10(%ebp)
+
+  fd = open(n, O_RDONLY);
+  if(fd < 0)
+    return -1;
+    4548:	90                   	nop
+    4549:	5b                   	pop    %ebx
+    454a:	5f                   	pop    %edi
+    454b:	5d                   	pop    %ebp
+    454c:	c3                   	ret
+
+0000454d <strcpy>:
+{
+    454d:	55                   	push   %ebp
+    454e:	89 e5                	mov    %esp,%ebp
+    4550:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+    4553:	8b 45 08             	mov    0x8(%ebp),%eax
+    4556:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+    4559:	90                   	nop
+    455a:	8b 55 0c             	mov    0xc(%ebp),%edx
+    455d:	8d 42 01             	lea    0x1(%edx),%eax
+    4560:	89 45 0c             	mov    %eax,0xc(%ebp)
+    4563:	8b 45 08             	mov    0x8(%ebp),%eax
+    4566:	8d 48 01             	lea    0x1(%eax),%ecx
+    4569:	89 4d 08             	mov    %ecx,0x8(%ebp)
+    456c:	0f b6 12             	movzbl (%edx),%edx
+    456f:	88 10                	mov    %dl,(%eax)
+    4571:	0f b6 00             	movzbl (%eax),%eax
+    4574:	84 c0                	test   %al,%al
+    4576:	75 e2                	jne    455a <strcpy+0xd>
+  return os;
+    4578:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    457b:	c9                   	leave
+    457c:	c3                   	ret
+
+0000457d <strlen>:
+{
+    457d:	55                   	push   %ebp
+    457e:	89 e5                	mov    %esp,%ebp
+    4580:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+    4583:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    458a:	eb 04                	jmp    4590 <strlen+0x13>
+    458c:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+    4590:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    4593:	8b 45 08             	mov    0x8(%ebp),%eax
+    4596:	01 d0                	add    %edx,%eax
+    4598:	0f b6 00             	movzbl (%eax),%eax
+    459b:	84 c0                	test   %al,%al
+    459d:	75 ed                	jne    458c <strlen+0xf>
+  return n;
+    459f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    45a2:	c9                   	leave
+    45a3:	c3                   	ret
+
+000045a4 <memset>:
+{
+    45a4:	55                   	push   %ebp
+    45a5:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+    45a7:	8b 45 10             	mov    0x10(%ebp),%eax
+    45aa:	50                   	push   %eax
+    45ab:	ff 75 0c             	push   0xc(%ebp)
+    45ae:	ff 75 08             	push   0x8(%ebp)
+    45b1:	e8 71 ff ff ff       	call   4527 <stosb>
+    45b6:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+    45b9:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    45bc:	c9                   	leave
+    45bd:	c3                   	ret
+
+000045be <strchr>:
+{
+    45be:	55                   	push   %ebp
+    45bf:	89 e5                	mov    %esp,%ebp
+    45c1:	83 ec 04             	sub    $0x4,%esp
+    45c4:	8b 45 0c             	mov    0xc(%ebp),%eax
+    45c7:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+    45ca:	eb 14                	jmp    45e0 <strchr+0x22>
+    if(*s == c)
+    45cc:	8b 45 08             	mov    0x8(%ebp),%eax
+    45cf:	0f b6 00             	movzbl (%eax),%eax
+    45d2:	38 45 fc             	cmp    %al,-0x4(%ebp)
+    45d5:	75 05                	jne    45dc <strchr+0x1e>
+      return (char*)s;
+    45d7:	8b 45 08             	mov    0x8(%ebp),%eax
+    45da:	eb 13                	jmp    45ef <strchr+0x31>
+  for(; *s; s++)
+    45dc:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+    45e0:	8b 45 08             	mov    0x8(%ebp),%eax
+    45e3:	0f b6 00             	movzbl (%eax),%eax
+    45e6:	84 c0                	test   %al,%al
+    45e8:	75 e2                	jne    45cc <strchr+0xe>
+  return 0;
+    45ea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    45ef:	c9                   	leave
+    45f0:	c3                   	ret
+
+000045f1 <gets>:
+{
+    45f1:	55                   	push   %ebp
+    45f2:	89 e5                	mov    %esp,%ebp
+    45f4:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+    45f7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    45fe:	eb 42                	jmp    4642 <gets+0x51>
+    cc = read(0, &c, 1);
+    4600:	83 ec 04             	sub    $0x4,%esp
+    4603:	6a 01                	push   $0x1
+    4605:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    4608:	50                   	push   %eax
+    4609:	6a 00                	push   $0x0
+    460b:	e8 dd 03 00 00       	call   49ed <read>
+    4610:	83 c4 10             	add    $0x10,%esp
+    4613:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+    4616:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    461a:	7e 33                	jle    464f <gets+0x5e>
+    buf[i++] = c;
+    461c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    461f:	8d 50 01             	lea    0x1(%eax),%edx
+    4622:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    4625:	89 c2                	mov    %eax,%edx
+    4627:	8b 45 08             	mov    0x8(%ebp),%eax
+    462a:	01 c2                	add    %eax,%edx
+    462c:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    4630:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+    4632:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    4636:	3c 0a                	cmp    $0xa,%al
+    4638:	74 16                	je     4650 <gets+0x5f>
+    463a:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    463e:	3c 0d                	cmp    $0xd,%al
+    4640:	74 0e                	je     4650 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+    4642:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4645:	83 c0 01             	add    $0x1,%eax
+    4648:	39 45 0c             	cmp    %eax,0xc(%ebp)
+    464b:	7f b3                	jg     4600 <gets+0xf>
+    464d:	eb 01                	jmp    4650 <gets+0x5f>
+      break;
+    464f:	90                   	nop
+  buf[i] = '\0';
+    4650:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    4653:	8b 45 08             	mov    0x8(%ebp),%eax
+    4656:	01 d0                	add    %edx,%eax
+    4658:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+    465b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    465e:	c9                   	leave
+    465f:	c3                   	ret
+
+00004660 <stat>:
+{
+    4660:	55                   	push   %ebp
+    4661:	89 e5                	mov    %esp,%ebp
+    4663:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+    4666:	83 ec 08             	sub    $0x8,%esp
+    4669:	6a 00                	push   $0x0
+    466b:	ff 75 08             	push   0x8(%ebp)
+    466e:	e8 a2 03 00 00       	call   4a15 <open>
+    4673:	83 c4 10             	add    $0x10,%esp
+    4676:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+    4679:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    467d:	79 07                	jns    4686 <stat+0x26>
+    return -1;
+    467f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    4684:	eb 25                	jmp    46ab <stat+0x4b>
+  r = fstat(fd, st);
+    4686:	83 ec 08             	sub    $0x8,%esp
+    4689:	ff 75 0c             	push   0xc(%ebp)
+    468c:	ff 75 f4             	push   -0xc(%ebp)
+    468f:	e8 99 03 00 00       	call   4a2d <fstat>
+    4694:	83 c4 10             	add    $0x10,%esp
+    4697:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+    469a:	83 ec 0c             	sub    $0xc,%esp
+    469d:	ff 75 f4             	push   -0xc(%ebp)
+    46a0:	e8 58 03 00 00       	call   49fd <close>
+    46a5:	83 c4 10             	add    $0x10,%esp
+  return r;
+    46a8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    46ab:	c9                   	leave
+    46ac:	c3                   	ret
+
+000046ad <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    46ad:	55                   	push   %ebp
+    46ae:	89 e5                	mov    %esp,%ebp
+    46b0:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+
+  dst = vdst;
+    46b3:	8b 45 08             	mov    0x8(%ebp),%eax
+    46b6:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+    46b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+    46bc:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+    46bf:	eb 17                	jmp    46d8 <memmove+0x2b>
+    *dst++ = *src++;
+    46c1:	8b 55 f8             	mov    -0x8(%ebp),%edx
+    46c4:	8d 42 01             	lea    0x1(%edx),%eax
+    46c7:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    46ca:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    46cd:	8d 48 01             	lea    0x1(%eax),%ecx
+    46d0:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+    46d3:	0f b6 12             	movzbl (%edx),%edx
+    46d6:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+    46d8:	8b 45 10             	mov    0x10(%ebp),%eax
+    46db:	8d 50 ff             	lea    -0x1(%eax),%edx
+    46de:	89 55 10             	mov    %edx,0x10(%ebp)
+    46e1:	85 c0                	test   %eax,%eax
+    46e3:	7f dc                	jg     46c1 <memmove+0x14>
+  return vdst;
+    46e5:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    46e8:	c9                   	leave
+    46e9:	c3                   	ret
+
+000046ea <cpuinfo>:
+    46ea:	55                   	push   %ebp
+    46eb:	89 e5                	mov    %esp,%ebp
+    46ed:	56                   	push   %esi
+    46ee:	53                   	push   %ebx
+    46ef:	8b 45 08             	mov    0x8(%ebp),%eax
+    46f2:	ba 00 00 00 00       	mov    $0x0,%edx
+    46f7:	89 d1                	mov    %edx,%ecx
+    46f9:	0f a2                	cpuid
+    46fb:	89 c6                	mov    %eax,%esi
+    46fd:	8b 45 0c             	mov    0xc(%ebp),%eax
+    4700:	89 30                	mov    %esi,(%eax)
+    4702:	8b 45 10             	mov    0x10(%ebp),%eax
+    4705:	89 18                	mov    %ebx,(%eax)
+    4707:	8b 45 14             	mov    0x14(%ebp),%eax
+    470a:	89 08                	mov    %ecx,(%eax)
+    470c:	8b 45 18             	mov    0x18(%ebp),%eax
+    470f:	89 10                	mov    %edx,(%eax)
+    4711:	90                   	nop
+    4712:	5b                   	pop    %ebx
+    4713:	5e                   	pop    %esi
+    4714:	5d                   	pop    %ebp
+    4715:	c3                   	ret
+
+00004716 <atoi>:
+{
+    4716:	55                   	push   %ebp
+    4717:	89 e5                	mov    %esp,%ebp
+    4719:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+    471c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+    4723:	eb 25                	jmp    474a <atoi+0x34>
+    n = n*10 + *s++ - '0';
+    4725:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    4728:	89 d0                	mov    %edx,%eax
+    472a:	c1 e0 02             	shl    $0x2,%eax
+    472d:	01 d0                	add    %edx,%eax
+    472f:	01 c0                	add    %eax,%eax
+    4731:	89 c1                	mov    %eax,%ecx
+    4733:	8b 45 08             	mov    0x8(%ebp),%eax
+    4736:	8d 50 01             	lea    0x1(%eax),%edx
+    4739:	89 55 08             	mov    %edx,0x8(%ebp)
+    473c:	0f b6 00             	movzbl (%eax),%eax
+    473f:	0f be c0             	movsbl %al,%eax
+    4742:	01 c8                	add    %ecx,%eax
+    4744:	83 e8 30             	sub    $0x30,%eax
+    4747:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+    474a:	8b 45 08             	mov    0x8(%ebp),%eax
+    474d:	0f b6 00             	movzbl (%eax),%eax
+    4750:	3c 2f                	cmp    $0x2f,%al
+    4752:	7e 0a                	jle    475e <atoi+0x48>
+    4754:	8b 45 08             	mov    0x8(%ebp),%eax
+    4757:	0f b6 00             	movzbl (%eax),%eax
+    475a:	3c 39                	cmp    $0x39,%al
+    475c:	7e c7                	jle    4725 <atoi+0xf>
+  return n;
+    475e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    4761:	c9                   	leave
+    4762:	c3                   	ret
+
+00004763 <strcmp>:
+{
+    4763:	55                   	push   %ebp
+    4764:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+    4766:	eb 08                	jmp    4770 <strcmp+0xd>
+    p++, q++;
+    4768:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+    476c:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+    4770:	8b 45 08             	mov    0x8(%ebp),%eax
+    4773:	0f b6 00             	movzbl (%eax),%eax
+    4776:	84 c0                	test   %al,%al
+    4778:	74 10                	je     478a <strcmp+0x27>
+    477a:	8b 45 08             	mov    0x8(%ebp),%eax
+    477d:	0f b6 10             	movzbl (%eax),%edx
+    4780:	8b 45 0c             	mov    0xc(%ebp),%eax
+    4783:	0f b6 00             	movzbl (%eax),%eax
+    4786:	38 c2                	cmp    %al,%dl
+    4788:	74 de                	je     4768 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+    478a:	8b 45 08             	mov    0x8(%ebp),%eax
+    478d:	0f b6 00             	movzbl (%eax),%eax
+    4790:	0f b6 d0             	movzbl %al,%edx
+    4793:	8b 45 0c             	mov    0xc(%ebp),%eax
+    4796:	0f b6 00             	movzbl (%eax),%eax
+    4799:	0f b6 c0             	movzbl %al,%eax
+    479c:	29 c2                	sub    %eax,%edx
+    479e:	89 d0                	mov    %edx,%eax
+}
+    47a0:	5d                   	pop    %ebp
+    47a1:	c3                   	ret
+
+000047a2 <udiv64>:
+{
+    47a2:	55                   	push   %ebp
+    47a3:	89 e5                	mov    %esp,%ebp
+    47a5:	57                   	push   %edi
+    47a6:	56                   	push   %esi
+    47a7:	83 ec 38             	sub    $0x38,%esp
+    47aa:	8b 45 08             	mov    0x8(%ebp),%eax
+    47ad:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    47b0:	8b 45 0c             	mov    0xc(%ebp),%eax
+    47b3:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    47b6:	8b 45 10             	mov    0x10(%ebp),%eax
+    47b9:	89 45 c8             	mov    %eax,-0x38(%ebp)
+    47bc:	8b 45 14             	mov    0x14(%ebp),%eax
+    47bf:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  q = r = 0;
+    47c2:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+    47c9:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    47d0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    47d3:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    47d6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    47d9:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+    47dc:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+    47e3:	e9 85 00 00 00       	jmp    486d <udiv64+0xcb>
+    r = (r << 1) | ((n >> i) & 1);
+    47e8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    47eb:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    47ee:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+    47f2:	01 c0                	add    %eax,%eax
+    47f4:	89 c6                	mov    %eax,%esi
+    47f6:	89 d7                	mov    %edx,%edi
+    47f8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    47fb:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    47fe:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    4801:	0f ad d0             	shrd   %cl,%edx,%eax
+    4804:	d3 ea                	shr    %cl,%edx
+    4806:	f6 c1 20             	test   $0x20,%cl
+    4809:	74 04                	je     480f <udiv64+0x6d>
+    480b:	89 d0                	mov    %edx,%eax
+    480d:	31 d2                	xor    %edx,%edx
+    480f:	83 e0 01             	and    $0x1,%eax
+    4812:	89 45 c0             	mov    %eax,-0x40(%ebp)
+    4815:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+    481c:	89 f0                	mov    %esi,%eax
+    481e:	89 fa                	mov    %edi,%edx
+    4820:	0b 45 c0             	or     -0x40(%ebp),%eax
+    4823:	0b 55 c4             	or     -0x3c(%ebp),%edx
+    4826:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    4829:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+    482c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    482f:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    4832:	3b 45 c8             	cmp    -0x38(%ebp),%eax
+    4835:	89 d0                	mov    %edx,%eax
+    4837:	1b 45 cc             	sbb    -0x34(%ebp),%eax
+    483a:	72 2d                	jb     4869 <udiv64+0xc7>
+      r -= d;
+    483c:	8b 45 c8             	mov    -0x38(%ebp),%eax
+    483f:	8b 55 cc             	mov    -0x34(%ebp),%edx
+    4842:	29 45 e8             	sub    %eax,-0x18(%ebp)
+    4845:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64_t)1 << i;
+    4848:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    484b:	b8 01 00 00 00       	mov    $0x1,%eax
+    4850:	ba 00 00 00 00       	mov    $0x0,%edx
+    4855:	0f a5 c2             	shld   %cl,%eax,%edx
+    4858:	d3 e0                	shl    %cl,%eax
+    485a:	f6 c1 20             	test   $0x20,%cl
+    485d:	74 04                	je     4863 <udiv64+0xc1>
+    485f:	89 c2                	mov    %eax,%edx
+    4861:	31 c0                	xor    %eax,%eax
+    4863:	09 45 f0             	or     %eax,-0x10(%ebp)
+    4866:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+    4869:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+    486d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+    4871:	0f 89 71 ff ff ff    	jns    47e8 <udiv64+0x46>
+  if(rem)
+    4877:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+    487b:	74 0e                	je     488b <udiv64+0xe9>
+    *rem = r;
+    487d:	8b 4d 18             	mov    0x18(%ebp),%ecx
+    4880:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    4883:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    4886:	89 01                	mov    %eax,(%ecx)
+    4888:	89 51 04             	mov    %edx,0x4(%ecx)
+  return q;
+    488b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    488e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+    4891:	83 c4 38             	add    $0x38,%esp
+    4894:	5e                   	pop    %esi
+    4895:	5f                   	pop    %edi
+    4896:	5d                   	pop    %ebp
+    4897:	c3                   	ret
+
+00004898 <crc32cinit>:
+{
+    4898:	55                   	push   %ebp
+    4899:	89 e5                	mov    %esp,%ebp
+    489b:	83 ec 20             	sub    $0x20,%esp
+  for(i = 0; i < 256; i++){
+    489e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    48a5:	eb 4c                	jmp    48f3 <crc32cinit+0x5b>
+    r = i;
+    48a7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    48aa:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+    48ad:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+    48b4:	eb 26                	jmp    48dc <crc32cinit+0x44>
+      r = (r >> 1) ^ ((r & 1) ? CRC32C_POLY : 0);
+    48b6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    48b9:	d1 e8                	shr    %eax
+    48bb:	89 c2                	mov    %eax,%edx
+    48bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    48c0:	83 e0 01             	and    $0x1,%eax
+    48c3:	85 c0                	test   %eax,%eax
+    48c5:	74 07                	je     48ce <crc32cinit+0x36>
+    48c7:	b8 78 3b f6 82       	mov    $0x82f63b78,%eax
+    48cc:	eb 05                	jmp    48d3 <crc32cinit+0x3b>
+    48ce:	b8 00 00 00 00       	mov    $0x0,%eax
+    48d3:	31 d0                	xor    %edx,%eax
+    48d5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+    48d8:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+    48dc:	83 7d f8 07          	cmpl   $0x7,-0x8(%ebp)
+    48e0:	76 d4                	jbe    48b6 <crc32cinit+0x1e>
+    crc32ctab[i] = r;
+    48e2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    48e5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    48e8:	89 14 85 20 72 00 00 	mov    %edx,0x7220(,%eax,4)
+  for(i = 0; i < 256; i++){
+    48ef:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+    48f3:	81 7d fc ff 00 00 00 	cmpl   $0xff,-0x4(%ebp)
+    48fa:	76 ab                	jbe    48a7 <crc32cinit+0xf>
+  cpuinfo(1, &a, &b, &c, &d);
+    48fc:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    48ff:	50                   	push   %eax
+    4900:	8d 45 e8             	lea    -0x18(%ebp),%eax
+    4903:	50                   	push   %eax
+    4904:	8d 45 ec             	lea    -0x14(%ebp),%eax
+    4907:	50                   	push   %eax
+    4908:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    490b:	50                   	push   %eax
+    490c:	6a 01                	push   $0x1
+    490e:	e8 d7 fd ff ff       	call   46ea <cpuinfo>
+    4913:	83 c4 14             	add    $0x14,%esp
+  crc32chw = (c & CPUID_SSE42) != 0;
+    4916:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    4919:	25 00 00 10 00       	and    $0x100000,%eax
+    491e:	85 c0                	test   %eax,%eax
+    4920:	0f 95 c0             	setne  %al
+    4923:	0f b6 c0             	movzbl %al,%eax
+    4926:	a3 80 71 00 00       	mov    %eax,0x7180
+}
+    492b:	90                   	nop
+    492c:	c9                   	leave
+    492d:	c3                   	ret
+
+0000492e <crc32c>:
+{
+    492e:	55                   	push   %ebp
+    492f:	89 e5                	mov    %esp,%ebp
+    4931:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s = p;
+    4934:	8b 45 0c             	mov    0xc(%ebp),%eax
+    4937:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(crc32chw < 0)
+    493a:	a1 80 71 00 00       	mov    0x7180,%eax
+    493f:	85 c0                	test   %eax,%eax
+    4941:	79 05                	jns    4948 <crc32c+0x1a>
+    crc32cinit();
+    4943:	e8 50 ff ff ff       	call   4898 <crc32cinit>
+  crc = ~crc;
+    4948:	f7 55 08             	notl   0x8(%ebp)
+  if(crc32chw){
+    494b:	a1 80 71 00 00       	mov    0x7180,%eax
+    4950:	85 c0                	test   %eax,%eax
+    4952:	74 6c                	je     49c0 <crc32c+0x92>
+    for(; n >= 4; n -= 4, s += 4)
+    4954:	eb 18                	jmp    496e <crc32c+0x40>
+      asm("crc32l %1, %0" : "+r" (crc) : "rm" (*(const uint*)s));
+    4956:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4959:	8b 10                	mov    (%eax),%edx
+    495b:	8b 45 08             	mov    0x8(%ebp),%eax
+    495e:	f2 0f 38 f1 c2       	crc32  %edx,%eax
+    4963:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n >= 4; n -= 4, s += 4)
+    4966:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+    496a:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+    496e:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+    4972:	77 e2                	ja     4956 <crc32c+0x28>
+    for(; n > 0; n--, s++)
+    4974:	eb 19                	jmp    498f <crc32c+0x61>
+      asm("crc32b %1, %0" : "+r" (crc) : "qm" (*s));
+    4976:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4979:	0f b6 10             	movzbl (%eax),%edx
+    497c:	8b 45 08             	mov    0x8(%ebp),%eax
+    497f:	f2 0f 38 f0 c2       	crc32  %dl,%eax
+    4984:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+    4987:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+    498b:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+    498f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+    4993:	75 e1                	jne    4976 <crc32c+0x48>
+    4995:	eb 2f                	jmp    49c6 <crc32c+0x98>
+      crc = crc32ctab[(crc ^ *s) & 0xff] ^ (crc >> 8);
+    4997:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    499a:	0f b6 00             	movzbl (%eax),%eax
+    499d:	0f b6 c0             	movzbl %al,%eax
+    49a0:	33 45 08             	xor    0x8(%ebp),%eax
+    49a3:	0f b6 c0             	movzbl %al,%eax
+    49a6:	8b 04 85 20 72 00 00 	mov    0x7220(,%eax,4),%eax
+    49ad:	8b 55 08             	mov    0x8(%ebp),%edx
+    49b0:	c1 ea 08             	shr    $0x8,%edx
+    49b3:	31 d0                	xor    %edx,%eax
+    49b5:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+    49b8:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+    49bc:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+    49c0:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+    49c4:	75 d1                	jne    4997 <crc32c+0x69>
+  return ~crc;
+    49c6:	8b 45 08             	mov    0x8(%ebp),%eax
+    49c9:	f7 d0                	not    %eax
+}
+    49cb:	c9                   	leave
+    49cc:	c3                   	ret
+
+000049cd <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    49cd:	b8 01 00 00 00       	mov    $0x1,%eax
+    49d2:	cd 40                	int    $0x40
+    49d4:	c3                   	ret
+
+000049d5 <exit>:
+SYSCALL(exit)
+    49d5:	b8 02 00 00 00       	mov    $0x2,%eax
+    49da:	cd 40                	int    $0x40
+    49dc:	c3                   	ret
+
+000049dd <wait>:
+SYSCALL(wait)
+    49dd:	b8 03 00 00 00       	mov    $0x3,%eax
+    49e2:	cd 40                	int    $0x40
+    49e4:	c3                   	ret
+
+000049e5 <pipe>:
+SYSCALL(pipe)
+    49e5:	b8 04 00 00 00       	mov    $0x4,%eax
+    49ea:	cd 40                	int    $0x40
+    49ec:	c3                   	ret
+
+000049ed <read>:
+SYSCALL(read)
+    49ed:	b8 05 00 00 00       	mov    $0x5,%eax
+    49f2:	cd 40                	int    $0x40
+    49f4:	c3                   	ret
+
+000049f5 <write>:
+SYSCALL(write)
+    49f5:	b8 10 00 00 00       	mov    $0x10,%eax
+    49fa:	cd 40                	int    $0x40
+    49fc:	c3                   	ret
+
+000049fd <close>:
+SYSCALL(close)
+    49fd:	b8 15 00 00 00       	mov    $0x15,%eax
+    4a02:	cd 40                	int    $0x40
+    4a04:	c3                   	ret
+
+00004a05 <kill>:
+SYSCALL(kill)
+    4a05:	b8 06 00 00 00       	mov    $0x6,%eax
+    4a0a:	cd 40                	int    $0x40
+    4a0c:	c3                   	ret
+
+00004a0d <exec>:
+SYSCALL(exec)
+    4a0d:	b8 07 00 00 00       	mov    $0x7,%eax
+    4a12:	cd 40                	int    $0x40
+    4a14:	c3                   	ret
+
+00004a15 <open>:
+SYSCALL(open)
+    4a15:	b8 0f 00 00 00       	mov    $0xf,%eax
+    4a1a:	cd 40                	int    $0x40
+    4a1c:	c3                   	ret
+
+00004a1d <mknod>:
+SYSCALL(mknod)
+    4a1d:	b8 11 00 00 00       	mov    $0x11,%eax
+    4a22:	cd 40                	int    $0x40
+    4a24:	c3                   	ret
+
+00004a25 <unlink>:
+SYSCALL(unlink)
+    4a25:	b8 12 00 00 00       	mov    $0x12,%eax
+    4a2a:	cd 40                	int    $0x40
+    4a2c:	c3                   	ret
+
+00004a2d <fstat>:
+SYSCALL(fstat)
+    4a2d:	b8 08 00 00 00       	mov    $0x8,%eax
+    4a32:	cd 40                	int    $0x40
+    4a34:	c3                   	ret
+
+00004a35 <link>:
+SYSCALL(link)
+    4a35:	b8 13 00 00 00       	mov    $0x13,%eax
+    4a3a:	cd 40                	int    $0x40
+    4a3c:	c3                   	ret
+
+00004a3d <mkdir>:
+SYSCALL(mkdir)
+    4a3d:	b8 14 00 00 00       	mov    $0x14,%eax
+    4a42:	cd 40                	int    $0x40
+    4a44:	c3                   	ret
+
+00004a45 <chdir>:
+SYSCALL(chdir)
+    4a45:	b8 09 00 00 00       	mov    $0x9,%eax
+    4a4a:	cd 40                	int    $0x40
+    4a4c:	c3                   	ret
+
+00004a4d <dup>:
+SYSCALL(dup)
+    4a4d:	b8 0a 00 00 00       	mov    $0xa,%eax
+    4a52:	cd 40                	int    $0x40
+    4a54:	c3                   	ret
+
+00004a55 <getpid>:
+SYSCALL(getpid)
+    4a55:	b8 0b 00 00 00       	mov    $0xb,%eax
+    4a5a:	cd 40                	int    $0x40
+    4a5c:	c3                   	ret
+
+00004a5d <sbrk>:
+SYSCALL(sbrk)
+    4a5d:	b8 0c 00 00 00       	mov    $0xc,%eax
+    4a62:	cd 40                	int    $0x40
+    4a64:	c3                   	ret
+
+00004a65 <sleep>:
+SYSCALL(sleep)
+    4a65:	b8 0d 00 00 00       	mov    $0xd,%eax
+    4a6a:	cd 40                	int    $0x40
+    4a6c:	c3                   	ret
+
+00004a6d <uptime>:
+SYSCALL(uptime)
+    4a6d:	b8 0e 00 00 00       	mov    $0xe,%eax
+    4a72:	cd 40                	int    $0x40
+    4a74:	c3                   	ret
+
+00004a75 <arp>:
+SYSCALL(arp)
+    4a75:	b8 16 00 00 00       	mov    $0x16,%eax
+    4a7a:	cd 40                	int    $0x40
+    4a7c:	c3                   	ret
+
+00004a7d <ifstat>:
+SYSCALL(ifstat)
+    4a7d:	b8 17 00 00 00       	mov    $0x17,%eax
+    4a82:	cd 40                	int    $0x40
+    4a84:	c3                   	ret
+
+00004a85 <pcapctl>:
+SYSCALL(pcapctl)
+    4a85:	b8 18 00 00 00       	mov    $0x18,%eax
+    4a8a:	cd 40                	int    $0x40
+    4a8c:	c3                   	ret
+
+00004a8d <pcapread>:
+SYSCALL(pcapread)
+    4a8d:	b8 19 00 00 00       	mov    $0x19,%eax
+    4a92:	cd 40                	int    $0x40
+    4a94:	c3                   	ret
+
+00004a95 <bpfattach>:
+SYSCALL(bpfattach)
+    4a95:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    4a9a:	cd 40                	int    $0x40
+    4a9c:	c3                   	ret
+
+00004a9d <pktgen>:
+SYSCALL(pktgen)
+    4a9d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    4aa2:	cd 40                	int    $0x40
+    4aa4:	c3                   	ret
+
+00004aa5 <reflect>:
+SYSCALL(reflect)
+    4aa5:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    4aaa:	cd 40                	int    $0x40
+    4aac:	c3                   	ret
+
+00004aad <brctl>:
+SYSCALL(brctl)
+    4aad:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    4ab2:	cd 40                	int    $0x40
+    4ab4:	c3                   	ret
+
+00004ab5 <hostopen>:
+SYSCALL(hostopen)
+    4ab5:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    4aba:	cd 40                	int    $0x40
+    4abc:	c3                   	ret
+
+00004abd <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+    4abd:	55                   	push   %ebp
+    4abe:	89 e5                	mov    %esp,%ebp
+    4ac0:	83 ec 18             	sub    $0x18,%esp
+    4ac3:	8b 45 0c             	mov    0xc(%ebp),%eax
+    4ac6:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+    4ac9:	83 ec 04             	sub    $0x4,%esp
+    4acc:	6a 01                	push   $0x1
+    4ace:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    4ad1:	50                   	push   %eax
+    4ad2:	ff 75 08             	push   0x8(%ebp)
+    4ad5:	e8 1b ff ff ff       	call   49f5 <write>
+    4ada:	83 c4 10             	add    $0x10,%esp
+}
+    4add:	90                   	nop
+    4ade:	c9                   	leave
+    4adf:	c3                   	ret
+
+00004ae0 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    4ae0:	55                   	push   %ebp
+    4ae1:	89 e5                	mov    %esp,%ebp
+    4ae3:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    4ae6:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+    4aed:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+    4af1:	74 17                	je     4b0a <printint+0x2a>
+    4af3:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+    4af7:	79 11                	jns    4b0a <printint+0x2a>
+    neg = 1;
+    4af9:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+    4b00:	8b 45 0c             	mov    0xc(%ebp),%eax
+    4b03:	f7 d8                	neg    %eax
+    4b05:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    4b08:	eb 06                	jmp    4b10 <printint+0x30>
+  } else {
+    x = xx;
+    4b0a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    4b0d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+    4b10:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+    4b17:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    4b1a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    4b1d:	ba 00 00 00 00       	mov    $0x0,%edx
+    4b22:	f7 f1                	div    %ecx
+    4b24:	89 d1                	mov    %edx,%ecx
+    4b26:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4b29:	8d 50 01             	lea    0x1(%eax),%edx
+    4b2c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    4b2f:	0f b6 91 84 71 00 00 	movzbl 0x7184(%ecx),%edx
+    4b36:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+    4b3a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    4b3d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    4b40:	ba 00 00 00 00       	mov    $0x0,%edx
+    4b45:	f7 f1                	div    %ecx
+    4b47:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    4b4a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    4b4e:	75 c7                	jne    4b17 <printint+0x37>
+  if(neg)
+    4b50:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    4b54:	74 2d                	je     4b83 <printint+0xa3>
+    buf[i++] = '-';
+    4b56:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4b59:	8d 50 01             	lea    0x1(%eax),%edx
+    4b5c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    4b5f:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+    4b64:	eb 1d                	jmp    4b83 <printint+0xa3>
+    putc(fd, buf[i]);
+    4b66:	8d 55 dc             	lea    -0x24(%ebp),%edx
+    4b69:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4b6c:	01 d0                	add    %edx,%eax
+    4b6e:	0f b6 00             	movzbl (%eax),%eax
+    4b71:	0f be c0             	movsbl %al,%eax
+    4b74:	83 ec 08             	sub    $0x8,%esp
+    4b77:	50                   	push   %eax
+    4b78:	ff 75 08             	push   0x8(%ebp)
+    4b7b:	e8 3d ff ff ff       	call   4abd <putc>
+    4b80:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+    4b83:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+    4b87:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    4b8b:	79 d9                	jns    4b66 <printint+0x86>
+}
+    4b8d:	90                   	nop
+    4b8e:	90                   	nop
+    4b8f:	c9                   	leave
+    4b90:	c3                   	ret
+
+00004b91 <printf>:
+
+// Print to the given fd. Only understands %d, %u, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    4b91:	55                   	push   %ebp
+    4b92:	89 e5                	mov    %esp,%ebp
+    4b94:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+    4b97:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+    4b9e:	8d 45 0c             	lea    0xc(%ebp),%eax
+    4ba1:	83 c0 04             	add    $0x4,%eax
+    4ba4:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+    4ba7:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    4bae:	e9 7d 01 00 00       	jmp    4d30 <printf+0x19f>
+    c = fmt[i] & 0xff;
+    4bb3:	8b 55 0c             	mov    0xc(%ebp),%edx
+    4bb6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4bb9:	01 d0                	add    %edx,%eax
+    4bbb:	0f b6 00             	movzbl (%eax),%eax
+    4bbe:	0f be c0             	movsbl %al,%eax
+    4bc1:	25 ff 00 00 00       	and    $0xff,%eax
+    4bc6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+    4bc9:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    4bcd:	75 2c                	jne    4bfb <printf+0x6a>
+      if(c == '%'){
+    4bcf:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    4bd3:	75 0c                	jne    4be1 <printf+0x50>
+        state = '%';
+    4bd5:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+    4bdc:	e9 4b 01 00 00       	jmp    4d2c <printf+0x19b>
+      } else {
+        putc(fd, c);
+    4be1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    4be4:	0f be c0             	movsbl %al,%eax
+    4be7:	83 ec 08             	sub    $0x8,%esp
+    4bea:	50                   	push   %eax
+    4beb:	ff 75 08             	push   0x8(%ebp)
+    4bee:	e8 ca fe ff ff       	call   4abd <putc>
+    4bf3:	83 c4 10             	add    $0x10,%esp
+    4bf6:	e9 31 01 00 00       	jmp    4d2c <printf+0x19b>
+      }
+    } else if(state == '%'){
+    4bfb:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+    4bff:	0f 85 27 01 00 00    	jne    4d2c <printf+0x19b>
+      if(c == 'd'){
+    4c05:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+    4c09:	75 1e                	jne    4c29 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+    4c0b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    4c0e:	8b 00                	mov    (%eax),%eax
+    4c10:	6a 01                	push   $0x1
+    4c12:	6a 0a                	push   $0xa
+    4c14:	50                   	push   %eax
+    4c15:	ff 75 08             	push   0x8(%ebp)
+    4c18:	e8 c3 fe ff ff       	call   4ae0 <printint>
+    4c1d:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    4c20:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    4c24:	e9 fc 00 00 00       	jmp    4d25 <printf+0x194>
+      } else if(c == 'u'){
+    4c29:	83 7d e4 75          	cmpl   $0x75,-0x1c(%ebp)
+    4c2d:	75 1e                	jne    4c4d <printf+0xbc>
+        printint(fd, *ap, 10, 0);
+    4c2f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    4c32:	8b 00                	mov    (%eax),%eax
+    4c34:	6a 00                	push   $0x0
+    4c36:	6a 0a                	push   $0xa
+    4c38:	50                   	push   %eax
+    4c39:	ff 75 08             	push   0x8(%ebp)
+    4c3c:	e8 9f fe ff ff       	call   4ae0 <printint>
+    4c41:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    4c44:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    4c48:	e9 d8 00 00 00       	jmp    4d25 <printf+0x194>
+      } else if(c == 'x' || c == 'p'){
+    4c4d:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+    4c51:	74 06                	je     4c59 <printf+0xc8>
+    4c53:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+    4c57:	75 1e                	jne    4c77 <printf+0xe6>
+        printint(fd, *ap, 16, 0);
+    4c59:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    4c5c:	8b 00                	mov    (%eax),%eax
+    4c5e:	6a 00                	push   $0x0
+    4c60:	6a 10                	push   $0x10
+    4c62:	50                   	push   %eax
+    4c63:	ff 75 08             	push   0x8(%ebp)
+    4c66:	e8 75 fe ff ff       	call   4ae0 <printint>
+    4c6b:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    4c6e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    4c72:	e9 ae 00 00 00       	jmp    4d25 <printf+0x194>
+      } else if(c == 's'){
+    4c77:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+    4c7b:	75 43                	jne    4cc0 <printf+0x12f>
+        s = (char*)*ap;
+    4c7d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    4c80:	8b 00                	mov    (%eax),%eax
+    4c82:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+    4c85:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+    4c89:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    4c8d:	75 25                	jne    4cb4 <printf+0x123>
+          s = "(null)";
+    4c8f:	c7 45 f4 3e 69 00 00 	movl   $0x693e,-0xc(%ebp)
+        while(*s != 0){
+    4c96:	eb 1c                	jmp    4cb4 <printf+0x123>
+          putc(fd, *s);
+    4c98:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4c9b:	0f b6 00             	movzbl (%eax),%eax
+    4c9e:	0f be c0             	movsbl %al,%eax
+    4ca1:	83 ec 08             	sub    $0x8,%esp
+    4ca4:	50                   	push   %eax
+    4ca5:	ff 75 08             	push   0x8(%ebp)
+    4ca8:	e8 10 fe ff ff       	call   4abd <putc>
+    4cad:	83 c4 10             	add    $0x10,%esp
+          s++;
+    4cb0:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+    4cb4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4cb7:	0f b6 00             	movzbl (%eax),%eax
+    4cba:	84 c0                	test   %al,%al
+    4cbc:	75 da                	jne    4c98 <printf+0x107>
+    4cbe:	eb 65                	jmp    4d25 <printf+0x194>
+        }
+      } else if(c == 'c'){
+    4cc0:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+    4cc4:	75 1d                	jne    4ce3 <printf+0x152>
+        putc(fd, *ap);
+    4cc6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    4cc9:	8b 00                	mov    (%eax),%eax
+    4ccb:	0f be c0             	movsbl %al,%eax
+    4cce:	83 ec 08             	sub    $0x8,%esp
+    4cd1:	50                   	push   %eax
+    4cd2:	ff 75 08             	push   0x8(%ebp)
+    4cd5:	e8 e3 fd ff ff       	call   4abd <putc>
+    4cda:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    4cdd:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    4ce1:	eb 42                	jmp    4d25 <printf+0x194>
+      } else if(c == '%'){
+    4ce3:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    4ce7:	75 17                	jne    4d00 <printf+0x16f>
+        putc(fd, c);
+    4ce9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    4cec:	0f be c0             	movsbl %al,%eax
+    4cef:	83 ec 08             	sub    $0x8,%esp
+    4cf2:	50                   	push   %eax
+    4cf3:	ff 75 08             	push   0x8(%ebp)
+    4cf6:	e8 c2 fd ff ff       	call   4abd <putc>
+    4cfb:	83 c4 10             	add    $0x10,%esp
+    4cfe:	eb 25                	jmp    4d25 <printf+0x194>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    4d00:	83 ec 08             	sub    $0x8,%esp
+    4d03:	6a 25                	push   $0x25
+    4d05:	ff 75 08             	push   0x8(%ebp)
+    4d08:	e8 b0 fd ff ff       	call   4abd <putc>
+    4d0d:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+    4d10:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    4d13:	0f be c0             	movsbl %al,%eax
+    4d16:	83 ec 08             	sub    $0x8,%esp
+    4d19:	50                   	push   %eax
+    4d1a:	ff 75 08             	push   0x8(%ebp)
+    4d1d:	e8 9b fd ff ff       	call   4abd <putc>
+    4d22:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+    4d25:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+    4d2c:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    4d30:	8b 55 0c             	mov    0xc(%ebp),%edx
+    4d33:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4d36:	01 d0                	add    %edx,%eax
+    4d38:	0f b6 00             	movzbl (%eax),%eax
+    4d3b:	84 c0                	test   %al,%al
+    4d3d:	0f 85 70 fe ff ff    	jne    4bb3 <printf+0x22>
+    }
+  }
+}
+    4d43:	90                   	nop
+    4d44:	90                   	nop
+    4d45:	c9                   	leave
+    4d46:	c3                   	ret
+
+00004d47 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    4d47:	55                   	push   %ebp
+    4d48:	89 e5                	mov    %esp,%ebp
+    4d4a:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    4d4d:	8b 45 08             	mov    0x8(%ebp),%eax
+    4d50:	83 e8 08             	sub    $0x8,%eax
+    4d53:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4d56:	a1 28 76 00 00       	mov    0x7628,%eax
+    4d5b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    4d5e:	eb 24                	jmp    4d84 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    4d60:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4d63:	8b 00                	mov    (%eax),%eax
+    4d65:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    4d68:	72 12                	jb     4d7c <free+0x35>
+    4d6a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    4d6d:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    4d70:	72 24                	jb     4d96 <free+0x4f>
+    4d72:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4d75:	8b 00                	mov    (%eax),%eax
+    4d77:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    4d7a:	72 1a                	jb     4d96 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4d7c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4d7f:	8b 00                	mov    (%eax),%eax
+    4d81:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    4d84:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    4d87:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    4d8a:	73 d4                	jae    4d60 <free+0x19>
+    4d8c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4d8f:	8b 00                	mov    (%eax),%eax
+    4d91:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    4d94:	73 ca                	jae    4d60 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    4d96:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    4d99:	8b 40 04             	mov    0x4(%eax),%eax
+    4d9c:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    4da3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    4da6:	01 c2                	add    %eax,%edx
+    4da8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4dab:	8b 00                	mov    (%eax),%eax
+    4dad:	39 c2                	cmp    %eax,%edx
+    4daf:	75 24                	jne    4dd5 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+    4db1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    4db4:	8b 50 04             	mov    0x4(%eax),%edx
+    4db7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4dba:	8b 00                	mov    (%eax),%eax
+    4dbc:	8b 40 04             	mov    0x4(%eax),%eax
+    4dbf:	01 c2                	add    %eax,%edx
+    4dc1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    4dc4:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    4dc7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4dca:	8b 00                	mov    (%eax),%eax
+    4dcc:	8b 10                	mov    (%eax),%edx
+    4dce:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    4dd1:	89 10                	mov    %edx,(%eax)
+    4dd3:	eb 0a                	jmp    4ddf <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+    4dd5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4dd8:	8b 10                	mov    (%eax),%edx
+    4dda:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    4ddd:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+    4ddf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4de2:	8b 40 04             	mov    0x4(%eax),%eax
+    4de5:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    4dec:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4def:	01 d0                	add    %edx,%eax
+    4df1:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    4df4:	75 20                	jne    4e16 <free+0xcf>
+    p->s.size += bp->s.size;
+    4df6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4df9:	8b 50 04             	mov    0x4(%eax),%edx
+    4dfc:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    4dff:	8b 40 04             	mov    0x4(%eax),%eax
+    4e02:	01 c2                	add    %eax,%edx
+    4e04:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4e07:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+    4e0a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    4e0d:	8b 10                	mov    (%eax),%edx
+    4e0f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4e12:	89 10                	mov    %edx,(%eax)
+    4e14:	eb 08                	jmp    4e1e <free+0xd7>
+  } else
+    p->s.ptr = bp;
+    4e16:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4e19:	8b 55 f8             	mov    -0x8(%ebp),%edx
+    4e1c:	89 10                	mov    %edx,(%eax)
+  freep = p;
+    4e1e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4e21:	a3 28 76 00 00       	mov    %eax,0x7628
+}
+    4e26:	90                   	nop
+    4e27:	c9                   	leave
+    4e28:	c3                   	ret
+
+00004e29 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    4e29:	55                   	push   %ebp
+    4e2a:	89 e5                	mov    %esp,%ebp
+    4e2c:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    4e2f:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+    4e36:	77 07                	ja     4e3f <morecore+0x16>
+    nu = 4096;
+    4e38:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+    4e3f:	8b 45 08             	mov    0x8(%ebp),%eax
+    4e42:	c1 e0 03             	shl    $0x3,%eax
+    4e45:	83 ec 0c             	sub    $0xc,%esp
+    4e48:	50                   	push   %eax
+    4e49:	e8 0f fc ff ff       	call   4a5d <sbrk>
+    4e4e:	83 c4 10             	add    $0x10,%esp
+    4e51:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+    4e54:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+    4e58:	75 07                	jne    4e61 <morecore+0x38>
+    return 0;
+    4e5a:	b8 00 00 00 00       	mov    $0x0,%eax
+    4e5f:	eb 26                	jmp    4e87 <morecore+0x5e>
+  hp = (Header*)p;
+    4e61:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4e64:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+    4e67:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4e6a:	8b 55 08             	mov    0x8(%ebp),%edx
+    4e6d:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+    4e70:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4e73:	83 c0 08             	add    $0x8,%eax
+    4e76:	83 ec 0c             	sub    $0xc,%esp
+    4e79:	50                   	push   %eax
+    4e7a:	e8 c8 fe ff ff       	call   4d47 <free>
+    4e7f:	83 c4 10             	add    $0x10,%esp
+  return freep;
+    4e82:	a1 28 76 00 00       	mov    0x7628,%eax
+}
+    4e87:	c9                   	leave
+    4e88:	c3                   	ret
+
+00004e89 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    4e89:	55                   	push   %ebp
+    4e8a:	89 e5                	mov    %esp,%ebp
+    4e8c:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    4e8f:	8b 45 08             	mov    0x8(%ebp),%eax
+    4e92:	83 c0 07             	add    $0x7,%eax
+    4e95:	c1 e8 03             	shr    $0x3,%eax
+    4e98:	83 c0 01             	add    $0x1,%eax
+    4e9b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+    4e9e:	a1 28 76 00 00       	mov    0x7628,%eax
+    4ea3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    4ea6:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    4eaa:	75 23                	jne    4ecf <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+    4eac:	c7 45 f0 20 76 00 00 	movl   $0x7620,-0x10(%ebp)
+    4eb3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4eb6:	a3 28 76 00 00       	mov    %eax,0x7628
+    4ebb:	a1 28 76 00 00       	mov    0x7628,%eax
+    4ec0:	a3 20 76 00 00       	mov    %eax,0x7620
+    base.s.size = 0;
+    4ec5:	c7 05 24 76 00 00 00 	movl   $0x0,0x7624
+    4ecc:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4ecf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4ed2:	8b 00                	mov    (%eax),%eax
+    4ed4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    4ed7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4eda:	8b 40 04             	mov    0x4(%eax),%eax
+    4edd:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+    4ee0:	72 4d                	jb     4f2f <malloc+0xa6>
+      if(p->s.size == nunits)
+    4ee2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4ee5:	8b 40 04             	mov    0x4(%eax),%eax
+    4ee8:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    4eeb:	75 0c                	jne    4ef9 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+    4eed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4ef0:	8b 10                	mov    (%eax),%edx
+    4ef2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4ef5:	89 10                	mov    %edx,(%eax)
+    4ef7:	eb 26                	jmp    4f1f <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+    4ef9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4efc:	8b 40 04             	mov    0x4(%eax),%eax
+    4eff:	2b 45 ec             	sub    -0x14(%ebp),%eax
+    4f02:	89 c2                	mov    %eax,%edx
+    4f04:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4f07:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+    4f0a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4f0d:	8b 40 04             	mov    0x4(%eax),%eax
+    4f10:	c1 e0 03             	shl    $0x3,%eax
+    4f13:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+    4f16:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4f19:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    4f1c:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+    4f1f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4f22:	a3 28 76 00 00       	mov    %eax,0x7628
+      return (void*)(p + 1);
+    4f27:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4f2a:	83 c0 08             	add    $0x8,%eax
+    4f2d:	eb 3b                	jmp    4f6a <malloc+0xe1>
+    }
+    if(p == freep)
+    4f2f:	a1 28 76 00 00       	mov    0x7628,%eax
+    4f34:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    4f37:	75 1e                	jne    4f57 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+    4f39:	83 ec 0c             	sub    $0xc,%esp
+    4f3c:	ff 75 ec             	push   -0x14(%ebp)
+    4f3f:	e8 e5 fe ff ff       	call   4e29 <morecore>
+    4f44:	83 c4 10             	add    $0x10,%esp
+    4f47:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    4f4a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    4f4e:	75 07                	jne    4f57 <malloc+0xce>
+        return 0;
+    4f50:	b8 00 00 00 00       	mov    $0x0,%eax
+    4f55:	eb 13                	jmp    4f6a <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4f57:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4f5a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    4f5d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4f60:	8b 00                	mov    (%eax),%eax
+    4f62:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    4f65:	e9 6d ff ff ff       	jmp    4ed7 <malloc+0x4e>
+  }
+}
+    4f6a:	c9                   	leave
+    4f6b:	c3                   	ret
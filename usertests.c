@@ -184,59 +184,77 @@ writetest(void)
   printf(stdout, "small file test ok\n");
 }
 
+// Two processes write big files at the same time, in writes
+// of 16 blocks, so that filewrite has to split each into several
+// transactions, which share the log with the other process's.
+// The files are large enough to reach the double indirect block.
+#define BIGBUF    (16 * BSIZE)
+#define BIGWRITES ((NDIRECT + NINDIRECT + 16) / 16 * BIGBUF / 512 + BIGBUF / 512)
+
+char bigbuf[BIGBUF];
+
 void
 writetest1(void)
 {
-  int i, fd, n;
+  char *names[] = { "big0", "big1" };
+  int i, j, fd, n, pi;
 
   printf(stdout, "big files test\n");
 
-  fd = open("big", O_CREATE|O_RDWR);
-  if(fd < 0){
-    printf(stdout, "error: creat big failed!\n");
+  for(pi = 0; pi < 2; pi++){
+    if(fork() != 0)
+      continue;
+    fd = open(names[pi], O_CREATE|O_RDWR);
+    if(fd < 0){
+      printf(stdout, "error: creat %s failed!\n", names[pi]);
+      exit();
+    }
+    for(i = 0; i < BIGWRITES; i += BIGBUF / 512){
+      for(j = 0; j < BIGBUF / 512; j++)
+        ((int*)(bigbuf + j*512))[0] = i + j;
+      if(write(fd, bigbuf, BIGBUF) != BIGBUF){
+        printf(stdout, "error: write big file failed\n", i);
+        exit();
+      }
+    }
+    close(fd);
     exit();
   }
+  wait();
+  wait();
 
-  for(i = 0; i < MAXFILE; i++){
-    ((int*)buf)[0] = i;
-    if(write(fd, buf, 512) != 512){
-      printf(stdout, "error: write big file failed\n", i);
+  for(pi = 0; pi < 2; pi++){
+    fd = open(names[pi], O_RDONLY);
+    if(fd < 0){
+      printf(stdout, "error: open %s failed!\n", names[pi]);
       exit();
     }
-  }
 
-  close(fd);
-
-  fd = open("big", O_RDONLY);
-  if(fd < 0){
-    printf(stdout, "error: open big failed!\n");
-    exit();
-  }
-
-  n = 0;
-  for(;;){
-    i = read(fd, buf, 512);
-    if(i == 0){
-      if(n == MAXFILE - 1){
-        printf(stdout, "read only %d blocks from big", n);
+    n = 0;
+    for(;;){
+      i = read(fd, buf, 512);
+      if(i == 0){
+        if(n != BIGWRITES){
+          printf(stdout, "read only %d blocks from big", n);
+          exit();
+        }
+        break;
+      } else if(i != 512){
+        printf(stdout, "read failed %d\n", i);
         exit();
       }
-      break;
-    } else if(i != 512){
-      printf(stdout, "read failed %d\n", i);
-      exit();
+      if(((int*)buf)[0] != n){
+        printf(stdout, "read content of block %d is %d\n",
+               n, ((int*)buf)[0]);
+        exit();
+      }
+      n++;
     }
-    if(((int*)buf)[0] != n){
-      printf(stdout, "read content of block %d is %d\n",
-             n, ((int*)buf)[0]);
+    close(fd);
+    if(unlink(names[pi]) < 0){
+      printf(stdout, "unlink big failed\n");
       exit();
     }
-    n++;
-  }
-  close(fd);
-  if(unlink("big") < 0){
-    printf(stdout, "unlink big failed\n");
-    exit();
   }
   printf(stdout, "big files ok\n");
 }
@@ -579,6 +597,92 @@ fourfiles(void)
   printf(1, "fourfiles ok\n");
 }
 
+// four processes create small files in one directory, so that
+// they change its blocks, the inode blocks and the bitmap while
+// the previous transaction, which changed them too, commits;
+// a fifth keeps the log busy with large writes
+void
+groupcommit(void)
+{
+  enum { N = 40 };
+  char name[8];
+  int pid, i, fd, pi, n;
+
+  printf(1, "groupcommit test\n");
+  if(mkdir("gc") < 0){
+    printf(1, "groupcommit: mkdir failed\n");
+    exit();
+  }
+
+  for(pi = 0; pi < 5; pi++){
+    pid = fork();
+    if(pid < 0){
+      printf(1, "fork failed\n");
+      exit();
+    }
+    if(pid > 0)
+      continue;
+
+    if(pi == 4){
+      fd = open("gc/big", O_CREATE|O_RDWR);
+      for(i = 0; i < 40; i++){
+        if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+          printf(1, "groupcommit: write big failed\n");
+          exit();
+        }
+      }
+      close(fd);
+      exit();
+    }
+
+    name[0] = 'g';
+    name[1] = 'c';
+    name[2] = '/';
+    name[3] = 'p' + pi;
+    name[6] = '\0';
+    for(i = 0; i < N; i++){
+      name[4] = '0' + i / 10;
+      name[5] = '0' + i % 10;
+      fd = open(name, O_CREATE|O_RDWR);
+      if(fd < 0 || write(fd, name, sizeof(name)) != sizeof(name)){
+        printf(1, "groupcommit: create %s failed\n", name);
+        exit();
+      }
+      close(fd);
+    }
+    exit();
+  }
+
+  for(pi = 0; pi < 5; pi++)
+    wait();
+
+  for(pi = 0; pi < 4; pi++){
+    name[0] = 'g';
+    name[1] = 'c';
+    name[2] = '/';
+    name[3] = 'p' + pi;
+    name[6] = '\0';
+    for(i = 0; i < N; i++){
+      name[4] = '0' + i / 10;
+      name[5] = '0' + i % 10;
+      fd = open(name, O_RDONLY);
+      if(fd < 0 || (n = read(fd, buf, sizeof(buf))) != sizeof(name) ||
+         strcmp(buf, name) != 0){
+        printf(1, "groupcommit: %s is missing or wrong\n", name);
+        exit();
+      }
+      close(fd);
+      unlink(name);
+    }
+  }
+  unlink("gc/big");
+  if(unlink("gc") < 0){
+    printf(1, "groupcommit: unlink gc failed\n");
+    exit();
+  }
+  printf(1, "groupcommit ok\n");
+}
+
 // four processes create and delete different files in same directory
 void
 createdelete(void)
@@ -931,6 +1035,92 @@ bigdir(void)
   printf(1, "bigdir ok\n");
 }
 
+#define NDX 2000
+
+static void
+dxname(char *name, int i)
+{
+  name[0] = 'd';
+  name[1] = 'x';
+  name[2] = '/';
+  name[3] = 'a' + i / 676;
+  name[4] = 'a' + i / 26 % 26;
+  name[5] = 'a' + i % 26;
+  name[6] = '\0';
+}
+
+// Open the first n names in dx: all of them, or the odd ones
+// only, and check that the others are gone.
+static void
+dxcheck(int n, int all)
+{
+  char name[8];
+  int i, fd;
+
+  for(i = 0; i < n; i++){
+    dxname(name, i);
+    fd = open(name, O_RDONLY);
+    if((fd >= 0) != (all || i % 2 == 1)){
+      printf(1, "dirindex: lookup of %s %s\n", name, fd < 0 ? "failed" : "succeeded");
+      exit();
+    }
+    if(fd >= 0)
+      close(fd);
+  }
+}
+
+// lookups in a directory that is searched linearly, and in
+// one large enough to be hashed and split
+void
+dirindex(void)
+{
+  char name[8];
+  int i, fd;
+
+  printf(1, "dirindex test\n");
+  if(mkdir("dx") < 0){
+    printf(1, "dirindex: mkdir failed\n");
+    exit();
+  }
+  fd = open("dx/f", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(1, "dirindex: create failed\n");
+    exit();
+  }
+  close(fd);
+
+  for(i = 0; i < NDX; i++){
+    dxname(name, i);
+    if(link("dx/f", name) != 0){
+      printf(1, "dirindex: link %s failed\n", name);
+      exit();
+    }
+    if(i == 50)
+      dxcheck(i + 1, 1);  // still one block
+  }
+  dxcheck(NDX, 1);
+
+  for(i = 0; i < NDX; i += 2){
+    dxname(name, i);
+    if(unlink(name) != 0){
+      printf(1, "dirindex: unlink %s failed\n", name);
+      exit();
+    }
+  }
+  dxcheck(NDX, 0);
+
+  for(i = 1; i < NDX; i += 2){
+    dxname(name, i);
+    unlink(name);
+  }
+  unlink("dx/f");
+  if(unlink("dx") != 0){
+    printf(1, "dirindex: unlink dx failed\n");
+    exit();
+  }
+  printf(1, "dirindex ok\n");
+}
+
 void
 subdir(void)
 {
@@ -1761,6 +1951,7 @@ main(int argc, char *argv[])
   linkunlink();
   concreate();
   fourfiles();
+  groupcommit();
   sharedfd();
 
   bigargtest();
@@ -1794,6 +1985,7 @@ main(int argc, char *argv[])
   iref();
   forktest();
   bigdir(); // slow
+  dirindex(); // slow
 
   uio();
 
@@ -4,6 +4,7 @@
  *mostly taken from ulib
  */
 #include "types.h"
+#include "x86.h"
 #include "util.h"
 
 int
@@ -25,3 +26,67 @@ strcmp(const char *p, const char *q)
     p++, q++;
   return (uchar)*p - (uchar)*q;
 }
+
+// 64-bit unsigned division for code built without libgcc.
+// Returns n/d and stores n%d in *rem if rem is non-zero.
+uint64_t
+udiv64(uint64_t n, uint64_t d, uint64_t *rem)
+{
+  uint64_t q, r;
+  int i;
+
+  q = r = 0;
+  for(i = 63; i >= 0; i--){
+    r = (r << 1) | ((n >> i) & 1);
+    if(r >= d){
+      r -= d;
+      q |= (uint64_t)1 << i;
+    }
+  }
+  if(rem)
+    *rem = r;
+  return q;
+}
+
+#define CRC32C_POLY 0x82f63b78  // Castagnoli, bit reversed
+#define CPUID_SSE42 (1 << 20)   // cpuid leaf 1, ecx
+
+static uint crc32ctab[256];
+static int crc32chw = -1;       // the CPU has the crc32 instruction
+
+static void
+crc32cinit(void)
+{
+  uint a, b, c, d, i, j, r;
+
+  for(i = 0; i < 256; i++){
+    r = i;
+    for(j = 0; j < 8; j++)
+      r = (r >> 1) ^ ((r & 1) ? CRC32C_POLY : 0);
+    crc32ctab[i] = r;
+  }
+  cpuinfo(1, &a, &b, &c, &d);
+  crc32chw = (c & CPUID_SSE42) != 0;
+}
+
+// CRC-32C of n bytes at p, continuing from crc (0 to start).
+// Uses the SSE4.2 crc32 instruction when the CPU has it.
+uint
+crc32c(uint crc, const void *p, uint n)
+{
+  const uchar *s = p;
+
+  if(crc32chw < 0)
+    crc32cinit();
+  crc = ~crc;
+  if(crc32chw){
+    for(; n >= 4; n -= 4, s += 4)
+      asm("crc32l %1, %0" : "+r" (crc) : "rm" (*(const uint*)s));
+    for(; n > 0; n--, s++)
+      asm("crc32b %1, %0" : "+r" (crc) : "qm" (*s));
+  } else {
+    for(; n > 0; n--, s++)
+      crc = crc32ctab[(crc ^ *s) & 0xff] ^ (crc >> 8);
+  }
+  return ~crc;
+}
@@ -8,5 +8,7 @@
 
 int atoi(const char*);
 int strcmp(const char*, const char*);
+uint64_t udiv64(uint64_t, uint64_t, uint64_t*);
+uint crc32c(uint, const void*, uint);
 
 #endif
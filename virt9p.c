@@ -0,0 +1,477 @@
+/*
+ * Client for a 9P2000.L file server behind a virtio 9p transport, such
+ * as the host directory qemu exports with
+ *   -virtfs local,path=DIR,mount_tag=host0,security_model=none
+ *
+ * xv6 has one file system and no mount table, so the export is not
+ * grafted into the name space. hostopen() walks a path from the root
+ * of the export instead and returns a read-only file descriptor, which
+ * read and close treat like any other (FD_HOST in file.c).
+ *
+ * Every operation is one request and its reply. The device reads the
+ * request from a page and writes the reply straight into up to
+ * P9_NRPAGE pages, which is what bounds msize. Processes have their
+ * requests on the ring at the same time; each waits for the reply under
+ * its own buffer id, which is also the request's tag.
+ */
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "memlayout.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "pci.h"
+#include "virtio.h"
+#include "virt9p.h"
+
+struct p9req {
+    int done;
+    uint32 len;     // of the reply
+};
+
+static struct {
+    struct virtio_device* dev;  // 0 if there is no 9p device
+    struct p9req* reqs;         // one per buffer id of the request queue
+    struct sleeplock attachlock;
+    int attached;               // version and attach are done
+    uint32 msize;
+    struct spinlock lock;       // protects fids
+    uchar fids[NP9FID];         // fid in use
+} p9;
+
+static uchar* put16(uchar* p, uint v) { p[0] = v; p[1] = v >> 8; return p + 2; }
+static uchar* put32(uchar* p, uint v) { put16(p, v); put16(p + 2, v >> 16); return p + 4; }
+static uint get16(uchar* p) { return p[0] | (p[1] << 8); }
+static uint get32(uchar* p) { return get16(p) | (get16(p + 2) << 16); }
+
+static uchar* put64(uchar* p, uint64 v)
+{
+    put32(p, (uint)v);
+    return put32(p + 4, (uint)(v >> 32));
+}
+
+static uchar* putstr(uchar* p, char* s, int n)
+{
+    p = put16(p, n);
+    memmove(p, s, n);
+    return p + n;
+}
+
+// Start a message of the given type in page t. Returns where its
+// body goes.
+static uchar* begin(char* t, int type)
+{
+    uchar* p = (uchar*)t;
+
+    p[4] = type;
+    put16(p + 5, P9_NOTAG);
+    return p + P9_HDRSZ;
+}
+
+// Finish the message in page t that ends at end.
+static void finish(char* t, uchar* end)
+{
+    put32((uchar*)t, end - (uchar*)t);
+}
+
+static void freepages(char* t, char** r, int nr)
+{
+    if (t) {
+        kfree(t);
+    }
+    for (int i = 0; i < nr; i++) {
+        if (r[i]) {
+            kfree(r[i]);
+        }
+    }
+}
+
+// Allocate a request page and nr reply pages. Returns -1 if there is
+// no memory.
+static int allocpages(char** t, char** r, int nr)
+{
+    int ok = (*t = kalloc()) != 0;
+
+    for (int i = 0; i < nr; i++) {
+        if ((r[i] = kalloc()) == 0) {
+            ok = 0;
+        }
+    }
+    if (!ok) {
+        freepages(*t, r, nr);
+        return -1;
+    }
+    return 0;
+}
+
+/*
+ * Sends the request in page t and waits for the reply, which the device
+ * writes into the pages r[0..nr-1]. Returns the length of the reply, or
+ * -1 if the server answered with an error.
+ */
+static int rpc(char* t, char** r, int nr)
+{
+    struct virt_queue* vq = &p9.dev->queues[0];
+    struct virtq_desc desc[1 + P9_NRPAGE];
+    struct p9req* req;
+    uint32 len;
+
+    desc[0].addr = V2P(t);
+    desc[0].len = get32((uchar*)t);
+    desc[0].flags = 0;
+    for (int i = 0; i < nr; i++) {
+        desc[1 + i].addr = V2P(r[i]);
+        desc[1 + i].len = PGSIZE;
+        desc[1 + i].flags = VIRTQ_DESC_F_WRITE;
+    }
+
+    acquire(&vq->lock);
+    while (vq->num_free < 1 + nr) {
+        sleep(vq, &vq->lock);
+    }
+
+    // Tversion goes out untagged, see begin.
+    if ((uchar)t[4] != P9_TVERSION) {
+        put16((uchar*)t + 5, vq->free_head);
+    }
+    req = &p9.reqs[vq->free_head];
+    req->done = 0;
+
+    if (virtio_post(p9.dev, 0, desc, 1 + nr) < 0) {
+        panic("virtio-9p: post");
+    }
+    virtio_kick(p9.dev, 0);
+
+    while (!req->done) {
+        sleep(req, &vq->lock);
+    }
+    len = req->len;
+    release(&vq->lock);
+
+    if (len < P9_HDRSZ || (uchar)r[0][4] == P9_RLERROR) {
+        return -1;
+    }
+    return len;
+}
+
+// Negotiate the protocol and attach fid 0 to the root of the export.
+// Caller holds attachlock.
+static int attach(void)
+{
+    char *t, *r[1];
+    uchar* p;
+    int len, ok;
+
+    if (allocpages(&t, r, 1) < 0) {
+        return -1;
+    }
+
+    p = begin(t, P9_TVERSION);
+    p = put32(p, P9_MSIZE);
+    p = putstr(p, "9P2000.L", 8);
+    finish(t, p);
+    len = rpc(t, r, 1);
+    p = (uchar*)r[0];
+    ok = len >= P9_HDRSZ + 14 && p[4] == P9_RVERSION && get16(p + 11) == 8 &&
+         memcmp(p + 13, "9P2000.L", 8) == 0;
+    if (!ok) {
+        cprintf("virtio-9p: server doesn't speak 9P2000.L\n");
+        freepages(t, r, 1);
+        return -1;
+    }
+    p9.msize = get32(p + 7);
+    if (p9.msize > P9_MSIZE) {
+        p9.msize = P9_MSIZE;
+    }
+
+    p = begin(t, P9_TATTACH);
+    p = put32(p, 0);            // fid
+    p = put32(p, P9_NOFID);     // afid, no authentication
+    p = putstr(p, "root", 4);   // uname
+    p = putstr(p, "", 0);       // aname, the exported directory
+    p = put32(p, 0);            // n_uname
+    finish(t, p);
+    ok = rpc(t, r, 1) >= 0 && (uchar)r[0][4] == P9_RATTACH;
+
+    freepages(t, r, 1);
+    return ok ? 0 : -1;
+}
+
+static int fidalloc(void)
+{
+    int fid;
+
+    acquire(&p9.lock);
+    for (fid = 1; fid < NP9FID; fid++) {
+        if (!p9.fids[fid]) {
+            p9.fids[fid] = 1;
+            release(&p9.lock);
+            return fid;
+        }
+    }
+    release(&p9.lock);
+    return -1;
+}
+
+static void fidfree(int fid)
+{
+    acquire(&p9.lock);
+    p9.fids[fid] = 0;
+    release(&p9.lock);
+}
+
+// Tell the server we are done with fid.
+static void clunk(int fid, char* t, char** r)
+{
+    uchar* p = begin(t, P9_TCLUNK);
+
+    p = put32(p, fid);
+    finish(t, p);
+    rpc(t, r, 1);
+}
+
+/*
+ * Opens the file at path, relative to the root of the export, for
+ * reading. Returns its fid, or -1 if there is no 9p device or the
+ * server can't open it.
+ */
+int virt9p_open(char* path)
+{
+    char *t, *r[1];
+    uchar *p, *nwname;
+    char* name;
+    int fid, n, len;
+
+    if (p9.dev == 0) {
+        return -1;
+    }
+
+    acquiresleep(&p9.attachlock);
+    if (!p9.attached && attach() == 0) {
+        p9.attached = 1;
+    }
+    releasesleep(&p9.attachlock);
+    if (!p9.attached) {
+        return -1;
+    }
+
+    if ((fid = fidalloc()) < 0) {
+        return -1;
+    }
+    if (allocpages(&t, r, 1) < 0) {
+        fidfree(fid);
+        return -1;
+    }
+
+    // Walk from the root to the file in one go.
+    p = begin(t, P9_TWALK);
+    p = put32(p, 0);
+    p = put32(p, fid);
+    nwname = p;
+    p += 2;
+    n = 0;
+    while (*path) {
+        while (*path == '/') {
+            path++;
+        }
+        name = path;
+        while (*path && *path != '/') {
+            path++;
+        }
+        len = path - name;
+        if (len == 0 || (len == 1 && name[0] == '.')) {
+            continue;
+        }
+        if (n == P9_MAXWELEM || len > 255) {
+            goto bad;
+        }
+        p = putstr(p, name, len);
+        n++;
+    }
+    put16(nwname, n);
+    finish(t, p);
+
+    // A walk that doesn't get all the way leaves the new fid unused.
+    if (rpc(t, r, 1) < 0 || (uchar)r[0][4] != P9_RWALK || get16((uchar*)r[0] + 7) != n) {
+        goto bad;
+    }
+
+    p = begin(t, P9_TLOPEN);
+    p = put32(p, fid);
+    p = put32(p, 0);            // O_RDONLY
+    finish(t, p);
+    if (rpc(t, r, 1) < 0 || (uchar)r[0][4] != P9_RLOPEN) {
+        clunk(fid, t, r);
+        goto bad;
+    }
+
+    freepages(t, r, 1);
+    return fid;
+
+bad:
+    freepages(t, r, 1);
+    fidfree(fid);
+    return -1;
+}
+
+/*
+ * Reads up to n bytes at offset off of the file open as fid into dst.
+ * Returns the number of bytes read, 0 at the end of the file, or -1.
+ */
+int virt9p_read(int fid, uint off, char* dst, int n)
+{
+    char *t, *r[P9_NRPAGE];
+    uchar* p;
+    uint count, got, at, m;
+    int nr;
+
+    if (n <= 0) {
+        return 0;
+    }
+    count = p9.msize - P9_IOHDRSZ;
+    if (n < count) {
+        count = n;
+    }
+
+    // The reply is 11 bytes of header followed by the data.
+    nr = (P9_HDRSZ + 4 + count + PGSIZE - 1) / PGSIZE;
+    if (allocpages(&t, r, nr) < 0) {
+        return -1;
+    }
+
+    p = begin(t, P9_TREAD);
+    p = put32(p, fid);
+    p = put64(p, off);
+    p = put32(p, count);
+    finish(t, p);
+
+    if (rpc(t, r, nr) < 0 || (uchar)r[0][4] != P9_RREAD) {
+        freepages(t, r, nr);
+        return -1;
+    }
+    got = get32((uchar*)r[0] + P9_HDRSZ);
+    if (got > count) {
+        got = count;
+    }
+
+    // Copy the data out of the reply pages.
+    at = P9_HDRSZ + 4;
+    for (m = 0; m < got; ) {
+        uint k = PGSIZE - at % PGSIZE;
+        if (k > got - m) {
+            k = got - m;
+        }
+        memmove(dst + m, r[at / PGSIZE] + at % PGSIZE, k);
+        at += k;
+        m += k;
+    }
+
+    freepages(t, r, nr);
+    return got;
+}
+
+/*
+ * Closes the file open as fid.
+ */
+void virt9p_close(int fid)
+{
+    char *t, *r[1];
+
+    if (allocpages(&t, r, 1) == 0) {
+        clunk(fid, t, r);
+        freepages(t, r, 1);
+    }
+    fidfree(fid);
+}
+
+/*
+ * Interrupt handler for the 9p device. Hands the replies to the
+ * processes waiting for them.
+ */
+void virt9p_intr(struct virtio_device* dev)
+{
+    struct virt_queue* vq = &dev->queues[0];
+    int done = 0;
+    uint16 id;
+    uint32 len;
+
+    if ((virtio_isr(dev) & 1) == 0) {
+        return;
+    }
+
+    acquire(&vq->lock);
+    while (virtio_next_used(vq, &id, &len)) {
+        p9.reqs[id].len = len;
+        p9.reqs[id].done = 1;
+        wakeup(&p9.reqs[id]);
+        done++;
+    }
+
+    if (done) {
+        wakeup(vq);
+    }
+    release(&vq->lock);
+}
+
+void virt9p_negotiate(uint64_t *features)
+{
+    DISABLE_FEATURE(*features, VIRTIO_F_EVENT_IDX);
+}
+
+int virt9p_init(struct virtio_device* dev)
+{
+    struct virt_queue* vq = &dev->queues[0];
+    volatile struct virtio_9p_config* cfg = virtio_device_cfg(dev);
+
+    if (p9.dev != 0) {
+        cprintf("virtio-9p: only one export is supported\n");
+        return -1;
+    }
+
+    if (vq->queue_size < 1 + P9_NRPAGE) {
+        cprintf("virtio-9p: request queue too small\n");
+        return -1;
+    }
+
+    p9.reqs = (struct p9req*)kallocn(PGROUNDUP(vq->queue_size * sizeof(struct p9req)) / PGSIZE);
+    if (p9.reqs == 0) {
+        cprintf("virtio-9p: no memory for %d requests\n", vq->queue_size);
+        return -1;
+    }
+
+    char tag[32];
+    int n = 0;
+    if (HAS_FEATURE(dev->features, VIRTIO_9P_F_MOUNT_TAG)) {
+        for (; n < cfg->tag_len && n < sizeof(tag) - 1; n++) {
+            tag[n] = cfg->tag[n];
+        }
+    }
+    tag[n] = 0;
+    cprintf("virtio-9p: export %s\n", tag);
+
+    initsleeplock(&p9.attachlock, "9p");
+    initlock(&p9.lock, "9pfid");
+    p9.fids[0] = 1;
+
+    virtio_enable_intr(vq);
+    dev->intr = &virt9p_intr;
+    picenable(dev->irq);
+    ioapicenable(dev->irq, 0);
+
+    p9.dev = dev;
+
+    return 0;
+}
+
+/*
+ * Registers the driver with the virtio core, which calls virt9p_init
+ * for the 9p device it finds.
+ */
+void virt9pinit(void)
+{
+    virtio_drivers[NINEP_TRANSPORT].name = "virtio-9p";
+    virtio_drivers[NINEP_TRANSPORT].negotiate = &virt9p_negotiate;
+    virtio_drivers[NINEP_TRANSPORT].init = &virt9p_init;
+}
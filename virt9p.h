@@ -0,0 +1,46 @@
+#ifndef __XV6_VIRT9P_H__
+#define __XV6_VIRT9P_H__
+
+#include "types.h"
+
+/* The feature bitmap for virtio 9p */
+#define VIRTIO_9P_F_MOUNT_TAG   0   /* The config space holds a mount tag */
+
+/* Device specific configuration */
+struct virtio_9p_config {
+    uint16 tag_len;
+    char tag[];
+} __attribute__((packed));
+
+/* 9P2000.L message types we use */
+#define P9_RLERROR      7
+#define P9_TLOPEN       12
+#define P9_RLOPEN       13
+#define P9_TVERSION     100
+#define P9_RVERSION     101
+#define P9_TATTACH      104
+#define P9_RATTACH      105
+#define P9_TWALK        110
+#define P9_RWALK        111
+#define P9_TREAD        116
+#define P9_RREAD        117
+#define P9_TCLUNK       120
+#define P9_RCLUNK       121
+
+#define P9_NOTAG        0xffff
+#define P9_NOFID        0xffffffff
+#define P9_MAXWELEM     16      /* names in one Twalk */
+
+#define P9_HDRSZ        7       /* size[4] type[1] tag[2] */
+#define P9_IOHDRSZ      24      /* room msize leaves for a read reply's header */
+
+/*
+ * A reply goes into up to P9_NRPAGE pages, so that with the page of the
+ * request the chain fits one indirect table.
+ */
+#define P9_NRPAGE       7
+#define P9_MSIZE        (P9_NRPAGE * 4096)
+
+#define NP9FID          64      /* open host files, fid 0 is the root */
+
+#endif
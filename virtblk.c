@@ -0,0 +1,236 @@
+/*
+ * Disk driver for a virtio block device.
+ *
+ * If the machine has one it replaces the IDE disk 1, the file system
+ * disk: iderwv hands it every batch of buffers for that disk. A request
+ * is a chain of three buffers, its header, the buffer cache block, which
+ * the device reads or writes in place, and a status byte. All requests
+ * of a batch, and of every process that waits for the disk, are on the
+ * ring at the same time, and the device may finish them in any order.
+ */
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "memlayout.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+#include "pci.h"
+#include "virtio.h"
+#include "virtblk.h"
+
+#define SECTOR_SIZE 512
+
+/*
+ * The header and status byte of a request have to stay put while it is
+ * in flight, the request with buffer id i keeps them in reqs[i].
+ */
+struct blkreq {
+    struct virtio_blk_req hdr;
+    uint8 status;
+    struct buf* b;
+};
+
+static struct {
+    struct virtio_device* dev;  // 0 if there is no virtio disk
+    struct blkreq* reqs;        // one per buffer id of the request queue
+    uint64 capacity;            // in sectors
+} blk;
+
+/*
+ * Feature negotiation for a block device.
+ *
+ * Without VIRTIO_BLK_F_FLUSH the device has to write through its cache,
+ * which is what the log expects of the disk.
+ */
+void virtioblk_negotiate(uint64_t *features)
+{
+    DISABLE_FEATURE(*features, VIRTIO_BLK_F_FLUSH);
+    DISABLE_FEATURE(*features, VIRTIO_BLK_F_CONFIG_WCE);
+    DISABLE_FEATURE(*features, VIRTIO_BLK_F_MQ);
+    DISABLE_FEATURE(*features, VIRTIO_BLK_F_DISCARD);
+    DISABLE_FEATURE(*features, VIRTIO_BLK_F_WRITE_ZEROES);
+    DISABLE_FEATURE(*features, VIRTIO_F_EVENT_IDX);
+}
+
+/*
+ * Interrupt handler for the block device. Marks the buffers of the
+ * finished requests and wakes up their processes and any process
+ * waiting for room on the ring.
+ */
+void virtioblk_intr(struct virtio_device* dev)
+{
+    struct virt_queue* vq = &dev->queues[0];
+    struct blkreq* r;
+    int done = 0;
+    uint16 id;
+    uint32 len;
+
+    if ((virtio_isr(dev) & 1) == 0) {
+        return;
+    }
+
+    acquire(&vq->lock);
+    while (virtio_next_used(vq, &id, &len)) {
+        r = &blk.reqs[id];
+        if (r->status != VIRTIO_BLK_S_OK) {
+            panic("virtio-blk: I/O error");
+        }
+
+        biodone(r->b);
+        done++;
+    }
+
+    if (done) {
+        wakeup(vq);
+    }
+    release(&vq->lock);
+}
+
+int virtioblk_init(struct virtio_device* dev)
+{
+    struct virt_queue* vq = &dev->queues[0];
+    volatile struct virtio_blk_config* cfg = virtio_device_cfg(dev);
+
+    if (blk.dev != 0) {
+        cprintf("virtio-blk: only one disk is supported\n");
+        return -1;
+    }
+
+    if (vq->queue_size == 0) {
+        cprintf("virtio-blk: no request queue\n");
+        return -1;
+    }
+
+    if (HAS_FEATURE(dev->features, VIRTIO_BLK_F_RO)) {
+        cprintf("virtio-blk: disk is read-only\n");
+        return -1;
+    }
+
+    blk.reqs = (struct blkreq*)kallocn(PGROUNDUP(vq->queue_size * sizeof(struct blkreq)) / PGSIZE);
+    if (blk.reqs == 0) {
+        cprintf("virtio-blk: no memory for %d requests\n", vq->queue_size);
+        return -1;
+    }
+
+    blk.capacity = cfg->capacity;
+    cprintf("virtio-blk: %d sectors, %d descriptors\n", (uint32)blk.capacity, vq->queue_size);
+
+    virtio_enable_intr(vq);
+    dev->intr = &virtioblk_intr;
+    picenable(dev->irq);
+    ioapicenable(dev->irq, 0);
+
+    // From here on iderw sends disk 1 requests our way.
+    blk.dev = dev;
+
+    return 0;
+}
+
+/*
+ * Put the request chain for b on the ring, without notifying the
+ * device. Caller holds the queue lock.
+ */
+static void post(struct virtio_device* dev, struct buf* b)
+{
+    struct virt_queue* vq = &dev->queues[0];
+    struct virtq_desc desc[3];
+    struct blkreq* r;
+    uint64 sector;
+
+    sector = (uint64)b->blockno * (BSIZE / SECTOR_SIZE);
+    if (sector + BSIZE / SECTOR_SIZE > blk.capacity) {
+        panic("virtio-blk: block out of range");
+    }
+
+    // Wait for room for the chain, even if it would go into a single
+    // indirect slot. Chains posted so far must reach the device first,
+    // or no room would ever be freed.
+    while (vq->num_free < 3) {
+        virtio_kick(dev, 0);
+        sleep(vq, &vq->lock);
+    }
+
+    r = &blk.reqs[vq->free_head];
+    r->hdr.type = (b->flags & B_DIRTY) ? VIRTIO_BLK_T_OUT : VIRTIO_BLK_T_IN;
+    r->hdr.reserved = 0;
+    r->hdr.sector = sector;
+    r->status = 0xff;
+    r->b = b;
+
+    desc[0].addr = V2P(&r->hdr);
+    desc[0].len = sizeof(r->hdr);
+    desc[0].flags = 0;
+    desc[1].addr = V2P(b->data);
+    desc[1].len = BSIZE;
+    desc[1].flags = (b->flags & B_DIRTY) ? 0 : VIRTQ_DESC_F_WRITE;
+    desc[2].addr = V2P(&r->status);
+    desc[2].len = 1;
+    desc[2].flags = VIRTQ_DESC_F_WRITE;
+
+    if (virtio_post(dev, 0, desc, 3) < 0) {
+        panic("virtio-blk: post");
+    }
+}
+
+/*
+ * Sync n bufs with the virtio disk, like iderwv. They are sorted by
+ * block number, as the IDE elevator would, all posted, and the device
+ * is notified once; then we wait for all of them. Returns -1 if there
+ * is no virtio disk, otherwise 0 once the requests have finished, or
+ * for read-ahead (B_ASYNC), once they are on the ring.
+ */
+int virtioblk_rwv(struct buf** bufs, int n)
+{
+    struct virtio_device* dev = blk.dev;
+    struct virt_queue* vq;
+    struct buf* b;
+    int i, j, async;
+
+    if (dev == 0) {
+        return -1;
+    }
+    vq = &dev->queues[0];
+    async = n > 0 && (bufs[0]->flags & B_ASYNC);
+
+    for (i = 1; i < n; i++) {
+        b = bufs[i];
+        for (j = i; j > 0 && bufs[j-1]->blockno > b->blockno; j--) {
+            bufs[j] = bufs[j-1];
+        }
+        bufs[j] = b;
+    }
+
+    acquire(&vq->lock);
+
+    for (i = 0; i < n; i++) {
+        post(dev, bufs[i]);
+    }
+    virtio_kick(dev, 0);
+
+    // Wait for the requests to finish. Read-ahead bufs may already
+    // have been released by virtioblk_intr, so don't look at them.
+    for (i = 0; i < n && !async; i++) {
+        while ((bufs[i]->flags & (B_VALID|B_DIRTY)) != B_VALID) {
+            sleep(bufs[i], &vq->lock);
+        }
+    }
+
+    release(&vq->lock);
+
+    return 0;
+}
+
+/*
+ * Registers the driver with the virtio core, which calls virtioblk_init
+ * for the block device it finds.
+ */
+void virtioblkinit(void)
+{
+    virtio_drivers[BLOCK_DEVICE].name = "virtio-blk";
+    virtio_drivers[BLOCK_DEVICE].negotiate = &virtioblk_negotiate;
+    virtio_drivers[BLOCK_DEVICE].init = &virtioblk_init;
+}
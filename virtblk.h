@@ -0,0 +1,47 @@
+#ifndef __XV6_VIRTBLK_H__
+#define __XV6_VIRTBLK_H__
+
+#include "types.h"
+
+/* The feature bitmap for virtio blk */
+#define VIRTIO_BLK_F_SIZE_MAX       1   /* Largest segment is size_max */
+#define VIRTIO_BLK_F_SEG_MAX        2   /* At most seg_max segments per request */
+#define VIRTIO_BLK_F_GEOMETRY       4   /* Legacy geometry available */
+#define VIRTIO_BLK_F_RO             5   /* Device is read-only */
+#define VIRTIO_BLK_F_BLK_SIZE       6   /* Block size of disk is blk_size */
+#define VIRTIO_BLK_F_FLUSH          9   /* Cache flush command, write-back cache */
+#define VIRTIO_BLK_F_TOPOLOGY       10  /* Topology information available */
+#define VIRTIO_BLK_F_CONFIG_WCE     11  /* Writeback mode in the config space */
+#define VIRTIO_BLK_F_MQ             12  /* More than one request queue */
+#define VIRTIO_BLK_F_DISCARD        13  /* Discard command */
+#define VIRTIO_BLK_F_WRITE_ZEROES   14  /* Write zeroes command */
+
+/* Device specific configuration, virtio spec 1.0 5.2.4 */
+struct virtio_blk_config {
+    uint64 capacity;    /* in 512 byte sectors */
+    uint32 size_max;
+    uint32 seg_max;
+    struct {
+        uint16 cylinders;
+        uint8 heads;
+        uint8 sectors;
+    } geometry;
+    uint32 blk_size;
+} __attribute__((packed));
+
+/* The device reads this at the start of every request, 5.2.6 */
+struct virtio_blk_req {
+#define VIRTIO_BLK_T_IN     0
+#define VIRTIO_BLK_T_OUT    1
+#define VIRTIO_BLK_T_FLUSH  4
+    uint32 type;
+    uint32 reserved;
+    uint64 sector;
+};
+
+/* and writes one of these into the byte at the end of it */
+#define VIRTIO_BLK_S_OK      0
+#define VIRTIO_BLK_S_IOERR   1
+#define VIRTIO_BLK_S_UNSUPP  2
+
+#endif
@@ -0,0 +1,173 @@
+/*
+ * Console output through a virtio console.
+ *
+ * Once a virtio console has been found, console output goes to its
+ * first port instead of to the serial port and the screen. Characters
+ * are collected in a buffer that is sent as a single transmit buffer
+ * when it is full and at the end of every cprintf and console write,
+ * so a line of output costs one notification instead of several port
+ * writes per character. Sent buffers are reclaimed the next time one
+ * is sent, the device doesn't interrupt us. If the ring is still full
+ * then, the device isn't keeping up, and the buffer goes to the serial
+ * port and the screen instead. We can't wait for room: cprintf runs
+ * with spinlocks held and in interrupt handlers. Input still comes from
+ * the keyboard and the serial port.
+ *
+ * With qemu, port 0 is the first virtconsole on a virtio-serial-pci
+ * bus, e.g. -device virtio-serial-pci -device virtconsole,chardev=c0
+ */
+
+#include "types.h"
+#include "defs.h"
+#include "mmu.h"
+#include "memlayout.h"
+#include "spinlock.h"
+#include "pci.h"
+#include "virtio.h"
+#include "virtcons.h"
+
+static struct {
+    struct virtio_device* dev;  // 0 until the console is set up
+    char buf[VIRTCONS_BUF];     // output not sent yet, under the tx queue lock
+    uint n;
+    uint diverted;              // bytes printed elsewhere for lack of room
+} vcons;
+
+/*
+ * Feature negotiation for a console. We only drive port 0.
+ */
+void virtcons_negotiate(uint64_t *features)
+{
+    DISABLE_FEATURE(*features, VIRTIO_CONSOLE_F_SIZE);
+    DISABLE_FEATURE(*features, VIRTIO_CONSOLE_F_MULTIPORT);
+    DISABLE_FEATURE(*features, VIRTIO_CONSOLE_F_EMERG_WRITE);
+    DISABLE_FEATURE(*features, VIRTIO_F_EVENT_IDX);
+}
+
+/*
+ * Sends the buffered output. Caller holds the tx queue lock. If the
+ * ring is full, the output goes to the serial port and the screen, and
+ * the first time that happens we say so there.
+ */
+static void flush(struct virt_queue* vq)
+{
+    static char full[] = "virtio-console: ring full, output continues here\n";
+    struct virtq_desc desc;
+
+    if (vcons.n == 0) {
+        return;
+    }
+
+    desc.addr = (uint32)vcons.buf;
+    desc.len = vcons.n;
+    desc.flags = 0;
+
+    virtio_reclaim_used(vq);
+    if (virtio_fill_buffer(vcons.dev, VIRTCONS_TXQ, &desc, 1) < 0) {
+        if (vcons.diverted == 0) {
+            consfallback(full, sizeof(full) - 1);
+        }
+        vcons.diverted += vcons.n;
+        consfallback(vcons.buf, vcons.n);
+    }
+
+    vcons.n = 0;
+}
+
+/*
+ * Appends n bytes to the console output. Returns -1 if there is no
+ * virtio console, or if it can't be used because the caller is in the
+ * middle of sending to it (a panic in the driver), and the caller
+ * should print the bytes itself.
+ */
+int virtcons_write(char* s, int n)
+{
+    struct virt_queue* vq;
+    uint m;
+
+    if (vcons.dev == 0) {
+        return -1;
+    }
+    vq = &vcons.dev->queues[VIRTCONS_TXQ];
+    if (holding(&vq->lock)) {
+        return -1;
+    }
+
+    acquire(&vq->lock);
+    while (n > 0) {
+        m = VIRTCONS_BUF - vcons.n;
+        if (m > n) {
+            m = n;
+        }
+        memmove(vcons.buf + vcons.n, s, m);
+        vcons.n += m;
+        s += m;
+        n -= m;
+
+        if (vcons.n == VIRTCONS_BUF) {
+            flush(vq);
+        }
+    }
+    release(&vq->lock);
+
+    return 0;
+}
+
+/*
+ * Sends whatever output has been collected. Called at the end of every
+ * cprintf and console write.
+ */
+void virtcons_flush(void)
+{
+    struct virt_queue* vq;
+
+    if (vcons.dev == 0) {
+        return;
+    }
+    vq = &vcons.dev->queues[VIRTCONS_TXQ];
+    if (holding(&vq->lock)) {
+        return;
+    }
+
+    acquire(&vq->lock);
+    flush(vq);
+    release(&vq->lock);
+}
+
+int virtcons_init(struct virtio_device* dev)
+{
+    struct virt_queue* rx = &dev->queues[VIRTCONS_RXQ];
+    struct virt_queue* tx = &dev->queues[VIRTCONS_TXQ];
+
+    if (vcons.dev != 0) {
+        cprintf("virtio-console: only one console is supported\n");
+        return -1;
+    }
+
+    if (rx->queue_size == 0 || tx->queue_size == 0) {
+        cprintf("virtio-console: no port 0 queues\n");
+        return -1;
+    }
+
+    // Transmitted buffers are reclaimed when the next one is sent.
+    tx->chunk_size = VIRTCONS_BUF;
+    virtio_disable_intr(rx);
+    virtio_disable_intr(tx);
+
+    cprintf("virtio-console: console output moves to port 0\n");
+
+    vcons.dev = dev;
+
+    return 0;
+}
+
+/*
+ * Registers the driver with the virtio core, which calls virtcons_init
+ * for the console it finds.
+ */
+void virtconsinit(void)
+{
+    virtio_drivers[CONSOLE].name = "virtio-console";
+    virtio_drivers[CONSOLE].negotiate = &virtcons_negotiate;
+    virtio_drivers[CONSOLE].init = &virtcons_init;
+}
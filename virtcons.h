@@ -0,0 +1,16 @@
+#ifndef __XV6_VIRTCONS_H__
+#define __XV6_VIRTCONS_H__
+
+/* The feature bitmap for virtio console */
+#define VIRTIO_CONSOLE_F_SIZE           0   /* cols and rows are valid */
+#define VIRTIO_CONSOLE_F_MULTIPORT      1   /* More than one port, control queues */
+#define VIRTIO_CONSOLE_F_EMERG_WRITE    2   /* emerg_write in the config space */
+
+/* Queues of port 0 when VIRTIO_CONSOLE_F_MULTIPORT is not negotiated */
+#define VIRTCONS_RXQ    0
+#define VIRTCONS_TXQ    1
+
+/* Bytes of output collected before they are sent in one buffer */
+#define VIRTCONS_BUF    1024
+
+#endif
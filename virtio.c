@@ -2,11 +2,12 @@
 #include "mmu.h"
 #include "memlayout.h"
 #include "defs.h"
+#include "spinlock.h"
 #include "pci.h"
 #include "virtio.h"
 
+#define ROUNDUP(n, a) (((n) + (a) - 1) / (a) * (a))
 
-#define VIRTIO_F_VERSION_1		32
 
 /*
 * Table of all virtio devices in the machine
@@ -15,19 +16,73 @@
 */
 struct virtio_device virtdevs[NVIRTIO] = {0};
 
+// Bit i set: a virtio device interrupts on line i.
+static uint virtio_irqs;
+
+/*
+ * Drivers by device type, filled in by the drivers' init functions
+ * before pci_init probes the bus.
+ */
+struct virtio_driver virtio_drivers[NVIRTIOTYPE];
+
 void virtio_enable_intr(struct virt_queue* vq)
 {
-    vq->used->flags |= ~VIRTQ_USED_F_NO_NOTIFY;
+    if (vq->packed) {
+        vq->driver_event->flags = VIRTQ_EVENT_F_ENABLE;
+    } else {
+        vq->available->flags &= ~VIRTQ_AVAIL_F_NO_INTERRUPT;
+    }
 }
 
 void virtio_disable_intr(struct virt_queue* vq)
 {
-    vq->used->flags |= VIRTQ_USED_F_NO_NOTIFY;
+    if (vq->packed) {
+        vq->driver_event->flags = VIRTQ_EVENT_F_DISABLE;
+    } else {
+        vq->available->flags |= VIRTQ_AVAIL_F_NO_INTERRUPT;
+    }
 }
 
 
 /*
- * Allocates a virtio device.
+ * Maps the structure of capability `type` as memory type `memtype`.
+ * Returns 0 if the device doesn't have it.
+ */
+static volatile uint8* map_cap(struct pci_device* pci, int type, int memtype)
+{
+    if (pci->cap[type] == 0 || pci->cap_len[type] == 0) {
+        return 0;
+    }
+
+    return ioremap(pci->reg_base[pci->cap_bar[type]] + pci->cap_off[type],
+                   pci->cap_len[type], memtype);
+}
+
+/*
+ * The memory type is set per page, so a structure can only be write
+ * combining if none of the register structures shares a page with it.
+ */
+static int own_pages(struct pci_device* pci, int type)
+{
+    uint32 start = PGROUNDDOWN(pci->reg_base[pci->cap_bar[type]] + pci->cap_off[type]);
+    uint32 end = PGROUNDUP(pci->reg_base[pci->cap_bar[type]] + pci->cap_off[type] + pci->cap_len[type]);
+
+    for (int t = VIRTIO_PCI_CAP_COMMON_CFG; t <= VIRTIO_PCI_CAP_DEVICE_CFG; t++) {
+        if (t == type || pci->cap[t] == 0) {
+            continue;
+        }
+        uint32 s = pci->reg_base[pci->cap_bar[t]] + pci->cap_off[t];
+        if (s < end && s + pci->cap_len[t] > start) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/*
+ * Allocates a virtio device and maps its structures: the registers
+ * uncached, the queue doorbells write combining. Returns -1 if there
+ * are too many devices or a structure the core needs can't be mapped.
  */
 int alloc_virt_dev(int pci_fd)
 {
@@ -46,14 +101,25 @@ int alloc_virt_dev(int pci_fd)
 
 found:
 
-  vdev->state = VIRT_USED;
   vdev->base = dev->membase;
   vdev->size = dev->reg_size[4];
   vdev->irq = dev->irq_line;
+  if (vdev->irq < 32) {
+      virtio_irqs |= 1 << vdev->irq;
+  }
   vdev->iobase = dev->iobase;
   vdev->pci = dev;
-  vdev->cfg = (struct virtio_pci_common_cfg*)vdev->base;
+  vdev->cfg = (struct virtio_pci_common_cfg*)map_cap(dev, VIRTIO_PCI_CAP_COMMON_CFG, IOREMAP_UC);
+  vdev->isr = map_cap(dev, VIRTIO_PCI_CAP_ISR_CFG, IOREMAP_UC);
+  vdev->devcfg = map_cap(dev, VIRTIO_PCI_CAP_DEVICE_CFG, IOREMAP_UC);
+  vdev->notify = map_cap(dev, VIRTIO_PCI_CAP_NOTIFY_CFG,
+      own_pages(dev, VIRTIO_PCI_CAP_NOTIFY_CFG) ? IOREMAP_WC : IOREMAP_UC);
+
+  if (vdev->cfg == 0 || vdev->isr == 0 || vdev->notify == 0) {
+      return -1;
+  }
 
+  vdev->state = VIRT_USED;
   return index;
 }
 
@@ -71,14 +137,88 @@ int setup_virtqueue(struct virtio_device* dev, uint16 queue)
         return -1;
     }
 
+    // The driver may always pick a smaller queue than the device offers.
+    if (size > VIRTQ_SIZE) {
+        size = VIRTQ_SIZE;
+        dev->cfg->queue_size = size;
+    }
+
     struct virt_queue* virtq = &dev->queues[queue];
-    virtq->queue_size = size;
+    uint8 packed = (dev->features >> VIRTIO_F_RING_PACKED) & 1;
+
+    // Lay out the block: the device's areas first, each at the alignment
+    // the spec asks for, then the driver's arrays.
+    uint32 desc_sz = size * sizeof(struct virtq_desc);
+    uint32 avail_off, used_off, off;
+    if (packed) {
+        avail_off = desc_sz;
+        used_off = avail_off + sizeof(struct virtq_packed_event);
+        off = used_off + sizeof(struct virtq_packed_event);
+    } else {
+        avail_off = desc_sz;
+        used_off = ROUNDUP(avail_off + sizeof(struct virtq_avail) + 2 * (size + 1), 4);
+        off = used_off + sizeof(struct virtq_used) + sizeof(struct virtq_used_elem) * size + 2;
+    }
+    uint32 chain_off = ROUNDUP(off, 4);
+    uint32 free_off = chain_off + 2 * size;
+    uint32 arena_off = ROUNDUP(free_off + 2 * size, 4);
+    uint32 indirect_off = arena_off + sizeof(uint8*) * size;
+    uint32 total = indirect_off + sizeof(uint8*) * ROUNDUP(size, VIRTQ_INDIRECT_PER_PAGE) / VIRTQ_INDIRECT_PER_PAGE;
+
+    uint8* mem = (uint8*)kallocn(PGROUNDUP(total) / PGSIZE);
+    if (mem == 0) {
+        cprintf("Queue: %d no memory for %d entries\n", queue, size);
+        return -1;
+    }
+    memset(mem, 0, PGROUNDUP(total));
+
     virtq->num = queue;
     virtq->next_buffer = 0;
+    virtq->free_head = 0;
+    virtq->num_free = size;
+    virtq->last_used_index = 0;
+    virtq->notify_off = dev->cfg->queue_notify_off;
+    virtq->packed = packed;
+    virtq->avail_wrap = 1;
+    virtq->used_wrap = 1;
+    virtq->chain_len = (uint16*)(mem + chain_off);
+    virtq->free_next = (uint16*)(mem + free_off);
+    virtq->arena = (uint8**)(mem + arena_off);
+    virtq->indirect = (uint8**)(mem + indirect_off);
+    initlock(&virtq->lock, "virtq");
+
+    // A zeroed ring is empty in both layouts, and all packed descriptors
+    // start out owned by the driver.
+    if (packed) {
+        virtq->ring = (struct virtq_packed_desc*)mem;
+        virtq->driver_event = (struct virtq_packed_event*)(mem + avail_off);
+        virtq->device_event = (struct virtq_packed_event*)(mem + used_off);
+    } else {
+        virtq->buffers = (struct virtq_desc*)mem;
+        virtq->available = (struct virtq_avail*)(mem + avail_off);
+        virtq->used = (struct virtq_used*)(mem + used_off);
+    }
+
+    // Every id starts out free. The free descriptors of a split queue
+    // are linked through their own next fields, so a chain can be taken
+    // off the list without rewriting them.
+    for (uint16 i = 0; i < size; i++) {
+        if (packed) {
+            virtq->free_next[i] = i + 1;
+        } else {
+            virtq->buffers[i].next = i + 1;
+        }
+    }
 
-    dev->cfg->queue_desc = V2P(&virtq->buffers);
-    dev->cfg->queue_avail = V2P(&virtq->available);
-    dev->cfg->queue_used = V2P(&virtq->used);
+    dev->cfg->queue_desc = V2P(mem);
+    dev->cfg->queue_desc_hi = 0;
+    dev->cfg->queue_avail = V2P(mem + avail_off);
+    dev->cfg->queue_avail_hi = 0;
+    dev->cfg->queue_used = V2P(mem + used_off);
+    dev->cfg->queue_used_hi = 0;
+    dev->cfg->queue_enable = 1;
+
+    virtq->queue_size = size;
 
     // cprintf("descriptors: %d available: %d used: %d\n", dev->cfg->queue_desc, dev->cfg->queue_avail, dev->cfg->queue_used);
 
@@ -93,7 +233,7 @@ int setup_virtqueue(struct virtio_device* dev, uint16 queue)
  * This functions accepts a function pointer to a negotiate function. This
  * means that different virtio devices can customize feature negotiation.
  */
-int conf_virtio_mem(int fd, void (*negotiate)(uint32 *features))
+int conf_virtio_mem(int fd, void (*negotiate)(uint64_t *features))
 {
     struct virtio_device *dev = &virtdevs[fd];
 
@@ -109,11 +249,24 @@ int conf_virtio_mem(int fd, void (*negotiate)(uint32 *features))
     flag |= VIRTIO_STATUS_DRIVER;
     dev->cfg->device_status = flag;
 
-    uint32 features = dev->cfg->device_feature;
+    // The feature bits are read and written 32 at a time, the select
+    // registers pick the half.
+    dev->cfg->device_feature_select = 0;
+    uint64_t features = dev->cfg->device_feature;
+    dev->cfg->device_feature_select = 1;
+    features |= (uint64_t)dev->cfg->device_feature << 32;
 
     negotiate(&features);
 
-    dev->cfg->driver_feature = features;
+    // Of the transport features we can only take the ones the core
+    // implements.
+    features &= ~VIRTIO_TRANSPORT_F_MASK | VIRTIO_CORE_FEATURES;
+
+    dev->cfg->driver_feature_select = 0;
+    dev->cfg->driver_feature = (uint32)features;
+    dev->cfg->driver_feature_select = 1;
+    dev->cfg->driver_feature = (uint32)(features >> 32);
+    dev->features = features;
 
     flag |= VIRTIO_STATUS_FEATURES_OK;
     dev->cfg->device_status = flag;
@@ -123,11 +276,18 @@ int conf_virtio_mem(int fd, void (*negotiate)(uint32 *features))
     // cprintf("got val: %d\n", val);
 
     if ((val & VIRTIO_STATUS_FEATURES_OK) == 0) {
+        dev->cfg->device_status = flag | VIRTIO_STATUS_FAILED;
         return -1;
     }
 
-    // Only support 4 virt queues.
-    for (int i = 0; i < 4; i++) {
+    uint8 cap_pointer = dev->pci->cap[VIRTIO_PCI_CAP_NOTIFY_CFG];
+    dev->notify_mult = confread32(
+        dev->pci,
+        cap_pointer + offsetof(struct virtio_pci_notify_cap, notify_off_multiplier)
+    );
+
+    // Only support NVIRTQ virt queues.
+    for (int i = 0; i < dev->cfg->num_queues && i < NVIRTQ; i++) {
         setup_virtqueue(dev, i);
     }
 
@@ -140,75 +300,554 @@ int conf_virtio_mem(int fd, void (*negotiate)(uint32 *features))
 }
 
 /*
- * Notify the device by writing to an offest within the ISR CAP Bar.
+ * Called by pci_init for every function with the virtio vendor id.
+ * Works out the device type, configures the device and hands it to the
+ * driver registered for that type. Returns -1 if the device is left
+ * alone.
  *
- * From Virtio Spec 1.0 4.1.4.4 Notification structure layout
+ * Modern devices have the type in their device id, transitional ones
+ * in their subsystem id. Legacy only devices have no virtio
+ * capabilities and are not supported.
  */
-void notify_queue(struct virtio_device* dev, uint16 queue)
+int virtio_probe(struct pci_device* pci)
 {
-    uint8 cap_pointer = dev->pci->cap[VIRTIO_PCI_CAP_NOTIFY_CFG];
-    uint32 notify_bar = dev->pci->cap_bar[VIRTIO_PCI_CAP_NOTIFY_CFG];
-    uint32 notify_off = dev->pci->cap_off[VIRTIO_PCI_CAP_NOTIFY_CFG];
-    uint32 bar_addr = dev->pci->reg_base[notify_bar];
+    uint32 id = pci->dev_id >> 16;
+    uint32 type;
+
+    if (id >= VIRTIO_DEVICE_ID_BASE && id < VIRTIO_DEVICE_ID_BASE + 0x40) {
+        type = id - VIRTIO_DEVICE_ID_BASE;
+    } else if (id >= T_NETWORK_CARD && id < T_NETWORK_CARD + 0x40) {
+        type = confread32(pci, PCI_SUBSYS_REG) >> 16;
+    } else {
+        return -1;
+    }
 
-    // The multiplier is after the cap structure, which is 16 bytes long.
-    uint32 notify_off_multiplier = confread32(
-        dev->pci,
-        cap_pointer + offsetof(struct virtio_pci_notify_cap, notify_off_multiplier)
-    );
+    if (type >= NVIRTIOTYPE || virtio_drivers[type].init == 0) {
+        cprintf("virtio: no driver for device type %d\n", type);
+        return -1;
+    }
+
+    if (config_pci(pci) < 0 || pci->cap[VIRTIO_PCI_CAP_COMMON_CFG] == 0) {
+        cprintf("virtio: %s: not a virtio 1.0 device\n", virtio_drivers[type].name);
+        return -1;
+    }
 
-    uint32 total_offset = notify_off + dev->cfg->queue_notify_off * notify_off_multiplier;
+    int fd = alloc_virt_dev(pci - pcidevs);
+    if (fd < 0) {
+        cprintf("virtio: %s: too many devices or can't map them\n", virtio_drivers[type].name);
+        return -1;
+    }
+
+    struct virtio_device* dev = &virtdevs[fd];
+    dev->type = type;
+
+    if (conf_virtio_mem(fd, virtio_drivers[type].negotiate) < 0) {
+        cprintf("virtio: %s: feature negotiation failed\n", virtio_drivers[type].name);
+        dev->state = VIRT_FREE;
+        return -1;
+    }
 
-    // cprintf("Total offset: %p, cap_pointer: %p\n", total_offset, cap_pointer);
+    cprintf("virtio: %s: features %x:%x\n", virtio_drivers[type].name,
+            (uint32)(dev->features >> 32), (uint32)dev->features);
+
+    return virtio_drivers[type].init(dev);
+}
 
-    // write the queue index to the address within the bar to notify the
-    // device.
-    uint32* addr = (bar_addr + total_offset);
+/*
+ * Registers the core for every function with the virtio vendor id,
+ * virtio_probe then picks the driver by device type.
+ */
+void virtioinit(void)
+{
+    struct pci_driver d = {
+        .name = "virtio", .vendor = VIRTIO_VENDOR_ID, .device = PCI_ANY_ID,
+        .probe = &virtio_probe,
+    };
+
+    pci_register_driver(&d);
+}
+
+/*
+ * Returns the device specific configuration structure of the device.
+ */
+void* virtio_device_cfg(struct virtio_device* dev)
+{
+    return (void*)dev->devcfg;
+}
+
+/*
+ * Notify the device by writing to an offest within the notification
+ * structure.
+ *
+ * From Virtio Spec 1.0 4.1.4.4 Notification structure layout
+ */
+void notify_queue(struct virtio_device* dev, uint16 queue)
+{
+    // The multiplier was read from the notify capability at configuration
+    // time, each queue has its own queue_notify_off.
+    uint32 total_offset = dev->queues[queue].notify_off * dev->notify_mult;
+
+    // write the queue index to the address within the structure to
+    // notify the device, and push it out of the write combining buffer.
+    volatile uint16* addr = (volatile uint16*)(dev->notify + total_offset);
     *addr = queue;
+    sfence();
 }
 
-void virtio_fill_buffer(struct virtio_device* dev, uint16 queue, struct virtq_desc* desc_chain, uint32 count)
+/*
+ * Notifies the device about new buffers on `queue` unless it has asked
+ * not to be: it sets VIRTQ_USED_F_NO_NOTIFY, or disables its event
+ * suppression structure, while it is already processing the queue.
+ */
+void virtio_kick(struct virtio_device* dev, uint16 queue)
 {
     struct virt_queue* vq = &dev->queues[queue];
-    // Do we need to lock this queue?
+    uint16 flags;
+
+    // The ring updates have to be visible before we look at the flags.
+    __sync_synchronize();
+
+    if (vq->packed) {
+        flags = ((volatile struct virtq_packed_event*)vq->device_event)->flags;
+        if (flags == VIRTQ_EVENT_F_DISABLE) {
+            return;
+        }
+    } else {
+        flags = ((volatile struct virtq_used*)vq->used)->flags;
+        if (flags & VIRTQ_USED_F_NO_NOTIFY) {
+            return;
+        }
+    }
+
+    notify_queue(dev, queue);
+}
+
+/*
+ * Reads the ISR status of the device, which also acknowledges the
+ * interrupt. Bit 0 is set when a queue has new used buffers.
+ *
+ * From Virtio Spec 1.0 4.1.4.5 ISR status capability
+ */
+uint8 virtio_isr(struct virtio_device* dev)
+{
+    return *dev->isr;
+}
+
+/*
+ * Interrupt handler shared by all virtio devices, for interrupt line
+ * irq. Returns 0 if no virtio device is on that line. Legacy interrupts
+ * are level triggered and may be shared, so every device on the line
+ * gets a look.
+ */
+int virtiointr(int irq)
+{
+    struct virtio_device* vdev;
+
+    if (irq >= 32 || (virtio_irqs & (1 << irq)) == 0) {
+        return 0;
+    }
+
+    for (vdev = virtdevs; vdev < &virtdevs[NVIRTIO]; vdev++) {
+        if (vdev->state == VIRT_USED && vdev->irq == irq && vdev->intr != 0) {
+            vdev->intr(vdev);
+        }
+    }
+    return 1;
+}
+
+/*
+ * Returns the chunk_size buffer for descriptor (split) or buffer id
+ * (packed) `id`. Buffers don't cross pages, and a page is allocated
+ * when the first of its buffers is asked for. Returns 0 if there is
+ * no memory or the queue has no chunk size.
+ */
+uint8* virtio_buffer(struct virt_queue* vq, uint16 id)
+{
+    if (vq->chunk_size == 0 || vq->chunk_size > PGSIZE) {
+        return 0;
+    }
+
+    uint32 per_page = PGSIZE / vq->chunk_size;
+    uint8** page = &vq->arena[id / per_page];
 
+    if (*page == 0 && (*page = (uint8*)kalloc()) == 0) {
+        return 0;
+    }
+
+    return *page + (id % per_page) * vq->chunk_size;
+}
+
+/*
+ * Takes the next chain the device has finished with off the used ring
+ * and returns its descriptors to the free pool. Returns 0 if there is
+ * none, otherwise 1 with the id of the chain's buffer in *id and the
+ * number of bytes the device wrote into it in *len.
+ *
+ * Chains may come back in any order, the id goes back on the front of
+ * the free list.
+ */
+int virtio_next_used(struct virt_queue* vq, uint16* id, uint32* len)
+{
+    if (vq->packed) {
+        struct virtq_packed_desc* d = vq->ring + vq->last_used_index;
+        uint16 flags = ((volatile struct virtq_packed_desc*)d)->flags;
+
+        // The device hands a descriptor back by making both AVAIL and
+        // USED equal to its wrap counter.
+        if (((flags & VIRTQ_DESC_F_AVAIL) != 0) != vq->used_wrap ||
+            ((flags & VIRTQ_DESC_F_USED) != 0) != vq->used_wrap) {
+            return 0;
+        }
+        __sync_synchronize();
+
+        *id = d->id;
+        *len = d->len;
+
+        // The device writes one used descriptor per chain, the rest of
+        // the chain's slots are skipped.
+        uint16 n = vq->chain_len[*id];
+        vq->last_used_index += n;
+        if (vq->last_used_index >= vq->queue_size) {
+            vq->last_used_index -= vq->queue_size;
+            vq->used_wrap ^= 1;
+        }
+        vq->num_free += n;
+        vq->free_next[*id] = vq->free_head;
+        vq->free_head = *id;
+        return 1;
+    }
+
+    if (vq->last_used_index == ((volatile struct virtq_used*)vq->used)->idx) {
+        return 0;
+    }
+    __sync_synchronize();
+
+    struct virtq_used_elem* e = &vq->used->ring[vq->last_used_index % vq->queue_size];
+    uint16 i = e->id;
+
+    *id = i;
+    *len = e->len;
+
+    // Walk to the end of the chain, which then goes back on the free
+    // list as it is.
+    vq->num_free++;
+    while (vq->buffers[i].flags & VIRTQ_DESC_F_NEXT) {
+        i = vq->buffers[i].next;
+        vq->num_free++;
+    }
+    vq->buffers[i].next = vq->free_head;
+    vq->free_head = *id;
+
+    vq->last_used_index++;
+    return 1;
+}
+
+/*
+ * Returns descriptor chains the device has finished with to the free
+ * pool. Returns the number of chains reclaimed.
+ */
+int virtio_reclaim_used(struct virt_queue* vq)
+{
+    int chains = 0;
+    uint16 id;
+    uint32 len;
+
+    while (virtio_next_used(vq, &id, &len)) {
+        chains++;
+    }
+
+    return chains;
+}
+
+/*
+ * Gives a receive buffer the device has just handed back through
+ * virtio_next_used to the device again as it was: a single device
+ * writable chunk. The device is not notified, see virtio_kick.
+ */
+void virtio_requeue(struct virt_queue* vq, uint16 id)
+{
+    // virtio_next_used has just put the id on the front of the free list.
+    if (vq->free_head != id) {
+        panic("virtio_requeue");
+    }
+
+    if (vq->packed) {
+        vq->free_head = vq->free_next[id];
+
+        struct virtq_packed_desc* d = vq->ring + vq->next_buffer;
+
+        d->addr = V2P(virtio_buffer(vq, id));
+        d->addr_hi = 0;
+        d->len = vq->chunk_size;
+        d->id = id;
+        vq->chain_len[id] = 1;
+        __sync_synchronize();
+        d->flags = VIRTQ_DESC_F_WRITE
+            | (vq->avail_wrap ? VIRTQ_DESC_F_AVAIL : VIRTQ_DESC_F_USED);
+
+        if (++vq->next_buffer == vq->queue_size) {
+            vq->next_buffer = 0;
+            vq->avail_wrap ^= 1;
+        }
+    } else {
+        // The descriptor is still intact, only its index goes back.
+        vq->free_head = vq->buffers[id].next;
+        vq->available->ring[vq->available->idx % vq->queue_size] = id;
+        __sync_synchronize();
+        vq->available->idx++;
+    }
+
+    vq->num_free--;
+}
+
+/*
+ * Split ring part of fill. The chain takes `count` descriptors off the
+ * free list and the id of its first one. If `stage` is set the buffers
+ * are copied into the arena, otherwise their addresses are physical
+ * and used as they are.
+ */
+static void fill_split(struct virt_queue* vq, struct virtq_desc* desc_chain, uint32 count, int stage)
+{
     uint16 idx = vq->available->idx % vq->queue_size;
-    uint16 buf_idx = vq->next_buffer;
-    uint16 next_buf;
+    uint16 head = vq->free_head;
+    uint16 buf_idx = head;
 
-    uint8* buf = (uint8 *)(&vq->arena[vq->chunk_size * buf_idx]);
+    uint8* buf = stage ? virtio_buffer(vq, head) : 0;
 
-    vq->available->ring[idx] = buf_idx;
     for (int i = 0; i < count; i++) {
-        // cprintf("Filling buffer %d\n", buf_idx);
+        struct virtq_desc* d = &vq->buffers[buf_idx];
 
-        next_buf = (buf_idx + 1) % vq->queue_size;
+        // The free descriptors are already linked through next, so
+        // only the flags say where the chain ends.
+        d->flags = desc_chain[i].flags;
+        if (i != count - 1) {
+            d->flags |= VIRTQ_DESC_F_NEXT;
+        }
+        d->len = desc_chain[i].len;
+
+        if (!stage) {
+            d->addr = desc_chain[i].addr;
+        } else {
+            d->addr = V2P(buf);
 
-        vq->buffers[buf_idx].flags = desc_chain[i].flags;
+            if (desc_chain[i].addr != 0) {
+                // Only copy if a valid address is present
+                memmove(buf, (void*)desc_chain[i].addr, desc_chain[i].len);
+            }
+
+            buf += desc_chain[i].len;
+        }
 
-        // If this isn't the last buffer, add the chaining flag
-        if (i != count -1) {
-            vq->buffers[buf_idx].flags |= VIRTQ_DESC_F_NEXT;
+        if (i != count - 1) {
+            buf_idx = d->next;
         }
+    }
+
+    vq->free_head = vq->buffers[buf_idx].next;
+    vq->available->ring[idx] = head;
+
+    // The descriptors have to be visible before the index that
+    // publishes them.
+    __sync_synchronize();
+    vq->available->idx++;
+}
 
-        vq->buffers[buf_idx].next = next_buf;
-        vq->buffers[buf_idx].len = desc_chain[i].len;
-        vq->buffers[buf_idx].addr = V2P(buf);
+/*
+ * Packed ring part of fill. The chain takes the next `count` ring
+ * slots and the buffer id on the front of the free list. `stage` is as
+ * for fill_split.
+ */
+static void fill_packed(struct virt_queue* vq, struct virtq_desc* desc_chain, uint32 count, int stage)
+{
+    struct virtq_packed_desc* ring = vq->ring;
+    uint16 id = vq->free_head;
+    uint16 head = vq->next_buffer;
+    uint16 idx = head;
+    uint16 head_flags = 0;
+    uint8 wrap = vq->avail_wrap;
+
+    uint8* buf = stage ? virtio_buffer(vq, id) : 0;
 
-        if (desc_chain[i].addr != 0) {
-            // Only copy if a valid address is present
-            memmove(buf, &desc_chain[i].addr, desc_chain[i].len);
+    for (int i = 0; i < count; i++) {
+        uint16 flags = desc_chain[i].flags;
+
+        if (i != count - 1) {
+            flags |= VIRTQ_DESC_F_NEXT;
+        }
+        // Available means AVAIL matches our wrap counter and USED doesn't.
+        flags |= wrap ? VIRTQ_DESC_F_AVAIL : VIRTQ_DESC_F_USED;
+
+        ring[idx].addr_hi = 0;
+        ring[idx].len = desc_chain[i].len;
+        ring[idx].id = id;
+
+        if (!stage) {
+            ring[idx].addr = desc_chain[i].addr;
+        } else {
+            ring[idx].addr = V2P(buf);
+            if (desc_chain[i].addr != 0) {
+                memmove(buf, (void*)desc_chain[i].addr, desc_chain[i].len);
+            }
+            buf += desc_chain[i].len;
         }
 
-        buf += desc_chain[i].len;
+        if (i == 0) {
+            head_flags = flags;
+        } else {
+            ring[idx].flags = flags;
+        }
 
-        buf_idx = next_buf;
+        if (++idx == vq->queue_size) {
+            idx = 0;
+            wrap ^= 1;
+        }
     }
 
-    vq->next_buffer = next_buf;
+    vq->free_head = vq->free_next[id];
+    vq->chain_len[id] = count;
+    vq->next_buffer = idx;
+    vq->avail_wrap = wrap;
 
-    // Do we need an mfence here?
-    vq->available->idx++;
+    // The device may start on the chain as soon as the head is
+    // available, so its flags go last.
+    __sync_synchronize();
+    ring[head].flags = head_flags;
+}
 
-    notify_queue(dev, queue);
+/*
+ * Describes the chain in the indirect table of the next buffer id,
+ * which is returned as a single descriptor in *ind. The table is in
+ * the format of the ring. If `stage` is set the chain is copied into
+ * the arena buffer of the id first. Returns -1 if the table's page
+ * can't be allocated.
+ */
+static int fill_indirect(struct virt_queue* vq, struct virtq_desc* desc_chain, uint32 count, struct virtq_desc* ind, int stage)
+{
+    uint16 id = vq->free_head;
+    uint8** page = &vq->indirect[id / VIRTQ_INDIRECT_PER_PAGE];
+
+    if (*page == 0 && (*page = (uint8*)kalloc()) == 0) {
+        return -1;
+    }
+
+    uint8* table = *page + (id % VIRTQ_INDIRECT_PER_PAGE) * VIRTQ_INDIRECT_SZ;
+    uint8* buf = stage ? virtio_buffer(vq, id) : 0;
+
+    for (int i = 0; i < count; i++) {
+        uint32 addr = stage ? V2P(buf) : desc_chain[i].addr;
+
+        if (vq->packed) {
+            // Only WRITE means anything in a packed indirect table, the
+            // buffers simply follow each other.
+            struct virtq_packed_desc* d = (struct virtq_packed_desc*)table + i;
+            d->addr = addr;
+            d->addr_hi = 0;
+            d->len = desc_chain[i].len;
+            d->id = 0;
+            d->flags = desc_chain[i].flags & VIRTQ_DESC_F_WRITE;
+        } else {
+            struct virtq_desc* d = (struct virtq_desc*)table + i;
+            d->addr = addr;
+            d->len = desc_chain[i].len;
+            d->flags = desc_chain[i].flags & VIRTQ_DESC_F_WRITE;
+            if (i != count - 1) {
+                d->flags |= VIRTQ_DESC_F_NEXT;
+            }
+            d->next = i + 1;
+        }
+
+        if (stage) {
+            if (desc_chain[i].addr != 0) {
+                memmove(buf, (void*)desc_chain[i].addr, desc_chain[i].len);
+            }
+            buf += desc_chain[i].len;
+        }
+    }
+
+    ind->addr = V2P(table);
+    ind->len = count * sizeof(struct virtq_desc);
+    ind->flags = VIRTQ_DESC_F_INDIRECT;
+    ind->next = 0;
+    return 0;
+}
+
+/*
+ * Places a chain of `count` buffers on the available ring. Returns the
+ * buffer id the chain got, or -1 without touching the ring if there
+ * are not enough free descriptors for the whole chain. Callers
+ * serialize on vq->lock.
+ *
+ * If the device takes indirect descriptors, a chain of up to
+ * VIRTQ_INDIRECT_MAX buffers only needs a single ring slot.
+ */
+static int fill(struct virtio_device* dev, uint16 queue, struct virtq_desc* desc_chain, uint32 count, int stage)
+{
+    struct virt_queue* vq = &dev->queues[queue];
+    struct virtq_desc ind;
+    uint16 id = vq->free_head;
+    uint32 len = 0;
+
+    if (vq->num_free == 0) {
+        return -1;
+    }
+
+    // A staged chain is copied into the buffer of its id.
+    if (stage) {
+        for (int i = 0; i < count; i++) {
+            len += desc_chain[i].len;
+        }
+        if (len > vq->chunk_size || virtio_buffer(vq, id) == 0) {
+            return -1;
+        }
+    }
+
+    if (count > 1 && count <= VIRTQ_INDIRECT_MAX &&
+        HAS_FEATURE(dev->features, VIRTIO_F_INDIRECT_DESC) &&
+        fill_indirect(vq, desc_chain, count, &ind, stage) == 0) {
+        desc_chain = &ind;
+        count = 1;
+        stage = 0;
+    }
+
+    if (vq->num_free < count) {
+        return -1;
+    }
+
+    if (vq->packed) {
+        fill_packed(vq, desc_chain, count, stage);
+    } else {
+        fill_split(vq, desc_chain, count, stage);
+    }
+    vq->num_free -= count;
+
+    return id;
+}
+
+/*
+ * Copies a chain of `count` buffers into the arena, places it on the
+ * available ring and notifies the device. Returns the buffer id of the
+ * chain, or -1 if it doesn't fit.
+ */
+int virtio_fill_buffer(struct virtio_device* dev, uint16 queue, struct virtq_desc* desc_chain, uint32 count)
+{
+    int id = fill(dev, queue, desc_chain, count, 1);
+
+    if (id >= 0) {
+        virtio_kick(dev, queue);
+    }
+
+    return id;
+}
+
+/*
+ * Places a chain of `count` buffers with physical addresses on the
+ * available ring, for the device to use in place. The id the chain
+ * will get is vq->free_head beforehand. The device is not notified, so
+ * several chains can be posted before one virtio_kick. Returns the
+ * buffer id of the chain, or -1 if there are not enough free
+ * descriptors.
+ */
+int virtio_post(struct virtio_device* dev, uint16 queue, struct virtq_desc* desc_chain, uint32 count)
+{
+    return fill(dev, queue, desc_chain, count, 0);
 }
@@ -3,9 +3,9 @@
 
 #include "types.h"
 
-#define DISABLE_FEATURE(v,feature) v &= ~(1<<feature)
-#define ENABLE_FEATURE(v,feature) v |= (1<<feature)
-#define HAS_FEATURE(v,feature) (v & (1<<feature))
+#define DISABLE_FEATURE(v,feature) v &= ~(1ULL<<(feature))
+#define ENABLE_FEATURE(v,feature) v |= (1ULL<<(feature))
+#define HAS_FEATURE(v,feature) ((v) & (1ULL<<(feature)))
 
 // Virtio device IDs
 enum VIRTIO_DEVICE {
@@ -28,6 +28,8 @@ enum VIRTIO_DEVICE {
     INPUT_DEVICE = 16
 };
 
+#define NVIRTIOTYPE 17  // device types above, the size of virtio_drivers
+
 // Transitional vitio device ids
 enum TRANSITIONAL_VIRTIO_DEVICE {
     T_NETWORK_CARD = 0X1000,
@@ -86,20 +88,24 @@ struct virtio_pci_common_cfg {
     uint32 device_feature;            /* read-only for driver , 4*/
     uint32 driver_feature_select;     /* read-write , 8*/
     uint32 driver_feature;            /* read-write , 12*/
-    uint16 msix_config;               /* read-write , 20*/
-    uint16 num_queues;                /* read-only for driver , 22*/
-    uint8 device_status;               /* read-write , 24*/
-    uint8 config_generation;           /* read-only for driver , 25*/
+    uint16 msix_config;               /* read-write , 16*/
+    uint16 num_queues;                /* read-only for driver , 18*/
+    uint8 device_status;               /* read-write , 20*/
+    uint8 config_generation;           /* read-only for driver , 21*/
 
     /* About a specific virtqueue. */
-    uint16 queue_select;              /* read-write , 26*/
-    uint16 queue_size;                /* read-write, power of 2, or 0. , 28*/
-    uint16 queue_msix_vector;         /* read-write , 30*/
-    uint16 queue_enable;              /* read-write , 32*/
-    uint16 queue_notify_off;          /* read-only for driver , 34*/
-    uint32 queue_desc;                /* read-write , 36*/
-    uint32 queue_avail;               /* read-write , 42*/
-    uint32 queue_used;                /* read-write , 50*/
+    uint16 queue_select;              /* read-write , 22*/
+    uint16 queue_size;                /* read-write, power of 2, or 0. , 24*/
+    uint16 queue_msix_vector;         /* read-write , 26*/
+    uint16 queue_enable;              /* read-write , 28*/
+    uint16 queue_notify_off;          /* read-only for driver , 30*/
+    /* The three ring addresses are 64 bit, we only use the low half. */
+    uint32 queue_desc;                /* read-write , 32*/
+    uint32 queue_desc_hi;             /* read-write , 36*/
+    uint32 queue_avail;               /* read-write , 40 (driver area)*/
+    uint32 queue_avail_hi;            /* read-write , 44*/
+    uint32 queue_used;                /* read-write , 48 (device area)*/
+    uint32 queue_used_hi;             /* read-write , 52*/
 } __attribute__((packed));
 
 
@@ -120,6 +126,33 @@ struct virtq_desc {
     uint16 next;
 };
 
+/*
+ * Descriptor of a packed virtqueue, virtio spec 1.1 2.7. The ring is a
+ * single array of these which the driver and the device both walk in
+ * order. Ownership of a descriptor is encoded in its AVAIL and USED
+ * flags relative to a wrap counter that flips every time the walk
+ * wraps around, so no index needs to be shared.
+ */
+struct virtq_packed_desc {
+    uint32 addr;
+    uint32 addr_hi;
+    uint32 len;
+    /* Buffer id, written back by the device in the used descriptor. */
+    uint16 id;
+/* NEXT, WRITE and INDIRECT as for the split ring, plus */
+#define VIRTQ_DESC_F_AVAIL      (1 << 7)
+#define VIRTQ_DESC_F_USED       (1 << 15)
+    uint16 flags;
+};
+
+/* Event suppression structure of a packed virtqueue. */
+struct virtq_packed_event {
+    uint16 off_wrap;
+#define VIRTQ_EVENT_F_ENABLE    0
+#define VIRTQ_EVENT_F_DISABLE   1
+    uint16 flags;
+};
+
 struct virtq_avail {
 #define VIRTQ_AVAIL_F_NO_INTERRUPT      1
     uint16 flags;
@@ -142,23 +175,51 @@ struct virtq_used {
     struct virtq_used_elem ring[/* Queue Size */];
 };
 
-// qemu's default virtq size is 256
-#define VIRTQ_SIZE              256
+// Largest queue we set up. qemu's default virtq size is 256, a device
+// that offers more is given VIRTQ_SIZE entries.
+#define VIRTQ_SIZE              1024
+
+// Chains of up to VIRTQ_INDIRECT_MAX buffers can be sent through one
+// ring slot with an indirect table when VIRTIO_F_INDIRECT_DESC is
+// negotiated. Each queue keeps a table per buffer id, in pages that
+// are allocated the first time one of their tables is used.
+#define VIRTQ_INDIRECT_MAX      8
+#define VIRTQ_INDIRECT_SZ       (VIRTQ_INDIRECT_MAX * sizeof(struct virtq_desc))
+#define VIRTQ_INDIRECT_PER_PAGE (4096 / VIRTQ_INDIRECT_SZ)
 
 // alignment and sizes come from virtio spec 1.0 2.4 Virtqueues
 // http://docs.oasis-open.org/virtio/virtio/v1.0/cs04/virtio-v1.0-cs04.html#x1-220004
+//
+// The rings are allocated by setup_virtqueue for the queue size the
+// device reports, in one physically contiguous block that also holds
+// the driver's per buffer id arrays. A split queue uses `buffers`,
+// `available` and `used`; a packed queue (VIRTIO_F_RING_PACKED) uses
+// `ring` and the two event suppression structures.
 struct virt_queue {
     uint32 num;
-    struct virtq_desc buffers[16 * VIRTQ_SIZE] __attribute__ ((aligned(16)));
-    struct virtq_avail available[6 + (2 * VIRTQ_SIZE)] __attribute__ ((aligned(2)));
-    struct virtq_used used[6 + (8 * VIRTQ_SIZE)] __attribute__ ((aligned(4)));
+    struct virtq_desc* buffers;
+    struct virtq_avail* available;
+    struct virtq_used* used;
+    struct virtq_packed_desc* ring;
+    struct virtq_packed_event* driver_event;
+    struct virtq_packed_event* device_event;
     uint16 last_used_index;
     uint16 last_available_index;
     uint32 chunk_size;
-    uint16 next_buffer;
-    uint16 queue_size;
-    uint8  arena[4096*2]; // Statically allocate 10 pages worth of memory per queue.
-    uint32 lock;
+    uint16 next_buffer; // packed: ring slot the next chain starts at
+    uint16 free_head;   // buffer id the next chain gets
+    uint16 num_free; // descriptors not owned by the device
+    uint16 queue_size;  // 0 if the queue is not set up
+    uint16 notify_off;  // queue_notify_off of this queue
+    uint8 packed;       // the queue uses the packed layout
+    uint8 avail_wrap;   // packed: wrap counter of next_buffer
+    uint8 used_wrap;    // packed: wrap counter of last_used_index
+    uint16* chain_len;  // packed: descriptors in the chain of buffer id
+    uint16* free_next;  // packed: free id after this one, split queues
+                        // link free descriptors through their next
+    uint8** arena;      // pages of chunk_size buffers, one per buffer id
+    uint8** indirect;   // indirect table pages
+    struct spinlock lock; // serializes callers of virtio_fill_buffer and virtio_post
 };
 
 
@@ -180,6 +241,8 @@ static inline uint16 *virtq_avail_event(struct virt_queue *vq)
         return (uint16 *)&vq->used->ring[vq->num];
 }
 
+#define NVIRTQ 4  // queues set up per device
+
 /*
  * A Virtio device.
  */
@@ -193,10 +256,36 @@ struct virtio_device {
     uint32 iobase;
     struct pci_device* pci;
     struct virtio_pci_common_cfg* cfg;
+    volatile uint8* notify;     // notification structure, write combining
+    volatile uint8* isr;        // ISR status
+    volatile uint8* devcfg;     // device specific configuration, or 0
     uint8 macaddr[6];
-    struct virt_queue queues[4];
+    uint16 type;        // enum VIRTIO_DEVICE
+    uint64_t features;  // negotiated feature bits
+    uint32 notify_mult; // notify_off_multiplier of the notify capability
+    struct nic_device* nic;
+    // Called from virtiointr() when the device may have raised an interrupt.
+    void (*intr)(struct virtio_device*);
+    struct virt_queue queues[NVIRTQ];
+};
+
+/*
+ * A driver for one type of virtio device, registered in virtio_drivers
+ * under that type before pci_init. The core negotiates the features
+ * and sets up the queues, then hands the device to init.
+ */
+struct virtio_driver {
+    char* name;
+    // Clears the bits of the offered features the driver doesn't want.
+    // Transport bits (24 to 40) the core doesn't implement are cleared
+    // after it.
+    void (*negotiate)(uint64_t* features);
+    // Takes over the configured device. Returns -1 if it can't.
+    int (*init)(struct virtio_device* dev);
 };
 
+extern struct virtio_driver virtio_drivers[NVIRTIOTYPE];
+
 #define NVIRTIO                         10
 
 // Array of virtio devices
@@ -222,8 +311,17 @@ extern struct virtio_device virtdevs[NVIRTIO];
 #define VIRTIO_NET_F_CTRL_VLAN	    19	/* Control channel VLAN filtering */
 #define VIRTIO_NET_F_CTRL_RX_EXTRA  20	/* Extra RX mode control support */
 #define VIRTIO_NET_F_GUEST_ANNOUNCE 21	/* Guest can announce device on the network */
+#define VIRTIO_F_INDIRECT_DESC      28  /* Support for indirect descriptor tables */
 #define VIRTIO_F_EVENT_IDX          29  /* Support for avail_event and used_event fields */
 
+#define VIRTIO_F_VERSION_1          32  /* Compliant with the 1.0 spec */
+#define VIRTIO_F_RING_PACKED        34  /* Packed virtqueue layout */
+
+/* Feature bits 24 to 40 belong to the transport, the core negotiates them */
+#define VIRTIO_TRANSPORT_F_MASK     (((1ULL << 41) - 1) & ~((1ULL << 24) - 1))
+#define VIRTIO_CORE_FEATURES \
+    (1ULL << VIRTIO_F_INDIRECT_DESC | 1ULL << VIRTIO_F_VERSION_1 | 1ULL << VIRTIO_F_RING_PACKED)
+
 
 #define VIRTIO_STATUS_RESET                    0
 #define VIRTIO_STATUS_ACKNOWLEDGE              1
@@ -1,10 +1,13 @@
 #include "defs.h"
 #include "mmu.h"
+#include "memlayout.h"
 #include "types.h"
+#include "spinlock.h"
 #include "pci.h"
 #include "virtio.h"
 #include "virtnet.h"
 #include "nic.h"
+#include "pcap.h"
 
 /*
  * Read the network device MAC address from the device specific configuration
@@ -13,14 +16,13 @@
  */
 void init_macaddr(struct virtio_device *dev)
 {
-    struct pci_device* pci = dev->pci;
+    // The MAC is the first field of struct virtio_net_config.
+    volatile uint8* cfg = virtio_device_cfg(dev);
 
     cprintf("Mac addr: ");
 
     for (int i = 0; i < 6; i++) {
-        // setup_window(pci, 1, bar, offset + i);
-        // dev->macaddr[i] = confread8(dev, window_off);
-        dev->macaddr[i] = inb(dev->iobase+VIRTIO_DEV_SPECIFIC_OFF + i);
+        dev->macaddr[i] = cfg[i];
         cprintf("%x:", dev->macaddr[i]);
     }
 
@@ -33,7 +35,7 @@ void init_macaddr(struct virtio_device *dev)
  *
  * We are offloading checksuming to the device
  */
-void virtionet_negotiate(uint32 *features)
+void virtionet_negotiate(uint64_t *features)
 {
     // do not use control queue
     DISABLE_FEATURE(*features, VIRTIO_NET_F_CTRL_VQ);
@@ -47,7 +49,7 @@ void virtionet_negotiate(uint32 *features)
     ENABLE_FEATURE(*features, VIRTIO_NET_F_CSUM);
 
   // Only enable MAC if it is offered by the device
-  if (*features & VIRTIO_NET_F_MAC) {
+  if (HAS_FEATURE(*features, VIRTIO_NET_F_MAC)) {
       ENABLE_FEATURE(*features, VIRTIO_NET_F_MAC);
   }
 }
@@ -56,6 +58,7 @@ void virtionet_send(void* driver, uint8_t *packet, uint16_t length)
 {
     struct virtio_device* dev = (struct virtio_device*)driver;
     struct virt_queue* vq = &dev->queues[1]; // Tx queue
+    struct ifqstat* st;
 
     uint32 virt_size = length + sizeof(struct virtio_net_hdr);
 
@@ -69,42 +72,118 @@ void virtionet_send(void* driver, uint8_t *packet, uint16_t length)
 
     desc[0].len = sizeof(struct virtio_net_hdr);
     desc[0].flags = 0;
-    desc[0].addr = &net;
-    desc[1].addr = packet;
-    desc[1].len = virt_size;
+    desc[0].addr = (uint32)&net;
+    desc[1].addr = (uint32)packet;
+    desc[1].len = length;
     desc[1].flags = 0;
 
-    virtio_fill_buffer(dev, 1, &desc, 2);
+    if (pcapon) {
+        pcap_capture(dev->nic, PCAP_TX, packet, length);
+    }
+
+    // The reflector sends from interrupt context, so the ring is
+    // shared with whatever process is sending at the same time.
+    acquire(&vq->lock);
+    st = nic_qstats(dev->nic, NIC_TXQ);
+
+    // Take back whatever the device has already sent before giving up
+    // on a full ring.
+    virtio_reclaim_used(vq);
+    if (virtio_fill_buffer(dev, 1, desc, 2) < 0) {
+        st->ringfull++;
+        st->drops++;
+    } else {
+        st->packets++;
+        st->bytes += length;
+        st->notifies++;
+    }
+    release(&vq->lock);
 }
 
 void virtionet_recv(void* driver, uint8_t* packet, uint16_t length)
 {}
 
-int virtio_init(int pci_fd)
+/*
+ * Interrupt handler for a network device. Frames the device has written
+ * into the receive queue are consumed and their buffers are put straight
+ * back on the available ring.
+ */
+void virtionet_intr(struct virtio_device* dev)
 {
-    int virt_fd = alloc_virt_dev(pci_fd);
-    conf_virtio_mem(virt_fd, &virtionet_negotiate);
-    init_macaddr(&virtdevs[virt_fd]);
+    struct virt_queue* rx = &dev->queues[0];
+    struct virt_queue* tx = &dev->queues[1];
+    struct ifqstat* st;
+    int received = 0;
+    uint16 id;
+    uint32 len;
+
+    if ((virtio_isr(dev) & 1) == 0) {
+        return;
+    }
+
+    st = nic_qstats(dev->nic, NIC_RXQ);
+
+    while (virtio_next_used(rx, &id, &len)) {
+        uint8* pkt = virtio_buffer(rx, id) + sizeof(struct virtio_net_hdr);
+
+        if (len < sizeof(struct virtio_net_hdr)) {
+            st->drops++;
+        } else if (dev->nic->filter.prog &&
+                   bpf_run(&dev->nic->filter, pkt, len - sizeof(struct virtio_net_hdr)) == 0) {
+            // Dropped by the interface filter before anything else
+            // looks at it.
+            st->drops++;
+        } else {
+            len -= sizeof(struct virtio_net_hdr);
+
+            st->packets++;
+            st->bytes += len;
+
+            if (pcapon) {
+                pcap_capture(dev->nic, PCAP_RX, pkt, len);
+            }
+
+            nic_rx(dev->nic, pkt, len);
+        }
 
-    struct virtio_device* dev = &virtdevs[virt_fd];
+        // Recycle the buffer in place.
+        virtio_requeue(rx, id);
+        received++;
+    }
+
+    if (received) {
+        st->intrs++;
+        st->notifies++;
+        virtio_kick(dev, 0);
+    }
+
+    acquire(&tx->lock);
+    if (virtio_reclaim_used(tx)) {
+        nic_qstats(dev->nic, NIC_TXQ)->intrs++;
+    }
+    release(&tx->lock);
+}
+
+int virtionet_init(struct virtio_device* dev)
+{
+    init_macaddr(dev);
 
     struct virt_queue* rx = &dev->queues[0]; // Receive
     struct virt_queue* tx = &dev->queues[1]; // Send
 
-    if (rx->buffers == 0 || tx->buffers == 0) {
+    if (rx->queue_size == 0 || tx->queue_size == 0) {
         cprintf("unable to initialize virtio device\n");
-        return virt_fd;
+        return -1;
     }
 
     rx->chunk_size = FRAME_SIZE;
-    rx->available->idx = 0;
     virtio_enable_intr(rx);
 
     // Fill up receive queue so that we can receive data.
     struct virtq_desc buffer;
     buffer.len = FRAME_SIZE;
     buffer.flags = VIRTQ_DESC_F_WRITE;
-    buffer.addr = 0; // This should be the physical address of the buffer.
+    buffer.addr = 0; // No data to copy, the device writes into the buffer.
 
     cprintf("Sending buffers to device\n");
     for (int i = 0; i < 10; i++) {
@@ -112,17 +191,27 @@ int virtio_init(int pci_fd)
     }
 
     tx->chunk_size = FRAME_SIZE;
-    tx->available->idx = 0;
-    notify_queue(dev, tx->num);
 
     picenable(dev->irq);
     ioapicenable(dev->irq, 0);
     ioapicenable(dev->irq, 1);
 
-    struct nic_device nic = { .driver = dev, .mac_addr = dev->macaddr, .send_packet = &virtionet_send, .recv_packet = &virtionet_recv };
+    struct nic_device nic = { .driver = dev, .send_packet = &virtionet_send, .recv_packet = &virtionet_recv };
+    memmove(nic.mac_addr, dev->macaddr, 6);
 
-    register_device(nic);
+    dev->nic = register_device(nic);
+    dev->intr = &virtionet_intr;
 
-    return virt_fd;
+    return 0;
 }
 
+/*
+ * Registers the driver with the virtio core, which calls virtionet_init
+ * for every network device it finds.
+ */
+void virtionetinit(void)
+{
+    virtio_drivers[NETWORK_CARD].name = "virtio-net";
+    virtio_drivers[NETWORK_CARD].negotiate = &virtionet_negotiate;
+    virtio_drivers[NETWORK_CARD].init = &virtionet_init;
+}
@@ -120,6 +120,7 @@ setupkvm(void)
 {
   pde_t *pgdir;
   struct kmap *k;
+  uint i;
 
   if((pgdir = (pde_t*)kalloc()) == 0)
     return 0;
@@ -132,6 +133,10 @@ setupkvm(void)
       freevm(pgdir);
       return 0;
     }
+  // Share the page tables of the ioremap window.
+  if(kpgdir)
+    for(i = PDX(IOREMAPBASE); i < PDX(DEVSPACE); i++)
+      pgdir[i] = kpgdir[i];
   return pgdir;
 }
 
@@ -144,6 +149,72 @@ kvmalloc(void)
   switchkvm();
 }
 
+// Next free address of the ioremap window.
+static uint ioremapnext = IOREMAPBASE;
+
+#define MSR_PAT     0x277
+#define CPUID_PAT   (1 << 16)   // cpuid leaf 1, edx
+
+// Page attribute table: the memory type of a page is entry
+// PAT<<2 | PCD<<1 | PWT. Entry 1 (PWT alone) selects write combining
+// instead of its power-on write through; the rest keep their power-on
+// types, so 0 is WB and 3 (PCD|PWT) is UC everywhere.
+#define PAT_WB      6
+#define PAT_WC      1
+#define PAT_UCMINUS 7
+#define PAT_UC      0
+#define PAT_VALUE   ((uint64_t)(PAT_WB | PAT_WC << 8 | PAT_UCMINUS << 16 | PAT_UC << 24) * 0x100000001ULL)
+
+static int havepat;   // write combining is available
+
+// Program the page attribute table of this CPU. Every CPU has to have
+// the same table, so the others do it in mpenter.
+void
+patinit(void)
+{
+  uint a, b, c, d;
+
+  cpuinfo(1, &a, &b, &c, &d);
+  if((d & CPUID_PAT) == 0)
+    return;
+  wrmsr(MSR_PAT, PAT_VALUE);
+  havepat = 1;
+}
+
+// Map the device memory at physical addresses pa..pa+size into the
+// ioremap window of the kernel page table as memory type `type`
+// (IOREMAP_UC, _WC or _WB), and return the virtual address of pa.
+// Write combining falls back to uncached without PAT. Returns 0 if
+// the window is full.
+// The window's page tables are shared by every page table setupkvm
+// makes, but only those that exist when it makes it, so this is for
+// use while booting, before the first process.
+void*
+ioremap(uint pa, uint size, int type)
+{
+  uint off, va;
+  int perm;
+
+  off = pa % PGSIZE;
+  pa -= off;
+  size = PGROUNDUP(size + off);
+  if(size == 0 || size > DEVSPACE - ioremapnext)
+    return 0;
+
+  if(type == IOREMAP_WB)
+    perm = PTE_W;
+  else if(type == IOREMAP_WC && havepat)
+    perm = PTE_W|PTE_PWT;
+  else
+    perm = PTE_W|PTE_PCD|PTE_PWT;
+
+  va = ioremapnext;
+  if(mappages(kpgdir, (void*)va, size, pa, perm) < 0)
+    return 0;
+  ioremapnext += size;
+  return (char*)va + off;
+}
+
 // Switch h/w page table register to the kernel-only page table,
 // for when no process is running.
 void
@@ -289,6 +360,8 @@ freevm(pde_t *pgdir)
     panic("freevm: no pgdir");
   deallocuvm(pgdir, KERNBASE, 0);
   for(i = 0; i < NPDENTRIES; i++){
+    if(i >= PDX(IOREMAPBASE) && i < PDX(DEVSPACE))
+      continue;  // shared with kpgdir
     if(pgdir[i] & PTE_P){
       char * v = P2V(PTE_ADDR(pgdir[i]));
       kfree(v);
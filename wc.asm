@@ -0,0 +1,1538 @@
+
+_wc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <wc>:
+
+char buf[512];
+
+void
+wc(int fd, char *name)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 28             	sub    $0x28,%esp
+  int i, n;
+  int l, w, c, inword;
+
+  l = w = c = 0;
+   6:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+   d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  10:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  13:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  16:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  inword = 0;
+  19:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+  20:	eb 69                	jmp    8b <wc+0x8b>
+    for(i=0; i<n; i++){
+  22:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  29:	eb 58                	jmp    83 <wc+0x83>
+      c++;
+  2b:	83 45 e8 01          	addl   $0x1,-0x18(%ebp)
+      if(buf[i] == '\n')
+  2f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  32:	05 80 13 00 00       	add    $0x1380,%eax
+  37:	0f b6 00             	movzbl (%eax),%eax
+  3a:	3c 0a                	cmp    $0xa,%al
+  3c:	75 04                	jne    42 <wc+0x42>
+        l++;
+  3e:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+      if(strchr(" \r\t\n\v", buf[i]))
+  42:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  45:	05 80 13 00 00       	add    $0x1380,%eax
+  4a:	0f b6 00             	movzbl (%eax),%eax
+  4d:	0f be c0             	movsbl %al,%eax
+  50:	83 ec 08             	sub    $0x8,%esp
+  53:	50                   	push   %eax
+  54:	68 02 0c 00 00       	push   $0xc02
+  59:	e8 f6 01 00 00       	call   254 <strchr>
+  5e:	83 c4 10             	add    $0x10,%esp
+  61:	85 c0                	test   %eax,%eax
+  63:	74 09                	je     6e <wc+0x6e>
+        inword = 0;
+  65:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  6c:	eb 11                	jmp    7f <wc+0x7f>
+      else if(!inword){
+  6e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  72:	75 0b                	jne    7f <wc+0x7f>
+        w++;
+  74:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+        inword = 1;
+  78:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+    for(i=0; i<n; i++){
+  7f:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  83:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  86:	3b 45 e0             	cmp    -0x20(%ebp),%eax
+  89:	7c a0                	jl     2b <wc+0x2b>
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+  8b:	83 ec 04             	sub    $0x4,%esp
+  8e:	68 00 02 00 00       	push   $0x200
+  93:	68 80 13 00 00       	push   $0x1380
+  98:	ff 75 08             	push   0x8(%ebp)
+  9b:	e8 e3 05 00 00       	call   683 <read>
+  a0:	83 c4 10             	add    $0x10,%esp
+  a3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  a6:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  aa:	0f 8f 72 ff ff ff    	jg     22 <wc+0x22>
+      }
+    }
+  }
+  if(n < 0){
+  b0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  b4:	79 17                	jns    cd <wc+0xcd>
+    printf(1, "wc: read error\n");
+  b6:	83 ec 08             	sub    $0x8,%esp
+  b9:	68 08 0c 00 00       	push   $0xc08
+  be:	6a 01                	push   $0x1
+  c0:	e8 62 07 00 00       	call   827 <printf>
+  c5:	83 c4 10             	add    $0x10,%esp
+    exit();
+  c8:	e8 9e 05 00 00       	call   66b <exit>
+  }
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+  cd:	83 ec 08             	sub    $0x8,%esp
+  d0:	ff 75 0c             	push   0xc(%ebp)
+  d3:	ff 75 e8             	push   -0x18(%ebp)
+  d6:	ff 75 ec             	push   -0x14(%ebp)
+  d9:	ff 75 f0             	push   -0x10(%ebp)
+  dc:	68 18 0c 00 00       	push   $0xc18
+  e1:	6a 01                	push   $0x1
+  e3:	e8 3f 07 00 00       	call   827 <printf>
+  e8:	83 c4 20             	add    $0x20,%esp
+}
+  eb:	90                   	nop
+  ec:	c9                   	leave
+  ed:	c3                   	ret
+
+000000ee <main>:
+
+int
+main(int argc, char *argv[])
+{
+  ee:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  f2:	83 e4 f0             	and    $0xfffffff0,%esp
+  f5:	ff 71 fc             	push   -0x4(%ecx)
+  f8:	55                   	push   %ebp
+  f9:	89 e5                	mov    %esp,%ebp
+  fb:	53                   	push   %ebx
+  fc:	51                   	push   %ecx
+  fd:	83 ec 10             	sub    $0x10,%esp
+ 100:	89 cb                	mov    %ecx,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+ 102:	83 3b 01             	cmpl   $0x1,(%ebx)
+ 105:	7f 17                	jg     11e <main+0x30>
+    wc(0, "");
+ 107:	83 ec 08             	sub    $0x8,%esp
+ 10a:	68 25 0c 00 00       	push   $0xc25
+ 10f:	6a 00                	push   $0x0
+ 111:	e8 ea fe ff ff       	call   0 <wc>
+ 116:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 119:	e8 4d 05 00 00       	call   66b <exit>
+  }
+
+  for(i = 1; i < argc; i++){
+ 11e:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+ 125:	e9 83 00 00 00       	jmp    1ad <main+0xbf>
+    if((fd = open(argv[i], 0)) < 0){
+ 12a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 12d:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 134:	8b 43 04             	mov    0x4(%ebx),%eax
+ 137:	01 d0                	add    %edx,%eax
+ 139:	8b 00                	mov    (%eax),%eax
+ 13b:	83 ec 08             	sub    $0x8,%esp
+ 13e:	6a 00                	push   $0x0
+ 140:	50                   	push   %eax
+ 141:	e8 65 05 00 00       	call   6ab <open>
+ 146:	83 c4 10             	add    $0x10,%esp
+ 149:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 14c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 150:	79 29                	jns    17b <main+0x8d>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+ 152:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 155:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 15c:	8b 43 04             	mov    0x4(%ebx),%eax
+ 15f:	01 d0                	add    %edx,%eax
+ 161:	8b 00                	mov    (%eax),%eax
+ 163:	83 ec 04             	sub    $0x4,%esp
+ 166:	50                   	push   %eax
+ 167:	68 26 0c 00 00       	push   $0xc26
+ 16c:	6a 01                	push   $0x1
+ 16e:	e8 b4 06 00 00       	call   827 <printf>
+ 173:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 176:	e8 f0 04 00 00       	call   66b <exit>
+    }
+    wc(fd, argv[i]);
+ 17b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 17e:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 185:	8b 43 04             	mov    0x4(%ebx),%eax
+ 188:	01 d0                	add    %edx,%eax
+ 18a:	8b 00                	mov    (%eax),%eax
+ 18c:	83 ec 08             	sub    $0x8,%esp
+ 18f:	50                   	push   %eax
+ 190:	ff 75 f0             	push   -0x10(%ebp)
+ 193:	e8 68 fe ff ff       	call   0 <wc>
+ 198:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+ 19b:	83 ec 0c             	sub    $0xc,%esp
+ 19e:	ff 75 f0             	push   -0x10(%ebp)
+ 1a1:	e8 ed 04 00 00       	call   693 <close>
+ 1a6:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < argc; i++){
+ 1a9:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 1ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1b0:	3b 03                	cmp    (%ebx),%eax
+ 1b2:	0f 8c 72 ff ff ff    	jl     12a <main+0x3c>
+  }
+  exit();
+ 1b8:	e8 ae 04 00 00       	call   66b <exit>
+
+000001bd <stosb>:
+}
+
+int
+stat(char *n, struct stat *st)
+{
+  int fd;
+ 1bd:	55                   	push   %ebp
+ 1be:	89 e5                	mov    %esp,%ebp
+ 1c0:	57                   	push   %edi
+ 1c1:	53                   	push   %ebx
+  int r;
+ 1c2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1c5:	8b 55 10             	mov    0x10(%ebp),%edx
+ 1c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1cb:	89 cb                	mov    %ecx,%ebx
+ 1cd:	89 df                	mov    %ebx,%edi
+ 1cf:	89 d1                	mov    %edx,%ecx
+ 1d1:	fc                   	cld
+ 1d2:	f3 aa                	rep stos %al,%es:(%edi)
+ 1d4:	89 ca                	mov    %ecx,%edx
+ 1d6:	89 fb                	mov    %edi,%ebx
+ 1d8:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 1db:	89 55 10             	mov    %edx,0x10(%ebp)
+
+  fd = open(n, O_RDONLY);
+  if(fd < 0)
+    return -1;
+ 1de:	90                   	nop
+ 1df:	5b                   	pop    %ebx
+ 1e0:	5f                   	pop    %edi
+ 1e1:	5d                   	pop    %ebp
+ 1e2:	c3                   	ret
+
+000001e3 <strcpy>:
+{
+ 1e3:	55                   	push   %ebp
+ 1e4:	89 e5                	mov    %esp,%ebp
+ 1e6:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 1e9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1ec:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 1ef:	90                   	nop
+ 1f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 1f3:	8d 42 01             	lea    0x1(%edx),%eax
+ 1f6:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 1f9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1fc:	8d 48 01             	lea    0x1(%eax),%ecx
+ 1ff:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 202:	0f b6 12             	movzbl (%edx),%edx
+ 205:	88 10                	mov    %dl,(%eax)
+ 207:	0f b6 00             	movzbl (%eax),%eax
+ 20a:	84 c0                	test   %al,%al
+ 20c:	75 e2                	jne    1f0 <strcpy+0xd>
+  return os;
+ 20e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 211:	c9                   	leave
+ 212:	c3                   	ret
+
+00000213 <strlen>:
+{
+ 213:	55                   	push   %ebp
+ 214:	89 e5                	mov    %esp,%ebp
+ 216:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 219:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 220:	eb 04                	jmp    226 <strlen+0x13>
+ 222:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 226:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 229:	8b 45 08             	mov    0x8(%ebp),%eax
+ 22c:	01 d0                	add    %edx,%eax
+ 22e:	0f b6 00             	movzbl (%eax),%eax
+ 231:	84 c0                	test   %al,%al
+ 233:	75 ed                	jne    222 <strlen+0xf>
+  return n;
+ 235:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 238:	c9                   	leave
+ 239:	c3                   	ret
+
+0000023a <memset>:
+{
+ 23a:	55                   	push   %ebp
+ 23b:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 23d:	8b 45 10             	mov    0x10(%ebp),%eax
+ 240:	50                   	push   %eax
+ 241:	ff 75 0c             	push   0xc(%ebp)
+ 244:	ff 75 08             	push   0x8(%ebp)
+ 247:	e8 71 ff ff ff       	call   1bd <stosb>
+ 24c:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 24f:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 252:	c9                   	leave
+ 253:	c3                   	ret
+
+00000254 <strchr>:
+{
+ 254:	55                   	push   %ebp
+ 255:	89 e5                	mov    %esp,%ebp
+ 257:	83 ec 04             	sub    $0x4,%esp
+ 25a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 25d:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 260:	eb 14                	jmp    276 <strchr+0x22>
+    if(*s == c)
+ 262:	8b 45 08             	mov    0x8(%ebp),%eax
+ 265:	0f b6 00             	movzbl (%eax),%eax
+ 268:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 26b:	75 05                	jne    272 <strchr+0x1e>
+      return (char*)s;
+ 26d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 270:	eb 13                	jmp    285 <strchr+0x31>
+  for(; *s; s++)
+ 272:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 276:	8b 45 08             	mov    0x8(%ebp),%eax
+ 279:	0f b6 00             	movzbl (%eax),%eax
+ 27c:	84 c0                	test   %al,%al
+ 27e:	75 e2                	jne    262 <strchr+0xe>
+  return 0;
+ 280:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 285:	c9                   	leave
+ 286:	c3                   	ret
+
+00000287 <gets>:
+{
+ 287:	55                   	push   %ebp
+ 288:	89 e5                	mov    %esp,%ebp
+ 28a:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 28d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 294:	eb 42                	jmp    2d8 <gets+0x51>
+    cc = read(0, &c, 1);
+ 296:	83 ec 04             	sub    $0x4,%esp
+ 299:	6a 01                	push   $0x1
+ 29b:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 29e:	50                   	push   %eax
+ 29f:	6a 00                	push   $0x0
+ 2a1:	e8 dd 03 00 00       	call   683 <read>
+ 2a6:	83 c4 10             	add    $0x10,%esp
+ 2a9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 2ac:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 2b0:	7e 33                	jle    2e5 <gets+0x5e>
+    buf[i++] = c;
+ 2b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2b5:	8d 50 01             	lea    0x1(%eax),%edx
+ 2b8:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 2bb:	89 c2                	mov    %eax,%edx
+ 2bd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c0:	01 c2                	add    %eax,%edx
+ 2c2:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2c6:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 2c8:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2cc:	3c 0a                	cmp    $0xa,%al
+ 2ce:	74 16                	je     2e6 <gets+0x5f>
+ 2d0:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2d4:	3c 0d                	cmp    $0xd,%al
+ 2d6:	74 0e                	je     2e6 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 2d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2db:	83 c0 01             	add    $0x1,%eax
+ 2de:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 2e1:	7f b3                	jg     296 <gets+0xf>
+ 2e3:	eb 01                	jmp    2e6 <gets+0x5f>
+      break;
+ 2e5:	90                   	nop
+  buf[i] = '\0';
+ 2e6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 2e9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ec:	01 d0                	add    %edx,%eax
+ 2ee:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 2f1:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2f4:	c9                   	leave
+ 2f5:	c3                   	ret
+
+000002f6 <stat>:
+{
+ 2f6:	55                   	push   %ebp
+ 2f7:	89 e5                	mov    %esp,%ebp
+ 2f9:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+ 2fc:	83 ec 08             	sub    $0x8,%esp
+ 2ff:	6a 00                	push   $0x0
+ 301:	ff 75 08             	push   0x8(%ebp)
+ 304:	e8 a2 03 00 00       	call   6ab <open>
+ 309:	83 c4 10             	add    $0x10,%esp
+ 30c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 30f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 313:	79 07                	jns    31c <stat+0x26>
+    return -1;
+ 315:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 31a:	eb 25                	jmp    341 <stat+0x4b>
+  r = fstat(fd, st);
+ 31c:	83 ec 08             	sub    $0x8,%esp
+ 31f:	ff 75 0c             	push   0xc(%ebp)
+ 322:	ff 75 f4             	push   -0xc(%ebp)
+ 325:	e8 99 03 00 00       	call   6c3 <fstat>
+ 32a:	83 c4 10             	add    $0x10,%esp
+ 32d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 330:	83 ec 0c             	sub    $0xc,%esp
+ 333:	ff 75 f4             	push   -0xc(%ebp)
+ 336:	e8 58 03 00 00       	call   693 <close>
+ 33b:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 33e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 341:	c9                   	leave
+ 342:	c3                   	ret
+
+00000343 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 343:	55                   	push   %ebp
+ 344:	89 e5                	mov    %esp,%ebp
+ 346:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+
+  dst = vdst;
+ 349:	8b 45 08             	mov    0x8(%ebp),%eax
+ 34c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 34f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 352:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 355:	eb 17                	jmp    36e <memmove+0x2b>
+    *dst++ = *src++;
+ 357:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 35a:	8d 42 01             	lea    0x1(%edx),%eax
+ 35d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 360:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 363:	8d 48 01             	lea    0x1(%eax),%ecx
+ 366:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 369:	0f b6 12             	movzbl (%edx),%edx
+ 36c:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 36e:	8b 45 10             	mov    0x10(%ebp),%eax
+ 371:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 374:	89 55 10             	mov    %edx,0x10(%ebp)
+ 377:	85 c0                	test   %eax,%eax
+ 379:	7f dc                	jg     357 <memmove+0x14>
+  return vdst;
+ 37b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 37e:	c9                   	leave
+ 37f:	c3                   	ret
+
+00000380 <cpuinfo>:
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	56                   	push   %esi
+ 384:	53                   	push   %ebx
+ 385:	8b 45 08             	mov    0x8(%ebp),%eax
+ 388:	ba 00 00 00 00       	mov    $0x0,%edx
+ 38d:	89 d1                	mov    %edx,%ecx
+ 38f:	0f a2                	cpuid
+ 391:	89 c6                	mov    %eax,%esi
+ 393:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 396:	89 30                	mov    %esi,(%eax)
+ 398:	8b 45 10             	mov    0x10(%ebp),%eax
+ 39b:	89 18                	mov    %ebx,(%eax)
+ 39d:	8b 45 14             	mov    0x14(%ebp),%eax
+ 3a0:	89 08                	mov    %ecx,(%eax)
+ 3a2:	8b 45 18             	mov    0x18(%ebp),%eax
+ 3a5:	89 10                	mov    %edx,(%eax)
+ 3a7:	90                   	nop
+ 3a8:	5b                   	pop    %ebx
+ 3a9:	5e                   	pop    %esi
+ 3aa:	5d                   	pop    %ebp
+ 3ab:	c3                   	ret
+
+000003ac <atoi>:
+{
+ 3ac:	55                   	push   %ebp
+ 3ad:	89 e5                	mov    %esp,%ebp
+ 3af:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+ 3b2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 3b9:	eb 25                	jmp    3e0 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 3bb:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 3be:	89 d0                	mov    %edx,%eax
+ 3c0:	c1 e0 02             	shl    $0x2,%eax
+ 3c3:	01 d0                	add    %edx,%eax
+ 3c5:	01 c0                	add    %eax,%eax
+ 3c7:	89 c1                	mov    %eax,%ecx
+ 3c9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3cc:	8d 50 01             	lea    0x1(%eax),%edx
+ 3cf:	89 55 08             	mov    %edx,0x8(%ebp)
+ 3d2:	0f b6 00             	movzbl (%eax),%eax
+ 3d5:	0f be c0             	movsbl %al,%eax
+ 3d8:	01 c8                	add    %ecx,%eax
+ 3da:	83 e8 30             	sub    $0x30,%eax
+ 3dd:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 3e0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e3:	0f b6 00             	movzbl (%eax),%eax
+ 3e6:	3c 2f                	cmp    $0x2f,%al
+ 3e8:	7e 0a                	jle    3f4 <atoi+0x48>
+ 3ea:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3ed:	0f b6 00             	movzbl (%eax),%eax
+ 3f0:	3c 39                	cmp    $0x39,%al
+ 3f2:	7e c7                	jle    3bb <atoi+0xf>
+  return n;
+ 3f4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3f7:	c9                   	leave
+ 3f8:	c3                   	ret
+
+000003f9 <strcmp>:
+{
+ 3f9:	55                   	push   %ebp
+ 3fa:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 3fc:	eb 08                	jmp    406 <strcmp+0xd>
+    p++, q++;
+ 3fe:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 402:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 406:	8b 45 08             	mov    0x8(%ebp),%eax
+ 409:	0f b6 00             	movzbl (%eax),%eax
+ 40c:	84 c0                	test   %al,%al
+ 40e:	74 10                	je     420 <strcmp+0x27>
+ 410:	8b 45 08             	mov    0x8(%ebp),%eax
+ 413:	0f b6 10             	movzbl (%eax),%edx
+ 416:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 419:	0f b6 00             	movzbl (%eax),%eax
+ 41c:	38 c2                	cmp    %al,%dl
+ 41e:	74 de                	je     3fe <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 420:	8b 45 08             	mov    0x8(%ebp),%eax
+ 423:	0f b6 00             	movzbl (%eax),%eax
+ 426:	0f b6 d0             	movzbl %al,%edx
+ 429:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 42c:	0f b6 00             	movzbl (%eax),%eax
+ 42f:	0f b6 c0             	movzbl %al,%eax
+ 432:	29 c2                	sub    %eax,%edx
+ 434:	89 d0                	mov    %edx,%eax
+}
+ 436:	5d                   	pop    %ebp
+ 437:	c3                   	ret
+
+00000438 <udiv64>:
+{
+ 438:	55                   	push   %ebp
+ 439:	89 e5                	mov    %esp,%ebp
+ 43b:	57                   	push   %edi
+ 43c:	56                   	push   %esi
+ 43d:	83 ec 38             	sub    $0x38,%esp
+ 440:	8b 45 08             	mov    0x8(%ebp),%eax
+ 443:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 446:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 449:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 44c:	8b 45 10             	mov    0x10(%ebp),%eax
+ 44f:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 452:	8b 45 14             	mov    0x14(%ebp),%eax
+ 455:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  q = r = 0;
+ 458:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 45f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 466:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 469:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 46c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 46f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 472:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 479:	e9 85 00 00 00       	jmp    503 <udiv64+0xcb>
+    r = (r << 1) | ((n >> i) & 1);
+ 47e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 481:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 484:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 488:	01 c0                	add    %eax,%eax
+ 48a:	89 c6                	mov    %eax,%esi
+ 48c:	89 d7                	mov    %edx,%edi
+ 48e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 491:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 494:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 497:	0f ad d0             	shrd   %cl,%edx,%eax
+ 49a:	d3 ea                	shr    %cl,%edx
+ 49c:	f6 c1 20             	test   $0x20,%cl
+ 49f:	74 04                	je     4a5 <udiv64+0x6d>
+ 4a1:	89 d0                	mov    %edx,%eax
+ 4a3:	31 d2                	xor    %edx,%edx
+ 4a5:	83 e0 01             	and    $0x1,%eax
+ 4a8:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 4ab:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+ 4b2:	89 f0                	mov    %esi,%eax
+ 4b4:	89 fa                	mov    %edi,%edx
+ 4b6:	0b 45 c0             	or     -0x40(%ebp),%eax
+ 4b9:	0b 55 c4             	or     -0x3c(%ebp),%edx
+ 4bc:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 4bf:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 4c2:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 4c5:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 4c8:	3b 45 c8             	cmp    -0x38(%ebp),%eax
+ 4cb:	89 d0                	mov    %edx,%eax
+ 4cd:	1b 45 cc             	sbb    -0x34(%ebp),%eax
+ 4d0:	72 2d                	jb     4ff <udiv64+0xc7>
+      r -= d;
+ 4d2:	8b 45 c8             	mov    -0x38(%ebp),%eax
+ 4d5:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 4d8:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 4db:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64_t)1 << i;
+ 4de:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 4e1:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4e6:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4eb:	0f a5 c2             	shld   %cl,%eax,%edx
+ 4ee:	d3 e0                	shl    %cl,%eax
+ 4f0:	f6 c1 20             	test   $0x20,%cl
+ 4f3:	74 04                	je     4f9 <udiv64+0xc1>
+ 4f5:	89 c2                	mov    %eax,%edx
+ 4f7:	31 c0                	xor    %eax,%eax
+ 4f9:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 4fc:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 4ff:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 503:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 507:	0f 89 71 ff ff ff    	jns    47e <udiv64+0x46>
+  if(rem)
+ 50d:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+ 511:	74 0e                	je     521 <udiv64+0xe9>
+    *rem = r;
+ 513:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 516:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 519:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 51c:	89 01                	mov    %eax,(%ecx)
+ 51e:	89 51 04             	mov    %edx,0x4(%ecx)
+  return q;
+ 521:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 524:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 527:	83 c4 38             	add    $0x38,%esp
+ 52a:	5e                   	pop    %esi
+ 52b:	5f                   	pop    %edi
+ 52c:	5d                   	pop    %ebp
+ 52d:	c3                   	ret
+
+0000052e <crc32cinit>:
+{
+ 52e:	55                   	push   %ebp
+ 52f:	89 e5                	mov    %esp,%ebp
+ 531:	83 ec 20             	sub    $0x20,%esp
+  for(i = 0; i < 256; i++){
+ 534:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 53b:	eb 4c                	jmp    589 <crc32cinit+0x5b>
+    r = i;
+ 53d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 540:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+ 543:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+ 54a:	eb 26                	jmp    572 <crc32cinit+0x44>
+      r = (r >> 1) ^ ((r & 1) ? CRC32C_POLY : 0);
+ 54c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 54f:	d1 e8                	shr    %eax
+ 551:	89 c2                	mov    %eax,%edx
+ 553:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 556:	83 e0 01             	and    $0x1,%eax
+ 559:	85 c0                	test   %eax,%eax
+ 55b:	74 07                	je     564 <crc32cinit+0x36>
+ 55d:	b8 78 3b f6 82       	mov    $0x82f63b78,%eax
+ 562:	eb 05                	jmp    569 <crc32cinit+0x3b>
+ 564:	b8 00 00 00 00       	mov    $0x0,%eax
+ 569:	31 d0                	xor    %edx,%eax
+ 56b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+ 56e:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+ 572:	83 7d f8 07          	cmpl   $0x7,-0x8(%ebp)
+ 576:	76 d4                	jbe    54c <crc32cinit+0x1e>
+    crc32ctab[i] = r;
+ 578:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 57b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 57e:	89 14 85 60 0f 00 00 	mov    %edx,0xf60(,%eax,4)
+  for(i = 0; i < 256; i++){
+ 585:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 589:	81 7d fc ff 00 00 00 	cmpl   $0xff,-0x4(%ebp)
+ 590:	76 ab                	jbe    53d <crc32cinit+0xf>
+  cpuinfo(1, &a, &b, &c, &d);
+ 592:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 595:	50                   	push   %eax
+ 596:	8d 45 e8             	lea    -0x18(%ebp),%eax
+ 599:	50                   	push   %eax
+ 59a:	8d 45 ec             	lea    -0x14(%ebp),%eax
+ 59d:	50                   	push   %eax
+ 59e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 5a1:	50                   	push   %eax
+ 5a2:	6a 01                	push   $0x1
+ 5a4:	e8 d7 fd ff ff       	call   380 <cpuinfo>
+ 5a9:	83 c4 14             	add    $0x14,%esp
+  crc32chw = (c & CPUID_SSE42) != 0;
+ 5ac:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5af:	25 00 00 10 00       	and    $0x100000,%eax
+ 5b4:	85 c0                	test   %eax,%eax
+ 5b6:	0f 95 c0             	setne  %al
+ 5b9:	0f b6 c0             	movzbl %al,%eax
+ 5bc:	a3 3c 0f 00 00       	mov    %eax,0xf3c
+}
+ 5c1:	90                   	nop
+ 5c2:	c9                   	leave
+ 5c3:	c3                   	ret
+
+000005c4 <crc32c>:
+{
+ 5c4:	55                   	push   %ebp
+ 5c5:	89 e5                	mov    %esp,%ebp
+ 5c7:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s = p;
+ 5ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5cd:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(crc32chw < 0)
+ 5d0:	a1 3c 0f 00 00       	mov    0xf3c,%eax
+ 5d5:	85 c0                	test   %eax,%eax
+ 5d7:	79 05                	jns    5de <crc32c+0x1a>
+    crc32cinit();
+ 5d9:	e8 50 ff ff ff       	call   52e <crc32cinit>
+  crc = ~crc;
+ 5de:	f7 55 08             	notl   0x8(%ebp)
+  if(crc32chw){
+ 5e1:	a1 3c 0f 00 00       	mov    0xf3c,%eax
+ 5e6:	85 c0                	test   %eax,%eax
+ 5e8:	74 6c                	je     656 <crc32c+0x92>
+    for(; n >= 4; n -= 4, s += 4)
+ 5ea:	eb 18                	jmp    604 <crc32c+0x40>
+      asm("crc32l %1, %0" : "+r" (crc) : "rm" (*(const uint*)s));
+ 5ec:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 5ef:	8b 10                	mov    (%eax),%edx
+ 5f1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5f4:	f2 0f 38 f1 c2       	crc32  %edx,%eax
+ 5f9:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n >= 4; n -= 4, s += 4)
+ 5fc:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+ 600:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+ 604:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+ 608:	77 e2                	ja     5ec <crc32c+0x28>
+    for(; n > 0; n--, s++)
+ 60a:	eb 19                	jmp    625 <crc32c+0x61>
+      asm("crc32b %1, %0" : "+r" (crc) : "qm" (*s));
+ 60c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 60f:	0f b6 10             	movzbl (%eax),%edx
+ 612:	8b 45 08             	mov    0x8(%ebp),%eax
+ 615:	f2 0f 38 f0 c2       	crc32  %dl,%eax
+ 61a:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+ 61d:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+ 621:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 625:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 629:	75 e1                	jne    60c <crc32c+0x48>
+ 62b:	eb 2f                	jmp    65c <crc32c+0x98>
+      crc = crc32ctab[(crc ^ *s) & 0xff] ^ (crc >> 8);
+ 62d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 630:	0f b6 00             	movzbl (%eax),%eax
+ 633:	0f b6 c0             	movzbl %al,%eax
+ 636:	33 45 08             	xor    0x8(%ebp),%eax
+ 639:	0f b6 c0             	movzbl %al,%eax
+ 63c:	8b 04 85 60 0f 00 00 	mov    0xf60(,%eax,4),%eax
+ 643:	8b 55 08             	mov    0x8(%ebp),%edx
+ 646:	c1 ea 08             	shr    $0x8,%edx
+ 649:	31 d0                	xor    %edx,%eax
+ 64b:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+ 64e:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+ 652:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 656:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 65a:	75 d1                	jne    62d <crc32c+0x69>
+  return ~crc;
+ 65c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 65f:	f7 d0                	not    %eax
+}
+ 661:	c9                   	leave
+ 662:	c3                   	ret
+
+00000663 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 663:	b8 01 00 00 00       	mov    $0x1,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <exit>:
+SYSCALL(exit)
+ 66b:	b8 02 00 00 00       	mov    $0x2,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <wait>:
+SYSCALL(wait)
+ 673:	b8 03 00 00 00       	mov    $0x3,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+
+0000067b <pipe>:
+SYSCALL(pipe)
+ 67b:	b8 04 00 00 00       	mov    $0x4,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <read>:
+SYSCALL(read)
+ 683:	b8 05 00 00 00       	mov    $0x5,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <write>:
+SYSCALL(write)
+ 68b:	b8 10 00 00 00       	mov    $0x10,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <close>:
+SYSCALL(close)
+ 693:	b8 15 00 00 00       	mov    $0x15,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <kill>:
+SYSCALL(kill)
+ 69b:	b8 06 00 00 00       	mov    $0x6,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <exec>:
+SYSCALL(exec)
+ 6a3:	b8 07 00 00 00       	mov    $0x7,%eax
+ 6a8:	cd 40                	int    $0x40
+ 6aa:	c3                   	ret
+
+000006ab <open>:
+SYSCALL(open)
+ 6ab:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <mknod>:
+SYSCALL(mknod)
+ 6b3:	b8 11 00 00 00       	mov    $0x11,%eax
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+
+000006bb <unlink>:
+SYSCALL(unlink)
+ 6bb:	b8 12 00 00 00       	mov    $0x12,%eax
+ 6c0:	cd 40                	int    $0x40
+ 6c2:	c3                   	ret
+
+000006c3 <fstat>:
+SYSCALL(fstat)
+ 6c3:	b8 08 00 00 00       	mov    $0x8,%eax
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+
+000006cb <link>:
+SYSCALL(link)
+ 6cb:	b8 13 00 00 00       	mov    $0x13,%eax
+ 6d0:	cd 40                	int    $0x40
+ 6d2:	c3                   	ret
+
+000006d3 <mkdir>:
+SYSCALL(mkdir)
+ 6d3:	b8 14 00 00 00       	mov    $0x14,%eax
+ 6d8:	cd 40                	int    $0x40
+ 6da:	c3                   	ret
+
+000006db <chdir>:
+SYSCALL(chdir)
+ 6db:	b8 09 00 00 00       	mov    $0x9,%eax
+ 6e0:	cd 40                	int    $0x40
+ 6e2:	c3                   	ret
+
+000006e3 <dup>:
+SYSCALL(dup)
+ 6e3:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 6e8:	cd 40                	int    $0x40
+ 6ea:	c3                   	ret
+
+000006eb <getpid>:
+SYSCALL(getpid)
+ 6eb:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 6f0:	cd 40                	int    $0x40
+ 6f2:	c3                   	ret
+
+000006f3 <sbrk>:
+SYSCALL(sbrk)
+ 6f3:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 6f8:	cd 40                	int    $0x40
+ 6fa:	c3                   	ret
+
+000006fb <sleep>:
+SYSCALL(sleep)
+ 6fb:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 700:	cd 40                	int    $0x40
+ 702:	c3                   	ret
+
+00000703 <uptime>:
+SYSCALL(uptime)
+ 703:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 708:	cd 40                	int    $0x40
+ 70a:	c3                   	ret
+
+0000070b <arp>:
+SYSCALL(arp)
+ 70b:	b8 16 00 00 00       	mov    $0x16,%eax
+ 710:	cd 40                	int    $0x40
+ 712:	c3                   	ret
+
+00000713 <ifstat>:
+SYSCALL(ifstat)
+ 713:	b8 17 00 00 00       	mov    $0x17,%eax
+ 718:	cd 40                	int    $0x40
+ 71a:	c3                   	ret
+
+0000071b <pcapctl>:
+SYSCALL(pcapctl)
+ 71b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 720:	cd 40                	int    $0x40
+ 722:	c3                   	ret
+
+00000723 <pcapread>:
+SYSCALL(pcapread)
+ 723:	b8 19 00 00 00       	mov    $0x19,%eax
+ 728:	cd 40                	int    $0x40
+ 72a:	c3                   	ret
+
+0000072b <bpfattach>:
+SYSCALL(bpfattach)
+ 72b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 730:	cd 40                	int    $0x40
+ 732:	c3                   	ret
+
+00000733 <pktgen>:
+SYSCALL(pktgen)
+ 733:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 738:	cd 40                	int    $0x40
+ 73a:	c3                   	ret
+
+0000073b <reflect>:
+SYSCALL(reflect)
+ 73b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 740:	cd 40                	int    $0x40
+ 742:	c3                   	ret
+
+00000743 <brctl>:
+SYSCALL(brctl)
+ 743:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 748:	cd 40                	int    $0x40
+ 74a:	c3                   	ret
+
+0000074b <hostopen>:
+SYSCALL(hostopen)
+ 74b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 750:	cd 40                	int    $0x40
+ 752:	c3                   	ret
+
+00000753 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 753:	55                   	push   %ebp
+ 754:	89 e5                	mov    %esp,%ebp
+ 756:	83 ec 18             	sub    $0x18,%esp
+ 759:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 75c:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 75f:	83 ec 04             	sub    $0x4,%esp
+ 762:	6a 01                	push   $0x1
+ 764:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 767:	50                   	push   %eax
+ 768:	ff 75 08             	push   0x8(%ebp)
+ 76b:	e8 1b ff ff ff       	call   68b <write>
+ 770:	83 c4 10             	add    $0x10,%esp
+}
+ 773:	90                   	nop
+ 774:	c9                   	leave
+ 775:	c3                   	ret
+
+00000776 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 776:	55                   	push   %ebp
+ 777:	89 e5                	mov    %esp,%ebp
+ 779:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 77c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 783:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 787:	74 17                	je     7a0 <printint+0x2a>
+ 789:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 78d:	79 11                	jns    7a0 <printint+0x2a>
+    neg = 1;
+ 78f:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 796:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 799:	f7 d8                	neg    %eax
+ 79b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 79e:	eb 06                	jmp    7a6 <printint+0x30>
+  } else {
+    x = xx;
+ 7a0:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7a3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 7a6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 7ad:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 7b0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 7b3:	ba 00 00 00 00       	mov    $0x0,%edx
+ 7b8:	f7 f1                	div    %ecx
+ 7ba:	89 d1                	mov    %edx,%ecx
+ 7bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7bf:	8d 50 01             	lea    0x1(%eax),%edx
+ 7c2:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 7c5:	0f b6 91 40 0f 00 00 	movzbl 0xf40(%ecx),%edx
+ 7cc:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 7d0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 7d3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 7d6:	ba 00 00 00 00       	mov    $0x0,%edx
+ 7db:	f7 f1                	div    %ecx
+ 7dd:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 7e0:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 7e4:	75 c7                	jne    7ad <printint+0x37>
+  if(neg)
+ 7e6:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 7ea:	74 2d                	je     819 <printint+0xa3>
+    buf[i++] = '-';
+ 7ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7ef:	8d 50 01             	lea    0x1(%eax),%edx
+ 7f2:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 7f5:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 7fa:	eb 1d                	jmp    819 <printint+0xa3>
+    putc(fd, buf[i]);
+ 7fc:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 7ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 802:	01 d0                	add    %edx,%eax
+ 804:	0f b6 00             	movzbl (%eax),%eax
+ 807:	0f be c0             	movsbl %al,%eax
+ 80a:	83 ec 08             	sub    $0x8,%esp
+ 80d:	50                   	push   %eax
+ 80e:	ff 75 08             	push   0x8(%ebp)
+ 811:	e8 3d ff ff ff       	call   753 <putc>
+ 816:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 819:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 81d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 821:	79 d9                	jns    7fc <printint+0x86>
+}
+ 823:	90                   	nop
+ 824:	90                   	nop
+ 825:	c9                   	leave
+ 826:	c3                   	ret
+
+00000827 <printf>:
+
+// Print to the given fd. Only understands %d, %u, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 827:	55                   	push   %ebp
+ 828:	89 e5                	mov    %esp,%ebp
+ 82a:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 82d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 834:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 837:	83 c0 04             	add    $0x4,%eax
+ 83a:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 83d:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 844:	e9 7d 01 00 00       	jmp    9c6 <printf+0x19f>
+    c = fmt[i] & 0xff;
+ 849:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 84c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 84f:	01 d0                	add    %edx,%eax
+ 851:	0f b6 00             	movzbl (%eax),%eax
+ 854:	0f be c0             	movsbl %al,%eax
+ 857:	25 ff 00 00 00       	and    $0xff,%eax
+ 85c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 85f:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 863:	75 2c                	jne    891 <printf+0x6a>
+      if(c == '%'){
+ 865:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 869:	75 0c                	jne    877 <printf+0x50>
+        state = '%';
+ 86b:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 872:	e9 4b 01 00 00       	jmp    9c2 <printf+0x19b>
+      } else {
+        putc(fd, c);
+ 877:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 87a:	0f be c0             	movsbl %al,%eax
+ 87d:	83 ec 08             	sub    $0x8,%esp
+ 880:	50                   	push   %eax
+ 881:	ff 75 08             	push   0x8(%ebp)
+ 884:	e8 ca fe ff ff       	call   753 <putc>
+ 889:	83 c4 10             	add    $0x10,%esp
+ 88c:	e9 31 01 00 00       	jmp    9c2 <printf+0x19b>
+      }
+    } else if(state == '%'){
+ 891:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 895:	0f 85 27 01 00 00    	jne    9c2 <printf+0x19b>
+      if(c == 'd'){
+ 89b:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 89f:	75 1e                	jne    8bf <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 8a1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8a4:	8b 00                	mov    (%eax),%eax
+ 8a6:	6a 01                	push   $0x1
+ 8a8:	6a 0a                	push   $0xa
+ 8aa:	50                   	push   %eax
+ 8ab:	ff 75 08             	push   0x8(%ebp)
+ 8ae:	e8 c3 fe ff ff       	call   776 <printint>
+ 8b3:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 8b6:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 8ba:	e9 fc 00 00 00       	jmp    9bb <printf+0x194>
+      } else if(c == 'u'){
+ 8bf:	83 7d e4 75          	cmpl   $0x75,-0x1c(%ebp)
+ 8c3:	75 1e                	jne    8e3 <printf+0xbc>
+        printint(fd, *ap, 10, 0);
+ 8c5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8c8:	8b 00                	mov    (%eax),%eax
+ 8ca:	6a 00                	push   $0x0
+ 8cc:	6a 0a                	push   $0xa
+ 8ce:	50                   	push   %eax
+ 8cf:	ff 75 08             	push   0x8(%ebp)
+ 8d2:	e8 9f fe ff ff       	call   776 <printint>
+ 8d7:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 8da:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 8de:	e9 d8 00 00 00       	jmp    9bb <printf+0x194>
+      } else if(c == 'x' || c == 'p'){
+ 8e3:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 8e7:	74 06                	je     8ef <printf+0xc8>
+ 8e9:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 8ed:	75 1e                	jne    90d <printf+0xe6>
+        printint(fd, *ap, 16, 0);
+ 8ef:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8f2:	8b 00                	mov    (%eax),%eax
+ 8f4:	6a 00                	push   $0x0
+ 8f6:	6a 10                	push   $0x10
+ 8f8:	50                   	push   %eax
+ 8f9:	ff 75 08             	push   0x8(%ebp)
+ 8fc:	e8 75 fe ff ff       	call   776 <printint>
+ 901:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 904:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 908:	e9 ae 00 00 00       	jmp    9bb <printf+0x194>
+      } else if(c == 's'){
+ 90d:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 911:	75 43                	jne    956 <printf+0x12f>
+        s = (char*)*ap;
+ 913:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 916:	8b 00                	mov    (%eax),%eax
+ 918:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 91b:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 91f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 923:	75 25                	jne    94a <printf+0x123>
+          s = "(null)";
+ 925:	c7 45 f4 3a 0c 00 00 	movl   $0xc3a,-0xc(%ebp)
+        while(*s != 0){
+ 92c:	eb 1c                	jmp    94a <printf+0x123>
+          putc(fd, *s);
+ 92e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 931:	0f b6 00             	movzbl (%eax),%eax
+ 934:	0f be c0             	movsbl %al,%eax
+ 937:	83 ec 08             	sub    $0x8,%esp
+ 93a:	50                   	push   %eax
+ 93b:	ff 75 08             	push   0x8(%ebp)
+ 93e:	e8 10 fe ff ff       	call   753 <putc>
+ 943:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 946:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 94a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 94d:	0f b6 00             	movzbl (%eax),%eax
+ 950:	84 c0                	test   %al,%al
+ 952:	75 da                	jne    92e <printf+0x107>
+ 954:	eb 65                	jmp    9bb <printf+0x194>
+        }
+      } else if(c == 'c'){
+ 956:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 95a:	75 1d                	jne    979 <printf+0x152>
+        putc(fd, *ap);
+ 95c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 95f:	8b 00                	mov    (%eax),%eax
+ 961:	0f be c0             	movsbl %al,%eax
+ 964:	83 ec 08             	sub    $0x8,%esp
+ 967:	50                   	push   %eax
+ 968:	ff 75 08             	push   0x8(%ebp)
+ 96b:	e8 e3 fd ff ff       	call   753 <putc>
+ 970:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 973:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 977:	eb 42                	jmp    9bb <printf+0x194>
+      } else if(c == '%'){
+ 979:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 97d:	75 17                	jne    996 <printf+0x16f>
+        putc(fd, c);
+ 97f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 982:	0f be c0             	movsbl %al,%eax
+ 985:	83 ec 08             	sub    $0x8,%esp
+ 988:	50                   	push   %eax
+ 989:	ff 75 08             	push   0x8(%ebp)
+ 98c:	e8 c2 fd ff ff       	call   753 <putc>
+ 991:	83 c4 10             	add    $0x10,%esp
+ 994:	eb 25                	jmp    9bb <printf+0x194>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 996:	83 ec 08             	sub    $0x8,%esp
+ 999:	6a 25                	push   $0x25
+ 99b:	ff 75 08             	push   0x8(%ebp)
+ 99e:	e8 b0 fd ff ff       	call   753 <putc>
+ 9a3:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 9a6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9a9:	0f be c0             	movsbl %al,%eax
+ 9ac:	83 ec 08             	sub    $0x8,%esp
+ 9af:	50                   	push   %eax
+ 9b0:	ff 75 08             	push   0x8(%ebp)
+ 9b3:	e8 9b fd ff ff       	call   753 <putc>
+ 9b8:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 9bb:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 9c2:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 9c6:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 9c9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9cc:	01 d0                	add    %edx,%eax
+ 9ce:	0f b6 00             	movzbl (%eax),%eax
+ 9d1:	84 c0                	test   %al,%al
+ 9d3:	0f 85 70 fe ff ff    	jne    849 <printf+0x22>
+    }
+  }
+}
+ 9d9:	90                   	nop
+ 9da:	90                   	nop
+ 9db:	c9                   	leave
+ 9dc:	c3                   	ret
+
+000009dd <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 9dd:	55                   	push   %ebp
+ 9de:	89 e5                	mov    %esp,%ebp
+ 9e0:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 9e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9e6:	83 e8 08             	sub    $0x8,%eax
+ 9e9:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9ec:	a1 68 13 00 00       	mov    0x1368,%eax
+ 9f1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 9f4:	eb 24                	jmp    a1a <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9f6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9f9:	8b 00                	mov    (%eax),%eax
+ 9fb:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 9fe:	72 12                	jb     a12 <free+0x35>
+ a00:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a03:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a06:	72 24                	jb     a2c <free+0x4f>
+ a08:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a0b:	8b 00                	mov    (%eax),%eax
+ a0d:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a10:	72 1a                	jb     a2c <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a12:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a15:	8b 00                	mov    (%eax),%eax
+ a17:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ a1a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a1d:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a20:	73 d4                	jae    9f6 <free+0x19>
+ a22:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a25:	8b 00                	mov    (%eax),%eax
+ a27:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a2a:	73 ca                	jae    9f6 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a2c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a2f:	8b 40 04             	mov    0x4(%eax),%eax
+ a32:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ a39:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a3c:	01 c2                	add    %eax,%edx
+ a3e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a41:	8b 00                	mov    (%eax),%eax
+ a43:	39 c2                	cmp    %eax,%edx
+ a45:	75 24                	jne    a6b <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ a47:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a4a:	8b 50 04             	mov    0x4(%eax),%edx
+ a4d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a50:	8b 00                	mov    (%eax),%eax
+ a52:	8b 40 04             	mov    0x4(%eax),%eax
+ a55:	01 c2                	add    %eax,%edx
+ a57:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a5a:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a5d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a60:	8b 00                	mov    (%eax),%eax
+ a62:	8b 10                	mov    (%eax),%edx
+ a64:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a67:	89 10                	mov    %edx,(%eax)
+ a69:	eb 0a                	jmp    a75 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ a6b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a6e:	8b 10                	mov    (%eax),%edx
+ a70:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a73:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ a75:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a78:	8b 40 04             	mov    0x4(%eax),%eax
+ a7b:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ a82:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a85:	01 d0                	add    %edx,%eax
+ a87:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a8a:	75 20                	jne    aac <free+0xcf>
+    p->s.size += bp->s.size;
+ a8c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a8f:	8b 50 04             	mov    0x4(%eax),%edx
+ a92:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a95:	8b 40 04             	mov    0x4(%eax),%eax
+ a98:	01 c2                	add    %eax,%edx
+ a9a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a9d:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ aa0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ aa3:	8b 10                	mov    (%eax),%edx
+ aa5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ aa8:	89 10                	mov    %edx,(%eax)
+ aaa:	eb 08                	jmp    ab4 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ aac:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ aaf:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ ab2:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ ab4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ab7:	a3 68 13 00 00       	mov    %eax,0x1368
+}
+ abc:	90                   	nop
+ abd:	c9                   	leave
+ abe:	c3                   	ret
+
+00000abf <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ abf:	55                   	push   %ebp
+ ac0:	89 e5                	mov    %esp,%ebp
+ ac2:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ ac5:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ acc:	77 07                	ja     ad5 <morecore+0x16>
+    nu = 4096;
+ ace:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ ad5:	8b 45 08             	mov    0x8(%ebp),%eax
+ ad8:	c1 e0 03             	shl    $0x3,%eax
+ adb:	83 ec 0c             	sub    $0xc,%esp
+ ade:	50                   	push   %eax
+ adf:	e8 0f fc ff ff       	call   6f3 <sbrk>
+ ae4:	83 c4 10             	add    $0x10,%esp
+ ae7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ aea:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ aee:	75 07                	jne    af7 <morecore+0x38>
+    return 0;
+ af0:	b8 00 00 00 00       	mov    $0x0,%eax
+ af5:	eb 26                	jmp    b1d <morecore+0x5e>
+  hp = (Header*)p;
+ af7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ afa:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ afd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b00:	8b 55 08             	mov    0x8(%ebp),%edx
+ b03:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ b06:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b09:	83 c0 08             	add    $0x8,%eax
+ b0c:	83 ec 0c             	sub    $0xc,%esp
+ b0f:	50                   	push   %eax
+ b10:	e8 c8 fe ff ff       	call   9dd <free>
+ b15:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ b18:	a1 68 13 00 00       	mov    0x1368,%eax
+}
+ b1d:	c9                   	leave
+ b1e:	c3                   	ret
+
+00000b1f <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ b1f:	55                   	push   %ebp
+ b20:	89 e5                	mov    %esp,%ebp
+ b22:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b25:	8b 45 08             	mov    0x8(%ebp),%eax
+ b28:	83 c0 07             	add    $0x7,%eax
+ b2b:	c1 e8 03             	shr    $0x3,%eax
+ b2e:	83 c0 01             	add    $0x1,%eax
+ b31:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ b34:	a1 68 13 00 00       	mov    0x1368,%eax
+ b39:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ b3c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ b40:	75 23                	jne    b65 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ b42:	c7 45 f0 60 13 00 00 	movl   $0x1360,-0x10(%ebp)
+ b49:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b4c:	a3 68 13 00 00       	mov    %eax,0x1368
+ b51:	a1 68 13 00 00       	mov    0x1368,%eax
+ b56:	a3 60 13 00 00       	mov    %eax,0x1360
+    base.s.size = 0;
+ b5b:	c7 05 64 13 00 00 00 	movl   $0x0,0x1364
+ b62:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b65:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b68:	8b 00                	mov    (%eax),%eax
+ b6a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ b6d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b70:	8b 40 04             	mov    0x4(%eax),%eax
+ b73:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ b76:	72 4d                	jb     bc5 <malloc+0xa6>
+      if(p->s.size == nunits)
+ b78:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b7b:	8b 40 04             	mov    0x4(%eax),%eax
+ b7e:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ b81:	75 0c                	jne    b8f <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ b83:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b86:	8b 10                	mov    (%eax),%edx
+ b88:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b8b:	89 10                	mov    %edx,(%eax)
+ b8d:	eb 26                	jmp    bb5 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ b8f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b92:	8b 40 04             	mov    0x4(%eax),%eax
+ b95:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ b98:	89 c2                	mov    %eax,%edx
+ b9a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b9d:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ ba0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ba3:	8b 40 04             	mov    0x4(%eax),%eax
+ ba6:	c1 e0 03             	shl    $0x3,%eax
+ ba9:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ bac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ baf:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ bb2:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ bb5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ bb8:	a3 68 13 00 00       	mov    %eax,0x1368
+      return (void*)(p + 1);
+ bbd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bc0:	83 c0 08             	add    $0x8,%eax
+ bc3:	eb 3b                	jmp    c00 <malloc+0xe1>
+    }
+    if(p == freep)
+ bc5:	a1 68 13 00 00       	mov    0x1368,%eax
+ bca:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ bcd:	75 1e                	jne    bed <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ bcf:	83 ec 0c             	sub    $0xc,%esp
+ bd2:	ff 75 ec             	push   -0x14(%ebp)
+ bd5:	e8 e5 fe ff ff       	call   abf <morecore>
+ bda:	83 c4 10             	add    $0x10,%esp
+ bdd:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ be0:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ be4:	75 07                	jne    bed <malloc+0xce>
+        return 0;
+ be6:	b8 00 00 00 00       	mov    $0x0,%eax
+ beb:	eb 13                	jmp    c00 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ bed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bf0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ bf3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bf6:	8b 00                	mov    (%eax),%eax
+ bf8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ bfb:	e9 6d ff ff ff       	jmp    b6d <malloc+0x4e>
+  }
+}
+ c00:	c9                   	leave
+ c01:	c3                   	ret
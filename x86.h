@@ -151,6 +151,43 @@ xchg(volatile uint *addr, uint newval)
   return result;
 }
 
+// Read the time-stamp counter.
+static inline uint64_t
+rdtsc(void)
+{
+  uint64_t tsc;
+  asm volatile("rdtsc" : "=A" (tsc));
+  return tsc;
+}
+
+static inline uint64_t
+rdmsr(uint msr)
+{
+  uint64_t val;
+  asm volatile("rdmsr" : "=A" (val) : "c" (msr));
+  return val;
+}
+
+static inline void
+wrmsr(uint msr, uint64_t val)
+{
+  asm volatile("wrmsr" : : "c" (msr), "A" (val));
+}
+
+// Processor identification leaf `leaf`.
+static inline void
+cpuinfo(uint leaf, uint *a, uint *b, uint *c, uint *d)
+{
+  asm volatile("cpuid" : "=a" (*a), "=b" (*b), "=c" (*c), "=d" (*d) : "a" (leaf), "c" (0));
+}
+
+// Drain the write-combining buffers.
+static inline void
+sfence(void)
+{
+  asm volatile("sfence" : : : "memory");
+}
+
 static inline uint
 rcr2(void)
 {
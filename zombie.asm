@@ -0,0 +1,1375 @@
+
+_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  if(fork() > 0)
+  11:	e8 bc 04 00 00       	call   4d2 <fork>
+  16:	85 c0                	test   %eax,%eax
+  18:	7e 0d                	jle    27 <main+0x27>
+    sleep(5);  // Let child exit before parent.
+  1a:	83 ec 0c             	sub    $0xc,%esp
+  1d:	6a 05                	push   $0x5
+  1f:	e8 46 05 00 00       	call   56a <sleep>
+  24:	83 c4 10             	add    $0x10,%esp
+  exit();
+  27:	e8 ae 04 00 00       	call   4da <exit>
+
+0000002c <stosb>:
+}
+
+int
+stat(char *n, struct stat *st)
+{
+  int fd;
+  2c:	55                   	push   %ebp
+  2d:	89 e5                	mov    %esp,%ebp
+  2f:	57                   	push   %edi
+  30:	53                   	push   %ebx
+  int r;
+  31:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  34:	8b 55 10             	mov    0x10(%ebp),%edx
+  37:	8b 45 0c             	mov    0xc(%ebp),%eax
+  3a:	89 cb                	mov    %ecx,%ebx
+  3c:	89 df                	mov    %ebx,%edi
+  3e:	89 d1                	mov    %edx,%ecx
+  40:	fc                   	cld
+  41:	f3 aa                	rep stos %al,%es:(%edi)
+  43:	89 ca                	mov    %ecx,%edx
+  45:	89 fb                	mov    %edi,%ebx
+  47:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  4a:	89 55 10             	mov    %edx,0x10(%ebp)
+
+  fd = open(n, O_RDONLY);
+  if(fd < 0)
+    return -1;
+  4d:	90                   	nop
+  4e:	5b                   	pop    %ebx
+  4f:	5f                   	pop    %edi
+  50:	5d                   	pop    %ebp
+  51:	c3                   	ret
+
+00000052 <strcpy>:
+{
+  52:	55                   	push   %ebp
+  53:	89 e5                	mov    %esp,%ebp
+  55:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+  58:	8b 45 08             	mov    0x8(%ebp),%eax
+  5b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  5e:	90                   	nop
+  5f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  62:	8d 42 01             	lea    0x1(%edx),%eax
+  65:	89 45 0c             	mov    %eax,0xc(%ebp)
+  68:	8b 45 08             	mov    0x8(%ebp),%eax
+  6b:	8d 48 01             	lea    0x1(%eax),%ecx
+  6e:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  71:	0f b6 12             	movzbl (%edx),%edx
+  74:	88 10                	mov    %dl,(%eax)
+  76:	0f b6 00             	movzbl (%eax),%eax
+  79:	84 c0                	test   %al,%al
+  7b:	75 e2                	jne    5f <strcpy+0xd>
+  return os;
+  7d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  80:	c9                   	leave
+  81:	c3                   	ret
+
+00000082 <strlen>:
+{
+  82:	55                   	push   %ebp
+  83:	89 e5                	mov    %esp,%ebp
+  85:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+  88:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  8f:	eb 04                	jmp    95 <strlen+0x13>
+  91:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  95:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  98:	8b 45 08             	mov    0x8(%ebp),%eax
+  9b:	01 d0                	add    %edx,%eax
+  9d:	0f b6 00             	movzbl (%eax),%eax
+  a0:	84 c0                	test   %al,%al
+  a2:	75 ed                	jne    91 <strlen+0xf>
+  return n;
+  a4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  a7:	c9                   	leave
+  a8:	c3                   	ret
+
+000000a9 <memset>:
+{
+  a9:	55                   	push   %ebp
+  aa:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+  ac:	8b 45 10             	mov    0x10(%ebp),%eax
+  af:	50                   	push   %eax
+  b0:	ff 75 0c             	push   0xc(%ebp)
+  b3:	ff 75 08             	push   0x8(%ebp)
+  b6:	e8 71 ff ff ff       	call   2c <stosb>
+  bb:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+  be:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+  c1:	c9                   	leave
+  c2:	c3                   	ret
+
+000000c3 <strchr>:
+{
+  c3:	55                   	push   %ebp
+  c4:	89 e5                	mov    %esp,%ebp
+  c6:	83 ec 04             	sub    $0x4,%esp
+  c9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  cc:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+  cf:	eb 14                	jmp    e5 <strchr+0x22>
+    if(*s == c)
+  d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  d4:	0f b6 00             	movzbl (%eax),%eax
+  d7:	38 45 fc             	cmp    %al,-0x4(%ebp)
+  da:	75 05                	jne    e1 <strchr+0x1e>
+      return (char*)s;
+  dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  df:	eb 13                	jmp    f4 <strchr+0x31>
+  for(; *s; s++)
+  e1:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  e8:	0f b6 00             	movzbl (%eax),%eax
+  eb:	84 c0                	test   %al,%al
+  ed:	75 e2                	jne    d1 <strchr+0xe>
+  return 0;
+  ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  f4:	c9                   	leave
+  f5:	c3                   	ret
+
+000000f6 <gets>:
+{
+  f6:	55                   	push   %ebp
+  f7:	89 e5                	mov    %esp,%ebp
+  f9:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+  fc:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 103:	eb 42                	jmp    147 <gets+0x51>
+    cc = read(0, &c, 1);
+ 105:	83 ec 04             	sub    $0x4,%esp
+ 108:	6a 01                	push   $0x1
+ 10a:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 10d:	50                   	push   %eax
+ 10e:	6a 00                	push   $0x0
+ 110:	e8 dd 03 00 00       	call   4f2 <read>
+ 115:	83 c4 10             	add    $0x10,%esp
+ 118:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 11b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 11f:	7e 33                	jle    154 <gets+0x5e>
+    buf[i++] = c;
+ 121:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 124:	8d 50 01             	lea    0x1(%eax),%edx
+ 127:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 12a:	89 c2                	mov    %eax,%edx
+ 12c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 12f:	01 c2                	add    %eax,%edx
+ 131:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 135:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 137:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 13b:	3c 0a                	cmp    $0xa,%al
+ 13d:	74 16                	je     155 <gets+0x5f>
+ 13f:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 143:	3c 0d                	cmp    $0xd,%al
+ 145:	74 0e                	je     155 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 147:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 14a:	83 c0 01             	add    $0x1,%eax
+ 14d:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 150:	7f b3                	jg     105 <gets+0xf>
+ 152:	eb 01                	jmp    155 <gets+0x5f>
+      break;
+ 154:	90                   	nop
+  buf[i] = '\0';
+ 155:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 158:	8b 45 08             	mov    0x8(%ebp),%eax
+ 15b:	01 d0                	add    %edx,%eax
+ 15d:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 160:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 163:	c9                   	leave
+ 164:	c3                   	ret
+
+00000165 <stat>:
+{
+ 165:	55                   	push   %ebp
+ 166:	89 e5                	mov    %esp,%ebp
+ 168:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+ 16b:	83 ec 08             	sub    $0x8,%esp
+ 16e:	6a 00                	push   $0x0
+ 170:	ff 75 08             	push   0x8(%ebp)
+ 173:	e8 a2 03 00 00       	call   51a <open>
+ 178:	83 c4 10             	add    $0x10,%esp
+ 17b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 17e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 182:	79 07                	jns    18b <stat+0x26>
+    return -1;
+ 184:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 189:	eb 25                	jmp    1b0 <stat+0x4b>
+  r = fstat(fd, st);
+ 18b:	83 ec 08             	sub    $0x8,%esp
+ 18e:	ff 75 0c             	push   0xc(%ebp)
+ 191:	ff 75 f4             	push   -0xc(%ebp)
+ 194:	e8 99 03 00 00       	call   532 <fstat>
+ 199:	83 c4 10             	add    $0x10,%esp
+ 19c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 19f:	83 ec 0c             	sub    $0xc,%esp
+ 1a2:	ff 75 f4             	push   -0xc(%ebp)
+ 1a5:	e8 58 03 00 00       	call   502 <close>
+ 1aa:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 1ad:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 1b0:	c9                   	leave
+ 1b1:	c3                   	ret
+
+000001b2 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 1b2:	55                   	push   %ebp
+ 1b3:	89 e5                	mov    %esp,%ebp
+ 1b5:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+
+  dst = vdst;
+ 1b8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1bb:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 1be:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1c1:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 1c4:	eb 17                	jmp    1dd <memmove+0x2b>
+    *dst++ = *src++;
+ 1c6:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 1c9:	8d 42 01             	lea    0x1(%edx),%eax
+ 1cc:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 1cf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 1d2:	8d 48 01             	lea    0x1(%eax),%ecx
+ 1d5:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 1d8:	0f b6 12             	movzbl (%edx),%edx
+ 1db:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 1dd:	8b 45 10             	mov    0x10(%ebp),%eax
+ 1e0:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 1e3:	89 55 10             	mov    %edx,0x10(%ebp)
+ 1e6:	85 c0                	test   %eax,%eax
+ 1e8:	7f dc                	jg     1c6 <memmove+0x14>
+  return vdst;
+ 1ea:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1ed:	c9                   	leave
+ 1ee:	c3                   	ret
+
+000001ef <cpuinfo>:
+ 1ef:	55                   	push   %ebp
+ 1f0:	89 e5                	mov    %esp,%ebp
+ 1f2:	56                   	push   %esi
+ 1f3:	53                   	push   %ebx
+ 1f4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f7:	ba 00 00 00 00       	mov    $0x0,%edx
+ 1fc:	89 d1                	mov    %edx,%ecx
+ 1fe:	0f a2                	cpuid
+ 200:	89 c6                	mov    %eax,%esi
+ 202:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 205:	89 30                	mov    %esi,(%eax)
+ 207:	8b 45 10             	mov    0x10(%ebp),%eax
+ 20a:	89 18                	mov    %ebx,(%eax)
+ 20c:	8b 45 14             	mov    0x14(%ebp),%eax
+ 20f:	89 08                	mov    %ecx,(%eax)
+ 211:	8b 45 18             	mov    0x18(%ebp),%eax
+ 214:	89 10                	mov    %edx,(%eax)
+ 216:	90                   	nop
+ 217:	5b                   	pop    %ebx
+ 218:	5e                   	pop    %esi
+ 219:	5d                   	pop    %ebp
+ 21a:	c3                   	ret
+
+0000021b <atoi>:
+{
+ 21b:	55                   	push   %ebp
+ 21c:	89 e5                	mov    %esp,%ebp
+ 21e:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+ 221:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 228:	eb 25                	jmp    24f <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 22a:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 22d:	89 d0                	mov    %edx,%eax
+ 22f:	c1 e0 02             	shl    $0x2,%eax
+ 232:	01 d0                	add    %edx,%eax
+ 234:	01 c0                	add    %eax,%eax
+ 236:	89 c1                	mov    %eax,%ecx
+ 238:	8b 45 08             	mov    0x8(%ebp),%eax
+ 23b:	8d 50 01             	lea    0x1(%eax),%edx
+ 23e:	89 55 08             	mov    %edx,0x8(%ebp)
+ 241:	0f b6 00             	movzbl (%eax),%eax
+ 244:	0f be c0             	movsbl %al,%eax
+ 247:	01 c8                	add    %ecx,%eax
+ 249:	83 e8 30             	sub    $0x30,%eax
+ 24c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 24f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 252:	0f b6 00             	movzbl (%eax),%eax
+ 255:	3c 2f                	cmp    $0x2f,%al
+ 257:	7e 0a                	jle    263 <atoi+0x48>
+ 259:	8b 45 08             	mov    0x8(%ebp),%eax
+ 25c:	0f b6 00             	movzbl (%eax),%eax
+ 25f:	3c 39                	cmp    $0x39,%al
+ 261:	7e c7                	jle    22a <atoi+0xf>
+  return n;
+ 263:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 266:	c9                   	leave
+ 267:	c3                   	ret
+
+00000268 <strcmp>:
+{
+ 268:	55                   	push   %ebp
+ 269:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 26b:	eb 08                	jmp    275 <strcmp+0xd>
+    p++, q++;
+ 26d:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 271:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 275:	8b 45 08             	mov    0x8(%ebp),%eax
+ 278:	0f b6 00             	movzbl (%eax),%eax
+ 27b:	84 c0                	test   %al,%al
+ 27d:	74 10                	je     28f <strcmp+0x27>
+ 27f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 282:	0f b6 10             	movzbl (%eax),%edx
+ 285:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 288:	0f b6 00             	movzbl (%eax),%eax
+ 28b:	38 c2                	cmp    %al,%dl
+ 28d:	74 de                	je     26d <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 28f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 292:	0f b6 00             	movzbl (%eax),%eax
+ 295:	0f b6 d0             	movzbl %al,%edx
+ 298:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 29b:	0f b6 00             	movzbl (%eax),%eax
+ 29e:	0f b6 c0             	movzbl %al,%eax
+ 2a1:	29 c2                	sub    %eax,%edx
+ 2a3:	89 d0                	mov    %edx,%eax
+}
+ 2a5:	5d                   	pop    %ebp
+ 2a6:	c3                   	ret
+
+000002a7 <udiv64>:
+{
+ 2a7:	55                   	push   %ebp
+ 2a8:	89 e5                	mov    %esp,%ebp
+ 2aa:	57                   	push   %edi
+ 2ab:	56                   	push   %esi
+ 2ac:	83 ec 38             	sub    $0x38,%esp
+ 2af:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 2b5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2b8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 2bb:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2be:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 2c1:	8b 45 14             	mov    0x14(%ebp),%eax
+ 2c4:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  q = r = 0;
+ 2c7:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 2ce:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 2d5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 2d8:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 2db:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 2de:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 2e1:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 2e8:	e9 85 00 00 00       	jmp    372 <udiv64+0xcb>
+    r = (r << 1) | ((n >> i) & 1);
+ 2ed:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 2f0:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 2f3:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 2f7:	01 c0                	add    %eax,%eax
+ 2f9:	89 c6                	mov    %eax,%esi
+ 2fb:	89 d7                	mov    %edx,%edi
+ 2fd:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 300:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 303:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 306:	0f ad d0             	shrd   %cl,%edx,%eax
+ 309:	d3 ea                	shr    %cl,%edx
+ 30b:	f6 c1 20             	test   $0x20,%cl
+ 30e:	74 04                	je     314 <udiv64+0x6d>
+ 310:	89 d0                	mov    %edx,%eax
+ 312:	31 d2                	xor    %edx,%edx
+ 314:	83 e0 01             	and    $0x1,%eax
+ 317:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 31a:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+ 321:	89 f0                	mov    %esi,%eax
+ 323:	89 fa                	mov    %edi,%edx
+ 325:	0b 45 c0             	or     -0x40(%ebp),%eax
+ 328:	0b 55 c4             	or     -0x3c(%ebp),%edx
+ 32b:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 32e:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 331:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 334:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 337:	3b 45 c8             	cmp    -0x38(%ebp),%eax
+ 33a:	89 d0                	mov    %edx,%eax
+ 33c:	1b 45 cc             	sbb    -0x34(%ebp),%eax
+ 33f:	72 2d                	jb     36e <udiv64+0xc7>
+      r -= d;
+ 341:	8b 45 c8             	mov    -0x38(%ebp),%eax
+ 344:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 347:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 34a:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64_t)1 << i;
+ 34d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 350:	b8 01 00 00 00       	mov    $0x1,%eax
+ 355:	ba 00 00 00 00       	mov    $0x0,%edx
+ 35a:	0f a5 c2             	shld   %cl,%eax,%edx
+ 35d:	d3 e0                	shl    %cl,%eax
+ 35f:	f6 c1 20             	test   $0x20,%cl
+ 362:	74 04                	je     368 <udiv64+0xc1>
+ 364:	89 c2                	mov    %eax,%edx
+ 366:	31 c0                	xor    %eax,%eax
+ 368:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 36b:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 36e:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 372:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 376:	0f 89 71 ff ff ff    	jns    2ed <udiv64+0x46>
+  if(rem)
+ 37c:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+ 380:	74 0e                	je     390 <udiv64+0xe9>
+    *rem = r;
+ 382:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 385:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 388:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 38b:	89 01                	mov    %eax,(%ecx)
+ 38d:	89 51 04             	mov    %edx,0x4(%ecx)
+  return q;
+ 390:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 393:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 396:	83 c4 38             	add    $0x38,%esp
+ 399:	5e                   	pop    %esi
+ 39a:	5f                   	pop    %edi
+ 39b:	5d                   	pop    %ebp
+ 39c:	c3                   	ret
+
+0000039d <crc32cinit>:
+{
+ 39d:	55                   	push   %ebp
+ 39e:	89 e5                	mov    %esp,%ebp
+ 3a0:	83 ec 20             	sub    $0x20,%esp
+  for(i = 0; i < 256; i++){
+ 3a3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 3aa:	eb 4c                	jmp    3f8 <crc32cinit+0x5b>
+    r = i;
+ 3ac:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 3af:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+ 3b2:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+ 3b9:	eb 26                	jmp    3e1 <crc32cinit+0x44>
+      r = (r >> 1) ^ ((r & 1) ? CRC32C_POLY : 0);
+ 3bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3be:	d1 e8                	shr    %eax
+ 3c0:	89 c2                	mov    %eax,%edx
+ 3c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3c5:	83 e0 01             	and    $0x1,%eax
+ 3c8:	85 c0                	test   %eax,%eax
+ 3ca:	74 07                	je     3d3 <crc32cinit+0x36>
+ 3cc:	b8 78 3b f6 82       	mov    $0x82f63b78,%eax
+ 3d1:	eb 05                	jmp    3d8 <crc32cinit+0x3b>
+ 3d3:	b8 00 00 00 00       	mov    $0x0,%eax
+ 3d8:	31 d0                	xor    %edx,%eax
+ 3da:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(j = 0; j < 8; j++)
+ 3dd:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+ 3e1:	83 7d f8 07          	cmpl   $0x7,-0x8(%ebp)
+ 3e5:	76 d4                	jbe    3bb <crc32cinit+0x1e>
+    crc32ctab[i] = r;
+ 3e7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 3ea:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 3ed:	89 14 85 80 0d 00 00 	mov    %edx,0xd80(,%eax,4)
+  for(i = 0; i < 256; i++){
+ 3f4:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 3f8:	81 7d fc ff 00 00 00 	cmpl   $0xff,-0x4(%ebp)
+ 3ff:	76 ab                	jbe    3ac <crc32cinit+0xf>
+  cpuinfo(1, &a, &b, &c, &d);
+ 401:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 404:	50                   	push   %eax
+ 405:	8d 45 e8             	lea    -0x18(%ebp),%eax
+ 408:	50                   	push   %eax
+ 409:	8d 45 ec             	lea    -0x14(%ebp),%eax
+ 40c:	50                   	push   %eax
+ 40d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 410:	50                   	push   %eax
+ 411:	6a 01                	push   $0x1
+ 413:	e8 d7 fd ff ff       	call   1ef <cpuinfo>
+ 418:	83 c4 14             	add    $0x14,%esp
+  crc32chw = (c & CPUID_SSE42) != 0;
+ 41b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 41e:	25 00 00 10 00       	and    $0x100000,%eax
+ 423:	85 c0                	test   %eax,%eax
+ 425:	0f 95 c0             	setne  %al
+ 428:	0f b6 c0             	movzbl %al,%eax
+ 42b:	a3 4c 0d 00 00       	mov    %eax,0xd4c
+}
+ 430:	90                   	nop
+ 431:	c9                   	leave
+ 432:	c3                   	ret
+
+00000433 <crc32c>:
+{
+ 433:	55                   	push   %ebp
+ 434:	89 e5                	mov    %esp,%ebp
+ 436:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s = p;
+ 439:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 43c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(crc32chw < 0)
+ 43f:	a1 4c 0d 00 00       	mov    0xd4c,%eax
+ 444:	85 c0                	test   %eax,%eax
+ 446:	79 05                	jns    44d <crc32c+0x1a>
+    crc32cinit();
+ 448:	e8 50 ff ff ff       	call   39d <crc32cinit>
+  crc = ~crc;
+ 44d:	f7 55 08             	notl   0x8(%ebp)
+  if(crc32chw){
+ 450:	a1 4c 0d 00 00       	mov    0xd4c,%eax
+ 455:	85 c0                	test   %eax,%eax
+ 457:	74 6c                	je     4c5 <crc32c+0x92>
+    for(; n >= 4; n -= 4, s += 4)
+ 459:	eb 18                	jmp    473 <crc32c+0x40>
+      asm("crc32l %1, %0" : "+r" (crc) : "rm" (*(const uint*)s));
+ 45b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 45e:	8b 10                	mov    (%eax),%edx
+ 460:	8b 45 08             	mov    0x8(%ebp),%eax
+ 463:	f2 0f 38 f1 c2       	crc32  %edx,%eax
+ 468:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n >= 4; n -= 4, s += 4)
+ 46b:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+ 46f:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+ 473:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+ 477:	77 e2                	ja     45b <crc32c+0x28>
+    for(; n > 0; n--, s++)
+ 479:	eb 19                	jmp    494 <crc32c+0x61>
+      asm("crc32b %1, %0" : "+r" (crc) : "qm" (*s));
+ 47b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 47e:	0f b6 10             	movzbl (%eax),%edx
+ 481:	8b 45 08             	mov    0x8(%ebp),%eax
+ 484:	f2 0f 38 f0 c2       	crc32  %dl,%eax
+ 489:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+ 48c:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+ 490:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 494:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 498:	75 e1                	jne    47b <crc32c+0x48>
+ 49a:	eb 2f                	jmp    4cb <crc32c+0x98>
+      crc = crc32ctab[(crc ^ *s) & 0xff] ^ (crc >> 8);
+ 49c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 49f:	0f b6 00             	movzbl (%eax),%eax
+ 4a2:	0f b6 c0             	movzbl %al,%eax
+ 4a5:	33 45 08             	xor    0x8(%ebp),%eax
+ 4a8:	0f b6 c0             	movzbl %al,%eax
+ 4ab:	8b 04 85 80 0d 00 00 	mov    0xd80(,%eax,4),%eax
+ 4b2:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4b5:	c1 ea 08             	shr    $0x8,%edx
+ 4b8:	31 d0                	xor    %edx,%eax
+ 4ba:	89 45 08             	mov    %eax,0x8(%ebp)
+    for(; n > 0; n--, s++)
+ 4bd:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+ 4c1:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 4c5:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 4c9:	75 d1                	jne    49c <crc32c+0x69>
+  return ~crc;
+ 4cb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4ce:	f7 d0                	not    %eax
+}
+ 4d0:	c9                   	leave
+ 4d1:	c3                   	ret
+
+000004d2 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 4d2:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4d7:	cd 40                	int    $0x40
+ 4d9:	c3                   	ret
+
+000004da <exit>:
+SYSCALL(exit)
+ 4da:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4df:	cd 40                	int    $0x40
+ 4e1:	c3                   	ret
+
+000004e2 <wait>:
+SYSCALL(wait)
+ 4e2:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4e7:	cd 40                	int    $0x40
+ 4e9:	c3                   	ret
+
+000004ea <pipe>:
+SYSCALL(pipe)
+ 4ea:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4ef:	cd 40                	int    $0x40
+ 4f1:	c3                   	ret
+
+000004f2 <read>:
+SYSCALL(read)
+ 4f2:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4f7:	cd 40                	int    $0x40
+ 4f9:	c3                   	ret
+
+000004fa <write>:
+SYSCALL(write)
+ 4fa:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4ff:	cd 40                	int    $0x40
+ 501:	c3                   	ret
+
+00000502 <close>:
+SYSCALL(close)
+ 502:	b8 15 00 00 00       	mov    $0x15,%eax
+ 507:	cd 40                	int    $0x40
+ 509:	c3                   	ret
+
+0000050a <kill>:
+SYSCALL(kill)
+ 50a:	b8 06 00 00 00       	mov    $0x6,%eax
+ 50f:	cd 40                	int    $0x40
+ 511:	c3                   	ret
+
+00000512 <exec>:
+SYSCALL(exec)
+ 512:	b8 07 00 00 00       	mov    $0x7,%eax
+ 517:	cd 40                	int    $0x40
+ 519:	c3                   	ret
+
+0000051a <open>:
+SYSCALL(open)
+ 51a:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 51f:	cd 40                	int    $0x40
+ 521:	c3                   	ret
+
+00000522 <mknod>:
+SYSCALL(mknod)
+ 522:	b8 11 00 00 00       	mov    $0x11,%eax
+ 527:	cd 40                	int    $0x40
+ 529:	c3                   	ret
+
+0000052a <unlink>:
+SYSCALL(unlink)
+ 52a:	b8 12 00 00 00       	mov    $0x12,%eax
+ 52f:	cd 40                	int    $0x40
+ 531:	c3                   	ret
+
+00000532 <fstat>:
+SYSCALL(fstat)
+ 532:	b8 08 00 00 00       	mov    $0x8,%eax
+ 537:	cd 40                	int    $0x40
+ 539:	c3                   	ret
+
+0000053a <link>:
+SYSCALL(link)
+ 53a:	b8 13 00 00 00       	mov    $0x13,%eax
+ 53f:	cd 40                	int    $0x40
+ 541:	c3                   	ret
+
+00000542 <mkdir>:
+SYSCALL(mkdir)
+ 542:	b8 14 00 00 00       	mov    $0x14,%eax
+ 547:	cd 40                	int    $0x40
+ 549:	c3                   	ret
+
+0000054a <chdir>:
+SYSCALL(chdir)
+ 54a:	b8 09 00 00 00       	mov    $0x9,%eax
+ 54f:	cd 40                	int    $0x40
+ 551:	c3                   	ret
+
+00000552 <dup>:
+SYSCALL(dup)
+ 552:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 557:	cd 40                	int    $0x40
+ 559:	c3                   	ret
+
+0000055a <getpid>:
+SYSCALL(getpid)
+ 55a:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 55f:	cd 40                	int    $0x40
+ 561:	c3                   	ret
+
+00000562 <sbrk>:
+SYSCALL(sbrk)
+ 562:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 567:	cd 40                	int    $0x40
+ 569:	c3                   	ret
+
+0000056a <sleep>:
+SYSCALL(sleep)
+ 56a:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 56f:	cd 40                	int    $0x40
+ 571:	c3                   	ret
+
+00000572 <uptime>:
+SYSCALL(uptime)
+ 572:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 577:	cd 40                	int    $0x40
+ 579:	c3                   	ret
+
+0000057a <arp>:
+SYSCALL(arp)
+ 57a:	b8 16 00 00 00       	mov    $0x16,%eax
+ 57f:	cd 40                	int    $0x40
+ 581:	c3                   	ret
+
+00000582 <ifstat>:
+SYSCALL(ifstat)
+ 582:	b8 17 00 00 00       	mov    $0x17,%eax
+ 587:	cd 40                	int    $0x40
+ 589:	c3                   	ret
+
+0000058a <pcapctl>:
+SYSCALL(pcapctl)
+ 58a:	b8 18 00 00 00       	mov    $0x18,%eax
+ 58f:	cd 40                	int    $0x40
+ 591:	c3                   	ret
+
+00000592 <pcapread>:
+SYSCALL(pcapread)
+ 592:	b8 19 00 00 00       	mov    $0x19,%eax
+ 597:	cd 40                	int    $0x40
+ 599:	c3                   	ret
+
+0000059a <bpfattach>:
+SYSCALL(bpfattach)
+ 59a:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 59f:	cd 40                	int    $0x40
+ 5a1:	c3                   	ret
+
+000005a2 <pktgen>:
+SYSCALL(pktgen)
+ 5a2:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5a7:	cd 40                	int    $0x40
+ 5a9:	c3                   	ret
+
+000005aa <reflect>:
+SYSCALL(reflect)
+ 5aa:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5af:	cd 40                	int    $0x40
+ 5b1:	c3                   	ret
+
+000005b2 <brctl>:
+SYSCALL(brctl)
+ 5b2:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5b7:	cd 40                	int    $0x40
+ 5b9:	c3                   	ret
+
+000005ba <hostopen>:
+SYSCALL(hostopen)
+ 5ba:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5bf:	cd 40                	int    $0x40
+ 5c1:	c3                   	ret
+
+000005c2 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 5c2:	55                   	push   %ebp
+ 5c3:	89 e5                	mov    %esp,%ebp
+ 5c5:	83 ec 18             	sub    $0x18,%esp
+ 5c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5cb:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 5ce:	83 ec 04             	sub    $0x4,%esp
+ 5d1:	6a 01                	push   $0x1
+ 5d3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 5d6:	50                   	push   %eax
+ 5d7:	ff 75 08             	push   0x8(%ebp)
+ 5da:	e8 1b ff ff ff       	call   4fa <write>
+ 5df:	83 c4 10             	add    $0x10,%esp
+}
+ 5e2:	90                   	nop
+ 5e3:	c9                   	leave
+ 5e4:	c3                   	ret
+
+000005e5 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5e5:	55                   	push   %ebp
+ 5e6:	89 e5                	mov    %esp,%ebp
+ 5e8:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 5eb:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 5f2:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 5f6:	74 17                	je     60f <printint+0x2a>
+ 5f8:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 5fc:	79 11                	jns    60f <printint+0x2a>
+    neg = 1;
+ 5fe:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 605:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 608:	f7 d8                	neg    %eax
+ 60a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 60d:	eb 06                	jmp    615 <printint+0x30>
+  } else {
+    x = xx;
+ 60f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 612:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 615:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 61c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 61f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 622:	ba 00 00 00 00       	mov    $0x0,%edx
+ 627:	f7 f1                	div    %ecx
+ 629:	89 d1                	mov    %edx,%ecx
+ 62b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 62e:	8d 50 01             	lea    0x1(%eax),%edx
+ 631:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 634:	0f b6 91 50 0d 00 00 	movzbl 0xd50(%ecx),%edx
+ 63b:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 63f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 642:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 645:	ba 00 00 00 00       	mov    $0x0,%edx
+ 64a:	f7 f1                	div    %ecx
+ 64c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 64f:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 653:	75 c7                	jne    61c <printint+0x37>
+  if(neg)
+ 655:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 659:	74 2d                	je     688 <printint+0xa3>
+    buf[i++] = '-';
+ 65b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 65e:	8d 50 01             	lea    0x1(%eax),%edx
+ 661:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 664:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 669:	eb 1d                	jmp    688 <printint+0xa3>
+    putc(fd, buf[i]);
+ 66b:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 66e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 671:	01 d0                	add    %edx,%eax
+ 673:	0f b6 00             	movzbl (%eax),%eax
+ 676:	0f be c0             	movsbl %al,%eax
+ 679:	83 ec 08             	sub    $0x8,%esp
+ 67c:	50                   	push   %eax
+ 67d:	ff 75 08             	push   0x8(%ebp)
+ 680:	e8 3d ff ff ff       	call   5c2 <putc>
+ 685:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 688:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 68c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 690:	79 d9                	jns    66b <printint+0x86>
+}
+ 692:	90                   	nop
+ 693:	90                   	nop
+ 694:	c9                   	leave
+ 695:	c3                   	ret
+
+00000696 <printf>:
+
+// Print to the given fd. Only understands %d, %u, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 696:	55                   	push   %ebp
+ 697:	89 e5                	mov    %esp,%ebp
+ 699:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 69c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 6a3:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 6a6:	83 c0 04             	add    $0x4,%eax
+ 6a9:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 6ac:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 6b3:	e9 7d 01 00 00       	jmp    835 <printf+0x19f>
+    c = fmt[i] & 0xff;
+ 6b8:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 6bb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 6be:	01 d0                	add    %edx,%eax
+ 6c0:	0f b6 00             	movzbl (%eax),%eax
+ 6c3:	0f be c0             	movsbl %al,%eax
+ 6c6:	25 ff 00 00 00       	and    $0xff,%eax
+ 6cb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 6ce:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 6d2:	75 2c                	jne    700 <printf+0x6a>
+      if(c == '%'){
+ 6d4:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 6d8:	75 0c                	jne    6e6 <printf+0x50>
+        state = '%';
+ 6da:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 6e1:	e9 4b 01 00 00       	jmp    831 <printf+0x19b>
+      } else {
+        putc(fd, c);
+ 6e6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 6e9:	0f be c0             	movsbl %al,%eax
+ 6ec:	83 ec 08             	sub    $0x8,%esp
+ 6ef:	50                   	push   %eax
+ 6f0:	ff 75 08             	push   0x8(%ebp)
+ 6f3:	e8 ca fe ff ff       	call   5c2 <putc>
+ 6f8:	83 c4 10             	add    $0x10,%esp
+ 6fb:	e9 31 01 00 00       	jmp    831 <printf+0x19b>
+      }
+    } else if(state == '%'){
+ 700:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 704:	0f 85 27 01 00 00    	jne    831 <printf+0x19b>
+      if(c == 'd'){
+ 70a:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 70e:	75 1e                	jne    72e <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 710:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 713:	8b 00                	mov    (%eax),%eax
+ 715:	6a 01                	push   $0x1
+ 717:	6a 0a                	push   $0xa
+ 719:	50                   	push   %eax
+ 71a:	ff 75 08             	push   0x8(%ebp)
+ 71d:	e8 c3 fe ff ff       	call   5e5 <printint>
+ 722:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 725:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 729:	e9 fc 00 00 00       	jmp    82a <printf+0x194>
+      } else if(c == 'u'){
+ 72e:	83 7d e4 75          	cmpl   $0x75,-0x1c(%ebp)
+ 732:	75 1e                	jne    752 <printf+0xbc>
+        printint(fd, *ap, 10, 0);
+ 734:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 737:	8b 00                	mov    (%eax),%eax
+ 739:	6a 00                	push   $0x0
+ 73b:	6a 0a                	push   $0xa
+ 73d:	50                   	push   %eax
+ 73e:	ff 75 08             	push   0x8(%ebp)
+ 741:	e8 9f fe ff ff       	call   5e5 <printint>
+ 746:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 749:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 74d:	e9 d8 00 00 00       	jmp    82a <printf+0x194>
+      } else if(c == 'x' || c == 'p'){
+ 752:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 756:	74 06                	je     75e <printf+0xc8>
+ 758:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 75c:	75 1e                	jne    77c <printf+0xe6>
+        printint(fd, *ap, 16, 0);
+ 75e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 761:	8b 00                	mov    (%eax),%eax
+ 763:	6a 00                	push   $0x0
+ 765:	6a 10                	push   $0x10
+ 767:	50                   	push   %eax
+ 768:	ff 75 08             	push   0x8(%ebp)
+ 76b:	e8 75 fe ff ff       	call   5e5 <printint>
+ 770:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 773:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 777:	e9 ae 00 00 00       	jmp    82a <printf+0x194>
+      } else if(c == 's'){
+ 77c:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 780:	75 43                	jne    7c5 <printf+0x12f>
+        s = (char*)*ap;
+ 782:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 785:	8b 00                	mov    (%eax),%eax
+ 787:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 78a:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 78e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 792:	75 25                	jne    7b9 <printf+0x123>
+          s = "(null)";
+ 794:	c7 45 f4 71 0a 00 00 	movl   $0xa71,-0xc(%ebp)
+        while(*s != 0){
+ 79b:	eb 1c                	jmp    7b9 <printf+0x123>
+          putc(fd, *s);
+ 79d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7a0:	0f b6 00             	movzbl (%eax),%eax
+ 7a3:	0f be c0             	movsbl %al,%eax
+ 7a6:	83 ec 08             	sub    $0x8,%esp
+ 7a9:	50                   	push   %eax
+ 7aa:	ff 75 08             	push   0x8(%ebp)
+ 7ad:	e8 10 fe ff ff       	call   5c2 <putc>
+ 7b2:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 7b5:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 7b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7bc:	0f b6 00             	movzbl (%eax),%eax
+ 7bf:	84 c0                	test   %al,%al
+ 7c1:	75 da                	jne    79d <printf+0x107>
+ 7c3:	eb 65                	jmp    82a <printf+0x194>
+        }
+      } else if(c == 'c'){
+ 7c5:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 7c9:	75 1d                	jne    7e8 <printf+0x152>
+        putc(fd, *ap);
+ 7cb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7ce:	8b 00                	mov    (%eax),%eax
+ 7d0:	0f be c0             	movsbl %al,%eax
+ 7d3:	83 ec 08             	sub    $0x8,%esp
+ 7d6:	50                   	push   %eax
+ 7d7:	ff 75 08             	push   0x8(%ebp)
+ 7da:	e8 e3 fd ff ff       	call   5c2 <putc>
+ 7df:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 7e2:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7e6:	eb 42                	jmp    82a <printf+0x194>
+      } else if(c == '%'){
+ 7e8:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 7ec:	75 17                	jne    805 <printf+0x16f>
+        putc(fd, c);
+ 7ee:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7f1:	0f be c0             	movsbl %al,%eax
+ 7f4:	83 ec 08             	sub    $0x8,%esp
+ 7f7:	50                   	push   %eax
+ 7f8:	ff 75 08             	push   0x8(%ebp)
+ 7fb:	e8 c2 fd ff ff       	call   5c2 <putc>
+ 800:	83 c4 10             	add    $0x10,%esp
+ 803:	eb 25                	jmp    82a <printf+0x194>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 805:	83 ec 08             	sub    $0x8,%esp
+ 808:	6a 25                	push   $0x25
+ 80a:	ff 75 08             	push   0x8(%ebp)
+ 80d:	e8 b0 fd ff ff       	call   5c2 <putc>
+ 812:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 815:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 818:	0f be c0             	movsbl %al,%eax
+ 81b:	83 ec 08             	sub    $0x8,%esp
+ 81e:	50                   	push   %eax
+ 81f:	ff 75 08             	push   0x8(%ebp)
+ 822:	e8 9b fd ff ff       	call   5c2 <putc>
+ 827:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 82a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 831:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 835:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 838:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 83b:	01 d0                	add    %edx,%eax
+ 83d:	0f b6 00             	movzbl (%eax),%eax
+ 840:	84 c0                	test   %al,%al
+ 842:	0f 85 70 fe ff ff    	jne    6b8 <printf+0x22>
+    }
+  }
+}
+ 848:	90                   	nop
+ 849:	90                   	nop
+ 84a:	c9                   	leave
+ 84b:	c3                   	ret
+
+0000084c <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 84c:	55                   	push   %ebp
+ 84d:	89 e5                	mov    %esp,%ebp
+ 84f:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 852:	8b 45 08             	mov    0x8(%ebp),%eax
+ 855:	83 e8 08             	sub    $0x8,%eax
+ 858:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 85b:	a1 88 11 00 00       	mov    0x1188,%eax
+ 860:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 863:	eb 24                	jmp    889 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 865:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 868:	8b 00                	mov    (%eax),%eax
+ 86a:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 86d:	72 12                	jb     881 <free+0x35>
+ 86f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 872:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 875:	72 24                	jb     89b <free+0x4f>
+ 877:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 87a:	8b 00                	mov    (%eax),%eax
+ 87c:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 87f:	72 1a                	jb     89b <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 881:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 884:	8b 00                	mov    (%eax),%eax
+ 886:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 889:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 88c:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 88f:	73 d4                	jae    865 <free+0x19>
+ 891:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 894:	8b 00                	mov    (%eax),%eax
+ 896:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 899:	73 ca                	jae    865 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 89b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 89e:	8b 40 04             	mov    0x4(%eax),%eax
+ 8a1:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 8a8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8ab:	01 c2                	add    %eax,%edx
+ 8ad:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8b0:	8b 00                	mov    (%eax),%eax
+ 8b2:	39 c2                	cmp    %eax,%edx
+ 8b4:	75 24                	jne    8da <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 8b6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8b9:	8b 50 04             	mov    0x4(%eax),%edx
+ 8bc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8bf:	8b 00                	mov    (%eax),%eax
+ 8c1:	8b 40 04             	mov    0x4(%eax),%eax
+ 8c4:	01 c2                	add    %eax,%edx
+ 8c6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8c9:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8cc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8cf:	8b 00                	mov    (%eax),%eax
+ 8d1:	8b 10                	mov    (%eax),%edx
+ 8d3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8d6:	89 10                	mov    %edx,(%eax)
+ 8d8:	eb 0a                	jmp    8e4 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 8da:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8dd:	8b 10                	mov    (%eax),%edx
+ 8df:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8e2:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 8e4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8e7:	8b 40 04             	mov    0x4(%eax),%eax
+ 8ea:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 8f1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8f4:	01 d0                	add    %edx,%eax
+ 8f6:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 8f9:	75 20                	jne    91b <free+0xcf>
+    p->s.size += bp->s.size;
+ 8fb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8fe:	8b 50 04             	mov    0x4(%eax),%edx
+ 901:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 904:	8b 40 04             	mov    0x4(%eax),%eax
+ 907:	01 c2                	add    %eax,%edx
+ 909:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 90c:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 90f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 912:	8b 10                	mov    (%eax),%edx
+ 914:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 917:	89 10                	mov    %edx,(%eax)
+ 919:	eb 08                	jmp    923 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 91b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 91e:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 921:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 923:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 926:	a3 88 11 00 00       	mov    %eax,0x1188
+}
+ 92b:	90                   	nop
+ 92c:	c9                   	leave
+ 92d:	c3                   	ret
+
+0000092e <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 92e:	55                   	push   %ebp
+ 92f:	89 e5                	mov    %esp,%ebp
+ 931:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 934:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 93b:	77 07                	ja     944 <morecore+0x16>
+    nu = 4096;
+ 93d:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 944:	8b 45 08             	mov    0x8(%ebp),%eax
+ 947:	c1 e0 03             	shl    $0x3,%eax
+ 94a:	83 ec 0c             	sub    $0xc,%esp
+ 94d:	50                   	push   %eax
+ 94e:	e8 0f fc ff ff       	call   562 <sbrk>
+ 953:	83 c4 10             	add    $0x10,%esp
+ 956:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 959:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 95d:	75 07                	jne    966 <morecore+0x38>
+    return 0;
+ 95f:	b8 00 00 00 00       	mov    $0x0,%eax
+ 964:	eb 26                	jmp    98c <morecore+0x5e>
+  hp = (Header*)p;
+ 966:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 969:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 96c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 96f:	8b 55 08             	mov    0x8(%ebp),%edx
+ 972:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 975:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 978:	83 c0 08             	add    $0x8,%eax
+ 97b:	83 ec 0c             	sub    $0xc,%esp
+ 97e:	50                   	push   %eax
+ 97f:	e8 c8 fe ff ff       	call   84c <free>
+ 984:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 987:	a1 88 11 00 00       	mov    0x1188,%eax
+}
+ 98c:	c9                   	leave
+ 98d:	c3                   	ret
+
+0000098e <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 98e:	55                   	push   %ebp
+ 98f:	89 e5                	mov    %esp,%ebp
+ 991:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 994:	8b 45 08             	mov    0x8(%ebp),%eax
+ 997:	83 c0 07             	add    $0x7,%eax
+ 99a:	c1 e8 03             	shr    $0x3,%eax
+ 99d:	83 c0 01             	add    $0x1,%eax
+ 9a0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 9a3:	a1 88 11 00 00       	mov    0x1188,%eax
+ 9a8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 9ab:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 9af:	75 23                	jne    9d4 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 9b1:	c7 45 f0 80 11 00 00 	movl   $0x1180,-0x10(%ebp)
+ 9b8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9bb:	a3 88 11 00 00       	mov    %eax,0x1188
+ 9c0:	a1 88 11 00 00       	mov    0x1188,%eax
+ 9c5:	a3 80 11 00 00       	mov    %eax,0x1180
+    base.s.size = 0;
+ 9ca:	c7 05 84 11 00 00 00 	movl   $0x0,0x1184
+ 9d1:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9d4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9d7:	8b 00                	mov    (%eax),%eax
+ 9d9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 9dc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9df:	8b 40 04             	mov    0x4(%eax),%eax
+ 9e2:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 9e5:	72 4d                	jb     a34 <malloc+0xa6>
+      if(p->s.size == nunits)
+ 9e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9ea:	8b 40 04             	mov    0x4(%eax),%eax
+ 9ed:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 9f0:	75 0c                	jne    9fe <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 9f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9f5:	8b 10                	mov    (%eax),%edx
+ 9f7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9fa:	89 10                	mov    %edx,(%eax)
+ 9fc:	eb 26                	jmp    a24 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 9fe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a01:	8b 40 04             	mov    0x4(%eax),%eax
+ a04:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ a07:	89 c2                	mov    %eax,%edx
+ a09:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a0c:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ a0f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a12:	8b 40 04             	mov    0x4(%eax),%eax
+ a15:	c1 e0 03             	shl    $0x3,%eax
+ a18:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ a1b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a1e:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ a21:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ a24:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a27:	a3 88 11 00 00       	mov    %eax,0x1188
+      return (void*)(p + 1);
+ a2c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a2f:	83 c0 08             	add    $0x8,%eax
+ a32:	eb 3b                	jmp    a6f <malloc+0xe1>
+    }
+    if(p == freep)
+ a34:	a1 88 11 00 00       	mov    0x1188,%eax
+ a39:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ a3c:	75 1e                	jne    a5c <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ a3e:	83 ec 0c             	sub    $0xc,%esp
+ a41:	ff 75 ec             	push   -0x14(%ebp)
+ a44:	e8 e5 fe ff ff       	call   92e <morecore>
+ a49:	83 c4 10             	add    $0x10,%esp
+ a4c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ a4f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a53:	75 07                	jne    a5c <malloc+0xce>
+        return 0;
+ a55:	b8 00 00 00 00       	mov    $0x0,%eax
+ a5a:	eb 13                	jmp    a6f <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a5c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a5f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ a62:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a65:	8b 00                	mov    (%eax),%eax
+ a67:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ a6a:	e9 6d ff ff ff       	jmp    9dc <malloc+0x4e>
+  }
+}
+ a6f:	c9                   	leave
+ a70:	c3                   	ret